@@ -47,6 +47,8 @@ def convert_type(t):
         return "F32"
     elif t == "f64":
         return "F64"
+    elif t == "v128":
+        return "V128"
     raise Exception("unsupported type {}".format(t))
 
 
@@ -74,6 +76,49 @@ def convert_value(value, t):
     raise Exception("unsupported type {}".format(t))
 
 
+v128_lane_formats = {
+    'i8': 'B',
+    'i16': 'H',
+    'i32': 'I',
+    'i64': 'Q',
+    'f32': 'I',
+    'f64': 'Q',
+}
+
+
+def convert_v128(lane_type, values):
+    lane_format = v128_lane_formats[lane_type]
+    data = struct.pack('<' + lane_format * len(values), *(int(v) for v in values))
+    lanes = struct.unpack('<4I', data)
+    return 'v128_const({})'.format(', '.join('0x{:08X}u'.format(lane) for lane in lanes))
+
+
+def convert_arg(arg):
+    t = convert_type(arg['type'])
+    if t == 'V128':
+        return convert_v128(arg['lane_type'], arg['value'])
+    return convert_value(arg['value'], t)
+
+
+multi_value_type_codes = {
+    'i32': 'i',
+    'i64': 'j',
+    'f32': 'f',
+    'f64': 'd',
+    'v128': 'v',
+}
+
+
+def multi_value_type_name(types):
+    return 'wasmMultiValue_' + ''.join(multi_value_type_codes[t] for t in types)
+
+
+def is_nan_value(value):
+    if isinstance(value, list):
+        return any(is_nan_value(v) for v in value)
+    return value.startswith('nan')
+
+
 invalid_char_regex = re.compile('[^a-zA-Z0-9]')
 
 def generate_test_files(json_path):
@@ -103,6 +148,13 @@ void test() {{
         test_file = open(test_path, 'w')
         test_file.write(test_preamble)
 
+    def write_assertion(indent, expected_type, actual, expected_value, description):
+        test_file.write("{}assertEqual{}(\n".format(indent, expected_type))
+        test_file.write("{}    {},\n".format(indent, actual))
+        test_file.write("{}    {},\n".format(indent, expected_value))
+        test_file.write("{}    \"{}\"\n".format(indent, description))
+        test_file.write("{});\n".format(indent))
+
     def close_test_file():
         nonlocal test_file
         if not test_file:
@@ -132,11 +184,11 @@ void test() {{
                     continue
 
                 # TODO:
-                if 'nan' in (arg['value'] for arg in action['args']):
+                if any(is_nan_value(arg['value']) for arg in action['args']):
                     continue
 
                 args = [
-                    convert_value(arg['value'], convert_type(arg['type']))
+                    convert_arg(arg)
                     for arg in action['args']
                 ]
 
@@ -162,27 +214,40 @@ void test() {{
                         test_file.write("    {};\n".format(call))
                         continue
 
-                    # TODO: add support for multiple result values
-                    if len(expected) > 1:
-                        continue
-
-                    expected_type = convert_type(expected[0]['type'])
-                    expected_value = expected[0]['value']
                     # TODO:
-                    if expected_value.startswith('nan'):
+                    if any(is_nan_value(value['value']) for value in expected):
                         continue
 
-                    expected_value = convert_value(expected_value, expected_type)
+                    expected_values = [convert_arg(value) for value in expected]
 
                     # TODO:
-                    if expected_value == 'nan':
+                    if 'nan' in expected_values:
+                        continue
+
+                    if len(expected) == 1:
+                        write_assertion(
+                            "    ",
+                            convert_type(expected[0]['type']),
+                            call,
+                            expected_values[0],
+                            description
+                        )
                         continue
 
-                    test_file.write("    assertEqual{}(\n".format(expected_type))
-                    test_file.write("        {},\n".format(call))
-                    test_file.write("        {},\n".format(expected_value))
-                    test_file.write("        \"{}\"\n".format(description))
-                    test_file.write("    );\n")
+                    # Functions with multiple results return a struct,
+                    # with the results in the fields v0, v1, etc.
+                    result_type = multi_value_type_name(value['type'] for value in expected)
+                    test_file.write("    {\n")
+                    test_file.write("        {} results = {};\n".format(result_type, call))
+                    for i, value in enumerate(expected):
+                        write_assertion(
+                            "        ",
+                            convert_type(value['type']),
+                            "results.v{}".format(i),
+                            expected_values[i],
+                            "{}.v{}".format(description, i)
+                        )
+                    test_file.write("    }\n")
 
                 elif t == 'action':
                     test_file.write("    {};\n".format(call))
@@ -208,6 +273,11 @@ def gen(paths):
         else:
             if wast_path in memory_files:
                 wast2json_opts.append('--enable-bulk-memory')
+            if wast_path.startswith('simd_'):
+                wast2json_opts.append('--enable-simd')
+
+        if wast_path.startswith('return_call'):
+            wast2json_opts.append('--enable-tail-call')
 
         # Convert WAST to JSON and WASM files, if needed
         json_path = gen_dir / Path(wast_path).with_suffix('.json').name
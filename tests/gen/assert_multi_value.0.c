@@ -0,0 +1,638 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_multi_value.0.h"
+
+void test() {
+    multivalue0Instance instance;
+    multivalue0Instantiate(&instance, resolveTestImports);
+    printStart("multi_value.0.wasm");
+    {
+        wasmMultiValue_ij results = multivalue0_valueX2Di32X2Di64(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "value-i32-i64().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            2ull,
+            "value-i32-i64().v1"
+        );
+    }
+    {
+        wasmMultiValue_iii results = multivalue0_valueX2Di32X2Di32X2Di32(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "value-i32-i32-i32().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "value-i32-i32-i32().v1"
+        );
+        assertEqualU32(
+            results.v2,
+            3u,
+            "value-i32-i32-i32().v2"
+        );
+    }
+    {
+        wasmMultiValue_fd results = multivalue0_valueX2Df32X2Df64(&instance);
+        assertEqualF32(
+            results.v0,
+            1.5,
+            "value-f32-f64().v0"
+        );
+        assertEqualF64(
+            results.v1,
+            -12.0,
+            "value-f32-f64().v1"
+        );
+    }
+    {
+        wasmMultiValue_ijfdi results = multivalue0_valueX2Dall(&instance);
+        assertEqualU32(
+            results.v0,
+            4294967295u,
+            "value-all().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            9223372036854775807ull,
+            "value-all().v1"
+        );
+        assertEqualF32(
+            results.v2,
+            -INFINITY,
+            "value-all().v2"
+        );
+        assertEqualF64(
+            results.v3,
+            5e-324,
+            "value-all().v3"
+        );
+        assertEqualU32(
+            results.v4,
+            5u,
+            "value-all().v4"
+        );
+    }
+    {
+        wasmMultiValue_vi results = multivalue0_valueX2Dv128X2Di32(&instance);
+        assertEqualV128(
+            results.v0,
+            v128_const(0x00000001u, 0x00000002u, 0x00000003u, 0x00000004u),
+            "value-v128-i32().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            5u,
+            "value-v128-i32().v1"
+        );
+    }
+    {
+        wasmMultiValue_dfji results = multivalue0_paramX2Dpass(&instance, 1u, 2ull, 3.5, 4.25);
+        assertEqualF64(
+            results.v0,
+            4.25,
+            "param-pass(1u, 2ull, 3.5, 4.25).v0"
+        );
+        assertEqualF32(
+            results.v1,
+            3.5,
+            "param-pass(1u, 2ull, 3.5, 4.25).v1"
+        );
+        assertEqualU64(
+            results.v2,
+            2ull,
+            "param-pass(1u, 2ull, 3.5, 4.25).v2"
+        );
+        assertEqualU32(
+            results.v3,
+            1u,
+            "param-pass(1u, 2ull, 3.5, 4.25).v3"
+        );
+    }
+    {
+        wasmMultiValue_dfji results = multivalue0_paramX2Dpass(&instance, 4294967295u, 18446744073709551614ull, -INFINITY, INFINITY);
+        assertEqualF64(
+            results.v0,
+            INFINITY,
+            "param-pass(4294967295u, 18446744073709551614ull, -INFINITY, INFINITY).v0"
+        );
+        assertEqualF32(
+            results.v1,
+            -INFINITY,
+            "param-pass(4294967295u, 18446744073709551614ull, -INFINITY, INFINITY).v1"
+        );
+        assertEqualU64(
+            results.v2,
+            18446744073709551614ull,
+            "param-pass(4294967295u, 18446744073709551614ull, -INFINITY, INFINITY).v2"
+        );
+        assertEqualU32(
+            results.v3,
+            4294967295u,
+            "param-pass(4294967295u, 18446744073709551614ull, -INFINITY, INFINITY).v3"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_swap(&instance, 1u, 2u);
+        assertEqualU32(
+            results.v0,
+            2u,
+            "swap(1u, 2u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            1u,
+            "swap(1u, 2u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_swapX2Dtwice(&instance, 1u, 2u);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "swap-twice(1u, 2u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "swap-twice(1u, 2u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ji results = multivalue0_callX2Dpair(&instance);
+        assertEqualU64(
+            results.v0,
+            8ull,
+            "call-pair().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            7u,
+            "call-pair().v1"
+        );
+    }
+    assertEqualU32(
+        multivalue0_callX2Dsum(&instance),
+        13u,
+        "call-sum()"
+    );
+    assertEqualU32(
+        multivalue0_callX2Dsub(&instance, 3u, 10u),
+        7u,
+        "call-sub(3u, 10u)"
+    );
+    assertEqualU32(
+        multivalue0_callX2Ddrop(&instance),
+        9u,
+        "call-drop()"
+    );
+    {
+        wasmMultiValue_ii results = multivalue0_call_indirect(&instance, 1u, 5u, 6u);
+        assertEqualU32(
+            results.v0,
+            6u,
+            "call_indirect(1u, 5u, 6u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            5u,
+            "call_indirect(1u, 5u, 6u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_call_indirect(&instance, 2u, 5u, 6u);
+        assertEqualU32(
+            results.v0,
+            20u,
+            "call_indirect(2u, 5u, 6u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            24u,
+            "call_indirect(2u, 5u, 6u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_call_indirectX2Dpair(&instance);
+        assertEqualU32(
+            results.v0,
+            7u,
+            "call_indirect-pair().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            8ull,
+            "call_indirect-pair().v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_blockX2Dresults(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-results().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            2ull,
+            "block-results().v1"
+        );
+    }
+    assertEqualU32(
+        multivalue0_blockX2Dparams(&instance),
+        3u,
+        "block-params()"
+    );
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2DparamsX2Did(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-params-id().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "block-params-id().v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2DtypeX2Dindex(&instance);
+        assertEqualU32(
+            results.v0,
+            16u,
+            "block-type-index().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            20u,
+            "block-type-index().v1"
+        );
+    }
+    {
+        wasmMultiValue_iii results = multivalue0_blockX2Dnested(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-nested().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            5u,
+            "block-nested().v1"
+        );
+        assertEqualU32(
+            results.v2,
+            4u,
+            "block-nested().v2"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_blockX2Dbr(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            30u,
+            "block-br(0u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            40ull,
+            "block-br(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_blockX2Dbr(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            10u,
+            "block-br(1u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            20ull,
+            "block-br(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_id results = multivalue0_blockX2DbrX2Dvalue(&instance);
+        assertEqualU32(
+            results.v0,
+            11u,
+            "block-br-value().v0"
+        );
+        assertEqualF64(
+            results.v1,
+            2.5,
+            "block-br-value().v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2DbrX2Dnested(&instance);
+        assertEqualU32(
+            results.v0,
+            12u,
+            "block-br-nested().v0"
+        );
+        assertEqualU32(
+            results.v1,
+            13u,
+            "block-br-nested().v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_ifX2Dvalue(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "block-br_if-value(0u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            3u,
+            "block-br_if-value(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_ifX2Dvalue(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-br_if-value(1u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "block-br_if-value(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_table(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-br_table(0u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "block-br_table(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_table(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            4294967295u,
+            "block-br_table(1u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            200u,
+            "block-br_table(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_table(&instance, 2u);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "block-br_table(2u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            100u,
+            "block-br_table(2u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_blockX2Dbr_table(&instance, 3u);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "block-br_table(3u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            100u,
+            "block-br_table(3u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_blockX2Dreturn(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "block-return(0u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            4ull,
+            "block-return(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_blockX2Dreturn(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "block-return(1u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            2ull,
+            "block-return(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_loopX2Dresults(&instance);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "loop-results().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            4ull,
+            "loop-results().v1"
+        );
+    }
+    assertEqualU32(
+        multivalue0_loopX2Dparams(&instance),
+        3u,
+        "loop-params()"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfac(&instance, 1ull),
+        1ull,
+        "loop-fac(1ull)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfac(&instance, 5ull),
+        120ull,
+        "loop-fac(5ull)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfac(&instance, 25ull),
+        7034535277573963776ull,
+        "loop-fac(25ull)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfib(&instance, 1u),
+        1ull,
+        "loop-fib(1u)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfib(&instance, 2u),
+        1ull,
+        "loop-fib(2u)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfib(&instance, 10u),
+        55ull,
+        "loop-fib(10u)"
+    );
+    assertEqualU64(
+        multivalue0_loopX2Dfib(&instance, 90u),
+        2880067194370816120ull,
+        "loop-fib(90u)"
+    );
+    {
+        wasmMultiValue_ij results = multivalue0_ifX2Dresults(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "if-results(1u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            2ull,
+            "if-results(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ij results = multivalue0_ifX2Dresults(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            3u,
+            "if-results(0u).v0"
+        );
+        assertEqualU64(
+            results.v1,
+            4ull,
+            "if-results(0u).v1"
+        );
+    }
+    assertEqualU32(
+        multivalue0_ifX2Dparams(&instance, 1u, 10u, 3u),
+        13u,
+        "if-params(1u, 10u, 3u)"
+    );
+    assertEqualU32(
+        multivalue0_ifX2Dparams(&instance, 0u, 10u, 3u),
+        7u,
+        "if-params(0u, 10u, 3u)"
+    );
+    {
+        wasmMultiValue_ii results = multivalue0_ifX2DparamsX2Dresults(&instance, 1u);
+        assertEqualU32(
+            results.v0,
+            6u,
+            "if-params-results(1u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            5u,
+            "if-params-results(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_ifX2DparamsX2Dresults(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            20u,
+            "if-params-results(0u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            24u,
+            "if-params-results(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_fi results = multivalue0_ifX2Dbr(&instance, 1u);
+        assertEqualF32(
+            results.v0,
+            0.25,
+            "if-br(1u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            1u,
+            "if-br(1u).v1"
+        );
+    }
+    {
+        wasmMultiValue_fi results = multivalue0_ifX2Dbr(&instance, 0u);
+        assertEqualF32(
+            results.v0,
+            -0.5,
+            "if-br(0u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            2u,
+            "if-br(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ijf results = multivalue0_returnX2Dvalue(&instance);
+        assertEqualU32(
+            results.v0,
+            1u,
+            "return-value().v0"
+        );
+        assertEqualU64(
+            results.v1,
+            18446744073709551614ull,
+            "return-value().v1"
+        );
+        assertEqualF32(
+            results.v2,
+            3.0,
+            "return-value().v2"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_returnX2Dnested(&instance, 0u);
+        assertEqualU32(
+            results.v0,
+            0u,
+            "return-nested(0u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            0u,
+            "return-nested(0u).v1"
+        );
+    }
+    {
+        wasmMultiValue_ii results = multivalue0_returnX2Dnested(&instance, 7u);
+        assertEqualU32(
+            results.v0,
+            7u,
+            "return-nested(7u).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            99u,
+            "return-nested(7u).v1"
+        );
+    }
+}
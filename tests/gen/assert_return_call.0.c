@@ -0,0 +1,199 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_return_call.0.h"
+
+void test() {
+    returncall0Instance instance;
+    returncall0Instantiate(&instance, resolveTestImports);
+    printStart("return_call.0.wasm");
+    assertEqualU32(
+        returncall0_typeX2Di32(&instance),
+        306u,
+        "type-i32()"
+    );
+    assertEqualU64(
+        returncall0_typeX2Di64(&instance),
+        356ull,
+        "type-i64()"
+    );
+    assertEqualF32(
+        returncall0_typeX2Df32(&instance),
+        3890.0,
+        "type-f32()"
+    );
+    assertEqualF64(
+        returncall0_typeX2Df64(&instance),
+        3940.0,
+        "type-f64()"
+    );
+    assertEqualU32(
+        returncall0_typeX2DfirstX2Di32(&instance),
+        32u,
+        "type-first-i32()"
+    );
+    assertEqualU64(
+        returncall0_typeX2DfirstX2Di64(&instance),
+        64ull,
+        "type-first-i64()"
+    );
+    assertEqualF32(
+        returncall0_typeX2DfirstX2Df32(&instance),
+        1.3200000524520874,
+        "type-first-f32()"
+    );
+    assertEqualF64(
+        returncall0_typeX2DfirstX2Df64(&instance),
+        1.64,
+        "type-first-f64()"
+    );
+    assertEqualU32(
+        returncall0_typeX2DsecondX2Di32(&instance),
+        32u,
+        "type-second-i32()"
+    );
+    assertEqualU64(
+        returncall0_typeX2DsecondX2Di64(&instance),
+        64ull,
+        "type-second-i64()"
+    );
+    assertEqualF32(
+        returncall0_typeX2DsecondX2Df32(&instance),
+        32.0,
+        "type-second-f32()"
+    );
+    assertEqualF64(
+        returncall0_typeX2DsecondX2Df64(&instance),
+        64.1,
+        "type-second-f64()"
+    );
+    {
+        wasmMultiValue_ji results = returncall0_typeX2Dresults(&instance, 1u, 2ull);
+        assertEqualU64(
+            results.v0,
+            2ull,
+            "type-results(1u, 2ull).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            1u,
+            "type-results(1u, 2ull).v1"
+        );
+    }
+    assertEqualU32(
+        returncall0_asX2DblockX2Dvalue(&instance),
+        306u,
+        "as-block-value()"
+    );
+    assertEqualU32(
+        returncall0_asX2DifX2Dthen(&instance, 1u),
+        1u,
+        "as-if-then(1u)"
+    );
+    assertEqualU32(
+        returncall0_asX2DifX2Dthen(&instance, 0u),
+        2u,
+        "as-if-then(0u)"
+    );
+    assertEqualU32(
+        returncall0_asX2Dbr_ifX2Dcond(&instance),
+        306u,
+        "as-br_if-cond()"
+    );
+    assertEqualU64(
+        returncall0_facX2Dacc(&instance, 0ull, 1ull),
+        1ull,
+        "fac-acc(0ull, 1ull)"
+    );
+    assertEqualU64(
+        returncall0_facX2Dacc(&instance, 1ull, 1ull),
+        1ull,
+        "fac-acc(1ull, 1ull)"
+    );
+    assertEqualU64(
+        returncall0_facX2Dacc(&instance, 5ull, 1ull),
+        120ull,
+        "fac-acc(5ull, 1ull)"
+    );
+    assertEqualU64(
+        returncall0_facX2Dacc(&instance, 25ull, 1ull),
+        7034535277573963776ull,
+        "fac-acc(25ull, 1ull)"
+    );
+    assertEqualU64(
+        returncall0_count(&instance, 0ull),
+        0ull,
+        "count(0ull)"
+    );
+    assertEqualU64(
+        returncall0_count(&instance, 1000ull),
+        0ull,
+        "count(1000ull)"
+    );
+    assertEqualU64(
+        returncall0_count(&instance, 1000000ull),
+        0ull,
+        "count(1000000ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 0ull),
+        44u,
+        "even(0ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 1ull),
+        99u,
+        "even(1ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 100ull),
+        44u,
+        "even(100ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 77ull),
+        99u,
+        "even(77ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 1000000ull),
+        44u,
+        "even(1000000ull)"
+    );
+    assertEqualU32(
+        returncall0_even(&instance, 1000001ull),
+        99u,
+        "even(1000001ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 0ull),
+        99u,
+        "odd(0ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 1ull),
+        44u,
+        "odd(1ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 200ull),
+        99u,
+        "odd(200ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 77ull),
+        44u,
+        "odd(77ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 1000000ull),
+        99u,
+        "odd(1000000ull)"
+    );
+    assertEqualU32(
+        returncall0_odd(&instance, 999999ull),
+        44u,
+        "odd(999999ull)"
+    );
+}
@@ -0,0 +1,209 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_return_call_indirect.0.h"
+
+void test() {
+    returncallindirect0Instance instance;
+    returncallindirect0Instantiate(&instance, resolveTestImports);
+    printStart("return_call_indirect.0.wasm");
+    assertEqualU32(
+        returncallindirect0_typeX2Di32(&instance),
+        306u,
+        "type-i32()"
+    );
+    assertEqualU64(
+        returncallindirect0_typeX2Di64(&instance),
+        356ull,
+        "type-i64()"
+    );
+    assertEqualF32(
+        returncallindirect0_typeX2Df32(&instance),
+        3890.0,
+        "type-f32()"
+    );
+    assertEqualF64(
+        returncallindirect0_typeX2Df64(&instance),
+        3940.0,
+        "type-f64()"
+    );
+    assertEqualU64(
+        returncallindirect0_typeX2Dindex(&instance),
+        100ull,
+        "type-index()"
+    );
+    assertEqualU32(
+        returncallindirect0_typeX2DfirstX2Di32(&instance),
+        32u,
+        "type-first-i32()"
+    );
+    assertEqualU64(
+        returncallindirect0_typeX2DfirstX2Di64(&instance),
+        64ull,
+        "type-first-i64()"
+    );
+    assertEqualF32(
+        returncallindirect0_typeX2DfirstX2Df32(&instance),
+        1.3200000524520874,
+        "type-first-f32()"
+    );
+    assertEqualF64(
+        returncallindirect0_typeX2DfirstX2Df64(&instance),
+        1.64,
+        "type-first-f64()"
+    );
+    assertEqualU32(
+        returncallindirect0_typeX2DsecondX2Di32(&instance),
+        32u,
+        "type-second-i32()"
+    );
+    assertEqualU64(
+        returncallindirect0_typeX2DsecondX2Di64(&instance),
+        64ull,
+        "type-second-i64()"
+    );
+    assertEqualF32(
+        returncallindirect0_typeX2DsecondX2Df32(&instance),
+        32.0,
+        "type-second-f32()"
+    );
+    assertEqualF64(
+        returncallindirect0_typeX2DsecondX2Df64(&instance),
+        64.1,
+        "type-second-f64()"
+    );
+    {
+        wasmMultiValue_ji results = returncallindirect0_typeX2Dresults(&instance, 1u, 2ull);
+        assertEqualU64(
+            results.v0,
+            2ull,
+            "type-results(1u, 2ull).v0"
+        );
+        assertEqualU32(
+            results.v1,
+            1u,
+            "type-results(1u, 2ull).v1"
+        );
+    }
+    assertEqualU64(
+        returncallindirect0_dispatch(&instance, 5u, 2ull),
+        2ull,
+        "dispatch(5u, 2ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatch(&instance, 5u, 5ull),
+        5ull,
+        "dispatch(5u, 5ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatch(&instance, 12u, 5ull),
+        120ull,
+        "dispatch(12u, 5ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatch(&instance, 17u, 2ull),
+        2ull,
+        "dispatch(17u, 2ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatchX2Dstructural(&instance, 5u),
+        9ull,
+        "dispatch-structural(5u)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatchX2Dstructural(&instance, 5u),
+        9ull,
+        "dispatch-structural(5u)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatchX2Dstructural(&instance, 12u),
+        362880ull,
+        "dispatch-structural(12u)"
+    );
+    assertEqualU64(
+        returncallindirect0_dispatchX2Dstructural(&instance, 17u),
+        9ull,
+        "dispatch-structural(17u)"
+    );
+    assertEqualU64(
+        returncallindirect0_fac(&instance, 0ull),
+        1ull,
+        "fac(0ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_fac(&instance, 1ull),
+        1ull,
+        "fac(1ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_fac(&instance, 5ull),
+        120ull,
+        "fac(5ull)"
+    );
+    assertEqualU64(
+        returncallindirect0_fac(&instance, 25ull),
+        7034535277573963776ull,
+        "fac(25ull)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 0u),
+        44u,
+        "even(0u)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 1u),
+        99u,
+        "even(1u)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 100u),
+        44u,
+        "even(100u)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 77u),
+        99u,
+        "even(77u)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 100000u),
+        44u,
+        "even(100000u)"
+    );
+    assertEqualU32(
+        returncallindirect0_even(&instance, 111111u),
+        99u,
+        "even(111111u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 0u),
+        99u,
+        "odd(0u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 1u),
+        44u,
+        "odd(1u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 200u),
+        99u,
+        "odd(200u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 77u),
+        44u,
+        "odd(77u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 200002u),
+        99u,
+        "odd(200002u)"
+    );
+    assertEqualU32(
+        returncallindirect0_odd(&instance, 300003u),
+        44u,
+        "odd(300003u)"
+    );
+}
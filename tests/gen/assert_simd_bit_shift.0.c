@@ -0,0 +1,1691 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_bit_shift.0.h"
+
+void test() {
+    simdbitshift0Instance instance;
+    simdbitshift0Instantiate(&instance, resolveTestImports);
+    printStart("simd_bit_shift.0.wasm");
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.shl(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u),
+        v128_const(0x04040404u, 0x04040404u, 0x04040404u, 0x04040404u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u),
+        v128_const(0x04040404u, 0x04040404u, 0x04040404u, 0x04040404u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u),
+        v128_const(0x04040404u, 0x04040404u, 0x04040404u, 0x04040404u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshl(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shl(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 7u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 8u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 9u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i8x16X2Eshr_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.shr_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.shl(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u),
+        v128_const(0x00040004u, 0x00040004u, 0x00040004u, 0x00040004u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u),
+        v128_const(0x00040004u, 0x00040004u, 0x00040004u, 0x00040004u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u),
+        v128_const(0x00040004u, 0x00040004u, 0x00040004u, 0x00040004u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshl(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shl(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 15u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 16u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 17u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i16x8X2Eshr_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.shr_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.shl(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u),
+        v128_const(0x00000004u, 0x00000004u, 0x00000004u, 0x00000004u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000004u, 0x00000004u, 0x00000004u, 0x00000004u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000004u, 0x00000004u, 0x00000004u, 0x00000004u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshl(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shl(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 31u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 32u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i32x4X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.shr_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000002u, 0x00000000u, 0x00000002u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.shl(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x00000000u, 0xFFFFFFFEu, 0x00000000u, 0xFFFFFFFEu),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.shl(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u),
+        v128_const(0x00000004u, 0x00000000u, 0x00000004u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u),
+        v128_const(0x00000004u, 0x00000000u, 0x00000004u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000004u, 0x00000000u, 0x00000004u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshl(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shl(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_s(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_s(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x7FFFFFFFu, 0x00000000u),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), 4294967295u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 0u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 1u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 63u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 64u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 65u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 33u)"
+    );
+    assertEqualV128(
+        simdbitshift0_i64x2X2Eshr_u(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.shr_u(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u), 4294967295u)"
+    );
+}
@@ -0,0 +1,461 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_bitwise.0.h"
+
+void test() {
+    simdbitwise0Instance instance;
+    simdbitwise0Instantiate(&instance, resolveTestImports);
+    printStart("simd_bitwise.0.wasm");
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.not(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.not(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu),
+        "v128.not(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.not(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x76543210u, 0xFEDCBA98u, 0x76543210u, 0xFEDCBA98u),
+        "v128.not(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u)),
+        v128_const(0xE795811Au, 0xF34A2D84u, 0x04F6FB4Fu, 0x41BDAE1Au),
+        "v128.not(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xD9AD15D5u, 0x6A5C25ABu, 0x2669D52Fu, 0xE26E7E04u),
+        "v128.not(v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Enot(&instance, v128_const(0xF38B40A7u, 0xBB4D1ED2u, 0x7FBD6ABCu, 0x6941BE8Au)),
+        v128_const(0x0C74BF58u, 0x44B2E12Du, 0x80429543u, 0x96BE4175u),
+        "v128.not(v128_const(0xF38B40A7u, 0xBB4D1ED2u, 0x7FBD6ABCu, 0x6941BE8Au))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.and(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.and(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.and(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.and(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u),
+        "v128.and(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu),
+        "v128.and(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.and(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x01014545u, 0x01014545u, 0x01014545u, 0x01014545u),
+        "v128.and(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x04504000u, 0x15015054u, 0x51140050u, 0x15110151u),
+        "v128.and(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.and(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x88AA88AAu, 0x00220022u, 0x88AA88AAu, 0x00220022u),
+        "v128.and(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x2202AA2Au, 0x80A28A00u, 0x88822A80u, 0x088080AAu),
+        "v128.and(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x01014545u, 0x01014545u, 0x01014545u, 0x01014545u),
+        "v128.and(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u),
+        "v128.and(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x0002C82Au, 0x01234044u, 0x898208C0u, 0x01010163u),
+        "v128.and(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x10405445u, 0x04155051u, 0x51010410u, 0x14405145u),
+        "v128.and(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x082A4CE5u, 0x00214063u, 0x890904A0u, 0x00024165u),
+        "v128.and(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eand(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x00426A20u, 0x04A1D250u, 0xD9000090u, 0x1C0001E1u),
+        "v128.and(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.or(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u),
+        "v128.or(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu),
+        "v128.or(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.or(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.or(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.or(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.or(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0xDDFFDDFFu, 0x55775577u, 0xDDFFDDFFu, 0x55775577u),
+        "v128.or(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x7757FF7Fu, 0xD5F7DF55u, 0xDDD77FD5u, 0x5DD5D5FFu),
+        "v128.or(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.or(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0xABABEFEFu, 0xABABEFEFu, 0xABABEFEFu, 0xABABEFEFu),
+        "v128.or(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xAEFAEAAAu, 0xBFABFAFEu, 0xFBBEAAFAu, 0xBFBBABFBu),
+        "v128.or(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xDDFFDDFFu, 0x55775577u, 0xDDFFDDFFu, 0x55775577u),
+        "v128.or(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u),
+        "v128.or(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xAFFBEFEFu, 0x95A3DF77u, 0xD9BFEFFFu, 0x1DB3C5FFu),
+        "v128.or(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x5D7F7FF5u, 0x5DF5D77Fu, 0xFF5D55F5u, 0xFF5755F5u),
+        "v128.or(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x99EBFFEFu, 0x0DB7D77Fu, 0xFBABCDFFu, 0xBF6355E7u),
+        "v128.or(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x3E7AFEEFu, 0x9DB7DA7Fu, 0xFB9F2EF0u, 0xBFD3D1FFu),
+        "v128.or(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u),
+        "v128.xor(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u),
+        "v128.xor(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu),
+        "v128.xor(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu),
+        "v128.xor(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x76543210u, 0xFEDCBA98u, 0x76543210u, 0xFEDCBA98u),
+        "v128.xor(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xD9AD15D5u, 0x6A5C25ABu, 0x2669D52Fu, 0xE26E7E04u),
+        "v128.xor(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.xor(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0xDCFE98BAu, 0x54761032u, 0xDCFE98BAu, 0x54761032u),
+        "v128.xor(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x7307BF7Fu, 0xC0F68F01u, 0x8CC37F85u, 0x48C4D4AEu),
+        "v128.xor(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "v128.xor(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x23016745u, 0xAB89EFCDu, 0x23016745u, 0xAB89EFCDu),
+        "v128.xor(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x8CF84080u, 0x3F0970FEu, 0x733C807Au, 0xB73B2B51u),
+        "v128.xor(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xDCFE98BAu, 0x54761032u, 0xDCFE98BAu, 0x54761032u),
+        "v128.xor(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.xor(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xAFF927C5u, 0x94809F33u, 0x503DE73Fu, 0x1CB2C49Cu),
+        "v128.xor(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x4D3F2BB0u, 0x59E0872Eu, 0xAE5C51E5u, 0xEB1704B0u),
+        "v128.xor(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x91C1B30Au, 0x0D96971Cu, 0x72A2C95Fu, 0xBF611482u),
+        "v128.xor(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Exor(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x3E3894CFu, 0x9916082Fu, 0x229F2E60u, 0xA3D3D01Eu),
+        "v128.xor(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.andnot(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.andnot(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.andnot(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu),
+        "v128.andnot(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x76543210u, 0xFEDCBA98u, 0x76543210u, 0xFEDCBA98u),
+        "v128.andnot(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0xD9AD15D5u, 0x6A5C25ABu, 0x2669D52Fu, 0xE26E7E04u),
+        "v128.andnot(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.andnot(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x54541010u, 0x54541010u, 0x54541010u, 0x54541010u),
+        "v128.andnot(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x51051555u, 0x40540501u, 0x04415505u, 0x40445404u),
+        "v128.andnot(v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu),
+        "v128.andnot(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x22002200u, 0xAA88AA88u, 0x22002200u, 0xAA88AA88u),
+        "v128.andnot(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x88A80080u, 0x2A0820AAu, 0x2228802Au, 0xA22A2A00u),
+        "v128.andnot(v128_const(0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu, 0xAAAAAAAAu), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x88AA88AAu, 0x00220022u, 0x88AA88AAu, 0x00220022u),
+        "v128.andnot(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.andnot(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x89A905C5u, 0x00000523u, 0x0029C52Fu, 0x00224404u),
+        "v128.andnot(v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0x082A2AA0u, 0x08A0822Au, 0xAA0800A0u, 0xAA0200A0u),
+        "v128.andnot(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0x10403200u, 0x0C949218u, 0x72000010u, 0xBE401080u),
+        "v128.andnot(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Eandnot(&instance, v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x182814C5u, 0x0814002Bu, 0x22090420u, 0xA2425004u),
+        "v128.andnot(v128_const(0x186A7EE5u, 0x0CB5D27Bu, 0xFB0904B0u, 0xBE4251E5u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0xA8D46590u, 0xF1B4EB8Au, 0x2B825512u, 0xB3BD9979u), v128_const(0x2C05E163u, 0x10556E51u, 0x187CEE5Bu, 0xF2C0418Bu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u)),
+        v128_const(0xAC846580u, 0x11746B12u, 0x19D66712u, 0xF3E101E9u),
+        "v128.bitselect(v128_const(0xA8D46590u, 0xF1B4EB8Au, 0x2B825512u, 0xB3BD9979u), v128_const(0x2C05E163u, 0x10556E51u, 0x187CEE5Bu, 0xF2C0418Bu), v128_const(0x89ABCDEFu, 0x01234567u, 0x89ABCDEFu, 0x01234567u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0x0D1260EFu, 0x8A746CACu, 0x998A8EAFu, 0x5B9C6926u), v128_const(0x6D446474u, 0x215C716Fu, 0x82D00111u, 0xD80FB472u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x0D1260EFu, 0x8A746CACu, 0x998A8EAFu, 0x5B9C6926u),
+        "v128.bitselect(v128_const(0x0D1260EFu, 0x8A746CACu, 0x998A8EAFu, 0x5B9C6926u), v128_const(0x6D446474u, 0x215C716Fu, 0x82D00111u, 0xD80FB472u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0xD59DAEA7u, 0x5E0565DDu, 0x2440BAD5u, 0xD94A530Eu), v128_const(0x8F9F7C61u, 0x68133613u, 0xDE765D3Du, 0x262F21E1u), v128_const(0x61031F0Du, 0x16FA0AD2u, 0xEC62E015u, 0x5B75B6B8u)),
+        v128_const(0xCF9D6E65u, 0x7E0134D1u, 0x3654BD3Du, 0x7D4A1349u),
+        "v128.bitselect(v128_const(0xD59DAEA7u, 0x5E0565DDu, 0x2440BAD5u, 0xD94A530Eu), v128_const(0x8F9F7C61u, 0x68133613u, 0xDE765D3Du, 0x262F21E1u), v128_const(0x61031F0Du, 0x16FA0AD2u, 0xEC62E015u, 0x5B75B6B8u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0xEBF2BB1Cu, 0x9AB4B405u, 0x68358CA1u, 0x7C1EB031u), v128_const(0x27010011u, 0xA5DBC97Du, 0x374D5C8Du, 0x3F00C394u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x27010011u, 0xA5DBC97Du, 0x374D5C8Du, 0x3F00C394u),
+        "v128.bitselect(v128_const(0xEBF2BB1Cu, 0x9AB4B405u, 0x68358CA1u, 0x7C1EB031u), v128_const(0x27010011u, 0xA5DBC97Du, 0x374D5C8Du, 0x3F00C394u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0x3B9013B9u, 0x0688E35Cu, 0x9C6A039Cu, 0xC48F73CBu), v128_const(0x61DCE3B4u, 0x33B89BD2u, 0x65C79847u, 0xACD03D98u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x61DCE3B4u, 0x33B89BD2u, 0x65C79847u, 0xACD03D98u),
+        "v128.bitselect(v128_const(0x3B9013B9u, 0x0688E35Cu, 0x9C6A039Cu, 0xC48F73CBu), v128_const(0x61DCE3B4u, 0x33B89BD2u, 0x65C79847u, 0xACD03D98u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0xF451620Au, 0xBAAAB6FDu, 0xBB247096u, 0x78C7703Fu), v128_const(0x4A542DCDu, 0xB9BE393Cu, 0xA0C99830u, 0x0BC656F4u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu)),
+        v128_const(0x6C5467CFu, 0xB8BEB37Cu, 0xB94DB0B0u, 0x1AC7563Fu),
+        "v128.bitselect(v128_const(0xF451620Au, 0xBAAAB6FDu, 0xBB247096u, 0x78C7703Fu), v128_const(0x4A542DCDu, 0xB9BE393Cu, 0xA0C99830u, 0x0BC656F4u), v128_const(0x2652EA2Au, 0x95A3DA54u, 0xD9962AD0u, 0x1D9181FBu))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0x77FE9E4Eu, 0x291605E1u, 0x890B9DDCu, 0xABF33561u), v128_const(0xB717D5E3u, 0x0413A61Bu, 0x6AF4749Bu, 0x164BC3D2u), v128_const(0x01F66531u, 0x84AEFB64u, 0x70FF9DE5u, 0xE1F8E1E2u)),
+        v128_const(0xB7F794C2u, 0x0017057Bu, 0x0A0BFDDEu, 0xB7F32370u),
+        "v128.bitselect(v128_const(0x77FE9E4Eu, 0x291605E1u, 0x890B9DDCu, 0xABF33561u), v128_const(0xB717D5E3u, 0x0413A61Bu, 0x6AF4749Bu, 0x164BC3D2u), v128_const(0x01F66531u, 0x84AEFB64u, 0x70FF9DE5u, 0xE1F8E1E2u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0x3506E8DAu, 0x819BE1A7u, 0xA9C05AFBu, 0xBF36C468u), v128_const(0xF29DDFD1u, 0x963C9CFAu, 0x16FA3563u, 0xBABEF6A3u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u)),
+        v128_const(0xB78CCAD0u, 0x8339C9AFu, 0x03EA7073u, 0xBFBEE6E2u),
+        "v128.bitselect(v128_const(0x3506E8DAu, 0x819BE1A7u, 0xA9C05AFBu, 0xBF36C468u), v128_const(0xF29DDFD1u, 0x963C9CFAu, 0x16FA3563u, 0xBABEF6A3u), v128_const(0x55555555u, 0x55555555u, 0x55555555u, 0x55555555u))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0x050F6C0Du, 0x7D1AFDC9u, 0x37D3E3F9u, 0xDCE5D689u), v128_const(0xF8F4346Cu, 0xDC8BA478u, 0x9BF19011u, 0xB2063F9Cu), v128_const(0xF38B40A7u, 0xBB4D1ED2u, 0x7FBD6ABCu, 0x6941BE8Au)),
+        v128_const(0x097F744Du, 0x7D8ABCE8u, 0xB7D1F2B9u, 0xDA47979Cu),
+        "v128.bitselect(v128_const(0x050F6C0Du, 0x7D1AFDC9u, 0x37D3E3F9u, 0xDCE5D689u), v128_const(0xF8F4346Cu, 0xDC8BA478u, 0x9BF19011u, 0xB2063F9Cu), v128_const(0xF38B40A7u, 0xBB4D1ED2u, 0x7FBD6ABCu, 0x6941BE8Au))"
+    );
+    assertEqualV128(
+        simdbitwise0_v128X2Ebitselect(&instance, v128_const(0xB2D5D8A6u, 0x5F348599u, 0x8493F1BAu, 0xFE7A2914u), v128_const(0x31ECE4DAu, 0xEB568A57u, 0xA04784F5u, 0x8F3D0C04u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xB2D5D8A6u, 0x5F348599u, 0x8493F1BAu, 0xFE7A2914u),
+        "v128.bitselect(v128_const(0xB2D5D8A6u, 0x5F348599u, 0x8493F1BAu, 0xFE7A2914u), v128_const(0x31ECE4DAu, 0xEB568A57u, 0xA04784F5u, 0x8F3D0C04u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+}
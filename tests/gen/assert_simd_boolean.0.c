@@ -0,0 +1,441 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_boolean.0.h"
+
+void test() {
+    simdboolean0Instance instance;
+    simdboolean0Instantiate(&instance, resolveTestImports);
+    printStart("simd_boolean.0.wasm");
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "v128.any_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        1u,
+        "v128.any_true(v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        1u,
+        "v128.any_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        1u,
+        "v128.any_true(v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        1u,
+        "v128.any_true(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_v128X2Eany_true(&instance, v128_const(0xCEF71673u, 0x60E397F5u, 0xCFB11991u, 0xA4F76ABAu)),
+        1u,
+        "v128.any_true(v128_const(0xCEF71673u, 0x60E397F5u, 0xCFB11991u, 0xA4F76ABAu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i8x16.all_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i8x16.bitmask(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        1u,
+        "i8x16.all_true(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        65535u,
+        "i8x16.bitmask(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        1u,
+        "i8x16.all_true(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        0u,
+        "i8x16.bitmask(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x00010101u)),
+        0u,
+        "i8x16.all_true(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x00010101u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x00010101u)),
+        0u,
+        "i8x16.bitmask(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x00010101u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0xFFFFFF00u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        0u,
+        "i8x16.all_true(v128_const(0xFFFFFF00u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0xFFFFFF00u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        65534u,
+        "i8x16.bitmask(v128_const(0xFFFFFF00u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        1u,
+        "i8x16.all_true(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        65535u,
+        "i8x16.bitmask(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x04050504u, 0x05040505u, 0x05050405u, 0x04050504u)),
+        1u,
+        "i8x16.all_true(v128_const(0x04050504u, 0x05040505u, 0x05050405u, 0x04050504u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x04050504u, 0x05040505u, 0x05050405u, 0x04050504u)),
+        0u,
+        "i8x16.bitmask(v128_const(0x04050504u, 0x05040505u, 0x05050405u, 0x04050504u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0x1A37805Eu, 0x0F74FBEEu, 0xF34232C7u, 0x593E90CAu)),
+        1u,
+        "i8x16.all_true(v128_const(0x1A37805Eu, 0x0F74FBEEu, 0xF34232C7u, 0x593E90CAu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0x1A37805Eu, 0x0F74FBEEu, 0xF34232C7u, 0x593E90CAu)),
+        14642u,
+        "i8x16.bitmask(v128_const(0x1A37805Eu, 0x0F74FBEEu, 0xF34232C7u, 0x593E90CAu))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0xFBEAC883u, 0xE030A652u, 0xF83B56B7u, 0x031A5911u)),
+        1u,
+        "i8x16.all_true(v128_const(0xFBEAC883u, 0xE030A652u, 0xF83B56B7u, 0x031A5911u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0xFBEAC883u, 0xE030A652u, 0xF83B56B7u, 0x031A5911u)),
+        2479u,
+        "i8x16.bitmask(v128_const(0xFBEAC883u, 0xE030A652u, 0xF83B56B7u, 0x031A5911u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Eall_true(&instance, v128_const(0xD78F6E9Eu, 0x61601DE9u, 0x97EA78AFu, 0xA8DA3047u)),
+        1u,
+        "i8x16.all_true(v128_const(0xD78F6E9Eu, 0x61601DE9u, 0x97EA78AFu, 0xA8DA3047u))"
+    );
+    assertEqualU32(
+        simdboolean0_i8x16X2Ebitmask(&instance, v128_const(0xD78F6E9Eu, 0x61601DE9u, 0x97EA78AFu, 0xA8DA3047u)),
+        52509u,
+        "i8x16.bitmask(v128_const(0xD78F6E9Eu, 0x61601DE9u, 0x97EA78AFu, 0xA8DA3047u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i16x8.all_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i16x8.bitmask(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        1u,
+        "i16x8.all_true(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        255u,
+        "i16x8.bitmask(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        1u,
+        "i16x8.all_true(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        0u,
+        "i16x8.bitmask(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00000001u)),
+        0u,
+        "i16x8.all_true(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00000001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00000001u)),
+        0u,
+        "i16x8.bitmask(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00000001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        0u,
+        "i16x8.all_true(v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        254u,
+        "i16x8.bitmask(v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        1u,
+        "i16x8.all_true(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        255u,
+        "i16x8.bitmask(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x00050004u, 0x00040005u, 0x00050005u, 0x00050004u)),
+        1u,
+        "i16x8.all_true(v128_const(0x00050004u, 0x00040005u, 0x00050005u, 0x00050004u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x00050004u, 0x00040005u, 0x00050005u, 0x00050004u)),
+        0u,
+        "i16x8.bitmask(v128_const(0x00050004u, 0x00040005u, 0x00050005u, 0x00050004u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0xE139AF1Eu, 0x83DC0AA3u, 0x74D6F8AFu, 0xBA69CECAu)),
+        1u,
+        "i16x8.all_true(v128_const(0xE139AF1Eu, 0x83DC0AA3u, 0x74D6F8AFu, 0xBA69CECAu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0xE139AF1Eu, 0x83DC0AA3u, 0x74D6F8AFu, 0xBA69CECAu)),
+        219u,
+        "i16x8.bitmask(v128_const(0xE139AF1Eu, 0x83DC0AA3u, 0x74D6F8AFu, 0xBA69CECAu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0x6D1BE27Au, 0xA0E1D746u, 0xA6AED468u, 0x17DA5BBCu)),
+        1u,
+        "i16x8.all_true(v128_const(0x6D1BE27Au, 0xA0E1D746u, 0xA6AED468u, 0x17DA5BBCu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0x6D1BE27Au, 0xA0E1D746u, 0xA6AED468u, 0x17DA5BBCu)),
+        61u,
+        "i16x8.bitmask(v128_const(0x6D1BE27Au, 0xA0E1D746u, 0xA6AED468u, 0x17DA5BBCu))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Eall_true(&instance, v128_const(0xD2CD33D0u, 0xA9FA1069u, 0x632F7564u, 0x536A5069u)),
+        1u,
+        "i16x8.all_true(v128_const(0xD2CD33D0u, 0xA9FA1069u, 0x632F7564u, 0x536A5069u))"
+    );
+    assertEqualU32(
+        simdboolean0_i16x8X2Ebitmask(&instance, v128_const(0xD2CD33D0u, 0xA9FA1069u, 0x632F7564u, 0x536A5069u)),
+        10u,
+        "i16x8.bitmask(v128_const(0xD2CD33D0u, 0xA9FA1069u, 0x632F7564u, 0x536A5069u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i32x4.all_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i32x4.bitmask(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        1u,
+        "i32x4.all_true(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        15u,
+        "i32x4.bitmask(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        1u,
+        "i32x4.all_true(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        0u,
+        "i32x4.bitmask(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000000u)),
+        0u,
+        "i32x4.all_true(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000000u)),
+        0u,
+        "i32x4.bitmask(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        0u,
+        "i32x4.all_true(v128_const(0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        14u,
+        "i32x4.bitmask(v128_const(0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        1u,
+        "i32x4.all_true(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        15u,
+        "i32x4.bitmask(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x00000004u, 0x00000005u, 0x00000005u, 0x00000004u)),
+        1u,
+        "i32x4.all_true(v128_const(0x00000004u, 0x00000005u, 0x00000005u, 0x00000004u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x00000004u, 0x00000005u, 0x00000005u, 0x00000004u)),
+        0u,
+        "i32x4.bitmask(v128_const(0x00000004u, 0x00000005u, 0x00000005u, 0x00000004u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x1EBC5BC2u, 0xC1946EEEu, 0x38828A78u, 0x9093F195u)),
+        1u,
+        "i32x4.all_true(v128_const(0x1EBC5BC2u, 0xC1946EEEu, 0x38828A78u, 0x9093F195u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x1EBC5BC2u, 0xC1946EEEu, 0x38828A78u, 0x9093F195u)),
+        10u,
+        "i32x4.bitmask(v128_const(0x1EBC5BC2u, 0xC1946EEEu, 0x38828A78u, 0x9093F195u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x72609F26u, 0xD291675Bu, 0x29BA3C53u, 0xC9427D2Fu)),
+        1u,
+        "i32x4.all_true(v128_const(0x72609F26u, 0xD291675Bu, 0x29BA3C53u, 0xC9427D2Fu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x72609F26u, 0xD291675Bu, 0x29BA3C53u, 0xC9427D2Fu)),
+        10u,
+        "i32x4.bitmask(v128_const(0x72609F26u, 0xD291675Bu, 0x29BA3C53u, 0xC9427D2Fu))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Eall_true(&instance, v128_const(0x1A293E7Bu, 0x3AEC3104u, 0x0EACEC69u, 0xBF95B092u)),
+        1u,
+        "i32x4.all_true(v128_const(0x1A293E7Bu, 0x3AEC3104u, 0x0EACEC69u, 0xBF95B092u))"
+    );
+    assertEqualU32(
+        simdboolean0_i32x4X2Ebitmask(&instance, v128_const(0x1A293E7Bu, 0x3AEC3104u, 0x0EACEC69u, 0xBF95B092u)),
+        8u,
+        "i32x4.bitmask(v128_const(0x1A293E7Bu, 0x3AEC3104u, 0x0EACEC69u, 0xBF95B092u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i64x2.all_true(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i64x2.bitmask(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        1u,
+        "i64x2.all_true(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        3u,
+        "i64x2.bitmask(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        1u,
+        "i64x2.all_true(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        0u,
+        "i64x2.bitmask(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i64x2.all_true(v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        0u,
+        "i64x2.bitmask(v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        0u,
+        "i64x2.all_true(v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        2u,
+        "i64x2.bitmask(v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        1u,
+        "i64x2.all_true(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        3u,
+        "i64x2.bitmask(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x00000004u, 0x00000000u, 0x00000005u, 0x00000000u)),
+        1u,
+        "i64x2.all_true(v128_const(0x00000004u, 0x00000000u, 0x00000005u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x00000004u, 0x00000000u, 0x00000005u, 0x00000000u)),
+        0u,
+        "i64x2.bitmask(v128_const(0x00000004u, 0x00000000u, 0x00000005u, 0x00000000u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0xA3381159u, 0x90026682u, 0xBF530EDBu, 0xC7BF1754u)),
+        1u,
+        "i64x2.all_true(v128_const(0xA3381159u, 0x90026682u, 0xBF530EDBu, 0xC7BF1754u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0xA3381159u, 0x90026682u, 0xBF530EDBu, 0xC7BF1754u)),
+        3u,
+        "i64x2.bitmask(v128_const(0xA3381159u, 0x90026682u, 0xBF530EDBu, 0xC7BF1754u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0x2F933575u, 0xB6DB1AF0u, 0x26FF91FEu, 0x4FD68B06u)),
+        1u,
+        "i64x2.all_true(v128_const(0x2F933575u, 0xB6DB1AF0u, 0x26FF91FEu, 0x4FD68B06u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0x2F933575u, 0xB6DB1AF0u, 0x26FF91FEu, 0x4FD68B06u)),
+        1u,
+        "i64x2.bitmask(v128_const(0x2F933575u, 0xB6DB1AF0u, 0x26FF91FEu, 0x4FD68B06u))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Eall_true(&instance, v128_const(0xEA0E21C1u, 0xE4246E05u, 0x53F3CED6u, 0xA7450A5Eu)),
+        1u,
+        "i64x2.all_true(v128_const(0xEA0E21C1u, 0xE4246E05u, 0x53F3CED6u, 0xA7450A5Eu))"
+    );
+    assertEqualU32(
+        simdboolean0_i64x2X2Ebitmask(&instance, v128_const(0xEA0E21C1u, 0xE4246E05u, 0x53F3CED6u, 0xA7450A5Eu)),
+        3u,
+        "i64x2.bitmask(v128_const(0xEA0E21C1u, 0xE4246E05u, 0x53F3CED6u, 0xA7450A5Eu))"
+    );
+}
@@ -0,0 +1,91 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_const.0.h"
+
+void test() {
+    simdconst0Instance instance;
+    simdconst0Instantiate(&instance, resolveTestImports);
+    printStart("simd_const.0.wasm");
+    assertEqualV128(
+        simdconst0_constX2D0(&instance),
+        v128_const(0x7F80FEFFu, 0x80FF0100u, 0x2010FF7Fu, 0x60504030u),
+        "const-0()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D1(&instance),
+        v128_const(0x8000FFFFu, 0xFFFF7FFFu, 0xFFFF1234u, 0x00010000u),
+        "const-1()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D2(&instance),
+        v128_const(0xFFFFFFFFu, 0x80000000u, 0x7FFFFFFFu, 0x12345678u),
+        "const-2()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D3(&instance),
+        v128_const(0x000F4240u, 0xFFFFFC18u, 0x00010000u, 0x00000000u),
+        "const-3()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D4(&instance),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x80000000u),
+        "const-4()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D5(&instance),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0x89ABCDEFu, 0x01234567u),
+        "const-5()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D6(&instance),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBFC00000u),
+        "const-6()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D7(&instance),
+        v128_const(0x7F800000u, 0xFF800000u, 0x00000001u, 0x7F7FFFFFu),
+        "const-7()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D8(&instance),
+        v128_const(0x7FC00000u, 0xFFC00000u, 0x7FA00000u, 0xFF800001u),
+        "const-8()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D9(&instance),
+        v128_const(0x40400000u, 0x501502F9u, 0xAEDBE6FFu, 0x3DCCCCCDu),
+        "const-9()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D10(&instance),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "const-10()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D11(&instance),
+        v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xC0020000u),
+        "const-11()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D12(&instance),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "const-12()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D13(&instance),
+        v128_const(0x00000001u, 0x00000000u, 0xFFFFFFFFu, 0x7FEFFFFFu),
+        "const-13()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D14(&instance),
+        v128_const(0x00000000u, 0x7FF80000u, 0x00000001u, 0xFFF00000u),
+        "const-14()"
+    );
+    assertEqualV128(
+        simdconst0_constX2D15(&instance),
+        v128_const(0x54800000u, 0x419D6F34u, 0xC2F8F359u, 0x01A56E1Fu),
+        "const-15()"
+    );
+}
@@ -0,0 +1,501 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_conversions.0.h"
+
+void test() {
+    simdconversions0Instance instance;
+    simdconversions0Instantiate(&instance, resolveTestImports);
+    printStart("simd_conversions.0.wasm");
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.convert_i32x4_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.convert_i32x4_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.convert_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "f32x4.convert_i32x4_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u)),
+        v128_const(0xCF000000u, 0x00000000u, 0xC0000000u, 0x4D24BB65u),
+        "f32x4.convert_i32x4_s(v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xCECF14A9u, 0x3F800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.convert_i32x4_s(v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u)),
+        v128_const(0x40000000u, 0xCF000000u, 0x4DF938CEu, 0x4EE4B3CAu),
+        "f32x4.convert_i32x4_s(v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u)),
+        v128_const(0xCEC25CB9u, 0xC0000000u, 0x4E3D7528u, 0x4E8A22A7u),
+        "f32x4.convert_i32x4_s(v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_s(&instance, v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u)),
+        v128_const(0x4B800000u, 0xCB800000u, 0x4EFFFFFFu, 0x4F000000u),
+        "f32x4.convert_i32x4_s(v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u)),
+        v128_const(0xFFC00000u, 0xC1DFFFFFu, 0x00000000u, 0x00000000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x28C00000u, 0xC1D9E295u, 0x00000000u, 0x3FF00000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xC1E00000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u)),
+        v128_const(0x26C00000u, 0xC1D84B97u, 0x00000000u, 0xC0000000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_s(&instance, v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u)),
+        v128_const(0x10000000u, 0x41700000u, 0x10000000u, 0xC1700000u),
+        "f64x2.convert_low_i32x4_s(v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.convert_i32x4_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.convert_i32x4_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x4F800000u, 0x4F800000u, 0x4F800000u, 0x4F800000u),
+        "f32x4.convert_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "f32x4.convert_i32x4_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u)),
+        v128_const(0x4F000000u, 0x00000000u, 0x4F800000u, 0x4D24BB65u),
+        "f32x4.convert_i32x4_u(v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x4F1875ABu, 0x3F800000u, 0x4F800000u, 0x4F800000u),
+        "f32x4.convert_i32x4_u(v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u)),
+        v128_const(0x40000000u, 0x4F000000u, 0x4DF938CEu, 0x4EE4B3CAu),
+        "f32x4.convert_i32x4_u(v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u)),
+        v128_const(0x4F1ED1A3u, 0x4F800000u, 0x4E3D7528u, 0x4E8A22A7u),
+        "f32x4.convert_i32x4_u(v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Econvert_i32x4_u(&instance, v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u)),
+        v128_const(0x4B800000u, 0x4F7F0000u, 0x4EFFFFFFu, 0x4F000000u),
+        "f32x4.convert_i32x4_u(v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFE00000u, 0x41EFFFFFu, 0xFFE00000u, 0x41EFFFFFu),
+        "f64x2.convert_low_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u)),
+        v128_const(0x00200000u, 0x41E00000u, 0x00000000u, 0x00000000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x80000001u, 0x00000000u, 0xFFFFFFFEu, 0x0A4BB649u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x6BA00000u, 0x41E30EB5u, 0x00000000u, 0x3FF00000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x9875AB5Du, 0x00000001u, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x41E00000u),
+        "f64x2.convert_low_i32x4_u(v128_const(0x00000002u, 0x80000000u, 0x1F2719B7u, 0x7259E504u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u)),
+        v128_const(0x6CA00000u, 0x41E3DA34u, 0xFFC00000u, 0x41EFFFFFu),
+        "f64x2.convert_low_i32x4_u(v128_const(0x9ED1A365u, 0xFFFFFFFEu, 0x2F5D49EDu, 0x45115383u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Econvert_low_i32x4_u(&instance, v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u)),
+        v128_const(0x10000000u, 0x41700000u, 0xFFE00000u, 0x41EFDFFFu),
+        "f64x2.convert_low_i32x4_u(v128_const(0x01000001u, 0xFEFFFFFFu, 0x7FFFFFBFu, 0x7FFFFFC0u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x3F800000u, 0xBF800000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x3F000000u, 0xBF000000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x3FC00000u, 0xBFC00000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x40200000u, 0xC0200000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x40400000u, 0xC0600000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x501502F9u, 0xAEDBE6FFu, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x00000001u, 0x80000000u, 0xD941E9B3u, 0xBE8AAC66u)),
+        v128_const(0x80000000u, 0xB4556337u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x00000001u, 0x80000000u, 0xD941E9B3u, 0xBE8AAC66u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0x8800759Cu, 0x7E37E43Cu, 0x00400000u, 0x3FF00000u)),
+        v128_const(0x7F800000u, 0x3F800000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0x8800759Cu, 0x7E37E43Cu, 0x00400000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f32x4X2Edemote_f64x2_zero(&instance, v128_const(0xC2F8F359u, 0x81A56E1Fu, 0x10000000u, 0x3FF00000u)),
+        v128_const(0x80000000u, 0x3F800000u, 0x00000000u, 0x00000000u),
+        "f32x4.demote_f64x2_zero(v128_const(0xC2F8F359u, 0x81A56E1Fu, 0x10000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.promote_low_f32x4(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u),
+        "f64x2.promote_low_f32x4(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u),
+        "f64x2.promote_low_f32x4(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0xA0000000u, 0x3FB99999u, 0xA0000000u, 0xC0FE240Cu),
+        "f64x2.promote_low_f32x4(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.promote_low_f32x4(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC7B96388u)),
+        v128_const(0x00000000u, 0x38100000u, 0x00000000u, 0x36A00000u),
+        "f64x2.promote_low_f32x4(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC7B96388u))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x3ECE4956u, 0x4038E297u, 0x7F7FFFFFu, 0xB635A2FFu)),
+        v128_const(0xC0000000u, 0x3FD9C92Au, 0xE0000000u, 0x40071C52u),
+        "f64x2.promote_low_f32x4(v128_const(0x3ECE4956u, 0x4038E297u, 0x7F7FFFFFu, 0xB635A2FFu))"
+    );
+    assertEqualV128(
+        simdconversions0_f64x2X2Epromote_low_f32x4(&instance, v128_const(0x36B50D50u, 0x43DA9707u, 0xC17ECED5u, 0x3F000000u)),
+        v128_const(0x00000000u, 0x3ED6A1AAu, 0xE0000000u, 0x407B52E0u),
+        "f64x2.promote_low_f32x4(v128_const(0x36B50D50u, 0x43DA9707u, 0xC17ECED5u, 0x3F000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.narrow_i16x8_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80808080u, 0x80808080u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.narrow_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.narrow_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.narrow_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x91F39361u, 0x9AB40001u, 0x2EB8D006u, 0x00025D04u), v128_const(0x800186C9u, 0xDE26FFFFu, 0x8000C0AFu, 0x00010000u)),
+        v128_const(0x80018080u, 0x027F7F80u, 0x80FF8080u, 0x01008080u),
+        "i8x16.narrow_i16x8_s(v128_const(0x91F39361u, 0x9AB40001u, 0x2EB8D006u, 0x00025D04u), v128_const(0x800186C9u, 0xDE26FFFFu, 0x8000C0AFu, 0x00010000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x443B8001u, 0x1E594000u, 0x00028001u, 0x06700055u), v128_const(0x0C8EFFFEu, 0x005522FBu, 0x150789F4u, 0xA69F0000u)),
+        v128_const(0x7F7F7F80u, 0x7F550280u, 0x557F7FFEu, 0x80007F80u),
+        "i8x16.narrow_i16x8_s(v128_const(0x443B8001u, 0x1E594000u, 0x00028001u, 0x06700055u), v128_const(0x0C8EFFFEu, 0x005522FBu, 0x150789F4u, 0xA69F0000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_s(&instance, v128_const(0x1791B83Cu, 0x8BDD7FFEu, 0x6BE7977Bu, 0xB8030002u), v128_const(0xFFFFA06Cu, 0x0001FFFFu, 0x0808C067u, 0x62D9D47Du)),
+        v128_const(0x807F7F80u, 0x80027F80u, 0x01FFFF80u, 0x7F807F80u),
+        "i8x16.narrow_i16x8_s(v128_const(0x1791B83Cu, 0x8BDD7FFEu, 0x6BE7977Bu, 0xB8030002u), v128_const(0xFFFFA06Cu, 0x0001FFFFu, 0x0808C067u, 0x62D9D47Du))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.narrow_i16x8_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x01010101u, 0x01010101u),
+        "i8x16.narrow_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.narrow_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.narrow_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.narrow_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x8001F569u, 0x2C020002u, 0x7FFF0002u, 0x4000FFFFu), v128_const(0x005501F2u, 0x80000001u, 0xEF502EB6u, 0xD7DC6E5Au)),
+        v128_const(0xFF020000u, 0xFF00FF02u, 0x000155FFu, 0x00FF00FFu),
+        "i8x16.narrow_i16x8_u(v128_const(0x8001F569u, 0x2C020002u, 0x7FFF0002u, 0x4000FFFFu), v128_const(0x005501F2u, 0x80000001u, 0xEF502EB6u, 0xD7DC6E5Au))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x759F0000u, 0x0055FFFEu, 0x94AC811Du, 0xFFFEFFFFu), v128_const(0x80005D17u, 0x380B0000u, 0x0055FFFEu, 0x07017FFEu)),
+        v128_const(0x5500FF00u, 0x00000000u, 0xFF0000FFu, 0xFFFF5500u),
+        "i8x16.narrow_i16x8_u(v128_const(0x759F0000u, 0x0055FFFEu, 0x94AC811Du, 0xFFFEFFFFu), v128_const(0x80005D17u, 0x380B0000u, 0x0055FFFEu, 0x07017FFEu))"
+    );
+    assertEqualV128(
+        simdconversions0_i8x16X2Enarrow_i16x8_u(&instance, v128_const(0x0000FD30u, 0xC0008000u, 0xD2372E67u, 0xAFAB7FFEu), v128_const(0x40002AD8u, 0x7FFF5FB9u, 0x0002B308u, 0xE0A64741u)),
+        v128_const(0x00000000u, 0x00FF00FFu, 0xFFFFFFFFu, 0x00FF0200u),
+        "i8x16.narrow_i16x8_u(v128_const(0x0000FD30u, 0xC0008000u, 0xD2372E67u, 0xAFAB7FFEu), v128_const(0x40002AD8u, 0x7FFF5FB9u, 0x0002B308u, 0xE0A64741u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.narrow_i32x4_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80008000u, 0x80008000u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.narrow_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.narrow_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.narrow_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x5602705Fu, 0xABC4D002u, 0x7FFFFFFFu, 0x00000001u), v128_const(0xF117482Fu, 0x00000002u, 0xC0000000u, 0x80000001u)),
+        v128_const(0x80007FFFu, 0x00017FFFu, 0x00028000u, 0x80008000u),
+        "i16x8.narrow_i32x4_s(v128_const(0x5602705Fu, 0xABC4D002u, 0x7FFFFFFFu, 0x00000001u), v128_const(0xF117482Fu, 0x00000002u, 0xC0000000u, 0x80000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0xFFFFFFFEu, 0x80000001u, 0x7FFFFFFEu, 0x3CD1226Fu), v128_const(0x758CDDA2u, 0x7FFFFFFFu, 0x40000000u, 0x54011829u)),
+        v128_const(0x8000FFFEu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.narrow_i32x4_s(v128_const(0xFFFFFFFEu, 0x80000001u, 0x7FFFFFFEu, 0x3CD1226Fu), v128_const(0x758CDDA2u, 0x7FFFFFFFu, 0x40000000u, 0x54011829u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_s(&instance, v128_const(0x5E831C3Eu, 0x26019E4Eu, 0x00000002u, 0x73A1D23Fu), v128_const(0xBAB76916u, 0x7FFFFFFFu, 0x94E85285u, 0x00000055u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF0002u, 0x7FFF8000u, 0x00558000u),
+        "i16x8.narrow_i32x4_s(v128_const(0x5E831C3Eu, 0x26019E4Eu, 0x00000002u, 0x73A1D23Fu), v128_const(0xBAB76916u, 0x7FFFFFFFu, 0x94E85285u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.narrow_i32x4_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00010001u, 0x00010001u),
+        "i16x8.narrow_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.narrow_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.narrow_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.narrow_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0xBCE45692u, 0x17AF72A1u, 0x0028F383u, 0xFFFFFFFFu), v128_const(0x87E74B05u, 0x00000000u, 0x2CE466A5u, 0x80000000u)),
+        v128_const(0xFFFF0000u, 0x0000FFFFu, 0x00000000u, 0x0000FFFFu),
+        "i16x8.narrow_i32x4_u(v128_const(0xBCE45692u, 0x17AF72A1u, 0x0028F383u, 0xFFFFFFFFu), v128_const(0x87E74B05u, 0x00000000u, 0x2CE466A5u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x973BED4Fu, 0x9A88C092u, 0x11E88EA2u, 0x80000001u), v128_const(0xF57DCB4Du, 0x1870C14Bu, 0x7FFFFFFFu, 0xFFFFFFFEu)),
+        v128_const(0x00000000u, 0x0000FFFFu, 0xFFFF0000u, 0x0000FFFFu),
+        "i16x8.narrow_i32x4_u(v128_const(0x973BED4Fu, 0x9A88C092u, 0x11E88EA2u, 0x80000001u), v128_const(0xF57DCB4Du, 0x1870C14Bu, 0x7FFFFFFFu, 0xFFFFFFFEu))"
+    );
+    assertEqualV128(
+        simdconversions0_i16x8X2Enarrow_i32x4_u(&instance, v128_const(0x5A7F3214u, 0xC0AFCE1Au, 0x0FA4886Bu, 0x7FFFFFFEu), v128_const(0xE92D636Au, 0x40B60110u, 0x7FFFFFFEu, 0x7FFFFFFEu)),
+        v128_const(0x0000FFFFu, 0xFFFFFFFFu, 0xFFFF0000u, 0xFFFFFFFFu),
+        "i16x8.narrow_i32x4_u(v128_const(0x5A7F3214u, 0xC0AFCE1Au, 0x0FA4886Bu, 0x7FFFFFFEu), v128_const(0xE92D636Au, 0x40B60110u, 0x7FFFFFFEu, 0x7FFFFFFEu))"
+    );
+}
@@ -0,0 +1,221 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f32x4.0.h"
+
+void test() {
+    simdf32x40Instance instance;
+    simdf32x40Instantiate(&instance, resolveTestImports);
+    printStart("simd_f32x4.0.wasm");
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.min(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.min(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.min(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.min(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.min(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.min(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u),
+        "f32x4.min(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u),
+        "f32x4.min(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u),
+        "f32x4.min(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu),
+        "f32x4.min(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0x3FBC3FF9u, 0xB43340BDu, 0xFF7FFFFFu, 0x4E4E2630u), v128_const(0xC7F12065u, 0x00800000u, 0xFF7FFFFFu, 0x3AFD23F4u)),
+        v128_const(0xC7F12065u, 0xB43340BDu, 0xFF7FFFFFu, 0x3AFD23F4u),
+        "f32x4.min(v128_const(0x3FBC3FF9u, 0xB43340BDu, 0xFF7FFFFFu, 0x4E4E2630u), v128_const(0xC7F12065u, 0x00800000u, 0xFF7FFFFFu, 0x3AFD23F4u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emin(&instance, v128_const(0xCCF52BB0u, 0x80000001u, 0x36CB0E12u, 0x3F000000u), v128_const(0x00000001u, 0xBE1D10C2u, 0xCB44BCAAu, 0x44A57805u)),
+        v128_const(0xCCF52BB0u, 0xBE1D10C2u, 0xCB44BCAAu, 0x3F000000u),
+        "f32x4.min(v128_const(0xCCF52BB0u, 0x80000001u, 0x36CB0E12u, 0x3F000000u), v128_const(0x00000001u, 0xBE1D10C2u, 0xCB44BCAAu, 0x44A57805u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.max(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.max(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.max(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.max(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.max(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.max(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.max(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u),
+        "f32x4.max(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u),
+        "f32x4.max(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u),
+        "f32x4.max(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0x00000001u, 0x4D9F2818u, 0x32A6D5EEu, 0xB40DE378u), v128_const(0xB250C436u, 0x4C827E94u, 0xC0200000u, 0x00000001u)),
+        v128_const(0x00000001u, 0x4D9F2818u, 0x32A6D5EEu, 0x00000001u),
+        "f32x4.max(v128_const(0x00000001u, 0x4D9F2818u, 0x32A6D5EEu, 0xB40DE378u), v128_const(0xB250C436u, 0x4C827E94u, 0xC0200000u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Emax(&instance, v128_const(0xCC3E32E8u, 0xB1908F21u, 0xBFC00000u, 0x4367F898u), v128_const(0x00800000u, 0xBC69C2F5u, 0xC019CD69u, 0x00800000u)),
+        v128_const(0x00800000u, 0xB1908F21u, 0xBFC00000u, 0x4367F898u),
+        "f32x4.max(v128_const(0xCC3E32E8u, 0xB1908F21u, 0xBFC00000u, 0x4367F898u), v128_const(0x00800000u, 0xBC69C2F5u, 0xC019CD69u, 0x00800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.abs(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x3F000000u, 0x3F000000u, 0x3FC00000u, 0x3FC00000u),
+        "f32x4.abs(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x40200000u, 0x40200000u, 0x40400000u, 0x40600000u),
+        "f32x4.abs(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x3DCCCCCDu, 0x47F12065u, 0x501502F9u, 0x2EDBE6FFu),
+        "f32x4.abs(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F7FFFFFu, 0x7F7FFFFFu),
+        "f32x4.abs(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x469363DEu)),
+        v128_const(0x00800000u, 0x00000001u, 0x00000001u, 0x469363DEu),
+        "f32x4.abs(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x469363DEu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x3A7B5E5Fu, 0xB14AF6BDu, 0xBEAC5E75u, 0x3FAA5E33u)),
+        v128_const(0x3A7B5E5Fu, 0x314AF6BDu, 0x3EAC5E75u, 0x3FAA5E33u),
+        "f32x4.abs(v128_const(0x3A7B5E5Fu, 0xB14AF6BDu, 0xBEAC5E75u, 0x3FAA5E33u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0xC1E8C435u, 0xC54DFDF1u, 0x3DCCCCCDu, 0x7F800000u)),
+        v128_const(0x41E8C435u, 0x454DFDF1u, 0x3DCCCCCDu, 0x7F800000u),
+        "f32x4.abs(v128_const(0xC1E8C435u, 0xC54DFDF1u, 0x3DCCCCCDu, 0x7F800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eabs(&instance, v128_const(0x7FC00000u, 0xB66484DEu, 0x32E171DAu, 0xBEFDA06Au)),
+        v128_const(0x7FC00000u, 0x366484DEu, 0x32E171DAu, 0x3EFDA06Au),
+        "f32x4.abs(v128_const(0x7FC00000u, 0xB66484DEu, 0x32E171DAu, 0xBEFDA06Au))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x80000000u, 0x00000000u, 0xBF800000u, 0x3F800000u),
+        "f32x4.neg(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0xBF000000u, 0x3F000000u, 0xBFC00000u, 0x3FC00000u),
+        "f32x4.neg(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0xC0200000u, 0x40200000u, 0xC0400000u, 0x40600000u),
+        "f32x4.neg(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0xBDCCCCCDu, 0x47F12065u, 0xD01502F9u, 0x2EDBE6FFu),
+        "f32x4.neg(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0xFF800000u, 0x7F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu),
+        "f32x4.neg(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xB92273B4u)),
+        v128_const(0x80800000u, 0x80000001u, 0x00000001u, 0x392273B4u),
+        "f32x4.neg(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xB92273B4u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x4066AE10u, 0x34597A2Au, 0xC0600000u, 0xB588D1E2u)),
+        v128_const(0xC066AE10u, 0xB4597A2Au, 0x40600000u, 0x3588D1E2u),
+        "f32x4.neg(v128_const(0x4066AE10u, 0x34597A2Au, 0xC0600000u, 0xB588D1E2u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0xB740822Du, 0x32DA6CA5u, 0x80000000u, 0x451D7164u)),
+        v128_const(0x3740822Du, 0xB2DA6CA5u, 0x00000000u, 0xC51D7164u),
+        "f32x4.neg(v128_const(0xB740822Du, 0x32DA6CA5u, 0x80000000u, 0x451D7164u))"
+    );
+    assertEqualV128(
+        simdf32x40_f32x4X2Eneg(&instance, v128_const(0x7FC00000u, 0xC1080A02u, 0xB0AE40FAu, 0x46BBAC12u)),
+        v128_const(0xFFC00000u, 0x41080A02u, 0x30AE40FAu, 0xC6BBAC12u),
+        "f32x4.neg(v128_const(0x7FC00000u, 0xC1080A02u, 0xB0AE40FAu, 0x46BBAC12u))"
+    );
+}
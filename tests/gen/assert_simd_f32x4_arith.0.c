@@ -0,0 +1,226 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f32x4_arith.0.h"
+
+void test() {
+    simdf32x4arith0Instance instance;
+    simdf32x4arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f32x4_arith.0.wasm");
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.add(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "f32x4.add(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.add(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.add(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3F400000u, 0x3F400000u, 0x3F400000u, 0x3F400000u),
+        "f32x4.add(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.add(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u),
+        "f32x4.add(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0xC267618Bu, 0x3AF1FDD6u, 0xC0600000u, 0x4E6CDDAEu), v128_const(0xAEDBE6FFu, 0x43CD5564u, 0x501502F9u, 0x42E2C075u)),
+        v128_const(0xC267618Bu, 0x43CD55A0u, 0x501502F9u, 0x4E6CDDB0u),
+        "f32x4.add(v128_const(0xC267618Bu, 0x3AF1FDD6u, 0xC0600000u, 0x4E6CDDAEu), v128_const(0xAEDBE6FFu, 0x43CD5564u, 0x501502F9u, 0x42E2C075u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Eadd(&instance, v128_const(0x80000000u, 0xCE9E8B18u, 0xB56E391Bu, 0xAEDBE6FFu), v128_const(0xBF000000u, 0x3DCCCCCDu, 0xBD29C984u, 0xCBBF3157u)),
+        v128_const(0xBF000000u, 0xCE9E8B18u, 0xBD29CA72u, 0xCBBF3157u),
+        "f32x4.add(v128_const(0x80000000u, 0xCE9E8B18u, 0xB56E391Bu, 0xAEDBE6FFu), v128_const(0xBF000000u, 0x3DCCCCCDu, 0xBD29C984u, 0xCBBF3157u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.sub(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.sub(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "f32x4.sub(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.sub(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.sub(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u),
+        "f32x4.sub(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x40800000u, 0x40800000u, 0x40800000u, 0x40800000u),
+        "f32x4.sub(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u),
+        "f32x4.sub(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x00000001u, 0xC043C42Fu, 0xB72A5D58u, 0xCD7AFB14u), v128_const(0xC3EC9666u, 0x7F800000u, 0xB1C3A281u, 0x00800000u)),
+        v128_const(0x43EC9666u, 0xFF800000u, 0xB72A44E4u, 0xCD7AFB14u),
+        "f32x4.sub(v128_const(0x00000001u, 0xC043C42Fu, 0xB72A5D58u, 0xCD7AFB14u), v128_const(0xC3EC9666u, 0x7F800000u, 0xB1C3A281u, 0x00800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Esub(&instance, v128_const(0x327F5BFAu, 0x3AD275EDu, 0xC637FBC0u, 0x7F7FFFFFu), v128_const(0xBFF46057u, 0x49331099u, 0xC77FADCCu, 0x7F7FFFFFu)),
+        v128_const(0x3FF46057u, 0xC9331099u, 0x4751AEDCu, 0x00000000u),
+        "f32x4.sub(v128_const(0x327F5BFAu, 0x3AD275EDu, 0xC637FBC0u, 0x7F7FFFFFu), v128_const(0xBFF46057u, 0x49331099u, 0xC77FADCCu, 0x7F7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.mul(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.mul(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.mul(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.mul(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u),
+        "f32x4.mul(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3E000000u, 0x3E000000u, 0x3E000000u, 0x3E000000u),
+        "f32x4.mul(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xC0700000u, 0xC0700000u, 0xC0700000u, 0xC0700000u),
+        "f32x4.mul(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.mul(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0x46B24706u, 0xBD7B7EF1u, 0xCBAD17A4u, 0x3F800000u), v128_const(0x4BCE11E8u, 0x377E8A1Fu, 0xC1610892u, 0x37AB2C13u)),
+        v128_const(0x530F819Fu, 0xB57A0FA4u, 0x4D982793u, 0x37AB2C13u),
+        "f32x4.mul(v128_const(0x46B24706u, 0xBD7B7EF1u, 0xCBAD17A4u, 0x3F800000u), v128_const(0x4BCE11E8u, 0x377E8A1Fu, 0xC1610892u, 0x37AB2C13u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Emul(&instance, v128_const(0xBC0C4FCCu, 0x3CAA8C1Au, 0x31A59405u, 0xB5A887D5u), v128_const(0xB0A0B1C7u, 0x3A46E46Cu, 0xAEDBE6FFu, 0x4D14A9B8u)),
+        v128_const(0x2D30269Fu, 0x37848089u, 0xA10E3B08u, 0xC343BC84u),
+        "f32x4.mul(v128_const(0xBC0C4FCCu, 0x3CAA8C1Au, 0x31A59405u, 0xB5A887D5u), v128_const(0xB0A0B1C7u, 0x3A46E46Cu, 0xAEDBE6FFu, 0x4D14A9B8u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.div(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.div(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.div(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "f32x4.div(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xBF19999Au, 0xBF19999Au, 0xBF19999Au, 0xBF19999Au),
+        "f32x4.div(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x60AD78ECu, 0x60AD78ECu, 0x60AD78ECu, 0x60AD78ECu),
+        "f32x4.div(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x00000000u, 0x46A8ABEEu, 0x40B1F646u, 0xC04A46ABu), v128_const(0xBC3C4277u, 0xC94EFC72u, 0x7F800000u, 0xC0200000u)),
+        v128_const(0x80000000u, 0xBCD09CD9u, 0x00000000u, 0x3FA1D222u),
+        "f32x4.div(v128_const(0x00000000u, 0x46A8ABEEu, 0x40B1F646u, 0xC04A46ABu), v128_const(0xBC3C4277u, 0xC94EFC72u, 0x7F800000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4arith0_f32x4X2Ediv(&instance, v128_const(0x7F7FFFFFu, 0xCA9AF646u, 0x47B0743Au, 0x422E1E0Fu), v128_const(0xBFCDADCCu, 0xCC196613u, 0xC0DD2870u, 0xB1E06B76u)),
+        v128_const(0xFF1F50F8u, 0x3E014DF0u, 0xC64C40D3u, 0xCFC69E7Fu),
+        "f32x4.div(v128_const(0x7F7FFFFFu, 0xCA9AF646u, 0x47B0743Au, 0x422E1E0Fu), v128_const(0xBFCDADCCu, 0xCC196613u, 0xC0DD2870u, 0xB1E06B76u))"
+    );
+}
@@ -0,0 +1,401 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f32x4_cmp.0.h"
+
+void test() {
+    simdf32x4cmp0Instance instance;
+    simdf32x4cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f32x4_cmp.0.wasm");
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.eq(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.eq(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x40400000u, 0x4077C8D4u, 0x3A32D796u, 0x49388AB8u), v128_const(0x3468EE84u, 0xB55F3EBAu, 0xC1AA25B0u, 0xBF000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x40400000u, 0x4077C8D4u, 0x3A32D796u, 0x49388AB8u), v128_const(0x3468EE84u, 0xB55F3EBAu, 0xC1AA25B0u, 0xBF000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0xC7D23E36u, 0x439F0044u, 0x427D7ADEu, 0xBFC00000u), v128_const(0x501502F9u, 0x3F000000u, 0x4A06E8A4u, 0x428069BBu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0xC7D23E36u, 0x439F0044u, 0x427D7ADEu, 0xBFC00000u), v128_const(0x501502F9u, 0x3F000000u, 0x4A06E8A4u, 0x428069BBu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Eeq(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.eq(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.ne(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.ne(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x33CBCE23u, 0xCB5529A7u, 0xC801713Du, 0x4B4079D9u), v128_const(0xC9C68B04u, 0xBB252944u, 0xBB573235u, 0x501502F9u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x33CBCE23u, 0xCB5529A7u, 0xC801713Du, 0x4B4079D9u), v128_const(0xC9C68B04u, 0xBB252944u, 0xBB573235u, 0x501502F9u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0xC0200000u, 0x3FC00000u, 0xCC1CC044u, 0x4B2315D7u), v128_const(0x486F7C43u, 0xBC5F0635u, 0x501502F9u, 0xC2F5291Au)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0xC0200000u, 0x3FC00000u, 0xCC1CC044u, 0x4B2315D7u), v128_const(0x486F7C43u, 0xBC5F0635u, 0x501502F9u, 0xC2F5291Au))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ene(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ne(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0xB405C709u, 0x3C6992D0u, 0x324A6631u, 0xC7E2A0D5u), v128_const(0x80000000u, 0x41C83F12u, 0x31CB2406u, 0xC7DBED33u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu),
+        "f32x4.lt(v128_const(0xB405C709u, 0x3C6992D0u, 0x324A6631u, 0xC7E2A0D5u), v128_const(0x80000000u, 0x41C83F12u, 0x31CB2406u, 0xC7DBED33u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x40200000u, 0xBED1FD81u, 0xC0600000u, 0xC9602171u), v128_const(0xAEDBE6FFu, 0xC7F12065u, 0x3B75EB75u, 0x4756E24Au)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.lt(v128_const(0x40200000u, 0xBED1FD81u, 0xC0600000u, 0xC9602171u), v128_const(0xAEDBE6FFu, 0xC7F12065u, 0x3B75EB75u, 0x4756E24Au))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Elt(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.lt(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.gt(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0xC0200000u, 0xFF800000u, 0xFF7FFFFFu, 0xCED0668Cu), v128_const(0xBCBD200Bu, 0x36D68D96u, 0x4725B0EAu, 0x3F000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0xC0200000u, 0xFF800000u, 0xFF7FFFFFu, 0xCED0668Cu), v128_const(0xBCBD200Bu, 0x36D68D96u, 0x4725B0EAu, 0x3F000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0xBB29EC94u, 0xC1146BECu, 0x3465C588u, 0xCB0EDC13u), v128_const(0x3F000000u, 0xFF7FFFFFu, 0x4DEE4E28u, 0xBF800000u)),
+        v128_const(0x00000000u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0xBB29EC94u, 0xC1146BECu, 0x3465C588u, 0xCB0EDC13u), v128_const(0x3F000000u, 0xFF7FFFFFu, 0x4DEE4E28u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Egt(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.gt(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.le(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.le(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.le(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.le(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x45A8AEC8u, 0xBAD77999u, 0xB22BF127u, 0x4D00BE63u), v128_const(0x00800000u, 0xBF800000u, 0x3C4B564Au, 0x44E564DBu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "f32x4.le(v128_const(0x45A8AEC8u, 0xBAD77999u, 0xB22BF127u, 0x4D00BE63u), v128_const(0x00800000u, 0xBF800000u, 0x3C4B564Au, 0x44E564DBu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0xB8A35A1Bu, 0x3DCCCCCDu, 0xCE2605C8u, 0x3F000000u), v128_const(0xC0200000u, 0x39E52531u, 0x80000000u, 0x34F54136u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "f32x4.le(v128_const(0xB8A35A1Bu, 0x3DCCCCCDu, 0xCE2605C8u, 0x3F000000u), v128_const(0xC0200000u, 0x39E52531u, 0x80000000u, 0x34F54136u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ele(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.le(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x00800000u, 0xC163F0FAu, 0x386A44F1u, 0x4E17FB1Du), v128_const(0x43BF272Fu, 0x00000001u, 0x48A18398u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu),
+        "f32x4.ge(v128_const(0x00800000u, 0xC163F0FAu, 0x386A44F1u, 0x4E17FB1Du), v128_const(0x43BF272Fu, 0x00000001u, 0x48A18398u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0xC5DF5C11u, 0xBA0039D0u, 0x3FC00000u, 0xB9172AEEu), v128_const(0x34E8E01Du, 0x378C0D04u, 0x80000000u, 0x3B14C100u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "f32x4.ge(v128_const(0xC5DF5C11u, 0xBA0039D0u, 0x3FC00000u, 0xB9172AEEu), v128_const(0x34E8E01Du, 0x378C0D04u, 0x80000000u, 0x3B14C100u))"
+    );
+    assertEqualV128(
+        simdf32x4cmp0_f32x4X2Ege(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.ge(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+}
@@ -0,0 +1,141 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f32x4_pmin_pmax.0.h"
+
+void test() {
+    simdf32x4pminpmax0Instance instance;
+    simdf32x4pminpmax0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f32x4_pmin_pmax.0.wasm");
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.pmin(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.pmin(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.pmin(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.pmin(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.pmin(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.pmin(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u),
+        "f32x4.pmin(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u),
+        "f32x4.pmin(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u),
+        "f32x4.pmin(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu),
+        "f32x4.pmin(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x80000000u, 0xFF800000u, 0x3A56251Eu, 0xB3E7694Bu), v128_const(0xBF800000u, 0x40200000u, 0x45E51B70u, 0x3F800000u)),
+        v128_const(0xBF800000u, 0xFF800000u, 0x3A56251Eu, 0xB3E7694Bu),
+        "f32x4.pmin(v128_const(0x80000000u, 0xFF800000u, 0x3A56251Eu, 0xB3E7694Bu), v128_const(0xBF800000u, 0x40200000u, 0x45E51B70u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0xC0200000u, 0x3FC00000u, 0x4A6463B4u, 0x4BFBEE34u), v128_const(0x40E27A4Cu, 0x3CCD62C9u, 0x381F4343u, 0xC0DC15CCu)),
+        v128_const(0xC0200000u, 0x3CCD62C9u, 0x381F4343u, 0xC0DC15CCu),
+        "f32x4.pmin(v128_const(0xC0200000u, 0x3FC00000u, 0x4A6463B4u, 0x4BFBEE34u), v128_const(0x40E27A4Cu, 0x3CCD62C9u, 0x381F4343u, 0xC0DC15CCu))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmin(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u),
+        "f32x4.pmin(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.pmax(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.pmax(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.pmax(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.pmax(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.pmax(v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u), v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.pmax(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u)),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.pmax(v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u), v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u)),
+        v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u),
+        "f32x4.pmax(v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u), v128_const(0x3E800000u, 0x3E800000u, 0x3E800000u, 0x3E800000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u)),
+        v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u),
+        "f32x4.pmax(v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u), v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu)),
+        v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u),
+        "f32x4.pmax(v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u), v128_const(0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu, 0x2EDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x42F10142u, 0xBDBBF115u, 0xBF5B9CB3u, 0x4E87FF1Au), v128_const(0xC7F12065u, 0xC0776928u, 0xC54DF2C6u, 0xCE77F63Eu)),
+        v128_const(0x42F10142u, 0xBDBBF115u, 0xBF5B9CB3u, 0x4E87FF1Au),
+        "f32x4.pmax(v128_const(0x42F10142u, 0xBDBBF115u, 0xBF5B9CB3u, 0x4E87FF1Au), v128_const(0xC7F12065u, 0xC0776928u, 0xC54DF2C6u, 0xCE77F63Eu))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x3B3E13B5u, 0x485B2392u, 0x3498D5A6u, 0x00800000u), v128_const(0xC8D4D6DFu, 0xC0200000u, 0xB28F73BBu, 0xB4F79E46u)),
+        v128_const(0x3B3E13B5u, 0x485B2392u, 0x3498D5A6u, 0x00800000u),
+        "f32x4.pmax(v128_const(0x3B3E13B5u, 0x485B2392u, 0x3498D5A6u, 0x00800000u), v128_const(0xC8D4D6DFu, 0xC0200000u, 0xB28F73BBu, 0xB4F79E46u))"
+    );
+    assertEqualV128(
+        simdf32x4pminpmax0_f32x4X2Epmax(&instance, v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u)),
+        v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u),
+        "f32x4.pmax(v128_const(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u), v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u))"
+    );
+}
@@ -0,0 +1,171 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f32x4_rounding.0.h"
+
+void test() {
+    simdf32x4rounding0Instance instance;
+    simdf32x4rounding0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f32x4_rounding.0.wasm");
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u),
+        "f32x4.ceil(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x3F800000u, 0x80000000u, 0x40000000u, 0xBF800000u),
+        "f32x4.ceil(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x40400000u, 0xC0000000u, 0x40400000u, 0xC0400000u),
+        "f32x4.ceil(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x3F800000u, 0xC7F12000u, 0x501502F9u, 0x80000000u),
+        "f32x4.ceil(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu),
+        "f32x4.ceil(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xCA5680BEu)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x80000000u, 0xCA5680BCu),
+        "f32x4.ceil(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xCA5680BEu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x36724A7Cu, 0x38A3416Eu, 0x3B98106Fu, 0xC3B2FDBEu)),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0xC3B28000u),
+        "f32x4.ceil(v128_const(0x36724A7Cu, 0x38A3416Eu, 0x3B98106Fu, 0xC3B2FDBEu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Eceil(&instance, v128_const(0x4877EF1Eu, 0xC88505FBu, 0x80000000u, 0x407366D1u)),
+        v128_const(0x4877EF40u, 0xC88505E0u, 0x80000000u, 0x40800000u),
+        "f32x4.ceil(v128_const(0x4877EF1Eu, 0xC88505FBu, 0x80000000u, 0x407366D1u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u),
+        "f32x4.floor(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0xBF800000u, 0x3F800000u, 0xC0000000u),
+        "f32x4.floor(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x40000000u, 0xC0400000u, 0x40400000u, 0xC0800000u),
+        "f32x4.floor(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x00000000u, 0xC7F12080u, 0x501502F9u, 0xBF800000u),
+        "f32x4.floor(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu),
+        "f32x4.floor(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x38AE141Au)),
+        v128_const(0x00000000u, 0x00000000u, 0xBF800000u, 0x00000000u),
+        "f32x4.floor(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x38AE141Au))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0xC89CB0D5u, 0xC2BDB1EBu, 0x7F800000u, 0x4DD62DB2u)),
+        v128_const(0xC89CB0E0u, 0xC2BE0000u, 0x7F800000u, 0x4DD62DB2u),
+        "f32x4.floor(v128_const(0xC89CB0D5u, 0xC2BDB1EBu, 0x7F800000u, 0x4DD62DB2u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Efloor(&instance, v128_const(0xB1612B3Au, 0x3F000000u, 0x00000000u, 0x3E89E80Cu)),
+        v128_const(0xBF800000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.floor(v128_const(0xB1612B3Au, 0x3F000000u, 0x00000000u, 0x3E89E80Cu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u),
+        "f32x4.trunc(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u),
+        "f32x4.trunc(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x40000000u, 0xC0000000u, 0x40400000u, 0xC0400000u),
+        "f32x4.trunc(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x00000000u, 0xC7F12000u, 0x501502F9u, 0x80000000u),
+        "f32x4.trunc(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu),
+        "f32x4.trunc(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC8993652u)),
+        v128_const(0x00000000u, 0x00000000u, 0x80000000u, 0xC8993640u),
+        "f32x4.trunc(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC8993652u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x331ED569u, 0x4B0BC3FCu, 0xB24A49E3u, 0xC0200000u)),
+        v128_const(0x00000000u, 0x4B0BC3FCu, 0x80000000u, 0xC0000000u),
+        "f32x4.trunc(v128_const(0x331ED569u, 0x4B0BC3FCu, 0xB24A49E3u, 0xC0200000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Etrunc(&instance, v128_const(0x3CFACA15u, 0x4009DB9Fu, 0x3793A0FEu, 0x7F800000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x7F800000u),
+        "f32x4.trunc(v128_const(0x3CFACA15u, 0x4009DB9Fu, 0x3793A0FEu, 0x7F800000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u),
+        "f32x4.nearest(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x40000000u, 0xC0000000u),
+        "f32x4.nearest(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x40000000u, 0xC0000000u, 0x40400000u, 0xC0800000u),
+        "f32x4.nearest(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x00000000u, 0xC7F12080u, 0x501502F9u, 0x80000000u),
+        "f32x4.nearest(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu),
+        "f32x4.nearest(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xB8A8EBDBu)),
+        v128_const(0x00000000u, 0x00000000u, 0x80000000u, 0x80000000u),
+        "f32x4.nearest(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xB8A8EBDBu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x00800000u, 0x3AD51239u, 0xFF800000u, 0x346DB0FEu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFF800000u, 0x00000000u),
+        "f32x4.nearest(v128_const(0x00800000u, 0x3AD51239u, 0xFF800000u, 0x346DB0FEu))"
+    );
+    assertEqualV128(
+        simdf32x4rounding0_f32x4X2Enearest(&instance, v128_const(0x4AC26EE2u, 0x4862C91Eu, 0xBF000000u, 0xC44BA663u)),
+        v128_const(0x4AC26EE2u, 0x4862C900u, 0x80000000u, 0xC44BC000u),
+        "f32x4.nearest(v128_const(0x4AC26EE2u, 0x4862C91Eu, 0xBF000000u, 0xC44BA663u))"
+    );
+}
@@ -0,0 +1,261 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f64x2.0.h"
+
+void test() {
+    simdf64x20Instance instance;
+    simdf64x20Instantiate(&instance, resolveTestImports);
+    printStart("simd_f64x2.0.wasm");
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.min(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.min(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.min(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.min(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.min(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.min(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.min(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u),
+        "f64x2.min(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u),
+        "f64x2.min(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu),
+        "f64x2.min(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0xCB94101Au, 0x40688D42u, 0xCD28B434u, 0xBE4755A7u), v128_const(0x8931AEDAu, 0xC10C1537u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x8931AEDAu, 0xC10C1537u, 0x00000000u, 0xBFF00000u),
+        "f64x2.min(v128_const(0xCB94101Au, 0x40688D42u, 0xCD28B434u, 0xBE4755A7u), v128_const(0x8931AEDAu, 0xC10C1537u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emin(&instance, v128_const(0x4DFD009Du, 0x410D90A5u, 0x6CAA6FC3u, 0xBE3D5A17u), v128_const(0xC57D77DAu, 0xBEE68AE4u, 0x00000000u, 0x7FF00000u)),
+        v128_const(0xC57D77DAu, 0xBEE68AE4u, 0x6CAA6FC3u, 0xBE3D5A17u),
+        "f64x2.min(v128_const(0x4DFD009Du, 0x410D90A5u, 0x6CAA6FC3u, 0xBE3D5A17u), v128_const(0xC57D77DAu, 0xBEE68AE4u, 0x00000000u, 0x7FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.max(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.max(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.max(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.max(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.max(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.max(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.max(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u),
+        "f64x2.max(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u),
+        "f64x2.max(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu),
+        "f64x2.max(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x9FFB58E4u, 0x3F5C7C6Du, 0x00000000u, 0x40040000u), v128_const(0xFE443301u, 0x40F87D31u, 0xDB9E0862u, 0xBF1BCBCAu)),
+        v128_const(0xFE443301u, 0x40F87D31u, 0x00000000u, 0x40040000u),
+        "f64x2.max(v128_const(0x9FFB58E4u, 0x3F5C7C6Du, 0x00000000u, 0x40040000u), v128_const(0xFE443301u, 0x40F87D31u, 0xDB9E0862u, 0xBF1BCBCAu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Emax(&instance, v128_const(0x8FDAEC45u, 0x41A42738u, 0x457BBC18u, 0xC03FC8C0u), v128_const(0x00000001u, 0x80000000u, 0x00000000u, 0x40080000u)),
+        v128_const(0x8FDAEC45u, 0x41A42738u, 0x00000000u, 0x40080000u),
+        "f64x2.max(v128_const(0x8FDAEC45u, 0x41A42738u, 0x457BBC18u, 0xC03FC8C0u), v128_const(0x00000001u, 0x80000000u, 0x00000000u, 0x40080000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x40040000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0x400C0000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0x40FE240Cu),
+        "f64x2.abs(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0x3DDB7CDFu),
+        "f64x2.abs(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0x7FEFFFFFu),
+        "f64x2.abs(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u),
+        "f64x2.abs(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000001u, 0x80000000u, 0x328DFE0Au, 0x41C2BE0Du)),
+        v128_const(0x00000001u, 0x00000000u, 0x328DFE0Au, 0x41C2BE0Du),
+        "f64x2.abs(v128_const(0x00000001u, 0x80000000u, 0x328DFE0Au, 0x41C2BE0Du))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eabs(&instance, v128_const(0x00000000u, 0x7FF80000u, 0xFE57EDABu, 0x3F5234DCu)),
+        v128_const(0x00000000u, 0x7FF80000u, 0xFE57EDABu, 0x3F5234DCu),
+        "f64x2.abs(v128_const(0x00000000u, 0x7FF80000u, 0xFE57EDABu, 0x3F5234DCu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x00000000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0xBFE00000u, 0x00000000u, 0x3FE00000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0xBFF80000u, 0x00000000u, 0x3FF80000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0x40040000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0xC0080000u, 0x00000000u, 0x400C0000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x9999999Au, 0xBFB99999u, 0x9FBE76C9u, 0x40FE240Cu),
+        "f64x2.neg(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0xC202A05Fu, 0xD9D7BDBBu, 0x3DDB7CDFu),
+        "f64x2.neg(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFEFFFFFu, 0xFFFFFFFFu, 0x7FEFFFFFu),
+        "f64x2.neg(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80100000u, 0x00000001u, 0x80000000u),
+        "f64x2.neg(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000001u, 0x80000000u, 0x9E544E61u, 0xC02087C9u)),
+        v128_const(0x00000001u, 0x00000000u, 0x9E544E61u, 0x402087C9u),
+        "f64x2.neg(v128_const(0x00000001u, 0x80000000u, 0x9E544E61u, 0xC02087C9u))"
+    );
+    assertEqualV128(
+        simdf64x20_f64x2X2Eneg(&instance, v128_const(0x00000000u, 0x7FF80000u, 0xE08F4967u, 0x3FC53944u)),
+        v128_const(0x00000000u, 0xFFF80000u, 0xE08F4967u, 0xBFC53944u),
+        "f64x2.neg(v128_const(0x00000000u, 0x7FF80000u, 0xE08F4967u, 0x3FC53944u))"
+    );
+}
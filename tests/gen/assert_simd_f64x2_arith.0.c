@@ -0,0 +1,236 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f64x2_arith.0.h"
+
+void test() {
+    simdf64x2arith0Instance instance;
+    simdf64x2arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f64x2_arith.0.wasm");
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.add(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "f64x2.add(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.add(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.add(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FE80000u, 0x00000000u, 0x3FE80000u),
+        "f64x2.add(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.add(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu),
+        "f64x2.add(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFEFFFFFu, 0xB3741B72u, 0x40E8887Du), v128_const(0xB1EE3726u, 0xBFD027E1u, 0x98C3EBBEu, 0xC1075058u)),
+        v128_const(0xFFFFFFFFu, 0xFFEFFFFFu, 0x2BE6E4E2u, 0xC1012E39u),
+        "f64x2.add(v128_const(0xFFFFFFFFu, 0xFFEFFFFFu, 0xB3741B72u, 0x40E8887Du), v128_const(0xB1EE3726u, 0xBFD027E1u, 0x98C3EBBEu, 0xC1075058u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Eadd(&instance, v128_const(0x29B379B9u, 0x3FD362D8u, 0x28F3E504u, 0xC0330276u), v128_const(0x0C5185EDu, 0xBEBC7250u, 0x090B877Au, 0xBEE18C6Au)),
+        v128_const(0x0D1F76A5u, 0x3FD362D1u, 0xB557354Cu, 0xC0330276u),
+        "f64x2.add(v128_const(0x29B379B9u, 0x3FD362D8u, 0x28F3E504u, 0xC0330276u), v128_const(0x0C5185EDu, 0xBEBC7250u, 0x090B877Au, 0xBEE18C6Au))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40100000u, 0x00000000u, 0x40100000u),
+        "f64x2.sub(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu),
+        "f64x2.sub(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0x03D15AAEu, 0x3FF5424Au, 0xB0CA2563u, 0xC066730Bu), v128_const(0xC94127FCu, 0xBFFD0CFAu, 0x00000000u, 0x3FF80000u)),
+        v128_const(0x66894155u, 0x400927A2u, 0xB0CA2563u, 0xC066A30Bu),
+        "f64x2.sub(v128_const(0x03D15AAEu, 0x3FF5424Au, 0xB0CA2563u, 0xC066730Bu), v128_const(0xC94127FCu, 0xBFFD0CFAu, 0x00000000u, 0x3FF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esub(&instance, v128_const(0xB0690B86u, 0x3EE63F91u, 0xABB75D6Du, 0x3FA25011u), v128_const(0x00000000u, 0x3FF00000u, 0xC5EF12D8u, 0x414DCF31u)),
+        v128_const(0xC06E4F97u, 0xBFEFFFE9u, 0xC15B0E6Du, 0xC14DCF31u),
+        "f64x2.sub(v128_const(0xB0690B86u, 0x3EE63F91u, 0xABB75D6Du, 0x3FA25011u), v128_const(0x00000000u, 0x3FF00000u, 0xC5EF12D8u, 0x414DCF31u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FC00000u, 0x00000000u, 0x3FC00000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0xC00E0000u, 0x00000000u, 0xC00E0000u),
+        "f64x2.mul(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.mul(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x32EA030Eu, 0xC123ED07u, 0x5F77CC79u, 0xBEE59874u), v128_const(0x07067D7Au, 0x3FEF89B5u, 0x2F5BF097u, 0x3E25E9ACu)),
+        v128_const(0x793548F5u, 0xC123A35Eu, 0x42CA6CE1u, 0xBD1D937Du),
+        "f64x2.mul(v128_const(0x32EA030Eu, 0xC123ED07u, 0x5F77CC79u, 0xBEE59874u), v128_const(0x07067D7Au, 0x3FEF89B5u, 0x2F5BF097u, 0x3E25E9ACu))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Emul(&instance, v128_const(0x00000001u, 0x00000000u, 0xB73BB84Eu, 0xC154246Cu), v128_const(0xD4D21C76u, 0x41D43700u, 0xDAD774B6u, 0x4093F859u)),
+        v128_const(0x50DC0353u, 0x00000000u, 0xCCCB4964u, 0xC1F923E6u),
+        "f64x2.mul(v128_const(0x00000001u, 0x00000000u, 0xB73BB84Eu, 0xC154246Cu), v128_const(0xD4D21C76u, 0x41D43700u, 0xDAD774B6u, 0x4093F859u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.div(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.div(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.div(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "f64x2.div(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x33333333u, 0xBFE33333u, 0x33333333u, 0xBFE33333u),
+        "f64x2.div(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x78B58C40u, 0x4415AF1Du, 0x78B58C40u, 0x4415AF1Du),
+        "f64x2.div(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x00000001u, 0x00000000u, 0x9FBE76C9u, 0xC0FE240Cu), v128_const(0xB5D0694Cu, 0xBE9028CAu, 0x524C3B7Bu, 0xC0967522u)),
+        v128_const(0x003F5E71u, 0x80000000u, 0xBDEC7833u, 0x40557956u),
+        "f64x2.div(v128_const(0x00000001u, 0x00000000u, 0x9FBE76C9u, 0xC0FE240Cu), v128_const(0xB5D0694Cu, 0xBE9028CAu, 0x524C3B7Bu, 0xC0967522u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Ediv(&instance, v128_const(0x2C69509Eu, 0xC0042401u, 0xD8B59810u, 0x4044110Cu), v128_const(0x337C8C34u, 0xBEE79E9Eu, 0x77A40425u, 0x40C2AEE4u)),
+        v128_const(0x0B5EA953u, 0x410B4964u, 0xAA21266Cu, 0x3F712F4Bu),
+        "f64x2.div(v128_const(0x2C69509Eu, 0xC0042401u, 0xD8B59810u, 0x4044110Cu), v128_const(0x337C8C34u, 0xBEE79E9Eu, 0x77A40425u, 0x40C2AEE4u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esqrt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.sqrt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2arith0_f64x2X2Esqrt(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x20000000u, 0x00000000u, 0x1E600000u),
+        "f64x2.sqrt(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+}
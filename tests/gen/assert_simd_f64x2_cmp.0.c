@@ -0,0 +1,401 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f64x2_cmp.0.h"
+
+void test() {
+    simdf64x2cmp0Instance instance;
+    simdf64x2cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f64x2_cmp.0.wasm");
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.eq(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.eq(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0xED4837FCu, 0x3EA46866u, 0x03DFB06Cu, 0x3FE2C6E4u), v128_const(0x9C76BEE8u, 0x3F7A970Fu, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0xED4837FCu, 0x3EA46866u, 0x03DFB06Cu, 0x3FE2C6E4u), v128_const(0x9C76BEE8u, 0x3F7A970Fu, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x6FFB5886u, 0xC054A0A4u, 0xA4D3432Eu, 0xBE4A105Cu), v128_const(0x00000000u, 0x00100000u, 0x31B48EEDu, 0x40D2815Bu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x6FFB5886u, 0xC054A0A4u, 0xA4D3432Eu, 0xBE4A105Cu), v128_const(0x00000000u, 0x00100000u, 0x31B48EEDu, 0x40D2815Bu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Eeq(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.eq(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ne(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ne(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x577D810Fu, 0xC0F3C716u, 0xDE41B642u, 0x3F708A9Du), v128_const(0x6C5E7978u, 0x3E9A9B60u, 0x994B8DEAu, 0xC082B696u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x577D810Fu, 0xC0F3C716u, 0xDE41B642u, 0x3F708A9Du), v128_const(0x6C5E7978u, 0x3E9A9B60u, 0x994B8DEAu, 0xC082B696u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x17F93646u, 0x41BCC30Au, 0x00000000u, 0xBFF80000u), v128_const(0xEFD8FD10u, 0xBE272298u, 0x00000000u, 0x3FE00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x17F93646u, 0x41BCC30Au, 0x00000000u, 0xBFF80000u), v128_const(0xEFD8FD10u, 0xBE272298u, 0x00000000u, 0x3FE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ene(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ne(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x9A966FB2u, 0xC16CE369u, 0x8305ABE0u, 0xBFE73D39u), v128_const(0xC5B9D698u, 0x3F962ADBu, 0x79067C9Au, 0x3E5D7ED2u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.lt(v128_const(0x9A966FB2u, 0xC16CE369u, 0x8305ABE0u, 0xBFE73D39u), v128_const(0xC5B9D698u, 0x3F962ADBu, 0x79067C9Au, 0x3E5D7ED2u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x00100000u, 0x533206F6u, 0xC124E9E6u), v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0x5817A8ACu, 0x416D606Bu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.lt(v128_const(0x00000000u, 0x00100000u, 0x533206F6u, 0xC124E9E6u), v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0x5817A8ACu, 0x416D606Bu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Elt(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.lt(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.gt(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x91BDF784u, 0x409ABB12u, 0xA985BC3Du, 0xBFF40D12u), v128_const(0x080490B4u, 0xBEC9707Du, 0xF0DB96DEu, 0x41B26C07u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x91BDF784u, 0x409ABB12u, 0xA985BC3Du, 0xBFF40D12u), v128_const(0x080490B4u, 0xBEC9707Du, 0xF0DB96DEu, 0x41B26C07u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x2DB1C127u, 0xC0074793u, 0x00000001u, 0x00000000u), v128_const(0x9311CB98u, 0x40D2A728u, 0x9999999Au, 0x3FB99999u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x2DB1C127u, 0xC0074793u, 0x00000001u, 0x00000000u), v128_const(0x9311CB98u, 0x40D2A728u, 0x9999999Au, 0x3FB99999u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Egt(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.gt(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.le(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.le(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.le(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.le(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0xAFD9A74Eu, 0xC08BCC1Bu, 0x8842BC36u, 0xBFBB5C14u), v128_const(0x57FA6C39u, 0xBE7F16C2u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0xAFD9A74Eu, 0xC08BCC1Bu, 0x8842BC36u, 0xBFBB5C14u), v128_const(0x57FA6C39u, 0xBE7F16C2u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x526577B4u, 0xC0311FE9u, 0xB1CC873Fu, 0x407934BEu), v128_const(0x11C270B2u, 0x400E2CA9u, 0x08FB103Au, 0xBF0E4B80u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x526577B4u, 0xC0311FE9u, 0xB1CC873Fu, 0x407934BEu), v128_const(0x11C270B2u, 0x400E2CA9u, 0x08FB103Au, 0xBF0E4B80u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ele(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.le(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "f64x2.ge(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x2733AF06u, 0xBFAFEEDDu, 0x00000000u, 0x3FF00000u), v128_const(0xBE981694u, 0xBF634206u, 0x00000000u, 0x40080000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ge(v128_const(0x2733AF06u, 0xBFAFEEDDu, 0x00000000u, 0x3FF00000u), v128_const(0xBE981694u, 0xBF634206u, 0x00000000u, 0x40080000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x4C81866Cu, 0xBEF833C9u, 0xA6973F98u, 0xBF6C8445u), v128_const(0x4F505B31u, 0xBF2BA039u, 0x00000001u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "f64x2.ge(v128_const(0x4C81866Cu, 0xBEF833C9u, 0xA6973F98u, 0xBF6C8445u), v128_const(0x4F505B31u, 0xBF2BA039u, 0x00000001u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2cmp0_f64x2X2Ege(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.ge(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+}
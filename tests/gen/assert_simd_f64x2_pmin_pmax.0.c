@@ -0,0 +1,141 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f64x2_pmin_pmax.0.h"
+
+void test() {
+    simdf64x2pminpmax0Instance instance;
+    simdf64x2pminpmax0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f64x2_pmin_pmax.0.wasm");
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu),
+        "f64x2.pmin(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x00000000u), v128_const(0x3B42B70Eu, 0xC130B1C1u, 0xD55771E7u, 0xC0DE6669u)),
+        v128_const(0x3B42B70Eu, 0xC130B1C1u, 0xD55771E7u, 0xC0DE6669u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x00000000u), v128_const(0x3B42B70Eu, 0xC130B1C1u, 0xD55771E7u, 0xC0DE6669u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0xBFF80000u, 0x6ECEB9A8u, 0xC0C36648u), v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x3FE00000u)),
+        v128_const(0x00000000u, 0xBFF80000u, 0x6ECEB9A8u, 0xC0C36648u),
+        "f64x2.pmin(v128_const(0x00000000u, 0xBFF80000u, 0x6ECEB9A8u, 0xC0C36648u), v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x3FE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmin(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u),
+        "f64x2.pmin(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u), v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u), v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u)),
+        v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u), v128_const(0x00000000u, 0x3FD00000u, 0x00000000u, 0x3FD00000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u), v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu),
+        "f64x2.pmax(v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu), v128_const(0xD9D7BDBBu, 0x3DDB7CDFu, 0xD9D7BDBBu, 0x3DDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x01217B60u, 0x3EBB1092u, 0xE655C467u, 0x40787BEFu), v128_const(0x1E542794u, 0xBF657D02u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x01217B60u, 0x3EBB1092u, 0xE655C467u, 0x40787BEFu),
+        "f64x2.pmax(v128_const(0x01217B60u, 0x3EBB1092u, 0xE655C467u, 0x40787BEFu), v128_const(0x1E542794u, 0xBF657D02u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x23E0C8A6u, 0xC16DE4CFu, 0xB51B032Fu, 0xC10ED03Du), v128_const(0x00000000u, 0x40040000u, 0xA8E58E05u, 0x412C7FBEu)),
+        v128_const(0x00000000u, 0x40040000u, 0xA8E58E05u, 0x412C7FBEu),
+        "f64x2.pmax(v128_const(0x23E0C8A6u, 0xC16DE4CFu, 0xB51B032Fu, 0xC10ED03Du), v128_const(0x00000000u, 0x40040000u, 0xA8E58E05u, 0x412C7FBEu))"
+    );
+    assertEqualV128(
+        simdf64x2pminpmax0_f64x2X2Epmax(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u)),
+        v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u),
+        "f64x2.pmax(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0x7FF80000u), v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u))"
+    );
+}
@@ -0,0 +1,251 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_f64x2_rounding.0.h"
+
+void test() {
+    simdf64x2rounding0Instance instance;
+    simdf64x2rounding0Instantiate(&instance, resolveTestImports);
+    printStart("simd_f64x2_rounding.0.wasm");
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x80000000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC0000000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC0080000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xC0FE2400u),
+        "f64x2.ceil(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x00000000u, 0x80000000u),
+        "f64x2.ceil(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu),
+        "f64x2.ceil(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.ceil(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Eceil(&instance, v128_const(0x00000001u, 0x80000000u, 0x598BF8A0u, 0x3E9B97AEu)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.ceil(v128_const(0x00000001u, 0x80000000u, 0x598BF8A0u, 0x3E9B97AEu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xC0000000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xC0080000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC0100000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xC0FE2410u),
+        "f64x2.floor(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x00000000u, 0xBFF00000u),
+        "f64x2.floor(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu),
+        "f64x2.floor(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.floor(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Efloor(&instance, v128_const(0x00000001u, 0x80000000u, 0xC1CEC9A3u, 0xBED0EA9Du)),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.floor(v128_const(0x00000001u, 0x80000000u, 0xC1CEC9A3u, 0xBED0EA9Du))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xC0000000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC0080000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xC0FE2400u),
+        "f64x2.trunc(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x00000000u, 0x80000000u),
+        "f64x2.trunc(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu),
+        "f64x2.trunc(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.trunc(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Etrunc(&instance, v128_const(0x00000001u, 0x80000000u, 0x446901A2u, 0xBFB31837u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.trunc(v128_const(0x00000001u, 0x80000000u, 0x446901A2u, 0xBFB31837u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xC0000000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0xC0000000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC0100000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xC0FE2410u),
+        "f64x2.nearest(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x00000000u, 0x80000000u),
+        "f64x2.nearest(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu),
+        "f64x2.nearest(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.nearest(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdf64x2rounding0_f64x2X2Enearest(&instance, v128_const(0x00000001u, 0x80000000u, 0xDD949FB6u, 0x41A80CE2u)),
+        v128_const(0x00000000u, 0x80000000u, 0xDE000000u, 0x41A80CE2u),
+        "f64x2.nearest(v128_const(0x00000001u, 0x80000000u, 0xDD949FB6u, 0x41A80CE2u))"
+    );
+}
@@ -0,0 +1,201 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_arith.0.h"
+
+void test() {
+    simdi16x8arith0Instance instance;
+    simdi16x8arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_arith.0.wasm");
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.add(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.add(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.add(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.add(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x40000F39u, 0xE95F09A5u, 0x731532C3u, 0x13F364CBu), v128_const(0x24310001u, 0x3A9178A7u, 0x0055FFFEu, 0xC000024Cu)),
+        v128_const(0x64310F3Au, 0x23F0824Cu, 0x736A32C1u, 0xD3F36717u),
+        "i16x8.add(v128_const(0x40000F39u, 0xE95F09A5u, 0x731532C3u, 0x13F364CBu), v128_const(0x24310001u, 0x3A9178A7u, 0x0055FFFEu, 0xC000024Cu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x592F557Cu, 0x0000B213u, 0xAEE1FE74u, 0xFFFF7BB5u), v128_const(0xA7B76F2Bu, 0xA2C78000u, 0x00003604u, 0x905AFFFEu)),
+        v128_const(0x00E6C4A7u, 0xA2C73213u, 0xAEE13478u, 0x90597BB3u),
+        "i16x8.add(v128_const(0x592F557Cu, 0x0000B213u, 0xAEE1FE74u, 0xFFFF7BB5u), v128_const(0xA7B76F2Bu, 0xA2C78000u, 0x00003604u, 0x905AFFFEu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eadd(&instance, v128_const(0x3E4EE62Eu, 0xFFFEDA33u, 0xC000D7DDu, 0xA2770055u), v128_const(0x52530000u, 0x19E820CCu, 0x7FFE0002u, 0xC7348001u)),
+        v128_const(0x90A1E62Eu, 0x19E6FAFFu, 0x3FFED7DFu, 0x69AB8056u),
+        "i16x8.add(v128_const(0x3E4EE62Eu, 0xFFFEDA33u, 0xC000D7DDu, 0xA2770055u), v128_const(0x52530000u, 0x19E820CCu, 0x7FFE0002u, 0xC7348001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.sub(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu),
+        "i16x8.sub(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80018001u, 0x80018001u, 0x80018001u, 0x80018001u),
+        "i16x8.sub(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x7FFF7FFFu, 0x36E80000u, 0x00023092u, 0xA0258001u), v128_const(0xA0017FFFu, 0xE04F472Bu, 0x0001E70Fu, 0x31BDCDBBu)),
+        v128_const(0xDFFE0000u, 0x5699B8D5u, 0x00014983u, 0x6E68B246u),
+        "i16x8.sub(v128_const(0x7FFF7FFFu, 0x36E80000u, 0x00023092u, 0xA0258001u), v128_const(0xA0017FFFu, 0xE04F472Bu, 0x0001E70Fu, 0x31BDCDBBu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x1E9AF204u, 0x58D7B8AFu, 0x00004981u, 0xD9368000u), v128_const(0x94410002u, 0x802C8001u, 0x8000E2CFu, 0x48D6A0A8u)),
+        v128_const(0x8A59F202u, 0xD8AB38AEu, 0x800066B2u, 0x9060DF58u),
+        "i16x8.sub(v128_const(0x1E9AF204u, 0x58D7B8AFu, 0x00004981u, 0xD9368000u), v128_const(0x94410002u, 0x802C8001u, 0x8000E2CFu, 0x48D6A0A8u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Esub(&instance, v128_const(0x35F2F0D2u, 0x7FFF36BBu, 0x9D9DF543u, 0x80017ADDu), v128_const(0xFDA79483u, 0xB6D8FFFEu, 0x120B0C88u, 0x25AD0000u)),
+        v128_const(0x384B5C4Fu, 0xC92736BDu, 0x8B92E8BBu, 0x5A547ADDu),
+        "i16x8.sub(v128_const(0x35F2F0D2u, 0x7FFF36BBu, 0x9D9DF543u, 0x80017ADDu), v128_const(0xFDA79483u, 0xB6D8FFFEu, 0x120B0C88u, 0x25AD0000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.mul(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.mul(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.mul(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.mul(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.mul(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.mul(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x64A20001u, 0x00019BB5u, 0xB599FFFFu, 0x429CC000u), v128_const(0x0055FFFFu, 0xAF9ABC21u, 0xFFFEC000u, 0x3BAD3AB7u)),
+        v128_const(0x69CAFFFFu, 0xAF9AFE55u, 0x94CE4000u, 0xF76C4000u),
+        "i16x8.mul(v128_const(0x64A20001u, 0x00019BB5u, 0xB599FFFFu, 0x429CC000u), v128_const(0x0055FFFFu, 0xAF9ABC21u, 0xFFFEC000u, 0x3BAD3AB7u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0x7CC87FFFu, 0x48C0FFFEu, 0xC0004000u, 0xE2E68001u), v128_const(0x39437FFEu, 0x0156E3F7u, 0x00028000u, 0x313F2308u)),
+        v128_const(0x30588002u, 0x30803812u, 0x80000000u, 0xDC9A2308u),
+        "i16x8.mul(v128_const(0x7CC87FFFu, 0x48C0FFFEu, 0xC0004000u, 0xE2E68001u), v128_const(0x39437FFEu, 0x0156E3F7u, 0x00028000u, 0x313F2308u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Emul(&instance, v128_const(0xFAD1C597u, 0x760C0000u, 0xC0008DF4u, 0x4588C000u), v128_const(0xD61C77D8u, 0x8902245Fu, 0x2D5D2125u, 0xF5D50055u)),
+        v128_const(0x24DCE868u, 0x58180000u, 0xC000F844u, 0x0228C000u),
+        "i16x8.mul(v128_const(0xFAD1C597u, 0x760C0000u, 0xC0008DF4u, 0x4588C000u), v128_const(0xD61C77D8u, 0x8902245Fu, 0x2D5D2125u, 0xF5D50055u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.neg(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.neg(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.neg(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.neg(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0xFFFE9E72u, 0x40002D59u, 0x7A368000u, 0xD3B9385Eu)),
+        v128_const(0x0002618Eu, 0xC000D2A7u, 0x85CA8000u, 0x2C47C7A2u),
+        "i16x8.neg(v128_const(0xFFFE9E72u, 0x40002D59u, 0x7A368000u, 0xD3B9385Eu))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0x14EBCD4Bu, 0x41F80001u, 0xB15EADCCu, 0x73B80000u)),
+        v128_const(0xEB1532B5u, 0xBE08FFFFu, 0x4EA25234u, 0x8C480000u),
+        "i16x8.neg(v128_const(0x14EBCD4Bu, 0x41F80001u, 0xB15EADCCu, 0x73B80000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0x00018CC2u, 0xE8157FAEu, 0x80010055u, 0xF91B6F63u)),
+        v128_const(0xFFFF733Eu, 0x17EB8052u, 0x7FFFFFABu, 0x06E5909Du),
+        "i16x8.neg(v128_const(0x00018CC2u, 0xE8157FAEu, 0x80010055u, 0xF91B6F63u))"
+    );
+    assertEqualV128(
+        simdi16x8arith0_i16x8X2Eneg(&instance, v128_const(0xFFFF0000u, 0x80008000u, 0x5A0F7FFEu, 0x3540C000u)),
+        v128_const(0x00010000u, 0x80008000u, 0xA5F18002u, 0xCAC04000u),
+        "i16x8.neg(v128_const(0xFFFF0000u, 0x80008000u, 0x5A0F7FFEu, 0x3540C000u))"
+    );
+}
@@ -0,0 +1,301 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_arith2.0.h"
+
+void test() {
+    simdi16x8arith20Instance instance;
+    simdi16x8arith20Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_arith2.0.wasm");
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.abs(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.abs(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.abs(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.abs(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x6182872Du, 0xF81F3D7Bu, 0xFFFE8000u, 0x40006123u)),
+        v128_const(0x618278D3u, 0x07E13D7Bu, 0x00028000u, 0x40006123u),
+        "i16x8.abs(v128_const(0x6182872Du, 0xF81F3D7Bu, 0xFFFE8000u, 0x40006123u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0xD67503A9u, 0x7FFF4000u, 0x80000055u, 0x94310055u)),
+        v128_const(0x298B03A9u, 0x7FFF4000u, 0x80000055u, 0x6BCF0055u),
+        "i16x8.abs(v128_const(0xD67503A9u, 0x7FFF4000u, 0x80000055u, 0x94310055u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x40005755u, 0x00010924u, 0x80017FFFu, 0xC0EEFFFEu)),
+        v128_const(0x40005755u, 0x00010924u, 0x7FFF7FFFu, 0x3F120002u),
+        "i16x8.abs(v128_const(0x40005755u, 0x00010924u, 0x80017FFFu, 0xC0EEFFFEu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eabs(&instance, v128_const(0x00557FFEu, 0xC00076F0u, 0x047C7FFEu, 0xB7A903C5u)),
+        v128_const(0x00557FFEu, 0x400076F0u, 0x047C7FFEu, 0x485703C5u),
+        "i16x8.abs(v128_const(0x00557FFEu, 0xC00076F0u, 0x047C7FFEu, 0xB7A903C5u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.min_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.min_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.min_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.min_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.min_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.min_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.min_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x8656B66Cu, 0x120C0001u, 0x98E8E228u, 0x8BFADF7Du), v128_const(0x8000D3FEu, 0x89517FFFu, 0x00016CDBu, 0xFFFFFFFFu)),
+        v128_const(0x8000B66Cu, 0x89510001u, 0x98E8E228u, 0x8BFADF7Du),
+        "i16x8.min_s(v128_const(0x8656B66Cu, 0x120C0001u, 0x98E8E228u, 0x8BFADF7Du), v128_const(0x8000D3FEu, 0x89517FFFu, 0x00016CDBu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0x2CE28001u, 0xED62398Fu, 0x80008000u, 0xF51CDDFEu), v128_const(0xA02484F0u, 0x15EF8000u, 0x80008000u, 0x00003ADEu)),
+        v128_const(0xA0248001u, 0xED628000u, 0x80008000u, 0xF51CDDFEu),
+        "i16x8.min_s(v128_const(0x2CE28001u, 0xED62398Fu, 0x80008000u, 0xF51CDDFEu), v128_const(0xA02484F0u, 0x15EF8000u, 0x80008000u, 0x00003ADEu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_s(&instance, v128_const(0xA79C0001u, 0x4B47FFFFu, 0xFFFE0000u, 0x0002280Du), v128_const(0x2C496D8Cu, 0x543F195Du, 0xF1E1703Cu, 0x00000001u)),
+        v128_const(0xA79C0001u, 0x4B47FFFFu, 0xF1E10000u, 0x00000001u),
+        "i16x8.min_s(v128_const(0xA79C0001u, 0x4B47FFFFu, 0xFFFE0000u, 0x0002280Du), v128_const(0x2C496D8Cu, 0x543F195Du, 0xF1E1703Cu, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.min_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.min_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.min_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.min_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.min_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.min_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.min_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0xC0007D6Eu, 0xE6ED0002u, 0x8C64BD3Bu, 0x7792CD26u), v128_const(0x0002B08Eu, 0x0055B11Fu, 0x80004528u, 0x40007FFFu)),
+        v128_const(0x00027D6Eu, 0x00550002u, 0x80004528u, 0x40007FFFu),
+        "i16x8.min_u(v128_const(0xC0007D6Eu, 0xE6ED0002u, 0x8C64BD3Bu, 0x7792CD26u), v128_const(0x0002B08Eu, 0x0055B11Fu, 0x80004528u, 0x40007FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0xFB49BDF9u, 0x80000002u, 0xB4C6ACE7u, 0xF86A98EDu), v128_const(0xFFFE8001u, 0x00021DB2u, 0x00557FFEu, 0xC4B0957Bu)),
+        v128_const(0xFB498001u, 0x00020002u, 0x00557FFEu, 0xC4B0957Bu),
+        "i16x8.min_u(v128_const(0xFB49BDF9u, 0x80000002u, 0xB4C6ACE7u, 0xF86A98EDu), v128_const(0xFFFE8001u, 0x00021DB2u, 0x00557FFEu, 0xC4B0957Bu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emin_u(&instance, v128_const(0xFFFE7FFFu, 0xEB9F357Du, 0xB2065772u, 0x0A8F0002u), v128_const(0x60C6A7AAu, 0xE5C3990Bu, 0x7E7FBE52u, 0x80014702u)),
+        v128_const(0x60C67FFFu, 0xE5C3357Du, 0x7E7F5772u, 0x0A8F0002u),
+        "i16x8.min_u(v128_const(0xFFFE7FFFu, 0xEB9F357Du, 0xB2065772u, 0x0A8F0002u), v128_const(0x60C6A7AAu, 0xE5C3990Bu, 0x7E7FBE52u, 0x80014702u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.max_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.max_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.max_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.max_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.max_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.max_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.max_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x0BADCF11u, 0x00028000u, 0x733E4DFAu, 0x364E0001u), v128_const(0xEAEBFFFFu, 0x0000FFFFu, 0xFBA3517Fu, 0x8EAA0001u)),
+        v128_const(0x0BADFFFFu, 0x0002FFFFu, 0x733E517Fu, 0x364E0001u),
+        "i16x8.max_s(v128_const(0x0BADCF11u, 0x00028000u, 0x733E4DFAu, 0x364E0001u), v128_const(0xEAEBFFFFu, 0x0000FFFFu, 0xFBA3517Fu, 0x8EAA0001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x8A62D848u, 0x16A11F71u, 0xFFFE3668u, 0x00000055u), v128_const(0x939C8000u, 0x00006FE5u, 0x8000FFFFu, 0x095E2C08u)),
+        v128_const(0x939CD848u, 0x16A16FE5u, 0xFFFE3668u, 0x095E2C08u),
+        "i16x8.max_s(v128_const(0x8A62D848u, 0x16A11F71u, 0xFFFE3668u, 0x00000055u), v128_const(0x939C8000u, 0x00006FE5u, 0x8000FFFFu, 0x095E2C08u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_s(&instance, v128_const(0x7FFE86FEu, 0x00558001u, 0x9292E35Eu, 0x8000FFFFu), v128_const(0x34B68000u, 0x653D3530u, 0xFFFFFDCFu, 0x80017FFEu)),
+        v128_const(0x7FFE86FEu, 0x653D3530u, 0xFFFFFDCFu, 0x80017FFEu),
+        "i16x8.max_s(v128_const(0x7FFE86FEu, 0x00558001u, 0x9292E35Eu, 0x8000FFFFu), v128_const(0x34B68000u, 0x653D3530u, 0xFFFFFDCFu, 0x80017FFEu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.max_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.max_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.max_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.max_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.max_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.max_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.max_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0xC1A95BAAu, 0x35360055u, 0x0002DBC2u, 0x7FFF4D5Au), v128_const(0x40008001u, 0x7FFF7F73u, 0xE56FB550u, 0x5AD67FFFu)),
+        v128_const(0xC1A98001u, 0x7FFF7F73u, 0xE56FDBC2u, 0x7FFF7FFFu),
+        "i16x8.max_u(v128_const(0xC1A95BAAu, 0x35360055u, 0x0002DBC2u, 0x7FFF4D5Au), v128_const(0x40008001u, 0x7FFF7F73u, 0xE56FB550u, 0x5AD67FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x24F50E77u, 0x00555FC7u, 0xC418B2C9u, 0xF9187FFFu), v128_const(0x00550002u, 0x15C2A65Du, 0x4EF0DD46u, 0x4000DD33u)),
+        v128_const(0x24F50E77u, 0x15C2A65Du, 0xC418DD46u, 0xF918DD33u),
+        "i16x8.max_u(v128_const(0x24F50E77u, 0x00555FC7u, 0xC418B2C9u, 0xF9187FFFu), v128_const(0x00550002u, 0x15C2A65Du, 0x4EF0DD46u, 0x4000DD33u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Emax_u(&instance, v128_const(0x85737FFFu, 0x80000001u, 0x0ADA0001u, 0xFFFE0A4Du), v128_const(0xBB14FFFFu, 0x00001793u, 0xFFFE5591u, 0xF4F8B8B6u)),
+        v128_const(0xBB14FFFFu, 0x80001793u, 0xFFFE5591u, 0xFFFEB8B6u),
+        "i16x8.max_u(v128_const(0x85737FFFu, 0x80000001u, 0x0ADA0001u, 0xFFFE0A4Du), v128_const(0xBB14FFFFu, 0x00001793u, 0xFFFE5591u, 0xF4F8B8B6u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.avgr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.avgr_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.avgr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x40004000u, 0x40004000u, 0x40004000u, 0x40004000u),
+        "i16x8.avgr_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xC000C000u, 0xC000C000u, 0xC000C000u, 0xC000C000u),
+        "i16x8.avgr_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.avgr_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.avgr_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0xA9030001u, 0xFFFF0002u, 0x7FFE0000u, 0xB8A94000u), v128_const(0xD47D3F2Eu, 0x26033866u, 0xEA6BB84Cu, 0xFFFEC000u)),
+        v128_const(0xBEC01F98u, 0x93011C34u, 0xB5355C26u, 0xDC548000u),
+        "i16x8.avgr_u(v128_const(0xA9030001u, 0xFFFF0002u, 0x7FFE0000u, 0xB8A94000u), v128_const(0xD47D3F2Eu, 0x26033866u, 0xEA6BB84Cu, 0xFFFEC000u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x80008000u, 0xC0004000u, 0x0A73D353u, 0xD83E1125u), v128_const(0x7EEE6EF1u, 0x0002BB41u, 0x4E753716u, 0x2EC682A5u)),
+        v128_const(0x7F777779u, 0x60017DA1u, 0x2C748535u, 0x838249E5u),
+        "i16x8.avgr_u(v128_const(0x80008000u, 0xC0004000u, 0x0A73D353u, 0xD83E1125u), v128_const(0x7EEE6EF1u, 0x0002BB41u, 0x4E753716u, 0x2EC682A5u))"
+    );
+    assertEqualV128(
+        simdi16x8arith20_i16x8X2Eavgr_u(&instance, v128_const(0x85FCF571u, 0xC1F4D812u, 0x00010055u, 0x0E05569Bu), v128_const(0xFFFFA8C3u, 0x4C480001u, 0xBCA447B6u, 0x00552EA8u)),
+        v128_const(0xC2FECF1Au, 0x871E6C0Au, 0x5E532406u, 0x072D42A2u),
+        "i16x8.avgr_u(v128_const(0x85FCF571u, 0xC1F4D812u, 0x00010055u, 0x0E05569Bu), v128_const(0xFFFFA8C3u, 0x4C480001u, 0xBCA447B6u, 0x00552EA8u))"
+    );
+}
@@ -0,0 +1,411 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_cmp.0.h"
+
+void test() {
+    simdi16x8cmp0Instance instance;
+    simdi16x8cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_cmp.0.wasm");
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.eq(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.eq(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.eq(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.eq(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.eq(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.eq(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Eeq(&instance, v128_const(0x8001750Eu, 0xF72C8B9Cu, 0x7FFFCC6Du, 0xFF1C2B47u), v128_const(0xF3B91A97u, 0x2FA8EDB8u, 0x7FFE4000u, 0xC5CDFFFEu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.eq(v128_const(0x8001750Eu, 0xF72C8B9Cu, 0x7FFFCC6Du, 0xFF1C2B47u), v128_const(0xF3B91A97u, 0x2FA8EDB8u, 0x7FFE4000u, 0xC5CDFFFEu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ne(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ne(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ne(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ne(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ne(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ne(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ene(&instance, v128_const(0x80018889u, 0xFFFE4000u, 0xBCE38001u, 0xC0008000u), v128_const(0x055008B8u, 0xC00024DFu, 0x8BEE2684u, 0x74707FFEu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ne(v128_const(0x80018889u, 0xFFFE4000u, 0xBCE38001u, 0xC0008000u), v128_const(0x055008B8u, 0xC00024DFu, 0x8BEE2684u, 0x74707FFEu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.lt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.lt_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_s(&instance, v128_const(0x7E906E4Au, 0x590A4830u, 0x00550001u, 0x08BD4000u), v128_const(0x5DCE4D11u, 0x57958000u, 0x4000A4E9u, 0xFFFE0002u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFF0000u, 0x00000000u),
+        "i16x8.lt_s(v128_const(0x7E906E4Au, 0x590A4830u, 0x00550001u, 0x08BD4000u), v128_const(0x5DCE4D11u, 0x57958000u, 0x4000A4E9u, 0xFFFE0002u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.lt_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.lt_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Elt_u(&instance, v128_const(0xC0007FFEu, 0xB534BADEu, 0x80018EE7u, 0x74E47FFFu), v128_const(0x00006FFEu, 0xC0000D9Cu, 0x02040000u, 0x00018000u)),
+        v128_const(0x00000000u, 0xFFFF0000u, 0x00000000u, 0x0000FFFFu),
+        "i16x8.lt_u(v128_const(0xC0007FFEu, 0xB534BADEu, 0x80018EE7u, 0x74E47FFFu), v128_const(0x00006FFEu, 0xC0000D9Cu, 0x02040000u, 0x00018000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.gt_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_s(&instance, v128_const(0x40008137u, 0x4DE8AFBEu, 0xD8CE81CCu, 0x28DA0055u), v128_const(0x800037CCu, 0x00007FFEu, 0xE9C67522u, 0xA341FFFEu)),
+        v128_const(0xFFFF0000u, 0xFFFF0000u, 0x00000000u, 0xFFFFFFFFu),
+        "i16x8.gt_s(v128_const(0x40008137u, 0x4DE8AFBEu, 0xD8CE81CCu, 0x28DA0055u), v128_const(0x800037CCu, 0x00007FFEu, 0xE9C67522u, 0xA341FFFEu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.gt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.gt_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.gt_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Egt_u(&instance, v128_const(0x1EDAFFFEu, 0x4000FFFEu, 0x06360000u, 0x005505EDu), v128_const(0x0000C2FEu, 0x5C507FF5u, 0x00014000u, 0x0BDA0000u)),
+        v128_const(0xFFFFFFFFu, 0x0000FFFFu, 0xFFFF0000u, 0x0000FFFFu),
+        "i16x8.gt_u(v128_const(0x1EDAFFFEu, 0x4000FFFEu, 0x06360000u, 0x005505EDu), v128_const(0x0000C2FEu, 0x5C507FF5u, 0x00014000u, 0x0BDA0000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.le_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_s(&instance, v128_const(0xC000A9D6u, 0x8000F6A8u, 0x0002D282u, 0x3D2459A3u), v128_const(0x0002A5E4u, 0xFFFE4000u, 0xDEFAC519u, 0xCE2D8000u)),
+        v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i16x8.le_s(v128_const(0xC000A9D6u, 0x8000F6A8u, 0x0002D282u, 0x3D2459A3u), v128_const(0x0002A5E4u, 0xFFFE4000u, 0xDEFAC519u, 0xCE2D8000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.le_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.le_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.le_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ele_u(&instance, v128_const(0x7DD3C88Cu, 0xCA20C5D3u, 0xF4400000u, 0xFFFE8001u), v128_const(0x70A1AE60u, 0x37010055u, 0xA4C40002u, 0x5A37EA0Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x0000FFFFu, 0x0000FFFFu),
+        "i16x8.le_u(v128_const(0x7DD3C88Cu, 0xCA20C5D3u, 0xF4400000u, 0xFFFE8001u), v128_const(0x70A1AE60u, 0x37010055u, 0xA4C40002u, 0x5A37EA0Fu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ge_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ge_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_s(&instance, v128_const(0x00B92C7Fu, 0xA93B7FFEu, 0x0AA132F5u, 0x6CD97FFFu), v128_const(0x7FFF1AAAu, 0x0001CD4Au, 0x7FFFFB0Du, 0xFFFE7E15u)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_s(v128_const(0x00B92C7Fu, 0xA93B7FFEu, 0x0AA132F5u, 0x6CD97FFFu), v128_const(0x7FFF1AAAu, 0x0001CD4Au, 0x7FFFFB0Du, 0xFFFE7E15u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.ge_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.ge_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8cmp0_i16x8X2Ege_u(&instance, v128_const(0xFFFE0001u, 0xFFFFD5B3u, 0x40001CCAu, 0xBDB98499u), v128_const(0x8001BF74u, 0x2F5B7FFEu, 0x800187EBu, 0xDC7DAA37u)),
+        v128_const(0xFFFF0000u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i16x8.ge_u(v128_const(0xFFFE0001u, 0xFFFFD5B3u, 0x40001CCAu, 0xBDB98499u), v128_const(0x8001BF74u, 0x2F5B7FFEu, 0x800187EBu, 0xDC7DAA37u))"
+    );
+}
@@ -0,0 +1,111 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_extadd_pairwise_i8x16.0.h"
+
+void test() {
+    simdi16x8extaddpairwisei8x160Instance instance;
+    simdi16x8extaddpairwisei8x160Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_extadd_pairwise_i8x16.0.wasm");
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u)),
+        v128_const(0x00040004u, 0x00040004u, 0x00040004u, 0x00040004u),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x55C080B3u, 0x051F4D81u, 0x01020346u, 0xF58040FFu)),
+        v128_const(0x0015FF33u, 0x0024FFCEu, 0x00030049u, 0xFF75003Fu),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x55C080B3u, 0x051F4D81u, 0x01020346u, 0xF58040FFu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x020A5381u, 0x257F7F81u, 0x824340FBu, 0xFE623083u)),
+        v128_const(0x000CFFD4u, 0x00A40000u, 0xFFC5003Bu, 0x0060FFB3u),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x020A5381u, 0x257F7F81u, 0x824340FBu, 0xFE623083u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x487FF240u, 0x387F688Du, 0x02810200u, 0xC04D1655u)),
+        v128_const(0x00C70032u, 0x00B7FFF5u, 0xFF830002u, 0x000D006Bu),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x487FF240u, 0x387F688Du, 0x02810200u, 0xC04D1655u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0xB7407EC0u, 0x5CC3BB20u, 0xC07FEDC0u, 0xAF7F74BBu)),
+        v128_const(0xFFF7003Eu, 0x001FFFDBu, 0x003FFFADu, 0x002E002Fu),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0xB7407EC0u, 0x5CC3BB20u, 0xC07FEDC0u, 0xAF7F74BBu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0x40B8407Fu, 0x3C7E81C0u, 0x80557FA2u, 0xAA02857Fu)),
+        v128_const(0xFFF800BFu, 0x00BAFF41u, 0xFFD50021u, 0xFFAC0004u),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0x40B8407Fu, 0x3C7E81C0u, 0x80557FA2u, 0xAA02857Fu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_s(&instance, v128_const(0xCAC0B0D7u, 0x01F14020u, 0xC02001FAu, 0x7F02FFFEu)),
+        v128_const(0xFF8AFF87u, 0xFFF20060u, 0xFFE0FFFBu, 0x0081FFFDu),
+        "i16x8.extadd_pairwise_i8x16_s(v128_const(0xCAC0B0D7u, 0x01F14020u, 0xC02001FAu, 0x7F02FFFEu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x01FE01FEu, 0x01FE01FEu, 0x01FE01FEu, 0x01FE01FEu),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u)),
+        v128_const(0x00040004u, 0x00040004u, 0x00040004u, 0x00040004u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0xAA371CA0u, 0x00A17E02u, 0xAD49577Eu, 0x7E02378Bu)),
+        v128_const(0x00E100BCu, 0x00A10080u, 0x00F600D5u, 0x008000C2u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0xAA371CA0u, 0x00A17E02u, 0xAD49577Eu, 0x7E02378Bu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x55017372u, 0x6B6E9C40u, 0x4355C0C0u, 0x8334028Du)),
+        v128_const(0x005600E5u, 0x00D900DCu, 0x00980180u, 0x00B7008Fu),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x55017372u, 0x6B6E9C40u, 0x4355C0C0u, 0x8334028Du))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x7F6EAC40u, 0x90812797u, 0x008FDEC8u, 0xDC0065FEu)),
+        v128_const(0x00ED00ECu, 0x011100BEu, 0x008F01A6u, 0x00DC0163u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x7F6EAC40u, 0x90812797u, 0x008FDEC8u, 0xDC0065FEu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x0155FF41u, 0xF755C06Du, 0x42E94600u, 0x7E55E3B8u)),
+        v128_const(0x00560140u, 0x014C012Du, 0x012B0046u, 0x00D3019Bu),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x0155FF41u, 0xF755C06Du, 0x42E94600u, 0x7E55E3B8u))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0xD6F3C802u, 0x7F004081u, 0x6B406D01u, 0x537F69BDu)),
+        v128_const(0x01C900CAu, 0x007F00C1u, 0x00AB006Eu, 0x00D20126u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0xD6F3C802u, 0x7F004081u, 0x6B406D01u, 0x537F69BDu))"
+    );
+    assertEqualV128(
+        simdi16x8extaddpairwisei8x160_i16x8X2Eextadd_pairwise_i8x16_u(&instance, v128_const(0x81944081u, 0x02FFDD01u, 0x4001FFA9u, 0x55B6FEA2u)),
+        v128_const(0x011500C1u, 0x010100DEu, 0x004101A8u, 0x010B01A0u),
+        "i16x8.extadd_pairwise_i8x16_u(v128_const(0x81944081u, 0x02FFDD01u, 0x4001FFA9u, 0x55B6FEA2u))"
+    );
+}
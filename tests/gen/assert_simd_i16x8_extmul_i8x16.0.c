@@ -0,0 +1,211 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_extmul_i8x16.0.h"
+
+void test() {
+    simdi16x8extmuli8x160Instance instance;
+    simdi16x8extmuli8x160Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_extmul_i8x16.0.wasm");
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.extmul_low_i8x16_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x007F007Fu, 0x007F007Fu, 0x007F007Fu, 0x007F007Fu),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00800080u, 0x00800080u, 0x00800080u, 0x00800080u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x3F013F01u, 0x3F013F01u, 0x3F013F01u, 0x3F013F01u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x40004000u, 0x40004000u, 0x40004000u, 0x40004000u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du)),
+        v128_const(0x134CF6A0u, 0xF000FFE6u, 0x01A901FEu, 0xF7400047u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu)),
+        v128_const(0x0000002Eu, 0x086FE4D6u, 0x1200C37Au, 0x36A2F790u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_s(&instance, v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u)),
+        v128_const(0xD580FFABu, 0x07BC0E9Au, 0xE2BBCAD8u, 0x007FF744u),
+        "i16x8.extmul_low_i8x16_s(v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu),
+        "i16x8.extmul_low_i8x16_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x007F007Fu, 0x007F007Fu, 0x007F007Fu, 0x007F007Fu),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7F807F80u, 0x7F807F80u, 0x7F807F80u, 0x7F807F80u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x3F013F01u, 0x3F013F01u, 0x3F013F01u, 0x3F013F01u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x40004000u, 0x40004000u, 0x40004000u, 0x40004000u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du)),
+        v128_const(0x134C16A0u, 0x30000CE6u, 0x01A9C4FEu, 0x1A400047u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu)),
+        v128_const(0x0000D12Eu, 0x086F21D6u, 0x1200427Au, 0x49A21F90u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_low_i8x16_u(&instance, v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u)),
+        v128_const(0x2A8054ABu, 0x07BC0E9Au, 0x1DBB48D8u, 0x807F1144u),
+        "i16x8.extmul_low_i8x16_u(v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.extmul_high_i8x16_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x007F007Fu, 0x007F007Fu, 0x007F007Fu, 0x007F007Fu),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00800080u, 0x00800080u, 0x00800080u, 0x00800080u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x3F013F01u, 0x3F013F01u, 0x3F013F01u, 0x3F013F01u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x40004000u, 0x40004000u, 0x40004000u, 0x40004000u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du)),
+        v128_const(0x21F6FD76u, 0x09482331u, 0xFD661441u, 0x0785FBF3u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu)),
+        v128_const(0xF438FFC0u, 0x1C4026B2u, 0xD99CE080u, 0xFF24FF38u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_s(&instance, v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u)),
+        v128_const(0x13200564u, 0x01F800FEu, 0xF3DC00AAu, 0xFF02F480u),
+        "i16x8.extmul_high_i8x16_s(v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu),
+        "i16x8.extmul_high_i8x16_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x007F007Fu, 0x007F007Fu, 0x007F007Fu, 0x007F007Fu),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7F807F80u, 0x7F807F80u, 0x7F807F80u, 0x7F807F80u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x3F013F01u, 0x3F013F01u, 0x3F013F01u, 0x3F013F01u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x40004000u, 0x40004000u, 0x40004000u, 0x40004000u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du)),
+        v128_const(0x21F61776u, 0x96486131u, 0x6C661441u, 0x078538F3u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x400D41B5u, 0x234755F6u, 0xE5B37EE7u, 0x19EFFA55u), v128_const(0xC0FE4C20u, 0xC00105CDu, 0xA88B451Au, 0x4D3D6F3Du))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu)),
+        v128_const(0x0E3800C0u, 0x6B4026B2u, 0x579C5E80u, 0x6D246338u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x118E5FFFu, 0x82284886u, 0x8F4E8C01u, 0xFEFEB2C0u), v128_const(0x7F3D00D2u, 0x91CA407Fu, 0xC07F1AC0u, 0x6E647E7Eu))"
+    );
+    assertEqualV128(
+        simdi16x8extmuli8x160_i16x8X2Eextmul_high_i8x16_u(&instance, v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u)),
+        v128_const(0x87200564u, 0x01F87FFEu, 0x62DC00AAu, 0x7E023480u),
+        "i16x8.extmul_high_i8x16_u(v128_const(0x6E2A5555u, 0xFF1A3B94u, 0x7EFEBC5Cu, 0x7FD2E455u), v128_const(0x125980FFu, 0x81AA817Eu, 0x0481B80Fu, 0xFE406F02u))"
+    );
+}
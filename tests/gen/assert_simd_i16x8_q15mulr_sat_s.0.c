@@ -0,0 +1,81 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_q15mulr_sat_s.0.h"
+
+void test() {
+    simdi16x8q15mulrsats0Instance instance;
+    simdi16x8q15mulrsats0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_q15mulr_sat_s.0.wasm");
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.q15mulr_sat_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.q15mulr_sat_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.q15mulr_sat_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.q15mulr_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.q15mulr_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu),
+        "i16x8.q15mulr_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.q15mulr_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0xC000BC6Au, 0x2BB50000u, 0x50D91072u, 0xC000782Au), v128_const(0xA6D50001u, 0x8001FF04u, 0xB66F7F28u, 0x8001F1D0u)),
+        v128_const(0x2C96FFFFu, 0xD44B0000u, 0xD1891056u, 0x4000F2AEu),
+        "i16x8.q15mulr_sat_s(v128_const(0xC000BC6Au, 0x2BB50000u, 0x50D91072u, 0xC000782Au), v128_const(0xA6D50001u, 0x8001FF04u, 0xB66F7F28u, 0x8001F1D0u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x2BEA8807u, 0x83258001u, 0x7FFF7B35u, 0x84515067u), v128_const(0x734B6DFFu, 0x488C0001u, 0xB406895Du, 0x237C8001u)),
+        v128_const(0x278E98E7u, 0xB93CFFFFu, 0xB4078DCEu, 0xDDB6AF9Au),
+        "i16x8.q15mulr_sat_s(v128_const(0x2BEA8807u, 0x83258001u, 0x7FFF7B35u, 0x84515067u), v128_const(0x734B6DFFu, 0x488C0001u, 0xB406895Du, 0x237C8001u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x7FFEF523u, 0xDE9F4000u, 0x0000C000u, 0xFFFF7FFFu), v128_const(0x84283B84u, 0x0000DDC8u, 0x00004000u, 0x7FFFC6E9u)),
+        v128_const(0x842AFAF3u, 0x0000EEE4u, 0x0000E000u, 0xFFFFC6E9u),
+        "i16x8.q15mulr_sat_s(v128_const(0x7FFEF523u, 0xDE9F4000u, 0x0000C000u, 0xFFFF7FFFu), v128_const(0x84283B84u, 0x0000DDC8u, 0x00004000u, 0x7FFFC6E9u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x80004000u, 0x00020055u, 0x0D3B3761u, 0xA24DFFFFu), v128_const(0xF2D8DF41u, 0xFFE1D246u, 0xC0000002u, 0xD1347FFEu)),
+        v128_const(0x0D28EFA1u, 0x0000FFE2u, 0xF9630001u, 0x2242FFFFu),
+        "i16x8.q15mulr_sat_s(v128_const(0x80004000u, 0x00020055u, 0x0D3B3761u, 0xA24DFFFFu), v128_const(0xF2D8DF41u, 0xFFE1D246u, 0xC0000002u, 0xD1347FFEu))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x179CFFFEu, 0x1DEDE1D2u, 0x373E6B67u, 0x4B540001u), v128_const(0x39C10001u, 0xA8338000u, 0x70E70055u, 0xFF02B52Au)),
+        v128_const(0x0AA70000u, 0xEB791E2Eu, 0x30BA0047u, 0xFF6BFFFFu),
+        "i16x8.q15mulr_sat_s(v128_const(0x179CFFFEu, 0x1DEDE1D2u, 0x373E6B67u, 0x4B540001u), v128_const(0x39C10001u, 0xA8338000u, 0x70E70055u, 0xFF02B52Au))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0x00027FFFu, 0x667D0001u, 0xD7C25907u, 0x20F20000u), v128_const(0x7FFE79CEu, 0x324CA9CDu, 0x5C610000u, 0xA79F8000u)),
+        v128_const(0x000279CDu, 0x2846FFFFu, 0xE2F50000u, 0xE9410000u),
+        "i16x8.q15mulr_sat_s(v128_const(0x00027FFFu, 0x667D0001u, 0xD7C25907u, 0x20F20000u), v128_const(0x7FFE79CEu, 0x324CA9CDu, 0x5C610000u, 0xA79F8000u))"
+    );
+    assertEqualV128(
+        simdi16x8q15mulrsats0_i16x8X2Eq15mulr_sat_s(&instance, v128_const(0xFFFFC000u, 0x71F9FBE0u, 0x7FFF889Du, 0xC0003AE3u), v128_const(0x03604A47u, 0x461D0055u, 0x9A391F06u, 0x00020001u)),
+        v128_const(0x0000DADDu, 0x3E6EFFFDu, 0x9A3AE310u, 0xFFFF0000u),
+        "i16x8.q15mulr_sat_s(v128_const(0xFFFFC000u, 0x71F9FBE0u, 0x7FFF889Du, 0xC0003AE3u), v128_const(0x03604A47u, 0x461D0055u, 0x9A391F06u, 0x00020001u))"
+    );
+}
@@ -0,0 +1,251 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i16x8_sat_arith.0.h"
+
+void test() {
+    simdi16x8satarith0Instance instance;
+    simdi16x8satarith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i16x8_sat_arith.0.wasm");
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add_sat_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.add_sat_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add_sat_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.add_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.add_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu),
+        "i16x8.add_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.add_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0xAF02FFFEu, 0x0000FFFEu, 0xC0002E12u, 0x84F50055u), v128_const(0x52BC0002u, 0x9971964Eu, 0x7EEC82C6u, 0xFB4C9330u)),
+        v128_const(0x01BE0000u, 0x9971964Cu, 0x3EECB0D8u, 0x80419385u),
+        "i16x8.add_sat_s(v128_const(0xAF02FFFEu, 0x0000FFFEu, 0xC0002E12u, 0x84F50055u), v128_const(0x52BC0002u, 0x9971964Eu, 0x7EEC82C6u, 0xFB4C9330u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x0001781Cu, 0x55F57FFEu, 0x636A0002u, 0x1CD10001u), v128_const(0xC000F5FDu, 0x8001FD43u, 0x80000000u, 0x6DBA7675u)),
+        v128_const(0xC0016E19u, 0xD5F67D41u, 0xE36A0002u, 0x7FFF7676u),
+        "i16x8.add_sat_s(v128_const(0x0001781Cu, 0x55F57FFEu, 0x636A0002u, 0x1CD10001u), v128_const(0xC000F5FDu, 0x8001FD43u, 0x80000000u, 0x6DBA7675u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x998A7C3Bu, 0x00558000u, 0xA9B780FAu, 0x8722A524u), v128_const(0x00550000u, 0x00023486u, 0x2DA60FE2u, 0xA0D74000u)),
+        v128_const(0x99DF7C3Bu, 0x0057B486u, 0xD75D90DCu, 0x8000E524u),
+        "i16x8.add_sat_s(v128_const(0x998A7C3Bu, 0x00558000u, 0xA9B780FAu, 0x8722A524u), v128_const(0x00550000u, 0x00023486u, 0x2DA60FE2u, 0xA0D74000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0xBC777FFEu, 0xFFFEFFFEu, 0xC000F482u, 0xBD78C89Fu), v128_const(0x87D20000u, 0x86148001u, 0x8AEBCC60u, 0xFFFF5147u)),
+        v128_const(0x80007FFEu, 0x86128000u, 0x8000C0E2u, 0xBD7719E6u),
+        "i16x8.add_sat_s(v128_const(0xBC777FFEu, 0xFFFEFFFEu, 0xC000F482u, 0xBD78C89Fu), v128_const(0x87D20000u, 0x86148001u, 0x8AEBCC60u, 0xFFFF5147u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_s(&instance, v128_const(0x8001EBBAu, 0xFFFF0001u, 0xC040FC9Eu, 0xA186FCCAu), v128_const(0x44AD0000u, 0x0055CC6Bu, 0x4C090000u, 0x6C260055u)),
+        v128_const(0xC4AEEBBAu, 0x0054CC6Cu, 0x0C49FC9Eu, 0x0DACFD1Fu),
+        "i16x8.add_sat_s(v128_const(0x8001EBBAu, 0xFFFF0001u, 0xC040FC9Eu, 0xA186FCCAu), v128_const(0x44AD0000u, 0x0055CC6Bu, 0x4C090000u, 0x6C260055u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.add_sat_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u),
+        "i16x8.add_sat_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.add_sat_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.add_sat_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.add_sat_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.add_sat_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.add_sat_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x686E5F02u, 0x7FFE2F77u, 0xFFFE9847u, 0x5105ABB1u), v128_const(0xFFFE40E4u, 0x190F6BABu, 0xFFFF5006u, 0xFFFE8001u)),
+        v128_const(0xFFFF9FE6u, 0x990D9B22u, 0xFFFFE84Du, 0xFFFFFFFFu),
+        "i16x8.add_sat_u(v128_const(0x686E5F02u, 0x7FFE2F77u, 0xFFFE9847u, 0x5105ABB1u), v128_const(0xFFFE40E4u, 0x190F6BABu, 0xFFFF5006u, 0xFFFE8001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x7FFE0000u, 0x19FE0055u, 0x9AAC882Bu, 0xB1390002u), v128_const(0x1313C000u, 0xFFFE458Bu, 0x4FFCFFFFu, 0x0000EC88u)),
+        v128_const(0x9311C000u, 0xFFFF45E0u, 0xEAA8FFFFu, 0xB139EC8Au),
+        "i16x8.add_sat_u(v128_const(0x7FFE0000u, 0x19FE0055u, 0x9AAC882Bu, 0xB1390002u), v128_const(0x1313C000u, 0xFFFE458Bu, 0x4FFCFFFFu, 0x0000EC88u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x73F25873u, 0x00026996u, 0xB2D7FFFFu, 0x4000766Fu), v128_const(0xD94C21AAu, 0xFCE97FFEu, 0x9A1E5928u, 0xC9358815u)),
+        v128_const(0xFFFF7A1Du, 0xFCEBE994u, 0xFFFFFFFFu, 0xFFFFFE84u),
+        "i16x8.add_sat_u(v128_const(0x73F25873u, 0x00026996u, 0xB2D7FFFFu, 0x4000766Fu), v128_const(0xD94C21AAu, 0xFCE97FFEu, 0x9A1E5928u, 0xC9358815u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0x4000E54Fu, 0x409BF0BFu, 0x4000FFFEu, 0x80010FDBu), v128_const(0xFFFF0000u, 0xC000890Bu, 0x8000FFFFu, 0xFFFF7DA6u)),
+        v128_const(0xFFFFE54Fu, 0xFFFFFFFFu, 0xC000FFFFu, 0xFFFF8D81u),
+        "i16x8.add_sat_u(v128_const(0x4000E54Fu, 0x409BF0BFu, 0x4000FFFEu, 0x80010FDBu), v128_const(0xFFFF0000u, 0xC000890Bu, 0x8000FFFFu, 0xFFFF7DA6u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Eadd_sat_u(&instance, v128_const(0xACC8C590u, 0x7FFE8001u, 0xFFFEFFFFu, 0x8DAE9479u), v128_const(0x80014000u, 0x7FFE8000u, 0x00554000u, 0xC000C000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFCFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.add_sat_u(v128_const(0xACC8C590u, 0x7FFE8001u, 0xFFFEFFFFu, 0x8DAE9479u), v128_const(0x80014000u, 0x7FFE8000u, 0x00554000u, 0xC000C000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.sub_sat_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu),
+        "i16x8.sub_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80018001u, 0x80018001u, 0x80018001u, 0x80018001u),
+        "i16x8.sub_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0xC0005A5Bu, 0x6BDCC49Fu, 0x0002CD76u, 0xFFFF6B92u), v128_const(0x1C2D4000u, 0x8167FFFFu, 0x00026443u, 0x8684077Du)),
+        v128_const(0xA3D31A5Bu, 0x7FFFC4A0u, 0x00008000u, 0x797B6415u),
+        "i16x8.sub_sat_s(v128_const(0xC0005A5Bu, 0x6BDCC49Fu, 0x0002CD76u, 0xFFFF6B92u), v128_const(0x1C2D4000u, 0x8167FFFFu, 0x00026443u, 0x8684077Du))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0xEAFFA88Cu, 0xDB63196Bu, 0xB5BD4000u, 0xC7E3C955u), v128_const(0x5698FFFEu, 0x7FFE211Du, 0x8000515Au, 0x461DF985u)),
+        v128_const(0x9467A88Eu, 0x8000F84Eu, 0x35BDEEA6u, 0x81C6CFD0u),
+        "i16x8.sub_sat_s(v128_const(0xEAFFA88Cu, 0xDB63196Bu, 0xB5BD4000u, 0xC7E3C955u), v128_const(0x5698FFFEu, 0x7FFE211Du, 0x8000515Au, 0x461DF985u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x00022A80u, 0x1B386694u, 0xB332DE64u, 0x8001C000u), v128_const(0xDB7B5FC6u, 0x259DB51Fu, 0xAAF7330Fu, 0x581BA51Fu)),
+        v128_const(0x2487CABAu, 0xF59B7FFFu, 0x083BAB55u, 0x80001AE1u),
+        "i16x8.sub_sat_s(v128_const(0x00022A80u, 0x1B386694u, 0xB332DE64u, 0x8001C000u), v128_const(0xDB7B5FC6u, 0x259DB51Fu, 0xAAF7330Fu, 0x581BA51Fu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0xC0000000u, 0xA6E8F9FDu, 0x005599BDu, 0xE540E189u), v128_const(0x15AB0C16u, 0x80000002u, 0x59F8E9B7u, 0x41EE471Eu)),
+        v128_const(0xAA55F3EAu, 0x26E8F9FBu, 0xA65DB006u, 0xA3529A6Bu),
+        "i16x8.sub_sat_s(v128_const(0xC0000000u, 0xA6E8F9FDu, 0x005599BDu, 0xE540E189u), v128_const(0x15AB0C16u, 0x80000002u, 0x59F8E9B7u, 0x41EE471Eu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_s(&instance, v128_const(0x60AC5CE7u, 0x0002C000u, 0x8F1DD0E2u, 0x7FFE7FFFu), v128_const(0x00550002u, 0x38CCE74Fu, 0x0002C37Eu, 0xBFC207EEu)),
+        v128_const(0x60575CE5u, 0xC736D8B1u, 0x8F1B0D64u, 0x7FFF7811u),
+        "i16x8.sub_sat_s(v128_const(0x60AC5CE7u, 0x0002C000u, 0x8F1DD0E2u, 0x7FFE7FFFu), v128_const(0x00550002u, 0x38CCE74Fu, 0x0002C37Eu, 0xBFC207EEu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu, 0xFFFEFFFEu),
+        "i16x8.sub_sat_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu, 0x7FFE7FFEu),
+        "i16x8.sub_sat_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x19738FB5u, 0x40008000u, 0x9B2CC000u, 0x5E9BACBCu), v128_const(0x87FC8C23u, 0x0002F0F0u, 0x0002CC91u, 0x5E940000u)),
+        v128_const(0x00000392u, 0x3FFE0000u, 0x9B2A0000u, 0x0007ACBCu),
+        "i16x8.sub_sat_u(v128_const(0x19738FB5u, 0x40008000u, 0x9B2CC000u, 0x5E9BACBCu), v128_const(0x87FC8C23u, 0x0002F0F0u, 0x0002CC91u, 0x5E940000u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x40007A83u, 0x50717FFFu, 0x8001A6D3u, 0xB49E0002u), v128_const(0x7DE30388u, 0xE96179FDu, 0xFFFF0055u, 0xFFFE5544u)),
+        v128_const(0x000076FBu, 0x00000602u, 0x0000A67Eu, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x40007A83u, 0x50717FFFu, 0x8001A6D3u, 0xB49E0002u), v128_const(0x7DE30388u, 0xE96179FDu, 0xFFFF0055u, 0xFFFE5544u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x87D0E2D1u, 0x8000E2C4u, 0x00015AEEu, 0xAF43D87Fu), v128_const(0x75FD210Cu, 0xA59D4000u, 0xF4020000u, 0x6361A644u)),
+        v128_const(0x11D3C1C5u, 0x0000A2C4u, 0x00005AEEu, 0x4BE2323Bu),
+        "i16x8.sub_sat_u(v128_const(0x87D0E2D1u, 0x8000E2C4u, 0x00015AEEu, 0xAF43D87Fu), v128_const(0x75FD210Cu, 0xA59D4000u, 0xF4020000u, 0x6361A644u))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x3D2B7FFEu, 0xC3C3E561u, 0xC000B73Du, 0x0000E9D2u), v128_const(0xFFFE5631u, 0xFFFF7FFEu, 0x21465BC9u, 0xFFFFFFFFu)),
+        v128_const(0x000029CDu, 0x00006563u, 0x9EBA5B74u, 0x00000000u),
+        "i16x8.sub_sat_u(v128_const(0x3D2B7FFEu, 0xC3C3E561u, 0xC000B73Du, 0x0000E9D2u), v128_const(0xFFFE5631u, 0xFFFF7FFEu, 0x21465BC9u, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi16x8satarith0_i16x8X2Esub_sat_u(&instance, v128_const(0x7FFFFFFEu, 0x25BB60ABu, 0xC4448001u, 0xF8D0E3C5u), v128_const(0x0055C6F1u, 0x6955D885u, 0x904678F5u, 0x2A5D7FFEu)),
+        v128_const(0x7FAA390Du, 0x00000000u, 0x33FE070Cu, 0xCE7363C7u),
+        "i16x8.sub_sat_u(v128_const(0x7FFFFFFEu, 0x25BB60ABu, 0xC4448001u, 0xF8D0E3C5u), v128_const(0x0055C6F1u, 0x6955D885u, 0x904678F5u, 0x2A5D7FFEu))"
+    );
+}
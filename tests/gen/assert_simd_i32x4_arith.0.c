@@ -0,0 +1,201 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_arith.0.h"
+
+void test() {
+    simdi32x4arith0Instance instance;
+    simdi32x4arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_arith.0.wasm");
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.add(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.add(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.add(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.add(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.add(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.add(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0xA10E228Eu, 0xFFFFFFFEu, 0x40000000u, 0x92802A51u), v128_const(0x00000000u, 0x7FFFFFFEu, 0x00000001u, 0x00A321FEu)),
+        v128_const(0xA10E228Eu, 0x7FFFFFFCu, 0x40000001u, 0x93234C4Fu),
+        "i32x4.add(v128_const(0xA10E228Eu, 0xFFFFFFFEu, 0x40000000u, 0x92802A51u), v128_const(0x00000000u, 0x7FFFFFFEu, 0x00000001u, 0x00A321FEu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0x15B57DDAu, 0x8B755A09u, 0xFFFF1A25u, 0x37480856u), v128_const(0xAEC5C69Fu, 0x00000001u, 0xA87E29A1u, 0xDBF1F4E0u)),
+        v128_const(0xC47B4479u, 0x8B755A0Au, 0xA87D43C6u, 0x1339FD36u),
+        "i32x4.add(v128_const(0x15B57DDAu, 0x8B755A09u, 0xFFFF1A25u, 0x37480856u), v128_const(0xAEC5C69Fu, 0x00000001u, 0xA87E29A1u, 0xDBF1F4E0u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eadd(&instance, v128_const(0xCE04A833u, 0x00000002u, 0x7FFFFFFEu, 0xE51CD431u), v128_const(0xEF702920u, 0x00000001u, 0x4B2A9796u, 0xD9A636A6u)),
+        v128_const(0xBD74D153u, 0x00000003u, 0xCB2A9794u, 0xBEC30AD7u),
+        "i32x4.add(v128_const(0xCE04A833u, 0x00000002u, 0x7FFFFFFEu, 0xE51CD431u), v128_const(0xEF702920u, 0x00000001u, 0x4B2A9796u, 0xD9A636A6u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.sub(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.sub(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFEu, 0x7FFFFFFEu, 0x7FFFFFFEu, 0x7FFFFFFEu),
+        "i32x4.sub(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000001u, 0x80000001u, 0x80000001u, 0x80000001u),
+        "i32x4.sub(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.sub(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.sub(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x459769E1u, 0x0A362AAAu, 0x1B22C0B4u, 0x34C5E70Au), v128_const(0x6DB1BBEEu, 0xDC7C7253u, 0xDACDAD29u, 0x7FFFFFFFu)),
+        v128_const(0xD7E5ADF3u, 0x2DB9B857u, 0x4055138Bu, 0xB4C5E70Bu),
+        "i32x4.sub(v128_const(0x459769E1u, 0x0A362AAAu, 0x1B22C0B4u, 0x34C5E70Au), v128_const(0x6DB1BBEEu, 0xDC7C7253u, 0xDACDAD29u, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0x00000002u, 0x312D9F21u, 0x13F3EB46u, 0xE6F5F5D9u), v128_const(0xC0000000u, 0x29A237E3u, 0x0E0EA3FAu, 0x4603707Eu)),
+        v128_const(0x40000002u, 0x078B673Eu, 0x05E5474Cu, 0xA0F2855Bu),
+        "i32x4.sub(v128_const(0x00000002u, 0x312D9F21u, 0x13F3EB46u, 0xE6F5F5D9u), v128_const(0xC0000000u, 0x29A237E3u, 0x0E0EA3FAu, 0x4603707Eu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Esub(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xDE6D532Du, 0xC0000000u), v128_const(0x50916DF6u, 0xBCDFB1E7u, 0x4BF3378Du, 0xC47AEBE8u)),
+        v128_const(0xAF6E9209u, 0xC3204E18u, 0x927A1BA0u, 0xFB851418u),
+        "i32x4.sub(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xDE6D532Du, 0xC0000000u), v128_const(0x50916DF6u, 0xBCDFB1E7u, 0x4BF3378Du, 0xC47AEBE8u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.mul(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.mul(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.mul(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.mul(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.mul(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.mul(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0xD1DD448Du, 0xFE914EF8u, 0x9E44CCECu, 0xBCE6BFF8u), v128_const(0xFAB351DDu, 0x840BADB1u, 0xAEBCE58Bu, 0x7664A785u)),
+        v128_const(0xCF4BCAB9u, 0x797D3178u, 0x5FFA6024u, 0xF7FC83D8u),
+        "i32x4.mul(v128_const(0xD1DD448Du, 0xFE914EF8u, 0x9E44CCECu, 0xBCE6BFF8u), v128_const(0xFAB351DDu, 0x840BADB1u, 0xAEBCE58Bu, 0x7664A785u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x00000055u, 0x00000001u, 0xD2B20DAFu, 0x9852BE0Fu), v128_const(0x27B10565u, 0x9B05814Fu, 0x80000000u, 0xE70FA399u)),
+        v128_const(0x2DC6CA89u, 0x9B05814Fu, 0x80000000u, 0x645823F7u),
+        "i32x4.mul(v128_const(0x00000055u, 0x00000001u, 0xD2B20DAFu, 0x9852BE0Fu), v128_const(0x27B10565u, 0x9B05814Fu, 0x80000000u, 0xE70FA399u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Emul(&instance, v128_const(0x15020E42u, 0xFFFFFFFFu, 0x7FFFFFFFu, 0x97B75AA6u), v128_const(0xBB03A743u, 0x00000001u, 0x489F0039u, 0x80000000u)),
+        v128_const(0x379CC946u, 0xFFFFFFFFu, 0x3760FFC7u, 0x00000000u),
+        "i32x4.mul(v128_const(0x15020E42u, 0xFFFFFFFFu, 0x7FFFFFFFu, 0x97B75AA6u), v128_const(0xBB03A743u, 0x00000001u, 0x489F0039u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.neg(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.neg(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.neg(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.neg(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x646CFA6Au, 0x80000000u, 0x7FFFFFFEu, 0xFFFFFFFFu)),
+        v128_const(0x9B930596u, 0x80000000u, 0x80000002u, 0x00000001u),
+        "i32x4.neg(v128_const(0x646CFA6Au, 0x80000000u, 0x7FFFFFFEu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0xEE9553B7u, 0xFFA332AFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x116AAC49u, 0x005CCD51u),
+        "i32x4.neg(v128_const(0x00000000u, 0x00000000u, 0xEE9553B7u, 0xFFA332AFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x8B5E9698u, 0xDA29E485u, 0x327A0710u, 0x7FFFFFFEu)),
+        v128_const(0x74A16968u, 0x25D61B7Bu, 0xCD85F8F0u, 0x80000002u),
+        "i32x4.neg(v128_const(0x8B5E9698u, 0xDA29E485u, 0x327A0710u, 0x7FFFFFFEu))"
+    );
+    assertEqualV128(
+        simdi32x4arith0_i32x4X2Eneg(&instance, v128_const(0x7FFFFFFFu, 0xB4870786u, 0x0B0BE7BBu, 0x40000000u)),
+        v128_const(0x80000001u, 0x4B78F87Au, 0xF4F41845u, 0xC0000000u),
+        "i32x4.neg(v128_const(0x7FFFFFFFu, 0xB4870786u, 0x0B0BE7BBu, 0x40000000u))"
+    );
+}
@@ -0,0 +1,251 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_arith2.0.h"
+
+void test() {
+    simdi32x4arith20Instance instance;
+    simdi32x4arith20Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_arith2.0.wasm");
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.abs(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.abs(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.abs(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u)),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.abs(v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x7FFFFFFFu, 0xC3283C4Eu, 0x8FF6149Au, 0x447D936Bu)),
+        v128_const(0x7FFFFFFFu, 0x3CD7C3B2u, 0x7009EB66u, 0x447D936Bu),
+        "i32x4.abs(v128_const(0x7FFFFFFFu, 0xC3283C4Eu, 0x8FF6149Au, 0x447D936Bu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x2CCF4265u, 0xE9C72E82u, 0x40000000u, 0x00000000u)),
+        v128_const(0x2CCF4265u, 0x1638D17Eu, 0x40000000u, 0x00000000u),
+        "i32x4.abs(v128_const(0x2CCF4265u, 0xE9C72E82u, 0x40000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x7FFFFFFFu, 0x00000002u, 0x80000001u, 0x00000055u)),
+        v128_const(0x7FFFFFFFu, 0x00000002u, 0x7FFFFFFFu, 0x00000055u),
+        "i32x4.abs(v128_const(0x7FFFFFFFu, 0x00000002u, 0x80000001u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Eabs(&instance, v128_const(0x40000000u, 0xFFFFFFFFu, 0x7FFFFFFEu, 0x7FFFFFFEu)),
+        v128_const(0x40000000u, 0x00000001u, 0x7FFFFFFEu, 0x7FFFFFFEu),
+        "i32x4.abs(v128_const(0x40000000u, 0xFFFFFFFFu, 0x7FFFFFFEu, 0x7FFFFFFEu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.min_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.min_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.min_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.min_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.min_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.min_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.min_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x9A498F72u, 0xFEDC20A9u), v128_const(0x00000000u, 0xEED4E51Eu, 0x36F551A6u, 0x958B224Fu)),
+        v128_const(0x00000000u, 0xEED4E51Eu, 0x9A498F72u, 0x958B224Fu),
+        "i32x4.min_s(v128_const(0x00000001u, 0x00000000u, 0x9A498F72u, 0xFEDC20A9u), v128_const(0x00000000u, 0xEED4E51Eu, 0x36F551A6u, 0x958B224Fu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x5B4DFAF5u, 0x2AAB9FE5u, 0x56497961u, 0x230F3944u), v128_const(0xE53B4725u, 0x00000002u, 0xDE1B5220u, 0x0A57F8B6u)),
+        v128_const(0xE53B4725u, 0x00000002u, 0xDE1B5220u, 0x0A57F8B6u),
+        "i32x4.min_s(v128_const(0x5B4DFAF5u, 0x2AAB9FE5u, 0x56497961u, 0x230F3944u), v128_const(0xE53B4725u, 0x00000002u, 0xDE1B5220u, 0x0A57F8B6u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_s(&instance, v128_const(0x80000000u, 0x7FFFFFFFu, 0xA6F75930u, 0xD7ECFD61u), v128_const(0x00000001u, 0x00000000u, 0xFFFFFFFEu, 0x9AEE37A1u)),
+        v128_const(0x80000000u, 0x00000000u, 0xA6F75930u, 0x9AEE37A1u),
+        "i32x4.min_s(v128_const(0x80000000u, 0x7FFFFFFFu, 0xA6F75930u, 0xD7ECFD61u), v128_const(0x00000001u, 0x00000000u, 0xFFFFFFFEu, 0x9AEE37A1u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.min_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.min_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.min_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.min_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.min_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.min_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.min_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x40000000u, 0xFFFFFFFFu, 0xC0000000u, 0x00000000u), v128_const(0x2245EF61u, 0x40000000u, 0x00000000u, 0x125F800Cu)),
+        v128_const(0x2245EF61u, 0x40000000u, 0x00000000u, 0x00000000u),
+        "i32x4.min_u(v128_const(0x40000000u, 0xFFFFFFFFu, 0xC0000000u, 0x00000000u), v128_const(0x2245EF61u, 0x40000000u, 0x00000000u, 0x125F800Cu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x15C38160u, 0x9BD0F111u, 0xA6E1955Eu, 0xCBDCA8C6u), v128_const(0x00000000u, 0x42E0A9ADu, 0x61610DC1u, 0x51D3B760u)),
+        v128_const(0x00000000u, 0x42E0A9ADu, 0x61610DC1u, 0x51D3B760u),
+        "i32x4.min_u(v128_const(0x15C38160u, 0x9BD0F111u, 0xA6E1955Eu, 0xCBDCA8C6u), v128_const(0x00000000u, 0x42E0A9ADu, 0x61610DC1u, 0x51D3B760u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emin_u(&instance, v128_const(0x5AF35CEDu, 0x7FFFFFFEu, 0xB945F703u, 0x80000001u), v128_const(0x7FFFFFFFu, 0x40000000u, 0xC0000000u, 0xC8656423u)),
+        v128_const(0x5AF35CEDu, 0x40000000u, 0xB945F703u, 0x80000001u),
+        "i32x4.min_u(v128_const(0x5AF35CEDu, 0x7FFFFFFEu, 0xB945F703u, 0x80000001u), v128_const(0x7FFFFFFFu, 0x40000000u, 0xC0000000u, 0xC8656423u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.max_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.max_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.max_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.max_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.max_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.max_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.max_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0xF3BC7E63u, 0x00000055u, 0x00000001u, 0x09928D3Fu), v128_const(0x962BC779u, 0xEEEF6CDDu, 0x9A7B364Bu, 0x210A0F58u)),
+        v128_const(0xF3BC7E63u, 0x00000055u, 0x00000001u, 0x210A0F58u),
+        "i32x4.max_s(v128_const(0xF3BC7E63u, 0x00000055u, 0x00000001u, 0x09928D3Fu), v128_const(0x962BC779u, 0xEEEF6CDDu, 0x9A7B364Bu, 0x210A0F58u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x00000055u, 0xA9206F53u, 0x653670B4u, 0x00000002u), v128_const(0xC0000000u, 0x40000000u, 0x531DD92Au, 0x0BC4CDECu)),
+        v128_const(0x00000055u, 0x40000000u, 0x653670B4u, 0x0BC4CDECu),
+        "i32x4.max_s(v128_const(0x00000055u, 0xA9206F53u, 0x653670B4u, 0x00000002u), v128_const(0xC0000000u, 0x40000000u, 0x531DD92Au, 0x0BC4CDECu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_s(&instance, v128_const(0x80000001u, 0x7D6D7473u, 0xFFFFFFFEu, 0x7D8CA424u), v128_const(0xCC7B2438u, 0xDAAD5D69u, 0x80000001u, 0x07AFA7AAu)),
+        v128_const(0xCC7B2438u, 0x7D6D7473u, 0xFFFFFFFEu, 0x7D8CA424u),
+        "i32x4.max_s(v128_const(0x80000001u, 0x7D6D7473u, 0xFFFFFFFEu, 0x7D8CA424u), v128_const(0xCC7B2438u, 0xDAAD5D69u, 0x80000001u, 0x07AFA7AAu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.max_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.max_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.max_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.max_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.max_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.max_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.max_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0xE517A479u, 0x00000002u, 0x4047FD78u, 0x83F13B48u), v128_const(0x40000000u, 0xE7B36521u, 0xFFFFFFFFu, 0x80000001u)),
+        v128_const(0xE517A479u, 0xE7B36521u, 0xFFFFFFFFu, 0x83F13B48u),
+        "i32x4.max_u(v128_const(0xE517A479u, 0x00000002u, 0x4047FD78u, 0x83F13B48u), v128_const(0x40000000u, 0xE7B36521u, 0xFFFFFFFFu, 0x80000001u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0x9AEEAB54u, 0x626EACACu, 0x80000001u, 0xA8A6013Fu), v128_const(0xB4CB248Fu, 0x00000002u, 0xA4837AF8u, 0x40000000u)),
+        v128_const(0xB4CB248Fu, 0x626EACACu, 0xA4837AF8u, 0xA8A6013Fu),
+        "i32x4.max_u(v128_const(0x9AEEAB54u, 0x626EACACu, 0x80000001u, 0xA8A6013Fu), v128_const(0xB4CB248Fu, 0x00000002u, 0xA4837AF8u, 0x40000000u))"
+    );
+    assertEqualV128(
+        simdi32x4arith20_i32x4X2Emax_u(&instance, v128_const(0xFD479583u, 0x00000000u, 0xE4BACAFEu, 0x00000001u), v128_const(0x0D0E0946u, 0x8DF4273Fu, 0x9995CA7Au, 0x43AE9137u)),
+        v128_const(0xFD479583u, 0x8DF4273Fu, 0xE4BACAFEu, 0x43AE9137u),
+        "i32x4.max_u(v128_const(0xFD479583u, 0x00000000u, 0xE4BACAFEu, 0x00000001u), v128_const(0x0D0E0946u, 0x8DF4273Fu, 0x9995CA7Au, 0x43AE9137u))"
+    );
+}
@@ -0,0 +1,411 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_cmp.0.h"
+
+void test() {
+    simdi32x4cmp0Instance instance;
+    simdi32x4cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_cmp.0.wasm");
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.eq(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.eq(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.eq(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.eq(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.eq(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.eq(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Eeq(&instance, v128_const(0x00000000u, 0x7FFFFFFFu, 0x5074931Cu, 0x80000000u), v128_const(0x33ECA0F4u, 0x7FFFFFFEu, 0x00000001u, 0xA32C7E15u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.eq(v128_const(0x00000000u, 0x7FFFFFFFu, 0x5074931Cu, 0x80000000u), v128_const(0x33ECA0F4u, 0x7FFFFFFEu, 0x00000001u, 0xA32C7E15u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ne(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ne(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ne(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ne(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ne(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ne(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ene(&instance, v128_const(0x40000000u, 0xE46489AFu, 0x00000001u, 0x2536EC14u), v128_const(0xACCFA66Fu, 0x25667C08u, 0x8E13E8CCu, 0x65F8CB88u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ne(v128_const(0x40000000u, 0xE46489AFu, 0x00000001u, 0x2536EC14u), v128_const(0xACCFA66Fu, 0x25667C08u, 0x8E13E8CCu, 0x65F8CB88u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.lt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.lt_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_s(&instance, v128_const(0x80000000u, 0xFFFFFFFFu, 0xC5BFF02Cu, 0xFFFFFFFEu), v128_const(0x68A153F6u, 0x40000000u, 0xFE1828B6u, 0x6C0374A3u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.lt_s(v128_const(0x80000000u, 0xFFFFFFFFu, 0xC5BFF02Cu, 0xFFFFFFFEu), v128_const(0x68A153F6u, 0x40000000u, 0xFE1828B6u, 0x6C0374A3u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.lt_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.lt_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Elt_u(&instance, v128_const(0xDE31BB72u, 0x7FFFFFFFu, 0xF59D6BFEu, 0xB0802E63u), v128_const(0x80000000u, 0x39DE3089u, 0x00000055u, 0xFFFFFFFEu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu),
+        "i32x4.lt_u(v128_const(0xDE31BB72u, 0x7FFFFFFFu, 0xF59D6BFEu, 0xB0802E63u), v128_const(0x80000000u, 0x39DE3089u, 0x00000055u, 0xFFFFFFFEu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.gt_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0x272A8162u, 0x40000000u, 0x975EAECDu), v128_const(0x1384775Du, 0x40000000u, 0xAE565B5Fu, 0x04DBE1FBu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.gt_s(v128_const(0xFFFFFFFFu, 0x272A8162u, 0x40000000u, 0x975EAECDu), v128_const(0x1384775Du, 0x40000000u, 0xAE565B5Fu, 0x04DBE1FBu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.gt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.gt_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Egt_u(&instance, v128_const(0x00000002u, 0x81C19196u, 0x99CCAA18u, 0x977DF50Fu), v128_const(0xFFFFFFFFu, 0x00000055u, 0x220D126Eu, 0xBACFBEB9u)),
+        v128_const(0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.gt_u(v128_const(0x00000002u, 0x81C19196u, 0x99CCAA18u, 0x977DF50Fu), v128_const(0xFFFFFFFFu, 0x00000055u, 0x220D126Eu, 0xBACFBEB9u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.le_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_s(&instance, v128_const(0x255DD4DEu, 0x00000001u, 0xC2BBCA57u, 0x52CFC592u), v128_const(0xE9E9DE3Cu, 0x9A3EB9DDu, 0x1D0541E5u, 0xFFFFFFFEu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.le_s(v128_const(0x255DD4DEu, 0x00000001u, 0xC2BBCA57u, 0x52CFC592u), v128_const(0xE9E9DE3Cu, 0x9A3EB9DDu, 0x1D0541E5u, 0xFFFFFFFEu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.le_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.le_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.le_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ele_u(&instance, v128_const(0x42849EE1u, 0xC0000000u, 0x00000002u, 0xC0000000u), v128_const(0x40000000u, 0x93F64873u, 0xEAAA118Au, 0x7FFFFFFEu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.le_u(v128_const(0x42849EE1u, 0xC0000000u, 0x00000002u, 0xC0000000u), v128_const(0x40000000u, 0x93F64873u, 0xEAAA118Au, 0x7FFFFFFEu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ge_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ge_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0xE9777885u, 0x3D0C3B58u, 0x4DDABDFEu), v128_const(0x6708F207u, 0x01BC9715u, 0x7FFFFFFFu, 0xFDAB35BDu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFFu),
+        "i32x4.ge_s(v128_const(0xFFFFFFFFu, 0xE9777885u, 0x3D0C3B58u, 0x4DDABDFEu), v128_const(0x6708F207u, 0x01BC9715u, 0x7FFFFFFFu, 0xFDAB35BDu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.ge_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.ge_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4cmp0_i32x4X2Ege_u(&instance, v128_const(0x80000000u, 0xD1ECCCE4u, 0x14791272u, 0x00000002u), v128_const(0x415280F6u, 0x00000002u, 0x8D44977Bu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.ge_u(v128_const(0x80000000u, 0xD1ECCCE4u, 0x14791272u, 0x00000002u), v128_const(0x415280F6u, 0x00000002u, 0x8D44977Bu, 0x7FFFFFFFu))"
+    );
+}
@@ -0,0 +1,81 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_dot_i16x8.0.h"
+
+void test() {
+    simdi32x4doti16x80Instance instance;
+    simdi32x4doti16x80Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_dot_i16x8.0.wasm");
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.dot_i16x8_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.dot_i16x8_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.dot_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x0000FFFEu, 0x0000FFFEu, 0x0000FFFEu, 0x0000FFFEu),
+        "i32x4.dot_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00010000u, 0x00010000u, 0x00010000u, 0x00010000u),
+        "i32x4.dot_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x7FFE0002u, 0x7FFE0002u, 0x7FFE0002u, 0x7FFE0002u),
+        "i32x4.dot_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.dot_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x51F40BBDu, 0xFFFECF98u, 0x0001C000u, 0x0001E91Eu), v128_const(0x45418839u, 0x8001F971u, 0xD7607FFFu, 0x734CD906u)),
+        v128_const(0x10AD9809u, 0x013E7A16u, 0xE0001760u, 0x037C5800u),
+        "i32x4.dot_i16x8_s(v128_const(0x51F40BBDu, 0xFFFECF98u, 0x0001C000u, 0x0001E91Eu), v128_const(0x45418839u, 0x8001F971u, 0xD7607FFFu, 0x734CD906u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0xBD067FFFu, 0x00008B8Fu, 0x6C990AEFu, 0xB2F68001u), v128_const(0x81050001u, 0xA55B8C2Fu, 0xEC7960A8u, 0x0001ECDBu)),
+        v128_const(0x2139371Du, 0x34ADD341u, 0xFBD82D29u, 0x09921FD1u),
+        "i32x4.dot_i16x8_s(v128_const(0xBD067FFFu, 0x00008B8Fu, 0x6C990AEFu, 0xB2F68001u), v128_const(0x81050001u, 0xA55B8C2Fu, 0xEC7960A8u, 0x0001ECDBu))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0xBBE40E88u, 0x671DE545u, 0x7FFFA73Eu, 0xE36F78BFu), v128_const(0x9E77B840u, 0x1B2D635Cu, 0x16E8FFFFu, 0x8995563Du)),
+        v128_const(0x15E070FCu, 0x009242E5u, 0x0B7441DAu, 0x35E3B61Eu),
+        "i32x4.dot_i16x8_s(v128_const(0xBBE40E88u, 0x671DE545u, 0x7FFFA73Eu, 0xE36F78BFu), v128_const(0x9E77B840u, 0x1B2D635Cu, 0x16E8FFFFu, 0x8995563Du))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x7FFFB6FAu, 0x00018000u, 0x7FFF7003u, 0x7FFFB094u), v128_const(0xCD26A7CAu, 0xFFFE7FFEu, 0x9E890055u, 0xE367A6E8u)),
+        v128_const(0xFFBCAA1Eu, 0xC000FFFEu, 0xCF6A1276u, 0x0D579AB9u),
+        "i32x4.dot_i16x8_s(v128_const(0x7FFFB6FAu, 0x00018000u, 0x7FFF7003u, 0x7FFFB094u), v128_const(0xCD26A7CAu, 0xFFFE7FFEu, 0x9E890055u, 0xE367A6E8u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0xB366FFFFu, 0x334159B2u, 0x9AE4FFFEu, 0x00020001u), v128_const(0x78389629u, 0xF7BC8788u, 0x667B2849u, 0x20C70C87u)),
+        v128_const(0xDC077827u, 0xD422DF4Cu, 0xD785F2FAu, 0x00004E15u),
+        "i32x4.dot_i16x8_s(v128_const(0xB366FFFFu, 0x334159B2u, 0x9AE4FFFEu, 0x00020001u), v128_const(0x78389629u, 0xF7BC8788u, 0x667B2849u, 0x20C70C87u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0xC0005308u, 0x92321DD6u, 0x9AB5E6BBu, 0x42F2CB03u), v128_const(0x1561B0F8u, 0x00004029u, 0x1D07FFFEu, 0x5A910000u)),
+        v128_const(0xE105AFC0u, 0x077A4746u, 0xF483EE7Du, 0x17AEFF12u),
+        "i32x4.dot_i16x8_s(v128_const(0xC0005308u, 0x92321DD6u, 0x9AB5E6BBu, 0x42F2CB03u), v128_const(0x1561B0F8u, 0x00004029u, 0x1D07FFFEu, 0x5A910000u))"
+    );
+    assertEqualV128(
+        simdi32x4doti16x80_i32x4X2Edot_i16x8_s(&instance, v128_const(0x42B60000u, 0xC0004000u, 0xA8808001u, 0x772EDD7Cu), v128_const(0x65115E1Du, 0x80015668u, 0xC5AF15C0u, 0x7FFFFFFFu)),
+        v128_const(0x1A563C16u, 0x3599C000u, 0x090EC540u, 0x3B96AB56u),
+        "i32x4.dot_i16x8_s(v128_const(0x42B60000u, 0xC0004000u, 0xA8808001u, 0x772EDD7Cu), v128_const(0x65115E1Du, 0x80015668u, 0xC5AF15C0u, 0x7FFFFFFFu))"
+    );
+}
@@ -0,0 +1,111 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_extadd_pairwise_i16x8.0.h"
+
+void test() {
+    simdi32x4extaddpairwisei16x80Instance instance;
+    simdi32x4extaddpairwisei16x80Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_extadd_pairwise_i16x8.0.wasm");
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u)),
+        v128_const(0x00000004u, 0x00000004u, 0x00000004u, 0x00000004u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0xFFFECFADu, 0xF4F11741u, 0x2E1B5EC9u, 0x7FFE8000u)),
+        v128_const(0xFFFFCFABu, 0x00000C32u, 0x00008CE4u, 0xFFFFFFFEu),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0xFFFECFADu, 0xF4F11741u, 0x2E1B5EC9u, 0x7FFE8000u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0xFFFFE490u, 0xFE1B0002u, 0x00020001u, 0x00018000u)),
+        v128_const(0xFFFFE48Fu, 0xFFFFFE1Du, 0x00000003u, 0xFFFF8001u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0xFFFFE490u, 0xFE1B0002u, 0x00020001u, 0x00018000u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0xF5677FFFu, 0xFFFFFFFFu, 0xAA4CC000u, 0x80001EEDu)),
+        v128_const(0x00007566u, 0xFFFFFFFEu, 0xFFFF6A4Cu, 0xFFFF9EEDu),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0xF5677FFFu, 0xFFFFFFFFu, 0xAA4CC000u, 0x80001EEDu))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x80010E44u, 0x7B5FFFFFu, 0xE11B2ABFu, 0x9BBFC5C3u)),
+        v128_const(0xFFFF8E45u, 0x00007B5Eu, 0x00000BDAu, 0xFFFF6182u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x80010E44u, 0x7B5FFFFFu, 0xE11B2ABFu, 0x9BBFC5C3u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x40000002u, 0xBCF83515u, 0xBFC90055u, 0xF1E37FFFu)),
+        v128_const(0x00004002u, 0xFFFFF20Du, 0xFFFFC01Eu, 0x000071E2u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x40000002u, 0xBCF83515u, 0xBFC90055u, 0xF1E37FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_s(&instance, v128_const(0x2E1A7FFFu, 0x0001A922u, 0x8001EE14u, 0x00557FFEu)),
+        v128_const(0x0000AE19u, 0xFFFFA923u, 0xFFFF6E15u, 0x00008053u),
+        "i32x4.extadd_pairwise_i16x8_s(v128_const(0x2E1A7FFFu, 0x0001A922u, 0x8001EE14u, 0x00557FFEu))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000002u, 0x00000002u, 0x00000002u, 0x00000002u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x0001FFFEu, 0x0001FFFEu, 0x0001FFFEu, 0x0001FFFEu),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u)),
+        v128_const(0x00000004u, 0x00000004u, 0x00000004u, 0x00000004u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0x00020002u, 0x00020002u, 0x00020002u, 0x00020002u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0xEB601058u, 0xC52FCE37u, 0xFFFF2A5Du, 0xEDEF7F5Au)),
+        v128_const(0x0000FBB8u, 0x00019366u, 0x00012A5Cu, 0x00016D49u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0xEB601058u, 0xC52FCE37u, 0xFFFF2A5Du, 0xEDEF7F5Au))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0xFFFF0000u, 0xDA48BA73u, 0x505AEF49u, 0xC3B645A7u)),
+        v128_const(0x0000FFFFu, 0x000194BBu, 0x00013FA3u, 0x0001095Du),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0xFFFF0000u, 0xDA48BA73u, 0x505AEF49u, 0xC3B645A7u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0xF5BAFFFFu, 0x80000055u, 0x5ADBDC6Eu, 0x00020002u)),
+        v128_const(0x0001F5B9u, 0x00008055u, 0x00013749u, 0x00000004u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0xF5BAFFFFu, 0x80000055u, 0x5ADBDC6Eu, 0x00020002u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0x1BBD7FFFu, 0x49052B9Cu, 0x0001E6A5u, 0xFFFE0BD4u)),
+        v128_const(0x00009BBCu, 0x000074A1u, 0x0000E6A6u, 0x00010BD2u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0x1BBD7FFFu, 0x49052B9Cu, 0x0001E6A5u, 0xFFFE0BD4u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0xEB8F7FFEu, 0x25DDFFFFu, 0x4000FFFFu, 0x00028000u)),
+        v128_const(0x00016B8Du, 0x000125DCu, 0x00013FFFu, 0x00008002u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0xEB8F7FFEu, 0x25DDFFFFu, 0x4000FFFFu, 0x00028000u))"
+    );
+    assertEqualV128(
+        simdi32x4extaddpairwisei16x80_i32x4X2Eextadd_pairwise_i16x8_u(&instance, v128_const(0x0001B249u, 0x86CD6B68u, 0xFFFE0001u, 0x00557780u)),
+        v128_const(0x0000B24Au, 0x0000F235u, 0x0000FFFFu, 0x000077D5u),
+        "i32x4.extadd_pairwise_i16x8_u(v128_const(0x0001B249u, 0x86CD6B68u, 0xFFFE0001u, 0x00557780u))"
+    );
+}
@@ -0,0 +1,211 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_extmul_i16x8.0.h"
+
+void test() {
+    simdi32x4extmuli16x80Instance instance;
+    simdi32x4extmuli16x80Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_extmul_i16x8.0.wasm");
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.extmul_low_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00008000u, 0x00008000u, 0x00008000u, 0x00008000u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u)),
+        v128_const(0x33825BCAu, 0xF76CCDD1u, 0x1FFF8000u, 0xFFFFD093u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu)),
+        v128_const(0x10F4C000u, 0x00010000u, 0xFFFFC000u, 0x028E4098u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_s(&instance, v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu)),
+        v128_const(0x3FFE8002u, 0x10B45528u, 0xFFFFC1B4u, 0xE55820A5u),
+        "i32x4.extmul_low_i16x8_s(v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu),
+        "i32x4.extmul_low_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7FFF8000u, 0x7FFF8000u, 0x7FFF8000u, 0x7FFF8000u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u)),
+        v128_const(0x4D0B5BCAu, 0x3233CDD1u, 0x1FFF8000u, 0x2F6CD093u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu)),
+        v128_const(0x8D21C000u, 0x7FFF0000u, 0x3FFFC000u, 0x7F9C4098u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_low_i16x8_u(&instance, v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu)),
+        v128_const(0x3FFE8002u, 0x10B45528u, 0x3E4BC1B4u, 0x1C1120A5u),
+        "i32x4.extmul_low_i16x8_u(v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.extmul_high_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00008000u, 0x00008000u, 0x00008000u, 0x00008000u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u)),
+        v128_const(0x00000000u, 0x0DBA5ED4u, 0x05410000u, 0x3FFE8002u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu)),
+        v128_const(0x1B540000u, 0x22168000u, 0x02AC7292u, 0x23EBDCBEu),
+        "i32x4.extmul_high_i16x8_s(v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_s(&instance, v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu)),
+        v128_const(0xDB27F220u, 0xFFFFF546u, 0x1DDA3044u, 0xFFD58000u),
+        "i32x4.extmul_high_i16x8_s(v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu),
+        "i32x4.extmul_high_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u)),
+        v128_const(0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7FFF8000u, 0x7FFF8000u, 0x7FFF8000u, 0x7FFF8000u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu)),
+        v128_const(0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u, 0x3FFF0001u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu), v128_const(0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu, 0x7FFF7FFFu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u)),
+        v128_const(0x40000000u, 0x40000000u, 0x40000000u, 0x40000000u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u), v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u)),
+        v128_const(0x00000000u, 0x83AF5ED4u, 0xB03D0000u, 0x3FFE8002u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0xDAA7832Bu, 0xFFFF4000u, 0xDE54C000u, 0x7FFFEAFCu), v128_const(0x3AC7965Eu, 0x2F6D7FFEu, 0x97A10000u, 0x7FFEC000u))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu)),
+        v128_const(0x6E040000u, 0x5DE98000u, 0xAAB97292u, 0x63C4DCBEu),
+        "i32x4.extmul_high_i16x8_u(v128_const(0xFFFEBC2Du, 0xFACCFFFFu, 0x8000C000u, 0xA5D2B0AEu), v128_const(0x8000C000u, 0x82424000u, 0xBBD392B0u, 0x9A07F75Fu))"
+    );
+    assertEqualV128(
+        simdi32x4extmuli16x80_i32x4X2Eextmul_high_i16x8_u(&instance, v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu)),
+        v128_const(0x4581F220u, 0x055CF546u, 0x69253044u, 0x002A8000u),
+        "i32x4.extmul_high_i16x8_u(v128_const(0x676F7FFFu, 0x36B93E4Cu, 0x055DA750u, 0x8000BC7Cu), v128_const(0x29587FFEu, 0x834DFFFFu, 0xFFFE6A5Au, 0x00558ECFu))"
+    );
+}
@@ -0,0 +1,121 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_trunc_sat_f32x4.0.h"
+
+void test() {
+    simdi32x4truncsatf32x40Instance instance;
+    simdi32x4truncsatf32x40Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_trunc_sat_f32x4.0.wasm");
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0xFFFFFFFFu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0xFFFFFFFFu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x00000002u, 0xFFFFFFFEu, 0x00000003u, 0xFFFFFFFDu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x00000000u, 0xFFFE1DC0u, 0x7FFFFFFFu, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x80000000u, 0x7FFFFFFFu, 0x80000000u),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC342B158u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFF3Eu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0xC342B158u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x44771691u, 0x3FA49AD5u, 0x3D04AC3Du, 0x3D31FBF8u)),
+        v128_const(0x000003DCu, 0x00000001u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x44771691u, 0x3FA49AD5u, 0x3D04AC3Du, 0x3D31FBF8u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0xC3933219u, 0x4CF5A7F2u, 0x3C251039u, 0x4271342Cu)),
+        v128_const(0xFFFFFEDAu, 0x07AD3F90u, 0x00000000u, 0x0000003Cu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0xC3933219u, 0x4CF5A7F2u, 0x3C251039u, 0x4271342Cu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x4EFFFFFFu, 0x4F000000u, 0x4F7FFFFFu, 0x4F800000u)),
+        v128_const(0x7FFFFF80u, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x4EFFFFFFu, 0x4F000000u, 0x4F7FFFFFu, 0x4F800000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0xCF000000u, 0xCF000001u, 0xBF666666u, 0x3F666666u)),
+        v128_const(0x80000000u, 0x80000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0xCF000000u, 0xCF000001u, 0xBF666666u, 0x3F666666u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_s(&instance, v128_const(0x7FC00000u, 0xFFC00000u, 0xBFC00000u, 0x4E6E6B28u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x3B9ACA00u),
+        "i32x4.trunc_sat_f32x4_s(v128_const(0x7FC00000u, 0xFFC00000u, 0xBFC00000u, 0x4E6E6B28u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x00000000u, 0x80000000u, 0x3F800000u, 0xBF800000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x3F000000u, 0xBF000000u, 0x3FC00000u, 0xBFC00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000003u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x40200000u, 0xC0200000u, 0x40400000u, 0xC0600000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x3DCCCCCDu, 0xC7F12065u, 0x501502F9u, 0xAEDBE6FFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x7F800000u, 0xFF800000u, 0x7F7FFFFFu, 0xFF7FFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x429E32ABu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x0000004Fu),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x00800000u, 0x00000001u, 0x80000001u, 0x429E32ABu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0xFF7FFFFFu, 0xC3473AA7u, 0x461DDEFEu, 0x3E18740Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00002777u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0xFF7FFFFFu, 0xC3473AA7u, 0x461DDEFEu, 0x3E18740Fu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x334210CCu, 0xC0200000u, 0x40200000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x334210CCu, 0xC0200000u, 0x40200000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x4EFFFFFFu, 0x4F000000u, 0x4F7FFFFFu, 0x4F800000u)),
+        v128_const(0x7FFFFF80u, 0x80000000u, 0xFFFFFF00u, 0xFFFFFFFFu),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x4EFFFFFFu, 0x4F000000u, 0x4F7FFFFFu, 0x4F800000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0xCF000000u, 0xCF000001u, 0xBF666666u, 0x3F666666u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0xCF000000u, 0xCF000001u, 0xBF666666u, 0x3F666666u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf32x40_i32x4X2Etrunc_sat_f32x4_u(&instance, v128_const(0x7FC00000u, 0xFFC00000u, 0xBFC00000u, 0x4E6E6B28u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x3B9ACA00u),
+        "i32x4.trunc_sat_f32x4_u(v128_const(0x7FC00000u, 0xFFC00000u, 0xBFC00000u, 0x4E6E6B28u))"
+    );
+}
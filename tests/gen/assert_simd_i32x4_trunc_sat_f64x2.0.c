@@ -0,0 +1,171 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i32x4_trunc_sat_f64x2.0.h"
+
+void test() {
+    simdi32x4truncsatf64x20Instance instance;
+    simdi32x4truncsatf64x20Instantiate(&instance, resolveTestImports);
+    printStart("simd_i32x4_trunc_sat_f64x2.0.wasm");
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000001u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000001u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000002u, 0xFFFFFFFEu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000003u, 0xFFFFFFFDu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0xFFFE1DC0u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0x7FFFFFFFu, 0x80000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0x7FFFFFFFu, 0x80000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000001u, 0x80000000u, 0x986BA7F6u, 0x412465EBu)),
+        v128_const(0x00000000u, 0x000A32F5u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000001u, 0x80000000u, 0x986BA7F6u, 0x412465EBu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0xFFF9999Au, 0x41DFFFFFu, 0x00000000u, 0x41E00000u)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0xFFF9999Au, 0x41DFFFFFu, 0x00000000u, 0x41E00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0xFFF00000u, 0x41EFFFFFu, 0x00000000u, 0x41F00000u)),
+        v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0xFFF00000u, 0x41EFFFFFu, 0x00000000u, 0x41F00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x001CCCCDu, 0xC1E00000u, 0x00200000u, 0xC1E00000u)),
+        v128_const(0x80000000u, 0x80000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x001CCCCDu, 0xC1E00000u, 0x00200000u, 0xC1E00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_s_zero(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_s_zero(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0xBFF00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xBFE00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0xBFF80000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC0040000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u)),
+        v128_const(0x00000003u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x9999999Au, 0x3FB99999u, 0x9FBE76C9u, 0xC0FE240Cu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x20000000u, 0x4202A05Fu, 0xD9D7BDBBu, 0xBDDB7CDFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x00100000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000001u, 0x80000000u, 0x62B23618u, 0xC1741750u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000001u, 0x80000000u, 0x62B23618u, 0xC1741750u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0xFFF9999Au, 0x41DFFFFFu, 0x00000000u, 0x41E00000u)),
+        v128_const(0x7FFFFFFFu, 0x80000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0xFFF9999Au, 0x41DFFFFFu, 0x00000000u, 0x41E00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0xFFF00000u, 0x41EFFFFFu, 0x00000000u, 0x41F00000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0xFFF00000u, 0x41EFFFFFu, 0x00000000u, 0x41F00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x001CCCCDu, 0xC1E00000u, 0x00200000u, 0xC1E00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x001CCCCDu, 0xC1E00000u, 0x00200000u, 0xC1E00000u))"
+    );
+    assertEqualV128(
+        simdi32x4truncsatf64x20_i32x4X2Etrunc_sat_f64x2_u_zero(&instance, v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0xBFE00000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.trunc_sat_f64x2_u_zero(v128_const(0x00000000u, 0x7FF80000u, 0x00000000u, 0xBFE00000u))"
+    );
+}
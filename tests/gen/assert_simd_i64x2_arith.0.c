@@ -0,0 +1,201 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i64x2_arith.0.h"
+
+void test() {
+    simdi64x2arith0Instance instance;
+    simdi64x2arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i64x2_arith.0.wasm");
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.add(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.add(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.add(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu),
+        "i64x2.add(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu),
+        "i64x2.add(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.add(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x381C5C7Au, 0x3ECFC1B6u), v128_const(0x00000000u, 0x40000000u, 0x0B423A78u, 0x475C0117u)),
+        v128_const(0xFFFFFFFFu, 0x3FFFFFFFu, 0x435E96F2u, 0x862BC2CDu),
+        "i64x2.add(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x381C5C7Au, 0x3ECFC1B6u), v128_const(0x00000000u, 0x40000000u, 0x0B423A78u, 0x475C0117u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0x00000055u, 0x00000000u, 0x00000055u, 0x00000000u), v128_const(0xBE0FFE3Au, 0x4E4893A8u, 0x7A4D4CBCu, 0x528856C9u)),
+        v128_const(0xBE0FFE8Fu, 0x4E4893A8u, 0x7A4D4D11u, 0x528856C9u),
+        "i64x2.add(v128_const(0x00000055u, 0x00000000u, 0x00000055u, 0x00000000u), v128_const(0xBE0FFE3Au, 0x4E4893A8u, 0x7A4D4CBCu, 0x528856C9u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eadd(&instance, v128_const(0xC128972Eu, 0x195A8274u, 0x78DEDB61u, 0x9B3B54D4u), v128_const(0xE7F69E8Bu, 0x39D6B1E2u, 0x280BB93Du, 0x21C250D7u)),
+        v128_const(0xA91F35B9u, 0x53313457u, 0xA0EA949Eu, 0xBCFDA5ABu),
+        "i64x2.add(v128_const(0xC128972Eu, 0x195A8274u, 0x78DEDB61u, 0x9B3B54D4u), v128_const(0xE7F69E8Bu, 0x39D6B1E2u, 0x280BB93Du, 0x21C250D7u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.sub(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu),
+        "i64x2.sub(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFEu, 0x7FFFFFFFu, 0xFFFFFFFEu, 0x7FFFFFFFu),
+        "i64x2.sub(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000001u, 0x80000000u, 0x00000001u, 0x80000000u),
+        "i64x2.sub(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.sub(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.sub(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x293AAEADu, 0x36E4914Fu, 0x35DC38BFu, 0x4E6FB083u), v128_const(0x21F0FBE5u, 0x273A8918u, 0xFDB99B93u, 0x29F3727Au)),
+        v128_const(0x0749B2C8u, 0x0FAA0837u, 0x38229D2Cu, 0x247C3E08u),
+        "i64x2.sub(v128_const(0x293AAEADu, 0x36E4914Fu, 0x35DC38BFu, 0x4E6FB083u), v128_const(0x21F0FBE5u, 0x273A8918u, 0xFDB99B93u, 0x29F3727Au))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x215A179Du, 0xF730F7E4u, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000002u, 0x00000000u)),
+        v128_const(0x215A179Cu, 0xF730F7E4u, 0xFFFFFFFDu, 0xFFFFFFFFu),
+        "i64x2.sub(v128_const(0x215A179Du, 0xF730F7E4u, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000002u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Esub(&instance, v128_const(0x1218EB8Fu, 0x9C0319E4u, 0xDE066FEDu, 0xC6407E59u), v128_const(0x5FE9029Eu, 0x1AF12B15u, 0x0C9DEAF2u, 0x7017C8F9u)),
+        v128_const(0xB22FE8F1u, 0x8111EECEu, 0xD16884FBu, 0x5628B560u),
+        "i64x2.sub(v128_const(0x1218EB8Fu, 0x9C0319E4u, 0xDE066FEDu, 0xC6407E59u), v128_const(0x5FE9029Eu, 0x1AF12B15u, 0x0C9DEAF2u, 0x7017C8F9u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.mul(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.mul(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.mul(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu),
+        "i64x2.mul(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "i64x2.mul(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.mul(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.mul(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0x7DEA0356u, 0x92058770u), v128_const(0x00000000u, 0x40000000u, 0x3D91527Cu, 0x982BB7C1u)),
+        v128_const(0x00000000u, 0x80000000u, 0x542129A8u, 0xDA08B4FFu),
+        "i64x2.mul(v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0x7DEA0356u, 0x92058770u), v128_const(0x00000000u, 0x40000000u, 0x3D91527Cu, 0x982BB7C1u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0x9689236Eu, 0xBF2636FDu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x8FBA8AB4u, 0x9088F7CBu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xF5723558u, 0xFE37921Bu, 0x00000001u, 0x80000000u),
+        "i64x2.mul(v128_const(0x9689236Eu, 0xBF2636FDu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x8FBA8AB4u, 0x9088F7CBu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Emul(&instance, v128_const(0xB336BAA1u, 0xEB3EE2CEu, 0x340B3F7Du, 0x558274D4u), v128_const(0x9181F540u, 0x0637A2F3u, 0xFFFFFFFEu, 0xFFFFFFFFu)),
+        v128_const(0x6A6BBD40u, 0xFA16DC4Cu, 0x97E98106u, 0x54FB1657u),
+        "i64x2.mul(v128_const(0xB336BAA1u, 0xEB3EE2CEu, 0x340B3F7Du, 0x558274D4u), v128_const(0x9181F540u, 0x0637A2F3u, 0xFFFFFFFEu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.neg(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.neg(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.neg(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu),
+        "i64x2.neg(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0x6ECAE758u, 0x189B8389u)),
+        v128_const(0x00000002u, 0x00000000u, 0x913518A8u, 0xE7647C76u),
+        "i64x2.neg(v128_const(0xFFFFFFFEu, 0xFFFFFFFFu, 0x6ECAE758u, 0x189B8389u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x00000000u, 0x80000000u, 0x2CD7EFF8u, 0xE12B7E79u)),
+        v128_const(0x00000000u, 0x80000000u, 0xD3281008u, 0x1ED48186u),
+        "i64x2.neg(v128_const(0x00000000u, 0x80000000u, 0x2CD7EFF8u, 0xE12B7E79u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x13127169u, 0x5334962Au, 0x866C00DCu, 0x6B127193u)),
+        v128_const(0xECED8E97u, 0xACCB69D5u, 0x7993FF24u, 0x94ED8E6Cu),
+        "i64x2.neg(v128_const(0x13127169u, 0x5334962Au, 0x866C00DCu, 0x6B127193u))"
+    );
+    assertEqualV128(
+        simdi64x2arith0_i64x2X2Eneg(&instance, v128_const(0x68EE77D9u, 0xFBC9DF2Au, 0x00000000u, 0x40000000u)),
+        v128_const(0x97118827u, 0x043620D5u, 0x00000000u, 0xC0000000u),
+        "i64x2.neg(v128_const(0x68EE77D9u, 0xFBC9DF2Au, 0x00000000u, 0x40000000u))"
+    );
+}
@@ -0,0 +1,51 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i64x2_arith2.0.h"
+
+void test() {
+    simdi64x2arith20Instance instance;
+    simdi64x2arith20Instantiate(&instance, resolveTestImports);
+    printStart("simd_i64x2_arith2.0.wasm");
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.abs(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.abs(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.abs(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u),
+        "i64x2.abs(v128_const(0x00000002u, 0x00000000u, 0x00000002u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.abs(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x3525F0C3u, 0xAE88133Au, 0x00000002u, 0x00000000u)),
+        v128_const(0xCADA0F3Du, 0x5177ECC5u, 0x00000002u, 0x00000000u),
+        "i64x2.abs(v128_const(0x3525F0C3u, 0xAE88133Au, 0x00000002u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x1B029F46u, 0x99CE4860u, 0x675E6D3Cu, 0x1EA976B4u)),
+        v128_const(0xE4FD60BAu, 0x6631B79Fu, 0x675E6D3Cu, 0x1EA976B4u),
+        "i64x2.abs(v128_const(0x1B029F46u, 0x99CE4860u, 0x675E6D3Cu, 0x1EA976B4u))"
+    );
+    assertEqualV128(
+        simdi64x2arith20_i64x2X2Eabs(&instance, v128_const(0x00000001u, 0x80000000u, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu),
+        "i64x2.abs(v128_const(0x00000001u, 0x80000000u, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+}
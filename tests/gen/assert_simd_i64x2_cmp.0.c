@@ -0,0 +1,251 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i64x2_cmp.0.h"
+
+void test() {
+    simdi64x2cmp0Instance instance;
+    simdi64x2cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i64x2_cmp.0.wasm");
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.eq(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.eq(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.eq(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.eq(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.eq(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.eq(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Eeq(&instance, v128_const(0xBAA07179u, 0xC44D7CB5u, 0xFFFFFFFEu, 0x7FFFFFFFu), v128_const(0xA23CE011u, 0x4F652E83u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.eq(v128_const(0xBAA07179u, 0xC44D7CB5u, 0xFFFFFFFEu, 0x7FFFFFFFu), v128_const(0xA23CE011u, 0x4F652E83u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ne(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ne(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ne(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ne(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ne(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ne(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ene(&instance, v128_const(0xF10A57F9u, 0x5A786978u, 0x00000001u, 0x80000000u), v128_const(0x00000002u, 0x00000000u, 0xFFFFFFFEu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ne(v128_const(0xF10A57F9u, 0x5A786978u, 0x00000001u, 0x80000000u), v128_const(0x00000002u, 0x00000000u, 0xFFFFFFFEu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.lt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.lt_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.lt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.lt_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.lt_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.lt_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.lt_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Elt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x66DB9B36u, 0xA5BB50B5u), v128_const(0x00000000u, 0x80000000u, 0x045C68F4u, 0xD4FD8F18u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.lt_s(v128_const(0x00000000u, 0x00000000u, 0x66DB9B36u, 0xA5BB50B5u), v128_const(0x00000000u, 0x80000000u, 0x045C68F4u, 0xD4FD8F18u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.gt_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.gt_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Egt_s(&instance, v128_const(0x59B3C836u, 0x0FE87E95u, 0x4396723Fu, 0x522F7AF8u), v128_const(0xFFFFFFFEu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.gt_s(v128_const(0x59B3C836u, 0x0FE87E95u, 0x4396723Fu, 0x522F7AF8u), v128_const(0xFFFFFFFEu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.le_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ele_s(&instance, v128_const(0x7252C36Bu, 0x4087BCBEu, 0x10ABE507u, 0x910CFF71u), v128_const(0x00000001u, 0x00000000u, 0x00000002u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.le_s(v128_const(0x7252C36Bu, 0x4087BCBEu, 0x10ABE507u, 0x910CFF71u), v128_const(0x00000001u, 0x00000000u, 0x00000002u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ge_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.ge_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu), v128_const(0xFFFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u), v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2cmp0_i64x2X2Ege_s(&instance, v128_const(0x5A4B8810u, 0x7D03E6A6u, 0xACED4231u, 0x6DC079E6u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x1DFBDEE7u, 0xEC51E5D9u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.ge_s(v128_const(0x5A4B8810u, 0x7D03E6A6u, 0xACED4231u, 0x6DC079E6u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x1DFBDEE7u, 0xEC51E5D9u))"
+    );
+}
@@ -0,0 +1,211 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i64x2_extmul_i32x4.0.h"
+
+void test() {
+    simdi64x2extmuli32x40Instance instance;
+    simdi64x2extmuli32x40Instantiate(&instance, resolveTestImports);
+    printStart("simd_i64x2_extmul_i32x4.0.wasm");
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.extmul_low_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x7FFFFFFFu, 0x00000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x00000000u, 0x80000000u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x3FFFFFFFu, 0x00000001u, 0x3FFFFFFFu),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u)),
+        v128_const(0x2896B958u, 0x1F2C3187u, 0xB28F14B0u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u)),
+        v128_const(0xFFFFFFFEu, 0x00000000u, 0x3F7B468Cu, 0x30212E5Cu),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_s(&instance, v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u)),
+        v128_const(0xF4319726u, 0x05E7346Cu, 0xC2D91E80u, 0x2174B711u),
+        "i64x2.extmul_low_i32x4_s(v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x7FFFFFFFu, 0x00000000u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x7FFFFFFFu, 0x80000000u, 0x7FFFFFFFu),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x3FFFFFFFu, 0x00000001u, 0x3FFFFFFFu),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u)),
+        v128_const(0x2896B958u, 0x1F2C3187u, 0xB28F14B0u, 0xA6B875A6u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u)),
+        v128_const(0xFFFFFFFEu, 0x00000000u, 0x3F7B468Cu, 0x30212E5Cu),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_low_i32x4_u(&instance, v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u)),
+        v128_const(0xF4319726u, 0x05E7346Cu, 0xC2D91E80u, 0x2174B711u),
+        "i64x2.extmul_low_i32x4_u(v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.extmul_high_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x7FFFFFFFu, 0x00000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x00000000u, 0x80000000u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x3FFFFFFFu, 0x00000001u, 0x3FFFFFFFu),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u)),
+        v128_const(0x80000002u, 0xFFFFFFFFu, 0x8FCB3D86u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u)),
+        v128_const(0x27A16526u, 0xEC2F4D6Du, 0x8371B0EFu, 0x2394ED5Au),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_s(&instance, v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u)),
+        v128_const(0x102A0537u, 0xF2D8689Fu, 0x8F42F9A1u, 0x07521F9Du),
+        "i64x2.extmul_high_i32x4_s(v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u)),
+        v128_const(0x7FFFFFFFu, 0x00000000u, 0x7FFFFFFFu, 0x00000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80000000u, 0x7FFFFFFFu, 0x80000000u, 0x7FFFFFFFu),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu)),
+        v128_const(0x00000001u, 0x3FFFFFFFu, 0x00000001u, 0x3FFFFFFFu),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu), v128_const(0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu, 0x7FFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u)),
+        v128_const(0x00000000u, 0x40000000u, 0x00000000u, 0x40000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u), v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u)),
+        v128_const(0x80000002u, 0x7FFFFFFDu, 0x8FCB3D86u, 0x00000000u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x62886751u, 0xFFFFFFFEu, 0x7FFFFFFEu, 0x00000002u), v128_const(0x50FD7DD8u, 0xA6B875A8u, 0xFFFFFFFFu, 0x47E59EC3u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u)),
+        v128_const(0x27A16526u, 0x13D0B293u, 0x8371B0EFu, 0x5E8F5DE2u),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x00000002u, 0x60425CBAu, 0x80000001u, 0x85164855u), v128_const(0x7FFFFFFFu, 0x7FFFFFFEu, 0x27A16526u, 0xB5E42833u))"
+    );
+    assertEqualV128(
+        simdi64x2extmuli32x40_i64x2X2Eextmul_high_i32x4_u(&instance, v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u)),
+        v128_const(0x102A0537u, 0x449EC892u, 0x8F42F9A1u, 0x97EDC7ABu),
+        "i64x2.extmul_high_i32x4_u(v128_const(0x0BCE68DAu, 0x5C9514BAu, 0x51C65FF3u, 0xA54328BBu), v128_const(0x7FFFFFFFu, 0x5C825840u, 0xD6D19AADu, 0xEB587F53u))"
+    );
+}
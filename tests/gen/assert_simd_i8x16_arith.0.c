@@ -0,0 +1,151 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i8x16_arith.0.h"
+
+void test() {
+    simdi8x16arith0Instance instance;
+    simdi8x16arith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i8x16_arith.0.wasm");
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.add(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.add(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.add(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.add(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x0F557678u, 0xE0FE807Eu, 0xFF9CC07Fu, 0xF500D955u), v128_const(0xDC8081C4u, 0x5D960202u, 0x5E51FF81u, 0x66F9FF08u)),
+        v128_const(0xEBD5F73Cu, 0x3D948280u, 0x5DEDBF00u, 0x5BF9D85Du),
+        "i8x16.add(v128_const(0x0F557678u, 0xE0FE807Eu, 0xFF9CC07Fu, 0xF500D955u), v128_const(0xDC8081C4u, 0x5D960202u, 0x5E51FF81u, 0x66F9FF08u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x24558055u, 0x5C0F0136u, 0x877FB83Bu, 0x00FE4059u), v128_const(0x83018E2Du, 0x8528707Bu, 0x3C408136u, 0xF47E2FD6u)),
+        v128_const(0xA7560E82u, 0xE13771B1u, 0xC3BF3971u, 0xF47C6F2Fu),
+        "i8x16.add(v128_const(0x24558055u, 0x5C0F0136u, 0x877FB83Bu, 0x00FE4059u), v128_const(0x83018E2Du, 0x8528707Bu, 0x3C408136u, 0xF47E2FD6u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eadd(&instance, v128_const(0x557F7E00u, 0x7F2DA234u, 0x706CFFA5u, 0xF001020Eu), v128_const(0x192428B4u, 0xF796FE81u, 0xFFFCBC5Eu, 0x409A5155u)),
+        v128_const(0x6EA3A6B4u, 0x76C3A0B5u, 0x6F68BB03u, 0x309B5363u),
+        "i8x16.add(v128_const(0x557F7E00u, 0x7F2DA234u, 0x706CFFA5u, 0xF001020Eu), v128_const(0x192428B4u, 0xF796FE81u, 0xFFFCBC5Eu, 0x409A5155u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.sub(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu),
+        "i8x16.sub(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x81818181u, 0x81818181u, 0x81818181u, 0x81818181u),
+        "i8x16.sub(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0xFF02297Eu, 0x2C7F0000u, 0x7F017EFAu, 0xCA2965E0u), v128_const(0x4E980055u, 0xD6C5228Eu, 0xACA97601u, 0x40E881E9u)),
+        v128_const(0xB16A2929u, 0x56BADE72u, 0xD35808F9u, 0x8A41E4F7u),
+        "i8x16.sub(v128_const(0xFF02297Eu, 0x2C7F0000u, 0x7F017EFAu, 0xCA2965E0u), v128_const(0x4E980055u, 0xD6C5228Eu, 0xACA97601u, 0x40E881E9u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x806CB2FFu, 0x8000ECAAu, 0x3EFE28F0u, 0x7F4002FEu), v128_const(0x81FF80CEu, 0x8109FE81u, 0x75C00001u, 0x808002EDu)),
+        v128_const(0xFF6D3231u, 0xFFF7EE29u, 0xC93E28EFu, 0xFFC00011u),
+        "i8x16.sub(v128_const(0x806CB2FFu, 0x8000ECAAu, 0x3EFE28F0u, 0x7F4002FEu), v128_const(0x81FF80CEu, 0x8109FE81u, 0x75C00001u, 0x808002EDu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Esub(&instance, v128_const(0x017FC0DDu, 0x1D997E06u, 0x0F88A89Bu, 0x815A7340u), v128_const(0xE62B31F2u, 0x2CC076ACu, 0xB0F42F07u, 0x800D7E29u)),
+        v128_const(0x1B548FEBu, 0xF1D9085Au, 0x5F947994u, 0x014DF517u),
+        "i8x16.sub(v128_const(0x017FC0DDu, 0x1D997E06u, 0x0F88A89Bu, 0x815A7340u), v128_const(0xE62B31F2u, 0x2CC076ACu, 0xB0F42F07u, 0x800D7E29u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.neg(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.neg(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.neg(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.neg(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x405B7F20u, 0x716555C0u, 0x02B38001u, 0x02FFFE55u)),
+        v128_const(0xC0A581E0u, 0x8F9BAB40u, 0xFE4D80FFu, 0xFE0102ABu),
+        "i8x16.neg(v128_const(0x405B7F20u, 0x716555C0u, 0x02B38001u, 0x02FFFE55u))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0xE31D5500u, 0xC6BD6300u, 0x55FE7F40u, 0x9855BAFFu)),
+        v128_const(0x1DE3AB00u, 0x3A439D00u, 0xAB0281C0u, 0x68AB4601u),
+        "i8x16.neg(v128_const(0xE31D5500u, 0xC6BD6300u, 0x55FE7F40u, 0x9855BAFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x01FE5566u, 0x79554581u, 0x56C0BA55u, 0x5586C67Fu)),
+        v128_const(0xFF02AB9Au, 0x87ABBB7Fu, 0xAA4046ABu, 0xAB7A3A81u),
+        "i8x16.neg(v128_const(0x01FE5566u, 0x79554581u, 0x56C0BA55u, 0x5586C67Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith0_i8x16X2Eneg(&instance, v128_const(0x7FFECD01u, 0xD718FE01u, 0xF90114A1u, 0x406E8040u)),
+        v128_const(0x810233FFu, 0x29E802FFu, 0x07FFEC5Fu, 0xC09280C0u),
+        "i8x16.neg(v128_const(0x7FFECD01u, 0xD718FE01u, 0xF90114A1u, 0x406E8040u))"
+    );
+}
@@ -0,0 +1,341 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i8x16_arith2.0.h"
+
+void test() {
+    simdi8x16arith20Instance instance;
+    simdi8x16arith20Instantiate(&instance, resolveTestImports);
+    printStart("simd_i8x16_arith2.0.wasm");
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.abs(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.abs(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.abs(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u)),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.abs(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x491ACCC0u, 0x00E47FBEu, 0x80F1A0FCu, 0xE8108201u)),
+        v128_const(0x491A3440u, 0x001C7F42u, 0x800F6004u, 0x18107E01u),
+        "i8x16.abs(v128_const(0x491ACCC0u, 0x00E47FBEu, 0x80F1A0FCu, 0xE8108201u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0xDF80BAFEu, 0xEF1D65BFu, 0x7E00C07Fu, 0x3C7F5502u)),
+        v128_const(0x21804602u, 0x111D6541u, 0x7E00407Fu, 0x3C7F5502u),
+        "i8x16.abs(v128_const(0xDF80BAFEu, 0xEF1D65BFu, 0x7E00C07Fu, 0x3C7F5502u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x808FBB61u, 0x8140C0E8u, 0xC07F177Eu, 0x7E9C070Cu)),
+        v128_const(0x80714561u, 0x7F404018u, 0x407F177Eu, 0x7E64070Cu),
+        "i8x16.abs(v128_const(0x808FBB61u, 0x8140C0E8u, 0xC07F177Eu, 0x7E9C070Cu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eabs(&instance, v128_const(0x0280097Fu, 0x517E0B23u, 0x5AEA80FEu, 0xB3819D6Du)),
+        v128_const(0x0280097Fu, 0x517E0B23u, 0x5A168002u, 0x4D7F636Du),
+        "i8x16.abs(v128_const(0x0280097Fu, 0x517E0B23u, 0x5AEA80FEu, 0xB3819D6Du))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.min_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.min_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.min_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.min_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.min_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.min_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.min_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x7ED18055u, 0x7EE57F81u, 0xB18E812Eu, 0x163132B5u), v128_const(0x008802E5u, 0x4C0E007Fu, 0x3900C337u, 0xF081BBCBu)),
+        v128_const(0x008880E5u, 0x4CE50081u, 0xB18E812Eu, 0xF081BBB5u),
+        "i8x16.min_s(v128_const(0x7ED18055u, 0x7EE57F81u, 0xB18E812Eu, 0x163132B5u), v128_const(0x008802E5u, 0x4C0E007Fu, 0x3900C337u, 0xF081BBCBu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0x8E049380u, 0xC081F6E7u, 0x818062F9u, 0xE981FA31u), v128_const(0x00588001u, 0x015581FFu, 0x9940B313u, 0x27C08000u)),
+        v128_const(0x8E048080u, 0xC08181E7u, 0x8180B3F9u, 0xE9818000u),
+        "i8x16.min_s(v128_const(0x8E049380u, 0xC081F6E7u, 0x818062F9u, 0xE981FA31u), v128_const(0x00588001u, 0x015581FFu, 0x9940B313u, 0x27C08000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_s(&instance, v128_const(0xB21002FFu, 0x55407AFFu, 0xBB95407Fu, 0x818D09CAu), v128_const(0x251367D1u, 0xE2CD2D7Eu, 0x7F00252Cu, 0x804EBC7Eu)),
+        v128_const(0xB21002D1u, 0xE2CD2DFFu, 0xBB95252Cu, 0x808DBCCAu),
+        "i8x16.min_s(v128_const(0xB21002FFu, 0x55407AFFu, 0xBB95407Fu, 0x818D09CAu), v128_const(0x251367D1u, 0xE2CD2D7Eu, 0x7F00252Cu, 0x804EBC7Eu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.min_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.min_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.min_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.min_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.min_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.min_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.min_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x006E7F40u, 0x80067E24u, 0xFE3AFFD1u, 0x3C810051u), v128_const(0x55FCBF7Fu, 0x574302B7u, 0x1D844346u, 0x5AC85E74u)),
+        v128_const(0x006E7F40u, 0x57060224u, 0x1D3A4346u, 0x3C810051u),
+        "i8x16.min_u(v128_const(0x006E7F40u, 0x80067E24u, 0xFE3AFFD1u, 0x3C810051u), v128_const(0x55FCBF7Fu, 0x574302B7u, 0x1D844346u, 0x5AC85E74u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0x7EEC4000u, 0x40E23855u, 0x5E75AFE0u, 0x8080D0D3u), v128_const(0x5A8134FCu, 0x864ED740u, 0xABFFF2EEu, 0x05000180u)),
+        v128_const(0x5A813400u, 0x404E3840u, 0x5E75AFE0u, 0x05000180u),
+        "i8x16.min_u(v128_const(0x7EEC4000u, 0x40E23855u, 0x5E75AFE0u, 0x8080D0D3u), v128_const(0x5A8134FCu, 0x864ED740u, 0xABFFF2EEu, 0x05000180u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emin_u(&instance, v128_const(0xFD013E5Cu, 0x10439DFFu, 0xD860C000u, 0x0DA0A1C0u), v128_const(0xFE55FF65u, 0xFE8BA08Du, 0x8CD3CAFEu, 0xFEEE81AEu)),
+        v128_const(0xFD013E5Cu, 0x10439D8Du, 0x8C60C000u, 0x0DA081AEu),
+        "i8x16.min_u(v128_const(0xFD013E5Cu, 0x10439DFFu, 0xD860C000u, 0x0DA0A1C0u), v128_const(0xFE55FF65u, 0xFE8BA08Du, 0x8CD3CAFEu, 0xFEEE81AEu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.max_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.max_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.max_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.max_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.max_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.max_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.max_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x00FEC3B0u, 0x33718159u, 0x94EFBFB6u, 0xEB55B781u), v128_const(0x4AA1DBC0u, 0x59C8555Au, 0x408055E9u, 0x314DD97Fu)),
+        v128_const(0x4AFEDBC0u, 0x5971555Au, 0x40EF55E9u, 0x3155D97Fu),
+        "i8x16.max_s(v128_const(0x00FEC3B0u, 0x33718159u, 0x94EFBFB6u, 0xEB55B781u), v128_const(0x4AA1DBC0u, 0x59C8555Au, 0x408055E9u, 0x314DD97Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0xAD3D7EFEu, 0x7E115895u, 0x019540FFu, 0x407F0002u), v128_const(0xFFA04001u, 0x7F97A9B4u, 0xFD7BB440u, 0x800255FEu)),
+        v128_const(0xFF3D7E01u, 0x7F1158B4u, 0x017B4040u, 0x407F5502u),
+        "i8x16.max_s(v128_const(0xAD3D7EFEu, 0x7E115895u, 0x019540FFu, 0x407F0002u), v128_const(0xFFA04001u, 0x7F97A9B4u, 0xFD7BB440u, 0x800255FEu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_s(&instance, v128_const(0x17C5C080u, 0x017FC17Fu, 0x1313CD40u, 0xBBBFC094u), v128_const(0x0023CF36u, 0xC27EFE7Fu, 0x7F7F558Fu, 0xB9FF02E6u)),
+        v128_const(0x1723CF36u, 0x017FFE7Fu, 0x7F7F5540u, 0xBBFF02E6u),
+        "i8x16.max_s(v128_const(0x17C5C080u, 0x017FC17Fu, 0x1313CD40u, 0xBBBFC094u), v128_const(0x0023CF36u, 0xC27EFE7Fu, 0x7F7F558Fu, 0xB9FF02E6u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.max_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.max_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.max_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.max_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.max_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.max_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.max_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x028144FFu, 0x1E330275u, 0xA99B97CEu, 0xF5FF7F2Au), v128_const(0x027F80B7u, 0x9282DABCu, 0xFE9D2F00u, 0xC07F01F4u)),
+        v128_const(0x028180FFu, 0x9282DABCu, 0xFE9D97CEu, 0xF5FF7FF4u),
+        "i8x16.max_u(v128_const(0x028144FFu, 0x1E330275u, 0xA99B97CEu, 0xF5FF7F2Au), v128_const(0x027F80B7u, 0x9282DABCu, 0xFE9D2F00u, 0xC07F01F4u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x15267FBFu, 0x0081F87Fu, 0x45442D02u, 0xFE7C7FC0u), v128_const(0xE0D0C5C0u, 0x80195206u, 0x2EE8F961u, 0xFF2D1FC0u)),
+        v128_const(0xE0D0C5C0u, 0x8081F87Fu, 0x45E8F961u, 0xFF7C7FC0u),
+        "i8x16.max_u(v128_const(0x15267FBFu, 0x0081F87Fu, 0x45442D02u, 0xFE7C7FC0u), v128_const(0xE0D0C5C0u, 0x80195206u, 0x2EE8F961u, 0xFF2D1FC0u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Emax_u(&instance, v128_const(0x6BF6DDC0u, 0x559CC5FFu, 0xF296FE02u, 0x1FBC9281u), v128_const(0xE6EA5545u, 0x097D92CAu, 0xAAD7D371u, 0xC0C07780u)),
+        v128_const(0xE6F6DDC0u, 0x559CC5FFu, 0xF2D7FE71u, 0xC0C09281u),
+        "i8x16.max_u(v128_const(0x6BF6DDC0u, 0x559CC5FFu, 0xF296FE02u, 0x1FBC9281u), v128_const(0xE6EA5545u, 0x097D92CAu, 0xAAD7D371u, 0xC0C07780u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.avgr_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.avgr_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.avgr_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x40404040u, 0x40404040u, 0x40404040u, 0x40404040u),
+        "i8x16.avgr_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xC0C0C0C0u, 0xC0C0C0C0u, 0xC0C0C0C0u, 0xC0C0C0C0u),
+        "i8x16.avgr_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.avgr_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.avgr_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0xBCFDFE02u, 0x7FFFA528u, 0xD6D4D3F8u, 0x40FE804Au), v128_const(0x299AFF10u, 0x66005BE8u, 0xEE7EC09Fu, 0x1B9F817Fu)),
+        v128_const(0x73CCFF09u, 0x73808088u, 0xE2A9CACCu, 0x2ECF8165u),
+        "i8x16.avgr_u(v128_const(0xBCFDFE02u, 0x7FFFA528u, 0xD6D4D3F8u, 0x40FE804Au), v128_const(0x299AFF10u, 0x66005BE8u, 0xEE7EC09Fu, 0x1B9F817Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x2D7F4059u, 0x612B5FCDu, 0x7F15FEEDu, 0xFE822F1Du), v128_const(0x319BE929u, 0x7F040167u, 0xBE86C0CCu, 0xFE7EBF7Fu)),
+        v128_const(0x2F8D9541u, 0x7018309Au, 0x9F4EDFDDu, 0xFE80774Eu),
+        "i8x16.avgr_u(v128_const(0x2D7F4059u, 0x612B5FCDu, 0x7F15FEEDu, 0xFE822F1Du), v128_const(0x319BE929u, 0x7F040167u, 0xBE86C0CCu, 0xFE7EBF7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Eavgr_u(&instance, v128_const(0x67A180A1u, 0x023B573Au, 0xCDF600C7u, 0x2BD3E770u), v128_const(0xC0B20F40u, 0x81FE8EBBu, 0xE378FE9Fu, 0xC002FF55u)),
+        v128_const(0x94AA4871u, 0x429D737Bu, 0xD8B77FB3u, 0x766BF363u),
+        "i8x16.avgr_u(v128_const(0x67A180A1u, 0x023B573Au, 0xCDF600C7u, 0x2BD3E770u), v128_const(0xC0B20F40u, 0x81FE8EBBu, 0xE378FE9Fu, 0xC002FF55u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.popcnt(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.popcnt(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x08080808u, 0x08080808u, 0x08080808u, 0x08080808u),
+        "i8x16.popcnt(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u)),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.popcnt(v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0x0300EF81u, 0x16BF8159u, 0x02FE9CD6u, 0xC02280FAu)),
+        v128_const(0x02000702u, 0x03070204u, 0x01070405u, 0x02020106u),
+        "i8x16.popcnt(v128_const(0x0300EF81u, 0x16BF8159u, 0x02FE9CD6u, 0xC02280FAu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0xBBE008A3u, 0x73000281u, 0x7E820200u, 0x01558B1Bu)),
+        v128_const(0x06030104u, 0x05000102u, 0x06020100u, 0x01040404u),
+        "i8x16.popcnt(v128_const(0xBBE008A3u, 0x73000281u, 0x7E820200u, 0x01558B1Bu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0x7E7F809Bu, 0x844D40D8u, 0xEC7E7700u, 0x65FE55FFu)),
+        v128_const(0x06070105u, 0x02040104u, 0x05060600u, 0x04070408u),
+        "i8x16.popcnt(v128_const(0x7E7F809Bu, 0x844D40D8u, 0xEC7E7700u, 0x65FE55FFu))"
+    );
+    assertEqualV128(
+        simdi8x16arith20_i8x16X2Epopcnt(&instance, v128_const(0xFF0A40DDu, 0xBD558DC2u, 0xB355FFB6u, 0x55288001u)),
+        v128_const(0x08020106u, 0x06040403u, 0x05040805u, 0x04020101u),
+        "i8x16.popcnt(v128_const(0xFF0A40DDu, 0xBD558DC2u, 0xB355FFB6u, 0x55288001u))"
+    );
+}
@@ -0,0 +1,411 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i8x16_cmp.0.h"
+
+void test() {
+    simdi8x16cmp0Instance instance;
+    simdi8x16cmp0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i8x16_cmp.0.wasm");
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.eq(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.eq(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.eq(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.eq(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.eq(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.eq(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.eq(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Eeq(&instance, v128_const(0x71016BF3u, 0x7F40D639u, 0x440A872Au, 0x0084BDFFu), v128_const(0x3B807E80u, 0x594040A8u, 0x6276D213u, 0xEB7E6677u)),
+        v128_const(0x00000000u, 0x00FF0000u, 0x00000000u, 0x00000000u),
+        "i8x16.eq(v128_const(0x71016BF3u, 0x7F40D639u, 0x440A872Au, 0x0084BDFFu), v128_const(0x3B807E80u, 0x594040A8u, 0x6276D213u, 0xEB7E6677u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ne(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ne(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ne(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ne(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ne(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ne(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ne(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ene(&instance, v128_const(0x7F80C05Bu, 0x01FF81A2u, 0x0F4DFE00u, 0xC1158101u), v128_const(0x2B8A81D0u, 0x019D7EC5u, 0x50FB0C55u, 0x808102FEu)),
+        v128_const(0xFFFFFFFFu, 0x00FFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ne(v128_const(0x7F80C05Bu, 0x01FF81A2u, 0x0F4DFE00u, 0xC1158101u), v128_const(0x2B8A81D0u, 0x019D7EC5u, 0x50FB0C55u, 0x808102FEu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.lt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.lt_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_s(&instance, v128_const(0x7E13C081u, 0xF6DDFE4Fu, 0xC38979C0u, 0x80210237u), v128_const(0xC0A48161u, 0x55807F01u, 0x8095A940u, 0x1FBFFA64u)),
+        v128_const(0x000000FFu, 0xFF00FF00u, 0x00FF00FFu, 0xFF0000FFu),
+        "i8x16.lt_s(v128_const(0x7E13C081u, 0xF6DDFE4Fu, 0xC38979C0u, 0x80210237u), v128_const(0xC0A48161u, 0x55807F01u, 0x8095A940u, 0x1FBFFA64u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.lt_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.lt_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Elt_u(&instance, v128_const(0x2C80008Cu, 0xFEC08102u, 0x4DAD7F5Cu, 0xD4017F55u), v128_const(0xC396C97Eu, 0x9E967F9Du, 0x6940BD40u, 0x32885627u)),
+        v128_const(0xFFFFFF00u, 0x000000FFu, 0xFF00FF00u, 0x00FF0000u),
+        "i8x16.lt_u(v128_const(0x2C80008Cu, 0xFEC08102u, 0x4DAD7F5Cu, 0xD4017F55u), v128_const(0xC396C97Eu, 0x9E967F9Du, 0x6940BD40u, 0x32885627u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.gt_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_s(&instance, v128_const(0xFF02CB54u, 0x0000D72Du, 0x96C7813Du, 0xFEFF4081u), v128_const(0x021C6DC4u, 0x97C97581u, 0x61FFC001u, 0x0080FF7Eu)),
+        v128_const(0x000000FFu, 0xFFFF00FFu, 0x000000FFu, 0x00FFFF00u),
+        "i8x16.gt_s(v128_const(0xFF02CB54u, 0x0000D72Du, 0x96C7813Du, 0xFEFF4081u), v128_const(0x021C6DC4u, 0x97C97581u, 0x61FFC001u, 0x0080FF7Eu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.gt_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.gt_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.gt_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Egt_u(&instance, v128_const(0x30B3FF26u, 0x7F02C583u, 0x00550158u, 0x0181FE55u), v128_const(0xC42AC97Fu, 0x763A7F81u, 0x9BD3AB01u, 0x36FE5533u)),
+        v128_const(0x00FFFF00u, 0xFF00FFFFu, 0x000000FFu, 0x0000FFFFu),
+        "i8x16.gt_u(v128_const(0x30B3FF26u, 0x7F02C583u, 0x00550158u, 0x0181FE55u), v128_const(0xC42AC97Fu, 0x763A7F81u, 0x9BD3AB01u, 0x36FE5533u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.le_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_s(&instance, v128_const(0xE8FEB240u, 0x1F4A8097u, 0xEFC08D69u, 0x80E80147u), v128_const(0x009D2CAAu, 0xD68855B4u, 0x12070100u, 0xF0C24079u)),
+        v128_const(0xFF00FF00u, 0x0000FFFFu, 0xFFFFFF00u, 0xFF00FFFFu),
+        "i8x16.le_s(v128_const(0xE8FEB240u, 0x1F4A8097u, 0xEFC08D69u, 0x80E80147u), v128_const(0x009D2CAAu, 0xD68855B4u, 0x12070100u, 0xF0C24079u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.le_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.le_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ele_u(&instance, v128_const(0xC0FFFEB6u, 0x9C607F3Cu, 0xFFB03781u, 0x4017002Eu), v128_const(0xB03C9278u, 0x808E40CCu, 0x2E977F81u, 0xD2AE0A55u)),
+        v128_const(0x00000000u, 0x00FF00FFu, 0x0000FFFFu, 0xFFFFFFFFu),
+        "i8x16.le_u(v128_const(0xC0FFFEB6u, 0x9C607F3Cu, 0xFFB03781u, 0x4017002Eu), v128_const(0xB03C9278u, 0x808E40CCu, 0x2E977F81u, 0xD2AE0A55u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ge_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ge_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_s(&instance, v128_const(0xFF77FEEFu, 0xC213F77Eu, 0x1571A169u, 0x7EF8C07Fu), v128_const(0x7EDDA70Fu, 0x01C040FFu, 0xAA7E01F8u, 0x000A30FFu)),
+        v128_const(0x00FFFF00u, 0x00FF00FFu, 0xFF0000FFu, 0xFF0000FFu),
+        "i8x16.ge_s(v128_const(0xFF77FEEFu, 0xC213F77Eu, 0x1571A169u, 0x7EF8C07Fu), v128_const(0x7EDDA70Fu, 0x01C040FFu, 0xAA7E01F8u, 0x000A30FFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.ge_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.ge_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16cmp0_i8x16X2Ege_u(&instance, v128_const(0x55B8C751u, 0x7E80B481u, 0x00F17FFFu, 0x31017E80u), v128_const(0xD17F558Du, 0x8031C208u, 0xC6B1FEE2u, 0x02FF80E1u)),
+        v128_const(0x00FFFF00u, 0x00FF00FFu, 0x00FF00FFu, 0xFF000000u),
+        "i8x16.ge_u(v128_const(0x55B8C751u, 0x7E80B481u, 0x00F17FFFu, 0x31017E80u), v128_const(0xD17F558Du, 0x8031C208u, 0xC6B1FEE2u, 0x02FF80E1u))"
+    );
+}
@@ -0,0 +1,251 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_i8x16_sat_arith.0.h"
+
+void test() {
+    simdi8x16satarith0Instance instance;
+    simdi8x16satarith0Instantiate(&instance, resolveTestImports);
+    printStart("simd_i8x16_sat_arith.0.wasm");
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add_sat_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.add_sat_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add_sat_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.add_sat_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.add_sat_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.add_sat_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.add_sat_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x00BA0281u, 0x9D51D435u, 0x7EFEEF10u, 0x5581DE06u), v128_const(0x416580DAu, 0x4155BAD9u, 0xB5CB5540u, 0x5EF5947Fu)),
+        v128_const(0x411F8280u, 0xDE7F8E0Eu, 0x33C94450u, 0x7F80807Fu),
+        "i8x16.add_sat_s(v128_const(0x00BA0281u, 0x9D51D435u, 0x7EFEEF10u, 0x5581DE06u), v128_const(0x416580DAu, 0x4155BAD9u, 0xB5CB5540u, 0x5EF5947Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x01CCF5A5u, 0x7FBBF340u, 0x47E6026Au, 0x51E7AC7Eu), v128_const(0x81FE4040u, 0x8A4DD67Fu, 0xD09C5511u, 0x36810080u)),
+        v128_const(0x82CA35E5u, 0x0908C97Fu, 0x1782577Bu, 0x7F80ACFEu),
+        "i8x16.add_sat_s(v128_const(0x01CCF5A5u, 0x7FBBF340u, 0x47E6026Au, 0x51E7AC7Eu), v128_const(0x81FE4040u, 0x8A4DD67Fu, 0xD09C5511u, 0x36810080u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x80A3402Au, 0x757E40CDu, 0xBC0F55C0u, 0xD1537E7Eu), v128_const(0x2A9433FDu, 0xC57D40B0u, 0xC0CCC480u, 0xC0EE817Fu)),
+        v128_const(0xAA807327u, 0x3A7F7F80u, 0x80DB1980u, 0x9141FF7Fu),
+        "i8x16.add_sat_s(v128_const(0x80A3402Au, 0x757E40CDu, 0xBC0F55C0u, 0xD1537E7Eu), v128_const(0x2A9433FDu, 0xC57D40B0u, 0xC0CCC480u, 0xC0EE817Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0xFF6EFE6Au, 0xD8060242u, 0x01014557u, 0x65C0D5EAu), v128_const(0x655BC07Eu, 0xE9554276u, 0x30C09F9Fu, 0xFE40BADCu)),
+        v128_const(0x647FBE7Fu, 0xC15B447Fu, 0x31C1E4F6u, 0x63008FC6u),
+        "i8x16.add_sat_s(v128_const(0xFF6EFE6Au, 0xD8060242u, 0x01014557u, 0x65C0D5EAu), v128_const(0x655BC07Eu, 0xE9554276u, 0x30C09F9Fu, 0xFE40BADCu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_s(&instance, v128_const(0x4D555881u, 0xC0647EE0u, 0xF33581BAu, 0x02015B7Fu), v128_const(0x9481087Fu, 0x40C07F00u, 0x7FCD0140u, 0x01BC8050u)),
+        v128_const(0xE1D66000u, 0x00247FE0u, 0x720282FAu, 0x03BDDB7Fu),
+        "i8x16.add_sat_s(v128_const(0x4D555881u, 0xC0647EE0u, 0xF33581BAu, 0x02015B7Fu), v128_const(0x9481087Fu, 0x40C07F00u, 0x7FCD0140u, 0x01BC8050u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.add_sat_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x02020202u, 0x02020202u, 0x02020202u, 0x02020202u),
+        "i8x16.add_sat_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.add_sat_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.add_sat_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.add_sat_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.add_sat_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.add_sat_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x2951A300u, 0x003AEC55u, 0x407FD882u, 0xFEB29DC9u), v128_const(0x00A67FB2u, 0x7CC088CEu, 0x40B33B0Au, 0x43301C40u)),
+        v128_const(0x29F7FFB2u, 0x7CFAFFFFu, 0x80FFFF8Cu, 0xFFE2B9FFu),
+        "i8x16.add_sat_u(v128_const(0x2951A300u, 0x003AEC55u, 0x407FD882u, 0xFEB29DC9u), v128_const(0x00A67FB2u, 0x7CC088CEu, 0x40B33B0Au, 0x43301C40u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x40BC7668u, 0x7DFE55FFu, 0x0D5402E8u, 0x59D67F01u), v128_const(0x0AEC554Au, 0xCE01C87Eu, 0x8FBD818Au, 0x3A8BFE7Eu)),
+        v128_const(0x4AFFCBB2u, 0xFFFFFFFFu, 0x9CFF83FFu, 0x93FFFF7Fu),
+        "i8x16.add_sat_u(v128_const(0x40BC7668u, 0x7DFE55FFu, 0x0D5402E8u, 0x59D67F01u), v128_const(0x0AEC554Au, 0xCE01C87Eu, 0x8FBD818Au, 0x3A8BFE7Eu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x80FF02C9u, 0xCF027483u, 0xFEC05581u, 0x6AEE9900u), v128_const(0x7EEA0280u, 0x0000CE01u, 0x7E40EB49u, 0x804A41A5u)),
+        v128_const(0xFEFF04FFu, 0xCF02FF84u, 0xFFFFFFCAu, 0xEAFFDAA5u),
+        "i8x16.add_sat_u(v128_const(0x80FF02C9u, 0xCF027483u, 0xFEC05581u, 0x6AEE9900u), v128_const(0x7EEA0280u, 0x0000CE01u, 0x7E40EB49u, 0x804A41A5u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x10CDC0C0u, 0xA1B0A544u, 0xA5927FCEu, 0xFE3C8840u), v128_const(0xD2DD7E57u, 0xFEB1FE4Bu, 0xFFEF156Fu, 0x57401001u)),
+        v128_const(0xE2FFFFFFu, 0xFFFFFF8Fu, 0xFFFF94FFu, 0xFF7C9841u),
+        "i8x16.add_sat_u(v128_const(0x10CDC0C0u, 0xA1B0A544u, 0xA5927FCEu, 0xFE3C8840u), v128_const(0xD2DD7E57u, 0xFEB1FE4Bu, 0xFFEF156Fu, 0x57401001u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Eadd_sat_u(&instance, v128_const(0x8AF5806Du, 0x7E81307Eu, 0x7F167F34u, 0xC0C95B7Fu), v128_const(0x650297FEu, 0x02FF0286u, 0xC075FEDCu, 0x480CDA47u)),
+        v128_const(0xEFF7FFFFu, 0x80FF32FFu, 0xFF8BFFFFu, 0xFFD5FFC6u),
+        "i8x16.add_sat_u(v128_const(0x8AF5806Du, 0x7E81307Eu, 0x7F167F34u, 0xC0C95B7Fu), v128_const(0x650297FEu, 0x02FF0286u, 0xC075FEDCu, 0x480CDA47u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_s(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_s(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.sub_sat_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu),
+        "i8x16.sub_sat_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x81818181u, 0x81818181u, 0x81818181u, 0x81818181u),
+        "i8x16.sub_sat_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_s(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_s(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0xB041800Bu, 0xB3FE7F71u, 0xFB4840F1u, 0xBB95807Au), v128_const(0xB2DC986Du, 0x80FE0555u, 0x02108106u, 0xA57F7BB6u)),
+        v128_const(0xFE65E89Eu, 0x33007A1Cu, 0xF9387FEBu, 0x1680807Fu),
+        "i8x16.sub_sat_s(v128_const(0xB041800Bu, 0xB3FE7F71u, 0xFB4840F1u, 0xBB95807Au), v128_const(0xB2DC986Du, 0x80FE0555u, 0x02108106u, 0xA57F7BB6u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x08FF01C0u, 0xA9504000u, 0x50FF7002u, 0x81F47E02u), v128_const(0x1355EFFFu, 0xFE01DB29u, 0xC07EFEF7u, 0x40008014u)),
+        v128_const(0xF5AA12C1u, 0xAB4F65D7u, 0x7F81720Bu, 0x80F47FEEu),
+        "i8x16.sub_sat_s(v128_const(0x08FF01C0u, 0xA9504000u, 0x50FF7002u, 0x81F47E02u), v128_const(0x1355EFFFu, 0xFE01DB29u, 0xC07EFEF7u, 0x40008014u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x7C7E0063u, 0x00514420u, 0x74CDBA05u, 0xE7C8F1EBu), v128_const(0x3535FF58u, 0x9E8EFF80u, 0xC00C7F86u, 0xFAEB81B1u)),
+        v128_const(0x4749010Bu, 0x627F457Fu, 0x7FC1807Fu, 0xEDDD703Au),
+        "i8x16.sub_sat_s(v128_const(0x7C7E0063u, 0x00514420u, 0x74CDBA05u, 0xE7C8F1EBu), v128_const(0x3535FF58u, 0x9E8EFF80u, 0xC00C7F86u, 0xFAEB81B1u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0x7FFEFCBCu, 0xB4C0FDF4u, 0x014C8118u, 0xE5EB7EF7u), v128_const(0xC0E705B2u, 0x5077680Bu, 0x337CC0FFu, 0x6981FE6Du)),
+        v128_const(0x7F17F70Au, 0x808095E9u, 0xCED0C119u, 0x806A7F8Au),
+        "i8x16.sub_sat_s(v128_const(0x7FFEFCBCu, 0xB4C0FDF4u, 0x014C8118u, 0xE5EB7EF7u), v128_const(0xC0E705B2u, 0x5077680Bu, 0x337CC0FFu, 0x6981FE6Du))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_s(&instance, v128_const(0xA1404081u, 0x1E80C5C9u, 0x81C05780u, 0xFE2133EAu), v128_const(0xF8C07080u, 0xE2190081u, 0xC67A404Eu, 0x02FF3B20u)),
+        v128_const(0xA97FD001u, 0x3C80C548u, 0xBB801780u, 0xFC22F8CAu),
+        "i8x16.sub_sat_s(v128_const(0xA1404081u, 0x1E80C5C9u, 0x81C05780u, 0xFE2133EAu), v128_const(0xF8C07080u, 0xE2190081u, 0xC67A404Eu, 0x02FF3B20u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_u(v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u), v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_u(v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu, 0xFEFEFEFEu),
+        "i8x16.sub_sat_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u)),
+        v128_const(0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu, 0x7E7E7E7Eu),
+        "i8x16.sub_sat_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_u(v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu), v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.sub_sat_u(v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u), v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x8190819Eu, 0xB480FFFFu, 0x775EC066u, 0x819B7FE5u), v128_const(0x97303108u, 0x54FEEF5Bu, 0x2640FA22u, 0xD3FF30D2u)),
+        v128_const(0x00605096u, 0x600010A4u, 0x511E0044u, 0x00004F13u),
+        "i8x16.sub_sat_u(v128_const(0x8190819Eu, 0xB480FFFFu, 0x775EC066u, 0x819B7FE5u), v128_const(0x97303108u, 0x54FEEF5Bu, 0x2640FA22u, 0xD3FF30D2u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0xA9A901CDu, 0x7E7B8980u, 0x9EA63C1Cu, 0x40FBA055u), v128_const(0x02800740u, 0x4481C57Au, 0x81000E7Eu, 0xA00001CCu)),
+        v128_const(0xA729008Du, 0x3A000006u, 0x1DA62E00u, 0x00FB9F00u),
+        "i8x16.sub_sat_u(v128_const(0xA9A901CDu, 0x7E7B8980u, 0x9EA63C1Cu, 0x40FBA055u), v128_const(0x02800740u, 0x4481C57Au, 0x81000E7Eu, 0xA00001CCu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x5502CC40u, 0xEF81A480u, 0x8FFFFE79u, 0xF2C0FE9Fu), v128_const(0xDCD584C9u, 0x8001BC0Bu, 0x29009B49u, 0x7EA5DBFEu)),
+        v128_const(0x00004800u, 0x6F800075u, 0x66FF6330u, 0x741B2300u),
+        "i8x16.sub_sat_u(v128_const(0x5502CC40u, 0xEF81A480u, 0x8FFFFE79u, 0xF2C0FE9Fu), v128_const(0xDCD584C9u, 0x8001BC0Bu, 0x29009B49u, 0x7EA5DBFEu))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x39C3FAC0u, 0x7F1AC07Fu, 0xBF556D80u, 0x86A2DF7Fu), v128_const(0x819BC06Bu, 0x405D5501u, 0x6904E4BBu, 0xFE998100u)),
+        v128_const(0x00283A55u, 0x3F006B7Eu, 0x56510000u, 0x00095E7Fu),
+        "i8x16.sub_sat_u(v128_const(0x39C3FAC0u, 0x7F1AC07Fu, 0xBF556D80u, 0x86A2DF7Fu), v128_const(0x819BC06Bu, 0x405D5501u, 0x6904E4BBu, 0xFE998100u))"
+    );
+    assertEqualV128(
+        simdi8x16satarith0_i8x16X2Esub_sat_u(&instance, v128_const(0x8C0127C0u, 0xC07FCEADu, 0x8CD955FFu, 0xC19E02D5u), v128_const(0x1A92FFA7u, 0x527E0102u, 0x507F16C2u, 0x92577E44u)),
+        v128_const(0x72000019u, 0x6E01CDABu, 0x3C5A3F3Du, 0x2F470091u),
+        "i8x16.sub_sat_u(v128_const(0x8C0127C0u, 0xC07FCEADu, 0x8CD955FFu, 0xC19E02D5u), v128_const(0x1A92FFA7u, 0x527E0102u, 0x507F16C2u, 0x92577E44u))"
+    );
+}
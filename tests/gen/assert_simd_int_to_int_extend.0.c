@@ -0,0 +1,431 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_int_to_int_extend.0.h"
+
+void test() {
+    simdinttointextend0Instance instance;
+    simdinttointextend0Instantiate(&instance, resolveTestImports);
+    printStart("simd_int_to_int_extend.0.wasm");
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u)),
+        v128_const(0x00020002u, 0x005F001Eu, 0x007FFF8Eu, 0x00550001u),
+        "i16x8.extend_low_i8x16_s(v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u)),
+        v128_const(0x00440047u, 0x00090002u, 0xFFC00001u, 0xFFDC0002u),
+        "i16x8.extend_low_i8x16_s(v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du)),
+        v128_const(0x00620001u, 0xFFFEFFFEu, 0xFF810001u, 0x002EFFF7u),
+        "i16x8.extend_low_i8x16_s(v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu)),
+        v128_const(0xFF9CFF80u, 0x007E0055u, 0xFFC4FFA4u, 0xFF800000u),
+        "i16x8.extend_low_i8x16_s(v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu)),
+        v128_const(0x00710078u, 0x0055FFB0u, 0xFFC3FFB5u, 0x007EFFFEu),
+        "i16x8.extend_low_i8x16_s(v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u),
+        "i16x8.extend_low_i8x16_s(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.extend_low_i8x16_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u)),
+        v128_const(0x00020002u, 0x005F001Eu, 0x007F008Eu, 0x00550001u),
+        "i16x8.extend_low_i8x16_u(v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u)),
+        v128_const(0x00440047u, 0x00090002u, 0x00C00001u, 0x00DC0002u),
+        "i16x8.extend_low_i8x16_u(v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du)),
+        v128_const(0x00620001u, 0x00FE00FEu, 0x00810001u, 0x002E00F7u),
+        "i16x8.extend_low_i8x16_u(v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu)),
+        v128_const(0x009C0080u, 0x007E0055u, 0x00C400A4u, 0x00800000u),
+        "i16x8.extend_low_i8x16_u(v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu)),
+        v128_const(0x00710078u, 0x005500B0u, 0x00C300B5u, 0x007E00FEu),
+        "i16x8.extend_low_i8x16_u(v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u),
+        "i16x8.extend_low_i8x16_u(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_low_i8x16_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu),
+        "i16x8.extend_low_i8x16_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u)),
+        v128_const(0x00010040u, 0xFF900055u, 0xFFE0FFB8u, 0xFFAE0040u),
+        "i16x8.extend_high_i8x16_s(v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u)),
+        v128_const(0xFFC0FF9Bu, 0xFFF9FF80u, 0x006FFFC0u, 0x00560001u),
+        "i16x8.extend_high_i8x16_s(v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du)),
+        v128_const(0x00760002u, 0x0055FFFCu, 0xFFFF004Du, 0x007F0000u),
+        "i16x8.extend_high_i8x16_s(v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu)),
+        v128_const(0xFFC2002Cu, 0xFF80FFE2u, 0x0033FFFFu, 0xFFFEFF9Fu),
+        "i16x8.extend_high_i8x16_s(v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu)),
+        v128_const(0xFF80FFFFu, 0x0000005Cu, 0xFFA2FFFDu, 0x007E0000u),
+        "i16x8.extend_high_i8x16_s(v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0x00090008u, 0x000B000Au, 0x000D000Cu, 0x000F000Eu),
+        "i16x8.extend_high_i8x16_s(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.extend_high_i8x16_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u)),
+        v128_const(0x00010040u, 0x00900055u, 0x00E000B8u, 0x00AE0040u),
+        "i16x8.extend_high_i8x16_u(v128_const(0x5F1E0202u, 0x55017F8Eu, 0x90550140u, 0xAE40E0B8u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u)),
+        v128_const(0x00C0009Bu, 0x00F90080u, 0x006F00C0u, 0x00560001u),
+        "i16x8.extend_high_i8x16_u(v128_const(0x09024447u, 0xDC02C001u, 0xF980C09Bu, 0x56016FC0u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du)),
+        v128_const(0x00760002u, 0x005500FCu, 0x00FF004Du, 0x007F0000u),
+        "i16x8.extend_high_i8x16_u(v128_const(0xFEFE6201u, 0x2EF78101u, 0x55FC7602u, 0x7F00FF4Du))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu)),
+        v128_const(0x00C2002Cu, 0x008000E2u, 0x003300FFu, 0x00FE009Fu),
+        "i16x8.extend_high_i8x16_u(v128_const(0x7E559C80u, 0x8000C4A4u, 0x80E2C22Cu, 0xFE9F33FFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu)),
+        v128_const(0x008000FFu, 0x0000005Cu, 0x00A200FDu, 0x007E0000u),
+        "i16x8.extend_high_i8x16_u(v128_const(0x55B07178u, 0x7EFEC3B5u, 0x005C80FFu, 0x7E00A2FDu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0x00090008u, 0x000B000Au, 0x000D000Cu, 0x000F000Eu),
+        "i16x8.extend_high_i8x16_u(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i16x8X2Eextend_high_i8x16_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu),
+        "i16x8.extend_high_i8x16_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u)),
+        v128_const(0x00007FFFu, 0xFFFF8001u, 0x00007FFFu, 0xFFFF9BAFu),
+        "i32x4.extend_low_i16x8_s(v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu)),
+        v128_const(0xFFFF8000u, 0xFFFFB403u, 0x00000055u, 0xFFFFFFFFu),
+        "i32x4.extend_low_i16x8_s(v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu)),
+        v128_const(0x00004000u, 0x00000002u, 0x00003A97u, 0xFFFFC000u),
+        "i32x4.extend_low_i16x8_s(v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u)),
+        v128_const(0xFFFFFFFEu, 0xFFFFFFFEu, 0x00000055u, 0xFFFFC000u),
+        "i32x4.extend_low_i16x8_s(v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u)),
+        v128_const(0xFFFFB99Fu, 0xFFFFFFFEu, 0xFFFFEA15u, 0x000033E2u),
+        "i32x4.extend_low_i16x8_s(v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u)),
+        v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u),
+        "i32x4.extend_low_i16x8_s(v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.extend_low_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u)),
+        v128_const(0x00007FFFu, 0x00008001u, 0x00007FFFu, 0x00009BAFu),
+        "i32x4.extend_low_i16x8_u(v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu)),
+        v128_const(0x00008000u, 0x0000B403u, 0x00000055u, 0x0000FFFFu),
+        "i32x4.extend_low_i16x8_u(v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu)),
+        v128_const(0x00004000u, 0x00000002u, 0x00003A97u, 0x0000C000u),
+        "i32x4.extend_low_i16x8_u(v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u)),
+        v128_const(0x0000FFFEu, 0x0000FFFEu, 0x00000055u, 0x0000C000u),
+        "i32x4.extend_low_i16x8_u(v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u)),
+        v128_const(0x0000B99Fu, 0x0000FFFEu, 0x0000EA15u, 0x000033E2u),
+        "i32x4.extend_low_i16x8_u(v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u)),
+        v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u),
+        "i32x4.extend_low_i16x8_u(v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_low_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu),
+        "i32x4.extend_low_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u)),
+        v128_const(0xFFFFF94Fu, 0x00000002u, 0xFFFFC000u, 0x00006910u),
+        "i32x4.extend_high_i16x8_s(v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu)),
+        v128_const(0x00004000u, 0x00000001u, 0xFFFFE12Bu, 0x00007FFEu),
+        "i32x4.extend_high_i16x8_s(v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu)),
+        v128_const(0xFFFF8000u, 0xFFFFFFFFu, 0x00001F6Bu, 0x00006031u),
+        "i32x4.extend_high_i16x8_s(v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u)),
+        v128_const(0xFFFFC55Eu, 0x00007AB1u, 0x00007356u, 0x00002341u),
+        "i32x4.extend_high_i16x8_s(v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0x00006099u, 0xFFFFFE26u),
+        "i32x4.extend_high_i16x8_s(v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u)),
+        v128_const(0x00000004u, 0x00000005u, 0x00000006u, 0x00000007u),
+        "i32x4.extend_high_i16x8_s(v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.extend_high_i16x8_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u)),
+        v128_const(0x0000F94Fu, 0x00000002u, 0x0000C000u, 0x00006910u),
+        "i32x4.extend_high_i16x8_u(v128_const(0x80017FFFu, 0x9BAF7FFFu, 0x0002F94Fu, 0x6910C000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu)),
+        v128_const(0x00004000u, 0x00000001u, 0x0000E12Bu, 0x00007FFEu),
+        "i32x4.extend_high_i16x8_u(v128_const(0xB4038000u, 0xFFFF0055u, 0x00014000u, 0x7FFEE12Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu)),
+        v128_const(0x00008000u, 0x0000FFFFu, 0x00001F6Bu, 0x00006031u),
+        "i32x4.extend_high_i16x8_u(v128_const(0x00024000u, 0xC0003A97u, 0xFFFF8000u, 0x60311F6Bu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u)),
+        v128_const(0x0000C55Eu, 0x00007AB1u, 0x00007356u, 0x00002341u),
+        "i32x4.extend_high_i16x8_u(v128_const(0xFFFEFFFEu, 0xC0000055u, 0x7AB1C55Eu, 0x23417356u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x00006099u, 0x0000FE26u),
+        "i32x4.extend_high_i16x8_u(v128_const(0xFFFEB99Fu, 0x33E2EA15u, 0xFFFFFFFFu, 0xFE266099u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u)),
+        v128_const(0x00000004u, 0x00000005u, 0x00000006u, 0x00000007u),
+        "i32x4.extend_high_i16x8_u(v128_const(0x00010000u, 0x00030002u, 0x00050004u, 0x00070006u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i32x4X2Eextend_high_i16x8_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu),
+        "i32x4.extend_high_i16x8_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u)),
+        v128_const(0x40000000u, 0x00000000u, 0xEF60FF1Cu, 0xFFFFFFFFu),
+        "i64x2.extend_low_i32x4_s(v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu)),
+        v128_const(0x0C7E7144u, 0x00000000u, 0x15C0229Fu, 0x00000000u),
+        "i64x2.extend_low_i32x4_s(v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u)),
+        v128_const(0xD22967F7u, 0xFFFFFFFFu, 0x40000000u, 0x00000000u),
+        "i64x2.extend_low_i32x4_s(v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu)),
+        v128_const(0x00000055u, 0x00000000u, 0x00000055u, 0x00000000u),
+        "i64x2.extend_low_i32x4_s(v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu)),
+        v128_const(0xB5CD2BA1u, 0xFFFFFFFFu, 0x00000055u, 0x00000000u),
+        "i64x2.extend_low_i32x4_s(v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extend_low_i32x4_s(v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.extend_low_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u)),
+        v128_const(0x40000000u, 0x00000000u, 0xEF60FF1Cu, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu)),
+        v128_const(0x0C7E7144u, 0x00000000u, 0x15C0229Fu, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u)),
+        v128_const(0xD22967F7u, 0x00000000u, 0x40000000u, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu)),
+        v128_const(0x00000055u, 0x00000000u, 0x00000055u, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu)),
+        v128_const(0xB5CD2BA1u, 0x00000000u, 0x00000055u, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_low_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i64x2.extend_low_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u)),
+        v128_const(0xDA0EC7C7u, 0xFFFFFFFFu, 0x00000055u, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu)),
+        v128_const(0xC0000000u, 0xFFFFFFFFu, 0x3635626Eu, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u)),
+        v128_const(0x118A79ECu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu)),
+        v128_const(0xC47B9E7Cu, 0xFFFFFFFFu, 0x09F35CEBu, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu)),
+        v128_const(0xB6074A72u, 0xFFFFFFFFu, 0x084CFE1Fu, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000003u, 0x00000000u),
+        "i64x2.extend_high_i32x4_s(v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_s(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.extend_high_i32x4_s(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u)),
+        v128_const(0xDA0EC7C7u, 0x00000000u, 0x00000055u, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0x40000000u, 0xEF60FF1Cu, 0xDA0EC7C7u, 0x00000055u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu)),
+        v128_const(0xC0000000u, 0x00000000u, 0x3635626Eu, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0x0C7E7144u, 0x15C0229Fu, 0xC0000000u, 0x3635626Eu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u)),
+        v128_const(0x118A79ECu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0xD22967F7u, 0x40000000u, 0x118A79ECu, 0x00000000u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu)),
+        v128_const(0xC47B9E7Cu, 0x00000000u, 0x09F35CEBu, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0x00000055u, 0x00000055u, 0xC47B9E7Cu, 0x09F35CEBu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu)),
+        v128_const(0xB6074A72u, 0x00000000u, 0x084CFE1Fu, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0xB5CD2BA1u, 0x00000055u, 0xB6074A72u, 0x084CFE1Fu))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u)),
+        v128_const(0x00000002u, 0x00000000u, 0x00000003u, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u))"
+    );
+    assertEqualV128(
+        simdinttointextend0_i64x2X2Eextend_high_i32x4_u(&instance, v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu)),
+        v128_const(0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u),
+        "i64x2.extend_high_i32x4_u(v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu))"
+    );
+}
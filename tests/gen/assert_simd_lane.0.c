@@ -0,0 +1,711 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_lane.0.h"
+
+void test() {
+    simdlane0Instance instance;
+    simdlane0Instantiate(&instance, resolveTestImports);
+    printStart("simd_lane.0.wasm");
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D0(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        20u,
+        "i8x16.extract_lane_s-0(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D0(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        4294967249u,
+        "i8x16.extract_lane_s-0(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D0(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        4294967168u,
+        "i8x16.extract_lane_s-0(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D1(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        25u,
+        "i8x16.extract_lane_s-1(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D1(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        85u,
+        "i8x16.extract_lane_s-1(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D1(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        4294967169u,
+        "i8x16.extract_lane_s-1(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D8(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        4294967240u,
+        "i8x16.extract_lane_s-8(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D8(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        4294967185u,
+        "i8x16.extract_lane_s-8(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D8(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        4294967176u,
+        "i8x16.extract_lane_s-8(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D15(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        4294967189u,
+        "i8x16.extract_lane_s-15(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D15(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        57u,
+        "i8x16.extract_lane_s-15(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_sX2D15(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        4294967183u,
+        "i8x16.extract_lane_s-15(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D0(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        20u,
+        "i8x16.extract_lane_u-0(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D0(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        209u,
+        "i8x16.extract_lane_u-0(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D0(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        128u,
+        "i8x16.extract_lane_u-0(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D1(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        25u,
+        "i8x16.extract_lane_u-1(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D1(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        85u,
+        "i8x16.extract_lane_u-1(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D1(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        129u,
+        "i8x16.extract_lane_u-1(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D8(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        200u,
+        "i8x16.extract_lane_u-8(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D8(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        145u,
+        "i8x16.extract_lane_u-8(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D8(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        136u,
+        "i8x16.extract_lane_u-8(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D15(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u)),
+        149u,
+        "i8x16.extract_lane_u-15(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D15(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u)),
+        57u,
+        "i8x16.extract_lane_u-15(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u))"
+    );
+    assertEqualU32(
+        simdlane0_i8x16X2Eextract_lane_uX2D15(&instance, v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        143u,
+        "i8x16.extract_lane_u-15(v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D0(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 246062358u),
+        v128_const(0xBD131916u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u),
+        "i8x16.replace_lane-0(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 246062358u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D0(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 3738786922u),
+        v128_const(0x510A556Au, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u),
+        "i8x16.replace_lane-0(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 3738786922u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D1(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 516647516u),
+        v128_const(0xBD135C14u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u),
+        "i8x16.replace_lane-1(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 516647516u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D1(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 236456136u),
+        v128_const(0x510AC8D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u),
+        "i8x16.replace_lane-1(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 236456136u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D8(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 2525007951u),
+        v128_const(0xBD131914u, 0x8A133941u, 0x3B10974Fu, 0x9515D4D8u),
+        "i8x16.replace_lane-8(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 2525007951u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D8(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 4002213019u),
+        v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB68389Bu, 0x39A3C8C7u),
+        "i8x16.replace_lane-8(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 4002213019u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D15(&instance, v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 257365083u),
+        v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x5B15D4D8u),
+        "i8x16.replace_lane-15(v128_const(0xBD131914u, 0x8A133941u, 0x3B1097C8u, 0x9515D4D8u), 257365083u)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Ereplace_laneX2D15(&instance, v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 3768825715u),
+        v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x73A3C8C7u),
+        "i8x16.replace_lane-15(v128_const(0x510A55D1u, 0xC4BD6888u, 0xEB683891u, 0x39A3C8C7u), 3768825715u)"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D0(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        12812u,
+        "i16x8.extract_lane_s-0(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D0(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        21488u,
+        "i16x8.extract_lane_s-0(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D0(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        4294934528u,
+        "i16x8.extract_lane_s-0(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D1(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        22462u,
+        "i16x8.extract_lane_s-1(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D1(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        4294956764u,
+        "i16x8.extract_lane_s-1(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D1(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        4294934529u,
+        "i16x8.extract_lane_s-1(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D4(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        20780u,
+        "i16x8.extract_lane_s-4(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D4(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        21356u,
+        "i16x8.extract_lane_s-4(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D4(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        4294934532u,
+        "i16x8.extract_lane_s-4(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D7(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        20421u,
+        "i16x8.extract_lane_s-7(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D7(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        31556u,
+        "i16x8.extract_lane_s-7(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_sX2D7(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        4294934535u,
+        "i16x8.extract_lane_s-7(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D0(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        12812u,
+        "i16x8.extract_lane_u-0(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D0(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        21488u,
+        "i16x8.extract_lane_u-0(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D0(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        32768u,
+        "i16x8.extract_lane_u-0(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D1(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        22462u,
+        "i16x8.extract_lane_u-1(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D1(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        55004u,
+        "i16x8.extract_lane_u-1(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D1(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        32769u,
+        "i16x8.extract_lane_u-1(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D4(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        20780u,
+        "i16x8.extract_lane_u-4(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D4(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        21356u,
+        "i16x8.extract_lane_u-4(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D4(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        32772u,
+        "i16x8.extract_lane_u-4(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D7(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u)),
+        20421u,
+        "i16x8.extract_lane_u-7(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D7(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u)),
+        31556u,
+        "i16x8.extract_lane_u-7(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u))"
+    );
+    assertEqualU32(
+        simdlane0_i16x8X2Eextract_lane_uX2D7(&instance, v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u)),
+        32775u,
+        "i16x8.extract_lane_u-7(v128_const(0x80018000u, 0x80038002u, 0x80058004u, 0x80078006u))"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D0(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 174657728u),
+        v128_const(0x57BE10C0u, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u),
+        "i16x8.replace_lane-0(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 174657728u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D0(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 1709647580u),
+        v128_const(0xD6DC26DCu, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u),
+        "i16x8.replace_lane-0(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 1709647580u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D1(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 2539842981u),
+        v128_const(0xEDA5320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u),
+        "i16x8.replace_lane-1(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 2539842981u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D1(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 131738592u),
+        v128_const(0x2BE053F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u),
+        "i16x8.replace_lane-1(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 131738592u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D4(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 2795144925u),
+        v128_const(0x57BE320Cu, 0x63747EBDu, 0x007686DDu, 0x4FC52039u),
+        "i16x8.replace_lane-4(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 2795144925u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D4(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 2172246820u),
+        v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5DB24u, 0x7B44BCC1u),
+        "i16x8.replace_lane-4(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 2172246820u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D7(&instance, v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 1759952230u),
+        v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0xBD662039u),
+        "i16x8.replace_lane-7(v128_const(0x57BE320Cu, 0x63747EBDu, 0x0076512Cu, 0x4FC52039u), 1759952230u)"
+    );
+    assertEqualV128(
+        simdlane0_i16x8X2Ereplace_laneX2D7(&instance, v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 2373643852u),
+        v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0xEE4CBCC1u),
+        "i16x8.replace_lane-7(v128_const(0xD6DC53F0u, 0x5D40FD48u, 0x57E5536Cu, 0x7B44BCC1u), 2373643852u)"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D0(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u)),
+        3103315313u,
+        "i32x4.extract_lane-0(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D0(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u)),
+        2585884891u,
+        "i32x4.extract_lane-0(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D0(&instance, v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u)),
+        2147483648u,
+        "i32x4.extract_lane-0(v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D1(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u)),
+        486699135u,
+        "i32x4.extract_lane-1(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D1(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u)),
+        3637944372u,
+        "i32x4.extract_lane-1(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D1(&instance, v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u)),
+        2147483649u,
+        "i32x4.extract_lane-1(v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D2(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u)),
+        3356801907u,
+        "i32x4.extract_lane-2(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D2(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u)),
+        3490169960u,
+        "i32x4.extract_lane-2(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D2(&instance, v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u)),
+        2147483650u,
+        "i32x4.extract_lane-2(v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D3(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u)),
+        3973095249u,
+        "i32x4.extract_lane-3(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D3(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u)),
+        1182356480u,
+        "i32x4.extract_lane-3(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u))"
+    );
+    assertEqualU32(
+        simdlane0_i32x4X2Eextract_laneX2D3(&instance, v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u)),
+        2147483651u,
+        "i32x4.extract_lane-3(v128_const(0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u))"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D0(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 1197226622u),
+        v128_const(0x475C3A7Eu, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u),
+        "i32x4.replace_lane-0(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 1197226622u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D0(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 1786190840u),
+        v128_const(0x6A771BF8u, 0xD8D6A034u, 0xD007C468u, 0x46795400u),
+        "i32x4.replace_lane-0(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 1786190840u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D1(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2833360236u),
+        v128_const(0xB8F8D571u, 0xA8E1A56Cu, 0xC814BB73u, 0xECD09F51u),
+        "i32x4.replace_lane-1(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2833360236u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D1(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 3230380148u),
+        v128_const(0x9A2178DBu, 0xC08BB074u, 0xD007C468u, 0x46795400u),
+        "i32x4.replace_lane-1(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 3230380148u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D2(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2321081601u),
+        v128_const(0xB8F8D571u, 0x1D02707Fu, 0x8A58E501u, 0xECD09F51u),
+        "i32x4.replace_lane-2(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2321081601u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D2(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 2056920834u),
+        v128_const(0x9A2178DBu, 0xD8D6A034u, 0x7A9A1F02u, 0x46795400u),
+        "i32x4.replace_lane-2(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 2056920834u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D3(&instance, v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2809109553u),
+        v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xA76F9C31u),
+        "i32x4.replace_lane-3(v128_const(0xB8F8D571u, 0x1D02707Fu, 0xC814BB73u, 0xECD09F51u), 2809109553u)"
+    );
+    assertEqualV128(
+        simdlane0_i32x4X2Ereplace_laneX2D3(&instance, v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 2254160631u),
+        v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x865BC2F7u),
+        "i32x4.replace_lane-3(v128_const(0x9A2178DBu, 0xD8D6A034u, 0xD007C468u, 0x46795400u), 2254160631u)"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D0(&instance, v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u)),
+        11786704631679171173ull,
+        "i64x2.extract_lane-0(v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u))"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D0(&instance, v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u)),
+        10892702000365918393ull,
+        "i64x2.extract_lane-0(v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u))"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D0(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000001u, 0x80000000u)),
+        9223372036854775808ull,
+        "i64x2.extract_lane-0(v128_const(0x00000000u, 0x80000000u, 0x00000001u, 0x80000000u))"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D1(&instance, v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u)),
+        2756584882011044551ull,
+        "i64x2.extract_lane-1(v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u))"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D1(&instance, v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u)),
+        13811431986809791042ull,
+        "i64x2.extract_lane-1(v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u))"
+    );
+    assertEqualU64(
+        simdlane0_i64x2X2Eextract_laneX2D1(&instance, v128_const(0x00000000u, 0x80000000u, 0x00000001u, 0x80000000u)),
+        9223372036854775809ull,
+        "i64x2.extract_lane-1(v128_const(0x00000000u, 0x80000000u, 0x00000001u, 0x80000000u))"
+    );
+    assertEqualV128(
+        simdlane0_i64x2X2Ereplace_laneX2D0(&instance, v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u), 5301342730040446652ull),
+        v128_const(0x10A90EBCu, 0x49922720u, 0x5D7AFAC7u, 0x26415B58u),
+        "i64x2.replace_lane-0(v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u), 5301342730040446652ull)"
+    );
+    assertEqualV128(
+        simdlane0_i64x2X2Ereplace_laneX2D0(&instance, v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u), 5395689670529926250ull),
+        v128_const(0xF22E446Au, 0x4AE1572Au, 0x4543E242u, 0xBFAC1037u),
+        "i64x2.replace_lane-0(v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u), 5395689670529926250ull)"
+    );
+    assertEqualV128(
+        simdlane0_i64x2X2Ereplace_laneX2D1(&instance, v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u), 11717881722238205492ull),
+        v128_const(0xF3B03A65u, 0xA392C969u, 0xA60CFE34u, 0xA29E4757u),
+        "i64x2.replace_lane-1(v128_const(0xF3B03A65u, 0xA392C969u, 0x5D7AFAC7u, 0x26415B58u), 11717881722238205492ull)"
+    );
+    assertEqualV128(
+        simdlane0_i64x2X2Ereplace_laneX2D1(&instance, v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u), 4760044434091589254ull),
+        v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x691ABE86u, 0x420F1331u),
+        "i64x2.replace_lane-1(v128_const(0xDFFF58B9u, 0x972AA6C1u, 0x4543E242u, 0xBFAC1037u), 4760044434091589254ull)"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D0(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u)),
+        -1.0,
+        "f32x4.extract_lane-0(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D0(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u)),
+        1.0,
+        "f32x4.extract_lane-0(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D1(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u)),
+        -1.401298464324817e-45,
+        "f32x4.extract_lane-1(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D1(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u)),
+        -3.4028234663852886e+38,
+        "f32x4.extract_lane-1(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D2(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u)),
+        3.4028234663852886e+38,
+        "f32x4.extract_lane-2(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D2(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u)),
+        3.4028234663852886e+38,
+        "f32x4.extract_lane-2(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D3(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u)),
+        -3.5,
+        "f32x4.extract_lane-3(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u))"
+    );
+    assertEqualF32(
+        simdlane0_f32x4X2Eextract_laneX2D3(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u)),
+        1.1754943508222875e-38,
+        "f32x4.extract_lane-3(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u))"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D0(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), INFINITY),
+        v128_const(0x7F800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u),
+        "f32x4.replace_lane-0(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), INFINITY)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D0(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), 0.0),
+        v128_const(0x00000000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u),
+        "f32x4.replace_lane-0(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), 0.0)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D1(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), -1.0),
+        v128_const(0xBF800000u, 0xBF800000u, 0x7F7FFFFFu, 0xC0600000u),
+        "f32x4.replace_lane-1(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), -1.0)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D1(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), -123456.7890625),
+        v128_const(0x3F800000u, 0xC7F12065u, 0x7F7FFFFFu, 0x00800000u),
+        "f32x4.replace_lane-1(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), -123456.7890625)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D2(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), 1.1754943508222875e-38),
+        v128_const(0xBF800000u, 0x80000001u, 0x00800000u, 0xC0600000u),
+        "f32x4.replace_lane-2(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), 1.1754943508222875e-38)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D2(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), 1.0),
+        v128_const(0x3F800000u, 0xFF7FFFFFu, 0x3F800000u, 0x00800000u),
+        "f32x4.replace_lane-2(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), 1.0)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D3(&instance, v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), INFINITY),
+        v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0x7F800000u),
+        "f32x4.replace_lane-3(v128_const(0xBF800000u, 0x80000001u, 0x7F7FFFFFu, 0xC0600000u), INFINITY)"
+    );
+    assertEqualV128(
+        simdlane0_f32x4X2Ereplace_laneX2D3(&instance, v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), -123456.7890625),
+        v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0xC7F12065u),
+        "f32x4.replace_lane-3(v128_const(0x3F800000u, 0xFF7FFFFFu, 0x7F7FFFFFu, 0x00800000u), -123456.7890625)"
+    );
+    assertEqualF64(
+        simdlane0_f64x2X2Eextract_laneX2D0(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u)),
+        2.5,
+        "f64x2.extract_lane-0(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualF64(
+        simdlane0_f64x2X2Eextract_laneX2D0(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u)),
+        0.5,
+        "f64x2.extract_lane-0(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualF64(
+        simdlane0_f64x2X2Eextract_laneX2D1(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u)),
+        -3.5,
+        "f64x2.extract_lane-1(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u))"
+    );
+    assertEqualF64(
+        simdlane0_f64x2X2Eextract_laneX2D1(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u)),
+        -INFINITY,
+        "f64x2.extract_lane-1(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u))"
+    );
+    assertEqualV128(
+        simdlane0_f64x2X2Ereplace_laneX2D0(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u), 3.0),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0xC00C0000u),
+        "f64x2.replace_lane-0(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u), 3.0)"
+    );
+    assertEqualV128(
+        simdlane0_f64x2X2Ereplace_laneX2D0(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u), -5e-324),
+        v128_const(0x00000001u, 0x80000000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.replace_lane-0(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u), -5e-324)"
+    );
+    assertEqualV128(
+        simdlane0_f64x2X2Ereplace_laneX2D1(&instance, v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u), -1e-10),
+        v128_const(0x00000000u, 0x40040000u, 0xD9D7BDBBu, 0xBDDB7CDFu),
+        "f64x2.replace_lane-1(v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0xC00C0000u), -1e-10)"
+    );
+    assertEqualV128(
+        simdlane0_f64x2X2Ereplace_laneX2D1(&instance, v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u), 1.7976931348623157e+308),
+        v128_const(0x00000000u, 0x3FE00000u, 0xFFFFFFFFu, 0x7FEFFFFFu),
+        "f64x2.replace_lane-1(v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0xFFF00000u), 1.7976931348623157e+308)"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Didentity(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu),
+        "i8x16.shuffle-identity(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Didentity(&instance, v128_const(0x81082F0Bu, 0x341DE015u, 0xB5C05A9Cu, 0xEF5462F5u), v128_const(0x283D3FFEu, 0x5EB42EB2u, 0x9A9B4A2Du, 0xF9164F3Du)),
+        v128_const(0x81082F0Bu, 0x341DE015u, 0xB5C05A9Cu, 0xEF5462F5u),
+        "i8x16.shuffle-identity(v128_const(0x81082F0Bu, 0x341DE015u, 0xB5C05A9Cu, 0xEF5462F5u), v128_const(0x283D3FFEu, 0x5EB42EB2u, 0x9A9B4A2Du, 0xF9164F3Du))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dreverse(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u),
+        "i8x16.shuffle-reverse(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dreverse(&instance, v128_const(0xB53D726Cu, 0x838DE736u, 0x874B78E8u, 0x63540AD0u), v128_const(0xFD895AD7u, 0xF3EDED9Cu, 0x39C707D7u, 0x4B3AA35Fu)),
+        v128_const(0xD00A5463u, 0xE8784B87u, 0x36E78D83u, 0x6C723DB5u),
+        "i8x16.shuffle-reverse(v128_const(0xB53D726Cu, 0x838DE736u, 0x874B78E8u, 0x63540AD0u), v128_const(0xFD895AD7u, 0xF3EDED9Cu, 0x39C707D7u, 0x4B3AA35Fu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dinterleave(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x81018000u, 0x83038202u, 0x85058404u, 0x87078606u),
+        "i8x16.shuffle-interleave(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dinterleave(&instance, v128_const(0x44D05934u, 0x57CF80C3u, 0x223FFE32u, 0x6B677665u), v128_const(0x8837D6BBu, 0x2D231A28u, 0xB2830446u, 0xF2AF6969u)),
+        v128_const(0xD659BB34u, 0x884437D0u, 0x1A8028C3u, 0x2D5723CFu),
+        "i8x16.shuffle-interleave(v128_const(0x44D05934u, 0x57CF80C3u, 0x223FFE32u, 0x6B677665u), v128_const(0x8837D6BBu, 0x2D231A28u, 0xB2830446u, 0xF2AF6969u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dsecond(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu),
+        "i8x16.shuffle-second(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dsecond(&instance, v128_const(0xE2C38190u, 0xEC9866B0u, 0xE990A580u, 0x101B7B96u), v128_const(0xD62732ECu, 0xA19111CBu, 0x38C8DAF1u, 0xE6771FC9u)),
+        v128_const(0xD62732ECu, 0xA19111CBu, 0x38C8DAF1u, 0xE6771FC9u),
+        "i8x16.shuffle-second(v128_const(0xE2C38190u, 0xEC9866B0u, 0xE990A580u, 0x101B7B96u), v128_const(0xD62732ECu, 0xA19111CBu, 0x38C8DAF1u, 0xE6771FC9u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dbroadcast(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x05050505u, 0x05050505u, 0x05050505u, 0x05050505u),
+        "i8x16.shuffle-broadcast(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dbroadcast(&instance, v128_const(0xDDA4FD40u, 0xB263C756u, 0xB5068E48u, 0xDF9085F9u), v128_const(0x6EC00FB7u, 0x99279B89u, 0x2D57FC1Bu, 0x06CC0168u)),
+        v128_const(0xC7C7C7C7u, 0xC7C7C7C7u, 0xC7C7C7C7u, 0xC7C7C7C7u),
+        "i8x16.shuffle-broadcast(v128_const(0xDDA4FD40u, 0xB263C756u, 0xB5068E48u, 0xDF9085F9u), v128_const(0x6EC00FB7u, 0x99279B89u, 0x2D57FC1Bu, 0x06CC0168u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dmixed(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu)),
+        v128_const(0x0281008Fu, 0x06850483u, 0x8A0B8809u, 0x8E0F8C0Du),
+        "i8x16.shuffle-mixed(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x83828180u, 0x87868584u, 0x8B8A8988u, 0x8F8E8D8Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2EshuffleX2Dmixed(&instance, v128_const(0x69AA43E5u, 0x05B5F8AEu, 0x6BC34DFEu, 0xA08AE7BEu), v128_const(0x8842DA05u, 0xDE765E5Eu, 0xABA6CE63u, 0xA1AEB40Bu)),
+        v128_const(0xAADAE5A1u, 0xB55EAE88u, 0xA66B634Du, 0xAEA00BE7u),
+        "i8x16.shuffle-mixed(v128_const(0x69AA43E5u, 0x05B5F8AEu, 0x6BC34DFEu, 0xA08AE7BEu), v128_const(0x8842DA05u, 0xDE765E5Eu, 0xABA6CE63u, 0xA1AEB40Bu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu),
+        "i8x16.swizzle(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0xA703FDB7u, 0x2C107934u, 0x15BACF54u, 0x583EF438u), v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu)),
+        v128_const(0xA703FDB7u, 0x2C107934u, 0x15BACF54u, 0x583EF438u),
+        "i8x16.swizzle(v128_const(0xA703FDB7u, 0x2C107934u, 0x15BACF54u, 0x583EF438u), v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u)),
+        v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u),
+        "i8x16.swizzle(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x29B97171u, 0x11EFFF0Du, 0xD306F334u, 0x01DDA2B0u), v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u)),
+        v128_const(0xB0A2DD01u, 0x34F306D3u, 0x0DFFEF11u, 0x7171B929u),
+        "i8x16.swizzle(v128_const(0x29B97171u, 0x11EFFF0Du, 0xD306F334u, 0x01DDA2B0u), v128_const(0x0C0D0E0Fu, 0x08090A0Bu, 0x04050607u, 0x00010203u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x80FF1110u, 0x03020100u, 0x07201F0Fu, 0x807F0908u)),
+        v128_const(0x00000000u, 0x03020100u, 0x0700000Fu, 0x00000908u),
+        "i8x16.swizzle(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x80FF1110u, 0x03020100u, 0x07201F0Fu, 0x807F0908u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0xE41FBFE7u, 0xC5719514u, 0xBD88EEC2u, 0xC3E06A81u), v128_const(0x80FF1110u, 0x03020100u, 0x07201F0Fu, 0x807F0908u)),
+        v128_const(0x00000000u, 0xE41FBFE7u, 0xC50000C3u, 0x0000EEC2u),
+        "i8x16.swizzle(v128_const(0xE41FBFE7u, 0xC5719514u, 0xBD88EEC2u, 0xC3E06A81u), v128_const(0x80FF1110u, 0x03020100u, 0x07201F0Fu, 0x807F0908u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0xA57A847Bu, 0x83B19C84u, 0xC5B3FB77u, 0xE30A3431u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x000A0000u),
+        "i8x16.swizzle(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0xA57A847Bu, 0x83B19C84u, 0xC5B3FB77u, 0xE30A3431u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0xC08B3B50u, 0x5515D90Eu, 0xBE3E2EF3u, 0xC37A2B58u), v128_const(0xA57A847Bu, 0x83B19C84u, 0xC5B3FB77u, 0xE30A3431u)),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x003E0000u),
+        "i8x16.swizzle(v128_const(0xC08B3B50u, 0x5515D90Eu, 0xBE3E2EF3u, 0xC37A2B58u), v128_const(0xA57A847Bu, 0x83B19C84u, 0xC5B3FB77u, 0xE30A3431u))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x0E020E10u, 0x09080907u, 0x120B0404u, 0x0B01100Bu)),
+        v128_const(0x0E020E00u, 0x09080907u, 0x000B0404u, 0x0B01000Bu),
+        "i8x16.swizzle(v128_const(0x03020100u, 0x07060504u, 0x0B0A0908u, 0x0F0E0D0Cu), v128_const(0x0E020E10u, 0x09080907u, 0x120B0404u, 0x0B01100Bu))"
+    );
+    assertEqualV128(
+        simdlane0_i8x16X2Eswizzle(&instance, v128_const(0x77BDE87Au, 0xB090E209u, 0x46FF3809u, 0xAF990CACu), v128_const(0x0E020E10u, 0x09080907u, 0x120B0404u, 0x0B01100Bu)),
+        v128_const(0x99BD9900u, 0x380938B0u, 0x00460909u, 0x46E80046u),
+        "i8x16.swizzle(v128_const(0x77BDE87Au, 0xB090E209u, 0x46FF3809u, 0xAF990CACu), v128_const(0x0E020E10u, 0x09080907u, 0x120B0404u, 0x0B01100Bu))"
+    );
+}
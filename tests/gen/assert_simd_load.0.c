@@ -0,0 +1,541 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_load.0.h"
+
+void test() {
+    simdload0Instance instance;
+    simdload0Instantiate(&instance, resolveTestImports);
+    printStart("simd_load.0.wasm");
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x0EE9C49Fu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.load(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 0u),
+        v128_const(0xC8A78259u, 0x5C3B16EDu, 0xF1CEAB80u, 0x85623F14u),
+        "v128.load-offset(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 0u),
+        v128_const(0x9F7A5530u, 0x320EE9C4u, 0xC6A37C59u, 0x593710EDu),
+        "v128.load-align(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x320EE9C4u, 0xC6A37C59u, 0x593710EDu),
+        "v128.load(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 1u),
+        v128_const(0xEDC8A782u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.load-offset(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 1u),
+        v128_const(0xC49F7A55u, 0x59320EE9u, 0xEDC6A37Cu, 0x82593710u),
+        "v128.load-align(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x10EDC6A3u, 0xA7825937u, 0x3B16EDC8u),
+        "v128.load(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 7u),
+        v128_const(0xCEAB805Cu, 0x623F14F1u, 0xF1D4AF85u, 0x8D603B1Eu),
+        "v128.load-offset(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 7u),
+        v128_const(0xA37C5932u, 0x3710EDC6u, 0xC8A78259u, 0x5C3B16EDu),
+        "v128.load-align(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 15u),
+        v128_const(0xA7825937u, 0x3B16EDC8u, 0xCEAB805Cu, 0x623F14F1u),
+        "v128.load(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 15u),
+        v128_const(0xF1D4AF85u, 0x8D603B1Eu, 0x18FDD6AAu, 0xB4896247u),
+        "v128.load-offset(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 15u),
+        v128_const(0xC8A78259u, 0x5C3B16EDu, 0xF1CEAB80u, 0x85623F14u),
+        "v128.load-align(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 16u),
+        v128_const(0xC8A78259u, 0x5C3B16EDu, 0xF1CEAB80u, 0x85623F14u),
+        "v128.load(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 16u),
+        v128_const(0x1EF1D4AFu, 0xAA8D603Bu, 0x4718FDD6u, 0xD3B48962u),
+        "v128.load-offset(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 16u),
+        v128_const(0xEDC8A782u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.load-align(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0xD6AA8D60u, 0x624718FDu, 0xFDD3B489u),
+        "v128.load(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 33u),
+        v128_const(0x896C4326u, 0x24F8DFB2u, 0xB0956A4Fu, 0x002106DBu),
+        "v128.load-offset(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 33u),
+        v128_const(0x603B1EF1u, 0xFDD6AA8Du, 0x89624718u, 0x26FDD3B4u),
+        "v128.load-align(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 48u),
+        v128_const(0x6C4326FDu, 0xF8DFB289u, 0x956A4F24u, 0x2106DBB0u),
+        "v128.load(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Doffset(&instance, 48u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load-offset(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2EloadX2Dalign(&instance, 48u),
+        v128_const(0x896C4326u, 0x24F8DFB2u, 0xB0956A4Fu, 0x002106DBu),
+        "v128.load-align(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload(&instance, 65520u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load(65520u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 0u),
+        v128_const(0x0030000Bu, 0x007A0055u, 0xFFC4FF9Fu, 0x000EFFE9u),
+        "v128.load8x8_s(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 1u),
+        v128_const(0x00550030u, 0xFF9F007Au, 0xFFE9FFC4u, 0x0032000Eu),
+        "v128.load8x8_s(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 7u),
+        v128_const(0x0032000Eu, 0x007C0059u, 0xFFC6FFA3u, 0x0010FFEDu),
+        "v128.load8x8_s(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 15u),
+        v128_const(0x00590037u, 0xFFA7FF82u, 0xFFEDFFC8u, 0x003B0016u),
+        "v128.load8x8_s(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 16u),
+        v128_const(0xFF820059u, 0xFFC8FFA7u, 0x0016FFEDu, 0x005C003Bu),
+        "v128.load8x8_s(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 33u),
+        v128_const(0xFFF1FFD4u, 0x003B001Eu, 0xFF8D0060u, 0xFFD6FFAAu),
+        "v128.load8x8_s(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_s(&instance, 48u),
+        v128_const(0x0026FFFDu, 0x006C0043u, 0xFFB2FF89u, 0xFFF8FFDFu),
+        "v128.load8x8_s(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 0u),
+        v128_const(0x0030000Bu, 0x007A0055u, 0x00C4009Fu, 0x000E00E9u),
+        "v128.load8x8_u(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 1u),
+        v128_const(0x00550030u, 0x009F007Au, 0x00E900C4u, 0x0032000Eu),
+        "v128.load8x8_u(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 7u),
+        v128_const(0x0032000Eu, 0x007C0059u, 0x00C600A3u, 0x001000EDu),
+        "v128.load8x8_u(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 15u),
+        v128_const(0x00590037u, 0x00A70082u, 0x00ED00C8u, 0x003B0016u),
+        "v128.load8x8_u(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 16u),
+        v128_const(0x00820059u, 0x00C800A7u, 0x001600EDu, 0x005C003Bu),
+        "v128.load8x8_u(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 33u),
+        v128_const(0x00F100D4u, 0x003B001Eu, 0x008D0060u, 0x00D600AAu),
+        "v128.load8x8_u(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8x8_u(&instance, 48u),
+        v128_const(0x002600FDu, 0x006C0043u, 0x00B20089u, 0x00F800DFu),
+        "v128.load8x8_u(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 0u),
+        v128_const(0x0000300Bu, 0x00007A55u, 0xFFFFC49Fu, 0x00000EE9u),
+        "v128.load16x4_s(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 1u),
+        v128_const(0x00005530u, 0xFFFF9F7Au, 0xFFFFE9C4u, 0x0000320Eu),
+        "v128.load16x4_s(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 7u),
+        v128_const(0x0000320Eu, 0x00007C59u, 0xFFFFC6A3u, 0x000010EDu),
+        "v128.load16x4_s(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 15u),
+        v128_const(0x00005937u, 0xFFFFA782u, 0xFFFFEDC8u, 0x00003B16u),
+        "v128.load16x4_s(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 16u),
+        v128_const(0xFFFF8259u, 0xFFFFC8A7u, 0x000016EDu, 0x00005C3Bu),
+        "v128.load16x4_s(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 33u),
+        v128_const(0xFFFFF1D4u, 0x00003B1Eu, 0xFFFF8D60u, 0xFFFFD6AAu),
+        "v128.load16x4_s(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_s(&instance, 48u),
+        v128_const(0x000026FDu, 0x00006C43u, 0xFFFFB289u, 0xFFFFF8DFu),
+        "v128.load16x4_s(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 0u),
+        v128_const(0x0000300Bu, 0x00007A55u, 0x0000C49Fu, 0x00000EE9u),
+        "v128.load16x4_u(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 1u),
+        v128_const(0x00005530u, 0x00009F7Au, 0x0000E9C4u, 0x0000320Eu),
+        "v128.load16x4_u(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 7u),
+        v128_const(0x0000320Eu, 0x00007C59u, 0x0000C6A3u, 0x000010EDu),
+        "v128.load16x4_u(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 15u),
+        v128_const(0x00005937u, 0x0000A782u, 0x0000EDC8u, 0x00003B16u),
+        "v128.load16x4_u(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 16u),
+        v128_const(0x00008259u, 0x0000C8A7u, 0x000016EDu, 0x00005C3Bu),
+        "v128.load16x4_u(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 33u),
+        v128_const(0x0000F1D4u, 0x00003B1Eu, 0x00008D60u, 0x0000D6AAu),
+        "v128.load16x4_u(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16x4_u(&instance, 48u),
+        v128_const(0x000026FDu, 0x00006C43u, 0x0000B289u, 0x0000F8DFu),
+        "v128.load16x4_u(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x00000000u, 0x0EE9C49Fu, 0x00000000u),
+        "v128.load32x2_s(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 1u),
+        v128_const(0x9F7A5530u, 0xFFFFFFFFu, 0x320EE9C4u, 0x00000000u),
+        "v128.load32x2_s(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x00000000u, 0x10EDC6A3u, 0x00000000u),
+        "v128.load32x2_s(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 15u),
+        v128_const(0xA7825937u, 0xFFFFFFFFu, 0x3B16EDC8u, 0x00000000u),
+        "v128.load32x2_s(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 16u),
+        v128_const(0xC8A78259u, 0xFFFFFFFFu, 0x5C3B16EDu, 0x00000000u),
+        "v128.load32x2_s(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0x00000000u, 0xD6AA8D60u, 0xFFFFFFFFu),
+        "v128.load32x2_s(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_s(&instance, 48u),
+        v128_const(0x6C4326FDu, 0x00000000u, 0xF8DFB289u, 0xFFFFFFFFu),
+        "v128.load32x2_s(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x00000000u, 0x0EE9C49Fu, 0x00000000u),
+        "v128.load32x2_u(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x00000000u, 0x320EE9C4u, 0x00000000u),
+        "v128.load32x2_u(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x00000000u, 0x10EDC6A3u, 0x00000000u),
+        "v128.load32x2_u(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 15u),
+        v128_const(0xA7825937u, 0x00000000u, 0x3B16EDC8u, 0x00000000u),
+        "v128.load32x2_u(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 16u),
+        v128_const(0xC8A78259u, 0x00000000u, 0x5C3B16EDu, 0x00000000u),
+        "v128.load32x2_u(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0x00000000u, 0xD6AA8D60u, 0x00000000u),
+        "v128.load32x2_u(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32x2_u(&instance, 48u),
+        v128_const(0x6C4326FDu, 0x00000000u, 0xF8DFB289u, 0x00000000u),
+        "v128.load32x2_u(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 0u),
+        v128_const(0x0B0B0B0Bu, 0x0B0B0B0Bu, 0x0B0B0B0Bu, 0x0B0B0B0Bu),
+        "v128.load8_splat(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 1u),
+        v128_const(0x30303030u, 0x30303030u, 0x30303030u, 0x30303030u),
+        "v128.load8_splat(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 7u),
+        v128_const(0x0E0E0E0Eu, 0x0E0E0E0Eu, 0x0E0E0E0Eu, 0x0E0E0E0Eu),
+        "v128.load8_splat(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 15u),
+        v128_const(0x37373737u, 0x37373737u, 0x37373737u, 0x37373737u),
+        "v128.load8_splat(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 16u),
+        v128_const(0x59595959u, 0x59595959u, 0x59595959u, 0x59595959u),
+        "v128.load8_splat(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 33u),
+        v128_const(0xD4D4D4D4u, 0xD4D4D4D4u, 0xD4D4D4D4u, 0xD4D4D4D4u),
+        "v128.load8_splat(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload8_splat(&instance, 48u),
+        v128_const(0xFDFDFDFDu, 0xFDFDFDFDu, 0xFDFDFDFDu, 0xFDFDFDFDu),
+        "v128.load8_splat(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 0u),
+        v128_const(0x300B300Bu, 0x300B300Bu, 0x300B300Bu, 0x300B300Bu),
+        "v128.load16_splat(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 1u),
+        v128_const(0x55305530u, 0x55305530u, 0x55305530u, 0x55305530u),
+        "v128.load16_splat(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 7u),
+        v128_const(0x320E320Eu, 0x320E320Eu, 0x320E320Eu, 0x320E320Eu),
+        "v128.load16_splat(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 15u),
+        v128_const(0x59375937u, 0x59375937u, 0x59375937u, 0x59375937u),
+        "v128.load16_splat(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 16u),
+        v128_const(0x82598259u, 0x82598259u, 0x82598259u, 0x82598259u),
+        "v128.load16_splat(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 33u),
+        v128_const(0xF1D4F1D4u, 0xF1D4F1D4u, 0xF1D4F1D4u, 0xF1D4F1D4u),
+        "v128.load16_splat(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload16_splat(&instance, 48u),
+        v128_const(0x26FD26FDu, 0x26FD26FDu, 0x26FD26FDu, 0x26FD26FDu),
+        "v128.load16_splat(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x7A55300Bu, 0x7A55300Bu, 0x7A55300Bu),
+        "v128.load32_splat(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x9F7A5530u, 0x9F7A5530u, 0x9F7A5530u),
+        "v128.load32_splat(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x7C59320Eu, 0x7C59320Eu, 0x7C59320Eu),
+        "v128.load32_splat(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 15u),
+        v128_const(0xA7825937u, 0xA7825937u, 0xA7825937u, 0xA7825937u),
+        "v128.load32_splat(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 16u),
+        v128_const(0xC8A78259u, 0xC8A78259u, 0xC8A78259u, 0xC8A78259u),
+        "v128.load32_splat(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0x3B1EF1D4u, 0x3B1EF1D4u, 0x3B1EF1D4u),
+        "v128.load32_splat(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_splat(&instance, 48u),
+        v128_const(0x6C4326FDu, 0x6C4326FDu, 0x6C4326FDu, 0x6C4326FDu),
+        "v128.load32_splat(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x0EE9C49Fu, 0x7A55300Bu, 0x0EE9C49Fu),
+        "v128.load64_splat(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x320EE9C4u, 0x9F7A5530u, 0x320EE9C4u),
+        "v128.load64_splat(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x10EDC6A3u, 0x7C59320Eu, 0x10EDC6A3u),
+        "v128.load64_splat(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 15u),
+        v128_const(0xA7825937u, 0x3B16EDC8u, 0xA7825937u, 0x3B16EDC8u),
+        "v128.load64_splat(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 16u),
+        v128_const(0xC8A78259u, 0x5C3B16EDu, 0xC8A78259u, 0x5C3B16EDu),
+        "v128.load64_splat(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0xD6AA8D60u, 0x3B1EF1D4u, 0xD6AA8D60u),
+        "v128.load64_splat(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_splat(&instance, 48u),
+        v128_const(0x6C4326FDu, 0xF8DFB289u, 0x6C4326FDu, 0xF8DFB289u),
+        "v128.load64_splat(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 15u),
+        v128_const(0xA7825937u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 16u),
+        v128_const(0xC8A78259u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload32_zero(&instance, 48u),
+        v128_const(0x6C4326FDu, 0x00000000u, 0x00000000u, 0x00000000u),
+        "v128.load32_zero(48u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 0u),
+        v128_const(0x7A55300Bu, 0x0EE9C49Fu, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(0u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 1u),
+        v128_const(0x9F7A5530u, 0x320EE9C4u, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(1u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 7u),
+        v128_const(0x7C59320Eu, 0x10EDC6A3u, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(7u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 15u),
+        v128_const(0xA7825937u, 0x3B16EDC8u, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(15u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 16u),
+        v128_const(0xC8A78259u, 0x5C3B16EDu, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(16u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 33u),
+        v128_const(0x3B1EF1D4u, 0xD6AA8D60u, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(33u)"
+    );
+    assertEqualV128(
+        simdload0_v128X2Eload64_zero(&instance, 48u),
+        v128_const(0x6C4326FDu, 0xF8DFB289u, 0x00000000u, 0x00000000u),
+        "v128.load64_zero(48u)"
+    );
+}
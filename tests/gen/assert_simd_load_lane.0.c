@@ -0,0 +1,176 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_load_lane.0.h"
+
+void test() {
+    simdloadlane0Instance instance;
+    simdloadlane0Instantiate(&instance, resolveTestImports);
+    printStart("simd_load_lane.0.wasm");
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D0(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207B0Bu, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-0(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D0(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207B7Au, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-0(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D0(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207B82u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-0(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D1(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45200BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-1(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D1(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207AF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-1(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D1(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x452082F8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load8_lane-1(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D15(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0B9DACE0u),
+        "v128.load8_lane-15(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D15(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x7A9DACE0u),
+        "v128.load8_lane-15(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload8_laneX2D15(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x829DACE0u),
+        "v128.load8_lane-15(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D0(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x4520300Bu, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-0(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D0(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45209F7Au, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-0(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D0(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x4520A782u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-0(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D1(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x300B7BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-1(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D1(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x9F7A7BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-1(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D1(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0xA7827BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load16_lane-1(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D7(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x300BACE0u),
+        "v128.load16_lane-7(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D7(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x9F7AACE0u),
+        "v128.load16_lane-7(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload16_laneX2D7(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0xA782ACE0u),
+        "v128.load16_lane-7(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D0(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x7A55300Bu, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-0(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D0(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0xE9C49F7Au, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-0(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D0(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0xEDC8A782u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-0(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D1(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x7A55300Bu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-1(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D1(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0xE9C49F7Au, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-1(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D1(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0xEDC8A782u, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load32_lane-1(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D3(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x7A55300Bu),
+        "v128.load32_lane-3(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D3(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0xE9C49F7Au),
+        "v128.load32_lane-3(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload32_laneX2D3(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0xEDC8A782u),
+        "v128.load32_lane-3(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D0(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x7A55300Bu, 0x0EE9C49Fu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load64_lane-0(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D0(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0xE9C49F7Au, 0x7C59320Eu, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load64_lane-0(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D0(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0xEDC8A782u, 0x805C3B16u, 0xBD16E3A0u, 0x0A9DACE0u),
+        "v128.load64_lane-0(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D1(&instance, 0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0x7A55300Bu, 0x0EE9C49Fu),
+        "v128.load64_lane-1(0u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D1(&instance, 3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xE9C49F7Au, 0x7C59320Eu),
+        "v128.load64_lane-1(3u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+    assertEqualV128(
+        simdloadlane0_v128X2Eload64_laneX2D1(&instance, 17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u)),
+        v128_const(0x45207BF8u, 0x763BFCADu, 0xEDC8A782u, 0x805C3B16u),
+        "v128.load64_lane-1(17u, v128_const(0x45207BF8u, 0x763BFCADu, 0xBD16E3A0u, 0x0A9DACE0u))"
+    );
+}
@@ -0,0 +1,501 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_splat.0.h"
+
+void test() {
+    simdsplat0Instance instance;
+    simdsplat0Instantiate(&instance, resolveTestImports);
+    printStart("simd_splat.0.wasm");
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.splat(0u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 1u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.splat(1u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.splat(4294967295u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 127u),
+        v128_const(0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu, 0x7F7F7F7Fu),
+        "i8x16.splat(127u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 128u),
+        v128_const(0x80808080u, 0x80808080u, 0x80808080u, 0x80808080u),
+        "i8x16.splat(128u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 255u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.splat(255u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 4660u),
+        v128_const(0x34343434u, 0x34343434u, 0x34343434u, 0x34343434u),
+        "i8x16.splat(4660u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 32768u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.splat(32768u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 65535u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i8x16.splat(65535u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 305419896u),
+        v128_const(0x78787878u, 0x78787878u, 0x78787878u, 0x78787878u),
+        "i8x16.splat(305419896u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 2147483648u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i8x16.splat(2147483648u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 2147483649u),
+        v128_const(0x01010101u, 0x01010101u, 0x01010101u, 0x01010101u),
+        "i8x16.splat(2147483649u)"
+    );
+    assertEqualV128(
+        simdsplat0_i8x16X2Esplat(&instance, 2309737967u),
+        v128_const(0xEFEFEFEFu, 0xEFEFEFEFu, 0xEFEFEFEFu, 0xEFEFEFEFu),
+        "i8x16.splat(2309737967u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.splat(0u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 1u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.splat(1u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.splat(4294967295u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 127u),
+        v128_const(0x007F007Fu, 0x007F007Fu, 0x007F007Fu, 0x007F007Fu),
+        "i16x8.splat(127u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 128u),
+        v128_const(0x00800080u, 0x00800080u, 0x00800080u, 0x00800080u),
+        "i16x8.splat(128u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 255u),
+        v128_const(0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu, 0x00FF00FFu),
+        "i16x8.splat(255u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 4660u),
+        v128_const(0x12341234u, 0x12341234u, 0x12341234u, 0x12341234u),
+        "i16x8.splat(4660u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 32768u),
+        v128_const(0x80008000u, 0x80008000u, 0x80008000u, 0x80008000u),
+        "i16x8.splat(32768u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 65535u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i16x8.splat(65535u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 305419896u),
+        v128_const(0x56785678u, 0x56785678u, 0x56785678u, 0x56785678u),
+        "i16x8.splat(305419896u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 2147483648u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i16x8.splat(2147483648u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 2147483649u),
+        v128_const(0x00010001u, 0x00010001u, 0x00010001u, 0x00010001u),
+        "i16x8.splat(2147483649u)"
+    );
+    assertEqualV128(
+        simdsplat0_i16x8X2Esplat(&instance, 2309737967u),
+        v128_const(0xCDEFCDEFu, 0xCDEFCDEFu, 0xCDEFCDEFu, 0xCDEFCDEFu),
+        "i16x8.splat(2309737967u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 0u),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i32x4.splat(0u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 1u),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "i32x4.splat(1u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 4294967295u),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i32x4.splat(4294967295u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 127u),
+        v128_const(0x0000007Fu, 0x0000007Fu, 0x0000007Fu, 0x0000007Fu),
+        "i32x4.splat(127u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 128u),
+        v128_const(0x00000080u, 0x00000080u, 0x00000080u, 0x00000080u),
+        "i32x4.splat(128u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 255u),
+        v128_const(0x000000FFu, 0x000000FFu, 0x000000FFu, 0x000000FFu),
+        "i32x4.splat(255u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 4660u),
+        v128_const(0x00001234u, 0x00001234u, 0x00001234u, 0x00001234u),
+        "i32x4.splat(4660u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 32768u),
+        v128_const(0x00008000u, 0x00008000u, 0x00008000u, 0x00008000u),
+        "i32x4.splat(32768u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 65535u),
+        v128_const(0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu, 0x0000FFFFu),
+        "i32x4.splat(65535u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 305419896u),
+        v128_const(0x12345678u, 0x12345678u, 0x12345678u, 0x12345678u),
+        "i32x4.splat(305419896u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 2147483648u),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "i32x4.splat(2147483648u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 2147483649u),
+        v128_const(0x80000001u, 0x80000001u, 0x80000001u, 0x80000001u),
+        "i32x4.splat(2147483649u)"
+    );
+    assertEqualV128(
+        simdsplat0_i32x4X2Esplat(&instance, 2309737967u),
+        v128_const(0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu),
+        "i32x4.splat(2309737967u)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 0ull),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "i64x2.splat(0ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 1ull),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "i64x2.splat(1ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 18446744073709551615ull),
+        v128_const(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu),
+        "i64x2.splat(18446744073709551615ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 127ull),
+        v128_const(0x0000007Fu, 0x00000000u, 0x0000007Fu, 0x00000000u),
+        "i64x2.splat(127ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 128ull),
+        v128_const(0x00000080u, 0x00000000u, 0x00000080u, 0x00000000u),
+        "i64x2.splat(128ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 255ull),
+        v128_const(0x000000FFu, 0x00000000u, 0x000000FFu, 0x00000000u),
+        "i64x2.splat(255ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 4660ull),
+        v128_const(0x00001234u, 0x00000000u, 0x00001234u, 0x00000000u),
+        "i64x2.splat(4660ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 32768ull),
+        v128_const(0x00008000u, 0x00000000u, 0x00008000u, 0x00000000u),
+        "i64x2.splat(32768ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 65535ull),
+        v128_const(0x0000FFFFu, 0x00000000u, 0x0000FFFFu, 0x00000000u),
+        "i64x2.splat(65535ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 305419896ull),
+        v128_const(0x12345678u, 0x00000000u, 0x12345678u, 0x00000000u),
+        "i64x2.splat(305419896ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 2147483648ull),
+        v128_const(0x80000000u, 0x00000000u, 0x80000000u, 0x00000000u),
+        "i64x2.splat(2147483648ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 18446744071562067969ull),
+        v128_const(0x80000001u, 0xFFFFFFFFu, 0x80000001u, 0xFFFFFFFFu),
+        "i64x2.splat(18446744071562067969ull)"
+    );
+    assertEqualV128(
+        simdsplat0_i64x2X2Esplat(&instance, 1311768467463790320ull),
+        v128_const(0x9ABCDEF0u, 0x12345678u, 0x9ABCDEF0u, 0x12345678u),
+        "i64x2.splat(1311768467463790320ull)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 0.0),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f32x4.splat(0.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -0.0),
+        v128_const(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u),
+        "f32x4.splat(-0.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 1.0),
+        v128_const(0x3F800000u, 0x3F800000u, 0x3F800000u, 0x3F800000u),
+        "f32x4.splat(1.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -1.0),
+        v128_const(0xBF800000u, 0xBF800000u, 0xBF800000u, 0xBF800000u),
+        "f32x4.splat(-1.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 0.5),
+        v128_const(0x3F000000u, 0x3F000000u, 0x3F000000u, 0x3F000000u),
+        "f32x4.splat(0.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -0.5),
+        v128_const(0xBF000000u, 0xBF000000u, 0xBF000000u, 0xBF000000u),
+        "f32x4.splat(-0.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 1.5),
+        v128_const(0x3FC00000u, 0x3FC00000u, 0x3FC00000u, 0x3FC00000u),
+        "f32x4.splat(1.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -1.5),
+        v128_const(0xBFC00000u, 0xBFC00000u, 0xBFC00000u, 0xBFC00000u),
+        "f32x4.splat(-1.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 2.5),
+        v128_const(0x40200000u, 0x40200000u, 0x40200000u, 0x40200000u),
+        "f32x4.splat(2.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -2.5),
+        v128_const(0xC0200000u, 0xC0200000u, 0xC0200000u, 0xC0200000u),
+        "f32x4.splat(-2.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 3.0),
+        v128_const(0x40400000u, 0x40400000u, 0x40400000u, 0x40400000u),
+        "f32x4.splat(3.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -3.5),
+        v128_const(0xC0600000u, 0xC0600000u, 0xC0600000u, 0xC0600000u),
+        "f32x4.splat(-3.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 0.10000000149011612),
+        v128_const(0x3DCCCCCDu, 0x3DCCCCCDu, 0x3DCCCCCDu, 0x3DCCCCCDu),
+        "f32x4.splat(0.10000000149011612)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -123456.7890625),
+        v128_const(0xC7F12065u, 0xC7F12065u, 0xC7F12065u, 0xC7F12065u),
+        "f32x4.splat(-123456.7890625)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 10000000000.0),
+        v128_const(0x501502F9u, 0x501502F9u, 0x501502F9u, 0x501502F9u),
+        "f32x4.splat(10000000000.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -1.000000013351432e-10),
+        v128_const(0xAEDBE6FFu, 0xAEDBE6FFu, 0xAEDBE6FFu, 0xAEDBE6FFu),
+        "f32x4.splat(-1.000000013351432e-10)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, INFINITY),
+        v128_const(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u),
+        "f32x4.splat(INFINITY)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -INFINITY),
+        v128_const(0xFF800000u, 0xFF800000u, 0xFF800000u, 0xFF800000u),
+        "f32x4.splat(-INFINITY)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 3.4028234663852886e+38),
+        v128_const(0x7F7FFFFFu, 0x7F7FFFFFu, 0x7F7FFFFFu, 0x7F7FFFFFu),
+        "f32x4.splat(3.4028234663852886e+38)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -3.4028234663852886e+38),
+        v128_const(0xFF7FFFFFu, 0xFF7FFFFFu, 0xFF7FFFFFu, 0xFF7FFFFFu),
+        "f32x4.splat(-3.4028234663852886e+38)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 1.1754943508222875e-38),
+        v128_const(0x00800000u, 0x00800000u, 0x00800000u, 0x00800000u),
+        "f32x4.splat(1.1754943508222875e-38)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, 1.401298464324817e-45),
+        v128_const(0x00000001u, 0x00000001u, 0x00000001u, 0x00000001u),
+        "f32x4.splat(1.401298464324817e-45)"
+    );
+    assertEqualV128(
+        simdsplat0_f32x4X2Esplat(&instance, -1.401298464324817e-45),
+        v128_const(0x80000001u, 0x80000001u, 0x80000001u, 0x80000001u),
+        "f32x4.splat(-1.401298464324817e-45)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 0.0),
+        v128_const(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u),
+        "f64x2.splat(0.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -0.0),
+        v128_const(0x00000000u, 0x80000000u, 0x00000000u, 0x80000000u),
+        "f64x2.splat(-0.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 1.0),
+        v128_const(0x00000000u, 0x3FF00000u, 0x00000000u, 0x3FF00000u),
+        "f64x2.splat(1.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -1.0),
+        v128_const(0x00000000u, 0xBFF00000u, 0x00000000u, 0xBFF00000u),
+        "f64x2.splat(-1.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 0.5),
+        v128_const(0x00000000u, 0x3FE00000u, 0x00000000u, 0x3FE00000u),
+        "f64x2.splat(0.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -0.5),
+        v128_const(0x00000000u, 0xBFE00000u, 0x00000000u, 0xBFE00000u),
+        "f64x2.splat(-0.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 1.5),
+        v128_const(0x00000000u, 0x3FF80000u, 0x00000000u, 0x3FF80000u),
+        "f64x2.splat(1.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -1.5),
+        v128_const(0x00000000u, 0xBFF80000u, 0x00000000u, 0xBFF80000u),
+        "f64x2.splat(-1.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 2.5),
+        v128_const(0x00000000u, 0x40040000u, 0x00000000u, 0x40040000u),
+        "f64x2.splat(2.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -2.5),
+        v128_const(0x00000000u, 0xC0040000u, 0x00000000u, 0xC0040000u),
+        "f64x2.splat(-2.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 3.0),
+        v128_const(0x00000000u, 0x40080000u, 0x00000000u, 0x40080000u),
+        "f64x2.splat(3.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -3.5),
+        v128_const(0x00000000u, 0xC00C0000u, 0x00000000u, 0xC00C0000u),
+        "f64x2.splat(-3.5)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 0.1),
+        v128_const(0x9999999Au, 0x3FB99999u, 0x9999999Au, 0x3FB99999u),
+        "f64x2.splat(0.1)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -123456.789),
+        v128_const(0x9FBE76C9u, 0xC0FE240Cu, 0x9FBE76C9u, 0xC0FE240Cu),
+        "f64x2.splat(-123456.789)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 10000000000.0),
+        v128_const(0x20000000u, 0x4202A05Fu, 0x20000000u, 0x4202A05Fu),
+        "f64x2.splat(10000000000.0)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -1e-10),
+        v128_const(0xD9D7BDBBu, 0xBDDB7CDFu, 0xD9D7BDBBu, 0xBDDB7CDFu),
+        "f64x2.splat(-1e-10)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, INFINITY),
+        v128_const(0x00000000u, 0x7FF00000u, 0x00000000u, 0x7FF00000u),
+        "f64x2.splat(INFINITY)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -INFINITY),
+        v128_const(0x00000000u, 0xFFF00000u, 0x00000000u, 0xFFF00000u),
+        "f64x2.splat(-INFINITY)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 1.7976931348623157e+308),
+        v128_const(0xFFFFFFFFu, 0x7FEFFFFFu, 0xFFFFFFFFu, 0x7FEFFFFFu),
+        "f64x2.splat(1.7976931348623157e+308)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -1.7976931348623157e+308),
+        v128_const(0xFFFFFFFFu, 0xFFEFFFFFu, 0xFFFFFFFFu, 0xFFEFFFFFu),
+        "f64x2.splat(-1.7976931348623157e+308)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 2.2250738585072014e-308),
+        v128_const(0x00000000u, 0x00100000u, 0x00000000u, 0x00100000u),
+        "f64x2.splat(2.2250738585072014e-308)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, 5e-324),
+        v128_const(0x00000001u, 0x00000000u, 0x00000001u, 0x00000000u),
+        "f64x2.splat(5e-324)"
+    );
+    assertEqualV128(
+        simdsplat0_f64x2X2Esplat(&instance, -5e-324),
+        v128_const(0x00000001u, 0x80000000u, 0x00000001u, 0x80000000u),
+        "f64x2.splat(-5e-324)"
+    );
+}
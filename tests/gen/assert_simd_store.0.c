@@ -0,0 +1,61 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_store.0.h"
+
+void test() {
+    simdstore0Instance instance;
+    simdstore0Instantiate(&instance, resolveTestImports);
+    printStart("simd_store.0.wasm");
+    assertEqualV128(
+        simdstore0_v128X2Estore(&instance, 0u, v128_const(0x69614B28u, 0xCA36F78Bu, 0xD1169B53u, 0xCF237ED0u)),
+        v128_const(0x69614B28u, 0xCA36F78Bu, 0xD1169B53u, 0xCF237ED0u),
+        "v128.store(0u, v128_const(0x69614B28u, 0xCA36F78Bu, 0xD1169B53u, 0xCF237ED0u))"
+    );
+    assertEqualV128(
+        simdstore0_v128X2Estore(&instance, 5u, v128_const(0x09BAC887u, 0xC166394Du, 0x3ABAA0DDu, 0x95630461u)),
+        v128_const(0x09BAC887u, 0xC166394Du, 0x3ABAA0DDu, 0x95630461u),
+        "v128.store(5u, v128_const(0x09BAC887u, 0xC166394Du, 0x3ABAA0DDu, 0x95630461u))"
+    );
+    assertEqualV128(
+        simdstore0_v128X2Estore(&instance, 23u, v128_const(0xB2E6CBC6u, 0x93843D17u, 0xDAAF8017u, 0x74D1B3CDu)),
+        v128_const(0xB2E6CBC6u, 0x93843D17u, 0xDAAF8017u, 0x74D1B3CDu),
+        "v128.store(23u, v128_const(0xB2E6CBC6u, 0x93843D17u, 0xDAAF8017u, 0x74D1B3CDu))"
+    );
+    assertEqualV128(
+        simdstore0_v128X2EstoreX2Doffset(&instance, 0u, v128_const(0x307830BDu, 0x1541391Bu, 0x4E97E470u, 0x8CF554E0u)),
+        v128_const(0x307830BDu, 0x1541391Bu, 0x4E97E470u, 0x8CF554E0u),
+        "v128.store-offset(0u, v128_const(0x307830BDu, 0x1541391Bu, 0x4E97E470u, 0x8CF554E0u))"
+    );
+    assertEqualV128(
+        simdstore0_v128X2EstoreX2Doffset(&instance, 5u, v128_const(0x69730ADAu, 0xF67AD7E7u, 0xF2955EDEu, 0x328C75D8u)),
+        v128_const(0x69730ADAu, 0xF67AD7E7u, 0xF2955EDEu, 0x328C75D8u),
+        "v128.store-offset(5u, v128_const(0x69730ADAu, 0xF67AD7E7u, 0xF2955EDEu, 0x328C75D8u))"
+    );
+    assertEqualV128(
+        simdstore0_v128X2EstoreX2Doffset(&instance, 23u, v128_const(0xFB0F9019u, 0x8FC01E33u, 0x9F68C12Du, 0x9368B0A5u)),
+        v128_const(0xFB0F9019u, 0x8FC01E33u, 0x9F68C12Du, 0x9368B0A5u),
+        "v128.store-offset(23u, v128_const(0xFB0F9019u, 0x8FC01E33u, 0x9F68C12Du, 0x9368B0A5u))"
+    );
+    assertEqualV128(
+        simdstore0_load(&instance, 0u),
+        v128_const(0x69614B28u, 0xBAC8878Bu, 0x66394D09u, 0xBAA0DDC1u),
+        "load(0u)"
+    );
+    assertEqualV128(
+        simdstore0_load(&instance, 8u),
+        v128_const(0x66394D09u, 0xBAA0DDC1u, 0x307830BDu, 0x730ADA1Bu),
+        "load(8u)"
+    );
+    assertEqualV128(
+        simdstore0_load(&instance, 16u),
+        v128_const(0x307830BDu, 0x730ADA1Bu, 0x7AD7E769u, 0x955EDEF6u),
+        "load(16u)"
+    );
+    assertEqualV128(
+        simdstore0_load(&instance, 32u),
+        v128_const(0x8C75D8F2u, 0x1974D132u, 0x33FB0F90u, 0x2D8FC01Eu),
+        "load(32u)"
+    );
+}
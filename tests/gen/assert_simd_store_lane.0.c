@@ -0,0 +1,176 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_simd_store_lane.0.h"
+
+void test() {
+    simdstorelane0Instance instance;
+    simdstorelane0Instantiate(&instance, resolveTestImports);
+    printStart("simd_store_lane.0.wasm");
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D0(&instance, 0u, v128_const(0x518E0F92u, 0xEB4C7553u, 0xAEE992F1u, 0x89E66F78u)),
+        v128_const(0x7A553092u, 0x0EE9C49Fu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store8_lane-0(0u, v128_const(0x518E0F92u, 0xEB4C7553u, 0xAEE992F1u, 0x89E66F78u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D0(&instance, 3u, v128_const(0xE7E4743Bu, 0x9C12AB3Du, 0x5F1767A3u, 0x4D5A314Bu)),
+        v128_const(0xE9C49F3Bu, 0x7C59320Eu, 0x10EDC6A3u, 0xA7825937u),
+        "v128.store8_lane-0(3u, v128_const(0xE7E4743Bu, 0x9C12AB3Du, 0x5F1767A3u, 0x4D5A314Bu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D0(&instance, 17u, v128_const(0xE60C823Eu, 0x3679582Bu, 0x892BC4F8u, 0xEDF9E7FDu)),
+        v128_const(0xEDC8A73Eu, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store8_lane-0(17u, v128_const(0xE60C823Eu, 0x3679582Bu, 0x892BC4F8u, 0xEDF9E7FDu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D1(&instance, 0u, v128_const(0x51793C78u, 0xDA886195u, 0x2D034E5Cu, 0x0C83AA66u)),
+        v128_const(0x3B55303Cu, 0x0EE9C49Fu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store8_lane-1(0u, v128_const(0x51793C78u, 0xDA886195u, 0x2D034E5Cu, 0x0C83AA66u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D1(&instance, 3u, v128_const(0xC3D065FBu, 0xF372A68Du, 0xF45489DFu, 0xEE1D84C4u)),
+        v128_const(0xE9C49F65u, 0x7C59320Eu, 0x10EDC6A3u, 0xA73E5937u),
+        "v128.store8_lane-1(3u, v128_const(0xC3D065FBu, 0xF372A68Du, 0xF45489DFu, 0xEE1D84C4u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D1(&instance, 17u, v128_const(0x239565F3u, 0x161A126Bu, 0x2239CD3Du, 0xEFA99775u)),
+        v128_const(0xEDC8A765u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store8_lane-1(17u, v128_const(0x239565F3u, 0x161A126Bu, 0x2239CD3Du, 0xEFA99775u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D15(&instance, 0u, v128_const(0x303EA831u, 0x4D189394u, 0xE89D135Fu, 0x459D815Fu)),
+        v128_const(0x65553045u, 0x0EE9C49Fu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store8_lane-15(0u, v128_const(0x303EA831u, 0x4D189394u, 0xE89D135Fu, 0x459D815Fu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D15(&instance, 3u, v128_const(0x11F57504u, 0x89897E7Du, 0x02FAA1C0u, 0xC80FB9D1u)),
+        v128_const(0xE9C49FC8u, 0x7C59320Eu, 0x10EDC6A3u, 0xA7655937u),
+        "v128.store8_lane-15(3u, v128_const(0x11F57504u, 0x89897E7Du, 0x02FAA1C0u, 0xC80FB9D1u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore8_laneX2D15(&instance, 17u, v128_const(0x488B204Bu, 0xD3CBAF18u, 0xCBD06F04u, 0x3C7346CDu)),
+        v128_const(0xEDC8A73Cu, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store8_lane-15(17u, v128_const(0x488B204Bu, 0xD3CBAF18u, 0xCBD06F04u, 0x3C7346CDu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D0(&instance, 0u, v128_const(0xB9FDB35Cu, 0x5FF4E993u, 0x5CAD5A94u, 0x71EF754Au)),
+        v128_const(0xC855B35Cu, 0x0EE9C49Fu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store16_lane-0(0u, v128_const(0xB9FDB35Cu, 0x5FF4E993u, 0x5CAD5A94u, 0x71EF754Au))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D0(&instance, 3u, v128_const(0x6879DA65u, 0x0455C775u, 0x843FB3F0u, 0x83068A72u)),
+        v128_const(0xE9C4DA65u, 0x7C59320Eu, 0x10EDC6A3u, 0xA73C5937u),
+        "v128.store16_lane-0(3u, v128_const(0x6879DA65u, 0x0455C775u, 0x843FB3F0u, 0x83068A72u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D0(&instance, 17u, v128_const(0xAD6AB45Bu, 0xC951450Du, 0x0728F9E0u, 0xD92F855Fu)),
+        v128_const(0xEDC8B45Bu, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store16_lane-0(17u, v128_const(0xAD6AB45Bu, 0xC951450Du, 0x0728F9E0u, 0xD92F855Fu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D1(&instance, 0u, v128_const(0xD7F6B78Bu, 0xB2C371C5u, 0xC800A92Au, 0xEBF4B34Au)),
+        v128_const(0x6555D7F6u, 0x0EE9C4DAu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store16_lane-1(0u, v128_const(0xD7F6B78Bu, 0xB2C371C5u, 0xC800A92Au, 0xEBF4B34Au))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D1(&instance, 3u, v128_const(0x4827747Au, 0x853D9713u, 0x54655D47u, 0x8AE7D4DFu)),
+        v128_const(0xE9C44827u, 0x7C59320Eu, 0x10EDC6A3u, 0xB45B5937u),
+        "v128.store16_lane-1(3u, v128_const(0x4827747Au, 0x853D9713u, 0x54655D47u, 0x8AE7D4DFu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D1(&instance, 17u, v128_const(0x5DE969B9u, 0x3415EBA9u, 0xA6AE1E94u, 0x7AD121E7u)),
+        v128_const(0xEDC85DE9u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store16_lane-1(17u, v128_const(0x5DE969B9u, 0x3415EBA9u, 0xA6AE1E94u, 0x7AD121E7u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D7(&instance, 0u, v128_const(0x227B760Au, 0x8157DA64u, 0xB0737CFBu, 0x6299BAF1u)),
+        v128_const(0x27556299u, 0x0EE9C448u, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store16_lane-7(0u, v128_const(0x227B760Au, 0x8157DA64u, 0xB0737CFBu, 0x6299BAF1u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D7(&instance, 3u, v128_const(0x48AF88FAu, 0x49E1DB46u, 0x4467D26Du, 0x5A2CB23Bu)),
+        v128_const(0xE9C45A2Cu, 0x7C59320Eu, 0x10EDC6A3u, 0x5DE95937u),
+        "v128.store16_lane-7(3u, v128_const(0x48AF88FAu, 0x49E1DB46u, 0x4467D26Du, 0x5A2CB23Bu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore16_laneX2D7(&instance, 17u, v128_const(0xA3E60799u, 0xAC96B3AFu, 0xC9654675u, 0x32EA0BF9u)),
+        v128_const(0xEDC832EAu, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store16_lane-7(17u, v128_const(0xA3E60799u, 0xAC96B3AFu, 0xC9654675u, 0x32EA0BF9u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D0(&instance, 0u, v128_const(0x4A78D295u, 0x6764DED8u, 0xF9F4A916u, 0x5009ADAFu)),
+        v128_const(0x4A78D295u, 0x0EE9C45Au, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store32_lane-0(0u, v128_const(0x4A78D295u, 0x6764DED8u, 0xF9F4A916u, 0x5009ADAFu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D0(&instance, 3u, v128_const(0x7B02F3EDu, 0xE103C3A7u, 0x45DB9AD5u, 0xE935BF97u)),
+        v128_const(0x7B02F3EDu, 0x7C59320Eu, 0x10EDC6A3u, 0x32EA5937u),
+        "v128.store32_lane-0(3u, v128_const(0x7B02F3EDu, 0xE103C3A7u, 0x45DB9AD5u, 0xE935BF97u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D0(&instance, 17u, v128_const(0xDE0F3324u, 0xA1DE10FBu, 0xCF2CAA1Fu, 0xD4005F11u)),
+        v128_const(0xDE0F3324u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store32_lane-0(17u, v128_const(0xDE0F3324u, 0xA1DE10FBu, 0xCF2CAA1Fu, 0xD4005F11u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D1(&instance, 0u, v128_const(0xECEA40B5u, 0xA1F77814u, 0x5E9572ACu, 0xCB135AD2u)),
+        v128_const(0xA1F77814u, 0x0E7B02F3u, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store32_lane-1(0u, v128_const(0xECEA40B5u, 0xA1F77814u, 0x5E9572ACu, 0xCB135AD2u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D1(&instance, 3u, v128_const(0x95AD54FAu, 0xDF48BB61u, 0xEEB83641u, 0x109274D5u)),
+        v128_const(0xDF48BB61u, 0x7C59320Eu, 0x10EDC6A3u, 0x33245937u),
+        "v128.store32_lane-1(3u, v128_const(0x95AD54FAu, 0xDF48BB61u, 0xEEB83641u, 0x109274D5u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D1(&instance, 17u, v128_const(0xB7605CBFu, 0xFBD22D2Bu, 0xB7926263u, 0xB8DD628Bu)),
+        v128_const(0xFBD22D2Bu, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store32_lane-1(17u, v128_const(0xB7605CBFu, 0xFBD22D2Bu, 0xB7926263u, 0xB8DD628Bu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D3(&instance, 0u, v128_const(0xB9AEC889u, 0x88D76B83u, 0x6143A76Eu, 0x28DBDFFEu)),
+        v128_const(0x28DBDFFEu, 0x0EDF48BBu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store32_lane-3(0u, v128_const(0xB9AEC889u, 0x88D76B83u, 0x6143A76Eu, 0x28DBDFFEu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D3(&instance, 3u, v128_const(0x3E197725u, 0x4C0E5056u, 0x8065E33Au, 0x229B675Cu)),
+        v128_const(0x229B675Cu, 0x7C59320Eu, 0x10EDC6A3u, 0x2D2B5937u),
+        "v128.store32_lane-3(3u, v128_const(0x3E197725u, 0x4C0E5056u, 0x8065E33Au, 0x229B675Cu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore32_laneX2D3(&instance, 17u, v128_const(0x3D99A8D3u, 0xFFC2D816u, 0x62A1EA3Du, 0xE6FDEF37u)),
+        v128_const(0xE6FDEF37u, 0x805C3B16u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store32_lane-3(17u, v128_const(0x3D99A8D3u, 0xFFC2D816u, 0x62A1EA3Du, 0xE6FDEF37u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D0(&instance, 0u, v128_const(0x1DD620F6u, 0xC1813DFFu, 0x8FCB2261u, 0x7EC463ABu)),
+        v128_const(0x1DD620F6u, 0xC1813DFFu, 0xA37C5932u, 0x3710EDC6u),
+        "v128.store64_lane-0(0u, v128_const(0x1DD620F6u, 0xC1813DFFu, 0x8FCB2261u, 0x7EC463ABu))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D0(&instance, 3u, v128_const(0xF7404820u, 0xEC8680B4u, 0x7BA5077Bu, 0x2FDFCBD2u)),
+        v128_const(0xF7404820u, 0xEC8680B4u, 0x10EDC6A3u, 0xEF375937u),
+        "v128.store64_lane-0(3u, v128_const(0xF7404820u, 0xEC8680B4u, 0x7BA5077Bu, 0x2FDFCBD2u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D0(&instance, 17u, v128_const(0xE6550121u, 0x8FDAA8B7u, 0x8E93B94Fu, 0x5CC4AB92u)),
+        v128_const(0xE6550121u, 0x8FDAA8B7u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store64_lane-0(17u, v128_const(0xE6550121u, 0x8FDAA8B7u, 0x8E93B94Fu, 0x5CC4AB92u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D1(&instance, 0u, v128_const(0x5B2EE676u, 0x9DC3F210u, 0x4828ECC8u, 0xAA1ECFF7u)),
+        v128_const(0x4828ECC8u, 0xAA1ECFF7u, 0xA3EC8680u, 0x3710EDC6u),
+        "v128.store64_lane-1(0u, v128_const(0x5B2EE676u, 0x9DC3F210u, 0x4828ECC8u, 0xAA1ECFF7u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D1(&instance, 3u, v128_const(0xD693CE13u, 0xE0ADB825u, 0x866010EBu, 0xCCA38419u)),
+        v128_const(0x866010EBu, 0xCCA38419u, 0x10EDC6A3u, 0x01215937u),
+        "v128.store64_lane-1(3u, v128_const(0xD693CE13u, 0xE0ADB825u, 0x866010EBu, 0xCCA38419u))"
+    );
+    assertEqualV128(
+        simdstorelane0_v128X2Estore64_laneX2D1(&instance, 17u, v128_const(0x77998394u, 0x81A3A780u, 0xE0F780D9u, 0x98B48A98u)),
+        v128_const(0xE0F780D9u, 0x98B48A98u, 0x14F1CEABu, 0xAF85623Fu),
+        "v128.store64_lane-1(17u, v128_const(0x77998394u, 0x81A3A780u, 0xE0F780D9u, 0x98B48A98u))"
+    );
+}
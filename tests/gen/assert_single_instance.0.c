@@ -0,0 +1,72 @@
+
+#include <stdio.h>
+#include "w2c2_base.h"
+#include "test.h"
+#include "test_single_instance.0.h"
+
+void test() {
+    singleinstance0Instance instance;
+    singleinstance0Instantiate(&instance, resolveTestImports);
+    printStart("single_instance.0.wasm");
+    assertEqualU32(
+        singleinstance0_getX2Dg(&instance),
+        7u,
+        "get-g()"
+    );
+    assertEqualU32(
+        singleinstance0_load(&instance, 0u),
+        11u,
+        "load(0u)"
+    );
+    singleinstance0_setX2Dg(&instance, 42u);
+    printOK("set-g(42u)");
+    assertEqualU32(
+        singleinstance0_getX2Dg(&instance),
+        42u,
+        "get-g()"
+    );
+    assertEqualU32(
+        singleinstance0_callX2DgetX2Dg(&instance),
+        42u,
+        "call-get-g()"
+    );
+    singleinstance0_setX2Dh(&instance, 18446744073709551615ull);
+    printOK("set-h(18446744073709551615ull)");
+    assertEqualU64(
+        singleinstance0_getX2Dh(&instance),
+        18446744073709551615ull,
+        "get-h()"
+    );
+    assertEqualU32(
+        singleinstance0_getX2Dg(&instance),
+        42u,
+        "get-g()"
+    );
+    assertEqualU32(
+        singleinstance0_size(&instance),
+        1u,
+        "size()"
+    );
+    assertEqualU32(
+        singleinstance0_grow(&instance),
+        1u,
+        "grow()"
+    );
+    assertEqualU32(
+        singleinstance0_size(&instance),
+        2u,
+        "size()"
+    );
+    singleinstance0_store(&instance, 65536u, 13u);
+    printOK("store(65536u, 13u)");
+    assertEqualU32(
+        singleinstance0_load(&instance, 65536u),
+        13u,
+        "load(65536u)"
+    );
+    assertEqualU32(
+        singleinstance0_load(&instance, 0u),
+        11u,
+        "load(0u)"
+    );
+}
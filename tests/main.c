@@ -108,6 +108,26 @@ void assertEqualF64(
     }
 }
 
+void assertEqualV128(
+    V128 actual,
+    V128 expected,
+    const char *description
+) {
+    if (memcmp(&actual, &expected, sizeof(V128)) != 0) {
+        fprintf(
+            stderr,
+            "FAIL: %s: 0x%08x %08x %08x %08x != 0x%08x %08x %08x %08x\n",
+            description,
+            actual.u32[V128_LANE(4, 3)], actual.u32[V128_LANE(4, 2)],
+            actual.u32[V128_LANE(4, 1)], actual.u32[V128_LANE(4, 0)],
+            expected.u32[V128_LANE(4, 3)], expected.u32[V128_LANE(4, 2)],
+            expected.u32[V128_LANE(4, 1)], expected.u32[V128_LANE(4, 0)]
+        );
+    } else {
+        fprintf(stderr, "OK: %s\n", description);
+    }
+}
+
 void printStart(const char* name) {
     fprintf(stderr, "START: %s\n", name);
 }
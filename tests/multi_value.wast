@@ -0,0 +1,292 @@
+;; Test multiple results and multi-value block types
+
+(module
+  (type $pair (func (result i32 i64)))
+  (type $ii-ii (func (param i32 i32) (result i32 i32)))
+
+  (table funcref (elem $pair $swap $quad))
+
+  (func $dummy)
+
+  ;; Functions
+
+  (func (export "value-i32-i64") (result i32 i64)
+    (i32.const 1) (i64.const 2)
+  )
+  (func (export "value-i32-i32-i32") (result i32 i32 i32)
+    (i32.const 1) (i32.const 2) (i32.const 3)
+  )
+  (func (export "value-f32-f64") (result f32 f64)
+    (f32.const 1.5) (f64.const -0x1.8p+3)
+  )
+  (func (export "value-all") (result i32 i64 f32 f64 i32)
+    (i32.const -1) (i64.const 0x7fff_ffff_ffff_ffff) (f32.const -inf) (f64.const 0x1p-1074) (i32.const 5)
+  )
+  (func (export "value-v128-i32") (result v128 i32)
+    (v128.const i32x4 1 2 3 4) (i32.const 5)
+  )
+  (func (export "param-pass") (param i32 i64 f32 f64) (result f64 f32 i64 i32)
+    (local.get 3) (local.get 2) (local.get 1) (local.get 0)
+  )
+
+  (func $pair (type $pair)
+    (i32.const 7) (i64.const 8)
+  )
+  (func $swap (type $ii-ii)
+    (local.get 1) (local.get 0)
+  )
+  (func $quad (param i32 i32) (result i32 i32)
+    (i32.mul (local.get 0) (i32.const 4))
+    (i32.mul (local.get 1) (i32.const 4))
+  )
+  (func (export "swap") (param i32 i32) (result i32 i32)
+    (call $swap (local.get 0) (local.get 1))
+  )
+  (func (export "swap-twice") (param i32 i32) (result i32 i32)
+    (call $swap (call $swap (local.get 0) (local.get 1)))
+  )
+  (func (export "call-pair") (result i64 i32)
+    (local i32 i64)
+    (call $pair)
+    (local.set 1)
+    (local.set 0)
+    (local.get 1) (local.get 0)
+  )
+  (func (export "call-sum") (result i32)
+    (i32.add (call $swap (i32.const 3) (i32.const 10)))
+  )
+  (func (export "call-sub") (param i32 i32) (result i32)
+    (i32.sub (call $swap (local.get 0) (local.get 1)))
+  )
+  (func (export "call-drop") (result i32)
+    (call $pair) (drop) (drop)
+    (i32.const 9)
+  )
+  (func (export "call_indirect") (param i32 i32 i32) (result i32 i32)
+    (call_indirect (type $ii-ii) (local.get 1) (local.get 2) (local.get 0))
+  )
+  (func (export "call_indirect-pair") (result i32 i64)
+    (call_indirect (type $pair) (i32.const 0))
+  )
+
+  ;; Blocks
+
+  (func (export "block-results") (result i32 i64)
+    (block (result i32 i64) (call $dummy) (i32.const 1) (i64.const 2))
+  )
+  (func (export "block-params") (result i32)
+    (i32.const 1) (i32.const 2)
+    (block (param i32 i32) (result i32) (i32.add))
+  )
+  (func (export "block-params-id") (result i32 i32)
+    (i32.const 1) (i32.const 2)
+    (block (param i32 i32) (result i32 i32))
+  )
+  (func (export "block-type-index") (result i32 i32)
+    (i32.const 4) (i32.const 5)
+    (block (type $ii-ii) (call $quad))
+  )
+  (func (export "block-nested") (result i32 i32 i32)
+    (block (result i32 i32 i32)
+      (i32.const 1)
+      (block (result i32 i32)
+        (i32.const 2)
+        (block (param i32) (result i32 i32) (i32.const 3))
+        (i32.add)
+        (i32.const 4)
+      )
+    )
+  )
+  (func (export "block-br") (param i32) (result i32 i64)
+    (block (result i32 i64)
+      (i32.const 10) (i64.const 20)
+      (br_if 0 (local.get 0))
+      (drop) (drop)
+      (i32.const 30) (i64.const 40)
+    )
+  )
+  (func (export "block-br-value") (result i32 f64)
+    (block (result i32 f64)
+      (br 0 (i32.const 11) (f64.const 2.5))
+    )
+  )
+  (func (export "block-br-nested") (result i32 i32)
+    (block (result i32 i32)
+      (block (result i32)
+        (br 1 (i32.const 12) (i32.const 13))
+      )
+      (i32.const 14)
+    )
+  )
+  (func (export "block-br_if-value") (param i32) (result i32 i32)
+    (block (result i32 i32)
+      (br_if 0 (i32.const 1) (i32.const 2) (local.get 0))
+      (i32.add)
+      (i32.const 3)
+    )
+  )
+  (func (export "block-br_table") (param i32) (result i32 i32)
+    (block $a (result i32 i32)
+      (block $b (result i32 i32)
+        (block $c (result i32 i32)
+          (br_table $a $b $c (i32.const 1) (i32.const 2) (local.get 0))
+        )
+        (i32.add) (i32.const 100)
+        (return)
+      )
+      (i32.sub) (i32.const 200)
+      (return)
+    )
+  )
+  (func (export "block-return") (param i32) (result i32 i64)
+    (block (result i32 i64)
+      (if (local.get 0) (then (return (i32.const 1) (i64.const 2))))
+      (i32.const 3) (i64.const 4)
+    )
+  )
+
+  ;; Loops
+
+  (func (export "loop-results") (result i32 i64)
+    (loop (result i32 i64) (call $dummy) (i32.const 3) (i64.const 4))
+  )
+  (func (export "loop-params") (result i32)
+    (i32.const 1) (i32.const 2)
+    (loop (param i32 i32) (result i32) (i32.add))
+  )
+  (func (export "loop-fac") (param i64) (result i64)
+    (i64.const 1) (local.get 0)
+    (loop $l (param i64 i64) (result i64)
+      (call $pick1) (call $pick1) (i64.mul)
+      (call $pick1) (i64.const 1) (i64.sub)
+      (call $pick0) (i64.const 0) (i64.gt_u)
+      (br_if $l)
+      (drop) (return)
+    )
+  )
+  (func $pick0 (param i64) (result i64 i64)
+    (local.get 0) (local.get 0)
+  )
+  (func $pick1 (param i64 i64) (result i64 i64 i64)
+    (local.get 0) (local.get 1) (local.get 0)
+  )
+  (func (export "loop-fib") (param i32) (result i64)
+    (i64.const 0) (i64.const 1) (local.get 0)
+    (loop $l (param i64 i64 i32) (result i64)
+      (local.set 0)
+      (call $fib-step)
+      (local.get 0) (i32.const 1) (i32.sub)
+      (local.tee 0)
+      (br_if $l (i32.ne (local.get 0) (i32.const 0)))
+      (drop)
+      (drop)
+    )
+  )
+  (func $fib-step (param i64 i64) (result i64 i64)
+    (local.get 1) (i64.add (local.get 0) (local.get 1))
+  )
+
+  ;; Ifs
+
+  (func (export "if-results") (param i32) (result i32 i64)
+    (if (result i32 i64) (local.get 0)
+      (then (i32.const 1) (i64.const 2))
+      (else (i32.const 3) (i64.const 4))
+    )
+  )
+  (func (export "if-params") (param i32 i32 i32) (result i32)
+    (local.get 1) (local.get 2)
+    (if (param i32 i32) (result i32) (local.get 0)
+      (then (i32.add))
+      (else (i32.sub))
+    )
+  )
+  (func (export "if-params-results") (param i32) (result i32 i32)
+    (i32.const 5) (i32.const 6)
+    (if (param i32 i32) (result i32 i32) (local.get 0)
+      (then (call $swap))
+      (else (call $quad))
+    )
+  )
+  (func (export "if-br") (param i32) (result f32 i32)
+    (if (result f32 i32) (local.get 0)
+      (then (br 0 (f32.const 0.25) (i32.const 1)))
+      (else (f32.const -0.5) (i32.const 2))
+    )
+  )
+
+  ;; Returns
+
+  (func (export "return-value") (result i32 i64 f32)
+    (return (i32.const 1) (i64.const -2) (f32.const 3))
+  )
+  (func (export "return-nested") (param i32) (result i32 i32)
+    (block
+      (loop
+        (br_if 1 (i32.eqz (local.get 0)))
+        (return (local.get 0) (i32.const 99))
+      )
+    )
+    (i32.const 0) (i32.const 0)
+  )
+)
+
+(assert_return (invoke "value-i32-i64") (i32.const 1) (i64.const 2))
+(assert_return (invoke "value-i32-i32-i32") (i32.const 1) (i32.const 2) (i32.const 3))
+(assert_return (invoke "value-f32-f64") (f32.const 1.5) (f64.const -12))
+(assert_return (invoke "value-all") (i32.const -1) (i64.const 0x7fff_ffff_ffff_ffff) (f32.const -inf) (f64.const 0x1p-1074) (i32.const 5))
+(assert_return (invoke "value-v128-i32") (v128.const i32x4 1 2 3 4) (i32.const 5))
+(assert_return (invoke "param-pass" (i32.const 1) (i64.const 2) (f32.const 3.5) (f64.const 4.25)) (f64.const 4.25) (f32.const 3.5) (i64.const 2) (i32.const 1))
+(assert_return (invoke "param-pass" (i32.const -1) (i64.const -2) (f32.const -inf) (f64.const inf)) (f64.const inf) (f32.const -inf) (i64.const -2) (i32.const -1))
+
+(assert_return (invoke "swap" (i32.const 1) (i32.const 2)) (i32.const 2) (i32.const 1))
+(assert_return (invoke "swap-twice" (i32.const 1) (i32.const 2)) (i32.const 1) (i32.const 2))
+(assert_return (invoke "call-pair") (i64.const 8) (i32.const 7))
+(assert_return (invoke "call-sum") (i32.const 13))
+(assert_return (invoke "call-sub" (i32.const 3) (i32.const 10)) (i32.const 7))
+(assert_return (invoke "call-drop") (i32.const 9))
+(assert_return (invoke "call_indirect" (i32.const 1) (i32.const 5) (i32.const 6)) (i32.const 6) (i32.const 5))
+(assert_return (invoke "call_indirect" (i32.const 2) (i32.const 5) (i32.const 6)) (i32.const 20) (i32.const 24))
+(assert_trap (invoke "call_indirect" (i32.const 0) (i32.const 5) (i32.const 6)) "indirect call type mismatch")
+(assert_return (invoke "call_indirect-pair") (i32.const 7) (i64.const 8))
+
+(assert_return (invoke "block-results") (i32.const 1) (i64.const 2))
+(assert_return (invoke "block-params") (i32.const 3))
+(assert_return (invoke "block-params-id") (i32.const 1) (i32.const 2))
+(assert_return (invoke "block-type-index") (i32.const 16) (i32.const 20))
+(assert_return (invoke "block-nested") (i32.const 1) (i32.const 5) (i32.const 4))
+(assert_return (invoke "block-br" (i32.const 0)) (i32.const 30) (i64.const 40))
+(assert_return (invoke "block-br" (i32.const 1)) (i32.const 10) (i64.const 20))
+(assert_return (invoke "block-br-value") (i32.const 11) (f64.const 2.5))
+(assert_return (invoke "block-br-nested") (i32.const 12) (i32.const 13))
+(assert_return (invoke "block-br_if-value" (i32.const 0)) (i32.const 3) (i32.const 3))
+(assert_return (invoke "block-br_if-value" (i32.const 1)) (i32.const 1) (i32.const 2))
+(assert_return (invoke "block-br_table" (i32.const 0)) (i32.const 1) (i32.const 2))
+(assert_return (invoke "block-br_table" (i32.const 1)) (i32.const -1) (i32.const 200))
+(assert_return (invoke "block-br_table" (i32.const 2)) (i32.const 3) (i32.const 100))
+(assert_return (invoke "block-br_table" (i32.const 3)) (i32.const 3) (i32.const 100))
+(assert_return (invoke "block-return" (i32.const 0)) (i32.const 3) (i64.const 4))
+(assert_return (invoke "block-return" (i32.const 1)) (i32.const 1) (i64.const 2))
+
+(assert_return (invoke "loop-results") (i32.const 3) (i64.const 4))
+(assert_return (invoke "loop-params") (i32.const 3))
+(assert_return (invoke "loop-fac" (i64.const 1)) (i64.const 1))
+(assert_return (invoke "loop-fac" (i64.const 5)) (i64.const 120))
+(assert_return (invoke "loop-fac" (i64.const 25)) (i64.const 7034535277573963776))
+(assert_return (invoke "loop-fib" (i32.const 1)) (i64.const 1))
+(assert_return (invoke "loop-fib" (i32.const 2)) (i64.const 1))
+(assert_return (invoke "loop-fib" (i32.const 10)) (i64.const 55))
+(assert_return (invoke "loop-fib" (i32.const 90)) (i64.const 2880067194370816120))
+
+(assert_return (invoke "if-results" (i32.const 1)) (i32.const 1) (i64.const 2))
+(assert_return (invoke "if-results" (i32.const 0)) (i32.const 3) (i64.const 4))
+(assert_return (invoke "if-params" (i32.const 1) (i32.const 10) (i32.const 3)) (i32.const 13))
+(assert_return (invoke "if-params" (i32.const 0) (i32.const 10) (i32.const 3)) (i32.const 7))
+(assert_return (invoke "if-params-results" (i32.const 1)) (i32.const 6) (i32.const 5))
+(assert_return (invoke "if-params-results" (i32.const 0)) (i32.const 20) (i32.const 24))
+(assert_return (invoke "if-br" (i32.const 1)) (f32.const 0.25) (i32.const 1))
+(assert_return (invoke "if-br" (i32.const 0)) (f32.const -0.5) (i32.const 2))
+
+(assert_return (invoke "return-value") (i32.const 1) (i64.const -2) (f32.const 3))
+(assert_return (invoke "return-nested" (i32.const 0)) (i32.const 0) (i32.const 0))
+(assert_return (invoke "return-nested" (i32.const 7)) (i32.const 7) (i32.const 99))
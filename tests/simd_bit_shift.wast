@@ -0,0 +1,353 @@
+;; Tests for the shift operations
+
+(module
+  (func (export "i8x16.shl") (param v128 i32) (result v128) (i8x16.shl (local.get 0) (local.get 1)))
+  (func (export "i8x16.shr_s") (param v128 i32) (result v128) (i8x16.shr_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.shr_u") (param v128 i32) (result v128) (i8x16.shr_u (local.get 0) (local.get 1)))
+  (func (export "i16x8.shl") (param v128 i32) (result v128) (i16x8.shl (local.get 0) (local.get 1)))
+  (func (export "i16x8.shr_s") (param v128 i32) (result v128) (i16x8.shr_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.shr_u") (param v128 i32) (result v128) (i16x8.shr_u (local.get 0) (local.get 1)))
+  (func (export "i32x4.shl") (param v128 i32) (result v128) (i32x4.shl (local.get 0) (local.get 1)))
+  (func (export "i32x4.shr_s") (param v128 i32) (result v128) (i32x4.shr_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.shr_u") (param v128 i32) (result v128) (i32x4.shr_u (local.get 0) (local.get 1)))
+  (func (export "i64x2.shl") (param v128 i32) (result v128) (i64x2.shl (local.get 0) (local.get 1)))
+  (func (export "i64x2.shr_s") (param v128 i32) (result v128) (i64x2.shr_s (local.get 0) (local.get 1)))
+  (func (export "i64x2.shr_u") (param v128 i32) (result v128) (i64x2.shr_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 8)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 9)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 7)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 8)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 9)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 7)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 8)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 9)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i8x16 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 8)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 9)) (v128.const i8x16 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i8x16 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i8x16.shl" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 8)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 9)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 8)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 9)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 7)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 8)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 9)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 8)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 9)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 8)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 9)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 8)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 9)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 7)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 8)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 9)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 7)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 8)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 9)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.shr_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 16)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 17)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 15)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 16)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 17)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 15)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 16)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 17)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i16x8 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 16)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 17)) (v128.const i16x8 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i16x8 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i16x8.shl" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 16)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 17)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 16)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 17)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 15)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 16)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 17)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 16)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 17)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_s" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 16)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 17)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const 33)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 0)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 16)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 17)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const 33)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 0)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 15)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 16)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 17)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const 33)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (i32.const -1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 0)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 15)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 16)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 17)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const 33)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.shr_u" (v128.const i16x8 2 2 2 2 2 2 2 2) (i32.const -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 32)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 0 0 0 0) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 0)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 1)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 31)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 32)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 1 1 1 1) (i32.const -1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 1)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 31)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 32)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 -1 -1 -1 -1) (i32.const -1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 0)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 1)) (v128.const i32x4 4 4 4 4))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 32)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 4 4 4 4))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 4 4 4 4))
+(assert_return (invoke "i32x4.shl" (v128.const i32x4 2 2 2 2) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 32)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 0 0 0 0) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 0)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 32)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 1 1 1 1) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 31)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 32)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 -1 -1 -1 -1) (i32.const -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 0)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 32)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_s" (v128.const i32x4 2 2 2 2) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 32)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 0 0 0 0) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 0)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 32)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const 33)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 1 1 1 1) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 1)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 31)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 32)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const 33)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 -1 -1 -1 -1) (i32.const -1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 0)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 31)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 32)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const 33)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.shr_u" (v128.const i32x4 2 2 2 2) (i32.const -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 64)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 65)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 0 0) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 0)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 1)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 63)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 64)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 65)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const 33)) (v128.const i64x2 8589934592 8589934592))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 1 1) (i32.const -1)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 1)) (v128.const i64x2 -2 -2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 63)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 64)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 65)) (v128.const i64x2 -2 -2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const 33)) (v128.const i64x2 -8589934592 -8589934592))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 -1 -1) (i32.const -1)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 0)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 1)) (v128.const i64x2 4 4))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 64)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 65)) (v128.const i64x2 4 4))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const 33)) (v128.const i64x2 17179869184 17179869184))
+(assert_return (invoke "i64x2.shl" (v128.const i64x2 2 2) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 64)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 65)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 0 0) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 0)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 64)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 65)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 1 1) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 63)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 64)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 65)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const 33)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 -1 -1) (i32.const -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 0)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 64)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 65)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_s" (v128.const i64x2 2 2) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 64)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 65)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 0 0) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 0)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 64)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 65)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 1 1) (i32.const -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 1)) (v128.const i64x2 9223372036854775807 9223372036854775807))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 63)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 64)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 65)) (v128.const i64x2 9223372036854775807 9223372036854775807))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const 33)) (v128.const i64x2 2147483647 2147483647))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 -1 -1) (i32.const -1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 0)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 63)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 64)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 65)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const 33)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.shr_u" (v128.const i64x2 2 2) (i32.const -1)) (v128.const i64x2 0 0))
@@ -0,0 +1,101 @@
+;; Tests for the bitwise operations
+
+(module
+  (func (export "v128.not") (param v128) (result v128) (v128.not (local.get 0)))
+  (func (export "v128.and") (param v128 v128) (result v128) (v128.and (local.get 0) (local.get 1)))
+  (func (export "v128.or") (param v128 v128) (result v128) (v128.or (local.get 0) (local.get 1)))
+  (func (export "v128.xor") (param v128 v128) (result v128) (v128.xor (local.get 0) (local.get 1)))
+  (func (export "v128.andnot") (param v128 v128) (result v128) (v128.andnot (local.get 0) (local.get 1)))
+  (func (export "v128.bitselect") (param v128 v128 v128) (result v128) (v128.bitselect (local.get 0) (local.get 1) (local.get 2)))
+)
+
+(assert_return (invoke "v128.not" (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.not" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.not" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766))
+(assert_return (invoke "v128.not" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.not" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 1985229328 -19088744 1985229328 -19088744))
+(assert_return (invoke "v128.not" (v128.const i32x4 409632485 213242491 -83295056 -1102949915)) (v128.const i32x4 -409632486 -213242492 83295055 1102949914))
+(assert_return (invoke "v128.not" (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -642968107 1784423851 644470063 -496075260))
+(assert_return (invoke "v128.not" (v128.const i32x4 -208977753 -1152573742 2143120060 1765916298)) (v128.const i32x4 208977752 1152573741 -2143120061 -1765916299))
+(assert_return (invoke "v128.and" (v128.const i32x4 0 0 0 0) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.and" (v128.const i32x4 0 0 0 0) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.and" (v128.const i32x4 0 0 0 0) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 642968106 -1784423852 -644470064 496075259))
+(assert_return (invoke "v128.and" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.and" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 16860485 16860485 16860485 16860485))
+(assert_return (invoke "v128.and" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 72368128 352407636 1360265296 353435985))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -2002089814 2228258 -2002089814 2228258))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 570599978 -2136831488 -2004735360 142639274))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 16860485 16860485 16860485 16860485))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743))
+(assert_return (invoke "v128.and" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 182314 19087428 -1987966784 16843107))
+(assert_return (invoke "v128.and" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 272651333 68505681 1359021072 339759429))
+(assert_return (invoke "v128.and" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 136989925 2179171 -1995897696 147813))
+(assert_return (invoke "v128.and" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 4352544 77714000 -654311280 469762529))
+(assert_return (invoke "v128.or" (v128.const i32x4 0 0 0 0) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.or" (v128.const i32x4 0 0 0 0) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743))
+(assert_return (invoke "v128.or" (v128.const i32x4 0 0 0 0) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 642968106 -1784423852 -644470064 496075259))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.or" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.or" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -570434049 1433884023 -570434049 1433884023))
+(assert_return (invoke "v128.or" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 2002255743 -705175723 -573079595 1574295039))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1414795281 -1414795281 -1414795281 -1414795281))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1359287638 -1079248130 -71390470 -1078219781))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -570434049 1433884023 -570434049 1433884023))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743))
+(assert_return (invoke "v128.or" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1342443537 -1784422537 -641732609 498320895))
+(assert_return (invoke "v128.or" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1568636917 1576392575 -10660363 -11053579))
+(assert_return (invoke "v128.or" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1712586769 230152063 -72626689 -1084008985))
+(assert_return (invoke "v128.or" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 1048248047 -1648895361 -73453840 -1076637185))
+(assert_return (invoke "v128.xor" (v128.const i32x4 0 0 0 0) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765))
+(assert_return (invoke "v128.xor" (v128.const i32x4 0 0 0 0) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743))
+(assert_return (invoke "v128.xor" (v128.const i32x4 0 0 0 0) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 642968106 -1784423852 -644470064 496075259))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 1985229328 -19088744 1985229328 -19088744))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -642968107 1784423851 644470063 -496075260))
+(assert_return (invoke "v128.xor" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.xor" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -587294534 1417023538 -587294534 1417023538))
+(assert_return (invoke "v128.xor" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 1929887615 -1057583359 -1933344891 1220859054))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 587294533 -1417023539 587294533 -1417023539))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1929887616 1057583358 1933344890 -1220859055))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -587294534 1417023538 -587294534 1417023538))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.xor" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1342625851 -1803509965 1346234175 481477788))
+(assert_return (invoke "v128.xor" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 1295985584 1507886894 -1369681435 -350813008))
+(assert_return (invoke "v128.xor" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 -1849576694 227972892 1923271007 -1084156798))
+(assert_return (invoke "v128.xor" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 1043895503 -1726609361 580857440 -1546399714))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 0 0 0 0) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 0 0 0 0) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 0 0 0 0) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 1985229328 -19088744 1985229328 -19088744))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -642968107 1784423851 644470063 -496075260))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 1414795280 1414795280 1414795280 1414795280))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 1431655765 1431655765 1431655765 1431655765) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 1359287637 1079248129 71390469 1078219780))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 570434048 -1433884024 570434048 -1433884024))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1431655766 -1431655766 -1431655766 -1431655766) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -2002255744 705175722 573079594 -1574295040))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 -2002089814 2228258 -2002089814 2228258))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 -1985229329 19088743 -1985229329 19088743) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 -1985411643 1315 2737455 2245636))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 1431655765 1431655765 1431655765 1431655765)) (v128.const i32x4 136981152 144736810 -1442316128 -1442709344))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 -1985229329 19088743 -1985229329 19088743)) (v128.const i32x4 272642560 211063320 1912602640 -1103097728))
+(assert_return (invoke "v128.andnot" (v128.const i32x4 409632485 213242491 -83295056 -1102949915) (v128.const i32x4 642968106 -1784423852 -644470064 496075259)) (v128.const i32x4 405279941 135528491 571016224 -1572712444))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 -1462475376 -239801462 729961746 -1279420039) (v128.const i32x4 738582883 274034257 410840667 -222281333) (v128.const i16x8 -12817 -30293 17767 291 -12817 -30293 17767 291)) (v128.const i32x4 -1400609408 292842258 433481490 -203357719))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 219308271 -1972081492 -1718972753 1536977190) (v128.const i32x4 1833198708 559706479 -2100297455 -670059406) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 219308271 -1972081492 -1718972753 1536977190))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 -711086425 1577412061 608221909 -649440498) (v128.const i32x4 -1885373343 1746089491 -562668227 640623073) (v128.const i16x8 7949 24835 2770 5882 -8171 -5022 -18760 23413)) (v128.const i32x4 -811766171 2114008273 911523133 2102006601))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 -336413924 -1699433467 1748339873 2082385969) (v128.const i32x4 654376977 -1512322691 927816845 1057014676) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i32x4 654376977 -1512322691 927816845 1057014676))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 999297977 109634396 -1670773860 -997231669) (v128.const i32x4 1641866164 867736530 1707579463 -1395638888) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i32x4 1641866164 867736530 1707579463 -1395638888))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 -195993078 -1163217155 -1155239786 2026336319) (v128.const i32x4 1247030733 -1178715844 -1597401040 197547764) (v128.const i16x8 -5590 9810 -9644 -27229 10960 -9834 -32261 7569)) (v128.const i32x4 1817470927 -1195461764 -1186090832 449271359))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 2013175374 689309153 -1995727396 -1410124447) (v128.const i32x4 -1223174685 68396571 1794405531 374064082) (v128.const i16x8 25905 502 -1180 -31570 -25115 28927 -7710 -7688)) (v128.const i32x4 -1208511294 1508731 168558046 -1208802448))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 889645274 -2120490585 -1447011589 -1086929816) (v128.const i32x4 -224534575 -1774412550 385496419 -1161890141) (v128.const i16x8 21845 21845 21845 21845 21845 21845 21845 21845)) (v128.const i32x4 -1215509808 -2093364817 65695859 -1078008094))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 84896781 2098920905 936633337 -588917111) (v128.const i32x4 -118213524 -594828168 -1678667759 -1308213348) (v128.const i16x8 16551 -3189 7890 -17587 27324 32701 -16758 26945)) (v128.const i32x4 159347789 2106244328 -1210977607 -632842340))
+(assert_return (invoke "v128.bitselect" (v128.const i32x4 -1294608218 1597277593 -2070679110 -25548524) (v128.const i32x4 837608666 -346650025 -1605925643 -1891824636) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 -1294608218 1597277593 -2070679110 -25548524))
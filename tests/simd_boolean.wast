@@ -0,0 +1,100 @@
+;; Tests for the any_true, all_true and bitmask operations
+
+(module
+  (func (export "v128.any_true") (param v128) (result i32) (v128.any_true (local.get 0)))
+  (func (export "i8x16.all_true") (param v128) (result i32) (i8x16.all_true (local.get 0)))
+  (func (export "i8x16.bitmask") (param v128) (result i32) (i8x16.bitmask (local.get 0)))
+  (func (export "i16x8.all_true") (param v128) (result i32) (i16x8.all_true (local.get 0)))
+  (func (export "i16x8.bitmask") (param v128) (result i32) (i16x8.bitmask (local.get 0)))
+  (func (export "i32x4.all_true") (param v128) (result i32) (i32x4.all_true (local.get 0)))
+  (func (export "i32x4.bitmask") (param v128) (result i32) (i32x4.bitmask (local.get 0)))
+  (func (export "i64x2.all_true") (param v128) (result i32) (i64x2.all_true (local.get 0)))
+  (func (export "i64x2.bitmask") (param v128) (result i32) (i64x2.bitmask (local.get 0)))
+)
+
+(assert_return (invoke "v128.any_true" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "v128.any_true" (v128.const i8x16 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (i32.const 1))
+(assert_return (invoke "v128.any_true" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 -128)) (i32.const 1))
+(assert_return (invoke "v128.any_true" (v128.const i8x16 0 0 0 0 0 0 0 0 1 0 0 0 0 0 0 0)) (i32.const 1))
+(assert_return (invoke "v128.any_true" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 1))
+(assert_return (invoke "v128.any_true" (v128.const i8x16 115 22 -9 -50 -11 -105 -29 96 -111 25 -79 -49 -70 106 -9 -92)) (i32.const 1))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 65535))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (i32.const 0))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 0 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 0))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 0 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 65534))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (i32.const 65535))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 4 5 5 4 5 5 4 5 5 4 5 5 4 5 5 4)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 4 5 5 4 5 5 4 5 5 4 5 5 4 5 5 4)) (i32.const 0))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 94 -128 55 26 -18 -5 116 15 -57 50 66 -13 -54 -112 62 89)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 94 -128 55 26 -18 -5 116 15 -57 50 66 -13 -54 -112 62 89)) (i32.const 14642))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 -125 -56 -22 -5 82 -90 48 -32 -73 86 59 -8 17 89 26 3)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 -125 -56 -22 -5 82 -90 48 -32 -73 86 59 -8 17 89 26 3)) (i32.const 2479))
+(assert_return (invoke "i8x16.all_true" (v128.const i8x16 -98 110 -113 -41 -23 29 96 97 -81 120 -22 -105 71 48 -38 -88)) (i32.const 1))
+(assert_return (invoke "i8x16.bitmask" (v128.const i8x16 -98 110 -113 -41 -23 29 96 97 -81 120 -22 -105 71 48 -38 -88)) (i32.const 52509))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 0 0 0 0 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 0 0 0 0 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (i32.const 255))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 1 1 1 1 1 1 1 1)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 1 1 1 1 1 1 1 1)) (i32.const 0))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 1 1 1 1 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 1 1 1 1 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 0 -1 -1 -1 -1 -1 -1 -1)) (i32.const 0))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 0 -1 -1 -1 -1 -1 -1 -1)) (i32.const 254))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (i32.const 255))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 4 5 5 4 5 5 4 5)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 4 5 5 4 5 5 4 5)) (i32.const 0))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 -20706 -7879 2723 -31780 -1873 29910 -12598 -17815)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 -20706 -7879 2723 -31780 -1873 29910 -12598 -17815)) (i32.const 219))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 -7558 27931 -10426 -24351 -11160 -22866 23484 6106)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 -7558 27931 -10426 -24351 -11160 -22866 23484 6106)) (i32.const 61))
+(assert_return (invoke "i16x8.all_true" (v128.const i16x8 13264 -11571 4201 -22022 30052 25391 20585 21354)) (i32.const 1))
+(assert_return (invoke "i16x8.bitmask" (v128.const i16x8 13264 -11571 4201 -22022 30052 25391 20585 21354)) (i32.const 10))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 0 0 0 0)) (i32.const 0))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 -1 -1 -1 -1)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 -1 -1 -1 -1)) (i32.const 15))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 1 1 1 1)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 1 1 1 1)) (i32.const 0))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 1 1 1 0)) (i32.const 0))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 0 -1 -1 -1)) (i32.const 0))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 0 -1 -1 -1)) (i32.const 14))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (i32.const 15))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 4 5 5 4)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 4 5 5 4)) (i32.const 0))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 515660738 -1047236882 948079224 -1869352555)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 515660738 -1047236882 948079224 -1869352555)) (i32.const 10))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 1918934822 -762222757 700070995 -918389457)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 1918934822 -762222757 700070995 -918389457)) (i32.const 10))
+(assert_return (invoke "i32x4.all_true" (v128.const i32x4 438910587 988557572 246213737 -1080708974)) (i32.const 1))
+(assert_return (invoke "i32x4.bitmask" (v128.const i32x4 438910587 988557572 246213737 -1080708974)) (i32.const 8))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 0 0)) (i32.const 0))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 0 0)) (i32.const 0))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 -1 -1)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 -1 -1)) (i32.const 3))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 1 1)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 1 1)) (i32.const 0))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 1 0)) (i32.const 0))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 1 0)) (i32.const 0))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 0 -1)) (i32.const 0))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 0 -1)) (i32.const 2))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (i32.const 3))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 4 5)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 4 5)) (i32.const 0))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 -8069774871024365223 -4053495486855573797)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 -8069774871024365223 -4053495486855573797)) (i32.const 3))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 -5270589320014383755 5752938432552735230)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 -5270589320014383755 5752938432552735230)) (i32.const 1))
+(assert_return (invoke "i64x2.all_true" (v128.const i64x2 -2007358562219712063 -6393692695730860330)) (i32.const 1))
+(assert_return (invoke "i64x2.bitmask" (v128.const i64x2 -2007358562219712063 -6393692695730860330)) (i32.const 3))
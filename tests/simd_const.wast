@@ -0,0 +1,37 @@
+;; Tests for v128.const
+
+(module
+  (func (export "const-0") (result v128) (v128.const i8x16 0xFF 0xFE 0x80 0x7F 0 1 -1 -128 127 255 0x10 0x20 0x30 0x40 0x50 0x60))
+  (func (export "const-1") (result v128) (v128.const i16x8 0xFFFF -32768 32767 65535 0x1234 -1 0 1))
+  (func (export "const-2") (result v128) (v128.const i32x4 0xFFFFFFFF -2147483648 2147483647 0x12345678))
+  (func (export "const-3") (result v128) (v128.const i32x4 1_000_000 -1_000 0x1_0000 0))
+  (func (export "const-4") (result v128) (v128.const i64x2 0xFFFFFFFFFFFFFFFF -9223372036854775808))
+  (func (export "const-5") (result v128) (v128.const i64x2 9223372036854775807 0x0123456789ABCDEF))
+  (func (export "const-6") (result v128) (v128.const f32x4 0.0 -0.0 1.0 -1.5))
+  (func (export "const-7") (result v128) (v128.const f32x4 inf -inf 0x1p-149 0x1.fffffep127))
+  (func (export "const-8") (result v128) (v128.const f32x4 nan -nan nan:0x200000 -nan:0x1))
+  (func (export "const-9") (result v128) (v128.const f32x4 0x1.8p+1 1e10 -1e-10 0.1))
+  (func (export "const-10") (result v128) (v128.const f64x2 0.0 -0.0))
+  (func (export "const-11") (result v128) (v128.const f64x2 1.5 -2.25))
+  (func (export "const-12") (result v128) (v128.const f64x2 inf -inf))
+  (func (export "const-13") (result v128) (v128.const f64x2 0x1p-1074 0x1.fffffffffffffp1023))
+  (func (export "const-14") (result v128) (v128.const f64x2 nan:0x8000000000000 -nan:0x1))
+  (func (export "const-15") (result v128) (v128.const f64x2 123456789.125 1e-300))
+)
+
+(assert_return (invoke "const-0") (v128.const i32x4 2139160319 -2130771712 537984895 1615872048))
+(assert_return (invoke "const-1") (v128.const i32x4 -2147418113 -32769 -60876 65536))
+(assert_return (invoke "const-2") (v128.const i32x4 -1 -2147483648 2147483647 305419896))
+(assert_return (invoke "const-3") (v128.const i32x4 1000000 -1000 65536 0))
+(assert_return (invoke "const-4") (v128.const i32x4 -1 -1 0 -2147483648))
+(assert_return (invoke "const-5") (v128.const i32x4 -1 2147483647 -1985229329 19088743))
+(assert_return (invoke "const-6") (v128.const i32x4 0 -2147483648 1065353216 -1077936128))
+(assert_return (invoke "const-7") (v128.const i32x4 2139095040 -8388608 1 2139095039))
+(assert_return (invoke "const-8") (v128.const i32x4 2143289344 -4194304 2141192192 -8388607))
+(assert_return (invoke "const-9") (v128.const i32x4 1077936128 1343554297 -1361320193 1036831949))
+(assert_return (invoke "const-10") (v128.const i32x4 0 0 0 -2147483648))
+(assert_return (invoke "const-11") (v128.const i32x4 0 1073217536 0 -1073610752))
+(assert_return (invoke "const-12") (v128.const i32x4 0 2146435072 0 -1048576))
+(assert_return (invoke "const-13") (v128.const i32x4 1 0 -1 2146435071))
+(assert_return (invoke "const-14") (v128.const i32x4 0 2146959360 1 -1048576))
+(assert_return (invoke "const-15") (v128.const i32x4 1417674752 1100836660 -1023872167 27618847))
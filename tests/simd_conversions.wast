@@ -0,0 +1,115 @@
+;; Tests for the conversion and narrowing operations
+
+(module
+  (func (export "f32x4.convert_i32x4_s") (param v128) (result v128) (f32x4.convert_i32x4_s (local.get 0)))
+  (func (export "f64x2.convert_low_i32x4_s") (param v128) (result v128) (f64x2.convert_low_i32x4_s (local.get 0)))
+  (func (export "f32x4.convert_i32x4_u") (param v128) (result v128) (f32x4.convert_i32x4_u (local.get 0)))
+  (func (export "f64x2.convert_low_i32x4_u") (param v128) (result v128) (f64x2.convert_low_i32x4_u (local.get 0)))
+  (func (export "f32x4.demote_f64x2_zero") (param v128) (result v128) (f32x4.demote_f64x2_zero (local.get 0)))
+  (func (export "f64x2.promote_low_f32x4") (param v128) (result v128) (f64x2.promote_low_f32x4 (local.get 0)))
+  (func (export "i8x16.narrow_i16x8_s") (param v128 v128) (result v128) (i8x16.narrow_i16x8_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.narrow_i16x8_u") (param v128 v128) (result v128) (i8x16.narrow_i16x8_u (local.get 0) (local.get 1)))
+  (func (export "i16x8.narrow_i32x4_s") (param v128 v128) (result v128) (i16x8.narrow_i32x4_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.narrow_i32x4_u") (param v128 v128) (result v128) (i16x8.narrow_i32x4_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 0 0 0 0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 1 1 1 1)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 -1 -1 -1 -1)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 2 2 2 2)) (v128.const f32x4 2.0 2.0 2.0 2.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 -2147483647 0 -2 172734025)) (v128.const f32x4 -2147483648.0 0.0 -2.0 172734032.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 -1737118883 1 -1 -1)) (v128.const f32x4 -1737118848.0 1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 2 -2147483648 522656183 1918493956)) (v128.const f32x4 2.0 -2147483648.0 522656192.0 1918493952.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 -1630428315 -2 794642925 1158763395)) (v128.const f32x4 -1630428288.0 -2.0 794642944.0 1158763392.0))
+(assert_return (invoke "f32x4.convert_i32x4_s" (v128.const i32x4 16777217 -16777217 2147483583 2147483584)) (v128.const f32x4 16777216.0 -16777216.0 2147483520.0 2147483648.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 0 0 0 0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 1 1 1 1)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 -1 -1 -1 -1)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 2 2 2 2)) (v128.const f64x2 2.0 2.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 -2147483647 0 -2 172734025)) (v128.const f64x2 -2147483647.0 0.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 -1737118883 1 -1 -1)) (v128.const f64x2 -1737118883.0 1.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 2 -2147483648 522656183 1918493956)) (v128.const f64x2 2.0 -2147483648.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 -1630428315 -2 794642925 1158763395)) (v128.const f64x2 -1630428315.0 -2.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_s" (v128.const i32x4 16777217 -16777217 2147483583 2147483584)) (v128.const f64x2 16777217.0 -16777217.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 0 0 0 0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 1 1 1 1)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 -1 -1 -1 -1)) (v128.const f32x4 4294967296.0 4294967296.0 4294967296.0 4294967296.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 2 2 2 2)) (v128.const f32x4 2.0 2.0 2.0 2.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 -2147483647 0 -2 172734025)) (v128.const f32x4 2147483648.0 0.0 4294967296.0 172734032.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 -1737118883 1 -1 -1)) (v128.const f32x4 2557848320.0 1.0 4294967296.0 4294967296.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 2 -2147483648 522656183 1918493956)) (v128.const f32x4 2.0 2147483648.0 522656192.0 1918493952.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 -1630428315 -2 794642925 1158763395)) (v128.const f32x4 2664538880.0 4294967296.0 794642944.0 1158763392.0))
+(assert_return (invoke "f32x4.convert_i32x4_u" (v128.const i32x4 16777217 -16777217 2147483583 2147483584)) (v128.const f32x4 16777216.0 4278190080.0 2147483520.0 2147483648.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 0 0 0 0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 1 1 1 1)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 -1 -1 -1 -1)) (v128.const f64x2 4294967295.0 4294967295.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 2 2 2 2)) (v128.const f64x2 2.0 2.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 -2147483647 0 -2 172734025)) (v128.const f64x2 2147483649.0 0.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 -1737118883 1 -1 -1)) (v128.const f64x2 2557848413.0 1.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 2 -2147483648 522656183 1918493956)) (v128.const f64x2 2.0 2147483648.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 -1630428315 -2 794642925 1158763395)) (v128.const f64x2 2664538981.0 4294967294.0))
+(assert_return (invoke "f64x2.convert_low_i32x4_u" (v128.const i32x4 16777217 -16777217 2147483583 2147483584)) (v128.const f64x2 16777217.0 4278190079.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 0.0 -0.0)) (v128.const f32x4 0.0 -0.0 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 1.0 -1.0)) (v128.const f32x4 1.0 -1.0 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 0.5 -0.5)) (v128.const f32x4 0.5 -0.5 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 1.5 -1.5)) (v128.const f32x4 1.5 -1.5 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 2.5 -2.5)) (v128.const f32x4 2.5 -2.5 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 3.0 -3.5)) (v128.const f32x4 3.0 -3.5 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 0.1 -123456.789)) (v128.const f32x4 0.10000000149011612 -123456.7890625 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f32x4 10000000000.0 -1.000000013351432e-10 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 inf -inf)) (v128.const f32x4 inf -inf 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f32x4 inf -inf 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 -5e-324 -1.987326468977245e-07)) (v128.const f32x4 -0.0 -1.9873264989200834e-07 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 nan 0.00019026399941902346)) (v128.const f32x4 nan:arithmetic 0.0001902639924082905 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 1e+300 1.0000000009313226)) (v128.const f32x4 inf 1.0 0.0 0.0))
+(assert_return (invoke "f32x4.demote_f64x2_zero" (v128.const f64x2 -1e-300 1.0000000596046448)) (v128.const f32x4 -0.0 1.0 0.0 0.0))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f64x2 0.5 -0.5))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f64x2 2.5 -2.5))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f64x2 0.10000000149011612 -123456.7890625))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f64x2 inf -inf))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -94919.0625)) (v128.const f64x2 1.1754943508222875e-38 1.401298464324817e-45))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 0.4029032588005066 2.8888299465179443 3.4028234663852886e+38 -2.7065977974416455e-06)) (v128.const f64x2 0.4029032588005066 2.8888299465179443))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 5.395770131144673e-06 437.1799011230469 -15.925496101379395 0.5)) (v128.const f64x2 5.395770131144673e-06 437.1799011230469))
+(assert_return (invoke "f64x2.promote_low_f32x4" (v128.const f32x4 nan -3.197056685166899e-06 4688.46484375 -382.8679504394531)) (v128.const f64x2 nan:arithmetic -3.197056685166899e-06))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 127 127 127 127 127 127 127 127 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -27807 -28173 1 -25932 -12282 11960 23812 2) (v128.const i16x8 -31031 -32767 -1 -8666 -16209 -32768 0 1)) (v128.const i8x16 -128 -128 1 -128 -128 127 127 2 -128 -128 -1 -128 -128 -128 0 1))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -32767 17467 16384 7769 -32767 2 85 1648) (v128.const i16x8 -2 3214 8955 85 -30220 5383 0 -22881)) (v128.const i8x16 -128 127 127 127 -128 2 85 127 -2 127 127 85 -128 127 0 -128))
+(assert_return (invoke "i8x16.narrow_i16x8_s" (v128.const i16x8 -18372 6033 32766 -29731 -26757 27623 2 -18429) (v128.const i16x8 -24468 -1 -1 1 -16281 2056 -11139 25305)) (v128.const i8x16 -128 127 127 -128 -128 127 2 -128 -128 -1 -1 1 -128 127 -128 127))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 -2711 -32767 2 11266 2 32767 -1 16384) (v128.const i16x8 498 85 1 -32768 11958 -4272 28250 -10276)) (v128.const i8x16 0 0 2 -1 2 -1 0 -1 -1 85 1 0 -1 0 -1 0))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 0 30111 -2 85 -32483 -27476 -1 -2) (v128.const i16x8 23831 -32768 0 14347 -2 85 32766 1793)) (v128.const i8x16 0 -1 0 85 0 0 0 0 -1 0 0 -1 0 85 -1 -1))
+(assert_return (invoke "i8x16.narrow_i16x8_u" (v128.const i16x8 -720 0 -32768 -16384 11879 -11721 32766 -20565) (v128.const i16x8 10968 16384 24505 32767 -19704 2 18241 -8026)) (v128.const i8x16 0 0 0 0 -1 0 -1 0 -1 -1 -1 -1 0 2 -1 0))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 32767 32767 32767 32767 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 1443000415 -1413165054 2147483647 1) (v128.const i32x4 -250132433 2 -1073741824 -2147483647)) (v128.const i16x8 32767 -32768 32767 1 -32768 2 -32768 -32768))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 -2 -2147483647 2147483646 1020338799) (v128.const i32x4 1972166050 2147483647 1073741824 1409357865)) (v128.const i16x8 -2 -32768 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.narrow_i32x4_s" (v128.const i32x4 1585650750 637640270 2 1939984959) (v128.const i32x4 -1162385130 2147483647 -1796713851 85)) (v128.const i16x8 32767 32767 2 32767 -32768 32767 -32768 85))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 0 0 0 0 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 1 1 1 1))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 -1125886318 397374113 2683779 -1) (v128.const i32x4 -2014885115 0 753165989 -2147483648)) (v128.const i16x8 0 -1 -1 0 0 0 -1 0))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 -1757680305 -1702313838 300453538 -2147483647) (v128.const i32x4 -176305331 410042699 2147483647 -2)) (v128.const i16x8 0 0 -1 0 0 -1 -1 0))
+(assert_return (invoke "i16x8.narrow_i32x4_u" (v128.const i32x4 1518285332 -1062220262 262441067 2147483646) (v128.const i32x4 -382901398 1085669648 2147483646 2147483646)) (v128.const i16x8 -1 0 -1 -1 0 -1 -1 -1))
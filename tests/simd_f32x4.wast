@@ -0,0 +1,53 @@
+;; Tests for f32x4 min, max, abs and neg
+
+(module
+  (func (export "f32x4.min") (param v128 v128) (result v128) (f32x4.min (local.get 0) (local.get 1)))
+  (func (export "f32x4.max") (param v128 v128) (result v128) (f32x4.max (local.get 0) (local.get 1)))
+  (func (export "f32x4.abs") (param v128) (result v128) (f32x4.abs (local.get 0)))
+  (func (export "f32x4.neg") (param v128) (result v128) (f32x4.neg (local.get 0)))
+)
+
+(assert_return (invoke "f32x4.min" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 -inf -inf -inf -inf))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.25 0.25 0.25 0.25))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 1.4707022905349731 -1.669422573513657e-07 -3.4028234663852886e+38 864652288.0) (v128.const f32x4 -123456.7890625 1.1754943508222875e-38 -3.4028234663852886e+38 0.001931308303028345)) (v128.const f32x4 -123456.7890625 -1.669422573513657e-07 -3.4028234663852886e+38 0.001931308303028345))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 -128540032.0 -1.401298464324817e-45 6.0515094446600415e-06 0.5) (v128.const f32x4 1.401298464324817e-45 -0.1533842384815216 -12893354.0 1323.7506103515625)) (v128.const f32x4 -128540032.0 -0.1533842384815216 -12893354.0 0.5))
+(assert_return (invoke "f32x4.min" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.5 0.5 0.5 0.5))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 1.5 1.5 1.5 1.5))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 1.401298464324817e-45 333775616.0 1.9422227381937773e-08 -1.3214400951255811e-07) (v128.const f32x4 -1.2151806672022758e-08 68416672.0 -2.5 1.401298464324817e-45)) (v128.const f32x4 1.401298464324817e-45 333775616.0 1.9422227381937773e-08 1.401298464324817e-45))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 -49859488.0 -4.2072234585077695e-09 -1.5 231.9710693359375) (v128.const f32x4 1.1754943508222875e-38 -0.014267672784626484 -2.4031622409820557 1.1754943508222875e-38)) (v128.const f32x4 1.1754943508222875e-38 -4.2072234585077695e-09 -1.5 231.9710693359375))
+(assert_return (invoke "f32x4.max" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 0.0 1.0 1.0))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 0.5 0.5 1.5 1.5))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 2.5 2.5 3.0 3.5))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 0.10000000149011612 123456.7890625 10000000000.0 1.000000013351432e-10))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf inf 3.4028234663852886e+38 3.4028234663852886e+38))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 18865.93359375)) (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 1.401298464324817e-45 18865.93359375))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 0.0009588952525518835 -2.9535123236001937e-09 -0.33665814995765686 1.330999732017517)) (v128.const f32x4 0.0009588952525518835 2.9535123236001937e-09 0.33665814995765686 1.330999732017517))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 -29.09580421447754 -3295.871337890625 0.10000000149011612 inf)) (v128.const f32x4 29.09580421447754 3295.871337890625 0.10000000149011612 inf))
+(assert_return (invoke "f32x4.abs" (v128.const f32x4 nan -3.4051986403937917e-06 2.6245221107501493e-08 -0.4953644871711731)) (v128.const f32x4 nan 3.4051986403937917e-06 2.6245221107501493e-08 0.4953644871711731))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 -0.0 0.0 -1.0 1.0))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 -0.5 0.5 -1.5 1.5))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 -2.5 2.5 -3.0 3.5))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 -0.10000000149011612 123456.7890625 -10000000000.0 1.000000013351432e-10))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 -inf inf -3.4028234663852886e+38 3.4028234663852886e+38))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -0.00015492626698687673)) (v128.const f32x4 -1.1754943508222875e-38 -1.401298464324817e-45 1.401298464324817e-45 0.00015492626698687673))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 3.6043739318847656 2.0254142896192207e-07 -3.5 -1.019387354972423e-06)) (v128.const f32x4 -3.6043739318847656 -2.0254142896192207e-07 3.5 1.019387354972423e-06))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 -1.1474400707811583e-05 2.542794597104603e-08 -0.0 2519.0869140625)) (v128.const f32x4 1.1474400707811583e-05 -2.542794597104603e-08 0.0 -2519.0869140625))
+(assert_return (invoke "f32x4.neg" (v128.const f32x4 nan -8.502443313598633 -1.2678633698470776e-09 24022.03515625)) (v128.const f32x4 -nan 8.502443313598633 1.2678633698470776e-09 -24022.03515625))
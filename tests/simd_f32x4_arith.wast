@@ -0,0 +1,71 @@
+;; Tests for f32x4 arithmetic operations
+
+(module
+  (func (export "f32x4.add") (param v128 v128) (result v128) (f32x4.add (local.get 0) (local.get 1)))
+  (func (export "f32x4.sub") (param v128 v128) (result v128) (f32x4.sub (local.get 0) (local.get 1)))
+  (func (export "f32x4.mul") (param v128 v128) (result v128) (f32x4.mul (local.get 0) (local.get 1)))
+  (func (export "f32x4.div") (param v128 v128) (result v128) (f32x4.div (local.get 0) (local.get 1)))
+  (func (export "f32x4.sqrt") (param v128) (result v128) (f32x4.sqrt (local.get 0)))
+)
+
+(assert_return (invoke "f32x4.add" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 2.0 2.0 2.0 2.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.75 0.75 0.75 0.75))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 -57.84525680541992 0.0018462489824742079 -3.5 993487744.0) (v128.const f32x4 -1.000000013351432e-10 410.6671142578125 10000000000.0 113.37589263916016)) (v128.const f32x4 -57.84525680541992 410.6689453125 10000000000.0 993487872.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 -0.0 -1329957888.0 -8.874500849742617e-07 -1.000000013351432e-10) (v128.const f32x4 -0.5 0.10000000149011612 -0.04145194590091705 -25060014.0)) (v128.const f32x4 -0.5 -1329957888.0 -0.04145283252000809 -25060014.0))
+(assert_return (invoke "f32x4.add" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 2.0 2.0 2.0 2.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.25 0.25 0.25 0.25))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 4.0 4.0 4.0 4.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 1.401298464324817e-45 -3.0588490962982178 -1.0154522897209972e-05 -263172416.0) (v128.const f32x4 -473.17498779296875 inf -5.693721494282045e-09 1.1754943508222875e-38)) (v128.const f32x4 473.17498779296875 -inf -1.0148829460376874e-05 -263172416.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 1.4863866582004448e-08 0.0016056873137131333 -11774.9375 3.4028234663852886e+38) (v128.const f32x4 -1.909190058708191 733449.5625 -65453.796875 3.4028234663852886e+38)) (v128.const f32x4 1.909190058708191 -733449.5625 53678.859375 0.0))
+(assert_return (invoke "f32x4.sub" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 -inf -inf -inf -inf))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.125 0.125 0.125 0.125))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 -3.75 -3.75 -3.75 -3.75))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 22819.51171875 -0.06140035763382912 -22687560.0 1.0) (v128.const f32x4 27010000.0 1.5171738596109208e-05 -14.064592361450195 2.04053121706238e-05)) (v128.const f32x4 616355004416.0 -9.315501756645972e-07 319091296.0 2.04053121706238e-05))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 -0.008563946932554245 0.020818758755922318 4.8189598977899095e-09 -1.2556507726912969e-06) (v128.const f32x4 -1.1692059542767197e-09 0.0007587138097733259 -1.000000013351432e-10 155884416.0)) (v128.const f32x4 1.0013017325005702e-11 1.57954800670268e-05 -4.818959861289989e-19 -195.73638916015625))
+(assert_return (invoke "f32x4.mul" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 2.0 2.0 2.0 2.0))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 -0.6000000238418579 -0.6000000238418579 -0.6000000238418579 -0.6000000238418579))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 1.0000000200408773e+20 1.0000000200408773e+20 1.0000000200408773e+20 1.0000000200408773e+20))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 0.0 21589.96484375 5.561312675476074 -3.1605632305145264) (v128.const f32x4 -0.011490455828607082 -847815.125 inf -2.5)) (v128.const f32x4 -0.0 -0.02546541579067707 0.0 1.2642252445220947))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 3.4028234663852886e+38 -5077795.0 90344.453125 43.529354095458984) (v128.const f32x4 -1.6068663597106934 -40212556.0 -6.911186218261719 -6.531474916471325e-09)) (v128.const f32x4 -2.117676651160661e+38 0.12627387046813965 -13072.2060546875 -6664551936.0))
+(assert_return (invoke "f32x4.div" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan:arithmetic nan:arithmetic nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 -0.0 1.0 nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 0.7071067690849304 nan:arithmetic 1.2247449159622192 nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 1.5811388492584229 nan:arithmetic 1.7320507764816284 nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 0.3162277638912201 nan:arithmetic 100000.0 nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf nan:arithmetic 1.8446742974197924e+19 nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -1.7287998810289196e-09)) (v128.const f32x4 1.0842021724855044e-19 3.743392066509216e-23 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 inf 1.4098687171936035 -123456.7890625 831955.25)) (v128.const f32x4 inf 1.1873788833618164 nan:arithmetic 912.1157836914062))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 -1.0 -969.1177368164062 3.0 1.6015441417694092)) (v128.const f32x4 nan:arithmetic nan:arithmetic 1.7320507764816284 1.2655212879180908))
+(assert_return (invoke "f32x4.sqrt" (v128.const f32x4 nan 0.0007125322590582073 419012.875 0.4324679672718048)) (v128.const f32x4 nan:arithmetic 0.026693299412727356 647.31201171875 0.6576229929924011))
@@ -0,0 +1,89 @@
+;; Tests for f32x4 comparison operations
+
+(module
+  (func (export "f32x4.eq") (param v128 v128) (result v128) (f32x4.eq (local.get 0) (local.get 1)))
+  (func (export "f32x4.ne") (param v128 v128) (result v128) (f32x4.ne (local.get 0) (local.get 1)))
+  (func (export "f32x4.lt") (param v128 v128) (result v128) (f32x4.lt (local.get 0) (local.get 1)))
+  (func (export "f32x4.gt") (param v128 v128) (result v128) (f32x4.gt (local.get 0) (local.get 1)))
+  (func (export "f32x4.le") (param v128 v128) (result v128) (f32x4.le (local.get 0) (local.get 1)))
+  (func (export "f32x4.ge") (param v128 v128) (result v128) (f32x4.ge (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 3.0 3.8716325759887695 0.0006822285940870643 755883.5) (v128.const f32x4 2.1693455209970125e-07 -8.316525281770737e-07 -21.268402099609375 -0.5)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 -107644.421875 318.0020751953125 63.36998748779297 -1.5) (v128.const f32x4 10000000000.0 0.5 2210345.0 64.20650482177734)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.eq" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 9.490420183055903e-08 -13969831.0 -132548.953125 12614105.0) (v128.const f32x4 -1626464.5 -0.0025201598182320595 -0.003283632220700383 10000000000.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 -2.5 1.5 -41091344.0 10687959.0) (v128.const f32x4 245233.046875 -0.013612319715321064 10000000000.0 -122.58027648925781)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ne" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 -1.2458998810416233e-07 0.014256194233894348 1.1781183140158191e-08 -116033.6640625) (v128.const f32x4 -0.0 25.03079605102539 5.912172973410179e-09 -112602.3984375)) (v128.const i32x4 -1 -1 0 -1))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 2.5 -0.41013720631599426 -3.5 -918039.0625) (v128.const f32x4 -1.000000013351432e-10 -123456.7890625 0.0037524376530200243 55010.2890625)) (v128.const i32x4 0 0 -1 -1))
+(assert_return (invoke "f32x4.lt" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 -2.5 -inf -3.4028234663852886e+38 -1748190720.0) (v128.const f32x4 -0.02308656834065914 6.394179763447028e-06 42416.9140625 0.5)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 -0.002592836506664753 -9.276348114013672 2.1399148408818292e-07 -9362451.0) (v128.const f32x4 0.5 -3.4028234663852886e+38 499762432.0 -1.0)) (v128.const i32x4 0 -1 0 0))
+(assert_return (invoke "f32x4.gt" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 5397.84765625 -0.0016439437167719007 -1.0008341710943114e-08 134997552.0) (v128.const f32x4 1.1754943508222875e-38 -1.0 0.012410709634423256 1835.1517333984375)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 -7.789229130139574e-05 0.10000000149011612 -696349184.0 0.5) (v128.const f32x4 -2.5 0.00043705993448384106 -0.0 4.5682253357881564e-07)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "f32x4.le" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 1.1754943508222875e-38 -14.246332168579102 5.585415419773199e-05 637454144.0) (v128.const f32x4 382.3061218261719 1.401298464324817e-45 330780.75 1.0)) (v128.const i32x4 0 0 0 -1))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 -7147.50830078125 -0.0004891427233815193 1.5 -0.0001441647473257035) (v128.const f32x4 4.337643133567326e-07 1.669536140980199e-05 -0.0 0.0022698044776916504)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "f32x4.ge" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const i32x4 0 0 0 0))
@@ -0,0 +1,33 @@
+;; Tests for f32x4.pmin and f32x4.pmax
+
+(module
+  (func (export "f32x4.pmin") (param v128 v128) (result v128) (f32x4.pmin (local.get 0) (local.get 1)))
+  (func (export "f32x4.pmax") (param v128 v128) (result v128) (f32x4.pmax (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 -inf -inf -inf -inf))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.25 0.25 0.25 0.25))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 -0.0 -inf 0.0008168983040377498 -1.077592841625119e-07) (v128.const f32x4 -1.0 2.5 7331.4296875 1.0)) (v128.const f32x4 -1.0 -inf 0.0008168983040377498 -1.077592841625119e-07))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 -2.5 1.5 3741933.0 33021032.0) (v128.const f32x4 7.077428817749023 0.0250715184956789 3.797119643422775e-05 -6.877660751342773)) (v128.const f32x4 -2.5 0.0250715184956789 3.797119643422775e-05 -6.877660751342773))
+(assert_return (invoke "f32x4.pmin" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan nan nan nan))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 0.0 0.0 0.0 0.0) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 -0.0 -0.0 -0.0 -0.0) (v128.const f32x4 0.0 0.0 0.0 0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 1.0 1.0 1.0 1.0) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 inf inf inf inf) (v128.const f32x4 -inf -inf -inf -inf)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 0.5 0.5 0.5 0.5) (v128.const f32x4 0.25 0.25 0.25 0.25)) (v128.const f32x4 0.5 0.5 0.5 0.5))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 1.5 1.5 1.5 1.5) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5)) (v128.const f32x4 1.5 1.5 1.5 1.5))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0) (v128.const f32x4 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10 1.000000013351432e-10)) (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 120.50245666503906 -0.09176842123270035 -0.8578597903251648 1140821248.0) (v128.const f32x4 -123456.7890625 -3.865793228149414 -3295.17333984375 -1040027520.0)) (v128.const f32x4 120.50245666503906 -0.09176842123270035 -0.8578597903251648 1140821248.0))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 0.0029003445524722338 224398.28125 2.84676559658692e-07 1.1754943508222875e-38) (v128.const f32x4 -435894.96875 -2.5 -1.670001914533259e-08 -4.612249426827475e-07)) (v128.const f32x4 0.0029003445524722338 224398.28125 2.84676559658692e-07 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.pmax" (v128.const f32x4 nan nan nan nan) (v128.const f32x4 1.0 1.0 1.0 1.0)) (v128.const f32x4 nan nan nan nan))
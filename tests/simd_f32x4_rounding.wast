@@ -0,0 +1,45 @@
+;; Tests for f32x4 rounding operations
+
+(module
+  (func (export "f32x4.ceil") (param v128) (result v128) (f32x4.ceil (local.get 0)))
+  (func (export "f32x4.floor") (param v128) (result v128) (f32x4.floor (local.get 0)))
+  (func (export "f32x4.trunc") (param v128) (result v128) (f32x4.trunc (local.get 0)))
+  (func (export "f32x4.nearest") (param v128) (result v128) (f32x4.nearest (local.get 0)))
+)
+
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 -0.0 1.0 -1.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 1.0 -0.0 2.0 -1.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 3.0 -2.0 3.0 -3.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 1.0 -123456.0 10000000000.0 -0.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -3514415.5)) (v128.const f32x4 1.0 1.0 -0.0 -3514415.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 3.6104165701544844e-06 7.784632907714695e-05 0.004640630912035704 -357.98236083984375)) (v128.const f32x4 1.0 1.0 1.0 -357.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 253884.46875 -272431.84375 -0.0 3.8031504154205322)) (v128.const f32x4 253885.0 -272431.0 -0.0 4.0))
+(assert_return (invoke "f32x4.ceil" (v128.const f32x4 nan 0.00021122048201505095 257056672.0 -386085.15625)) (v128.const f32x4 nan:arithmetic 1.0 257056672.0 -386085.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 -0.0 1.0 -1.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 0.0 -1.0 1.0 -2.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 2.0 -3.0 3.0 -4.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 0.0 -123457.0 10000000000.0 -1.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 8.300710760522634e-05)) (v128.const f32x4 0.0 0.0 -1.0 0.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 -320902.65625 -94.84749603271484 inf 449164864.0)) (v128.const f32x4 -320903.0 -95.0 inf 449164864.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 -3.276638071980642e-09 0.5 0.0 0.26934850215911865)) (v128.const f32x4 -1.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.floor" (v128.const f32x4 nan -0.045093834400177 471.8795471191406 -0.002930612536147237)) (v128.const f32x4 nan:arithmetic -1.0 471.0 -1.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 -0.0 1.0 -1.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 0.0 -0.0 1.0 -1.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 2.0 -2.0 3.0 -3.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 0.0 -123456.0 10000000000.0 -0.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -313778.5625)) (v128.const f32x4 0.0 0.0 -0.0 -313778.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 3.698133710372531e-08 9159676.0 -1.1774747399329044e-08 -2.5)) (v128.const f32x4 0.0 9159676.0 -0.0 -2.0))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 0.030613938346505165 2.154029607772827 1.7598733393242583e-05 inf)) (v128.const f32x4 0.0 2.0 0.0 inf))
+(assert_return (invoke "f32x4.trunc" (v128.const f32x4 nan -564325248.0 -72279.265625 -8214744.5)) (v128.const f32x4 nan:arithmetic -564325248.0 -72279.0 -8214744.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const f32x4 0.0 -0.0 1.0 -1.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const f32x4 0.0 -0.0 2.0 -2.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const f32x4 2.0 -2.0 3.0 -4.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const f32x4 0.0 -123457.0 10000000000.0 -0.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -8.054795762291178e-05)) (v128.const f32x4 0.0 0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 1.1754943508222875e-38 0.0016256041126325727 -inf 2.213673440110142e-07)) (v128.const f32x4 0.0 0.0 -inf 0.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 6371185.0 232228.46875 -0.5 -814.5997924804688)) (v128.const f32x4 6371185.0 232228.0 -0.0 -815.0))
+(assert_return (invoke "f32x4.nearest" (v128.const f32x4 nan 25.933944702148438 -5.033406935694984e-08 -7.171479956014082e-05)) (v128.const f32x4 nan:arithmetic 26.0 -0.0 -0.0))
@@ -0,0 +1,61 @@
+;; Tests for f64x2 min, max, abs and neg
+
+(module
+  (func (export "f64x2.min") (param v128 v128) (result v128) (f64x2.min (local.get 0) (local.get 1)))
+  (func (export "f64x2.max") (param v128 v128) (result v128) (f64x2.max (local.get 0) (local.get 1)))
+  (func (export "f64x2.abs") (param v128) (result v128) (f64x2.abs (local.get 0)))
+  (func (export "f64x2.neg") (param v128) (result v128) (f64x2.neg (local.get 0)))
+)
+
+(assert_return (invoke "f64x2.min" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 -inf -inf))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.25 0.25))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 -2.5 -2.5))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 1e-10 1e-10))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 196.41440371435675 -1.0866016008054249e-08) (v128.const f64x2 -230054.94198929408 -1.0)) (v128.const f64x2 -230054.94198929408 -1.0))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 242196.66308022002 -6.834026409576863e-09) (v128.const f64x2 -1.0749127042405179e-05 inf)) (v128.const f64x2 -1.0749127042405179e-05 -6.834026409576863e-09))
+(assert_return (invoke "f64x2.min" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.5 0.5))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 1.5 1.5))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 10000000000.0 10000000000.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 0.0017386503749797161 2.5) (v128.const f64x2 100307.12457675861 -0.00010603356977692679)) (v128.const f64x2 100307.12457675861 2.5))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 169057351.92758384 -31.78418382902973) (v128.const f64x2 -5e-324 3.0)) (v128.const f64x2 169057351.92758384 3.0))
+(assert_return (invoke "f64x2.max" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 0.5 0.5))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 1.5 1.5))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 2.5 2.5))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 3.0 3.5))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 0.1 123456.789))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 10000000000.0 1e-10))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 1.7976931348623157e+308))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 2.2250738585072014e-308 5e-324))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 -5e-324 628890213.1093152)) (v128.const f64x2 5e-324 628890213.1093152))
+(assert_return (invoke "f64x2.abs" (v128.const f64x2 nan 0.0011112363948758512)) (v128.const f64x2 nan 0.0011112363948758512))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 -0.0 0.0))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 -1.0 1.0))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 -0.5 0.5))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 -1.5 1.5))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 -2.5 2.5))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 -3.0 3.5))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 -0.1 123456.789))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 -10000000000.0 1e-10))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 inf -inf)) (v128.const f64x2 -inf inf))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 -1.7976931348623157e+308 1.7976931348623157e+308))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 -2.2250738585072014e-308 -5e-324))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 -5e-324 -8.265210101882248)) (v128.const f64x2 5e-324 8.265210101882248))
+(assert_return (invoke "f64x2.neg" (v128.const f64x2 nan 0.16581021275357985)) (v128.const f64x2 -nan -0.16581021275357985))
@@ -0,0 +1,75 @@
+;; Tests for f64x2 arithmetic operations
+
+(module
+  (func (export "f64x2.add") (param v128 v128) (result v128) (f64x2.add (local.get 0) (local.get 1)))
+  (func (export "f64x2.sub") (param v128 v128) (result v128) (f64x2.sub (local.get 0) (local.get 1)))
+  (func (export "f64x2.mul") (param v128 v128) (result v128) (f64x2.mul (local.get 0) (local.get 1)))
+  (func (export "f64x2.div") (param v128 v128) (result v128) (f64x2.div (local.get 0) (local.get 1)))
+  (func (export "f64x2.sqrt") (param v128) (result v128) (f64x2.sqrt (local.get 0)))
+)
+
+(assert_return (invoke "f64x2.add" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 2.0 2.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.75 0.75))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 10000000000.0 10000000000.0))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 -1.7976931348623157e+308 50243.92815595017) (v128.const f64x2 -0.2524341809847662 -190987.0745924394)) (v128.const f64x2 -1.7976931348623157e+308 -140743.14643648925))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 0.3029079825627395 -19.0096154780813) (v128.const f64x2 -1.6955455504275456e-06 -8.367773518927946e-06)) (v128.const f64x2 0.3029062870171891 -19.00962384585482))
+(assert_return (invoke "f64x2.add" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 2.0 2.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.25 0.25))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 4.0 4.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 10000000000.0 10000000000.0))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 1.3286838673717898 -179.5951770733037) (v128.const f64x2 -1.815668855810599 1.5)) (v128.const f64x2 3.1443527231823887 -181.0951770733037))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 1.0608824152607556e-05 0.035767128192385346) (v128.const f64x2 1.0 3907171.5463584475)) (v128.const f64x2 -0.9999893911758474 -3907171.5105913193))
+(assert_return (invoke "f64x2.sub" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 -inf -inf))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.125 0.125))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 -3.75 -3.75))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 -652931.5994416194 -1.0297549109394702e-05) (v128.const f64x2 0.9855599534238728 2.550983753118601e-09)) (v128.const f64x2 -643503.2367346572 -2.6268880475006802e-14))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 5e-324 -5280178.863020016) (v128.const f64x2 1356596051.282987 1278.087748877047)) (v128.const f64x2 6.70247504e-315 -6748531916.705418))
+(assert_return (invoke "f64x2.mul" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 2.0 2.0))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 -0.6 -0.6))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 1e+20 1e+20))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 5e-324 -123456.789) (v128.const f64x2 -2.407929765039067e-07 -1437.2835170661263)) (v128.const f64x2 -2.0518275e-317 85.89591930477836))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 -2.5175803632392464 40.133204544705336) (v128.const f64x2 -1.1262703636888157e-05 9565.78490114405)) (v128.const f64x2 223532.50555164609 0.004195495190353431))
+(assert_return (invoke "f64x2.div" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 0.7071067811865476 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 1.224744871391589 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 1.5811388300841898 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 1.7320508075688772 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 0.31622776601683794 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 100000.0 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.3407807929942596e+154 nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 1.4916681462400413e-154 2.2227587494850775e-162))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 -5e-324 -3.370866053596391e-08)) (v128.const f64x2 nan:arithmetic nan:arithmetic))
+(assert_return (invoke "f64x2.sqrt" (v128.const f64x2 nan 3.3991964467652767)) (v128.const f64x2 nan:arithmetic 1.8436909846189726))
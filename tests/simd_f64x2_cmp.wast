@@ -0,0 +1,89 @@
+;; Tests for f64x2 comparison operations
+
+(module
+  (func (export "f64x2.eq") (param v128 v128) (result v128) (f64x2.eq (local.get 0) (local.get 1)))
+  (func (export "f64x2.ne") (param v128 v128) (result v128) (f64x2.ne (local.get 0) (local.get 1)))
+  (func (export "f64x2.lt") (param v128 v128) (result v128) (f64x2.lt (local.get 0) (local.get 1)))
+  (func (export "f64x2.gt") (param v128 v128) (result v128) (f64x2.gt (local.get 0) (local.get 1)))
+  (func (export "f64x2.le") (param v128 v128) (result v128) (f64x2.le (local.get 0) (local.get 1)))
+  (func (export "f64x2.ge") (param v128 v128) (result v128) (f64x2.ge (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 6.082004469513866e-07 0.5867786479625585) (v128.const f64x2 0.006491719227980509 -inf)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 -82.51003646417129 -1.2136955574594372e-08) (v128.const f64x2 2.2250738585072014e-308 18949.42490877111)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.eq" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 -81009.39635992445 0.004038445160501393) (v128.const f64x2 3.964743026055126e-07 -598.8235345747646)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 482544151.9734844 -1.5) (v128.const f64x2 -2.693285482466358e-09 0.5)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ne" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 -15145804.830863807 -0.7262237128282969) (v128.const f64x2 0.02164786714862163 2.746973099128851e-08)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 2.2250738585072014e-308 -685299.1624910522) (v128.const f64x2 1.7976931348623157e+308 15401818.752888046)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.lt" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 1710.7681340868303 -1.2531916257828606) (v128.const f64x2 -3.032613733593571e-06 309069808.8577708)) (v128.const i64x2 -1 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 -2.909948689448487 5e-324) (v128.const f64x2 19100.633976410696 0.1)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.gt" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 -889.5135190014059 -0.10687378241230835) (v128.const f64x2 -1.1581518854569014e-07 -1.5)) (v128.const i64x2 -1 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 -17.1246539590572 403.2965562810313) (v128.const f64x2 3.7718068492377705 -5.778297884043199e-05)) (v128.const i64x2 -1 0))
+(assert_return (invoke "f64x2.le" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 -0.06236926177538575 1.0) (v128.const f64x2 -0.002350819752566855 3.0)) (v128.const i64x2 0 0))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 -2.308110268279264e-05 -0.003481040989505812) (v128.const f64x2 -0.00021076869566690742 -5e-324)) (v128.const i64x2 -1 0))
+(assert_return (invoke "f64x2.ge" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const i64x2 0 0))
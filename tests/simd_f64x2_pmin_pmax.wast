@@ -0,0 +1,33 @@
+;; Tests for f64x2.pmin and f64x2.pmax
+
+(module
+  (func (export "f64x2.pmin") (param v128 v128) (result v128) (f64x2.pmin (local.get 0) (local.get 1)))
+  (func (export "f64x2.pmax") (param v128 v128) (result v128) (f64x2.pmax (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 -inf -inf))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.25 0.25))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 -2.5 -2.5))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 1e-10 1e-10))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 2.5 0.0) (v128.const f64x2 -1094081.231486741 -31129.653646336777)) (v128.const f64x2 -1094081.231486741 -31129.653646336777))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 -1.5 -9932.56588157716) (v128.const f64x2 2.5 0.5)) (v128.const f64x2 -1.5 -9932.56588157716))
+(assert_return (invoke "f64x2.pmin" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan nan))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 0.0 0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 0.0 0.0) (v128.const f64x2 -0.0 -0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 -0.0 -0.0) (v128.const f64x2 0.0 0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 1.0 1.0) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 1.0 1.0) (v128.const f64x2 -1.0 -1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 inf inf) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 inf inf) (v128.const f64x2 -inf -inf)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 0.5 0.5) (v128.const f64x2 0.25 0.25)) (v128.const f64x2 0.5 0.5))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 1.5 1.5) (v128.const f64x2 -2.5 -2.5)) (v128.const f64x2 1.5 1.5))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 10000000000.0 10000000000.0) (v128.const f64x2 1e-10 1e-10)) (v128.const f64x2 10000000000.0 10000000000.0))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 1.6131834894778365e-06 391.7460692739755) (v128.const f64x2 -0.002623085153236235 -2.5)) (v128.const f64x2 1.6131834894778365e-06 391.7460692739755))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 -15672953.121189427 -252423.71343042838) (v128.const f64x2 2.5 933855.3298763639)) (v128.const f64x2 2.5 933855.3298763639))
+(assert_return (invoke "f64x2.pmax" (v128.const f64x2 nan nan) (v128.const f64x2 1.0 1.0)) (v128.const f64x2 nan nan))
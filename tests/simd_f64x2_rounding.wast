@@ -0,0 +1,61 @@
+;; Tests for f64x2 rounding operations
+
+(module
+  (func (export "f64x2.ceil") (param v128) (result v128) (f64x2.ceil (local.get 0)))
+  (func (export "f64x2.floor") (param v128) (result v128) (f64x2.floor (local.get 0)))
+  (func (export "f64x2.trunc") (param v128) (result v128) (f64x2.trunc (local.get 0)))
+  (func (export "f64x2.nearest") (param v128) (result v128) (f64x2.nearest (local.get 0)))
+)
+
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 -1.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 1.0 -0.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 2.0 -1.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 3.0 -2.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 3.0 -3.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 1.0 -123456.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 10000000000.0 -0.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf -inf))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 -5e-324 4.111603515848494e-07)) (v128.const f64x2 -0.0 1.0))
+(assert_return (invoke "f64x2.ceil" (v128.const f64x2 nan 1.4714258364490048e-07)) (v128.const f64x2 nan:arithmetic 1.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 -1.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 0.0 -1.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 1.0 -2.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 2.0 -3.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 3.0 -4.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 0.0 -123457.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 10000000000.0 -1.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf -inf))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 -5e-324 -4.0332006649317156e-06)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.floor" (v128.const f64x2 nan -3.362471551149323e-07)) (v128.const f64x2 nan:arithmetic -1.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 -1.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 1.0 -1.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 2.0 -2.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 3.0 -3.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 0.0 -123456.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 10000000000.0 -0.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf -inf))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 -5e-324 -0.07458825512094916)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.trunc" (v128.const f64x2 nan -66322662.62211035)) (v128.const f64x2 nan:arithmetic -66322662.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 0.0 -0.0)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 1.0 -1.0)) (v128.const f64x2 1.0 -1.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 0.5 -0.5)) (v128.const f64x2 0.0 -0.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 1.5 -1.5)) (v128.const f64x2 2.0 -2.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 2.5 -2.5)) (v128.const f64x2 2.0 -2.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 3.0 -3.5)) (v128.const f64x2 3.0 -4.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 0.1 -123456.789)) (v128.const f64x2 0.0 -123457.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 10000000000.0 -1e-10)) (v128.const f64x2 10000000000.0 -0.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 inf -inf)) (v128.const f64x2 inf -inf))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 -1.7976931348623157e+308))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 2.2250738585072014e-308 5e-324)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 -5e-324 201748846.790281)) (v128.const f64x2 -0.0 201748847.0))
+(assert_return (invoke "f64x2.nearest" (v128.const f64x2 nan 1901.523008228543)) (v128.const f64x2 nan:arithmetic 1902.0))
@@ -0,0 +1,47 @@
+;; Tests for i16x8 arithmetic operations
+
+(module
+  (func (export "i16x8.add") (param v128 v128) (result v128) (i16x8.add (local.get 0) (local.get 1)))
+  (func (export "i16x8.sub") (param v128 v128) (result v128) (i16x8.sub (local.get 0) (local.get 1)))
+  (func (export "i16x8.mul") (param v128 v128) (result v128) (i16x8.mul (local.get 0) (local.get 1)))
+  (func (export "i16x8.neg") (param v128) (result v128) (i16x8.neg (local.get 0)))
+)
+
+(assert_return (invoke "i16x8.add" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 3897 16384 2469 -5793 12995 29461 25803 5107) (v128.const i16x8 1 9265 30887 14993 -2 85 588 -16384)) (v128.const i16x8 3898 25649 -32180 9200 12993 29546 26391 -11277))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 21884 22831 -19949 0 -396 -20767 31669 -1) (v128.const i16x8 28459 -22601 -32768 -23865 13828 0 -2 -28582)) (v128.const i16x8 -15193 230 12819 -23865 13432 -20767 31667 -28583))
+(assert_return (invoke "i16x8.add" (v128.const i16x8 -6610 15950 -9677 -2 -10275 -16384 85 -23945) (v128.const i16x8 0 21075 8396 6632 2 32766 -32767 -14540)) (v128.const i16x8 -6610 -28511 -1281 6630 -10273 16382 -32682 27051))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32766 32766 32766 32766 32766 32766 32766 32766))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32767 -32767 -32767 -32767 -32767 -32767 -32767 -32767))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 32767 32767 0 14056 12434 2 -32767 -24539) (v128.const i16x8 32767 -24575 18219 -8113 -6385 1 -12869 12733)) (v128.const i16x8 0 -8194 -18219 22169 18819 1 -19898 28264))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 -3580 7834 -18257 22743 18817 0 -32768 -9930) (v128.const i16x8 2 -27583 -32767 -32724 -7473 -32768 -24408 18646)) (v128.const i16x8 -3582 -30119 14510 -10069 26290 -32768 -8360 -28576))
+(assert_return (invoke "i16x8.sub" (v128.const i16x8 -3886 13810 14011 32767 -2749 -25187 31453 -32767) (v128.const i16x8 -27517 -601 -2 -18728 3208 4619 0 9645)) (v128.const i16x8 23631 14411 14013 -14041 -5957 -29806 31453 23124))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 1 25762 -25675 1 -1 -19047 -16384 17052) (v128.const i16x8 -1 85 -17375 -20582 -16384 -2 15031 15277)) (v128.const i16x8 -1 27082 -427 -20582 16384 -27442 16384 -2196))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 32767 31944 -2 18624 16384 -16384 -32767 -7450) (v128.const i16x8 32766 14659 -7177 342 -32768 2 8968 12607)) (v128.const i16x8 -32766 12376 14354 12416 0 -32768 8968 -9062))
+(assert_return (invoke "i16x8.mul" (v128.const i16x8 -14953 -1327 0 30220 -29196 -16384 -16384 17800) (v128.const i16x8 30680 -10724 9311 -30462 8485 11613 85 -2603)) (v128.const i16x8 -6040 9436 0 22552 -1980 -16384 -16384 552))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 2 2 2 2 2 2 2 2)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 -24974 -2 11609 16384 -32768 31286 14430 -11335)) (v128.const i16x8 24974 2 -11609 -16384 -32768 -31286 -14430 11335))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 -12981 5355 1 16888 -21044 -20130 0 29624)) (v128.const i16x8 12981 -5355 -1 -16888 21044 20130 0 -29624))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 -29502 1 32686 -6123 85 -32767 28515 -1765)) (v128.const i16x8 29502 -1 -32686 6123 -85 32767 -28515 1765))
+(assert_return (invoke "i16x8.neg" (v128.const i16x8 0 -1 -32768 -32768 32766 23055 -16384 13632)) (v128.const i16x8 0 1 -32768 -32768 -32766 -23055 16384 -13632))
@@ -0,0 +1,69 @@
+;; Tests for i16x8 abs, min, max, avgr_u and popcnt
+
+(module
+  (func (export "i16x8.abs") (param v128) (result v128) (i16x8.abs (local.get 0)))
+  (func (export "i16x8.min_s") (param v128 v128) (result v128) (i16x8.min_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.min_u") (param v128 v128) (result v128) (i16x8.min_u (local.get 0) (local.get 1)))
+  (func (export "i16x8.max_s") (param v128 v128) (result v128) (i16x8.max_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.max_u") (param v128 v128) (result v128) (i16x8.max_u (local.get 0) (local.get 1)))
+  (func (export "i16x8.avgr_u") (param v128 v128) (result v128) (i16x8.avgr_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 2 2 2 2 2 2 2 2)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 -30931 24962 15739 -2017 -32768 -2 24867 16384)) (v128.const i16x8 30931 24962 15739 2017 -32768 2 24867 16384))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 937 -10635 16384 32767 85 -32768 85 -27599)) (v128.const i16x8 937 10635 16384 32767 85 -32768 85 27599))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 22357 16384 2340 1 32767 -32767 -2 -16146)) (v128.const i16x8 22357 16384 2340 1 32767 32767 2 16146))
+(assert_return (invoke "i16x8.abs" (v128.const i16x8 32766 85 30448 -16384 32766 1148 965 -18519)) (v128.const i16x8 32766 85 30448 16384 32766 1148 965 18519))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 -18836 -31146 1 4620 -7640 -26392 -8323 -29702) (v128.const i16x8 -11266 -32768 32767 -30383 27867 1 -1 -1)) (v128.const i16x8 -18836 -32768 1 -30383 -7640 -26392 -8323 -29702))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 -32767 11490 14735 -4766 -32768 -32768 -8706 -2788) (v128.const i16x8 -31504 -24540 -32768 5615 -32768 -32768 15070 0)) (v128.const i16x8 -32767 -24540 -32768 -4766 -32768 -32768 -8706 -2788))
+(assert_return (invoke "i16x8.min_s" (v128.const i16x8 1 -22628 -1 19271 0 -2 10253 2) (v128.const i16x8 28044 11337 6493 21567 28732 -3615 1 0)) (v128.const i16x8 1 -22628 -1 19271 0 -3615 1 0))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 32110 -16384 2 -6419 -17093 -29596 -13018 30610) (v128.const i16x8 -20338 2 -20193 85 17704 -32768 32767 16384)) (v128.const i16x8 32110 2 2 85 17704 -32768 32767 16384))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 -16903 -1207 2 -32768 -21273 -19258 -26387 -1942) (v128.const i16x8 -32767 -2 7602 2 32766 85 -27269 -15184)) (v128.const i16x8 -32767 -1207 2 2 32766 85 -27269 -15184))
+(assert_return (invoke "i16x8.min_u" (v128.const i16x8 32767 -2 13693 -5217 22386 -19962 2 2703) (v128.const i16x8 -22614 24774 -26357 -6717 -16814 32383 18178 -32767)) (v128.const i16x8 32767 24774 13693 -6717 22386 32383 2 2703))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -12527 2989 -32768 2 19962 29502 1 13902) (v128.const i16x8 -1 -5397 -1 0 20863 -1117 1 -29014)) (v128.const i16x8 -1 2989 -1 2 20863 29502 1 13902))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -10168 -30110 8049 5793 13928 -2 85 0) (v128.const i16x8 -32768 -27748 28645 0 -1 -32768 11272 2398)) (v128.const i16x8 -10168 -27748 28645 5793 13928 -2 11272 2398))
+(assert_return (invoke "i16x8.max_s" (v128.const i16x8 -30978 32766 -32767 85 -7330 -28014 -1 -32768) (v128.const i16x8 -32768 13494 13616 25917 -561 -1 32766 -32767)) (v128.const i16x8 -30978 32766 13616 25917 -561 -1 32766 -32767))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 23466 -15959 85 13622 -9278 2 19802 32767) (v128.const i16x8 -32767 16384 32627 32767 -19120 -6801 32767 23254)) (v128.const i16x8 -32767 -15959 32627 32767 -9278 -6801 32767 32767))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 3703 9461 24519 85 -19767 -15336 32767 -1768) (v128.const i16x8 2 85 -22947 5570 -8890 20208 -8909 16384)) (v128.const i16x8 3703 9461 -22947 5570 -8890 -15336 -8909 -1768))
+(assert_return (invoke "i16x8.max_u" (v128.const i16x8 32767 -31373 1 -32768 1 2778 2637 -2) (v128.const i16x8 -1 -17644 6035 0 21905 -2 -18250 -2824)) (v128.const i16x8 -1 -17644 6035 -32768 21905 -2 -18250 -2))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 16384 16384 16384 16384 16384 16384 16384 16384))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -16384 -16384 -16384 -16384 -16384 -16384 -16384 -16384))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 1 -22269 2 -1 0 32766 16384 -18263) (v128.const i16x8 16174 -11139 14438 9731 -18356 -5525 -16384 -2)) (v128.const i16x8 8088 -16704 7220 -27903 23590 -19147 -32768 -9132))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 -32768 -32768 16384 -16384 -11437 2675 4389 -10178) (v128.const i16x8 28401 32494 -17599 2 14102 20085 -32091 11974)) (v128.const i16x8 30585 32631 32161 24577 -31435 11380 18917 -31870))
+(assert_return (invoke "i16x8.avgr_u" (v128.const i16x8 -2703 -31236 -10222 -15884 85 1 22171 3589) (v128.const i16x8 -22333 -1 1 19528 18358 -17244 11944 85)) (v128.const i16x8 -12518 -15618 27658 -30946 9222 24147 17058 1837))
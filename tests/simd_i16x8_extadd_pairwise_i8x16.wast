@@ -0,0 +1,27 @@
+;; Tests for i16x8.extadd_pairwise_i8x16
+
+(module
+  (func (export "i16x8.extadd_pairwise_i8x16_s") (param v128) (result v128) (i16x8.extadd_pairwise_i8x16_s (local.get 0)))
+  (func (export "i16x8.extadd_pairwise_i8x16_u") (param v128) (result v128) (i16x8.extadd_pairwise_i8x16_u (local.get 0)))
+)
+
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2)) (v128.const i16x8 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 -77 -128 -64 85 -127 77 31 5 70 3 2 1 -1 64 -128 -11)) (v128.const i16x8 -205 21 -50 36 73 3 63 -139))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 -127 83 10 2 -127 127 127 37 -5 64 67 -126 -125 48 98 -2)) (v128.const i16x8 -44 12 0 164 59 -59 -77 96))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 64 -14 127 72 -115 104 127 56 0 2 -127 2 85 22 77 -64)) (v128.const i16x8 50 199 -11 183 2 -125 107 13))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 -64 126 64 -73 32 -69 -61 92 -64 -19 127 -64 -69 116 127 -81)) (v128.const i16x8 62 -9 -37 31 -83 63 47 46))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 127 64 -72 64 -64 -127 126 60 -94 127 85 -128 127 -123 2 -86)) (v128.const i16x8 191 -8 -191 186 33 -43 4 -84))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_s" (v128.const i8x16 -41 -80 -64 -54 32 64 -15 1 -6 1 32 -64 -2 -1 2 127)) (v128.const i16x8 -121 -118 96 -14 -5 -32 -3 129))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 510 510 510 510 510 510 510 510))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2)) (v128.const i16x8 4 4 4 4 4 4 4 4))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 -96 28 55 -86 2 126 -95 0 126 87 73 -83 -117 55 2 126)) (v128.const i16x8 188 225 128 161 213 246 194 128))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 114 115 1 85 64 -100 110 107 -64 -64 85 67 -115 2 52 -125)) (v128.const i16x8 229 86 220 217 384 152 143 183))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 64 -84 110 127 -105 39 -127 -112 -56 -34 -113 0 -2 101 0 -36)) (v128.const i16x8 236 237 190 273 422 143 355 220))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 65 -1 85 1 109 -64 85 -9 0 70 -23 66 -72 -29 85 126)) (v128.const i16x8 320 86 301 332 70 299 411 211))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 2 -56 -13 -42 -127 64 0 127 1 109 64 107 -67 105 127 83)) (v128.const i16x8 202 457 193 127 110 171 294 210))
+(assert_return (invoke "i16x8.extadd_pairwise_i8x16_u" (v128.const i8x16 -127 64 -108 -127 1 -35 -1 2 -87 -1 1 64 -94 -2 -74 85)) (v128.const i16x8 193 277 222 257 424 65 416 267))
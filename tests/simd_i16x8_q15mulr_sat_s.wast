@@ -0,0 +1,20 @@
+;; Tests for i16x8.q15mulr_sat_s
+
+(module
+  (func (export "i16x8.q15mulr_sat_s") (param v128 v128) (result v128) (i16x8.q15mulr_sat_s (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32766 32766 32766 32766 32766 32766 32766 32766))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -17302 -16384 0 11189 4210 20697 30762 -16384) (v128.const i16x8 1 -22827 -252 -32767 32552 -18833 -3632 -32767)) (v128.const i16x8 -1 11414 0 -11189 4182 -11895 -3410 16384))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -30713 11242 -32767 -31963 31541 32767 20583 -31663) (v128.const i16x8 28159 29515 1 18572 -30371 -19450 -32767 9084)) (v128.const i16x8 -26393 10126 -1 -18116 -29234 -19449 -20582 -8778))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -2781 32766 16384 -8545 -16384 0 32767 -1) (v128.const i16x8 15236 -31704 -8760 0 16384 0 -14615 32767)) (v128.const i16x8 -1293 -31702 -4380 0 -8192 0 -14615 -1))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 16384 -32768 85 2 14177 3387 -1 -23987) (v128.const i16x8 -8383 -3368 -11706 -31 2 -16384 32766 -11980)) (v128.const i16x8 -4191 3368 -30 0 1 -1693 -1 8770))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -2 6044 -7726 7661 27495 14142 1 19284) (v128.const i16x8 1 14785 -32768 -22477 85 28903 -19158 -254)) (v128.const i16x8 0 2727 7726 -5255 71 12474 -1 -149))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 32767 2 1 26237 22791 -10302 0 8434) (v128.const i16x8 31182 32766 -22067 12876 0 23649 -32768 -22625)) (v128.const i16x8 31181 2 -1 10310 0 -7435 0 -5823))
+(assert_return (invoke "i16x8.q15mulr_sat_s" (v128.const i16x8 -16384 -1 -1056 29177 -30563 32767 15075 -16384) (v128.const i16x8 19015 864 85 17949 7942 -26055 1 2)) (v128.const i16x8 -9507 0 -3 15982 -7408 -26054 0 -1))
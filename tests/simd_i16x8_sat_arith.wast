@@ -0,0 +1,57 @@
+;; Tests for i16x8 saturating arithmetic operations
+
+(module
+  (func (export "i16x8.add_sat_s") (param v128 v128) (result v128) (i16x8.add_sat_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.add_sat_u") (param v128 v128) (result v128) (i16x8.add_sat_u (local.get 0) (local.get 1)))
+  (func (export "i16x8.sub_sat_s") (param v128 v128) (result v128) (i16x8.sub_sat_s (local.get 0) (local.get 1)))
+  (func (export "i16x8.sub_sat_u") (param v128 v128) (result v128) (i16x8.sub_sat_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 -2 -20734 -2 0 11794 -16384 85 -31499) (v128.const i16x8 2 21180 -27058 -26255 -32058 32492 -27856 -1204)) (v128.const i16x8 0 446 -27060 -26255 -20264 16108 -27771 -32703))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 30748 1 32766 22005 2 25450 1 7377) (v128.const i16x8 -2563 -16384 -701 -32767 0 -32768 30325 28090)) (v128.const i16x8 28185 -16383 32065 -10762 2 -7318 30326 32767))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 31803 -26230 -32768 85 -32518 -22089 -23260 -30942) (v128.const i16x8 0 85 13446 2 4066 11686 16384 -24361)) (v128.const i16x8 31803 -26145 -19322 87 -28452 -10403 -6876 -32768))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 32766 -17289 -2 -2 -2942 -16384 -14177 -17032) (v128.const i16x8 0 -30766 -32767 -31212 -13216 -29973 20807 -1)) (v128.const i16x8 32766 -32768 -32768 -31214 -16158 -32768 6630 -17033))
+(assert_return (invoke "i16x8.add_sat_s" (v128.const i16x8 -5190 -32767 1 -1 -866 -16320 -822 -24186) (v128.const i16x8 0 17581 -13205 85 0 19465 85 27686)) (v128.const i16x8 -5190 -15186 -13204 84 -866 3145 -737 3500))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 24322 26734 12151 32766 -26553 -2 -21583 20741) (v128.const i16x8 16612 -2 27563 6415 20486 -1 -32767 -2)) (v128.const i16x8 -24602 -1 -25822 -26355 -6067 -1 -1 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 0 32766 85 6654 -30677 -25940 2 -20167) (v128.const i16x8 -16384 4883 17803 -2 -1 20476 -4984 0)) (v128.const i16x8 -16384 -27887 17888 -1 -1 -5464 -4982 -20167))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 22643 29682 27030 2 -1 -19753 30319 16384) (v128.const i16x8 8618 -9908 32766 -791 22824 -26082 -30699 -14027)) (v128.const i16x8 31261 -1 -5740 -789 -1 -1 -380 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 -6833 16384 -3905 16539 -2 16384 4059 -32767) (v128.const i16x8 0 -1 -30453 -16384 -1 -32768 32166 -1)) (v128.const i16x8 -6833 -1 -1 -1 -1 -16384 -29311 -1))
+(assert_return (invoke "i16x8.add_sat_u" (v128.const i16x8 -14960 -21304 -32767 32766 -1 -2 -27527 -29266) (v128.const i16x8 16384 -32767 -32768 32766 16384 85 -16384 -16384)) (v128.const i16x8 -1 -1 -1 -4 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32766 32766 32766 32766 32766 32766 32766 32766))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -32767 -32767 -32767 -32767 -32767 -32767 -32767 -32767))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 23131 -16384 -15201 27612 -12938 2 27538 -1) (v128.const i16x8 16384 7213 -1 -32409 25667 2 1917 -31100)) (v128.const i16x8 6747 -23597 -15200 32767 -32768 0 25621 31099))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 -22388 -5377 6507 -9373 16384 -19011 -13995 -14365) (v128.const i16x8 -2 22168 8477 32766 20826 -32768 -1659 17949)) (v128.const i16x8 -22386 -27545 -1970 -32768 -4442 13757 -12336 -32314))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 10880 2 26260 6968 -8604 -19662 -16384 -32767) (v128.const i16x8 24518 -9349 -19169 9629 13071 -21769 -23265 22555)) (v128.const i16x8 -13638 9351 32767 -2661 -21675 2107 6881 -32768))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 0 -16384 -1539 -22808 -26179 85 -7799 -6848) (v128.const i16x8 3094 5547 2 -32768 -5705 23032 18206 16878)) (v128.const i16x8 -3094 -21931 -1541 9960 -20474 -22947 -26005 -23726))
+(assert_return (invoke "i16x8.sub_sat_s" (v128.const i16x8 23783 24748 -16384 2 -12062 -28899 32767 32766) (v128.const i16x8 2 85 -6321 14540 -15490 2 2030 -16446)) (v128.const i16x8 23781 24663 -10063 -14538 3428 -28901 30737 32767))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i16x8 32766 32766 32766 32766 32766 32766 32766 32766))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -28747 6515 -32768 16384 -16384 -25812 -21316 24219) (v128.const i16x8 -29661 -30724 -3856 2 -13167 2 0 24212)) (v128.const i16x8 914 0 0 16382 0 -25814 -21316 7))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 31363 16384 32767 20593 -22829 -32767 2 -19298) (v128.const i16x8 904 32227 31229 -5791 85 -1 21828 -2)) (v128.const i16x8 30459 0 1538 0 -22914 0 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -7471 -30768 -7484 -32768 23278 1 -10113 -20669) (v128.const i16x8 8460 30205 16384 -23139 0 -3070 -22972 25441)) (v128.const i16x8 -15931 4563 -23868 0 23278 0 12859 19426))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 32766 15659 -6815 -15421 -18627 -16384 -5678 0) (v128.const i16x8 22065 -2 32766 -1 23497 8518 -1 -1)) (v128.const i16x8 10701 0 25955 0 23412 -24902 0 0))
+(assert_return (invoke "i16x8.sub_sat_u" (v128.const i16x8 -2 32767 24747 9659 -32767 -15292 -7227 -1840) (v128.const i16x8 -14607 85 -10107 26965 30965 -28602 32766 10845)) (v128.const i16x8 14605 32682 0 0 1804 13310 25543 -12685))
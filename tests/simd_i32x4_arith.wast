@@ -0,0 +1,47 @@
+;; Tests for i32x4 arithmetic operations
+
+(module
+  (func (export "i32x4.add") (param v128 v128) (result v128) (i32x4.add (local.get 0) (local.get 1)))
+  (func (export "i32x4.sub") (param v128 v128) (result v128) (i32x4.sub (local.get 0) (local.get 1)))
+  (func (export "i32x4.mul") (param v128 v128) (result v128) (i32x4.mul (local.get 0) (local.get 1)))
+  (func (export "i32x4.neg") (param v128) (result v128) (i32x4.neg (local.get 0)))
+)
+
+(assert_return (invoke "i32x4.add" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 -1592909170 -2 1073741824 -1837094319) (v128.const i32x4 0 2147483646 1 10691070)) (v128.const i32x4 -1592909170 2147483644 1073741825 -1826403249))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 364215770 -1955243511 -58843 927467606) (v128.const i32x4 -1362770273 1 -1468126815 -604900128)) (v128.const i32x4 -998554503 -1955243510 -1468185658 322567478))
+(assert_return (invoke "i32x4.add" (v128.const i32x4 -838555597 2 2147483646 -451095503) (v128.const i32x4 -277862112 1 1261082518 -643418458)) (v128.const i32x4 -1116417709 3 -886401132 -1094513961))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 2147483646 2147483646 2147483646 2147483646))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -2147483647 -2147483647 -2147483647 -2147483647))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 1167550945 171322026 455262388 885384970) (v128.const i32x4 1840364526 -595824045 -624054999 2147483647)) (v128.const i32x4 -672813581 767146071 1079317387 -1262098677))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 2 825073441 334752582 -420088359) (v128.const i32x4 -1073741824 698496995 235840506 1174630526)) (v128.const i32x4 1073741826 126576446 98912076 -1594718885))
+(assert_return (invoke "i32x4.sub" (v128.const i32x4 -1 2147483647 -563260627 -1073741824) (v128.const i32x4 1351708150 -1126190617 1274230669 -998577176)) (v128.const i32x4 -1351708151 -1021293032 -1837491296 -75164648))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 -774028147 -24031496 -1639658260 -1125728264) (v128.const i32x4 -88911395 -2079609423 -1363352181 1986307973)) (v128.const i32x4 -817116487 2038247800 1610244132 -134446120))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 85 1 -760083025 -1739407857) (v128.const i32x4 665912677 -1694138033 -2147483648 -418405479)) (v128.const i32x4 768002697 -1694138033 -2147483648 1683497975))
+(assert_return (invoke "i32x4.mul" (v128.const i32x4 352456258 -1 2147483647 -1749591386) (v128.const i32x4 -1157388477 1 1218379833 -2147483648)) (v128.const i32x4 933022022 -1 929103815 0))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 2 2 2 2)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 1684863594 -2147483648 2147483646 -1)) (v128.const i32x4 -1684863594 -2147483648 -2147483646 1))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 0 0 -292203593 -6081873)) (v128.const i32x4 0 0 292203593 6081873))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 -1956735336 -634788731 846858000 2147483646)) (v128.const i32x4 1956735336 634788731 -846858000 -2147483646))
+(assert_return (invoke "i32x4.neg" (v128.const i32x4 2147483647 -1266219130 185329595 1073741824)) (v128.const i32x4 -2147483647 1266219130 -185329595 -1073741824))
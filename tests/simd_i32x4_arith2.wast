@@ -0,0 +1,58 @@
+;; Tests for i32x4 abs, min, max, avgr_u and popcnt
+
+(module
+  (func (export "i32x4.abs") (param v128) (result v128) (i32x4.abs (local.get 0)))
+  (func (export "i32x4.min_s") (param v128 v128) (result v128) (i32x4.min_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.min_u") (param v128 v128) (result v128) (i32x4.min_u (local.get 0) (local.get 1)))
+  (func (export "i32x4.max_s") (param v128 v128) (result v128) (i32x4.max_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.max_u") (param v128 v128) (result v128) (i32x4.max_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 2 2 2 2)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 2147483647 -1020773298 -1879698278 1149080427)) (v128.const i32x4 2147483647 1020773298 1879698278 1149080427))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 751780453 -372822398 1073741824 0)) (v128.const i32x4 751780453 372822398 1073741824 0))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 2147483647 2 -2147483647 85)) (v128.const i32x4 2147483647 2 2147483647 85))
+(assert_return (invoke "i32x4.abs" (v128.const i32x4 1073741824 -1 2147483646 2147483646)) (v128.const i32x4 1073741824 1 2147483646 2147483646))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 1 0 -1706455182 -19128151) (v128.const i32x4 0 -288037602 922046886 -1786043825)) (v128.const i32x4 0 -288037602 -1706455182 -1786043825))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 1531837173 715890661 1447655777 588200260) (v128.const i32x4 -449099995 2 -568634848 173537462)) (v128.const i32x4 -449099995 2 -568634848 173537462))
+(assert_return (invoke "i32x4.min_s" (v128.const i32x4 -2147483648 2147483647 -1493739216 -672334495) (v128.const i32x4 1 0 -2 -1695664223)) (v128.const i32x4 -2147483648 0 -1493739216 -1695664223))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 1073741824 -1 -1073741824 0) (v128.const i32x4 575008609 1073741824 0 308248588)) (v128.const i32x4 575008609 1073741824 0 0))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 365134176 -1680805615 -1495165602 -874731322) (v128.const i32x4 0 1122019757 1633750465 1372829536)) (v128.const i32x4 0 1122019757 1633750465 1372829536))
+(assert_return (invoke "i32x4.min_u" (v128.const i32x4 1525898477 2147483646 -1186597117 -2147483647) (v128.const i32x4 2147483647 1073741824 -1073741824 -932879325)) (v128.const i32x4 1525898477 1073741824 -1186597117 -2147483647))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 -205750685 85 1 160599359) (v128.const i32x4 -1775515783 -286298915 -1703201205 554307416)) (v128.const i32x4 -205750685 85 1 554307416))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 85 -1457492141 1698066612 2) (v128.const i32x4 -1073741824 1073741824 1394465066 197447148)) (v128.const i32x4 85 1073741824 1698066612 197447148))
+(assert_return (invoke "i32x4.max_s" (v128.const i32x4 -2147483647 2104325235 -2 2106369060) (v128.const i32x4 -864345032 -626172567 -2147483647 128952234)) (v128.const i32x4 -864345032 2104325235 -2 2106369060))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -451435399 2 1078459768 -2081342648) (v128.const i32x4 1073741824 -407673567 -1 -2147483647)) (v128.const i32x4 -451435399 -407673567 -1 -2081342648))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -1695634604 1651420332 -2147483647 -1465515713) (v128.const i32x4 -1261755249 2 -1534887176 1073741824)) (v128.const i32x4 -1261755249 1651420332 -1534887176 -1465515713))
+(assert_return (invoke "i32x4.max_u" (v128.const i32x4 -45640317 0 -457520386 1) (v128.const i32x4 219023686 -1913379009 -1718236550 1135513911)) (v128.const i32x4 -45640317 -1913379009 -457520386 1135513911))
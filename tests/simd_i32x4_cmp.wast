@@ -0,0 +1,95 @@
+;; Tests for i32x4 comparison operations
+
+(module
+  (func (export "i32x4.eq") (param v128 v128) (result v128) (i32x4.eq (local.get 0) (local.get 1)))
+  (func (export "i32x4.ne") (param v128 v128) (result v128) (i32x4.ne (local.get 0) (local.get 1)))
+  (func (export "i32x4.lt_s") (param v128 v128) (result v128) (i32x4.lt_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.lt_u") (param v128 v128) (result v128) (i32x4.lt_u (local.get 0) (local.get 1)))
+  (func (export "i32x4.gt_s") (param v128 v128) (result v128) (i32x4.gt_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.gt_u") (param v128 v128) (result v128) (i32x4.gt_u (local.get 0) (local.get 1)))
+  (func (export "i32x4.le_s") (param v128 v128) (result v128) (i32x4.le_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.le_u") (param v128 v128) (result v128) (i32x4.le_u (local.get 0) (local.get 1)))
+  (func (export "i32x4.ge_s") (param v128 v128) (result v128) (i32x4.ge_s (local.get 0) (local.get 1)))
+  (func (export "i32x4.ge_u") (param v128 v128) (result v128) (i32x4.ge_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.eq" (v128.const i32x4 0 2147483647 1349817116 -2147483648) (v128.const i32x4 871145716 2147483646 1 -1557365227)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ne" (v128.const i32x4 1073741824 -463173201 1 624356372) (v128.const i32x4 -1395677585 627473416 -1911297844 1710803848)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_s" (v128.const i32x4 -2147483648 -1 -977276884 -2) (v128.const i32x4 1755403254 1073741824 -31971146 1812165795)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.lt_u" (v128.const i32x4 -567166094 2147483647 -174232578 -1333776797) (v128.const i32x4 -2147483648 970862729 85 -2)) (v128.const i32x4 0 0 0 -1))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_s" (v128.const i32x4 -1 657097058 1073741824 -1755402547) (v128.const i32x4 327448413 1073741824 -1370072225 81519099)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.gt_u" (v128.const i32x4 2 -2118020714 -1714640360 -1753352945) (v128.const i32x4 -1 85 571282030 -1160790343)) (v128.const i32x4 0 -1 -1 0))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_s" (v128.const i32x4 626906334 1 -1027880361 1389348242) (v128.const i32x4 -370549188 -1707165219 486883813 -2)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.le_u" (v128.const i32x4 1115987681 -1073741824 2 -1073741824) (v128.const i32x4 1073741824 -1812576141 -357953142 2147483646)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_s" (v128.const i32x4 -1 -378046331 1024211800 1306181118) (v128.const i32x4 1728639495 29136661 2147483647 -39111235)) (v128.const i32x4 0 0 0 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 0 0 0 0) (v128.const i32x4 0 0 0 0)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 1 1 1 1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 -1 -1 -1 -1) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 1 1 1 1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -1 -1 -1 -1)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 2147483647 2147483647 2147483647 2147483647) (v128.const i32x4 2147483647 2147483647 2147483647 2147483647)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.ge_u" (v128.const i32x4 -2147483648 -773010204 343478898 2) (v128.const i32x4 1095926006 2 -1924884613 2147483647)) (v128.const i32x4 -1 -1 0 0))
@@ -0,0 +1,20 @@
+;; Tests for i32x4.dot_i16x8_s
+
+(module
+  (func (export "i32x4.dot_i16x8_s") (param v128 v128) (result v128) (i32x4.dot_i16x8_s (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 0 0 0 0 0 0 0 0) (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 1 1 1 1 1 1 1 1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i32x4 65534 65534 65534 65534))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 65536 65536 65536 65536))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767) (v128.const i16x8 32767 32767 32767 32767 32767 32767 32767 32767)) (v128.const i32x4 2147352578 2147352578 2147352578 2147352578))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 3005 20980 -12392 -2 -16384 1 -5858 1) (v128.const i16x8 -30663 17729 -1679 -32767 32767 -10400 -9978 29516)) (v128.const i32x4 279812105 20871702 -536864928 58480640))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 32767 -17146 -29809 0 2799 27801 -32767 -19722) (v128.const i16x8 1 -32507 -29649 -23205 24744 -4999 -4901 1)) (v128.const i32x4 557397789 883807041 -69718743 160571345))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 3720 -17436 -6843 26397 -22722 32767 30911 -7313) (v128.const i16x8 -18368 -24969 25436 6957 -1 5864 22077 -30315)) (v128.const i32x4 367030524 9585381 192168410 904115742))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 -18694 32767 -32768 1 28675 32767 -20332 32767) (v128.const i16x8 -22582 -13018 32766 -2 85 -24951 -22808 -7321)) (v128.const i32x4 -4412898 -1073676290 -815132042 223845049))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 -1 -19610 22962 13121 -2 -25884 1 2) (v128.const i16x8 -27095 30776 -30840 -2116 10313 26235 3207 8391)) (v128.const i32x4 -603490265 -735912116 -679087366 19989))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 21256 -16384 7638 -28110 -6469 -25931 -13565 17138) (v128.const i16x8 -20232 5473 16425 0 -2 7431 0 23185)) (v128.const i32x4 -519721024 125454150 -192680323 397344530))
+(assert_return (invoke "i32x4.dot_i16x8_s" (v128.const i16x8 0 17078 16384 -16384 -32767 -22400 -8836 30510) (v128.const i16x8 24093 25873 22120 -32767 5568 -14929 -1 32767)) (v128.const i32x4 441859094 899268608 151962944 999730006))
@@ -0,0 +1,27 @@
+;; Tests for i32x4.extadd_pairwise_i16x8
+
+(module
+  (func (export "i32x4.extadd_pairwise_i16x8_s") (param v128) (result v128) (i32x4.extadd_pairwise_i16x8_s (local.get 0)))
+  (func (export "i32x4.extadd_pairwise_i16x8_u") (param v128) (result v128) (i32x4.extadd_pairwise_i16x8_u (local.get 0)))
+)
+
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 -2 -2 -2 -2))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 2 2 2 2 2 2 2 2)) (v128.const i32x4 4 4 4 4))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 -12371 -2 5953 -2831 24265 11803 -32768 32766)) (v128.const i32x4 -12373 3122 36068 -2))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 -7024 -1 2 -485 1 2 -32768 1)) (v128.const i32x4 -7025 -483 3 -32767))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 32767 -2713 -1 -1 -16384 -21940 7917 -32768)) (v128.const i32x4 30054 -2 -38324 -24851))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 3652 -32767 -1 31583 10943 -7909 -14909 -25665)) (v128.const i32x4 -29115 31582 3034 -40574))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 2 16384 13589 -17160 85 -16439 32767 -3613)) (v128.const i32x4 16386 -3571 -16354 29154))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_s" (v128.const i16x8 32767 11802 -22238 1 -4588 -32767 32766 85)) (v128.const i32x4 44569 -22237 -37355 32851))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 0 0 0 0 0 0 0 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 1 1 1 1 1 1 1 1)) (v128.const i32x4 2 2 2 2))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 131070 131070 131070 131070))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 2 2 2 2 2 2 2 2)) (v128.const i32x4 4 4 4 4))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 4184 -5280 -12745 -15057 10845 -1 32602 -4625)) (v128.const i32x4 64440 103270 76380 93513))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 0 -1 -17805 -9656 -4279 20570 17831 -15434)) (v128.const i32x4 65535 103611 81827 67933))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 -1 -2630 85 -32768 -9106 23259 2 2)) (v128.const i32x4 128441 32853 79689 4))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 32767 7101 11164 18693 -6491 1 3028 -2)) (v128.const i32x4 39868 29857 59046 68562))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 32766 -5233 -1 9693 -1 16384 -32768 2)) (v128.const i32x4 93069 75228 81919 32770))
+(assert_return (invoke "i32x4.extadd_pairwise_i16x8_u" (v128.const i16x8 -19895 1 27496 -31027 1 -2 30592 85)) (v128.const i32x4 45642 62005 65535 30677))
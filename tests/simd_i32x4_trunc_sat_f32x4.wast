@@ -0,0 +1,29 @@
+;; Tests for i32x4.trunc_sat_f32x4_s and i32x4.trunc_sat_f32x4_u
+
+(module
+  (func (export "i32x4.trunc_sat_f32x4_s") (param v128) (result v128) (i32x4.trunc_sat_f32x4_s (local.get 0)))
+  (func (export "i32x4.trunc_sat_f32x4_u") (param v128) (result v128) (i32x4.trunc_sat_f32x4_u (local.get 0)))
+)
+
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const i32x4 0 0 1 -1))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const i32x4 0 0 1 -1))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const i32x4 2 -2 3 -3))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const i32x4 0 -123456 2147483647 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const i32x4 2147483647 -2147483648 2147483647 -2147483648))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 -194.6927490234375)) (v128.const i32x4 0 0 0 -194))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 988.3526000976562 1.2859750986099243 0.03239082172513008 0.04345318675041199)) (v128.const i32x4 988 1 0 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 -294.3913879394531 128794512.0 0.010074668563902378 60.30094909667969)) (v128.const i32x4 -294 128794512 0 60))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 2147483520.0 2147483648.0 4294967040.0 4294967296.0)) (v128.const i32x4 2147483520 2147483647 2147483647 2147483647))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 -2147483648.0 -2147483904.0 -0.8999999761581421 0.8999999761581421)) (v128.const i32x4 -2147483648 -2147483648 0 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_s" (v128.const f32x4 nan -nan -1.5 1000000000.0)) (v128.const i32x4 0 0 -1 1000000000))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 0.0 -0.0 1.0 -1.0)) (v128.const i32x4 0 0 1 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 0.5 -0.5 1.5 -1.5)) (v128.const i32x4 0 0 1 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 2.5 -2.5 3.0 -3.5)) (v128.const i32x4 2 0 3 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 0.10000000149011612 -123456.7890625 10000000000.0 -1.000000013351432e-10)) (v128.const i32x4 0 0 -1 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 inf -inf 3.4028234663852886e+38 -3.4028234663852886e+38)) (v128.const i32x4 -1 0 -1 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 1.1754943508222875e-38 1.401298464324817e-45 -1.401298464324817e-45 79.09896087646484)) (v128.const i32x4 0 0 0 79))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 -3.4028234663852886e+38 -199.22911071777344 10103.748046875 0.1488802284002304)) (v128.const i32x4 0 0 10103 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 4.518442153766955e-08 -2.5 2.5 0.0)) (v128.const i32x4 0 0 2 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 2147483520.0 2147483648.0 4294967040.0 4294967296.0)) (v128.const i32x4 2147483520 -2147483648 -256 -1))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 -2147483648.0 -2147483904.0 -0.8999999761581421 0.8999999761581421)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.trunc_sat_f32x4_u" (v128.const f32x4 nan -nan -1.5 1000000000.0)) (v128.const i32x4 0 0 0 1000000000))
@@ -0,0 +1,47 @@
+;; Tests for i64x2 arithmetic operations
+
+(module
+  (func (export "i64x2.add") (param v128 v128) (result v128) (i64x2.add (local.get 0) (local.get 1)))
+  (func (export "i64x2.sub") (param v128 v128) (result v128) (i64x2.sub (local.get 0) (local.get 1)))
+  (func (export "i64x2.mul") (param v128 v128) (result v128) (i64x2.mul (local.get 0) (local.get 1)))
+  (func (export "i64x2.neg") (param v128) (result v128) (i64x2.neg (local.get 0)))
+)
+
+(assert_return (invoke "i64x2.add" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 9223372036854775807 9223372036854775807))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 -2 -2))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 -1 4526049138900229242) (v128.const i64x2 4611686018427387904 5141986073035029112)) (v128.const i64x2 4611686018427387903 -8778708861774293262))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 85 85) (v128.const i64x2 5640920886234054202 5947098731283041468)) (v128.const i64x2 5640920886234054287 5947098731283041553))
+(assert_return (invoke "i64x2.add" (v128.const i64x2 1826916036820637486 -7261116702667121823) (v128.const i64x2 4167714093290397323 2432595633753536829)) (v128.const i64x2 5994630130111034809 -4828521068913584994))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 -2 -2))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 9223372036854775806 9223372036854775806))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 -9223372036854775807 -9223372036854775807))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 3955446141918293677 5651930134964091071) (v128.const i64x2 2826722452870069221 3022885647464110995)) (v128.const i64x2 1128723689048224456 2629044487499980076))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 -634734988275083363 -1) (v128.const i64x2 1 2)) (v128.const i64x2 -634734988275083364 -3))
+(assert_return (invoke "i64x2.sub" (v128.const i64x2 -7204886511515800689 -4161187131248185363) (v128.const i64x2 1941380285176808094 8077145428696361714)) (v128.const i64x2 -9146266796692608783 6208411513765004539))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 9223372036854775807 9223372036854775807))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 -9223372036854775808 -9223372036854775808))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -2 -7924779052069944490) (v128.const i64x2 4611686018427387904 -7481684315356441988)) (v128.const i64x2 -9223372036854775808 -2735737764906456664))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -4672987100570115218 -1) (v128.const i64x2 -8031897481753490764 9223372036854775807)) (v128.const i64x2 -128473415577094824 -9223372036854775807))
+(assert_return (invoke "i64x2.mul" (v128.const i64x2 -1495508648842577247 6161615694951300989) (v128.const i64x2 448005854948619584 -2)) (v128.const i64x2 -425910893978862272 6123512683806949638))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 -1 -1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 2 2)) (v128.const i64x2 -2 -2))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 -2 1773155504592971608)) (v128.const i64x2 2 -1773155504592971608))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 -9223372036854775808 -2221542932268716040)) (v128.const i64x2 -9223372036854775808 2221542932268716040))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 5995582111389741417 7715353990068437212)) (v128.const i64x2 -5995582111389741417 -7715353990068437212))
+(assert_return (invoke "i64x2.neg" (v128.const i64x2 -303466126628718631 4611686018427387904)) (v128.const i64x2 303466126628718631 -4611686018427387904))
@@ -0,0 +1,14 @@
+;; Tests for i64x2 abs, min, max, avgr_u and popcnt
+
+(module
+  (func (export "i64x2.abs") (param v128) (result v128) (i64x2.abs (local.get 0)))
+)
+
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 1 1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 -1 -1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 2 2)) (v128.const i64x2 2 2))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 -1 0)) (v128.const i64x2 1 0))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 -5870420973556731709 2)) (v128.const i64x2 5870420973556731709 2))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 -7363868763096965306 2209427609402371388)) (v128.const i64x2 7363868763096965306 2209427609402371388))
+(assert_return (invoke "i64x2.abs" (v128.const i64x2 -9223372036854775807 9223372036854775807)) (v128.const i64x2 9223372036854775807 9223372036854775807))
@@ -0,0 +1,59 @@
+;; Tests for i64x2 comparison operations
+
+(module
+  (func (export "i64x2.eq") (param v128 v128) (result v128) (i64x2.eq (local.get 0) (local.get 1)))
+  (func (export "i64x2.ne") (param v128 v128) (result v128) (i64x2.ne (local.get 0) (local.get 1)))
+  (func (export "i64x2.lt_s") (param v128 v128) (result v128) (i64x2.lt_s (local.get 0) (local.get 1)))
+  (func (export "i64x2.gt_s") (param v128 v128) (result v128) (i64x2.gt_s (local.get 0) (local.get 1)))
+  (func (export "i64x2.le_s") (param v128 v128) (result v128) (i64x2.le_s (local.get 0) (local.get 1)))
+  (func (export "i64x2.ge_s") (param v128 v128) (result v128) (i64x2.ge_s (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.eq" (v128.const i64x2 -4301644949106953863 9223372036854775806) (v128.const i64x2 5721030044541575185 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ne" (v128.const i64x2 6519076428779771897 -9223372036854775807) (v128.const i64x2 2 -2)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.lt_s" (v128.const i64x2 0 -6504516496761578698) (v128.const i64x2 -9223372036854775808 -3099163635245881100)) (v128.const i64x2 0 -1))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.gt_s" (v128.const i64x2 1146305285085972534 5922087241719902783) (v128.const i64x2 9223372036854775806 -1)) (v128.const i64x2 0 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.le_s" (v128.const i64x2 4649892666431161195 -7994734377413384953) (v128.const i64x2 1 2)) (v128.const i64x2 0 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 0 0) (v128.const i64x2 0 0)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 1 1) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 -1 -1) (v128.const i64x2 1 1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 1 1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -1 -1)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 9223372036854775807 9223372036854775807) (v128.const i64x2 9223372036854775807 9223372036854775807)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 -9223372036854775808 -9223372036854775808) (v128.const i64x2 -9223372036854775808 -9223372036854775808)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.ge_s" (v128.const i64x2 9008297281824983056 7908454977313260081) (v128.const i64x2 -1 -1418099686971285785)) (v128.const i64x2 -1 -1))
@@ -0,0 +1,36 @@
+;; Tests for i8x16 arithmetic operations
+
+(module
+  (func (export "i8x16.add") (param v128 v128) (result v128) (i8x16.add (local.get 0) (local.get 1)))
+  (func (export "i8x16.sub") (param v128 v128) (result v128) (i8x16.sub (local.get 0) (local.get 1)))
+  (func (export "i8x16.neg") (param v128) (result v128) (i8x16.neg (local.get 0)))
+)
+
+(assert_return (invoke "i8x16.add" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 120 118 85 15 126 -128 -2 -32 127 -64 -100 -1 85 -39 0 -11) (v128.const i8x16 -60 -127 -128 -36 2 2 -106 93 -127 -1 81 94 8 -1 -7 102)) (v128.const i8x16 60 -9 -43 -21 -128 -126 -108 61 0 -65 -19 93 93 -40 -7 91))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 85 -128 85 36 54 1 15 92 59 -72 127 -121 89 64 -2 0) (v128.const i8x16 45 -114 1 -125 123 112 40 -123 54 -127 64 60 -42 47 126 -12)) (v128.const i8x16 -126 14 86 -89 -79 113 55 -31 113 57 -65 -61 47 111 124 -12))
+(assert_return (invoke "i8x16.add" (v128.const i8x16 0 126 127 85 52 -94 45 127 -91 -1 108 112 14 2 1 -16) (v128.const i8x16 -76 40 36 25 -127 -2 -106 -9 94 -68 -4 -1 85 81 -102 64)) (v128.const i8x16 -76 -90 -93 110 -75 -96 -61 118 3 -69 104 111 99 83 -101 48))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 126 41 2 -1 0 0 127 44 -6 126 1 127 -32 101 41 -54) (v128.const i8x16 85 0 -104 78 -114 34 -59 -42 1 118 -87 -84 -23 -127 -24 64)) (v128.const i8x16 41 41 106 -79 114 -34 -70 86 -7 8 88 -45 -9 -28 65 -118))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 -1 -78 108 -128 -86 -20 0 -128 -16 40 -2 62 -2 2 64 127) (v128.const i8x16 -50 -128 -1 -127 -127 -2 9 -127 1 0 -64 117 -19 2 -128 -128)) (v128.const i8x16 49 50 109 -1 41 -18 -9 -1 -17 40 62 -55 17 0 -64 -1))
+(assert_return (invoke "i8x16.sub" (v128.const i8x16 -35 -64 127 1 6 126 -103 29 -101 -88 -120 15 64 115 90 -127) (v128.const i8x16 -14 49 43 -26 -84 118 -64 44 7 47 -12 -80 41 126 13 -128)) (v128.const i8x16 -21 -113 84 27 90 8 -39 -15 -108 121 -108 95 23 -11 77 1))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 32 127 91 64 -64 85 101 113 1 -128 -77 2 85 -2 -1 2)) (v128.const i8x16 -32 -127 -91 -64 64 -85 -101 -113 -1 -128 77 -2 -85 2 1 -2))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 0 85 29 -29 0 99 -67 -58 64 127 -2 85 -1 -70 85 -104)) (v128.const i8x16 0 -85 -29 29 0 -99 67 58 -64 -127 2 -85 1 70 -85 104))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 102 85 -2 1 -127 69 85 121 85 -70 -64 86 127 -58 -122 85)) (v128.const i8x16 -102 -85 2 -1 127 -69 -85 -121 -85 70 64 -86 -127 58 122 -85))
+(assert_return (invoke "i8x16.neg" (v128.const i8x16 1 -51 -2 127 1 -2 24 -41 -95 20 1 -7 64 -128 110 64)) (v128.const i8x16 -1 51 2 -127 -1 2 -24 41 95 -20 -1 7 -64 -128 -110 -64))
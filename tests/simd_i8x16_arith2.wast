@@ -0,0 +1,78 @@
+;; Tests for i8x16 abs, min, max, avgr_u and popcnt
+
+(module
+  (func (export "i8x16.abs") (param v128) (result v128) (i8x16.abs (local.get 0)))
+  (func (export "i8x16.min_s") (param v128 v128) (result v128) (i8x16.min_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.min_u") (param v128 v128) (result v128) (i8x16.min_u (local.get 0) (local.get 1)))
+  (func (export "i8x16.max_s") (param v128 v128) (result v128) (i8x16.max_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.max_u") (param v128 v128) (result v128) (i8x16.max_u (local.get 0) (local.get 1)))
+  (func (export "i8x16.avgr_u") (param v128 v128) (result v128) (i8x16.avgr_u (local.get 0) (local.get 1)))
+  (func (export "i8x16.popcnt") (param v128) (result v128) (i8x16.popcnt (local.get 0)))
+)
+
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 -64 -52 26 73 -66 127 -28 0 -4 -96 -15 -128 1 -126 16 -24)) (v128.const i8x16 64 52 26 73 66 127 28 0 4 96 15 -128 1 126 16 24))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 -2 -70 -128 -33 -65 101 29 -17 127 -64 0 126 2 85 127 60)) (v128.const i8x16 2 70 -128 33 65 101 29 17 127 64 0 126 2 85 127 60))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 97 -69 -113 -128 -24 -64 64 -127 126 23 127 -64 12 7 -100 126)) (v128.const i8x16 97 69 113 -128 24 64 64 127 126 23 127 64 12 7 100 126))
+(assert_return (invoke "i8x16.abs" (v128.const i8x16 127 9 -128 2 35 11 126 81 -2 -128 -22 90 109 -99 -127 -77)) (v128.const i8x16 127 9 -128 2 35 11 126 81 2 -128 22 90 109 99 127 77))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 85 -128 -47 126 -127 127 -27 126 46 -127 -114 -79 -75 50 49 22) (v128.const i8x16 -27 2 -120 0 127 0 14 76 55 -61 0 57 -53 -69 -127 -16)) (v128.const i8x16 -27 -128 -120 0 -127 0 -27 76 46 -127 -114 -79 -75 -69 -127 -16))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 -128 -109 4 -114 -25 -10 -127 -64 -7 98 -128 -127 49 -6 -127 -23) (v128.const i8x16 1 -128 88 0 -1 -127 85 1 19 -77 64 -103 0 -128 -64 39)) (v128.const i8x16 -128 -128 4 -114 -25 -127 -127 -64 -7 -77 -128 -127 0 -128 -127 -23))
+(assert_return (invoke "i8x16.min_s" (v128.const i8x16 -1 2 16 -78 -1 122 64 85 127 64 -107 -69 -54 9 -115 -127) (v128.const i8x16 -47 103 19 37 126 45 -51 -30 44 37 0 127 126 -68 78 -128)) (v128.const i8x16 -47 2 16 -78 -1 45 -51 -30 44 37 -107 -69 -54 -68 -115 -128))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 64 127 110 0 36 126 6 -128 -47 -1 58 -2 81 0 -127 60) (v128.const i8x16 127 -65 -4 85 -73 2 67 87 70 67 -124 29 116 94 -56 90)) (v128.const i8x16 64 127 110 0 36 2 6 87 70 67 58 29 81 0 -127 60))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 0 64 -20 126 85 56 -30 64 -32 -81 117 94 -45 -48 -128 -128) (v128.const i8x16 -4 52 -127 90 64 -41 78 -122 -18 -14 -1 -85 -128 1 0 5)) (v128.const i8x16 0 52 -127 90 64 56 78 64 -32 -81 117 94 -128 1 0 5))
+(assert_return (invoke "i8x16.min_u" (v128.const i8x16 92 62 1 -3 -1 -99 67 16 0 -64 96 -40 -64 -95 -96 13) (v128.const i8x16 101 -1 85 -2 -115 -96 -117 -2 -2 -54 -45 -116 -82 -127 -18 -2)) (v128.const i8x16 92 62 1 -3 -115 -99 67 16 0 -64 96 -116 -82 -127 -96 13))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -80 -61 -2 0 89 -127 113 51 -74 -65 -17 -108 -127 -73 85 -21) (v128.const i8x16 -64 -37 -95 74 90 85 -56 89 -23 85 -128 64 127 -39 77 49)) (v128.const i8x16 -64 -37 -2 74 90 85 113 89 -23 85 -17 64 127 -39 85 49))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -2 126 61 -83 -107 88 17 126 -1 64 -107 1 2 0 127 64) (v128.const i8x16 1 64 -96 -1 -76 -87 -105 127 64 -76 123 -3 -2 85 2 -128)) (v128.const i8x16 1 126 61 -1 -76 88 17 127 64 64 123 1 2 85 127 64))
+(assert_return (invoke "i8x16.max_s" (v128.const i8x16 -128 -64 -59 23 127 -63 127 1 64 -51 19 19 -108 -64 -65 -69) (v128.const i8x16 54 -49 35 0 127 -2 126 -62 -113 85 127 127 -26 2 -1 -71)) (v128.const i8x16 54 -49 35 23 127 -2 127 1 64 85 127 127 -26 2 -1 -69))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -1 68 -127 2 117 2 51 30 -50 -105 -101 -87 42 127 -1 -11) (v128.const i8x16 -73 -128 127 2 -68 -38 -126 -110 0 47 -99 -2 -12 1 127 -64)) (v128.const i8x16 -1 -128 -127 2 -68 -38 -126 -110 -50 -105 -99 -2 -12 127 -1 -11))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -65 127 38 21 127 -8 -127 0 2 45 68 69 -64 127 124 -2) (v128.const i8x16 -64 -59 -48 -32 6 82 25 -128 97 -7 -24 46 -64 31 45 -1)) (v128.const i8x16 -64 -59 -48 -32 127 -8 -127 -128 97 -7 -24 69 -64 127 124 -1))
+(assert_return (invoke "i8x16.max_u" (v128.const i8x16 -64 -35 -10 107 -1 -59 -100 85 2 -2 -106 -14 -127 -110 -68 31) (v128.const i8x16 69 85 -22 -26 -54 -110 125 9 113 -45 -41 -86 -128 119 -64 -64)) (v128.const i8x16 -64 -35 -10 -26 -1 -59 -100 85 113 -2 -41 -14 -127 -110 -64 -64))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 64 64 64 64 64 64 64 64 64 64 64 64 64 64 64 64))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64 -64))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 2 -2 -3 -68 40 -91 -1 127 -8 -45 -44 -42 74 -128 -2 64) (v128.const i8x16 16 -1 -102 41 -24 91 0 102 -97 -64 126 -18 127 -127 -97 27)) (v128.const i8x16 9 -1 -52 115 -120 -128 -128 115 -52 -54 -87 -30 101 -127 -49 46))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 89 64 127 45 -51 95 43 97 -19 -2 21 127 29 47 -126 -2) (v128.const i8x16 41 -23 -101 49 103 1 4 127 -52 -64 -122 -66 127 -65 126 -2)) (v128.const i8x16 65 -107 -115 47 -102 48 24 112 -35 -33 78 -97 78 119 -128 -2))
+(assert_return (invoke "i8x16.avgr_u" (v128.const i8x16 -95 -128 -95 103 58 87 59 2 -57 0 -10 -51 112 -25 -45 43) (v128.const i8x16 64 15 -78 -64 -69 -114 -2 -127 -97 -2 120 -29 85 -1 2 -64)) (v128.const i8x16 113 72 -86 -108 123 115 -99 66 -77 127 -73 -40 99 -13 107 118))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 8 8 8 8 8 8 8 8 8 8 8 8 8 8 8 8))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 -127 -17 0 3 89 -127 -65 22 -42 -100 -2 2 -6 -128 34 -64)) (v128.const i8x16 2 7 0 2 4 2 7 3 5 4 7 1 6 1 2 2))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 -93 8 -32 -69 -127 2 0 115 0 2 -126 126 27 -117 85 1)) (v128.const i8x16 4 1 3 6 2 1 0 5 0 1 2 6 4 4 4 1))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 -101 -128 127 126 -40 64 77 -124 0 119 126 -20 -1 85 -2 101)) (v128.const i8x16 5 1 7 6 4 1 4 2 0 6 6 5 8 4 7 4))
+(assert_return (invoke "i8x16.popcnt" (v128.const i8x16 -35 64 10 -1 -62 -115 85 -67 -74 -1 85 -77 1 -128 40 85)) (v128.const i8x16 6 1 2 8 3 4 4 6 5 8 4 5 1 1 2 4))
@@ -0,0 +1,57 @@
+;; Tests for i8x16 saturating arithmetic operations
+
+(module
+  (func (export "i8x16.add_sat_s") (param v128 v128) (result v128) (i8x16.add_sat_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.add_sat_u") (param v128 v128) (result v128) (i8x16.add_sat_u (local.get 0) (local.get 1)))
+  (func (export "i8x16.sub_sat_s") (param v128 v128) (result v128) (i8x16.sub_sat_s (local.get 0) (local.get 1)))
+  (func (export "i8x16.sub_sat_u") (param v128 v128) (result v128) (i8x16.sub_sat_u (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -127 2 -70 0 53 -44 81 -99 16 -17 -2 126 6 -34 -127 85) (v128.const i8x16 -38 -128 101 65 -39 -70 85 65 64 85 -53 -75 127 -108 -11 94)) (v128.const i8x16 -128 -126 31 65 14 -114 127 -34 80 68 -55 51 127 -128 -128 127))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -91 -11 -52 1 64 -13 -69 127 106 2 -26 71 126 -84 -25 81) (v128.const i8x16 64 64 -2 -127 127 -42 77 -118 17 85 -100 -48 -128 0 -127 54)) (v128.const i8x16 -27 53 -54 -126 127 -55 8 9 123 87 -126 23 -2 -84 -128 127))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 42 64 -93 -128 -51 64 126 117 -64 85 15 -68 126 126 83 -47) (v128.const i8x16 -3 51 -108 42 -80 64 125 -59 -128 -60 -52 -64 127 -127 -18 -64)) (v128.const i8x16 39 115 -128 -86 -128 127 127 58 -128 25 -37 -128 127 -1 65 -111))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 106 -2 110 -1 66 2 6 -40 87 69 1 1 -22 -43 -64 101) (v128.const i8x16 126 -64 91 101 118 66 85 -23 -97 -97 -64 48 -36 -70 64 -2)) (v128.const i8x16 127 -66 127 100 127 68 91 -63 -10 -28 -63 49 -58 -113 0 99))
+(assert_return (invoke "i8x16.add_sat_s" (v128.const i8x16 -127 88 85 77 -32 126 100 -64 -70 -127 53 -13 127 91 1 2) (v128.const i8x16 127 8 -127 -108 0 127 -64 64 64 1 -51 127 80 -128 -68 1)) (v128.const i8x16 0 96 -42 -31 -32 127 36 0 -6 -126 2 114 127 -37 -67 3))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2 2))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 0 -93 81 41 85 -20 58 0 -126 -40 127 64 -55 -99 -78 -2) (v128.const i8x16 -78 127 -90 0 -50 -120 -64 124 10 59 -77 64 64 28 48 67)) (v128.const i8x16 -78 -1 -9 41 -1 -1 -6 124 -116 -1 -1 -128 -1 -71 -30 -1))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 104 118 -68 64 -1 85 -2 125 -24 2 84 13 1 127 -42 89) (v128.const i8x16 74 85 -20 10 126 -56 1 -50 -118 -127 -67 -113 126 -2 -117 58)) (v128.const i8x16 -78 -53 -1 74 -1 -1 -1 -1 -1 -125 -1 -100 127 -1 -1 -109))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 -55 2 -1 -128 -125 116 2 -49 -127 85 -64 -2 0 -103 -18 106) (v128.const i8x16 -128 2 -22 126 1 -50 0 0 73 -21 64 126 -91 65 74 -128)) (v128.const i8x16 -1 4 -1 -2 -124 -1 2 -49 -54 -1 -1 -1 -91 -38 -1 -22))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 -64 -64 -51 16 68 -91 -80 -95 -50 127 -110 -91 64 -120 60 -2) (v128.const i8x16 87 126 -35 -46 75 -2 -79 -2 111 21 -17 -1 1 16 64 87)) (v128.const i8x16 -1 -1 -1 -30 -113 -1 -1 -1 -1 -108 -1 -1 65 -104 124 -1))
+(assert_return (invoke "i8x16.add_sat_u" (v128.const i8x16 109 -128 -11 -118 126 48 -127 126 52 127 22 127 127 91 -55 -64) (v128.const i8x16 -2 -105 2 101 -122 2 -1 2 -36 -2 117 -64 71 -38 12 72)) (v128.const i8x16 -1 -1 -9 -17 -1 50 -1 -128 -1 -1 -117 -1 -58 -1 -43 -1))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127 -127))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 11 -128 65 -80 113 127 -2 -77 -15 64 72 -5 122 -128 -107 -69) (v128.const i8x16 109 -104 -36 -78 85 5 -2 -128 6 -127 16 2 -74 123 127 -91)) (v128.const i8x16 -98 -24 101 -2 28 122 0 51 -21 127 56 -7 127 -128 -128 22))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -64 1 -1 8 0 64 80 -87 2 112 -1 80 2 126 -12 -127) (v128.const i8x16 -1 -17 85 19 41 -37 1 -2 -9 -2 126 -64 20 -128 0 64)) (v128.const i8x16 -63 18 -86 -11 -41 101 79 -85 11 114 -127 127 -18 127 -12 -128))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 99 0 126 124 32 68 81 0 5 -70 -51 116 -21 -15 -56 -25) (v128.const i8x16 88 -1 53 53 -128 -1 -114 -98 -122 127 12 -64 -79 -127 -21 -6)) (v128.const i8x16 11 1 73 71 127 69 127 98 127 -128 -63 127 58 112 -35 -19))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -68 -4 -2 127 -12 -3 -64 -76 24 -127 76 1 -9 126 -21 -27) (v128.const i8x16 -78 5 -25 -64 11 104 119 80 -1 -64 124 51 109 -2 -127 105)) (v128.const i8x16 10 -9 23 127 -23 -107 -128 -128 25 -63 -48 -50 -118 127 106 -128))
+(assert_return (invoke "i8x16.sub_sat_s" (v128.const i8x16 -127 64 64 -95 -55 -59 -128 30 -128 87 -64 -127 -22 51 33 -2) (v128.const i8x16 -128 112 -64 -8 -127 0 25 -30 78 64 122 -58 32 59 -1 2)) (v128.const i8x16 1 -48 127 -87 72 -59 -128 60 -128 23 -128 -69 -54 -8 34 -4))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2 -2))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1)) (v128.const i8x16 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126 126))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -98 -127 -112 -127 -1 -1 -128 -76 102 -64 94 119 -27 127 -101 -127) (v128.const i8x16 8 49 48 -105 91 -17 -2 84 34 -6 64 38 -46 48 -1 -45)) (v128.const i8x16 -106 80 96 0 -92 16 0 96 68 0 30 81 19 79 0 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -51 1 -87 -87 -128 -119 123 126 28 60 -90 -98 85 -96 -5 64) (v128.const i8x16 64 7 -128 2 122 -59 -127 68 126 14 0 -127 -52 1 0 -96)) (v128.const i8x16 -115 0 41 -89 6 0 0 58 0 46 -90 29 0 -97 -5 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 64 -52 2 85 -128 -92 -127 -17 121 -2 -1 -113 -97 -2 -64 -14) (v128.const i8x16 -55 -124 -43 -36 11 -68 1 -128 73 -101 0 41 -2 -37 -91 126)) (v128.const i8x16 0 72 0 0 117 0 -128 111 48 99 -1 102 0 35 27 116))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -64 -6 -61 57 127 -64 26 127 -128 109 85 -65 127 -33 -94 -122) (v128.const i8x16 107 -64 -101 -127 1 85 93 64 -69 -28 4 105 0 -127 -103 -2)) (v128.const i8x16 85 58 40 0 126 107 0 63 0 0 81 86 127 94 9 0))
+(assert_return (invoke "i8x16.sub_sat_u" (v128.const i8x16 -64 39 1 -116 -83 -50 127 -64 -1 85 -39 -116 -43 2 -98 -63) (v128.const i8x16 -89 -1 -110 26 2 1 126 82 -62 22 127 80 68 126 87 -110)) (v128.const i8x16 25 0 0 114 -85 -51 1 110 61 63 90 60 -111 0 71 47))
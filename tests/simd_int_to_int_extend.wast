@@ -0,0 +1,101 @@
+;; Tests for the integer extend operations
+
+(module
+  (func (export "i16x8.extend_low_i8x16_s") (param v128) (result v128) (i16x8.extend_low_i8x16_s (local.get 0)))
+  (func (export "i16x8.extend_low_i8x16_u") (param v128) (result v128) (i16x8.extend_low_i8x16_u (local.get 0)))
+  (func (export "i16x8.extend_high_i8x16_s") (param v128) (result v128) (i16x8.extend_high_i8x16_s (local.get 0)))
+  (func (export "i16x8.extend_high_i8x16_u") (param v128) (result v128) (i16x8.extend_high_i8x16_u (local.get 0)))
+  (func (export "i32x4.extend_low_i16x8_s") (param v128) (result v128) (i32x4.extend_low_i16x8_s (local.get 0)))
+  (func (export "i32x4.extend_low_i16x8_u") (param v128) (result v128) (i32x4.extend_low_i16x8_u (local.get 0)))
+  (func (export "i32x4.extend_high_i16x8_s") (param v128) (result v128) (i32x4.extend_high_i16x8_s (local.get 0)))
+  (func (export "i32x4.extend_high_i16x8_u") (param v128) (result v128) (i32x4.extend_high_i16x8_u (local.get 0)))
+  (func (export "i64x2.extend_low_i32x4_s") (param v128) (result v128) (i64x2.extend_low_i32x4_s (local.get 0)))
+  (func (export "i64x2.extend_low_i32x4_u") (param v128) (result v128) (i64x2.extend_low_i32x4_u (local.get 0)))
+  (func (export "i64x2.extend_high_i32x4_s") (param v128) (result v128) (i64x2.extend_high_i32x4_s (local.get 0)))
+  (func (export "i64x2.extend_high_i32x4_u") (param v128) (result v128) (i64x2.extend_high_i32x4_u (local.get 0)))
+)
+
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 2 2 30 95 -114 127 1 85 64 1 85 -112 -72 -32 64 -82)) (v128.const i16x8 2 2 30 95 -114 127 1 85))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 71 68 2 9 1 -64 2 -36 -101 -64 -128 -7 -64 111 1 86)) (v128.const i16x8 71 68 2 9 1 -64 2 -36))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 1 98 -2 -2 1 -127 -9 46 2 118 -4 85 77 -1 0 127)) (v128.const i16x8 1 98 -2 -2 1 -127 -9 46))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 -128 -100 85 126 -92 -60 0 -128 44 -62 -30 -128 -1 51 -97 -2)) (v128.const i16x8 -128 -100 85 126 -92 -60 0 -128))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 120 113 -80 85 -75 -61 -2 126 -1 -128 92 0 -3 -94 0 126)) (v128.const i16x8 120 113 -80 85 -75 -61 -2 126))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i16x8 0 1 2 3 4 5 6 7))
+(assert_return (invoke "i16x8.extend_low_i8x16_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 2 2 30 95 -114 127 1 85 64 1 85 -112 -72 -32 64 -82)) (v128.const i16x8 2 2 30 95 142 127 1 85))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 71 68 2 9 1 -64 2 -36 -101 -64 -128 -7 -64 111 1 86)) (v128.const i16x8 71 68 2 9 1 192 2 220))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 1 98 -2 -2 1 -127 -9 46 2 118 -4 85 77 -1 0 127)) (v128.const i16x8 1 98 254 254 1 129 247 46))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 -128 -100 85 126 -92 -60 0 -128 44 -62 -30 -128 -1 51 -97 -2)) (v128.const i16x8 128 156 85 126 164 196 0 128))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 120 113 -80 85 -75 -61 -2 126 -1 -128 92 0 -3 -94 0 126)) (v128.const i16x8 120 113 176 85 181 195 254 126))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i16x8 0 1 2 3 4 5 6 7))
+(assert_return (invoke "i16x8.extend_low_i8x16_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 255 255 255 255 255 255 255 255))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 2 2 30 95 -114 127 1 85 64 1 85 -112 -72 -32 64 -82)) (v128.const i16x8 64 1 85 -112 -72 -32 64 -82))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 71 68 2 9 1 -64 2 -36 -101 -64 -128 -7 -64 111 1 86)) (v128.const i16x8 -101 -64 -128 -7 -64 111 1 86))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 1 98 -2 -2 1 -127 -9 46 2 118 -4 85 77 -1 0 127)) (v128.const i16x8 2 118 -4 85 77 -1 0 127))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 -128 -100 85 126 -92 -60 0 -128 44 -62 -30 -128 -1 51 -97 -2)) (v128.const i16x8 44 -62 -30 -128 -1 51 -97 -2))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 120 113 -80 85 -75 -61 -2 126 -1 -128 92 0 -3 -94 0 126)) (v128.const i16x8 -1 -128 92 0 -3 -94 0 126))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i16x8 8 9 10 11 12 13 14 15))
+(assert_return (invoke "i16x8.extend_high_i8x16_s" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 2 2 30 95 -114 127 1 85 64 1 85 -112 -72 -32 64 -82)) (v128.const i16x8 64 1 85 144 184 224 64 174))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 71 68 2 9 1 -64 2 -36 -101 -64 -128 -7 -64 111 1 86)) (v128.const i16x8 155 192 128 249 192 111 1 86))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 1 98 -2 -2 1 -127 -9 46 2 118 -4 85 77 -1 0 127)) (v128.const i16x8 2 118 252 85 77 255 0 127))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 -128 -100 85 126 -92 -60 0 -128 44 -62 -30 -128 -1 51 -97 -2)) (v128.const i16x8 44 194 226 128 255 51 159 254))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 120 113 -80 85 -75 -61 -2 126 -1 -128 92 0 -3 -94 0 126)) (v128.const i16x8 255 128 92 0 253 162 0 126))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i16x8 8 9 10 11 12 13 14 15))
+(assert_return (invoke "i16x8.extend_high_i8x16_u" (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i16x8 255 255 255 255 255 255 255 255))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 32767 -32767 32767 -25681 -1713 2 -16384 26896)) (v128.const i32x4 32767 -32767 32767 -25681))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 -32768 -19453 85 -1 16384 1 -7893 32766)) (v128.const i32x4 -32768 -19453 85 -1))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 16384 2 14999 -16384 -32768 -1 8043 24625)) (v128.const i32x4 16384 2 14999 -16384))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 -2 -2 85 -16384 -15010 31409 29526 9025)) (v128.const i32x4 -2 -2 85 -16384))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 -18017 -2 -5611 13282 -1 -1 24729 -474)) (v128.const i32x4 -18017 -2 -5611 13282))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 0 1 2 3 4 5 6 7)) (v128.const i32x4 0 1 2 3))
+(assert_return (invoke "i32x4.extend_low_i16x8_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 32767 -32767 32767 -25681 -1713 2 -16384 26896)) (v128.const i32x4 32767 32769 32767 39855))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 -32768 -19453 85 -1 16384 1 -7893 32766)) (v128.const i32x4 32768 46083 85 65535))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 16384 2 14999 -16384 -32768 -1 8043 24625)) (v128.const i32x4 16384 2 14999 49152))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 -2 -2 85 -16384 -15010 31409 29526 9025)) (v128.const i32x4 65534 65534 85 49152))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 -18017 -2 -5611 13282 -1 -1 24729 -474)) (v128.const i32x4 47519 65534 59925 13282))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 0 1 2 3 4 5 6 7)) (v128.const i32x4 0 1 2 3))
+(assert_return (invoke "i32x4.extend_low_i16x8_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 65535 65535 65535 65535))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 32767 -32767 32767 -25681 -1713 2 -16384 26896)) (v128.const i32x4 -1713 2 -16384 26896))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 -32768 -19453 85 -1 16384 1 -7893 32766)) (v128.const i32x4 16384 1 -7893 32766))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 16384 2 14999 -16384 -32768 -1 8043 24625)) (v128.const i32x4 -32768 -1 8043 24625))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 -2 -2 85 -16384 -15010 31409 29526 9025)) (v128.const i32x4 -15010 31409 29526 9025))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 -18017 -2 -5611 13282 -1 -1 24729 -474)) (v128.const i32x4 -1 -1 24729 -474))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 0 1 2 3 4 5 6 7)) (v128.const i32x4 4 5 6 7))
+(assert_return (invoke "i32x4.extend_high_i16x8_s" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 32767 -32767 32767 -25681 -1713 2 -16384 26896)) (v128.const i32x4 63823 2 49152 26896))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 -32768 -19453 85 -1 16384 1 -7893 32766)) (v128.const i32x4 16384 1 57643 32766))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 16384 2 14999 -16384 -32768 -1 8043 24625)) (v128.const i32x4 32768 65535 8043 24625))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 -2 -2 85 -16384 -15010 31409 29526 9025)) (v128.const i32x4 50526 31409 29526 9025))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 -18017 -2 -5611 13282 -1 -1 24729 -474)) (v128.const i32x4 65535 65535 24729 65062))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 0 1 2 3 4 5 6 7)) (v128.const i32x4 4 5 6 7))
+(assert_return (invoke "i32x4.extend_high_i16x8_u" (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1)) (v128.const i32x4 65535 65535 65535 65535))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 1073741824 -278855908 -636565561 85)) (v128.const i64x2 1073741824 -278855908))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 209613124 364913311 -1073741824 909468270)) (v128.const i64x2 209613124 364913311))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 -769038345 1073741824 294287852 0)) (v128.const i64x2 -769038345 1073741824))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 85 85 -998531460 166943979)) (v128.const i64x2 85 85))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 -1244845151 85 -1241036174 139263519)) (v128.const i64x2 -1244845151 85))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 0 1 2 3)) (v128.const i64x2 0 1))
+(assert_return (invoke "i64x2.extend_low_i32x4_s" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 1073741824 -278855908 -636565561 85)) (v128.const i64x2 1073741824 4016111388))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 209613124 364913311 -1073741824 909468270)) (v128.const i64x2 209613124 364913311))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 -769038345 1073741824 294287852 0)) (v128.const i64x2 3525928951 1073741824))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 85 85 -998531460 166943979)) (v128.const i64x2 85 85))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 -1244845151 85 -1241036174 139263519)) (v128.const i64x2 3050122145 85))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 0 1 2 3)) (v128.const i64x2 0 1))
+(assert_return (invoke "i64x2.extend_low_i32x4_u" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i64x2 4294967295 4294967295))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 1073741824 -278855908 -636565561 85)) (v128.const i64x2 -636565561 85))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 209613124 364913311 -1073741824 909468270)) (v128.const i64x2 -1073741824 909468270))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 -769038345 1073741824 294287852 0)) (v128.const i64x2 294287852 0))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 85 85 -998531460 166943979)) (v128.const i64x2 -998531460 166943979))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 -1244845151 85 -1241036174 139263519)) (v128.const i64x2 -1241036174 139263519))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 0 1 2 3)) (v128.const i64x2 2 3))
+(assert_return (invoke "i64x2.extend_high_i32x4_s" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 1073741824 -278855908 -636565561 85)) (v128.const i64x2 3658401735 85))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 209613124 364913311 -1073741824 909468270)) (v128.const i64x2 3221225472 909468270))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 -769038345 1073741824 294287852 0)) (v128.const i64x2 294287852 0))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 85 85 -998531460 166943979)) (v128.const i64x2 3296435836 166943979))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 -1244845151 85 -1241036174 139263519)) (v128.const i64x2 3053931122 139263519))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 0 1 2 3)) (v128.const i64x2 2 3))
+(assert_return (invoke "i64x2.extend_high_i32x4_u" (v128.const i32x4 -1 -1 -1 -1)) (v128.const i64x2 4294967295 4294967295))
@@ -0,0 +1,200 @@
+;; Tests for the lane operations
+
+(module
+  (func (export "i8x16.extract_lane_s-0") (param v128) (result i32) (i8x16.extract_lane_s 0 (local.get 0)))
+  (func (export "i8x16.extract_lane_s-1") (param v128) (result i32) (i8x16.extract_lane_s 1 (local.get 0)))
+  (func (export "i8x16.extract_lane_s-8") (param v128) (result i32) (i8x16.extract_lane_s 8 (local.get 0)))
+  (func (export "i8x16.extract_lane_s-15") (param v128) (result i32) (i8x16.extract_lane_s 15 (local.get 0)))
+  (func (export "i8x16.extract_lane_u-0") (param v128) (result i32) (i8x16.extract_lane_u 0 (local.get 0)))
+  (func (export "i8x16.extract_lane_u-1") (param v128) (result i32) (i8x16.extract_lane_u 1 (local.get 0)))
+  (func (export "i8x16.extract_lane_u-8") (param v128) (result i32) (i8x16.extract_lane_u 8 (local.get 0)))
+  (func (export "i8x16.extract_lane_u-15") (param v128) (result i32) (i8x16.extract_lane_u 15 (local.get 0)))
+  (func (export "i8x16.replace_lane-0") (param v128 i32) (result v128) (i8x16.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "i8x16.replace_lane-1") (param v128 i32) (result v128) (i8x16.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "i8x16.replace_lane-8") (param v128 i32) (result v128) (i8x16.replace_lane 8 (local.get 0) (local.get 1)))
+  (func (export "i8x16.replace_lane-15") (param v128 i32) (result v128) (i8x16.replace_lane 15 (local.get 0) (local.get 1)))
+  (func (export "i16x8.extract_lane_s-0") (param v128) (result i32) (i16x8.extract_lane_s 0 (local.get 0)))
+  (func (export "i16x8.extract_lane_s-1") (param v128) (result i32) (i16x8.extract_lane_s 1 (local.get 0)))
+  (func (export "i16x8.extract_lane_s-4") (param v128) (result i32) (i16x8.extract_lane_s 4 (local.get 0)))
+  (func (export "i16x8.extract_lane_s-7") (param v128) (result i32) (i16x8.extract_lane_s 7 (local.get 0)))
+  (func (export "i16x8.extract_lane_u-0") (param v128) (result i32) (i16x8.extract_lane_u 0 (local.get 0)))
+  (func (export "i16x8.extract_lane_u-1") (param v128) (result i32) (i16x8.extract_lane_u 1 (local.get 0)))
+  (func (export "i16x8.extract_lane_u-4") (param v128) (result i32) (i16x8.extract_lane_u 4 (local.get 0)))
+  (func (export "i16x8.extract_lane_u-7") (param v128) (result i32) (i16x8.extract_lane_u 7 (local.get 0)))
+  (func (export "i16x8.replace_lane-0") (param v128 i32) (result v128) (i16x8.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "i16x8.replace_lane-1") (param v128 i32) (result v128) (i16x8.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "i16x8.replace_lane-4") (param v128 i32) (result v128) (i16x8.replace_lane 4 (local.get 0) (local.get 1)))
+  (func (export "i16x8.replace_lane-7") (param v128 i32) (result v128) (i16x8.replace_lane 7 (local.get 0) (local.get 1)))
+  (func (export "i32x4.extract_lane-0") (param v128) (result i32) (i32x4.extract_lane 0 (local.get 0)))
+  (func (export "i32x4.extract_lane-1") (param v128) (result i32) (i32x4.extract_lane 1 (local.get 0)))
+  (func (export "i32x4.extract_lane-2") (param v128) (result i32) (i32x4.extract_lane 2 (local.get 0)))
+  (func (export "i32x4.extract_lane-3") (param v128) (result i32) (i32x4.extract_lane 3 (local.get 0)))
+  (func (export "i32x4.replace_lane-0") (param v128 i32) (result v128) (i32x4.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "i32x4.replace_lane-1") (param v128 i32) (result v128) (i32x4.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "i32x4.replace_lane-2") (param v128 i32) (result v128) (i32x4.replace_lane 2 (local.get 0) (local.get 1)))
+  (func (export "i32x4.replace_lane-3") (param v128 i32) (result v128) (i32x4.replace_lane 3 (local.get 0) (local.get 1)))
+  (func (export "i64x2.extract_lane-0") (param v128) (result i64) (i64x2.extract_lane 0 (local.get 0)))
+  (func (export "i64x2.extract_lane-1") (param v128) (result i64) (i64x2.extract_lane 1 (local.get 0)))
+  (func (export "i64x2.replace_lane-0") (param v128 i64) (result v128) (i64x2.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "i64x2.replace_lane-1") (param v128 i64) (result v128) (i64x2.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "f32x4.extract_lane-0") (param v128) (result f32) (f32x4.extract_lane 0 (local.get 0)))
+  (func (export "f32x4.extract_lane-1") (param v128) (result f32) (f32x4.extract_lane 1 (local.get 0)))
+  (func (export "f32x4.extract_lane-2") (param v128) (result f32) (f32x4.extract_lane 2 (local.get 0)))
+  (func (export "f32x4.extract_lane-3") (param v128) (result f32) (f32x4.extract_lane 3 (local.get 0)))
+  (func (export "f32x4.replace_lane-0") (param v128 f32) (result v128) (f32x4.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "f32x4.replace_lane-1") (param v128 f32) (result v128) (f32x4.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "f32x4.replace_lane-2") (param v128 f32) (result v128) (f32x4.replace_lane 2 (local.get 0) (local.get 1)))
+  (func (export "f32x4.replace_lane-3") (param v128 f32) (result v128) (f32x4.replace_lane 3 (local.get 0) (local.get 1)))
+  (func (export "f64x2.extract_lane-0") (param v128) (result f64) (f64x2.extract_lane 0 (local.get 0)))
+  (func (export "f64x2.extract_lane-1") (param v128) (result f64) (f64x2.extract_lane 1 (local.get 0)))
+  (func (export "f64x2.replace_lane-0") (param v128 f64) (result v128) (f64x2.replace_lane 0 (local.get 0) (local.get 1)))
+  (func (export "f64x2.replace_lane-1") (param v128 f64) (result v128) (f64x2.replace_lane 1 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-identity") (param v128 v128) (result v128) (i8x16.shuffle 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-reverse") (param v128 v128) (result v128) (i8x16.shuffle 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-interleave") (param v128 v128) (result v128) (i8x16.shuffle 0 16 1 17 2 18 3 19 4 20 5 21 6 22 7 23 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-second") (param v128 v128) (result v128) (i8x16.shuffle 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-broadcast") (param v128 v128) (result v128) (i8x16.shuffle 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5 (local.get 0) (local.get 1)))
+  (func (export "i8x16.shuffle-mixed") (param v128 v128) (result v128) (i8x16.shuffle 31 0 17 2 19 4 21 6 9 24 11 26 13 28 15 30 (local.get 0) (local.get 1)))
+  (func (export "i8x16.swizzle") (param v128 v128) (result v128) (i8x16.swizzle (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "i8x16.extract_lane_s-0" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 20))
+(assert_return (invoke "i8x16.extract_lane_s-0" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const -47))
+(assert_return (invoke "i8x16.extract_lane_s-0" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const -128))
+(assert_return (invoke "i8x16.extract_lane_s-1" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 25))
+(assert_return (invoke "i8x16.extract_lane_s-1" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 85))
+(assert_return (invoke "i8x16.extract_lane_s-1" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const -127))
+(assert_return (invoke "i8x16.extract_lane_s-8" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const -56))
+(assert_return (invoke "i8x16.extract_lane_s-8" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const -111))
+(assert_return (invoke "i8x16.extract_lane_s-8" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const -120))
+(assert_return (invoke "i8x16.extract_lane_s-15" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const -107))
+(assert_return (invoke "i8x16.extract_lane_s-15" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 57))
+(assert_return (invoke "i8x16.extract_lane_s-15" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const -113))
+(assert_return (invoke "i8x16.extract_lane_u-0" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 20))
+(assert_return (invoke "i8x16.extract_lane_u-0" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 209))
+(assert_return (invoke "i8x16.extract_lane_u-0" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const 128))
+(assert_return (invoke "i8x16.extract_lane_u-1" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 25))
+(assert_return (invoke "i8x16.extract_lane_u-1" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 85))
+(assert_return (invoke "i8x16.extract_lane_u-1" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const 129))
+(assert_return (invoke "i8x16.extract_lane_u-8" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 200))
+(assert_return (invoke "i8x16.extract_lane_u-8" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 145))
+(assert_return (invoke "i8x16.extract_lane_u-8" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const 136))
+(assert_return (invoke "i8x16.extract_lane_u-15" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107)) (i32.const 149))
+(assert_return (invoke "i8x16.extract_lane_u-15" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57)) (i32.const 57))
+(assert_return (invoke "i8x16.extract_lane_u-15" (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (i32.const 143))
+(assert_return (invoke "i8x16.replace_lane-0" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107) (i32.const 246062358)) (v128.const i8x16 22 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107))
+(assert_return (invoke "i8x16.replace_lane-0" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57) (i32.const -556180374)) (v128.const i8x16 106 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57))
+(assert_return (invoke "i8x16.replace_lane-1" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107) (i32.const 516647516)) (v128.const i8x16 20 92 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107))
+(assert_return (invoke "i8x16.replace_lane-1" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57) (i32.const 236456136)) (v128.const i8x16 -47 -56 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57))
+(assert_return (invoke "i8x16.replace_lane-8" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107) (i32.const -1769959345)) (v128.const i8x16 20 25 19 -67 65 57 19 -118 79 -105 16 59 -40 -44 21 -107))
+(assert_return (invoke "i8x16.replace_lane-8" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57) (i32.const -292754277)) (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -101 56 104 -21 -57 -56 -93 57))
+(assert_return (invoke "i8x16.replace_lane-15" (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 -107) (i32.const 257365083)) (v128.const i8x16 20 25 19 -67 65 57 19 -118 -56 -105 16 59 -40 -44 21 91))
+(assert_return (invoke "i8x16.replace_lane-15" (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 57) (i32.const -526141581)) (v128.const i8x16 -47 85 10 81 -120 104 -67 -60 -111 56 104 -21 -57 -56 -93 115))
+(assert_return (invoke "i16x8.extract_lane_s-0" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 12812))
+(assert_return (invoke "i16x8.extract_lane_s-0" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 21488))
+(assert_return (invoke "i16x8.extract_lane_s-0" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const -32768))
+(assert_return (invoke "i16x8.extract_lane_s-1" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 22462))
+(assert_return (invoke "i16x8.extract_lane_s-1" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const -10532))
+(assert_return (invoke "i16x8.extract_lane_s-1" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const -32767))
+(assert_return (invoke "i16x8.extract_lane_s-4" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 20780))
+(assert_return (invoke "i16x8.extract_lane_s-4" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 21356))
+(assert_return (invoke "i16x8.extract_lane_s-4" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const -32764))
+(assert_return (invoke "i16x8.extract_lane_s-7" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 20421))
+(assert_return (invoke "i16x8.extract_lane_s-7" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 31556))
+(assert_return (invoke "i16x8.extract_lane_s-7" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const -32761))
+(assert_return (invoke "i16x8.extract_lane_u-0" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 12812))
+(assert_return (invoke "i16x8.extract_lane_u-0" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 21488))
+(assert_return (invoke "i16x8.extract_lane_u-0" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const 32768))
+(assert_return (invoke "i16x8.extract_lane_u-1" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 22462))
+(assert_return (invoke "i16x8.extract_lane_u-1" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 55004))
+(assert_return (invoke "i16x8.extract_lane_u-1" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const 32769))
+(assert_return (invoke "i16x8.extract_lane_u-4" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 20780))
+(assert_return (invoke "i16x8.extract_lane_u-4" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 21356))
+(assert_return (invoke "i16x8.extract_lane_u-4" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const 32772))
+(assert_return (invoke "i16x8.extract_lane_u-7" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421)) (i32.const 20421))
+(assert_return (invoke "i16x8.extract_lane_u-7" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556)) (i32.const 31556))
+(assert_return (invoke "i16x8.extract_lane_u-7" (v128.const i16x8 -32768 -32767 -32766 -32765 -32764 -32763 -32762 -32761)) (i32.const 32775))
+(assert_return (invoke "i16x8.replace_lane-0" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421) (i32.const 174657728)) (v128.const i16x8 4288 22462 32445 25460 20780 118 8249 20421))
+(assert_return (invoke "i16x8.replace_lane-0" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556) (i32.const 1709647580)) (v128.const i16x8 9948 -10532 -696 23872 21356 22501 -17215 31556))
+(assert_return (invoke "i16x8.replace_lane-1" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421) (i32.const -1755124315)) (v128.const i16x8 12812 -4699 32445 25460 20780 118 8249 20421))
+(assert_return (invoke "i16x8.replace_lane-1" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556) (i32.const 131738592)) (v128.const i16x8 21488 11232 -696 23872 21356 22501 -17215 31556))
+(assert_return (invoke "i16x8.replace_lane-4" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421) (i32.const -1499822371)) (v128.const i16x8 12812 22462 32445 25460 -31011 118 8249 20421))
+(assert_return (invoke "i16x8.replace_lane-4" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556) (i32.const -2122720476)) (v128.const i16x8 21488 -10532 -696 23872 -9436 22501 -17215 31556))
+(assert_return (invoke "i16x8.replace_lane-7" (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 20421) (i32.const 1759952230)) (v128.const i16x8 12812 22462 32445 25460 20780 118 8249 -17050))
+(assert_return (invoke "i16x8.replace_lane-7" (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 31556) (i32.const -1921323444)) (v128.const i16x8 21488 -10532 -696 23872 21356 22501 -17215 -4532))
+(assert_return (invoke "i32x4.extract_lane-0" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047)) (i32.const -1191651983))
+(assert_return (invoke "i32x4.extract_lane-0" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480)) (i32.const -1709082405))
+(assert_return (invoke "i32x4.extract_lane-0" (v128.const i32x4 -2147483648 -2147483647 -2147483646 -2147483645)) (i32.const -2147483648))
+(assert_return (invoke "i32x4.extract_lane-1" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047)) (i32.const 486699135))
+(assert_return (invoke "i32x4.extract_lane-1" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480)) (i32.const -657022924))
+(assert_return (invoke "i32x4.extract_lane-1" (v128.const i32x4 -2147483648 -2147483647 -2147483646 -2147483645)) (i32.const -2147483647))
+(assert_return (invoke "i32x4.extract_lane-2" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047)) (i32.const -938165389))
+(assert_return (invoke "i32x4.extract_lane-2" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480)) (i32.const -804797336))
+(assert_return (invoke "i32x4.extract_lane-2" (v128.const i32x4 -2147483648 -2147483647 -2147483646 -2147483645)) (i32.const -2147483646))
+(assert_return (invoke "i32x4.extract_lane-3" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047)) (i32.const -321872047))
+(assert_return (invoke "i32x4.extract_lane-3" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480)) (i32.const 1182356480))
+(assert_return (invoke "i32x4.extract_lane-3" (v128.const i32x4 -2147483648 -2147483647 -2147483646 -2147483645)) (i32.const -2147483645))
+(assert_return (invoke "i32x4.replace_lane-0" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047) (i32.const 1197226622)) (v128.const i32x4 1197226622 486699135 -938165389 -321872047))
+(assert_return (invoke "i32x4.replace_lane-0" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480) (i32.const 1786190840)) (v128.const i32x4 1786190840 -657022924 -804797336 1182356480))
+(assert_return (invoke "i32x4.replace_lane-1" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047) (i32.const -1461607060)) (v128.const i32x4 -1191651983 -1461607060 -938165389 -321872047))
+(assert_return (invoke "i32x4.replace_lane-1" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480) (i32.const -1064587148)) (v128.const i32x4 -1709082405 -1064587148 -804797336 1182356480))
+(assert_return (invoke "i32x4.replace_lane-2" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047) (i32.const -1973885695)) (v128.const i32x4 -1191651983 486699135 -1973885695 -321872047))
+(assert_return (invoke "i32x4.replace_lane-2" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480) (i32.const 2056920834)) (v128.const i32x4 -1709082405 -657022924 2056920834 1182356480))
+(assert_return (invoke "i32x4.replace_lane-3" (v128.const i32x4 -1191651983 486699135 -938165389 -321872047) (i32.const -1485857743)) (v128.const i32x4 -1191651983 486699135 -938165389 -1485857743))
+(assert_return (invoke "i32x4.replace_lane-3" (v128.const i32x4 -1709082405 -657022924 -804797336 1182356480) (i32.const -2040806665)) (v128.const i32x4 -1709082405 -657022924 -804797336 -2040806665))
+(assert_return (invoke "i64x2.extract_lane-0" (v128.const i64x2 -6660039442030380443 2756584882011044551)) (i64.const -6660039442030380443))
+(assert_return (invoke "i64x2.extract_lane-0" (v128.const i64x2 -7554042073343633223 -4635312086899760574)) (i64.const -7554042073343633223))
+(assert_return (invoke "i64x2.extract_lane-0" (v128.const i64x2 -9223372036854775808 -9223372036854775807)) (i64.const -9223372036854775808))
+(assert_return (invoke "i64x2.extract_lane-1" (v128.const i64x2 -6660039442030380443 2756584882011044551)) (i64.const 2756584882011044551))
+(assert_return (invoke "i64x2.extract_lane-1" (v128.const i64x2 -7554042073343633223 -4635312086899760574)) (i64.const -4635312086899760574))
+(assert_return (invoke "i64x2.extract_lane-1" (v128.const i64x2 -9223372036854775808 -9223372036854775807)) (i64.const -9223372036854775807))
+(assert_return (invoke "i64x2.replace_lane-0" (v128.const i64x2 -6660039442030380443 2756584882011044551) (i64.const 5301342730040446652)) (v128.const i64x2 5301342730040446652 2756584882011044551))
+(assert_return (invoke "i64x2.replace_lane-0" (v128.const i64x2 -7554042073343633223 -4635312086899760574) (i64.const 5395689670529926250)) (v128.const i64x2 5395689670529926250 -4635312086899760574))
+(assert_return (invoke "i64x2.replace_lane-1" (v128.const i64x2 -6660039442030380443 2756584882011044551) (i64.const -6728862351471346124)) (v128.const i64x2 -6660039442030380443 -6728862351471346124))
+(assert_return (invoke "i64x2.replace_lane-1" (v128.const i64x2 -7554042073343633223 -4635312086899760574) (i64.const 4760044434091589254)) (v128.const i64x2 -7554042073343633223 4760044434091589254))
+(assert_return (invoke "f32x4.extract_lane-0" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5)) (f32.const -1.0))
+(assert_return (invoke "f32x4.extract_lane-0" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38)) (f32.const 1.0))
+(assert_return (invoke "f32x4.extract_lane-1" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5)) (f32.const -1.401298464324817e-45))
+(assert_return (invoke "f32x4.extract_lane-1" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38)) (f32.const -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.extract_lane-2" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5)) (f32.const 3.4028234663852886e+38))
+(assert_return (invoke "f32x4.extract_lane-2" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38)) (f32.const 3.4028234663852886e+38))
+(assert_return (invoke "f32x4.extract_lane-3" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5)) (f32.const -3.5))
+(assert_return (invoke "f32x4.extract_lane-3" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38)) (f32.const 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.replace_lane-0" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5) (f32.const inf)) (v128.const f32x4 inf -1.401298464324817e-45 3.4028234663852886e+38 -3.5))
+(assert_return (invoke "f32x4.replace_lane-0" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38) (f32.const 0.0)) (v128.const f32x4 0.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.replace_lane-1" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5) (f32.const -1.0)) (v128.const f32x4 -1.0 -1.0 3.4028234663852886e+38 -3.5))
+(assert_return (invoke "f32x4.replace_lane-1" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38) (f32.const -123456.7890625)) (v128.const f32x4 1.0 -123456.7890625 3.4028234663852886e+38 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.replace_lane-2" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5) (f32.const 1.1754943508222875e-38)) (v128.const f32x4 -1.0 -1.401298464324817e-45 1.1754943508222875e-38 -3.5))
+(assert_return (invoke "f32x4.replace_lane-2" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38) (f32.const 1.0)) (v128.const f32x4 1.0 -3.4028234663852886e+38 1.0 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.replace_lane-3" (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 -3.5) (f32.const inf)) (v128.const f32x4 -1.0 -1.401298464324817e-45 3.4028234663852886e+38 inf))
+(assert_return (invoke "f32x4.replace_lane-3" (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 1.1754943508222875e-38) (f32.const -123456.7890625)) (v128.const f32x4 1.0 -3.4028234663852886e+38 3.4028234663852886e+38 -123456.7890625))
+(assert_return (invoke "f64x2.extract_lane-0" (v128.const f64x2 2.5 -3.5)) (f64.const 2.5))
+(assert_return (invoke "f64x2.extract_lane-0" (v128.const f64x2 0.5 -inf)) (f64.const 0.5))
+(assert_return (invoke "f64x2.extract_lane-1" (v128.const f64x2 2.5 -3.5)) (f64.const -3.5))
+(assert_return (invoke "f64x2.extract_lane-1" (v128.const f64x2 0.5 -inf)) (f64.const -inf))
+(assert_return (invoke "f64x2.replace_lane-0" (v128.const f64x2 2.5 -3.5) (f64.const 3.0)) (v128.const f64x2 3.0 -3.5))
+(assert_return (invoke "f64x2.replace_lane-0" (v128.const f64x2 0.5 -inf) (f64.const -5e-324)) (v128.const f64x2 -5e-324 -inf))
+(assert_return (invoke "f64x2.replace_lane-1" (v128.const f64x2 2.5 -3.5) (f64.const -1e-10)) (v128.const f64x2 2.5 -1e-10))
+(assert_return (invoke "f64x2.replace_lane-1" (v128.const f64x2 0.5 -inf) (f64.const 1.7976931348623157e+308)) (v128.const f64x2 0.5 1.7976931348623157e+308))
+(assert_return (invoke "i8x16.shuffle-identity" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15))
+(assert_return (invoke "i8x16.shuffle-identity" (v128.const i8x16 11 47 8 -127 21 -32 29 52 -100 90 -64 -75 -11 98 84 -17) (v128.const i8x16 -2 63 61 40 -78 46 -76 94 45 74 -101 -102 61 79 22 -7)) (v128.const i8x16 11 47 8 -127 21 -32 29 52 -100 90 -64 -75 -11 98 84 -17))
+(assert_return (invoke "i8x16.shuffle-reverse" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0))
+(assert_return (invoke "i8x16.shuffle-reverse" (v128.const i8x16 108 114 61 -75 54 -25 -115 -125 -24 120 75 -121 -48 10 84 99) (v128.const i8x16 -41 90 -119 -3 -100 -19 -19 -13 -41 7 -57 57 95 -93 58 75)) (v128.const i8x16 99 84 10 -48 -121 75 120 -24 -125 -115 -25 54 -75 61 114 108))
+(assert_return (invoke "i8x16.shuffle-interleave" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 0 -128 1 -127 2 -126 3 -125 4 -124 5 -123 6 -122 7 -121))
+(assert_return (invoke "i8x16.shuffle-interleave" (v128.const i8x16 52 89 -48 68 -61 -128 -49 87 50 -2 63 34 101 118 103 107) (v128.const i8x16 -69 -42 55 -120 40 26 35 45 70 4 -125 -78 105 105 -81 -14)) (v128.const i8x16 52 -69 89 -42 -48 55 68 -120 -61 40 -128 26 -49 35 87 45))
+(assert_return (invoke "i8x16.shuffle-second" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113))
+(assert_return (invoke "i8x16.shuffle-second" (v128.const i8x16 -112 -127 -61 -30 -80 102 -104 -20 -128 -91 -112 -23 -106 123 27 16) (v128.const i8x16 -20 50 39 -42 -53 17 -111 -95 -15 -38 -56 56 -55 31 119 -26)) (v128.const i8x16 -20 50 39 -42 -53 17 -111 -95 -15 -38 -56 56 -55 31 119 -26))
+(assert_return (invoke "i8x16.shuffle-broadcast" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5))
+(assert_return (invoke "i8x16.shuffle-broadcast" (v128.const i8x16 64 -3 -92 -35 86 -57 99 -78 72 -114 6 -75 -7 -123 -112 -33) (v128.const i8x16 -73 15 -64 110 -119 -101 39 -103 27 -4 87 45 104 1 -52 6)) (v128.const i8x16 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57 -57))
+(assert_return (invoke "i8x16.shuffle-mixed" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 -128 -127 -126 -125 -124 -123 -122 -121 -120 -119 -118 -117 -116 -115 -114 -113)) (v128.const i8x16 -113 0 -127 2 -125 4 -123 6 9 -120 11 -118 13 -116 15 -114))
+(assert_return (invoke "i8x16.shuffle-mixed" (v128.const i8x16 -27 67 -86 105 -82 -8 -75 5 -2 77 -61 107 -66 -25 -118 -96) (v128.const i8x16 5 -38 66 -120 94 94 118 -34 99 -50 -90 -85 11 -76 -82 -95)) (v128.const i8x16 -95 -27 -38 -86 -120 -82 94 -75 77 99 107 -90 -25 11 -96 -82))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 -73 -3 3 -89 52 121 16 44 84 -49 -70 21 56 -12 62 88) (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)) (v128.const i8x16 -73 -3 3 -89 52 121 16 44 84 -49 -70 21 56 -12 62 88))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0)) (v128.const i8x16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 113 113 -71 41 13 -1 -17 17 52 -13 6 -45 -80 -94 -35 1) (v128.const i8x16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0)) (v128.const i8x16 1 -35 -94 -80 -45 6 -13 52 17 -17 -1 13 41 -71 113 113))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 16 17 -1 -128 0 1 2 3 15 31 32 7 8 9 127 -128)) (v128.const i8x16 0 0 0 0 0 1 2 3 15 0 0 7 8 9 0 0))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 -25 -65 31 -28 20 -107 113 -59 -62 -18 -120 -67 -127 106 -32 -61) (v128.const i8x16 16 17 -1 -128 0 1 2 3 15 31 32 7 8 9 127 -128)) (v128.const i8x16 0 0 0 0 -25 -65 31 -28 -61 0 0 -59 -62 -18 0 0))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 123 -124 122 -91 -124 -100 -79 -125 119 -5 -77 -59 49 52 10 -29)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 10 0))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 80 59 -117 -64 14 -39 21 85 -13 46 62 -66 88 43 122 -61) (v128.const i8x16 123 -124 122 -91 -124 -100 -79 -125 119 -5 -77 -59 49 52 10 -29)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 62 0))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15) (v128.const i8x16 16 14 2 14 7 9 8 9 4 4 11 18 11 16 1 11)) (v128.const i8x16 0 14 2 14 7 9 8 9 4 4 11 0 11 0 1 11))
+(assert_return (invoke "i8x16.swizzle" (v128.const i8x16 122 -24 -67 119 9 -30 -112 -80 9 56 -1 70 -84 12 -103 -81) (v128.const i8x16 16 14 2 14 7 9 8 9 4 4 11 18 11 16 1 11)) (v128.const i8x16 0 -103 -67 -103 -80 56 9 56 9 9 70 0 70 0 -24 70))
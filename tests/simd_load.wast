@@ -0,0 +1,133 @@
+;; Tests for the v128 load operations
+
+(module
+  (memory 1)
+  (data (i32.const 0) "\0b\30\55\7a\9f\c4\e9\0e\32\59\7c\a3\c6\ed\10\37")
+  (data (i32.const 16) "\59\82\a7\c8\ed\16\3b\5c\80\ab\ce\f1\14\3f\62\85")
+  (data (i32.const 32) "\af\d4\f1\1e\3b\60\8d\aa\d6\fd\18\47\62\89\b4\d3")
+  (data (i32.const 48) "\fd\26\43\6c\89\b2\df\f8\24\4f\6a\95\b0\db\06\21")
+
+  (func (export "v128.load") (param i32) (result v128) (v128.load (local.get 0)))
+  (func (export "v128.load-offset") (param i32) (result v128) (v128.load offset=16 (local.get 0)))
+  (func (export "v128.load-align") (param i32) (result v128) (v128.load offset=1 align=1 (local.get 0)))
+  (func (export "v128.load8x8_s") (param i32) (result v128) (v128.load8x8_s (local.get 0)))
+  (func (export "v128.load8x8_u") (param i32) (result v128) (v128.load8x8_u (local.get 0)))
+  (func (export "v128.load16x4_s") (param i32) (result v128) (v128.load16x4_s (local.get 0)))
+  (func (export "v128.load16x4_u") (param i32) (result v128) (v128.load16x4_u (local.get 0)))
+  (func (export "v128.load32x2_s") (param i32) (result v128) (v128.load32x2_s (local.get 0)))
+  (func (export "v128.load32x2_u") (param i32) (result v128) (v128.load32x2_u (local.get 0)))
+  (func (export "v128.load8_splat") (param i32) (result v128) (v128.load8_splat (local.get 0)))
+  (func (export "v128.load16_splat") (param i32) (result v128) (v128.load16_splat (local.get 0)))
+  (func (export "v128.load32_splat") (param i32) (result v128) (v128.load32_splat (local.get 0)))
+  (func (export "v128.load64_splat") (param i32) (result v128) (v128.load64_splat (local.get 0)))
+  (func (export "v128.load32_zero") (param i32) (result v128) (v128.load32_zero (local.get 0)))
+  (func (export "v128.load64_zero") (param i32) (result v128) (v128.load64_zero (local.get 0)))
+)
+
+(assert_return (invoke "v128.load" (i32.const 0)) (v128.const i8x16 11 48 85 122 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.load-offset" (i32.const 0)) (v128.const i8x16 89 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123))
+(assert_return (invoke "v128.load-align" (i32.const 0)) (v128.const i8x16 48 85 122 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89))
+(assert_return (invoke "v128.load" (i32.const 1)) (v128.const i8x16 48 85 122 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89))
+(assert_return (invoke "v128.load-offset" (i32.const 1)) (v128.const i8x16 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.load-align" (i32.const 1)) (v128.const i8x16 85 122 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 -126))
+(assert_return (invoke "v128.load" (i32.const 7)) (v128.const i8x16 14 50 89 124 -93 -58 -19 16 55 89 -126 -89 -56 -19 22 59))
+(assert_return (invoke "v128.load-offset" (i32.const 7)) (v128.const i8x16 92 -128 -85 -50 -15 20 63 98 -123 -81 -44 -15 30 59 96 -115))
+(assert_return (invoke "v128.load-align" (i32.const 7)) (v128.const i8x16 50 89 124 -93 -58 -19 16 55 89 -126 -89 -56 -19 22 59 92))
+(assert_return (invoke "v128.load" (i32.const 15)) (v128.const i8x16 55 89 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98))
+(assert_return (invoke "v128.load-offset" (i32.const 15)) (v128.const i8x16 -123 -81 -44 -15 30 59 96 -115 -86 -42 -3 24 71 98 -119 -76))
+(assert_return (invoke "v128.load-align" (i32.const 15)) (v128.const i8x16 89 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123))
+(assert_return (invoke "v128.load" (i32.const 16)) (v128.const i8x16 89 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123))
+(assert_return (invoke "v128.load-offset" (i32.const 16)) (v128.const i8x16 -81 -44 -15 30 59 96 -115 -86 -42 -3 24 71 98 -119 -76 -45))
+(assert_return (invoke "v128.load-align" (i32.const 16)) (v128.const i8x16 -126 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.load" (i32.const 33)) (v128.const i8x16 -44 -15 30 59 96 -115 -86 -42 -3 24 71 98 -119 -76 -45 -3))
+(assert_return (invoke "v128.load-offset" (i32.const 33)) (v128.const i8x16 38 67 108 -119 -78 -33 -8 36 79 106 -107 -80 -37 6 33 0))
+(assert_return (invoke "v128.load-align" (i32.const 33)) (v128.const i8x16 -15 30 59 96 -115 -86 -42 -3 24 71 98 -119 -76 -45 -3 38))
+(assert_return (invoke "v128.load" (i32.const 48)) (v128.const i8x16 -3 38 67 108 -119 -78 -33 -8 36 79 106 -107 -80 -37 6 33))
+(assert_return (invoke "v128.load-offset" (i32.const 48)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load-align" (i32.const 48)) (v128.const i8x16 38 67 108 -119 -78 -33 -8 36 79 106 -107 -80 -37 6 33 0))
+(assert_return (invoke "v128.load" (i32.const 65520)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_trap (invoke "v128.load" (i32.const 65521)) "out of bounds memory access")
+(assert_return (invoke "v128.load8x8_s" (i32.const 0)) (v128.const i16x8 11 48 85 122 -97 -60 -23 14))
+(assert_return (invoke "v128.load8x8_s" (i32.const 1)) (v128.const i16x8 48 85 122 -97 -60 -23 14 50))
+(assert_return (invoke "v128.load8x8_s" (i32.const 7)) (v128.const i16x8 14 50 89 124 -93 -58 -19 16))
+(assert_return (invoke "v128.load8x8_s" (i32.const 15)) (v128.const i16x8 55 89 -126 -89 -56 -19 22 59))
+(assert_return (invoke "v128.load8x8_s" (i32.const 16)) (v128.const i16x8 89 -126 -89 -56 -19 22 59 92))
+(assert_return (invoke "v128.load8x8_s" (i32.const 33)) (v128.const i16x8 -44 -15 30 59 96 -115 -86 -42))
+(assert_return (invoke "v128.load8x8_s" (i32.const 48)) (v128.const i16x8 -3 38 67 108 -119 -78 -33 -8))
+(assert_return (invoke "v128.load8x8_u" (i32.const 0)) (v128.const i16x8 11 48 85 122 159 196 233 14))
+(assert_return (invoke "v128.load8x8_u" (i32.const 1)) (v128.const i16x8 48 85 122 159 196 233 14 50))
+(assert_return (invoke "v128.load8x8_u" (i32.const 7)) (v128.const i16x8 14 50 89 124 163 198 237 16))
+(assert_return (invoke "v128.load8x8_u" (i32.const 15)) (v128.const i16x8 55 89 130 167 200 237 22 59))
+(assert_return (invoke "v128.load8x8_u" (i32.const 16)) (v128.const i16x8 89 130 167 200 237 22 59 92))
+(assert_return (invoke "v128.load8x8_u" (i32.const 33)) (v128.const i16x8 212 241 30 59 96 141 170 214))
+(assert_return (invoke "v128.load8x8_u" (i32.const 48)) (v128.const i16x8 253 38 67 108 137 178 223 248))
+(assert_return (invoke "v128.load16x4_s" (i32.const 0)) (v128.const i32x4 12299 31317 -15201 3817))
+(assert_return (invoke "v128.load16x4_s" (i32.const 1)) (v128.const i32x4 21808 -24710 -5692 12814))
+(assert_return (invoke "v128.load16x4_s" (i32.const 7)) (v128.const i32x4 12814 31833 -14685 4333))
+(assert_return (invoke "v128.load16x4_s" (i32.const 15)) (v128.const i32x4 22839 -22654 -4664 15126))
+(assert_return (invoke "v128.load16x4_s" (i32.const 16)) (v128.const i32x4 -32167 -14169 5869 23611))
+(assert_return (invoke "v128.load16x4_s" (i32.const 33)) (v128.const i32x4 -3628 15134 -29344 -10582))
+(assert_return (invoke "v128.load16x4_s" (i32.const 48)) (v128.const i32x4 9981 27715 -19831 -1825))
+(assert_return (invoke "v128.load16x4_u" (i32.const 0)) (v128.const i32x4 12299 31317 50335 3817))
+(assert_return (invoke "v128.load16x4_u" (i32.const 1)) (v128.const i32x4 21808 40826 59844 12814))
+(assert_return (invoke "v128.load16x4_u" (i32.const 7)) (v128.const i32x4 12814 31833 50851 4333))
+(assert_return (invoke "v128.load16x4_u" (i32.const 15)) (v128.const i32x4 22839 42882 60872 15126))
+(assert_return (invoke "v128.load16x4_u" (i32.const 16)) (v128.const i32x4 33369 51367 5869 23611))
+(assert_return (invoke "v128.load16x4_u" (i32.const 33)) (v128.const i32x4 61908 15134 36192 54954))
+(assert_return (invoke "v128.load16x4_u" (i32.const 48)) (v128.const i32x4 9981 27715 45705 63711))
+(assert_return (invoke "v128.load32x2_s" (i32.const 0)) (v128.const i64x2 2052403211 250201247))
+(assert_return (invoke "v128.load32x2_s" (i32.const 1)) (v128.const i64x2 -1619372752 839838148))
+(assert_return (invoke "v128.load32x2_s" (i32.const 7)) (v128.const i64x2 2086220302 284018339))
+(assert_return (invoke "v128.load32x2_s" (i32.const 15)) (v128.const i64x2 -1484629705 991358408))
+(assert_return (invoke "v128.load32x2_s" (i32.const 16)) (v128.const i64x2 -928546215 1547376365))
+(assert_return (invoke "v128.load32x2_s" (i32.const 33)) (v128.const i64x2 991883732 -693465760))
+(assert_return (invoke "v128.load32x2_s" (i32.const 48)) (v128.const i64x2 1816340221 -119557495))
+(assert_return (invoke "v128.load32x2_u" (i32.const 0)) (v128.const i64x2 2052403211 250201247))
+(assert_return (invoke "v128.load32x2_u" (i32.const 1)) (v128.const i64x2 2675594544 839838148))
+(assert_return (invoke "v128.load32x2_u" (i32.const 7)) (v128.const i64x2 2086220302 284018339))
+(assert_return (invoke "v128.load32x2_u" (i32.const 15)) (v128.const i64x2 2810337591 991358408))
+(assert_return (invoke "v128.load32x2_u" (i32.const 16)) (v128.const i64x2 3366421081 1547376365))
+(assert_return (invoke "v128.load32x2_u" (i32.const 33)) (v128.const i64x2 991883732 3601501536))
+(assert_return (invoke "v128.load32x2_u" (i32.const 48)) (v128.const i64x2 1816340221 4175409801))
+(assert_return (invoke "v128.load8_splat" (i32.const 0)) (v128.const i8x16 11 11 11 11 11 11 11 11 11 11 11 11 11 11 11 11))
+(assert_return (invoke "v128.load8_splat" (i32.const 1)) (v128.const i8x16 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48))
+(assert_return (invoke "v128.load8_splat" (i32.const 7)) (v128.const i8x16 14 14 14 14 14 14 14 14 14 14 14 14 14 14 14 14))
+(assert_return (invoke "v128.load8_splat" (i32.const 15)) (v128.const i8x16 55 55 55 55 55 55 55 55 55 55 55 55 55 55 55 55))
+(assert_return (invoke "v128.load8_splat" (i32.const 16)) (v128.const i8x16 89 89 89 89 89 89 89 89 89 89 89 89 89 89 89 89))
+(assert_return (invoke "v128.load8_splat" (i32.const 33)) (v128.const i8x16 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44 -44))
+(assert_return (invoke "v128.load8_splat" (i32.const 48)) (v128.const i8x16 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3 -3))
+(assert_return (invoke "v128.load16_splat" (i32.const 0)) (v128.const i16x8 12299 12299 12299 12299 12299 12299 12299 12299))
+(assert_return (invoke "v128.load16_splat" (i32.const 1)) (v128.const i16x8 21808 21808 21808 21808 21808 21808 21808 21808))
+(assert_return (invoke "v128.load16_splat" (i32.const 7)) (v128.const i16x8 12814 12814 12814 12814 12814 12814 12814 12814))
+(assert_return (invoke "v128.load16_splat" (i32.const 15)) (v128.const i16x8 22839 22839 22839 22839 22839 22839 22839 22839))
+(assert_return (invoke "v128.load16_splat" (i32.const 16)) (v128.const i16x8 -32167 -32167 -32167 -32167 -32167 -32167 -32167 -32167))
+(assert_return (invoke "v128.load16_splat" (i32.const 33)) (v128.const i16x8 -3628 -3628 -3628 -3628 -3628 -3628 -3628 -3628))
+(assert_return (invoke "v128.load16_splat" (i32.const 48)) (v128.const i16x8 9981 9981 9981 9981 9981 9981 9981 9981))
+(assert_return (invoke "v128.load32_splat" (i32.const 0)) (v128.const i32x4 2052403211 2052403211 2052403211 2052403211))
+(assert_return (invoke "v128.load32_splat" (i32.const 1)) (v128.const i32x4 -1619372752 -1619372752 -1619372752 -1619372752))
+(assert_return (invoke "v128.load32_splat" (i32.const 7)) (v128.const i32x4 2086220302 2086220302 2086220302 2086220302))
+(assert_return (invoke "v128.load32_splat" (i32.const 15)) (v128.const i32x4 -1484629705 -1484629705 -1484629705 -1484629705))
+(assert_return (invoke "v128.load32_splat" (i32.const 16)) (v128.const i32x4 -928546215 -928546215 -928546215 -928546215))
+(assert_return (invoke "v128.load32_splat" (i32.const 33)) (v128.const i32x4 991883732 991883732 991883732 991883732))
+(assert_return (invoke "v128.load32_splat" (i32.const 48)) (v128.const i32x4 1816340221 1816340221 1816340221 1816340221))
+(assert_return (invoke "v128.load64_splat" (i32.const 0)) (v128.const i64x2 1074606175335821323 1074606175335821323))
+(assert_return (invoke "v128.load64_splat" (i32.const 1)) (v128.const i64x2 3607077382268802352 3607077382268802352))
+(assert_return (invoke "v128.load64_splat" (i32.const 7)) (v128.const i64x2 1219849479555461646 1219849479555461646))
+(assert_return (invoke "v128.load64_splat" (i32.const 15)) (v128.const i64x2 4257851943784962359 4257851943784962359))
+(assert_return (invoke "v128.load64_splat" (i32.const 16)) (v128.const i64x2 6645930885644780121 6645930885644780121))
+(assert_return (invoke "v128.load64_splat" (i32.const 33)) (v128.const i64x2 -2978412759103901228 -2978412759103901228))
+(assert_return (invoke "v128.load64_splat" (i32.const 48)) (v128.const i64x2 -513495529200343299 -513495529200343299))
+(assert_return (invoke "v128.load32_zero" (i32.const 0)) (v128.const i8x16 11 48 85 122 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 1)) (v128.const i8x16 48 85 122 -97 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 7)) (v128.const i8x16 14 50 89 124 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 15)) (v128.const i8x16 55 89 -126 -89 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 16)) (v128.const i8x16 89 -126 -89 -56 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 33)) (v128.const i8x16 -44 -15 30 59 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load32_zero" (i32.const 48)) (v128.const i8x16 -3 38 67 108 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 0)) (v128.const i8x16 11 48 85 122 -97 -60 -23 14 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 1)) (v128.const i8x16 48 85 122 -97 -60 -23 14 50 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 7)) (v128.const i8x16 14 50 89 124 -93 -58 -19 16 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 15)) (v128.const i8x16 55 89 -126 -89 -56 -19 22 59 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 16)) (v128.const i8x16 89 -126 -89 -56 -19 22 59 92 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 33)) (v128.const i8x16 -44 -15 30 59 96 -115 -86 -42 0 0 0 0 0 0 0 0))
+(assert_return (invoke "v128.load64_zero" (i32.const 48)) (v128.const i8x16 -3 38 67 108 -119 -78 -33 -8 0 0 0 0 0 0 0 0))
@@ -0,0 +1,55 @@
+;; Tests for the v128 load lane operations
+
+(module
+  (memory 1)
+  (data (i32.const 0) "\0b\30\55\7a\9f\c4\e9\0e\32\59\7c\a3\c6\ed\10\37")
+  (data (i32.const 16) "\59\82\a7\c8\ed\16\3b\5c\80\ab\ce\f1\14\3f\62\85")
+  (data (i32.const 32) "\af\d4\f1\1e\3b\60\8d\aa\d6\fd\18\47\62\89\b4\d3")
+  (data (i32.const 48) "\fd\26\43\6c\89\b2\df\f8\24\4f\6a\95\b0\db\06\21")
+
+  (func (export "v128.load8_lane-0") (param i32 v128) (result v128) (v128.load8_lane 0 (local.get 0) (local.get 1)))
+  (func (export "v128.load8_lane-1") (param i32 v128) (result v128) (v128.load8_lane 1 (local.get 0) (local.get 1)))
+  (func (export "v128.load8_lane-15") (param i32 v128) (result v128) (v128.load8_lane 15 (local.get 0) (local.get 1)))
+  (func (export "v128.load16_lane-0") (param i32 v128) (result v128) (v128.load16_lane 0 (local.get 0) (local.get 1)))
+  (func (export "v128.load16_lane-1") (param i32 v128) (result v128) (v128.load16_lane 1 (local.get 0) (local.get 1)))
+  (func (export "v128.load16_lane-7") (param i32 v128) (result v128) (v128.load16_lane 7 (local.get 0) (local.get 1)))
+  (func (export "v128.load32_lane-0") (param i32 v128) (result v128) (v128.load32_lane 0 (local.get 0) (local.get 1)))
+  (func (export "v128.load32_lane-1") (param i32 v128) (result v128) (v128.load32_lane 1 (local.get 0) (local.get 1)))
+  (func (export "v128.load32_lane-3") (param i32 v128) (result v128) (v128.load32_lane 3 (local.get 0) (local.get 1)))
+  (func (export "v128.load64_lane-0") (param i32 v128) (result v128) (v128.load64_lane 0 (local.get 0) (local.get 1)))
+  (func (export "v128.load64_lane-1") (param i32 v128) (result v128) (v128.load64_lane 1 (local.get 0) (local.get 1)))
+)
+
+(assert_return (invoke "v128.load8_lane-0" (i32.const 0) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 11 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-0" (i32.const 3) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 122 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-0" (i32.const 17) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -126 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-1" (i32.const 0) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 11 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-1" (i32.const 3) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 122 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-1" (i32.const 17) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 -126 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10))
+(assert_return (invoke "v128.load8_lane-15" (i32.const 0) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 11))
+(assert_return (invoke "v128.load8_lane-15" (i32.const 3) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 122))
+(assert_return (invoke "v128.load8_lane-15" (i32.const 17) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 10)) (v128.const i8x16 -8 123 32 69 -83 -4 59 118 -96 -29 22 -67 -32 -84 -99 -126))
+(assert_return (invoke "v128.load16_lane-0" (i32.const 0) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 12299 17696 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-0" (i32.const 3) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 -24710 17696 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-0" (i32.const 17) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 -22654 17696 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-1" (i32.const 0) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 12299 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-1" (i32.const 3) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 -24710 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-1" (i32.const 17) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 -22654 -851 30267 -7264 -17130 -21280 2717))
+(assert_return (invoke "v128.load16_lane-7" (i32.const 0) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 12299))
+(assert_return (invoke "v128.load16_lane-7" (i32.const 3) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 -24710))
+(assert_return (invoke "v128.load16_lane-7" (i32.const 17) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 2717)) (v128.const i16x8 31736 17696 -851 30267 -7264 -17130 -21280 -22654))
+(assert_return (invoke "v128.load32_lane-0" (i32.const 0) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 2052403211 1983642797 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-0" (i32.const 3) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 -372990086 1983642797 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-0" (i32.const 17) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 -305617022 1983642797 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-1" (i32.const 0) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 2052403211 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-1" (i32.const 3) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 -372990086 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-1" (i32.const 17) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 -305617022 -1122573408 178105568))
+(assert_return (invoke "v128.load32_lane-3" (i32.const 0) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 1983642797 -1122573408 2052403211))
+(assert_return (invoke "v128.load32_lane-3" (i32.const 3) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 1983642797 -1122573408 -372990086))
+(assert_return (invoke "v128.load32_lane-3" (i32.const 17) (v128.const i32x4 1159756792 1983642797 -1122573408 178105568)) (v128.const i32x4 1159756792 1983642797 -1122573408 -305617022))
+(assert_return (invoke "v128.load64_lane-0" (i32.const 0) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 1074606175335821323 764957592967898016))
+(assert_return (invoke "v128.load64_lane-0" (i32.const 3) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 8960247973263220602 764957592967898016))
+(assert_return (invoke "v128.load64_lane-0" (i32.const 17) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 -9197411369332725886 764957592967898016))
+(assert_return (invoke "v128.load64_lane-1" (i32.const 0) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 8519680941220723704 1074606175335821323))
+(assert_return (invoke "v128.load64_lane-1" (i32.const 3) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 8519680941220723704 8960247973263220602))
+(assert_return (invoke "v128.load64_lane-1" (i32.const 17) (v128.const i64x2 8519680941220723704 764957592967898016)) (v128.const i64x2 8519680941220723704 -9197411369332725886))
@@ -0,0 +1,109 @@
+;; Tests for the splat operations
+
+(module
+  (func (export "i8x16.splat") (param i32) (result v128) (i8x16.splat (local.get 0)))
+  (func (export "i16x8.splat") (param i32) (result v128) (i16x8.splat (local.get 0)))
+  (func (export "i32x4.splat") (param i32) (result v128) (i32x4.splat (local.get 0)))
+  (func (export "i64x2.splat") (param i64) (result v128) (i64x2.splat (local.get 0)))
+  (func (export "f32x4.splat") (param f32) (result v128) (f32x4.splat (local.get 0)))
+  (func (export "f64x2.splat") (param f64) (result v128) (f64x2.splat (local.get 0)))
+)
+
+(assert_return (invoke "i8x16.splat" (i32.const 0)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.splat" (i32.const 1)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.splat" (i32.const -1)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.splat" (i32.const 127)) (v128.const i8x16 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i8x16.splat" (i32.const 128)) (v128.const i8x16 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128 -128))
+(assert_return (invoke "i8x16.splat" (i32.const 255)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.splat" (i32.const 4660)) (v128.const i8x16 52 52 52 52 52 52 52 52 52 52 52 52 52 52 52 52))
+(assert_return (invoke "i8x16.splat" (i32.const 32768)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.splat" (i32.const 65535)) (v128.const i8x16 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i8x16.splat" (i32.const 305419896)) (v128.const i8x16 120 120 120 120 120 120 120 120 120 120 120 120 120 120 120 120))
+(assert_return (invoke "i8x16.splat" (i32.const -2147483648)) (v128.const i8x16 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i8x16.splat" (i32.const -2147483647)) (v128.const i8x16 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i8x16.splat" (i32.const -1985229329)) (v128.const i8x16 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17 -17))
+(assert_return (invoke "i16x8.splat" (i32.const 0)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.splat" (i32.const 1)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.splat" (i32.const -1)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.splat" (i32.const 127)) (v128.const i16x8 127 127 127 127 127 127 127 127))
+(assert_return (invoke "i16x8.splat" (i32.const 128)) (v128.const i16x8 128 128 128 128 128 128 128 128))
+(assert_return (invoke "i16x8.splat" (i32.const 255)) (v128.const i16x8 255 255 255 255 255 255 255 255))
+(assert_return (invoke "i16x8.splat" (i32.const 4660)) (v128.const i16x8 4660 4660 4660 4660 4660 4660 4660 4660))
+(assert_return (invoke "i16x8.splat" (i32.const 32768)) (v128.const i16x8 -32768 -32768 -32768 -32768 -32768 -32768 -32768 -32768))
+(assert_return (invoke "i16x8.splat" (i32.const 65535)) (v128.const i16x8 -1 -1 -1 -1 -1 -1 -1 -1))
+(assert_return (invoke "i16x8.splat" (i32.const 305419896)) (v128.const i16x8 22136 22136 22136 22136 22136 22136 22136 22136))
+(assert_return (invoke "i16x8.splat" (i32.const -2147483648)) (v128.const i16x8 0 0 0 0 0 0 0 0))
+(assert_return (invoke "i16x8.splat" (i32.const -2147483647)) (v128.const i16x8 1 1 1 1 1 1 1 1))
+(assert_return (invoke "i16x8.splat" (i32.const -1985229329)) (v128.const i16x8 -12817 -12817 -12817 -12817 -12817 -12817 -12817 -12817))
+(assert_return (invoke "i32x4.splat" (i32.const 0)) (v128.const i32x4 0 0 0 0))
+(assert_return (invoke "i32x4.splat" (i32.const 1)) (v128.const i32x4 1 1 1 1))
+(assert_return (invoke "i32x4.splat" (i32.const -1)) (v128.const i32x4 -1 -1 -1 -1))
+(assert_return (invoke "i32x4.splat" (i32.const 127)) (v128.const i32x4 127 127 127 127))
+(assert_return (invoke "i32x4.splat" (i32.const 128)) (v128.const i32x4 128 128 128 128))
+(assert_return (invoke "i32x4.splat" (i32.const 255)) (v128.const i32x4 255 255 255 255))
+(assert_return (invoke "i32x4.splat" (i32.const 4660)) (v128.const i32x4 4660 4660 4660 4660))
+(assert_return (invoke "i32x4.splat" (i32.const 32768)) (v128.const i32x4 32768 32768 32768 32768))
+(assert_return (invoke "i32x4.splat" (i32.const 65535)) (v128.const i32x4 65535 65535 65535 65535))
+(assert_return (invoke "i32x4.splat" (i32.const 305419896)) (v128.const i32x4 305419896 305419896 305419896 305419896))
+(assert_return (invoke "i32x4.splat" (i32.const -2147483648)) (v128.const i32x4 -2147483648 -2147483648 -2147483648 -2147483648))
+(assert_return (invoke "i32x4.splat" (i32.const -2147483647)) (v128.const i32x4 -2147483647 -2147483647 -2147483647 -2147483647))
+(assert_return (invoke "i32x4.splat" (i32.const -1985229329)) (v128.const i32x4 -1985229329 -1985229329 -1985229329 -1985229329))
+(assert_return (invoke "i64x2.splat" (i64.const 0)) (v128.const i64x2 0 0))
+(assert_return (invoke "i64x2.splat" (i64.const 1)) (v128.const i64x2 1 1))
+(assert_return (invoke "i64x2.splat" (i64.const -1)) (v128.const i64x2 -1 -1))
+(assert_return (invoke "i64x2.splat" (i64.const 127)) (v128.const i64x2 127 127))
+(assert_return (invoke "i64x2.splat" (i64.const 128)) (v128.const i64x2 128 128))
+(assert_return (invoke "i64x2.splat" (i64.const 255)) (v128.const i64x2 255 255))
+(assert_return (invoke "i64x2.splat" (i64.const 4660)) (v128.const i64x2 4660 4660))
+(assert_return (invoke "i64x2.splat" (i64.const 32768)) (v128.const i64x2 32768 32768))
+(assert_return (invoke "i64x2.splat" (i64.const 65535)) (v128.const i64x2 65535 65535))
+(assert_return (invoke "i64x2.splat" (i64.const 305419896)) (v128.const i64x2 305419896 305419896))
+(assert_return (invoke "i64x2.splat" (i64.const 2147483648)) (v128.const i64x2 2147483648 2147483648))
+(assert_return (invoke "i64x2.splat" (i64.const -2147483647)) (v128.const i64x2 -2147483647 -2147483647))
+(assert_return (invoke "i64x2.splat" (i64.const 1311768467463790320)) (v128.const i64x2 1311768467463790320 1311768467463790320))
+(assert_return (invoke "f32x4.splat" (f32.const 0.0)) (v128.const f32x4 0.0 0.0 0.0 0.0))
+(assert_return (invoke "f32x4.splat" (f32.const -0.0)) (v128.const f32x4 -0.0 -0.0 -0.0 -0.0))
+(assert_return (invoke "f32x4.splat" (f32.const 1.0)) (v128.const f32x4 1.0 1.0 1.0 1.0))
+(assert_return (invoke "f32x4.splat" (f32.const -1.0)) (v128.const f32x4 -1.0 -1.0 -1.0 -1.0))
+(assert_return (invoke "f32x4.splat" (f32.const 0.5)) (v128.const f32x4 0.5 0.5 0.5 0.5))
+(assert_return (invoke "f32x4.splat" (f32.const -0.5)) (v128.const f32x4 -0.5 -0.5 -0.5 -0.5))
+(assert_return (invoke "f32x4.splat" (f32.const 1.5)) (v128.const f32x4 1.5 1.5 1.5 1.5))
+(assert_return (invoke "f32x4.splat" (f32.const -1.5)) (v128.const f32x4 -1.5 -1.5 -1.5 -1.5))
+(assert_return (invoke "f32x4.splat" (f32.const 2.5)) (v128.const f32x4 2.5 2.5 2.5 2.5))
+(assert_return (invoke "f32x4.splat" (f32.const -2.5)) (v128.const f32x4 -2.5 -2.5 -2.5 -2.5))
+(assert_return (invoke "f32x4.splat" (f32.const 3.0)) (v128.const f32x4 3.0 3.0 3.0 3.0))
+(assert_return (invoke "f32x4.splat" (f32.const -3.5)) (v128.const f32x4 -3.5 -3.5 -3.5 -3.5))
+(assert_return (invoke "f32x4.splat" (f32.const 0.10000000149011612)) (v128.const f32x4 0.10000000149011612 0.10000000149011612 0.10000000149011612 0.10000000149011612))
+(assert_return (invoke "f32x4.splat" (f32.const -123456.7890625)) (v128.const f32x4 -123456.7890625 -123456.7890625 -123456.7890625 -123456.7890625))
+(assert_return (invoke "f32x4.splat" (f32.const 10000000000.0)) (v128.const f32x4 10000000000.0 10000000000.0 10000000000.0 10000000000.0))
+(assert_return (invoke "f32x4.splat" (f32.const -1.000000013351432e-10)) (v128.const f32x4 -1.000000013351432e-10 -1.000000013351432e-10 -1.000000013351432e-10 -1.000000013351432e-10))
+(assert_return (invoke "f32x4.splat" (f32.const inf)) (v128.const f32x4 inf inf inf inf))
+(assert_return (invoke "f32x4.splat" (f32.const -inf)) (v128.const f32x4 -inf -inf -inf -inf))
+(assert_return (invoke "f32x4.splat" (f32.const 3.4028234663852886e+38)) (v128.const f32x4 3.4028234663852886e+38 3.4028234663852886e+38 3.4028234663852886e+38 3.4028234663852886e+38))
+(assert_return (invoke "f32x4.splat" (f32.const -3.4028234663852886e+38)) (v128.const f32x4 -3.4028234663852886e+38 -3.4028234663852886e+38 -3.4028234663852886e+38 -3.4028234663852886e+38))
+(assert_return (invoke "f32x4.splat" (f32.const 1.1754943508222875e-38)) (v128.const f32x4 1.1754943508222875e-38 1.1754943508222875e-38 1.1754943508222875e-38 1.1754943508222875e-38))
+(assert_return (invoke "f32x4.splat" (f32.const 1.401298464324817e-45)) (v128.const f32x4 1.401298464324817e-45 1.401298464324817e-45 1.401298464324817e-45 1.401298464324817e-45))
+(assert_return (invoke "f32x4.splat" (f32.const -1.401298464324817e-45)) (v128.const f32x4 -1.401298464324817e-45 -1.401298464324817e-45 -1.401298464324817e-45 -1.401298464324817e-45))
+(assert_return (invoke "f64x2.splat" (f64.const 0.0)) (v128.const f64x2 0.0 0.0))
+(assert_return (invoke "f64x2.splat" (f64.const -0.0)) (v128.const f64x2 -0.0 -0.0))
+(assert_return (invoke "f64x2.splat" (f64.const 1.0)) (v128.const f64x2 1.0 1.0))
+(assert_return (invoke "f64x2.splat" (f64.const -1.0)) (v128.const f64x2 -1.0 -1.0))
+(assert_return (invoke "f64x2.splat" (f64.const 0.5)) (v128.const f64x2 0.5 0.5))
+(assert_return (invoke "f64x2.splat" (f64.const -0.5)) (v128.const f64x2 -0.5 -0.5))
+(assert_return (invoke "f64x2.splat" (f64.const 1.5)) (v128.const f64x2 1.5 1.5))
+(assert_return (invoke "f64x2.splat" (f64.const -1.5)) (v128.const f64x2 -1.5 -1.5))
+(assert_return (invoke "f64x2.splat" (f64.const 2.5)) (v128.const f64x2 2.5 2.5))
+(assert_return (invoke "f64x2.splat" (f64.const -2.5)) (v128.const f64x2 -2.5 -2.5))
+(assert_return (invoke "f64x2.splat" (f64.const 3.0)) (v128.const f64x2 3.0 3.0))
+(assert_return (invoke "f64x2.splat" (f64.const -3.5)) (v128.const f64x2 -3.5 -3.5))
+(assert_return (invoke "f64x2.splat" (f64.const 0.1)) (v128.const f64x2 0.1 0.1))
+(assert_return (invoke "f64x2.splat" (f64.const -123456.789)) (v128.const f64x2 -123456.789 -123456.789))
+(assert_return (invoke "f64x2.splat" (f64.const 10000000000.0)) (v128.const f64x2 10000000000.0 10000000000.0))
+(assert_return (invoke "f64x2.splat" (f64.const -1e-10)) (v128.const f64x2 -1e-10 -1e-10))
+(assert_return (invoke "f64x2.splat" (f64.const inf)) (v128.const f64x2 inf inf))
+(assert_return (invoke "f64x2.splat" (f64.const -inf)) (v128.const f64x2 -inf -inf))
+(assert_return (invoke "f64x2.splat" (f64.const 1.7976931348623157e+308)) (v128.const f64x2 1.7976931348623157e+308 1.7976931348623157e+308))
+(assert_return (invoke "f64x2.splat" (f64.const -1.7976931348623157e+308)) (v128.const f64x2 -1.7976931348623157e+308 -1.7976931348623157e+308))
+(assert_return (invoke "f64x2.splat" (f64.const 2.2250738585072014e-308)) (v128.const f64x2 2.2250738585072014e-308 2.2250738585072014e-308))
+(assert_return (invoke "f64x2.splat" (f64.const 5e-324)) (v128.const f64x2 5e-324 5e-324))
+(assert_return (invoke "f64x2.splat" (f64.const -5e-324)) (v128.const f64x2 -5e-324 -5e-324))
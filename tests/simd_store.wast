@@ -0,0 +1,25 @@
+;; Tests for the v128 store operations
+
+(module
+  (memory 1)
+  (data (i32.const 0) "\0b\30\55\7a\9f\c4\e9\0e\32\59\7c\a3\c6\ed\10\37")
+  (data (i32.const 16) "\59\82\a7\c8\ed\16\3b\5c\80\ab\ce\f1\14\3f\62\85")
+  (data (i32.const 32) "\af\d4\f1\1e\3b\60\8d\aa\d6\fd\18\47\62\89\b4\d3")
+  (data (i32.const 48) "\fd\26\43\6c\89\b2\df\f8\24\4f\6a\95\b0\db\06\21")
+
+  (func (export "v128.store") (param i32 v128) (result v128) (v128.store (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store-offset") (param i32 v128) (result v128) (v128.store offset=16 align=1 (local.get 0) (local.get 1)) (v128.load offset=16 (local.get 0)))
+  (func (export "load") (param i32) (result v128) (v128.load (local.get 0)))
+)
+
+(assert_return (invoke "v128.store" (i32.const 0) (v128.const i32x4 1767983912 -902367349 -787047597 -819757360)) (v128.const i32x4 1767983912 -902367349 -787047597 -819757360))
+(assert_return (invoke "v128.store" (i32.const 5) (v128.const i32x4 163235975 -1050265267 985309405 -1788672927)) (v128.const i32x4 163235975 -1050265267 985309405 -1788672927))
+(assert_return (invoke "v128.store" (i32.const 23) (v128.const i32x4 -1293497402 -1820050153 -626032617 1959900109)) (v128.const i32x4 -1293497402 -1820050153 -626032617 1959900109))
+(assert_return (invoke "v128.store-offset" (i32.const 0) (v128.const i32x4 813183165 356595995 1318577264 -1930079008)) (v128.const i32x4 813183165 356595995 1318577264 -1930079008))
+(assert_return (invoke "v128.store-offset" (i32.const 5) (v128.const i32x4 1769147098 -159721497 -225091874 848066008)) (v128.const i32x4 1769147098 -159721497 -225091874 848066008))
+(assert_return (invoke "v128.store-offset" (i32.const 23) (v128.const i32x4 -82866151 -1883234765 -1620524755 -1821855579)) (v128.const i32x4 -82866151 -1883234765 -1620524755 -1821855579))
+(assert_return (invoke "load" (i32.const 0)) (v128.const i8x16 40 75 97 105 -117 -121 -56 -70 9 77 57 102 -63 -35 -96 -70))
+(assert_return (invoke "load" (i32.const 8)) (v128.const i8x16 9 77 57 102 -63 -35 -96 -70 -67 48 120 48 27 -38 10 115))
+(assert_return (invoke "load" (i32.const 16)) (v128.const i8x16 -67 48 120 48 27 -38 10 115 105 -25 -41 122 -10 -34 94 -107))
+(assert_return (invoke "load" (i32.const 32)) (v128.const i8x16 -14 -40 117 -116 50 -47 116 25 -112 15 -5 51 30 -64 -113 45))
+(assert_trap (invoke "v128.store" (i32.const 65521) (v128.const i32x4 0 0 0 0)) "out of bounds memory access")
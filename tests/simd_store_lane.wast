@@ -0,0 +1,56 @@
+;; Tests for the v128 store lane operations
+
+(module
+  (memory 1)
+  (data (i32.const 0) "\0b\30\55\7a\9f\c4\e9\0e\32\59\7c\a3\c6\ed\10\37")
+  (data (i32.const 16) "\59\82\a7\c8\ed\16\3b\5c\80\ab\ce\f1\14\3f\62\85")
+  (data (i32.const 32) "\af\d4\f1\1e\3b\60\8d\aa\d6\fd\18\47\62\89\b4\d3")
+  (data (i32.const 48) "\fd\26\43\6c\89\b2\df\f8\24\4f\6a\95\b0\db\06\21")
+
+  (func (export "load") (param i32) (result v128) (v128.load (local.get 0)))
+  (func (export "v128.store8_lane-0") (param i32 v128) (result v128) (v128.store8_lane 0 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store8_lane-1") (param i32 v128) (result v128) (v128.store8_lane 1 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store8_lane-15") (param i32 v128) (result v128) (v128.store8_lane 15 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store16_lane-0") (param i32 v128) (result v128) (v128.store16_lane 0 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store16_lane-1") (param i32 v128) (result v128) (v128.store16_lane 1 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store16_lane-7") (param i32 v128) (result v128) (v128.store16_lane 7 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store32_lane-0") (param i32 v128) (result v128) (v128.store32_lane 0 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store32_lane-1") (param i32 v128) (result v128) (v128.store32_lane 1 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store32_lane-3") (param i32 v128) (result v128) (v128.store32_lane 3 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store64_lane-0") (param i32 v128) (result v128) (v128.store64_lane 0 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+  (func (export "v128.store64_lane-1") (param i32 v128) (result v128) (v128.store64_lane 1 (local.get 0) (local.get 1)) (v128.load (local.get 0)))
+)
+
+(assert_return (invoke "v128.store8_lane-0" (i32.const 0) (v128.const i8x16 -110 15 -114 81 83 117 76 -21 -15 -110 -23 -82 120 111 -26 -119)) (v128.const i8x16 -110 48 85 122 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store8_lane-0" (i32.const 3) (v128.const i8x16 59 116 -28 -25 61 -85 18 -100 -93 103 23 95 75 49 90 77)) (v128.const i8x16 59 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 -126 -89))
+(assert_return (invoke "v128.store8_lane-0" (i32.const 17) (v128.const i8x16 62 -126 12 -26 43 88 121 54 -8 -60 43 -119 -3 -25 -7 -19)) (v128.const i8x16 62 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store8_lane-1" (i32.const 0) (v128.const i8x16 120 60 121 81 -107 97 -120 -38 92 78 3 45 102 -86 -125 12)) (v128.const i8x16 60 48 85 59 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store8_lane-1" (i32.const 3) (v128.const i8x16 -5 101 -48 -61 -115 -90 114 -13 -33 -119 84 -12 -60 -124 29 -18)) (v128.const i8x16 101 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 62 -89))
+(assert_return (invoke "v128.store8_lane-1" (i32.const 17) (v128.const i8x16 -13 101 -107 35 107 18 26 22 61 -51 57 34 117 -105 -87 -17)) (v128.const i8x16 101 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store8_lane-15" (i32.const 0) (v128.const i8x16 49 -88 62 48 -108 -109 24 77 95 19 -99 -24 95 -127 -99 69)) (v128.const i8x16 69 48 85 101 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store8_lane-15" (i32.const 3) (v128.const i8x16 4 117 -11 17 125 126 -119 -119 -64 -95 -6 2 -47 -71 15 -56)) (v128.const i8x16 -56 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 101 -89))
+(assert_return (invoke "v128.store8_lane-15" (i32.const 17) (v128.const i8x16 75 32 -117 72 24 -81 -53 -45 4 111 -48 -53 -51 70 115 60)) (v128.const i8x16 60 -89 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store16_lane-0" (i32.const 0) (v128.const i16x8 -19620 -17923 -5741 24564 23188 23725 30026 29167)) (v128.const i8x16 92 -77 85 -56 -97 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store16_lane-0" (i32.const 3) (v128.const i16x8 -9627 26745 -14475 1109 -19472 -31681 -30094 -31994)) (v128.const i8x16 101 -38 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 60 -89))
+(assert_return (invoke "v128.store16_lane-0" (i32.const 17) (v128.const i16x8 -19365 -21142 17677 -13999 -1568 1832 -31393 -9937)) (v128.const i8x16 91 -76 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store16_lane-1" (i32.const 0) (v128.const i16x8 -18549 -10250 29125 -19773 -22230 -14336 -19638 -5132)) (v128.const i8x16 -10 -41 85 101 -38 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store16_lane-1" (i32.const 3) (v128.const i16x8 29818 18471 -26861 -31427 23879 21605 -11041 -29977)) (v128.const i8x16 39 72 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 91 -76))
+(assert_return (invoke "v128.store16_lane-1" (i32.const 17) (v128.const i16x8 27065 24041 -5207 13333 7828 -22866 8679 31441)) (v128.const i8x16 -23 93 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store16_lane-7" (i32.const 0) (v128.const i16x8 30218 8827 -9628 -32425 31995 -20365 -17679 25241)) (v128.const i8x16 -103 98 85 39 72 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store16_lane-7" (i32.const 3) (v128.const i16x8 -30470 18607 -9402 18913 -11667 17511 -19909 23084)) (v128.const i8x16 44 90 -60 -23 14 50 89 124 -93 -58 -19 16 55 89 -23 93))
+(assert_return (invoke "v128.store16_lane-7" (i32.const 17) (v128.const i16x8 1945 -23578 -19537 -21354 18037 -13979 3065 13034)) (v128.const i8x16 -22 50 -56 -19 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store32_lane-0" (i32.const 0) (v128.const i32x4 1249432213 1734663896 -101406442 1342811567)) (v128.const i8x16 -107 -46 120 74 90 -60 -23 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store32_lane-0" (i32.const 3) (v128.const i32x4 2063791085 -519847001 1172019925 -382353513)) (v128.const i8x16 -19 -13 2 123 14 50 89 124 -93 -58 -19 16 55 89 -22 50))
+(assert_return (invoke "v128.store32_lane-0" (i32.const 17) (v128.const i32x4 -569429212 -1579282181 -819156449 -738173167)) (v128.const i8x16 36 51 15 -34 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store32_lane-1" (i32.const 0) (v128.const i32x4 -320192331 -1577617388 1586852524 -887924014)) (v128.const i8x16 20 120 -9 -95 -13 2 123 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store32_lane-1" (i32.const 3) (v128.const i32x4 -1783802630 -548881567 -289917375 278033621)) (v128.const i8x16 97 -69 72 -33 14 50 89 124 -93 -58 -19 16 55 89 36 51))
+(assert_return (invoke "v128.store32_lane-1" (i32.const 17) (v128.const i32x4 -1218421569 -70111957 -1215143325 -1193450869)) (v128.const i8x16 43 45 -46 -5 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store32_lane-3" (i32.const 0) (v128.const i32x4 -1179727735 -1999148157 1631823726 685498366)) (v128.const i8x16 -2 -33 -37 40 -69 72 -33 14 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store32_lane-3" (i32.const 3) (v128.const i32x4 1041856293 1276006486 -2140806342 580609884)) (v128.const i8x16 92 103 -101 34 14 50 89 124 -93 -58 -19 16 55 89 43 45))
+(assert_return (invoke "v128.store32_lane-3" (i32.const 17) (v128.const i32x4 1033480403 -4007914 1654778429 -419565769)) (v128.const i8x16 55 -17 -3 -26 22 59 92 -128 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store64_lane-0" (i32.const 0) (v128.const i64x2 -4503249986467258122 9134535532717220449)) (v128.const i8x16 -10 32 -42 29 -1 61 -127 -63 50 89 124 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store64_lane-0" (i32.const 3) (v128.const i64x2 -1403292719148677088 3449699944467072891)) (v128.const i8x16 32 72 64 -9 -76 -128 -122 -20 -93 -58 -19 16 55 89 55 -17))
+(assert_return (invoke "v128.store64_lane-0" (i32.const 17) (v128.const i64x2 -8080961073566121695 6684656392870279503)) (v128.const i8x16 33 1 85 -26 -73 -88 -38 -113 -85 -50 -15 20 63 98 -123 -81))
+(assert_return (invoke "v128.store64_lane-1" (i32.const 0) (v128.const i64x2 -7078548037233088906 -6188280176985969464)) (v128.const i8x16 -56 -20 40 72 -9 -49 30 -86 -128 -122 -20 -93 -58 -19 16 55))
+(assert_return (invoke "v128.store64_lane-1" (i32.const 3) (v128.const i64x2 -2256945365589438957 -3700969223604924181)) (v128.const i8x16 -21 16 96 -122 25 -124 -93 -52 -93 -58 -19 16 55 89 33 1))
+(assert_return (invoke "v128.store64_lane-1" (i32.const 17) (v128.const i64x2 -9105249851408809068 -7443171894922608423)) (v128.const i8x16 -39 -128 -9 -32 -104 -118 -76 -104 -85 -50 -15 20 63 98 -123 -81))
@@ -0,0 +1,47 @@
+;; Test that state changed after instantiation is seen by later calls,
+;; e.g. when the instance is stored statically (--single-instance)
+
+(module
+  (global $g (mut i32) (i32.const 1))
+  (global $h (mut i64) (i64.const 2))
+  (memory 1 3)
+  (table 2 funcref)
+  (elem (i32.const 0) $get-g)
+
+  (type $get (func (result i32)))
+
+  (func $init
+    (global.set $g (i32.const 7))
+    (i32.store (i32.const 0) (i32.const 11))
+  )
+  (start $init)
+
+  (func (export "set-g") (param i32) (global.set $g (local.get 0)))
+  (func $get-g (export "get-g") (result i32) (global.get $g))
+  (func (export "set-h") (param i64) (global.set $h (local.get 0)))
+  (func (export "get-h") (result i64) (global.get $h))
+  (func (export "call-get-g") (result i32) (call_indirect (type $get) (i32.const 0)))
+
+  (func (export "grow") (result i32) (memory.grow (i32.const 1)))
+  (func (export "size") (result i32) (memory.size))
+  (func (export "store") (param i32 i32) (i32.store (local.get 0) (local.get 1)))
+  (func (export "load") (param i32) (result i32) (i32.load (local.get 0)))
+)
+
+(assert_return (invoke "get-g") (i32.const 7))
+(assert_return (invoke "load" (i32.const 0)) (i32.const 11))
+
+(invoke "set-g" (i32.const 42))
+(assert_return (invoke "get-g") (i32.const 42))
+(assert_return (invoke "call-get-g") (i32.const 42))
+
+(invoke "set-h" (i64.const -1))
+(assert_return (invoke "get-h") (i64.const -1))
+(assert_return (invoke "get-g") (i32.const 42))
+
+(assert_return (invoke "size") (i32.const 1))
+(assert_return (invoke "grow") (i32.const 1))
+(assert_return (invoke "size") (i32.const 2))
+(invoke "store" (i32.const 65536) (i32.const 13))
+(assert_return (invoke "load" (i32.const 65536)) (i32.const 13))
+(assert_return (invoke "load" (i32.const 0)) (i32.const 11))
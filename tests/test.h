@@ -28,6 +28,13 @@ assertEqualF64(
     const char *description
 );
 
+void
+assertEqualV128(
+    V128 actual,
+    V128 expected,
+    const char *description
+);
+
 void
 printStart(
     const char* name
@@ -0,0 +1,304 @@
+#include "boundscheck.h"
+
+/* Marks a stack entry whose value is not known to be the value of a local */
+#define WASM_BOUNDS_CHECK_UNKNOWN UINT32_MAX
+
+#define WASM_BOUNDS_CHECK_MAX_STACK 64
+
+U32
+wasmBoundsCheckAccessLength(
+    const WasmOpcode opcode
+) {
+    switch (opcode) {
+        case wasmOpcodeI32Load8S:
+        case wasmOpcodeI32Load8U:
+        case wasmOpcodeI64Load8S:
+        case wasmOpcodeI64Load8U:
+        case wasmOpcodeI32Store8:
+        case wasmOpcodeI64Store8:
+            return 1;
+        case wasmOpcodeI32Load16S:
+        case wasmOpcodeI32Load16U:
+        case wasmOpcodeI64Load16S:
+        case wasmOpcodeI64Load16U:
+        case wasmOpcodeI32Store16:
+        case wasmOpcodeI64Store16:
+            return 2;
+        case wasmOpcodeI32Load:
+        case wasmOpcodeF32Load:
+        case wasmOpcodeI64Load32S:
+        case wasmOpcodeI64Load32U:
+        case wasmOpcodeI32Store:
+        case wasmOpcodeF32Store:
+        case wasmOpcodeI64Store32:
+            return 4;
+        case wasmOpcodeI64Load:
+        case wasmOpcodeF64Load:
+        case wasmOpcodeI64Store:
+        case wasmOpcodeF64Store:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+U32
+wasmBoundsCheckSIMDAccessLength(
+    const WasmSIMDOpcode simdOpcode
+) {
+    switch (simdOpcode) {
+        case wasmSIMDOpcodeV128Load8Splat:
+        case wasmSIMDOpcodeV128Load8Lane:
+        case wasmSIMDOpcodeV128Store8Lane:
+            return 1;
+        case wasmSIMDOpcodeV128Load16Splat:
+        case wasmSIMDOpcodeV128Load16Lane:
+        case wasmSIMDOpcodeV128Store16Lane:
+            return 2;
+        case wasmSIMDOpcodeV128Load32Splat:
+        case wasmSIMDOpcodeV128Load32Zero:
+        case wasmSIMDOpcodeV128Load32Lane:
+        case wasmSIMDOpcodeV128Store32Lane:
+            return 4;
+        case wasmSIMDOpcodeV128Load8x8S:
+        case wasmSIMDOpcodeV128Load8x8U:
+        case wasmSIMDOpcodeV128Load16x4S:
+        case wasmSIMDOpcodeV128Load16x4U:
+        case wasmSIMDOpcodeV128Load32x2S:
+        case wasmSIMDOpcodeV128Load32x2U:
+        case wasmSIMDOpcodeV128Load64Splat:
+        case wasmSIMDOpcodeV128Load64Zero:
+        case wasmSIMDOpcodeV128Load64Lane:
+        case wasmSIMDOpcodeV128Store64Lane:
+            return 8;
+        case wasmSIMDOpcodeV128Load:
+        case wasmSIMDOpcodeV128Store:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+static
+bool
+wasmBoundsCheckAccessesContain(
+    const WasmBoundsCheckAccesses* accesses,
+    const WasmInstruction* position
+) {
+    U32 index = 0;
+    for (; index < accesses->count; index++) {
+        if (accesses->positions[index] == position) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+wasmBoundsCheckAccessesRemove(
+    WasmBoundsCheckAccesses* accesses,
+    const WasmInstruction* position
+) {
+    U32 index = 0;
+    for (; index < accesses->count; index++) {
+        if (accesses->positions[index] == position) {
+            accesses->count--;
+            accesses->positions[index] = accesses->positions[accesses->count];
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * wasmBoundsCheckStackEffect returns the number of values popped and pushed
+ * by the given opcode, if it has no side effect and cannot trap.
+ */
+static
+bool
+wasmBoundsCheckStackEffect(
+    const WasmOpcode opcode,
+    U32* popCount,
+    U32* pushCount
+) {
+    *pushCount = 1;
+
+    if (opcode == wasmOpcodeI32Eqz
+        || opcode == wasmOpcodeI64Eqz
+        || (opcode >= wasmOpcodeI32Clz && opcode <= wasmOpcodeI32PopCnt)
+        || (opcode >= wasmOpcodeI64Clz && opcode <= wasmOpcodeI64PopCnt)
+        || (opcode >= wasmOpcodeF32Abs && opcode <= wasmOpcodeF32Sqrt)
+        || (opcode >= wasmOpcodeF64Abs && opcode <= wasmOpcodeF64Sqrt)
+        || opcode == wasmOpcodeI32WrapI64
+        || opcode == wasmOpcodeI64ExtendI32S
+        || opcode == wasmOpcodeI64ExtendI32U
+        || (opcode >= wasmOpcodeF32ConvertI32S && opcode <= wasmOpcodeF64ReinterpretI64)
+        || (opcode >= wasmOpcodeI32Extend8S && opcode <= wasmOpcodeI64Extend32S)
+    ) {
+        *popCount = 1;
+        return true;
+    }
+
+    if ((opcode >= wasmOpcodeI32Eq && opcode <= wasmOpcodeI32GeU)
+        || (opcode >= wasmOpcodeI64Eq && opcode <= wasmOpcodeI64GeU)
+        || (opcode >= wasmOpcodeF32Eq && opcode <= wasmOpcodeF64Ge)
+        || (opcode >= wasmOpcodeI32Add && opcode <= wasmOpcodeI32Mul)
+        || (opcode >= wasmOpcodeI32And && opcode <= wasmOpcodeI32Rotr)
+        || (opcode >= wasmOpcodeI64Add && opcode <= wasmOpcodeI64Mul)
+        || (opcode >= wasmOpcodeI64And && opcode <= wasmOpcodeI64Rotr)
+        || (opcode >= wasmOpcodeF32Add && opcode <= wasmOpcodeF32CopySign)
+        || (opcode >= wasmOpcodeF64Add && opcode <= wasmOpcodeF64CopySign)
+    ) {
+        *popCount = 2;
+        return true;
+    }
+
+    return false;
+}
+
+static
+U32
+wasmBoundsCheckPop(
+    const U32* stack,
+    U32* stackLength
+) {
+    if (*stackLength == 0) {
+        return WASM_BOUNDS_CHECK_UNKNOWN;
+    }
+    (*stackLength)--;
+    return stack[*stackLength];
+}
+
+bool
+wasmBoundsCheckScan(
+    const WasmInstruction* instructions,
+    const size_t instructionCount,
+    const U32 localIndex,
+    WasmBoundsCheckAccesses* accesses,
+    U32* offset,
+    U32* length
+) {
+    /* Stack of local indices, starting with the value of the local.get */
+    U32 stack[WASM_BOUNDS_CHECK_MAX_STACK];
+    U32 stackLength = 1;
+
+    U64 maxEnd = 0;
+    bool found = false;
+    size_t instructionIndex = 0;
+
+    stack[0] = localIndex;
+
+    for (; instructionIndex < instructionCount; instructionIndex++) {
+        const WasmInstruction* instruction = &instructions[instructionIndex];
+        const WasmOpcode opcode = instruction->opcode;
+        U32 popCount = 0;
+        U32 pushCount = 0;
+
+        /* Each instruction pushes at most one value */
+        if (stackLength >= WASM_BOUNDS_CHECK_MAX_STACK) {
+            break;
+        }
+
+        if (wasmBoundsCheckStackEffect(opcode, &popCount, &pushCount)) {
+            U32 index = 0;
+            for (; index < popCount; index++) {
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+            }
+            for (index = 0; index < pushCount; index++) {
+                stack[stackLength++] = WASM_BOUNDS_CHECK_UNKNOWN;
+            }
+            continue;
+        }
+
+        switch (opcode) {
+            case wasmOpcodeNop:
+                continue;
+
+            case wasmOpcodeDrop:
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+                continue;
+
+            case wasmOpcodeSelect:
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+                stack[stackLength++] = WASM_BOUNDS_CHECK_UNKNOWN;
+                continue;
+
+            case wasmOpcodeI32Const:
+            case wasmOpcodeI64Const:
+            case wasmOpcodeF32Const:
+            case wasmOpcodeF64Const:
+            case wasmOpcodeGlobalGet:
+                stack[stackLength++] = WASM_BOUNDS_CHECK_UNKNOWN;
+                continue;
+
+            case wasmOpcodeLocalGet:
+                stack[stackLength++] = instruction->immediates.local.localIndex;
+                continue;
+
+            case wasmOpcodeLocalSet:
+            case wasmOpcodeLocalTee: {
+                const U32 assignedLocalIndex = instruction->immediates.local.localIndex;
+                U32 index = 0;
+                /* Accesses after an assignment to the base use another address */
+                if (assignedLocalIndex == localIndex) {
+                    break;
+                }
+                (void) wasmBoundsCheckPop(stack, &stackLength);
+                /* Values on the stack are from before the assignment */
+                for (; index < stackLength; index++) {
+                    if (stack[index] == assignedLocalIndex) {
+                        stack[index] = WASM_BOUNDS_CHECK_UNKNOWN;
+                    }
+                }
+                if (opcode == wasmOpcodeLocalTee) {
+                    stack[stackLength++] = assignedLocalIndex;
+                }
+                continue;
+            }
+
+            default: {
+                const U32 accessLength = wasmBoundsCheckAccessLength(opcode);
+                const bool isStore = opcode >= wasmOpcodeI32Store;
+                const U32 accessOffset = instruction->immediates.memoryArgument.offset;
+                U32 address = 0;
+
+                if (accessLength == 0) {
+                    break;
+                }
+
+                if (isStore) {
+                    (void) wasmBoundsCheckPop(stack, &stackLength);
+                }
+                address = wasmBoundsCheckPop(stack, &stackLength);
+
+                if (address == localIndex
+                    && !wasmBoundsCheckAccessesContain(accesses, instruction)
+                    && accesses->count < WASM_BOUNDS_CHECK_MAX_ACCESSES
+                ) {
+                    const U64 end = (U64) accessOffset + accessLength;
+                    accesses->positions[accesses->count++] = instruction;
+                    if (!found || end > maxEnd) {
+                        maxEnd = end;
+                        *offset = accessOffset;
+                        *length = accessLength;
+                    }
+                    found = true;
+                }
+
+                /* A store is a side effect, so later accesses must not be checked before it */
+                if (isStore) {
+                    break;
+                }
+
+                stack[stackLength++] = WASM_BOUNDS_CHECK_UNKNOWN;
+                continue;
+            }
+        }
+
+        break;
+    }
+
+    return found;
+}
@@ -0,0 +1,81 @@
+#ifndef W2C2_BOUNDSCHECK_H
+#define W2C2_BOUNDSCHECK_H
+
+#include "w2c2_base.h"
+#include "opcode.h"
+#include "code.h"
+
+typedef enum WasmBoundsCheckMode {
+    /* Rely on the runtime (e.g. guard pages) */
+    wasmBoundsCheckModeNone,
+    /* Check loads and stores explicitly, merging checks of accesses with the same base */
+    wasmBoundsCheckModeChecked
+} WasmBoundsCheckMode;
+
+#define WASM_BOUNDS_CHECK_MAX_ACCESSES 32
+
+/*
+ * WasmBoundsCheckAccesses is the set of memory accesses which are already covered
+ * by a previously emitted bounds check. Accesses are identified by their instruction
+ * in the function's code.
+ */
+typedef struct WasmBoundsCheckAccesses {
+    const WasmInstruction* positions[WASM_BOUNDS_CHECK_MAX_ACCESSES];
+    U32 count;
+} WasmBoundsCheckAccesses;
+
+static const WasmBoundsCheckAccesses wasmEmptyBoundsCheckAccesses = {{NULL}, 0};
+
+/*
+ * wasmBoundsCheckAccessLength returns the number of bytes accessed by the given
+ * load or store opcode, or 0 if the opcode is not a load or store.
+ */
+U32
+wasmBoundsCheckAccessLength(
+    WasmOpcode opcode
+);
+
+/*
+ * wasmBoundsCheckSIMDAccessLength returns the number of bytes accessed by the given
+ * SIMD load or store opcode, or 0 if the opcode is not a load or store.
+ */
+U32
+wasmBoundsCheckSIMDAccessLength(
+    WasmSIMDOpcode simdOpcode
+);
+
+/*
+ * wasmBoundsCheckScan scans the given straight-line instructions following a local.get
+ * of the given local for loads and stores using the local's value as their address.
+ *
+ * The scan stops at the first instruction which has a side effect,
+ * may trap for another reason, or transfers control, so a single check
+ * at the position of the local.get is equivalent to checking each access.
+ *
+ * All found accesses which are not already covered are added to the given set.
+ * Returns true if any access was added, and stores the offset and length
+ * of the access with the highest end address into the given results.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmBoundsCheckScan(
+    const WasmInstruction* instructions,
+    size_t instructionCount,
+    U32 localIndex,
+    WasmBoundsCheckAccesses* accesses,
+    U32* offset,
+    U32* length
+);
+
+/*
+ * wasmBoundsCheckAccessesRemove removes the access at the given position from the set.
+ * Returns true if the access was covered.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmBoundsCheckAccessesRemove(
+    WasmBoundsCheckAccesses* accesses,
+    const WasmInstruction* position
+);
+
+#endif /* W2C2_BOUNDSCHECK_H */
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <string.h>
+#include "boundscheck.h"
+#include "boundscheck_test.h"
+
+typedef struct BoundsCheckScanTest {
+    U8 code[32];
+    size_t codeLength;
+    bool found;
+    U32 offset;
+    U32 length;
+    U32 count;
+} BoundsCheckScanTest;
+
+void
+testBoundsCheckScan(void) {
+    /* Code following a local.get of local 0 */
+    static BoundsCheckScanTest tests[] = {
+        /* i32.load offset=4; drop; local.get 0; i64.load offset=16 */
+        {{0x28, 0x02, 0x04, 0x1A, 0x20, 0x00, 0x29, 0x03, 0x10}, 9, true, 16, 8, 2},
+        /* local.get 1; i32.store offset=8; local.get 0; i32.load offset=32 */
+        {{0x20, 0x01, 0x36, 0x02, 0x08, 0x20, 0x00, 0x28, 0x02, 0x20}, 10, true, 8, 4, 1},
+        /* i32.load8_u offset=1; local.set 0; local.get 0; i32.load offset=8 */
+        {{0x2D, 0x00, 0x01, 0x21, 0x00, 0x20, 0x00, 0x28, 0x02, 0x08}, 10, true, 1, 1, 1},
+        /* i32.const 4; i32.add; i32.load */
+        {{0x41, 0x04, 0x6A, 0x28, 0x02, 0x00}, 6, false, 0, 0, 0},
+        /* call 0; i32.load */
+        {{0x10, 0x00, 0x28, 0x02, 0x00}, 5, false, 0, 0, 0},
+        /* local.get 1; i32.div_u; drop; local.get 0; i32.load */
+        {{0x20, 0x01, 0x6E, 0x1A, 0x20, 0x00, 0x28, 0x02, 0x00}, 9, false, 0, 0, 0}
+    };
+
+    /* A module with a function import, which is called by the tests */
+    WasmFunctionType functionType = wasmEmptyFunctionType;
+    WasmFunctionImport functionImport = wasmEmptyFunctionImport;
+    WasmModule module;
+    WasmCode code = wasmEmptyCode;
+
+    size_t index = 0;
+
+    memset(&module, 0, sizeof(WasmModule));
+    module.functionTypes.functionTypes = &functionType;
+    module.functionTypes.count = 1;
+    module.functionImports.imports = &functionImport;
+    module.functionImports.length = 1;
+
+    for (; index < sizeof(tests) / sizeof(BoundsCheckScanTest); index++) {
+        const BoundsCheckScanTest test = tests[index];
+        WasmBoundsCheckAccesses accesses = wasmEmptyBoundsCheckAccesses;
+        WasmFunction function = wasmEmptyFunction;
+        U32 offset = 0;
+        U32 length = 0;
+        bool found = false;
+
+        function.code.data = tests[index].code;
+        function.code.length = test.codeLength;
+
+        if (!wasmCodeDecode(&module, function, &code)) {
+            fprintf(stderr, "FAIL testBoundsCheckScan %lu: failed to decode code\n", index);
+            exit(1);
+        }
+
+        found = wasmBoundsCheckScan(
+            code.instructions.instructions,
+            code.instructions.length,
+            0,
+            &accesses,
+            &offset,
+            &length
+        );
+        if (found != test.found) {
+            fprintf(stderr, "FAIL testBoundsCheckScan %lu: incorrect result: %d != %d\n", index, found, test.found);
+            exit(1);
+        }
+        if (!found) {
+            continue;
+        }
+        if (offset != test.offset || length != test.length) {
+            fprintf(
+                stderr,
+                "FAIL testBoundsCheckScan %lu: incorrect range: %u+%u != %u+%u\n",
+                index,
+                offset,
+                length,
+                test.offset,
+                test.length
+            );
+            exit(1);
+        }
+        if (accesses.count != test.count) {
+            fprintf(
+                stderr,
+                "FAIL testBoundsCheckScan %lu: incorrect access count: %u != %u\n",
+                index,
+                accesses.count,
+                test.count
+            );
+            exit(1);
+        }
+
+        /* Accesses already covered are not checked again */
+        if (wasmBoundsCheckScan(
+            code.instructions.instructions,
+            code.instructions.length,
+            0,
+            &accesses,
+            &offset,
+            &length
+        )) {
+            fprintf(stderr, "FAIL testBoundsCheckScan %lu: covered access was found again\n", index);
+            exit(1);
+        }
+    }
+
+    wasmCodeFree(&code);
+
+    fprintf(stderr, "PASS testBoundsCheckScan\n");
+}
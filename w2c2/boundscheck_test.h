@@ -0,0 +1,7 @@
+#ifndef W2C2_BOUNDSCHECK_TEST_H
+#define W2C2_BOUNDSCHECK_TEST_H
+
+void
+testBoundsCheckScan(void);
+
+#endif /* W2C2_BOUNDSCHECK_TEST_H */
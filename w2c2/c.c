@@ -7,6 +7,9 @@
 #endif /* HAS_PTHREAD */
 #include <errno.h>
 #include <limits.h>
+#if HAS_UNISTD
+  #include <unistd.h>
+#endif /* HAS_UNISTD */
 #include "compat.h"
 #include "w2c2_base.h"
 
@@ -17,8 +20,18 @@
 #include "c.h"
 #include "stringbuilder.h"
 #include "instruction.h"
+#include "leb128.h"
+#include "code.h"
+#include "dataflow.h"
+#include "boundscheck.h"
 #include "typestack.h"
 #include "labelstack.h"
+#include "sha1.h"
+#include "file.h"
+#include "path.h"
+
+/* Size of the buffer of output files, so generated code is written in large blocks */
+static const size_t wasmCOutputBufferSize = 1024 * 1024;
 
 static const char localNamePrefix = 'l';
 static const char globalNamePrefix = 'g';
@@ -27,9 +40,12 @@ static const char dataSegmentNamePrefix = 'd';
 static const char tableNamePrefix = 't';
 static const char stackNamePrefix = 's';
 static const char labelNamePrefix = 'L';
+static const char* const memoryBaseName = "mem0";
+static const char* const cachedGlobalNamePrefix = "cg";
+static const char* const singleInstanceNameSuffix = "SingleInstance";
 
 static const char* const valueTypeNames[wasmValueType_count] = {
-    "U32", "U64", "F32", "F64"
+    "U32", "U64", "F32", "F64", "V128"
 };
 
 static const char* const signedTypeNames[2] = {
@@ -41,7 +57,7 @@ static const char* const shiftMaskStrings[2] = {
 };
 
 static const char valueTypeStackNames[wasmValueType_count] = {
-    'i', 'j', 'f', 'd'
+    'i', 'j', 'f', 'd', 'v'
 };
 
 static const char* const indentation = "  ";
@@ -496,32 +512,100 @@ wasmCWriteStringLabelName(
     return true;
 }
 
+static const char* const multiValueTypePrefix = "wasmMultiValue_";
+static const char* const multiValueGuardPrefix = "WASM_MULTI_VALUE_";
+static const char multiValueFieldPrefix = 'v';
+static const char* const multiValueVariableName = "r";
+
+/*
+ * Functions with multiple results return a struct,
+ * named after the result types, e.g. wasmMultiValue_ij for (result i32 i64)
+ */
 static
-W2C2_INLINE
-const char*
-wasmCGetReturnType(
+void
+wasmCWriteFileMultiValueTypeSuffix(
+    FILE* file,
+    const WasmFunctionType functionType
+) {
+    U32 resultIndex = 0;
+    for (; resultIndex < functionType.resultCount; resultIndex++) {
+        fputc(valueTypeStackNames[functionType.resultTypes[resultIndex]], file);
+    }
+}
+
+static
+void
+wasmCWriteFileReturnType(
+    FILE* file,
     const WasmFunctionType functionType
 ) {
     switch (functionType.resultCount) {
         case 0:
-            return "void";
-        case 1: {
-            const WasmValueType resultType = functionType.resultTypes[0];
-            return valueTypeNames[resultType];
-        }
+            fputs("void", file);
+            break;
+        case 1:
+            fputs(valueTypeNames[functionType.resultTypes[0]], file);
+            break;
         default:
-            /* TODO: add support for multiple result values */
-            fprintf(stderr, "w2c2: unsupported function with multiple result values\n");
-            abort();
+            fputs(multiValueTypePrefix, file);
+            wasmCWriteFileMultiValueTypeSuffix(file, functionType);
+            break;
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringReturnType(
+    StringBuilder* builder,
+    const WasmFunctionType functionType
+) {
+    switch (functionType.resultCount) {
+        case 0:
+            MUST (stringBuilderAppend(builder, "void"))
+            break;
+        case 1:
+            MUST (stringBuilderAppend(builder, valueTypeNames[functionType.resultTypes[0]]))
+            break;
+        default: {
+            U32 resultIndex = 0;
+            MUST (stringBuilderAppend(builder, multiValueTypePrefix))
+            for (; resultIndex < functionType.resultCount; resultIndex++) {
+                MUST (stringBuilderAppendChar(
+                    builder,
+                    valueTypeStackNames[functionType.resultTypes[resultIndex]]
+                ))
+            }
+            break;
+        }
     }
+    return true;
+}
+
+static
+W2C2_INLINE
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringMultiValueFieldName(
+    StringBuilder* builder,
+    const U32 resultIndex
+) {
+    MUST (stringBuilderAppendChar(builder, multiValueFieldPrefix))
+    MUST (stringBuilderAppendU32(builder, resultIndex))
+    return true;
 }
 
+/*
+ * wasmCWriteFileLocalsDeclarations writes the declarations of the function's locals.
+ * Locals are initialized to zero, unless they are always assigned before they are read.
+ */
 static
 void
 wasmCWriteFileLocalsDeclarations(
     FILE* file,
     const WasmModule* module,
     const WasmFunction function,
+    const WasmDataflow* dataflow,
     const bool pretty
 ) {
     const WasmFunctionType functionType = module->functionTypes.functionTypes[function.functionTypeIndex];
@@ -542,10 +626,157 @@ wasmCWriteFileLocalsDeclarations(
             fputs(valueTypeNames[localsDeclaration.type], file);
             fputc(' ', file);
             wasmCWriteFileLocalName(file, parameterCount + localIndex);
-            fputs(pretty ? " = 0;\n" : "=0;\n", file);
-        }
-    }
-}
+            if (!wasmDataflowLocalNeedsInitialization(dataflow, parameterCount + localIndex)) {
+                fputs(";\n", file);
+            } else if (localsDeclaration.type == wasmValueTypeV128) {
+                fputs(pretty ? " = v128_zero();\n" : "=v128_zero();\n", file);
+            } else {
+                fputs(pretty ? " = 0;\n" : "=0;\n", file);
+            }
+        }
+    }
+}
+
+/*
+ * WasmCFoldedValue is a stack entry whose value is computed by a pure expression,
+ * which is written as an assignment statement to the stack entry,
+ * but may still be moved into the expression of the instruction consuming the value
+ */
+typedef struct WasmCFoldedValue {
+    U32 stackIndex;
+    /* Start of the assignment statement in the function's code */
+    size_t statementStart;
+    /* Start and length of the expression in the function's code */
+    size_t expressionStart;
+    size_t expressionLength;
+    /* End of the assignment statement in the function's code */
+    size_t statementEnd;
+    /* Nesting depth of the expression */
+    U32 depth;
+    /* Set when the expression was moved into the expression of the current instruction */
+    bool consumed;
+} WasmCFoldedValue;
+
+ARRAY_TYPE(
+    WasmCFoldedValues,
+    WasmCFoldedValue,
+    wasmCFoldedValues,
+    values,
+    value
+)
+
+/*
+ * WasmCExpressionFolder tracks the folded values on the stack.
+ * Their assignment statements are always the last statements written,
+ * in the order of the stack, so the statements of consumed values can be removed
+ */
+typedef struct WasmCExpressionFolder {
+    WasmCFoldedValues values;
+    /* Set when the current instruction may move folded values into its expression */
+    bool consuming;
+    /* Start of the code of the current instruction */
+    size_t instructionStart;
+    /* Maximum nesting depth of the values consumed by the current instruction */
+    U32 depth;
+    /* The assignment of the current instruction's result, if any */
+    bool hasResult;
+    WasmCFoldedValue result;
+} WasmCExpressionFolder;
+
+static const WasmCExpressionFolder wasmCEmptyExpressionFolder = {
+    {0, 0, NULL},
+    false,
+    0,
+    0,
+    false,
+    {0, 0, 0, 0, 0, 0, false}
+};
+
+/*
+ * Maximum nesting depth of folded expressions.
+ * C89 compilers are only required to support 32 levels of nested parentheses
+ */
+static const U32 wasmCFoldMaxDepth = 8;
+
+/* WasmCGlobalUses are the uses of a global by a function */
+typedef struct WasmCGlobalUses {
+    /* Number of global.get and global.set instructions, weighted by their loop depth */
+    U32 count;
+    /* The global is assigned by the function, so it must be written back */
+    bool assigned;
+    /* The global is cached in a local variable */
+    bool cached;
+} WasmCGlobalUses;
+
+ARRAY_TYPE(
+    WasmCGlobalUsesArray,
+    WasmCGlobalUses,
+    wasmCGlobalUsesArray,
+    uses,
+    use
+)
+
+ARRAY_TYPE(
+    WasmCCachedGlobalIndices,
+    U32,
+    wasmCCachedGlobalIndices,
+    indices,
+    index
+)
+
+ARRAY_TYPE(
+    WasmCGlobalCacheBlocks,
+    bool,
+    wasmCGlobalCacheBlocks,
+    loops,
+    loop
+)
+
+/*
+ * WasmCGlobalCache holds the mutable globals used by a function,
+ * which are cached in local variables while the function runs.
+ * Assigned globals are written back before calls, returns and unreachable,
+ * and all cached globals are reloaded after calls
+ */
+typedef struct WasmCGlobalCache {
+    /* Uses of each global of the module */
+    WasmCGlobalUsesArray uses;
+    /* Indices of the cached globals */
+    WasmCCachedGlobalIndices indices;
+    /* Used while analyzing: whether each enclosing block is a loop */
+    WasmCGlobalCacheBlocks blocks;
+} WasmCGlobalCache;
+
+static const WasmCGlobalCache wasmCEmptyGlobalCache = {
+    {0, 0, NULL},
+    {0, 0, NULL},
+    {0, 0, NULL}
+};
+
+/*
+ * Maximum loop nesting depth considered when weighting the instructions of a function.
+ * Instructions in loops are assumed to run 8 times as often as the instructions around them
+ */
+static const U32 wasmCGlobalCacheMaxLoopDepth = 3;
+
+/*
+ * WasmCLoopParameter is a stack variable passed to the start of a loop.
+ * Branches to the start of the loop assign it, so it is used until the end of the loop
+ */
+typedef struct WasmCLoopParameter {
+    U32 stackIndex;
+    WasmValueType valueType;
+    /* Offset of the end of the loop in the function's code */
+    size_t loopEnd;
+} WasmCLoopParameter;
+
+ARRAY_TYPE(
+    WasmCLoopParameters,
+    WasmCLoopParameter,
+    wasmCLoopParameters,
+    parameters,
+    parameter
+)
 
 typedef struct WasmCFunctionWriter {
     StringBuilder* builder;
@@ -555,13 +786,45 @@ typedef struct WasmCFunctionWriter {
     const WasmModule* module;
     const char* moduleName;
     WasmFunction function;
-    Buffer* code;
+    const WasmCode* code;
+    /* Index of the next instruction in the code */
+    size_t instructionIndex;
+    /* The instruction currently being written */
+    const WasmInstruction* instruction;
     U32 indent;
     bool ignore;
     bool pretty;
     bool debug;
     bool multipleModules;
+    /* Which functions take the instance as a parameter, NULL if all do */
+    const bool* instanceParameters;
     WasmDebugLines* debugLines;
+    WasmBoundsCheckMode boundsCheckMode;
+    WasmBoundsCheckAccesses* boundsCheckAccesses;
+    bool cacheMemoryBase;
+    /* Set when the function uses the cached memory base */
+    bool* memoryBaseUsed;
+    /* Mutable globals cached in local variables, NULL if disabled */
+    const WasmCGlobalCache* globalCache;
+    /* Index of the function in the module, i.e. including imported functions */
+    U32 functionIndex;
+    /* Set when the function performs a tail call to itself */
+    bool* selfTailCallUsed;
+    /* Set when the function performs a tail call through the trampoline */
+    bool* tailCallTrampolineUsed;
+    /* Set when the function performs a tail call that cannot use musttail instead */
+    bool* tailCallMustTailUnavailable;
+    /* Folds single-use values into nested expressions, NULL if disabled */
+    WasmCExpressionFolder* folder;
+    /*
+     * Label stack index of the innermost loop, which branches continue,
+     * or zero if there is none, as the function's label is never a loop
+     */
+    U32 loopLabelStackIndex;
+    /* Set when branches to the label enclosing the innermost loop break out of the loop */
+    bool loopBreak;
+    /* Parameters of the loops written so far, NULL if stack variables are not coalesced */
+    WasmCLoopParameters* loopParameters;
 } WasmCFunctionWriter;
 
 static
@@ -655,98 +918,104 @@ wasmCWriteFunctionCode(
     WasmOpcode* opcode
 );
 
+/*
+ * wasmCIsSimpleExpression returns true if the given expression is a single name or number,
+ * which does not need parentheses when nested into another expression
+ */
 static
 bool
-WARN_UNUSED_RESULT
-wasmCWriteCallExpr(
-    const WasmCFunctionWriter* writer
-) {
-    WasmCallInstruction instruction;
-    if (!wasmCallInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid call instruction encoding\n");
-        return false;
+wasmCIsSimpleExpression(
+    const char* expression,
+    const size_t length
+) {
+    size_t index = 0;
+    for (; index < length; index++) {
+        const char c = expression[index];
+        if (!isalnum((unsigned char) c) && c != '_') {
+            return false;
+        }
     }
+    return true;
+}
 
-    if (!writer->ignore) {
-        WasmFunctionType functionType;
-        MUST (wasmModuleGetFunctionType(writer->module, instruction.funcIndex, &functionType))
-        {
-            const U32 parameterCount = functionType.parameterCount;
-            const U32 resultCount = functionType.resultCount;
-
-            MUST (wasmCWriteIndent(writer))
-
-            if (resultCount > 0) {
-                /* TODO: add support for multiple result values */
-                const WasmValueType resultType = functionType.resultTypes[0];
+/*
+ * wasmCWriteStackValue writes a use of the value of the given stack entry.
+ * If the current instruction consumes folded values, and the value is folded,
+ * the expression computing the value is written instead of the stack entry
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStackValue(
+    const WasmCFunctionWriter* writer,
+    const U32 stackIndex
+) {
+    WasmCExpressionFolder* folder = writer->folder;
+
+    if (folder != NULL && folder->consuming) {
+        WasmCFoldedValues* values = &folder->values;
+        size_t index = values->length;
+        while (index > 0) {
+            WasmCFoldedValue* value = &values->values[--index];
+            if (value->stackIndex == stackIndex) {
+                StringBuilder* builder = writer->builder;
+                const bool simple = wasmCIsSimpleExpression(
+                    builder->string + value->expressionStart,
+                    value->expressionLength
+                );
 
-                U32 resultStackIndex = assertSizeU32(writer->typeStack->length);
-                if (parameterCount > 0) {
-                    resultStackIndex -= parameterCount;
+                value->consumed = true;
+                if (value->depth > folder->depth) {
+                    folder->depth = value->depth;
                 }
 
-                MUST (wasmTypeStackSet(writer->stackDeclarations, resultStackIndex, resultType))
-                MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
-                MUST (wasmCWriteAssign(writer))
-            }
-
-            MUST (wasmCWriteStringFunctionUse(
-                writer->builder,
-                writer->module,
-                writer->moduleName,
-                instruction.funcIndex,
-                false,
-                writer->multipleModules
-            ))
-
-            MUST (wasmCWrite(writer, "(i"))
-            {
-                U32 parameterIndex = 0;
-                for (; parameterIndex < parameterCount; parameterIndex++) {
-                    const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
-                    const U32 paramStackIndex = wasmTypeStackGetTopIndex(
-                        writer->typeStack,
-                        parameterCount - parameterIndex - 1
-                    );
-                    MUST (wasmCWriteComma(writer))
-                    MUST (wasmCWriteStringStackName(writer->builder, paramStackIndex, parameterType))
+                if (!simple) {
+                    MUST (wasmCWriteChar(writer, '('))
                 }
-            }
-            MUST (wasmCWrite(writer, ");\n"))
-
-            wasmTypeStackDrop(writer->typeStack, parameterCount);
-            {
-                U32 resultIndex = 0;
-                for (; resultIndex < resultCount; resultIndex++) {
-                    const WasmValueType resultType = functionType.resultTypes[resultIndex];
-                    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+                MUST (stringBuilderAppendRange(builder, value->expressionStart, value->expressionLength))
+                if (!simple) {
+                    MUST (wasmCWriteChar(writer, ')'))
                 }
+                return true;
             }
         }
     }
 
-    return true;
+    return wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex,
+        writer->typeStack->valueTypes[stackIndex]
+    );
 }
 
+/*
+ * wasmCWriteResultStart writes the start of the assignment of an instruction's result
+ * to the given stack entry. The expression is written by the caller,
+ * followed by wasmCWriteResultEnd
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteParameters(
+wasmCWriteResultStart(
     const WasmCFunctionWriter* writer,
-    const WasmFunctionType functionType
+    const U32 stackIndex,
+    const WasmValueType resultType
 ) {
-    MUST (wasmCWriteChar(writer, '('))
-    MUST (wasmCWrite(writer, writer->moduleName))
-    MUST (wasmCWrite(writer, "Instance*"))
-    {
-        U32 parameterIndex = 0;
-        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
-            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
-            MUST (wasmCWriteComma(writer))
-            MUST (wasmCWrite(writer, valueTypeNames[parameterType]))
-        }
+    WasmCExpressionFolder* folder = writer->folder;
+
+    if (folder != NULL) {
+        folder->hasResult = true;
+        folder->result.stackIndex = stackIndex;
+        folder->result.statementStart = writer->builder->length;
+    }
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex, resultType))
+    MUST (wasmCWriteAssign(writer))
+
+    if (folder != NULL) {
+        folder->result.expressionStart = writer->builder->length;
     }
-    MUST (wasmCWriteChar(writer, ')'))
 
     return true;
 }
@@ -754,534 +1023,477 @@ wasmCWriteParameters(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteCallIndirectExpr(
+wasmCWriteResultEnd(
     const WasmCFunctionWriter* writer
 ) {
-    WasmCallIndirectInstruction instruction;
-    if (!wasmCallIndirectInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid call_indirect instruction encoding\n");
-        return false;
-    }
-
-    if (!writer->ignore) {
-        const WasmFunctionType functionType = writer->module->functionTypes.functionTypes[instruction.functionTypeIndex];
+    WasmCExpressionFolder* folder = writer->folder;
 
-        const U32 parameterCount = functionType.parameterCount;
-        const U32 resultCount = functionType.resultCount;
+    if (folder != NULL) {
+        folder->result.expressionLength = writer->builder->length - folder->result.expressionStart;
+    }
 
-        MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, ";\n"))
 
-        if (resultCount > 0) {
-            /* TODO: add support for multiple result values */
-            const WasmValueType resultType = functionType.resultTypes[0];
+    if (folder != NULL) {
+        folder->result.statementEnd = writer->builder->length;
+    }
 
-            U32 resultStackIndex = assertSizeU32(writer->typeStack->length - 1);
-            if (parameterCount > 0) {
-                resultStackIndex -= parameterCount;
-            }
+    return true;
+}
 
-            MUST (wasmTypeStackSet(writer->stackDeclarations, resultStackIndex, resultType))
-            MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
-            MUST (wasmCWriteAssign(writer))
-        }
 
-        MUST (wasmCWrite(writer, "TF("))
-        MUST (wasmCWriteStringTableUse(writer->builder, writer->module, instruction.tableIndex, false))
-        MUST (wasmCWriteComma(writer))
+/*
+ * wasmCWriteMemoryBaseRefresh reloads the cached memory base after instructions
+ * which may move the memory's data, i.e. calls and memory.grow
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryBaseRefresh(
+    const WasmCFunctionWriter* writer
+) {
+    const WasmModule* module = writer->module;
 
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-            ))
-        }
+    if (!writer->cacheMemoryBase) {
+        return true;
+    }
 
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWrite(writer, wasmCGetReturnType(functionType)))
-        MUST (wasmCWrite(writer, " (*)"))
+    if (module->memoryImports.length + module->memories.count == 0) {
+        return true;
+    }
 
-        MUST (wasmCWriteParameters(writer, functionType))
+    *writer->memoryBaseUsed = true;
 
-        MUST (wasmCWrite(writer, ")(i"))
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, memoryBaseName))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWriteStringMemoryUse(writer->builder, module, 0, true))
+    MUST (wasmCWrite(writer, "->data;\n"))
 
-        {
-            U32 parameterIndex = 0;
-            for (; parameterIndex < parameterCount; parameterIndex++) {
-                const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
-                const U32 paramStackIndex = wasmTypeStackGetTopIndex(
-                    writer->typeStack,
-                    parameterCount - parameterIndex
-                );
-                MUST (wasmCWriteComma(writer))
-                MUST (wasmCWriteStringStackName(writer->builder, paramStackIndex, parameterType))
-            }
-        }
-        MUST (wasmCWrite(writer, ");\n"))
+    return true;
+}
 
-        wasmTypeStackDrop(writer->typeStack, parameterCount + 1);
-        {
-            U32 resultIndex = 0;
-            for (; resultIndex < resultCount; resultIndex++) {
-                const WasmValueType resultType = functionType.resultTypes[resultIndex];
-                MUST (wasmTypeStackAppend(writer->typeStack, resultType))
-            }
-        }
+/*
+ * wasmCInstructionMayTrap returns true if the given instruction may trap,
+ * e.g. a memory access, an integer division, or a truncation
+ */
+static
+bool
+wasmCInstructionMayTrap(
+    const WasmInstruction* instruction
+) {
+    switch (instruction->opcode) {
+        case wasmOpcodeNop:
+        case wasmOpcodeBlock:
+        case wasmOpcodeLoop:
+        case wasmOpcodeIf:
+        case wasmOpcodeElse:
+        case wasmOpcodeEnd:
+        case wasmOpcodeBr:
+        case wasmOpcodeBrIf:
+        case wasmOpcodeBrTable:
+        case wasmOpcodeReturn:
+        case wasmOpcodeDrop:
+        case wasmOpcodeSelect:
+        case wasmOpcodeLocalGet:
+        case wasmOpcodeLocalSet:
+        case wasmOpcodeLocalTee:
+        case wasmOpcodeGlobalGet:
+        case wasmOpcodeGlobalSet:
+        case wasmOpcodeMemorySize:
+        case wasmOpcodeMemoryGrow:
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeF32Const:
+        case wasmOpcodeF64Const:
+            return false;
+        case wasmOpcodeI32DivS:
+        case wasmOpcodeI32DivU:
+        case wasmOpcodeI32RemS:
+        case wasmOpcodeI32RemU:
+        case wasmOpcodeI64DivS:
+        case wasmOpcodeI64DivU:
+        case wasmOpcodeI64RemS:
+        case wasmOpcodeI64RemU:
+        case wasmOpcodeI32TruncF32S:
+        case wasmOpcodeI32TruncF32U:
+        case wasmOpcodeI32TruncF64S:
+        case wasmOpcodeI32TruncF64U:
+        case wasmOpcodeI64TruncF32S:
+        case wasmOpcodeI64TruncF32U:
+        case wasmOpcodeI64TruncF64S:
+        case wasmOpcodeI64TruncF64U:
+            return true;
+        case wasmOpcodeMiscPrefix:
+            /* Only the saturating truncations never trap */
+            return instruction->prefixedOpcode > wasmMiscOpcodeI64TruncSatF64U;
+        default:
+            /* All other numeric instructions never trap */
+            return instruction->opcode < wasmOpcodeI32Eqz
+                || instruction->opcode > wasmOpcodeI64Extend32S;
     }
-
-    return true;
 }
 
+/*
+ * wasmCGlobalCacheAnalyze determines which mutable globals of the function with the given code
+ * are cached in local variables. Each cached global is loaded once at the start of the function,
+ * reloaded after each call, and, if assigned, written back before each call and on return,
+ * so a global is only cached if it is used more often than that.
+ * Uses and calls in loops are weighted higher, as they are likely to run more often.
+ *
+ * Assigned globals are only cached if the function has no instructions which may trap,
+ * other than calls and unreachable, which write them back,
+ * so a trap never leaves an assigned global with its previous value
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteLocalGetExpr(
-    const WasmCFunctionWriter* writer
+wasmCGlobalCacheAnalyze(
+    WasmCGlobalCache* globalCache,
+    const WasmModule* module,
+    const WasmCode* code
 ) {
-    WasmLocalInstruction instruction;
-    if (!wasmLocalInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid local.get instruction encoding\n");
-        return false;
-    }
+    const size_t globalImportCount = module->globalImports.length;
+    const size_t globalCount = globalImportCount + module->globals.count;
+    U32 callCount = 0;
+    U32 loopDepth = 0;
+    bool mayTrap = false;
 
-    if (!writer->ignore) {
-        WasmValueType localType = 0;
-        const bool gotType = wasmModuleFunctionGetLocalType(
-            writer->module,
-            writer->function,
-            instruction.localIndex,
-            &localType
-        );
-        if (!gotType) {
-            fprintf(
-                stderr,
-                "w2c2: invalid local.get instruction: invalid local index: %u\n",
-                instruction.localIndex
-            );
-            return false;
+    MUST (wasmCGlobalUsesArrayEnsureCapacity(&globalCache->uses, globalCount))
+    globalCache->uses.length = globalCount;
+    memset(globalCache->uses.uses, 0, globalCount * sizeof(WasmCGlobalUses));
+    globalCache->indices.length = 0;
+    globalCache->blocks.length = 0;
+
+    {
+        size_t instructionIndex = 0;
+        for (; instructionIndex < code->instructions.length; instructionIndex++) {
+            const WasmInstruction* instruction = code->instructions.instructions + instructionIndex;
+            const U32 weight = 1U << (3 * (loopDepth < wasmCGlobalCacheMaxLoopDepth
+                ? loopDepth
+                : wasmCGlobalCacheMaxLoopDepth));
+            switch (instruction->opcode) {
+                case wasmOpcodeBlock:
+                case wasmOpcodeLoop:
+                case wasmOpcodeIf: {
+                    const bool loop = instruction->opcode == wasmOpcodeLoop;
+                    MUST (wasmCGlobalCacheBlocksAppend(&globalCache->blocks, loop))
+                    if (loop) {
+                        loopDepth++;
+                    }
+                    break;
+                }
+                case wasmOpcodeEnd: {
+                    /* The final end of the function's body has no block */
+                    if (globalCache->blocks.length > 0) {
+                        globalCache->blocks.length--;
+                        if (globalCache->blocks.loops[globalCache->blocks.length]) {
+                            loopDepth--;
+                        }
+                    }
+                    break;
+                }
+                case wasmOpcodeCall:
+                case wasmOpcodeCallIndirect:
+                case wasmOpcodeReturnCall:
+                case wasmOpcodeReturnCallIndirect: {
+                    callCount += weight;
+                    break;
+                }
+                case wasmOpcodeGlobalGet:
+                case wasmOpcodeGlobalSet: {
+                    const U32 globalIndex = instruction->immediates.global.globalIndex;
+                    WasmCGlobalUses* uses = NULL;
+                    bool mutable = false;
+
+                    /* Invalid global indices are reported when generating code */
+                    if (globalIndex >= globalCount) {
+                        break;
+                    }
+
+                    mutable = globalIndex < globalImportCount
+                        ? module->globalImports.imports[globalIndex].globalType.mutable
+                        : module->globals.globals[globalIndex - globalImportCount].type.mutable;
+                    if (!mutable) {
+                        break;
+                    }
+
+                    uses = &globalCache->uses.uses[globalIndex];
+                    if (uses->count == 0) {
+                        MUST (wasmCCachedGlobalIndicesAppend(&globalCache->indices, globalIndex))
+                    }
+                    uses->count += weight;
+                    if (instruction->opcode == wasmOpcodeGlobalSet) {
+                        uses->assigned = true;
+                    }
+                    break;
+                }
+                case wasmOpcodeUnreachable:
+                    break;
+                default:
+                    if (wasmCInstructionMayTrap(instruction)) {
+                        mayTrap = true;
+                    }
+                    break;
+            }
         }
-        MUST (wasmTypeStackAppend(writer->typeStack, localType))
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
+    }
 
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, localType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
-            MUST (wasmCWrite(writer, ";\n"))
+    /* Only keep the globals which are worth caching */
+    {
+        size_t index = 0;
+        size_t cachedCount = 0;
+        for (; index < globalCache->indices.length; index++) {
+            const U32 globalIndex = globalCache->indices.indices[index];
+            WasmCGlobalUses* uses = &globalCache->uses.uses[globalIndex];
+            const U32 cost = uses->assigned
+                ? 2 + 2 * callCount
+                : 1 + callCount;
+            if (uses->assigned && mayTrap) {
+                continue;
+            }
+            if (uses->count > cost) {
+                uses->cached = true;
+                globalCache->indices.indices[cachedCount++] = globalIndex;
+            }
         }
+        globalCache->indices.length = cachedCount;
     }
 
     return true;
 }
 
 static
+W2C2_INLINE
 bool
-WARN_UNUSED_RESULT
-wasmCWriteLocalAssignmentExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+wasmCGlobalIsCached(
+    const WasmCGlobalCache* globalCache,
+    const U32 globalIndex
 ) {
-    WasmLocalInstruction instruction;
-    if (!wasmLocalInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
-        );
-        return false;
-    }
-
-    if (!writer->ignore) {
-        WasmValueType localType = 0;
-        const bool gotType = wasmModuleFunctionGetLocalType(
-            writer->module,
-            writer->function,
-            instruction.localIndex,
-            &localType
-        );
-        if (!gotType) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction: invalid local index: %u\n",
-                wasmOpcodeDescription(opcode),
-                instruction.localIndex
-            );
-            return false;
-        }
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
+    return globalCache != NULL
+        && globalIndex < globalCache->uses.length
+        && globalCache->uses.uses[globalIndex].cached;
+}
 
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, localType))
-            MUST (wasmCWrite(writer, ";\n"))
-        }
-        if (opcode == wasmOpcodeLocalSet) {
-            wasmTypeStackDrop(writer->typeStack, 1);
-        }
-    }
+static
+W2C2_INLINE
+void
+wasmCWriteFileCachedGlobalName(
+    FILE* file,
+    const U32 globalIndex
+) {
+    fputs(cachedGlobalNamePrefix, file);
+    fprintf(file, "%u", globalIndex);
+}
 
+static
+W2C2_INLINE
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringCachedGlobalName(
+    StringBuilder* builder,
+    const U32 globalIndex
+) {
+    MUST (stringBuilderAppend(builder, cachedGlobalNamePrefix))
+    MUST (stringBuilderAppendU32(builder, globalIndex))
     return true;
 }
 
+/* wasmCWriteGlobalUse writes the use of the given global, or of its cached local variable */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteGlobalUse(
+    const WasmCFunctionWriter* writer,
+    const U32 globalIndex
+) {
+    if (wasmCGlobalIsCached(writer->globalCache, globalIndex)) {
+        return wasmCWriteStringCachedGlobalName(writer->builder, globalIndex);
+    }
+    return wasmCWriteStringGlobalUse(writer->builder, writer->module, globalIndex, false);
+}
 
+/*
+ * wasmCWriteGlobalCacheStore writes the cached globals assigned by the function back
+ * before instructions which may observe them, i.e. calls, returns, and traps
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteGlobalGetExpr(
+wasmCWriteGlobalCacheStore(
     const WasmCFunctionWriter* writer
 ) {
-    static const WasmOpcode opcode = wasmOpcodeGlobalGet;
+    const WasmCGlobalCache* globalCache = writer->globalCache;
+    size_t index = 0;
 
-    WasmGlobalInstruction instruction;
-    if (!wasmGlobalInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
-        );
-        return false;
+    if (globalCache == NULL) {
+        return true;
     }
 
-    if (!writer->ignore) {
-        WasmValueType globalType = 0;
-        const bool gotType = wasmModuleGetGlobalType(
-            writer->module,
-            instruction.globalIndex,
-            &globalType
-        );
-        if (!gotType) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction: invalid global index: %u\n",
-                wasmOpcodeDescription(opcode),
-                instruction.globalIndex
-            );
-            return false;
-        }
-        MUST (wasmTypeStackAppend(writer->typeStack, globalType))
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
-
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, globalType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringGlobalUse(writer->builder, writer->module, instruction.globalIndex, false))
-            MUST (wasmCWrite(writer, ";\n"))
+    for (; index < globalCache->indices.length; index++) {
+        const U32 globalIndex = globalCache->indices.indices[index];
+        if (!globalCache->uses.uses[globalIndex].assigned) {
+            continue;
         }
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringGlobalUse(writer->builder, writer->module, globalIndex, false))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringCachedGlobalName(writer->builder, globalIndex))
+        MUST (wasmCWrite(writer, ";\n"))
     }
 
     return true;
 }
 
+/* wasmCWriteGlobalCacheLoad reloads the cached globals after calls, which may assign them */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteGlobalSetExpr(
+wasmCWriteGlobalCacheLoad(
     const WasmCFunctionWriter* writer
 ) {
-    static const WasmOpcode opcode = wasmOpcodeGlobalSet;
+    const WasmCGlobalCache* globalCache = writer->globalCache;
+    size_t index = 0;
 
-    WasmGlobalInstruction instruction;
-    if (!wasmGlobalInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
-        );
-        return false;
+    if (globalCache == NULL) {
+        return true;
     }
 
-    if (!writer->ignore) {
-        WasmValueType globalType = 0;
-        const bool gotType = wasmModuleGetGlobalType(
-            writer->module,
-            instruction.globalIndex,
-            &globalType
-        );
-        if (!gotType) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction: invalid global index: %u\n",
-                wasmOpcodeDescription(opcode),
-                instruction.globalIndex
-            );
-            return false;
-        }
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
-
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringGlobalUse(writer->builder, writer->module, instruction.globalIndex, false))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, globalType))
-            MUST (wasmCWrite(writer, ";\n"))
-        }
-        wasmTypeStackDrop(writer->typeStack, 1);
+    for (; index < globalCache->indices.length; index++) {
+        const U32 globalIndex = globalCache->indices.indices[index];
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringCachedGlobalName(writer->builder, globalIndex))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringGlobalUse(writer->builder, writer->module, globalIndex, false))
+        MUST (wasmCWrite(writer, ";\n"))
     }
 
     return true;
 }
 
+/*
+ * wasmCWriteMemoryAccessStart writes the start of a call to the given load or store function,
+ * up to and including the memory argument
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteLiteral(
-    StringBuilder* builder,
-    const WasmValueType valueType,
-    const WasmValue value
+wasmCWriteMemoryAccessStart(
+    const WasmCFunctionWriter* writer,
+    const char* functionName
 ) {
-    switch (valueType) {
-        case wasmValueTypeI32: {
-            MUST (stringBuilderAppendI32(builder, value.i32))
-            MUST (stringBuilderAppendChar(builder, 'U'))
-            break;
-        }
-        case wasmValueTypeI64: {
-            MUST (stringBuilderAppend(builder, "W2C2_LL("))
-            MUST (stringBuilderAppendI64(builder, value.i64))
-            MUST (stringBuilderAppend(builder, "U)"))
-            break;
-        }
-        case wasmValueTypeF32: {
-            const U32 bits = (U32) value.i32;
-            if ((bits & 0x7f800000U) == 0x7f800000U) {
-                const bool isNegative = (bits & 0x80000000U) != 0;
-                const U32 significand = bits & 0x7fffffU;
-                if (significand == 0) {
-                    if (isNegative) {
-                        MUST (stringBuilderAppendChar(builder, '-'))
-                    }
-                    MUST (stringBuilderAppend(builder, "INFINITY"))
-                } else {
-                    MUST (stringBuilderAppend(builder, "f32_reinterpret_i32(0x"))
-                    MUST (stringBuilderAppendU32Hex(builder, bits))
-                    MUST (stringBuilderAppendChar(builder, ')'))
-                }
-            } else if (bits == 0x80000000U) {
-                MUST (stringBuilderAppend(builder, "-0.f"))
-            } else {
-                MUST (stringBuilderAppendF32(builder, value.f32))
-            }
-            break;
-        }
-        case wasmValueTypeF64: {
-            const U64 bits = (U64) value.i64;
-            if ((bits & 0x7ff0000000000000ULL) == 0x7ff0000000000000ULL) {
-                const bool isNegative = (bits & 0x8000000000000000ULL) != 0;
-                const U64 significand = bits & 0x7fffffULL;
-                if (significand == 0) {
-                    if (isNegative) {
-                        MUST (stringBuilderAppendChar(builder, '-'))
-                    }
-                    MUST (stringBuilderAppend(builder, "INFINITY"))
-                } else {
-                    MUST (stringBuilderAppend(builder, "f64_reinterpret_i64(0x"))
-                    MUST (stringBuilderAppendU64Hex(builder, bits))
-                    MUST (stringBuilderAppendChar(builder, ')'))
-                }
-            } else if (bits == 0x8000000000000000ULL) {
-                MUST (stringBuilderAppend(builder, "-0.f"))
-            } else {
-                MUST (stringBuilderAppendF64(builder, value.f64))
-            }
-            break;
-        }
-        default:
-            fprintf(stderr, "w2c2: unsupported const type %s\n", wasmValueTypeDescription(valueType));
-            return false;
+    MUST (wasmCWrite(writer, functionName))
+    if (writer->cacheMemoryBase) {
+        *writer->memoryBaseUsed = true;
+        MUST (wasmCWrite(writer, "_data("))
+        MUST (wasmCWrite(writer, memoryBaseName))
+    } else {
+        MUST (wasmCWriteChar(writer, '('))
+        MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
     }
-
     return true;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteConstExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+wasmCWriteBoundsCheckStart(
+    const WasmCFunctionWriter* writer
 ) {
-    WasmConstInstruction instruction;
-    if (!wasmConstInstructionRead(writer->code, opcode, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
-        );
-        return false;
-    }
-
-    if (!writer->ignore) {
-        const WasmValueType resultType = wasmOpcodeResultType(opcode);
-        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteLiteral(writer->builder, resultType, instruction.value))
-            MUST (wasmCWrite(writer, ";\n"))
-        }
-    }
-
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "wasmMemoryCheckBounds("))
+    MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
+    MUST (wasmCWriteComma(writer))
     return true;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteLoad(
+wasmCWriteBoundsCheckEnd(
     const WasmCFunctionWriter* writer,
-    const WasmMemoryArgumentInstruction instruction,
-    const char* functionName,
-    WasmValueType resultType
+    const U32 offset,
+    const U32 length
 ) {
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
-    MUST (wasmCWriteAssign(writer))
-    MUST (wasmCWrite(writer, functionName))
-    MUST (wasmCWriteChar(writer, '('))
-    MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
     MUST (wasmCWriteComma(writer))
-    MUST (wasmCWrite(writer, "(U64)"))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    if (instruction.offset != 0) {
-        MUST (wasmCWritePlus(writer))
-        MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
-        MUST (wasmCWriteChar(writer, 'U'))
-    }
-    MUST (wasmCWrite(writer, ");\n"))
-
-    wasmTypeStackDrop(writer->typeStack, 1);
-
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
-
+    MUST (stringBuilderAppendU32(writer->builder, offset))
+    MUST (wasmCWriteChar(writer, 'U'))
+    MUST (wasmCWriteComma(writer))
+    MUST (stringBuilderAppendU32(writer->builder, length))
+    MUST (wasmCWrite(writer, "U);\n"))
     return true;
 }
 
+/*
+ * wasmCWriteBoundsCheck writes a bounds check for a memory access
+ * using the given stack entry as the address, unless the access
+ * at the given position is already covered by a previous check.
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteLoadExpr(
+wasmCWriteBoundsCheck(
     const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+    const WasmInstruction* position,
+    const U32 stackIndex,
+    const U32 offset,
+    const U32 length
 ) {
-    WasmMemoryArgumentInstruction instruction;
+    if (writer->boundsCheckMode != wasmBoundsCheckModeChecked) {
+        return true;
+    }
 
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
-        );
-        return false;
+    if (position != NULL
+        && wasmBoundsCheckAccessesRemove(writer->boundsCheckAccesses, position)
+    ) {
+        return true;
     }
 
-    if (!writer->ignore) {
-        WasmValueType resultType = 0;
-        char* functionName = NULL;
-        switch (opcode) {
-            case wasmOpcodeI32Load: {
-                resultType = wasmValueTypeI32;
-                functionName = "i32_load";
-                break;
-            }
-            case wasmOpcodeI64Load: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load";
-                break;
-            }
-            case wasmOpcodeF32Load: {
-                resultType = wasmValueTypeF32;
-                functionName = "f32_load";
-                break;
-            }
-            case wasmOpcodeF64Load: {
-                resultType = wasmValueTypeF64;
-                functionName = "f64_load";
-                break;
-            }
-            case wasmOpcodeI32Load8S: {
-                resultType = wasmValueTypeI32;
-                functionName = "i32_load8_s";
-                break;
-            }
-            case wasmOpcodeI64Load8S: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load8_s";
-                break;
-            }
-            case wasmOpcodeI32Load8U: {
-                resultType = wasmValueTypeI32;
-                functionName = "i32_load8_u";
-                break;
-            }
-            case wasmOpcodeI64Load8U: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load8_u";
-                break;
-            }
-            case wasmOpcodeI32Load16S: {
-                resultType = wasmValueTypeI32;
-                functionName = "i32_load16_s";
-                break;
-            }
-            case wasmOpcodeI64Load16S: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load16_s";
-                break;
-            }
-            case wasmOpcodeI32Load16U: {
-                resultType = wasmValueTypeI32;
-                functionName = "i32_load16_u";
-                break;
-            }
-            case wasmOpcodeI64Load16U: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load16_u";
-                break;
-            }
-            case wasmOpcodeI64Load32S: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load32_s";
-                break;
-            }
-            case wasmOpcodeI64Load32U: {
-                resultType = wasmValueTypeI64;
-                functionName = "i64_load32_u";
-                break;
-            }
-            default: {
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported load instruction opcode: %s\n",
-                    wasmOpcodeDescription(opcode)
-                );
-                return false;
-            }
-        }
+    MUST (wasmCWriteBoundsCheckStart(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex,
+        writer->typeStack->valueTypes[stackIndex]
+    ))
+    MUST (wasmCWriteBoundsCheckEnd(writer, offset, length))
 
-        MUST (wasmCWriteLoad(
-            writer,
-            instruction,
-            functionName,
-            resultType
-        ))
+    return true;
+}
+
+/*
+ * wasmCWriteCallResultsStart writes the start of a call statement,
+ * which assigns the results to the stack entries starting at the given index.
+ * Multiple results are returned in a struct, which is unpacked by wasmCWriteCallResultsEnd
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteCallResultsStart(
+    WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType,
+    const U32 resultStackIndex
+) {
+    MUST (wasmCWriteIndent(writer))
+
+    switch (functionType.resultCount) {
+        case 0:
+            break;
+        case 1: {
+            const WasmValueType resultType = functionType.resultTypes[0];
+            MUST (wasmTypeStackSet(writer->stackDeclarations, resultStackIndex, resultType))
+            MUST (wasmCWriteStringStackName(writer->builder, resultStackIndex, resultType))
+            MUST (wasmCWriteAssign(writer))
+            break;
+        }
+        default:
+            MUST (wasmCWrite(writer, "{\n"))
+            writer->indent++;
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringReturnType(writer->builder, functionType))
+            MUST (wasmCWriteChar(writer, ' '))
+            MUST (wasmCWrite(writer, multiValueVariableName))
+            MUST (wasmCWriteAssign(writer))
+            break;
     }
 
     return true;
@@ -1290,110 +1502,87 @@ wasmCWriteLoadExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteStore(
-    const WasmCFunctionWriter* writer,
-    const WasmMemoryArgumentInstruction instruction,
-    const char* functionName
+wasmCWriteCallResultsEnd(
+    WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType,
+    const U32 resultStackIndex
 ) {
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    U32 resultIndex = 0;
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWrite(writer, functionName))
-    MUST (wasmCWriteChar(writer, '('))
-    MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
-    MUST (wasmCWriteComma(writer))
-    MUST (wasmCWrite(writer, "(U64)"))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (instruction.offset != 0) {
-        MUST (wasmCWritePlus(writer))
-        MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
-        MUST (wasmCWriteChar(writer, 'U'))
+    if (functionType.resultCount < 2) {
+        return true;
     }
-    MUST (wasmCWriteComma(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    MUST (wasmCWrite(writer, ");\n"))
 
-    wasmTypeStackDrop(writer->typeStack, 2);
+    for (; resultIndex < functionType.resultCount; resultIndex++) {
+        const WasmValueType resultType = functionType.resultTypes[resultIndex];
+        const U32 stackIndex = resultStackIndex + resultIndex;
+        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex, resultType))
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex, resultType))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWrite(writer, multiValueVariableName))
+        MUST (wasmCWriteChar(writer, '.'))
+        MUST (wasmCWriteStringMultiValueFieldName(writer->builder, resultIndex))
+        MUST (wasmCWrite(writer, ";\n"))
+    }
+
+    writer->indent--;
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "}\n"))
 
     return true;
 }
 
+/*
+ * wasmCWriteArguments writes the arguments of a call to a function of the given type,
+ * which are on the top of the stack, below the given number of other stack entries
+ */
+/*
+ * wasmCFunctionHasInstanceParameter returns true if the given function
+ * takes the instance as its first parameter. Imported functions always take it
+ */
+static
+W2C2_INLINE
+bool
+wasmCFunctionHasInstanceParameter(
+    const WasmModule* module,
+    const bool* instanceParameters,
+    const U32 functionIndex
+) {
+    const size_t functionImportCount = module->functionImports.length;
+    if (instanceParameters == NULL
+        || functionIndex < functionImportCount
+        || functionIndex - functionImportCount >= module->functions.count
+    ) {
+        return true;
+    }
+    return instanceParameters[functionIndex - functionImportCount];
+}
+
+/*
+ * wasmCWriteArguments writes the arguments of a call from the stack.
+ * If the instance argument was written before, each argument is preceded by a comma
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteStoreExpr(
+wasmCWriteArguments(
     const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+    const WasmFunctionType functionType,
+    const U32 stackOffset,
+    const bool instanceArgument
 ) {
-    WasmMemoryArgumentInstruction instruction;
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmOpcodeDescription(opcode)
+    const U32 parameterCount = functionType.parameterCount;
+    U32 parameterIndex = 0;
+    for (; parameterIndex < parameterCount; parameterIndex++) {
+        const U32 paramStackIndex = wasmTypeStackGetTopIndex(
+            writer->typeStack,
+            parameterCount - parameterIndex - 1 + stackOffset
         );
-        return false;
-    }
-
-    if (!writer->ignore) {
-        char* functionName = NULL;
-        switch (opcode) {
-            case wasmOpcodeI32Store: {
-                functionName = "i32_store";
-                break;
-            }
-            case wasmOpcodeI64Store: {
-                functionName = "i64_store";
-                break;
-            }
-            case wasmOpcodeF32Store: {
-                functionName = "f32_store";
-                break;
-            }
-            case wasmOpcodeF64Store: {
-                functionName = "f64_store";
-                break;
-            }
-            case wasmOpcodeI32Store8: {
-                functionName = "i32_store8";
-                break;
-            }
-            case wasmOpcodeI64Store8: {
-                functionName = "i64_store8";
-                break;
-            }
-            case wasmOpcodeI32Store16: {
-                functionName = "i32_store16";
-                break;
-            }
-            case wasmOpcodeI64Store16: {
-                functionName = "i64_store16";
-                break;
-            }
-            case wasmOpcodeI64Store32: {
-                functionName = "i64_store32";
-                break;
-            }
-            default: {
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported store instruction opcode: %s\n",
-                    wasmOpcodeDescription(opcode)
-                );
-                return false;
-            }
+        if (instanceArgument || parameterIndex > 0) {
+            MUST (wasmCWriteComma(writer))
         }
-
-        MUST (wasmCWriteStore(writer, instruction, functionName))
+        MUST (wasmCWriteStackValue(writer, paramStackIndex))
     }
 
     return true;
@@ -1402,50 +1591,52 @@ wasmCWriteStoreExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemorySizeExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteCall(
+    WasmCFunctionWriter* writer,
+    const U32 functionIndex
 ) {
-    WasmMemoryInstruction instruction;
-    if (!wasmMemoryInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid memory.size instruction encoding\n");
-        return false;
-    }
-
+    WasmFunctionType functionType;
+    MUST (wasmModuleGetFunctionType(writer->module, functionIndex, &functionType))
     {
-        static const U32 expectedMemoryIndex = 0;
-        if (instruction.memoryIndex != expectedMemoryIndex) {
-            fprintf(
-                stderr,
-                "w2c2: invalid memory.size instruction: expected memory index %u, got %u\n",
-                expectedMemoryIndex,
-                instruction.memoryIndex
-            );
-            return false;
-        }
-    }
+        const U32 parameterCount = functionType.parameterCount;
+        const U32 resultCount = functionType.resultCount;
 
-    if (!writer->ignore) {
-        static const WasmValueType resultType = wasmValueTypeI32;
+        U32 resultStackIndex = assertSizeU32(writer->typeStack->length);
+        if (parameterCount > 0) {
+            resultStackIndex -= parameterCount;
+        }
 
-        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+        MUST (wasmCWriteGlobalCacheStore(writer))
+        MUST (wasmCWriteCallResultsStart(writer, functionType, resultStackIndex))
 
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                resultType
-            ))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringMemoryUse(
-                writer->builder,
-                writer->module,
-                instruction.memoryIndex,
-                false
-            ))
-            MUST (wasmCWrite(writer, ".pages;\n"))
+        MUST (wasmCWriteStringFunctionUse(
+            writer->builder,
+            writer->module,
+            writer->moduleName,
+            functionIndex,
+            false,
+            writer->multipleModules
+        ))
+
+        if (wasmCFunctionHasInstanceParameter(writer->module, writer->instanceParameters, functionIndex)) {
+            MUST (wasmCWrite(writer, "(i"))
+            MUST (wasmCWriteArguments(writer, functionType, 0, true))
+        } else {
+            MUST (wasmCWriteChar(writer, '('))
+            MUST (wasmCWriteArguments(writer, functionType, 0, false))
+        }
+        MUST (wasmCWrite(writer, ");\n"))
+        MUST (wasmCWriteCallResultsEnd(writer, functionType, resultStackIndex))
+        MUST (wasmCWriteMemoryBaseRefresh(writer))
+        MUST (wasmCWriteGlobalCacheLoad(writer))
+
+        wasmTypeStackDrop(writer->typeStack, parameterCount);
+        {
+            U32 resultIndex = 0;
+            for (; resultIndex < resultCount; resultIndex++) {
+                const WasmValueType resultType = functionType.resultTypes[resultIndex];
+                MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+            }
         }
     }
 
@@ -1455,54 +1646,68 @@ wasmCWriteMemorySizeExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryGrowExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteCallExpr(
+    WasmCFunctionWriter* writer
 ) {
-    WasmMemoryInstruction instruction;
-    if (!wasmMemoryInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid memory.grow instruction encoding\n");
-        return false;
+    const WasmCallInstruction instruction = writer->instruction->immediates.call;
+
+    if (!writer->ignore) {
+        MUST (wasmCWriteCall(writer, instruction.funcIndex))
     }
 
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteParameters(
+    const WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType
+) {
+    MUST (wasmCWriteChar(writer, '('))
+    MUST (wasmCWrite(writer, writer->moduleName))
+    MUST (wasmCWrite(writer, "Instance*"))
     {
-        static const U32 expectedMemoryIndex = 0;
-        if (instruction.memoryIndex != expectedMemoryIndex) {
-            fprintf(
-                stderr,
-                "w2c2: invalid memory.grow instruction: expected memory index %u, got %u\n",
-                expectedMemoryIndex,
-                instruction.memoryIndex
-            );
-            return false;
+        U32 parameterIndex = 0;
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWrite(writer, valueTypeNames[parameterType]))
         }
     }
+    MUST (wasmCWriteChar(writer, ')'))
 
-    if (!writer->ignore) {
-        static const WasmValueType resultType = wasmValueTypeI32;
+    return true;
+}
 
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+/*
+ * wasmCWriteTableFunction writes the lookup of the function in the given table,
+ * at the index on the top of the stack, as a pointer to a function of the given type
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteTableFunction(
+    const WasmCFunctionWriter* writer,
+    const U32 tableIndex,
+    const WasmFunctionType functionType
+) {
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWrite(writer, "wasmMemoryGrow("))
-            MUST (wasmCWriteStringMemoryUse(
-                writer->builder,
-                writer->module,
-                instruction.memoryIndex,
-                true
-            ))
-            MUST (wasmCWriteComma(writer))
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-            ))
-            MUST (wasmCWrite(writer, ");\n"))
-        }
-    }
+    MUST (wasmCWrite(writer, "TF("))
+    MUST (wasmCWriteStringTableUse(writer->builder, writer->module, tableIndex, false))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStringReturnType(writer->builder, functionType))
+    MUST (wasmCWrite(writer, " (*)"))
+    MUST (wasmCWriteParameters(writer, functionType))
+    MUST (wasmCWriteChar(writer, ')'))
 
     return true;
 }
@@ -1510,52 +1715,40 @@ wasmCWriteMemoryGrowExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryInitExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteCallIndirectExpr(
+    WasmCFunctionWriter* writer
 ) {
-    WasmMemoryInitInstruction instruction;
-    if (!wasmMemoryInitInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid memory.init instruction encoding\n");
-        return false;
-    }
+    const WasmCallIndirectInstruction instruction = writer->instruction->immediates.callIndirect;
 
     if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+        const WasmFunctionType functionType = writer->module->functionTypes.functionTypes[instruction.functionTypeIndex];
 
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "LOAD_DATA("))
-        MUST (wasmCWriteStringMemoryUse(
-            writer->builder,
-            writer->module,
-            instruction.memoryIndex,
-            false
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex2,
-            writer->typeStack->valueTypes[stackIndex2]
-        ))
-        MUST (wasmCWriteComma(writer))
-        /* TODO: add support for multiple modules */
-        MUST (wasmCWriteStringDataSegmentName(writer->builder, instruction.dataSegmentIndex))
-        MUST (wasmCWriteChar(writer, '+'))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex1,
-            writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex0,
-            writer->typeStack->valueTypes[stackIndex0]
-        ))
+        const U32 parameterCount = functionType.parameterCount;
+        const U32 resultCount = functionType.resultCount;
+
+        U32 resultStackIndex = assertSizeU32(writer->typeStack->length - 1);
+        if (parameterCount > 0) {
+            resultStackIndex -= parameterCount;
+        }
+
+        MUST (wasmCWriteGlobalCacheStore(writer))
+        MUST (wasmCWriteCallResultsStart(writer, functionType, resultStackIndex))
+        MUST (wasmCWriteTableFunction(writer, instruction.tableIndex, functionType))
+        MUST (wasmCWrite(writer, "(i"))
+        MUST (wasmCWriteArguments(writer, functionType, 1, true))
         MUST (wasmCWrite(writer, ");\n"))
+        MUST (wasmCWriteCallResultsEnd(writer, functionType, resultStackIndex))
+        MUST (wasmCWriteMemoryBaseRefresh(writer))
+        MUST (wasmCWriteGlobalCacheLoad(writer))
 
-        wasmTypeStackDrop(writer->typeStack, 3);
+        wasmTypeStackDrop(writer->typeStack, parameterCount + 1);
+        {
+            U32 resultIndex = 0;
+            for (; resultIndex < resultCount; resultIndex++) {
+                const WasmValueType resultType = functionType.resultTypes[resultIndex];
+                MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+            }
+        }
     }
 
     return true;
@@ -1564,80 +1757,59 @@ wasmCWriteMemoryInitExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryCopyExpr(
+wasmCWriteLocalGetExpr(
     const WasmCFunctionWriter* writer
 ) {
-    WasmMemoryCopyInstruction instruction;
-    if (!wasmMemoryCopyInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid memory.copy instruction encoding\n");
-        return false;
-    }
+    const WasmLocalInstruction instruction = writer->instruction->immediates.local;
 
-    /* Validate */
-    {
-        static const U32 expectedMemoryIndex = 0;
-        if (instruction.memoryIndex1 != expectedMemoryIndex) {
+    if (!writer->ignore) {
+        WasmValueType localType = 0;
+        const bool gotType = wasmModuleFunctionGetLocalType(
+            writer->module,
+            writer->function,
+            instruction.localIndex,
+            &localType
+        );
+        if (!gotType) {
             fprintf(
                 stderr,
-                "w2c2: invalid memory.copy instruction: expected memory index 1 to be %u, got %u\n",
-                expectedMemoryIndex,
-                instruction.memoryIndex1
+                "w2c2: invalid local.get instruction: invalid local index: %u\n",
+                instruction.localIndex
             );
             return false;
         }
+        MUST (wasmTypeStackAppend(writer->typeStack, localType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
 
-        if (instruction.memoryIndex2 != expectedMemoryIndex) {
-            fprintf(
-                stderr,
-                "w2c2: invalid memory.copy instruction: expected memory index 2 to be %u, got %u\n",
-                expectedMemoryIndex,
-                instruction.memoryIndex2
-            );
-            return false;
+            MUST (wasmCWriteResultStart(writer, stackIndex0, localType))
+            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
+            MUST (wasmCWriteResultEnd(writer))
         }
-    }
-
-    if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
-
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "wasmMemoryCopy("))
-        MUST (wasmCWriteStringMemoryUse(
-            writer->builder,
-            writer->module,
-            instruction.memoryIndex1,
-            true
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringMemoryUse(
-            writer->builder,
-            writer->module,
-            instruction.memoryIndex2,
-            true
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex2,
-            writer->typeStack->valueTypes[stackIndex2]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex1,
-            writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex0,
-            writer->typeStack->valueTypes[stackIndex0]
-        ))
-        MUST (wasmCWrite(writer, ");\n"))
 
-        wasmTypeStackDrop(writer->typeStack, 3);
+        /*
+         * Check all following accesses using the local as their base address at once,
+         * instead of checking each of them individually
+         */
+        if (writer->boundsCheckMode == wasmBoundsCheckModeChecked
+            && localType == wasmValueTypeI32
+        ) {
+            U32 offset = 0;
+            U32 length = 0;
+            if (wasmBoundsCheckScan(
+                writer->code->instructions.instructions + writer->instructionIndex,
+                writer->code->instructions.length - writer->instructionIndex,
+                instruction.localIndex,
+                writer->boundsCheckAccesses,
+                &offset,
+                &length
+            )) {
+                MUST (wasmCWriteBoundsCheckStart(writer))
+                MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
+                MUST (wasmCWriteBoundsCheckEnd(writer, offset, length))
+            }
+        }
     }
 
     return true;
@@ -1646,146 +1818,221 @@ wasmCWriteMemoryCopyExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryFillExpr(
+wasmCWriteLocalAssignmentExpr(
     const WasmCFunctionWriter* writer,
-    const WasmMiscOpcode miscOpcode
+    const WasmOpcode opcode
 ) {
-    WasmMemoryInstruction instruction;
-    if (!wasmMemoryInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid memory.fill instruction encoding\n");
-        return false;
-    }
-
-    {
-        static const U32 expectedMemoryIndex = 0;
-        if (instruction.memoryIndex != expectedMemoryIndex) {
-            fprintf(
-                stderr,
-                "w2c2: invalid memory.fill instruction: expected memory index %u, got %u\n",
-                expectedMemoryIndex,
-                instruction.memoryIndex
-            );
-            return false;
-        }
-    }
+    const WasmLocalInstruction instruction = writer->instruction->immediates.local;
 
     if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
-
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "wasmMemoryFill("))
-        MUST (wasmCWriteStringMemoryUse(
-            writer->builder,
+        WasmValueType localType = 0;
+        const bool gotType = wasmModuleFunctionGetLocalType(
             writer->module,
-            instruction.memoryIndex,
-            true
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex2,
-            writer->typeStack->valueTypes[stackIndex2]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex1,
-            writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex0,
-            writer->typeStack->valueTypes[stackIndex0]
-        ))
-        MUST (wasmCWrite(writer, ");\n"))
+            writer->function,
+            instruction.localIndex,
+            &localType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid local index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.localIndex
+            );
+            return false;
+        }
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, localType))
 
-        wasmTypeStackDrop(writer->typeStack, 3);
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringLocalName(writer->builder, instruction.localIndex))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStackValue(writer, stackIndex0))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+        if (opcode == wasmOpcodeLocalSet) {
+            wasmTypeStackDrop(writer->typeStack, 1);
+        }
     }
 
     return true;
 }
 
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLiteral(
+    StringBuilder* builder,
+    const WasmValueType valueType,
+    const WasmValue value
+) {
+    switch (valueType) {
+        case wasmValueTypeI32: {
+            MUST (stringBuilderAppendI32(builder, value.i32))
+            MUST (stringBuilderAppendChar(builder, 'U'))
+            break;
+        }
+        case wasmValueTypeI64: {
+            MUST (stringBuilderAppend(builder, "W2C2_LL("))
+            MUST (stringBuilderAppendI64(builder, value.i64))
+            MUST (stringBuilderAppend(builder, "U)"))
+            break;
+        }
+        case wasmValueTypeF32: {
+            const U32 bits = (U32) value.i32;
+            if ((bits & 0x7f800000U) == 0x7f800000U) {
+                const bool isNegative = (bits & 0x80000000U) != 0;
+                const U32 significand = bits & 0x7fffffU;
+                if (significand == 0) {
+                    if (isNegative) {
+                        MUST (stringBuilderAppendChar(builder, '-'))
+                    }
+                    MUST (stringBuilderAppend(builder, "INFINITY"))
+                } else {
+                    MUST (stringBuilderAppend(builder, "f32_reinterpret_i32(0x"))
+                    MUST (stringBuilderAppendU32Hex(builder, bits))
+                    MUST (stringBuilderAppendChar(builder, ')'))
+                }
+            } else if (bits == 0x80000000U) {
+                MUST (stringBuilderAppend(builder, "-0.f"))
+            } else {
+                MUST (stringBuilderAppendF32(builder, value.f32))
+            }
+            break;
+        }
+        case wasmValueTypeF64: {
+            const U64 bits = (U64) value.i64;
+            if ((bits & 0x7ff0000000000000ULL) == 0x7ff0000000000000ULL) {
+                const bool isNegative = (bits & 0x8000000000000000ULL) != 0;
+                const U64 significand = bits & 0x7fffffULL;
+                if (significand == 0) {
+                    if (isNegative) {
+                        MUST (stringBuilderAppendChar(builder, '-'))
+                    }
+                    MUST (stringBuilderAppend(builder, "INFINITY"))
+                } else {
+                    MUST (stringBuilderAppend(builder, "f64_reinterpret_i64(0x"))
+                    MUST (stringBuilderAppendU64Hex(builder, bits))
+                    MUST (stringBuilderAppendChar(builder, ')'))
+                }
+            } else if (bits == 0x8000000000000000ULL) {
+                MUST (stringBuilderAppend(builder, "-0.f"))
+            } else {
+                MUST (stringBuilderAppendF64(builder, value.f64))
+            }
+            break;
+        }
+        default:
+            fprintf(stderr, "w2c2: unsupported const type %s\n", wasmValueTypeDescription(valueType));
+            return false;
+    }
+
+    return true;
+}
 
+/*
+ * wasmCGetGlobalConstant returns true if the given global always has the same value,
+ * i.e. it is not imported, it is immutable, and its init expression is a number constant,
+ * or a read of another such global, of the given type. The value is stored in the given value.
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteUnaryExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmValueType resultType,
-    const char* operator
+wasmCGetGlobalConstant(
+    const WasmModule* module,
+    U32 globalIndex,
+    const WasmValueType valueType,
+    WasmValue* value
 ) {
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    const size_t globalImportCount = module->globalImports.length;
 
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+    /* The init expression of a global may only read globals defined before it */
+    while (globalIndex >= globalImportCount
+           && globalIndex - globalImportCount < module->globals.count
+    ) {
+        const WasmGlobal global = module->globals.globals[globalIndex - globalImportCount];
+        Buffer code = global.init;
+        WasmOpcode opcode = 0;
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
-    MUST (wasmCWriteAssign(writer))
-    MUST (wasmCWrite(writer, operator))
-    MUST (wasmCWriteChar(writer, '('))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    MUST (wasmCWrite(writer, ");\n"))
+        if (global.type.mutable || !wasmOpcodeRead(&code, &opcode)) {
+            return false;
+        }
 
-    wasmTypeStackDrop(writer->typeStack, 1);
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        switch (opcode) {
+            case wasmOpcodeI32Const:
+            case wasmOpcodeI64Const:
+            case wasmOpcodeF32Const:
+            case wasmOpcodeF64Const: {
+                WasmConstInstruction instruction;
+                if (wasmOpcodeResultType(opcode) != valueType
+                    || !wasmConstInstructionRead(&code, opcode, &instruction)
+                ) {
+                    return false;
+                }
+                *value = instruction.value;
+                return true;
+            }
+            case wasmOpcodeGlobalGet: {
+                WasmGlobalInstruction instruction;
+                if (!wasmGlobalInstructionRead(&code, &instruction)
+                    || instruction.globalIndex >= globalIndex
+                ) {
+                    return false;
+                }
+                globalIndex = instruction.globalIndex;
+                break;
+            }
+            default:
+                return false;
+        }
+    }
 
-    return true;
+    return false;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteInfixBinaryExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmValueType resultType,
-    const char* operator,
-    const bool assignmentAllowed
+wasmCWriteGlobalGetExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+    static const WasmOpcode opcode = wasmOpcodeGlobalGet;
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+    const WasmGlobalInstruction instruction = writer->instruction->immediates.global;
 
-    if (assignmentAllowed) {
-        if (writer->pretty) {
-            MUST (wasmCWriteChar(writer, ' '))
+    if (!writer->ignore) {
+        WasmValueType globalType = 0;
+        const bool gotType = wasmModuleGetGlobalType(
+            writer->module,
+            instruction.globalIndex,
+            &globalType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid global index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.globalIndex
+            );
+            return false;
         }
-        MUST (wasmCWrite(writer, operator))
-        MUST (wasmCWriteChar(writer, '='))
-        if (writer->pretty) {
-            MUST (wasmCWriteChar(writer, ' '))
+        MUST (wasmTypeStackAppend(writer->typeStack, globalType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            WasmValue constant;
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
+
+            MUST (wasmCWriteResultStart(writer, stackIndex0, globalType))
+            /* Globals which always have the same value are replaced by it */
+            if (wasmCGetGlobalConstant(writer->module, instruction.globalIndex, globalType, &constant)) {
+                MUST (wasmCWriteLiteral(writer->builder, globalType, constant))
+            } else {
+                MUST (wasmCWriteGlobalUse(writer, instruction.globalIndex))
+            }
+            MUST (wasmCWriteResultEnd(writer))
         }
-    } else {
-        MUST (wasmCWriteAssign(writer))
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex1,
-            writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteChar(writer, ' '))
-        MUST (wasmCWrite(writer, operator))
-        MUST (wasmCWriteChar(writer, ' '))
     }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    MUST (wasmCWrite(writer, ";\n"))
-
-    wasmTypeStackDrop(writer->typeStack, 2);
-
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
     return true;
 }
@@ -1793,92 +2040,73 @@ wasmCWriteInfixBinaryExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteSignedInfixBinaryExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode,
-    const char* operator
+wasmCWriteGlobalSetExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    const WasmValueType resultType = wasmOpcodeResultType(opcode);
-    const WasmValueType parameter1Type = wasmOpcodeParameter1Type(opcode);
-
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    static const WasmOpcode opcode = wasmOpcodeGlobalSet;
 
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+    const WasmGlobalInstruction instruction = writer->instruction->immediates.global;
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " = ("))
-    } else {
-        MUST (wasmCWrite(writer, "=("))
-    }
-    MUST (wasmCWrite(writer, valueTypeNames[parameter1Type]))
-    MUST (wasmCWrite(writer, ")(("))
-    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
-    MUST (wasmCWriteChar(writer, ')'))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWriteChar(writer, ' '))
-    }
-    MUST (wasmCWrite(writer, operator))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " ("))
-    } else {
-        MUST (wasmCWriteChar(writer, '('))
-    }
-    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
-    MUST (wasmCWriteChar(writer, ')'))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    MUST (wasmCWrite(writer, ");\n"))
+    if (!writer->ignore) {
+        WasmValueType globalType = 0;
+        const bool gotType = wasmModuleGetGlobalType(
+            writer->module,
+            instruction.globalIndex,
+            &globalType
+        );
+        if (!gotType) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction: invalid global index: %u\n",
+                wasmOpcodeDescription(opcode),
+                instruction.globalIndex
+            );
+            return false;
+        }
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, globalType))
 
-    wasmTypeStackDrop(writer->typeStack, 2);
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteGlobalUse(writer, instruction.globalIndex))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStackValue(writer, stackIndex0))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+        wasmTypeStackDrop(writer->typeStack, 1);
+    }
 
     return true;
 }
 
+/*
+ * wasmCWriteV128Literal writes a v128 constant as a call of v128_const
+ * with the four 32-bit lanes
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWritePrefixBinaryExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmValueType resultType,
-    const char* operator
+wasmCWriteV128Literal(
+    StringBuilder* builder,
+    const U8* bytes
 ) {
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
-
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
-    MUST (wasmCWriteAssign(writer))
-    MUST (wasmCWrite(writer, operator))
-    MUST (wasmCWriteChar(writer, '('))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    MUST (wasmCWriteComma(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    MUST (wasmCWrite(writer, ");\n"))
+    U32 laneIndex = 0;
 
-    wasmTypeStackDrop(writer->typeStack, 2);
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+    MUST (stringBuilderAppend(builder, "v128_const("))
+    for (; laneIndex < 4; laneIndex++) {
+        const U8* laneBytes = bytes + laneIndex * 4;
+        const U32 lane = (U32) laneBytes[0]
+            | ((U32) laneBytes[1] << 8)
+            | ((U32) laneBytes[2] << 16)
+            | ((U32) laneBytes[3] << 24);
+        if (laneIndex > 0) {
+            MUST (stringBuilderAppend(builder, ", "))
+        }
+        MUST (stringBuilderAppend(builder, "0x"))
+        MUST (stringBuilderAppendU32Hex(builder, lane))
+        MUST (stringBuilderAppendChar(builder, 'U'))
+    }
+    MUST (stringBuilderAppendChar(builder, ')'))
 
     return true;
 }
@@ -1886,168 +2114,74 @@ wasmCWritePrefixBinaryExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteSignedShiftRightExpr(
+wasmCWriteConstExpr(
     const WasmCFunctionWriter* writer,
     const WasmOpcode opcode
 ) {
-    const WasmValueType resultType = wasmOpcodeResultType(opcode);
-
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-    MUST (wasmTypeStackSet(
-        writer->stackDeclarations,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
+    const WasmConstInstruction instruction = writer->instruction->immediates.constant;
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " = ("))
-    } else {
-        MUST (wasmCWrite(writer, "=("))
-    }
-    MUST (wasmCWrite(writer, valueTypeNames[resultType]))
-    MUST (wasmCWrite(writer, ")(("))
-    MUST (wasmCWrite(writer, signedTypeNames[resultType]))
-    MUST (wasmCWriteChar(writer, ')'))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " >> ("))
-    } else {
-        MUST (wasmCWrite(writer, ">>("))
-    }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " & "))
-    } else {
-        MUST (wasmCWriteChar(writer, '&'))
+    if (!writer->ignore) {
+        const WasmValueType resultType = wasmOpcodeResultType(opcode);
+        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+            MUST (wasmCWriteResultStart(writer, stackIndex0, resultType))
+            MUST (wasmCWriteLiteral(writer->builder, resultType, instruction.value))
+            MUST (wasmCWriteResultEnd(writer))
+        }
     }
-    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
-    MUST (wasmCWrite(writer, "));\n"))
-
-    wasmTypeStackDrop(writer->typeStack, 1);
 
     return true;
 }
 
+/*
+ * wasmCWriteMemoryAddress writes the address of a memory access,
+ * i.e. the given stack entry plus the offset of the instruction
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteUnsignedShiftRightExpr(
+wasmCWriteMemoryAddress(
     const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+    const U32 stackIndex,
+    const U32 offset
 ) {
-    const WasmValueType resultType = wasmOpcodeResultType(opcode);
-
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-    MUST (wasmTypeStackSet(
-        writer->stackDeclarations,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " >>= ("))
-    } else {
-        MUST (wasmCWrite(writer, ">>=("))
-    }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " & "))
-    } else {
-        MUST (wasmCWriteChar(writer, '&'))
+    MUST (wasmCWrite(writer, "(U64)"))
+    MUST (wasmCWriteStackValue(writer, stackIndex))
+    if (offset != 0) {
+        MUST (wasmCWritePlus(writer))
+        MUST (stringBuilderAppendU32(writer->builder, offset))
+        MUST (wasmCWriteChar(writer, 'U'))
     }
-    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
-    MUST (wasmCWrite(writer, ");\n"))
-
-    wasmTypeStackDrop(writer->typeStack, 1);
-
     return true;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteShiftLeftExpr(
+wasmCWriteLoad(
     const WasmCFunctionWriter* writer,
-    const WasmOpcode opcode
+    const WasmMemoryArgumentInstruction instruction,
+    const char* functionName,
+    WasmValueType resultType,
+    const WasmInstruction* position,
+    const U32 length
 ) {
-    const WasmValueType resultType = wasmOpcodeResultType(opcode);
-
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
     const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    MUST (wasmCWriteBoundsCheck(writer, position, stackIndex0, instruction.offset, length))
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+    MUST (wasmCWriteResultStart(writer, stackIndex0, resultType))
+    MUST (wasmCWriteMemoryAccessStart(writer, functionName))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteMemoryAddress(writer, stackIndex0, instruction.offset))
+    MUST (wasmCWriteChar(writer, ')'))
 
-    MUST (wasmTypeStackSet(
-        writer->stackDeclarations,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " <<= ("))
-    } else {
-        MUST (wasmCWrite(writer, "<<=("))
-    }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " & "))
-    } else {
-        MUST (wasmCWriteChar(writer, '&'))
-    }
-    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
-    MUST (wasmCWrite(writer, ");\n"))
+    MUST (wasmCWriteResultEnd(writer))
 
     wasmTypeStackDrop(writer->typeStack, 1);
 
-    return true;
-}
-
-static
-bool
-WARN_UNUSED_RESULT
-wasmCWriteLabel(
-    const WasmCFunctionWriter* writer,
-    const U32 labelIndex
-) {
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringLabelName(writer->builder, labelIndex))
-    MUST (wasmCWrite(writer, ":;\n"))
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
     return true;
 }
@@ -2055,108 +2189,252 @@ wasmCWriteLabel(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteIfExpr(
-    WasmCFunctionWriter* writer,
-    WasmOpcode* opcode
+wasmCWriteLoadExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
 ) {
-    const bool ignore = writer->ignore;
-
-    size_t typeStackLengthBeforeBranches = 0;
-    WasmLabel label = wasmEmptyLabel;
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+    const WasmInstruction* position = writer->instruction;
 
-    WasmValueType blockValueType = 0;
-    WasmValueType* blockType = &blockValueType;
-    if (!wasmReadBlockType(writer->code, &blockType)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction: expected block type\n",
-            wasmOpcodeDescription(*opcode)
-        );
-        return false;
-    }
-
-    if (!ignore) {
-        MUST (wasmCWriteIndent(writer))
-        if (writer->pretty) {
-            MUST (wasmCWrite(writer, "if ("))
-        } else {
-            MUST (wasmCWrite(writer, "if("))
-        }
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-            ))
-        }
-        if (writer->pretty) {
-            MUST (wasmCWrite(writer, ") {\n"))
-        } else {
-            MUST (wasmCWrite(writer, "){\n"))
+    if (!writer->ignore) {
+        WasmValueType resultType = 0;
+        char* functionName = NULL;
+        switch (opcode) {
+            case wasmOpcodeI32Load: {
+                resultType = wasmValueTypeI32;
+                functionName = "i32_load";
+                break;
+            }
+            case wasmOpcodeI64Load: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load";
+                break;
+            }
+            case wasmOpcodeF32Load: {
+                resultType = wasmValueTypeF32;
+                functionName = "f32_load";
+                break;
+            }
+            case wasmOpcodeF64Load: {
+                resultType = wasmValueTypeF64;
+                functionName = "f64_load";
+                break;
+            }
+            case wasmOpcodeI32Load8S: {
+                resultType = wasmValueTypeI32;
+                functionName = "i32_load8_s";
+                break;
+            }
+            case wasmOpcodeI64Load8S: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load8_s";
+                break;
+            }
+            case wasmOpcodeI32Load8U: {
+                resultType = wasmValueTypeI32;
+                functionName = "i32_load8_u";
+                break;
+            }
+            case wasmOpcodeI64Load8U: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load8_u";
+                break;
+            }
+            case wasmOpcodeI32Load16S: {
+                resultType = wasmValueTypeI32;
+                functionName = "i32_load16_s";
+                break;
+            }
+            case wasmOpcodeI64Load16S: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load16_s";
+                break;
+            }
+            case wasmOpcodeI32Load16U: {
+                resultType = wasmValueTypeI32;
+                functionName = "i32_load16_u";
+                break;
+            }
+            case wasmOpcodeI64Load16U: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load16_u";
+                break;
+            }
+            case wasmOpcodeI64Load32S: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load32_s";
+                break;
+            }
+            case wasmOpcodeI64Load32U: {
+                resultType = wasmValueTypeI64;
+                functionName = "i64_load32_u";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported load instruction opcode: %s\n",
+                    wasmOpcodeDescription(opcode)
+                );
+                return false;
+            }
         }
 
-        wasmTypeStackDrop(writer->typeStack, 1);
-
-        typeStackLengthBeforeBranches = writer->typeStack->length;
-
-        MUST (wasmLabelStackPush(
-            writer->labelStack,
-            typeStackLengthBeforeBranches,
-            blockType,
-            &label
+        MUST (wasmCWriteLoad(
+            writer,
+            instruction,
+            functionName,
+            resultType,
+            position,
+            wasmBoundsCheckAccessLength(opcode)
         ))
-
-        writer->indent++;
     }
 
-    MUST (wasmCWriteFunctionCode(writer, opcode))
+    return true;
+}
 
-    if (!ignore) {
-        writer->ignore = false;
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStore(
+    const WasmCFunctionWriter* writer,
+    const WasmMemoryArgumentInstruction instruction,
+    const char* functionName,
+    const WasmInstruction* position,
+    const U32 length
+) {
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
 
-        writer->indent--;
+    MUST (wasmCWriteBoundsCheck(writer, position, stackIndex1, instruction.offset, length))
 
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWriteChar(writer, '}'))
-    }
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteMemoryAccessStart(writer, functionName))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteMemoryAddress(writer, stackIndex1, instruction.offset))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    MUST (wasmCWrite(writer, ");\n"))
 
-    if (*opcode == wasmOpcodeElse) {
-        if (!ignore) {
-            writer->typeStack->length = typeStackLengthBeforeBranches;
+    wasmTypeStackDrop(writer->typeStack, 2);
 
-            if (writer->pretty) {
-                MUST (wasmCWrite(writer, " else {\n"))
-            } else {
-                MUST (wasmCWrite(writer, "else{\n"))
-            }
+    return true;
+}
 
-            writer->indent++;
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStoreExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+    const WasmInstruction* position = writer->instruction;
+
+    if (!writer->ignore) {
+        char* functionName = NULL;
+        switch (opcode) {
+            case wasmOpcodeI32Store: {
+                functionName = "i32_store";
+                break;
+            }
+            case wasmOpcodeI64Store: {
+                functionName = "i64_store";
+                break;
+            }
+            case wasmOpcodeF32Store: {
+                functionName = "f32_store";
+                break;
+            }
+            case wasmOpcodeF64Store: {
+                functionName = "f64_store";
+                break;
+            }
+            case wasmOpcodeI32Store8: {
+                functionName = "i32_store8";
+                break;
+            }
+            case wasmOpcodeI64Store8: {
+                functionName = "i64_store8";
+                break;
+            }
+            case wasmOpcodeI32Store16: {
+                functionName = "i32_store16";
+                break;
+            }
+            case wasmOpcodeI64Store16: {
+                functionName = "i64_store16";
+                break;
+            }
+            case wasmOpcodeI64Store32: {
+                functionName = "i64_store32";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported store instruction opcode: %s\n",
+                    wasmOpcodeDescription(opcode)
+                );
+                return false;
+            }
         }
 
-        MUST (wasmCWriteFunctionCode(writer, opcode))
+        MUST (wasmCWriteStore(
+            writer,
+            instruction,
+            functionName,
+            position,
+            wasmBoundsCheckAccessLength(opcode)
+        ))
+    }
 
-        if (!ignore) {
-            writer->ignore = false;
+    return true;
+}
 
-            writer->indent--;
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemorySizeExpr(
+    const WasmCFunctionWriter* writer
+) {
+    const WasmMemoryInstruction instruction = writer->instruction->immediates.memory;
 
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteChar(writer, '}'))
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory.size instruction: expected memory index %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex
+            );
+            return false;
         }
     }
 
-    if (!ignore) {
-        MUST (wasmCWrite(writer, "\n"))
-
-        MUST (wasmCWriteLabel(writer, label.index))
-
-        writer->typeStack->length = typeStackLengthBeforeBranches;
+    if (!writer->ignore) {
+        static const WasmValueType resultType = wasmValueTypeI32;
 
-        wasmLabelStackPop(writer->labelStack);
+        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
 
-        if (blockType != NULL) {
-            MUST (wasmTypeStackAppend(writer->typeStack, blockValueType))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                resultType
+            ))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringMemoryUse(
+                writer->builder,
+                writer->module,
+                instruction.memoryIndex,
+                false
+            ))
+            MUST (wasmCWrite(writer, ".pages;\n"))
         }
     }
 
@@ -2166,63 +2444,49 @@ wasmCWriteIfExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteBlockExpr(
-    WasmCFunctionWriter* writer,
-    WasmOpcode* opcode
+wasmCWriteMemoryGrowExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    const bool ignore = writer->ignore;
+    const WasmMemoryInstruction instruction = writer->instruction->immediates.memory;
 
-    size_t typeStackLengthBeforeBranches = 0;
-    WasmLabel label = wasmEmptyLabel;
-
-    WasmValueType blockValueType = 0;
-    WasmValueType* blockType = &blockValueType;
-    if (!wasmReadBlockType(writer->code, &blockType)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction: expected block type\n",
-            wasmOpcodeDescription(*opcode)
-        );
-        return false;
-    }
-
-    if (!ignore) {
-        typeStackLengthBeforeBranches = writer->typeStack->length;
-
-        MUST (wasmLabelStackPush(
-            writer->labelStack,
-            typeStackLengthBeforeBranches,
-            blockType,
-            &label
-        ))
-
-        if (writer->pretty) {
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWrite(writer, "{\n"))
-            writer->indent++;
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory.grow instruction: expected memory index %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex
+            );
+            return false;
         }
     }
 
-    MUST (wasmCWriteFunctionCode(writer, opcode))
-
-    if (!ignore) {
-        writer->ignore = false;
+    if (!writer->ignore) {
+        static const WasmValueType resultType = wasmValueTypeI32;
 
-        if (writer->pretty) {
-            writer->indent--;
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
 
             MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWrite(writer, "}\n"))
-        }
-
-        MUST (wasmCWriteLabel(writer, label.index))
-
-        writer->typeStack->length = typeStackLengthBeforeBranches;
-
-        wasmLabelStackPop(writer->labelStack);
-
-        if (blockType != NULL) {
-            MUST (wasmTypeStackAppend(writer->typeStack, blockValueType))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, "wasmMemoryGrow("))
+            MUST (wasmCWriteStringMemoryUse(
+                writer->builder,
+                writer->module,
+                instruction.memoryIndex,
+                true
+            ))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+            MUST (wasmCWrite(writer, ");\n"))
+            MUST (wasmCWriteMemoryBaseRefresh(writer))
         }
     }
 
@@ -2232,62 +2496,48 @@ wasmCWriteBlockExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteLoopExpr(
-    WasmCFunctionWriter* writer,
-    WasmOpcode* opcode
+wasmCWriteMemoryInitExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    const bool ignore = writer->ignore;
-
-    size_t typeStackLengthBeforeBranches = 0;
-    WasmLabel label = wasmEmptyLabel;
-
-    WasmValueType blockValueType = 0;
-    WasmValueType* blockType = &blockValueType;
-    if (!wasmReadBlockType(writer->code, &blockType)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction: expected block type\n",
-            wasmOpcodeDescription(*opcode)
-       );
-        return false;
-    }
-
-    if (!ignore) {
-        typeStackLengthBeforeBranches = writer->typeStack->length;
-
-        MUST (wasmLabelStackPush(
-            writer->labelStack,
-            typeStackLengthBeforeBranches,
-            /* NOTE: ignoring block type (result type) */
-            NULL,
-            &label
-        ))
-
-        MUST (wasmCWriteLabel(writer, label.index))
-
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "{\n"))
-
-        writer->indent++;
-    }
-
-    MUST (wasmCWriteFunctionCode(writer, opcode))
-
-    if (!ignore) {
-        writer->ignore = false;
+    const WasmMemoryInitInstruction instruction = writer->instruction->immediates.memoryInit;
 
-        writer->indent--;
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
 
         MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "}\n"))
-
-        writer->typeStack->length = typeStackLengthBeforeBranches;
-
-        wasmLabelStackPop(writer->labelStack);
+        MUST (wasmCWrite(writer, "LOAD_DATA("))
+        MUST (wasmCWriteStringMemoryUse(
+            writer->builder,
+            writer->module,
+            instruction.memoryIndex,
+            false
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex2,
+            writer->typeStack->valueTypes[stackIndex2]
+        ))
+        MUST (wasmCWriteComma(writer))
+        /* TODO: add support for multiple modules */
+        MUST (wasmCWriteStringDataSegmentName(writer->builder, instruction.dataSegmentIndex))
+        MUST (wasmCWriteChar(writer, '+'))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex1,
+            writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ");\n"))
 
-        if (blockType != NULL) {
-            MUST (wasmTypeStackAppend(writer->typeStack, blockValueType))
-        }
+        wasmTypeStackDrop(writer->typeStack, 3);
     }
 
     return true;
@@ -2296,117 +2546,165 @@ wasmCWriteLoopExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteGoto(
-    const WasmCFunctionWriter* writer,
-    const U32 labelStackIndex
+wasmCWriteMemoryCopyExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    const WasmLabel label = writer->labelStack->labels.labels[labelStackIndex];
+    const WasmMemoryCopyInstruction instruction = writer->instruction->immediates.memoryCopy;
 
-    MUST (wasmCWriteIndent(writer))
+    /* Validate */
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex1 != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory.copy instruction: expected memory index 1 to be %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex1
+            );
+            return false;
+        }
 
-    if (label.type != NULL) {
-        const WasmValueType resultType = *label.type;
+        if (instruction.memoryIndex2 != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory.copy instruction: expected memory index 2 to be %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex2
+            );
+            return false;
+        }
+    }
 
+    if (!writer->ignore) {
         const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 destinationStackIndex = assertSizeU32(label.typeStackLength);
-
-        if (destinationStackIndex != stackIndex0) {
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
 
-            MUST (wasmTypeStackSet(writer->stackDeclarations, destinationStackIndex, resultType))
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "wasmMemoryCopy("))
+        MUST (wasmCWriteStringMemoryUse(
+            writer->builder,
+            writer->module,
+            instruction.memoryIndex1,
+            true
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringMemoryUse(
+            writer->builder,
+            writer->module,
+            instruction.memoryIndex2,
+            true
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex2,
+            writer->typeStack->valueTypes[stackIndex2]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex1,
+            writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ");\n"))
 
-            MUST (wasmCWriteStringStackName(writer->builder, destinationStackIndex, resultType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-            ))
-            if (writer->pretty) {
-                MUST (wasmCWrite(writer, "; "))
-            } else {
-                MUST (wasmCWriteChar(writer, ';'))
-            }
-        }
+        wasmTypeStackDrop(writer->typeStack, 3);
     }
 
-    MUST (wasmCWrite(writer, "goto "))
-    MUST (wasmCWriteStringLabelName(writer->builder, label.index))
-    MUST (wasmCWrite(writer, ";\n"))
     return true;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteSelectExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteMemoryFillExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmMiscOpcode miscOpcode
 ) {
-    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-    const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+    const WasmMemoryInstruction instruction = writer->instruction->immediates.memory;
 
-    /* same as 2 */
-    const WasmValueType resultType = writer->typeStack->valueTypes[stackIndex1];
+    {
+        static const U32 expectedMemoryIndex = 0;
+        if (instruction.memoryIndex != expectedMemoryIndex) {
+            fprintf(
+                stderr,
+                "w2c2: invalid memory.fill instruction: expected memory index %u, got %u\n",
+                expectedMemoryIndex,
+                instruction.memoryIndex
+            );
+            return false;
+        }
+    }
 
-    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
 
-    MUST (wasmCWriteIndent(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex2,
-        resultType
-    ))
-    MUST (wasmCWriteAssign(writer))
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex0,
-        writer->typeStack->valueTypes[stackIndex0]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " ? "))
-    } else {
-        MUST (wasmCWriteChar(writer, '?'))
-    }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex2,
-        writer->typeStack->valueTypes[stackIndex2]
-    ))
-    if (writer->pretty) {
-        MUST (wasmCWrite(writer, " : "))
-    } else {
-        MUST (wasmCWriteChar(writer, ':'))
-    }
-    MUST (wasmCWriteStringStackName(
-        writer->builder,
-        stackIndex1,
-        writer->typeStack->valueTypes[stackIndex1]
-    ))
-    MUST (wasmCWrite(writer, ";\n"))
-
-    wasmTypeStackDrop(writer->typeStack, 3);
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "wasmMemoryFill("))
+        MUST (wasmCWriteStringMemoryUse(
+            writer->builder,
+            writer->module,
+            instruction.memoryIndex,
+            true
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex2,
+            writer->typeStack->valueTypes[stackIndex2]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex1,
+            writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ");\n"))
 
-    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        wasmTypeStackDrop(writer->typeStack, 3);
+    }
 
     return true;
 }
 
+
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteBranchExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteUnaryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmValueType resultType,
+    const char* operator
 ) {
-    WasmBranchInstruction instruction;
-    if (!wasmBranchInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid br instruction encoding\n");
-        return false;
-    }
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-    if (!writer->ignore) {
-        const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
-        MUST (wasmCWriteGoto(writer, labelIndex))
-    }
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, resultType))
+
+    MUST (wasmCWriteResultStart(writer, stackIndex0, resultType))
+    MUST (wasmCWrite(writer, operator))
+    MUST (wasmCWriteChar(writer, '('))
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    MUST (wasmCWriteChar(writer, ')'))
+
+    MUST (wasmCWriteResultEnd(writer))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
     return true;
 }
@@ -2414,48 +2712,42 @@ wasmCWriteBranchExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteBranchIfExpr(
-    WasmCFunctionWriter* writer
+wasmCWriteInfixBinaryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmValueType resultType,
+    const char* operator,
+    const bool assignmentAllowed
 ) {
-    WasmBranchInstruction instruction;
-    if (!wasmBranchInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid br.if instruction encoding\n");
-        return false;
-    }
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-    if (!writer->ignore) {
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
 
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    /* Compound assignments cannot be folded */
+    if (assignmentAllowed && writer->folder == NULL) {
         MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
         if (writer->pretty) {
-            MUST (wasmCWrite(writer, "if ("))
-        } else {
-            MUST (wasmCWrite(writer, "if("))
+            MUST (wasmCWriteChar(writer, ' '))
         }
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex0,
-            writer->typeStack->valueTypes[stackIndex0]
-        ))
+        MUST (wasmCWrite(writer, operator))
+        MUST (wasmCWriteChar(writer, '='))
         if (writer->pretty) {
-            MUST (wasmCWrite(writer, ") {\n"))
-        } else {
-            MUST (wasmCWrite(writer, "){\n"))
+            MUST (wasmCWriteChar(writer, ' '))
         }
+    } else {
+        MUST (wasmCWriteResultStart(writer, stackIndex1, resultType))
+        MUST (wasmCWriteStackValue(writer, stackIndex1))
+        MUST (wasmCWriteChar(writer, ' '))
+        MUST (wasmCWrite(writer, operator))
+        MUST (wasmCWriteChar(writer, ' '))
+    }
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    MUST (wasmCWriteResultEnd(writer))
 
-        writer->indent++;
-
-        wasmTypeStackDrop(writer->typeStack, 1);
-
-        {
-            const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
-            MUST (wasmCWriteGoto(writer, labelIndex))
-        }
+    wasmTypeStackDrop(writer->typeStack, 2);
 
-        writer->indent--;
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "}\n"))
-    }
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
     return true;
 }
@@ -2463,73 +2755,43 @@ wasmCWriteBranchIfExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteBranchTableExpr(
-    WasmCFunctionWriter* writer
+wasmCWriteSignedInfixBinaryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    const char* operator
 ) {
-    WasmBranchTableInstruction instruction;
-    if (!wasmBranchTableInstructionRead(writer->code, &instruction)) {
-        fprintf(stderr, "w2c2: invalid br_table instruction encoding\n");
-        return false;
-    }
-
-    if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-        MUST (wasmCWriteIndent(writer))
-        if (writer->pretty) {
-            MUST (wasmCWrite(writer, "switch ("))
-        } else {
-            MUST (wasmCWrite(writer, "switch("))
-        }
-        MUST (wasmCWriteStringStackName(
-            writer->builder,
-            stackIndex0,
-            writer->typeStack->valueTypes[stackIndex0]
-        ))
-        if (writer->pretty) {
-            MUST (wasmCWrite(writer, ") {\n"))
-        } else {
-            MUST (wasmCWrite(writer, "){\n"))
-        }
-
-        wasmTypeStackDrop(writer->typeStack, 1);
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
+    const WasmValueType parameter1Type = wasmOpcodeParameter1Type(opcode);
 
-        {
-            U32 index = 0;
-            for (; index < instruction.labelIndexCount; index++) {
-                MUST (wasmCWriteIndent(writer))
-                MUST (wasmCWrite(writer, "case "))
-                MUST (stringBuilderAppendU32(writer->builder, index))
-                MUST (wasmCWrite(writer, ":\n"))
-                writer->indent++;
-                {
-                    const U32 labelIndex = wasmLabelStackGetTopIndex(
-                        writer->labelStack,
-                        instruction.labelIndices[index]
-                    );
-                    MUST (wasmCWriteGoto(writer, labelIndex))
-                }
-                writer->indent--;
-            }
-        }
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "default:\n"))
-        writer->indent++;
-        {
-            const U32 labelIndex = wasmLabelStackGetTopIndex(
-                writer->labelStack,
-                instruction.defaultLabelIndex
-            );
-            MUST (wasmCWriteGoto(writer, labelIndex))
-        }
-        writer->indent--;
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
 
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "}\n"))
+    MUST (wasmCWriteResultStart(writer, stackIndex1, resultType))
+    MUST (wasmCWriteChar(writer, '('))
+    MUST (wasmCWrite(writer, valueTypeNames[parameter1Type]))
+    MUST (wasmCWrite(writer, ")(("))
+    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteStackValue(writer, stackIndex1))
+    if (writer->pretty) {
+        MUST (wasmCWriteChar(writer, ' '))
     }
+    MUST (wasmCWrite(writer, operator))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " ("))
+    } else {
+        MUST (wasmCWriteChar(writer, '('))
+    }
+    MUST (wasmCWrite(writer, signedTypeNames[parameter1Type]))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteResultEnd(writer))
 
-    wasmBranchTableInstructionFree(instruction);
+    wasmTypeStackDrop(writer->typeStack, 2);
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
     return true;
 }
@@ -2537,104 +2799,124 @@ wasmCWriteBranchTableExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteDebugLine(
-    StringBuilder* builder,
-    const WasmDebugLine* debugLine
-
+wasmCWritePrefixBinaryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmValueType resultType,
+    const char* operator
 ) {
-    MUST (stringBuilderAppend(builder, "#line "))
-    MUST (stringBuilderAppendU64(builder, debugLine->number))
-    MUST (stringBuilderAppend(builder, " \""))
-    MUST (stringBuilderAppend(builder, debugLine->path))
-    MUST (stringBuilderAppend(builder, "\"\n"))
-    return true;
-}
-
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-static
-WasmDebugLine*
-wasmCGetDebugLine(
-    WasmDebugLines* debugLines,
-    const size_t absoluteAddress
-) {
-    WasmDebugLine* debugLine = NULL;
-    if (debugLines->length == 0) {
-        return NULL;
-    }
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
 
-    debugLine = debugLines->debugLines;
+    MUST (wasmCWriteResultStart(writer, stackIndex1, resultType))
+    MUST (wasmCWrite(writer, operator))
+    MUST (wasmCWriteChar(writer, '('))
+    MUST (wasmCWriteStackValue(writer, stackIndex1))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    MUST (wasmCWriteChar(writer, ')'))
 
-    if (debugLines->length > 1) {
-        const WasmDebugLine* nextDebugLine = debugLine + 1;
-        if (absoluteAddress >= nextDebugLine->address) {
-            debugLines->length--;
-            debugLines->debugLines++;
-            debugLine = debugLines->debugLines;
-        }
-    }
+    MUST (wasmCWriteResultEnd(writer))
 
-    if (absoluteAddress < debugLine->address) {
-       return NULL;
-    }
+    wasmTypeStackDrop(writer->typeStack, 2);
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
-    return debugLine;
+    return true;
 }
 
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryAtomicNotifyExpr(
-    const WasmCFunctionWriter* writer
-) {
-    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicNotify;
+wasmCWriteSignedShiftRightExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
 
-    WasmMemoryArgumentInstruction instruction;
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-    if (!wasmMemoryArgument32InstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+
+    MUST (wasmCWriteResultStart(writer, stackIndex1, writer->typeStack->valueTypes[stackIndex1]))
+    MUST (wasmCWriteChar(writer, '('))
+    MUST (wasmCWrite(writer, valueTypeNames[resultType]))
+    MUST (wasmCWrite(writer, ")(("))
+    MUST (wasmCWrite(writer, signedTypeNames[resultType]))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteStackValue(writer, stackIndex1))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " >> ("))
+    } else {
+        MUST (wasmCWrite(writer, ">>("))
+    }
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " & "))
+    } else {
+        MUST (wasmCWriteChar(writer, '&'))
     }
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWrite(writer, "))"))
+    MUST (wasmCWriteResultEnd(writer))
 
-    if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    wasmTypeStackDrop(writer->typeStack, 1);
 
-        static const WasmValueType resultType = wasmValueTypeI32;
+    return true;
+}
 
-        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteUnsignedShiftRightExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode
+) {
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
 
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
-        MUST (wasmCWriteAssign(writer))
-        MUST (wasmCWrite(writer, "wasmMemoryAtomicNotify("))
-        MUST (wasmCWriteStringMemoryUse(
-                writer->builder,
-                writer->module,
-                0,
-                true
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex1,
-                writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-        ))
-        MUST (wasmCWrite(writer, ");\n"))
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-        wasmTypeStackDrop(writer->typeStack, 2);
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
 
-        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+    /* Compound assignments cannot be folded */
+    if (writer->folder == NULL) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStackValue(writer, stackIndex1))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " >>= ("))
+        } else {
+            MUST (wasmCWrite(writer, ">>=("))
+        }
+    } else {
+        MUST (wasmCWriteResultStart(writer, stackIndex1, writer->typeStack->valueTypes[stackIndex1]))
+        MUST (wasmCWriteStackValue(writer, stackIndex1))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " >> ("))
+        } else {
+            MUST (wasmCWrite(writer, ">>("))
+        }
+    }
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " & "))
+    } else {
+        MUST (wasmCWriteChar(writer, '&'))
     }
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteResultEnd(writer))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
 
     return true;
 }
@@ -2642,55 +2924,50 @@ wasmCWriteMemoryAtomicNotifyExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryAtomicWaitExpr(
+wasmCWriteShiftLeftExpr(
     const WasmCFunctionWriter* writer,
-    const bool isWait64
+    const WasmOpcode opcode
 ) {
-    if (!writer->ignore) {
-        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+    const WasmValueType resultType = wasmOpcodeResultType(opcode);
 
-        static const WasmValueType resultType = wasmValueTypeI32;
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
+    MUST (wasmTypeStackSet(
+        writer->stackDeclarations,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
 
+    /* Compound assignments cannot be folded */
+    if (writer->folder == NULL) {
         MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, resultType))
-        MUST (wasmCWriteAssign(writer))
-        MUST (wasmCWrite(writer, "wasmMemoryAtomicWait("))
-        MUST (wasmCWriteStringMemoryUse(
-                writer->builder,
-                writer->module,
-                0,
-                true
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex2,
-                writer->typeStack->valueTypes[stackIndex2]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex1,
-                writer->typeStack->valueTypes[stackIndex1]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-        ))
-        MUST (wasmCWriteComma(writer))
-        MUST (wasmCWrite(writer, isWait64 ? "true" : "false"))
-        MUST (wasmCWrite(writer, ");\n"))
-
-        wasmTypeStackDrop(writer->typeStack, 3);
-
-        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        MUST (wasmCWriteStackValue(writer, stackIndex1))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " <<= ("))
+        } else {
+            MUST (wasmCWrite(writer, "<<=("))
+        }
+    } else {
+        MUST (wasmCWriteResultStart(writer, stackIndex1, writer->typeStack->valueTypes[stackIndex1]))
+        MUST (wasmCWriteStackValue(writer, stackIndex1))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, " << ("))
+        } else {
+            MUST (wasmCWrite(writer, "<<("))
+        }
+    }
+    MUST (wasmCWriteStackValue(writer, stackIndex0))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " & "))
+    } else {
+        MUST (wasmCWriteChar(writer, '&'))
     }
+    MUST (wasmCWrite(writer, shiftMaskStrings[resultType]))
+    MUST (wasmCWriteChar(writer, ')'))
+    MUST (wasmCWriteResultEnd(writer))
+
+    wasmTypeStackDrop(writer->typeStack, 1);
 
     return true;
 }
@@ -2698,169 +2975,169 @@ wasmCWriteMemoryAtomicWaitExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryAtomicWait32Expr(
-    const WasmCFunctionWriter* writer
+wasmCWriteLabel(
+    const WasmCFunctionWriter* writer,
+    const U32 labelIndex
 ) {
-    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicWait32;
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringLabelName(writer->builder, labelIndex))
+    MUST (wasmCWrite(writer, ":;\n"))
 
-    WasmMemoryArgumentInstruction instruction;
+    return true;
+}
 
-    if (!wasmMemoryArgument32InstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
+/*
+ * wasmCWriteLabelValueAssignments writes the assignments of the values passed
+ * to the given label, from the top of the stack to the label's stack entries,
+ * either as separate statements, or inline, preceding a goto
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLabelValueAssignments(
+    const WasmCFunctionWriter* writer,
+    const WasmLabel label,
+    const bool statements
+) {
+    U32 typeIndex = 0;
+    for (; typeIndex < label.typeCount; typeIndex++) {
+        const WasmValueType valueType = label.types[typeIndex];
+        const U32 sourceStackIndex = wasmTypeStackGetTopIndex(
+            writer->typeStack,
+            label.typeCount - typeIndex - 1
         );
-        return false;
-    }
+        const U32 destinationStackIndex = assertSizeU32(label.typeStackLength) + typeIndex;
 
-    MUST (wasmCWriteMemoryAtomicWaitExpr(writer, false))
+        /* Values are moved down the stack, so earlier assignments never overwrite later sources */
+        if (destinationStackIndex == sourceStackIndex) {
+            continue;
+        }
+
+        MUST (wasmTypeStackSet(writer->stackDeclarations, destinationStackIndex, valueType))
+
+        if (statements) {
+            MUST (wasmCWriteIndent(writer))
+        }
+        MUST (wasmCWriteStringStackName(writer->builder, destinationStackIndex, valueType))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            sourceStackIndex,
+            writer->typeStack->valueTypes[sourceStackIndex]
+        ))
+        if (statements) {
+            MUST (wasmCWrite(writer, ";\n"))
+        } else if (writer->pretty) {
+            MUST (wasmCWrite(writer, "; "))
+        } else {
+            MUST (wasmCWriteChar(writer, ';'))
+        }
+    }
 
     return true;
 }
 
+/*
+ * wasmCWriteLabelValues writes the assignments of the values passed to the given label
+ * when the end of the label's block is reached, if they are not already in place
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteMemoryAtomicWait64Expr(
-    const WasmCFunctionWriter* writer
+wasmCWriteLabelValues(
+    const WasmCFunctionWriter* writer,
+    const WasmLabel label
 ) {
-    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicWait64;
-
-    WasmMemoryArgumentInstruction instruction;
-
-    if (!wasmMemoryArgument64InstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
+    if (writer->typeStack->length - label.typeCount == label.typeStackLength) {
+        return true;
     }
 
-    MUST (wasmCWriteMemoryAtomicWaitExpr(writer, true))
-
-    return true;
+    return wasmCWriteLabelValueAssignments(writer, label, true);
 }
 
+/*
+ * wasmCWriteCopyParameters pushes copies of the parameters of a block
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteAtomicFenceExpr(
-    const WasmCFunctionWriter* writer
+wasmCWriteCopyParameters(
+    const WasmCFunctionWriter* writer,
+    const WasmFunctionType blockFunctionType
 ) {
-    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeAtomicFence;
+    const U32 parameterCount = blockFunctionType.parameterCount;
+    U32 parameterIndex = 0;
+    for (; parameterIndex < parameterCount; parameterIndex++) {
+        const WasmValueType parameterType = blockFunctionType.parameterTypes[parameterIndex];
+        const U32 sourceStackIndex = wasmTypeStackGetTopIndex(writer->typeStack, parameterCount - 1);
 
-    U8 immediate = 0;
-    MUST (bufferReadByte(writer->code, &immediate) > 0)
-    if (immediate != 0x0) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
-    }
+        MUST (wasmTypeStackAppend(writer->typeStack, parameterType))
+        {
+            const U32 destinationStackIndex = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-    if (!writer->ignore) {
-        MUST (wasmCWriteIndent(writer))
-        MUST (wasmCWrite(writer, "atomic_fence();\n"))
+            MUST (wasmTypeStackSet(writer->stackDeclarations, destinationStackIndex, parameterType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, destinationStackIndex, parameterType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, sourceStackIndex, parameterType))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
     }
 
     return true;
 }
 
+static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteAtomicLoadExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmThreadsOpcode opcode
+wasmCAppendTypes(
+    WasmTypeStack* typeStack,
+    const U32 count,
+    const WasmValueType* valueTypes
 ) {
-    WasmMemoryArgumentInstruction instruction;
-
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
+    U32 index = 0;
+    for (; index < count; index++) {
+        MUST (wasmTypeStackAppend(typeStack, valueTypes[index]))
     }
+    return true;
+}
 
-    if (!writer->ignore) {
-        U32 expectedAlign = 0;
-        WasmValueType resultType = 0;
-        char* functionName = NULL;
-        switch (opcode) {
-            case wasmThreadsOpcodeI32AtomicLoad: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_load";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicLoad: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_load";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicLoad8U: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_load8_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicLoad16U: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_load16_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicLoad8U: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_load8_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicLoad16U: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_load16_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicLoad32U: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_load32_u";
-                break;
-            }
-            default: {
+/*
+ * wasmCReadBlockType gets the block type of a block, loop, or if instruction,
+ * and resolves it to the parameter and result types of the block
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCReadBlockType(
+    const WasmCFunctionWriter* writer,
+    const WasmOpcode opcode,
+    WasmBlockType* blockType,
+    WasmFunctionType* result
+) {
+    *blockType = writer->instruction->immediates.blockType;
+    *result = wasmEmptyFunctionType;
+
+    switch (blockType->kind) {
+        case wasmBlockTypeKindEmpty:
+            break;
+        case wasmBlockTypeKindValueType:
+            result->resultCount = 1;
+            result->resultTypes = &blockType->valueType;
+            break;
+        case wasmBlockTypeKindFunctionType:
+            if (blockType->functionTypeIndex >= writer->module->functionTypes.count) {
                 fprintf(
                     stderr,
-                    "w2c2: unsupported atomic load instruction opcode: %s\n",
-                    wasmThreadsOpcodeDescription(opcode)
+                    "w2c2: invalid %s instruction: invalid function type index: %u\n",
+                    wasmOpcodeDescription(opcode),
+                    blockType->functionTypeIndex
                 );
                 return false;
             }
-        }
-
-        if (instruction.align != expectedAlign) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
-                wasmThreadsOpcodeDescription(opcode),
-                expectedAlign,
-                instruction.align
-            );
-            return false;
-        }
-
-        MUST (wasmCWriteLoad(
-            writer,
-            instruction,
-            functionName,
-            resultType
-        ))
+            *result = writer->module->functionTypes.functionTypes[blockType->functionTypeIndex];
+            break;
     }
 
     return true;
@@ -2869,81 +3146,122 @@ wasmCWriteAtomicLoadExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteAtomicStoreExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmThreadsOpcode opcode
+wasmCWriteIfExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
 ) {
-    WasmMemoryArgumentInstruction instruction;
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
+    const bool ignore = writer->ignore;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmBlockType blockType;
+    WasmFunctionType blockFunctionType = wasmEmptyFunctionType;
+    MUST (wasmCReadBlockType(writer, *opcode, &blockType, &blockFunctionType))
+
+    if (!ignore) {
+        MUST (wasmCWriteIndent(writer))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, "if ("))
+        } else {
+            MUST (wasmCWrite(writer, "if("))
+        }
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+        }
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, ") {\n"))
+        } else {
+            MUST (wasmCWrite(writer, "){\n"))
+        }
+
+        wasmTypeStackDrop(writer->typeStack, 1);
+
+        typeStackLengthBeforeBranches = writer->typeStack->length - blockFunctionType.parameterCount;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockFunctionType.resultCount,
+            blockFunctionType.resultTypes,
+            &label
+        ))
+
+        writer->indent++;
+
+        /*
+         * The then-branch operates on a copy of the parameters,
+         * as the else-branch needs the original values
+         */
+        MUST (wasmCWriteCopyParameters(writer, blockFunctionType))
     }
 
-    if (!writer->ignore) {
-        U32 expectedAlign = 0;
-        char* functionName = NULL;
-        switch (opcode) {
-            case wasmThreadsOpcodeI32AtomicStore: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                functionName = "i32_atomic_store";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicStore: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                functionName = "i64_atomic_store";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicStore8: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                functionName = "i32_atomic_store8";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicStore8: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                functionName = "i64_atomic_store8";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicStore16: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                functionName = "i32_atomic_store16";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicStore16: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                functionName = "i64_atomic_store16";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicStore32: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                functionName = "i64_atomic_store32";
-                break;
-            }
-            default: {
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported atomic store instruction opcode: %s\n",
-                    wasmThreadsOpcodeDescription(opcode)
-                );
-                return false;
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        if (!writer->ignore && blockFunctionType.parameterCount > 0) {
+            MUST (wasmCWriteLabelValues(writer, writer->labelStack->labels.labels[
+                wasmLabelStackGetTopIndex(writer->labelStack, 0)
+            ]))
+        }
+
+        writer->ignore = false;
+
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteChar(writer, '}'))
+    }
+
+    if (*opcode == wasmOpcodeElse) {
+        if (!ignore) {
+            writer->typeStack->length = typeStackLengthBeforeBranches;
+            MUST (wasmCAppendTypes(
+                writer->typeStack,
+                blockFunctionType.parameterCount,
+                blockFunctionType.parameterTypes
+            ))
+
+            if (writer->pretty) {
+                MUST (wasmCWrite(writer, " else {\n"))
+            } else {
+                MUST (wasmCWrite(writer, "else{\n"))
             }
+
+            writer->indent++;
         }
 
-        if (instruction.align != expectedAlign) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
-                wasmThreadsOpcodeDescription(opcode),
-                expectedAlign,
-                instruction.align
-            );
-            return false;
+        MUST (wasmCWriteFunctionCode(writer, opcode))
+
+        if (!ignore) {
+            writer->ignore = false;
+
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteChar(writer, '}'))
         }
+    }
+
+    if (!ignore) {
+        MUST (wasmCWrite(writer, "\n"))
+
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
 
-        MUST (wasmCWriteStore(writer, instruction, functionName))
+        MUST (wasmCAppendTypes(
+            writer->typeStack,
+            blockFunctionType.resultCount,
+            blockFunctionType.resultTypes
+        ))
     }
 
     return true;
@@ -2952,471 +3270,607 @@ wasmCWriteAtomicStoreExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteAtomicRMWExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmThreadsOpcode opcode
+wasmCWriteBlockExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
 ) {
-    WasmMemoryArgumentInstruction instruction;
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
-        );
-        return false;
+    const bool ignore = writer->ignore;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmBlockType blockType;
+    WasmFunctionType blockFunctionType = wasmEmptyFunctionType;
+    MUST (wasmCReadBlockType(writer, *opcode, &blockType, &blockFunctionType))
+
+    if (!ignore) {
+        typeStackLengthBeforeBranches = writer->typeStack->length - blockFunctionType.parameterCount;
+
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockFunctionType.resultCount,
+            blockFunctionType.resultTypes,
+            &label
+        ))
+
+        if (writer->pretty) {
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "{\n"))
+            writer->indent++;
+        }
     }
 
-    if (!writer->ignore) {
-        U32 expectedAlign = 0;
-        WasmValueType resultType = 0;
-        char *functionName = NULL;
-        switch (opcode) {
-            /* Add */
-            case wasmThreadsOpcodeI32AtomicRMWAdd: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_add";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWAdd: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_add";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8AddU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_add_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16AddU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_add_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8AddU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_add_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16AddU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_add_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32AddU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_add_u";
-                break;
-            }
-            /* Sub */
-            case wasmThreadsOpcodeI32AtomicRMWSub: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_sub";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWSub: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_sub";
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        writer->ignore = false;
+
+        if (writer->pretty) {
+            writer->indent--;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}\n"))
+        }
+
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        MUST (wasmCAppendTypes(
+            writer->typeStack,
+            blockFunctionType.resultCount,
+            blockFunctionType.resultTypes
+        ))
+    }
+
+    return true;
+}
+
+/*
+ * wasmCLoopEndsBlock returns true if the end of the loop whose body starts at the next instruction
+ * is immediately followed by the end of the enclosing block, i.e. by an end or else instruction
+ */
+static
+bool
+wasmCLoopEndsBlock(
+    const WasmCFunctionWriter* writer
+) {
+    const WasmInstructions* instructions = &writer->code->instructions;
+    size_t instructionIndex = writer->instructionIndex;
+    U32 depth = 1;
+
+    for (; instructionIndex < instructions->length; instructionIndex++) {
+        switch (instructions->instructions[instructionIndex].opcode) {
+            case wasmOpcodeBlock:
+            case wasmOpcodeLoop:
+            case wasmOpcodeIf: {
+                depth++;
                 break;
             }
-            case wasmThreadsOpcodeI32AtomicRMW8SubU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_sub_u";
+            case wasmOpcodeEnd: {
+                if (--depth == 0) {
+                    if (instructionIndex + 1 >= instructions->length) {
+                        return false;
+                    }
+                    switch (instructions->instructions[instructionIndex + 1].opcode) {
+                        case wasmOpcodeEnd:
+                        case wasmOpcodeElse:
+                            return true;
+                        default:
+                            return false;
+                    }
+                }
                 break;
             }
-            case wasmThreadsOpcodeI32AtomicRMW16SubU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_sub_u";
+            default:
                 break;
+        }
+    }
+
+    return false;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteLoopExpr(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    const bool ignore = writer->ignore;
+    const U32 enclosingLoopLabelStackIndex = writer->loopLabelStackIndex;
+    const bool enclosingLoopBreak = writer->loopBreak;
+
+    size_t typeStackLengthBeforeBranches = 0;
+    WasmLabel label = wasmEmptyLabel;
+
+    WasmBlockType blockType;
+    WasmFunctionType blockFunctionType = wasmEmptyFunctionType;
+    MUST (wasmCReadBlockType(writer, *opcode, &blockType, &blockFunctionType))
+
+    if (!ignore) {
+        const U32 enclosingLabelStackIndex = wasmLabelStackGetTopIndex(writer->labelStack, 0);
+        const WasmLabel enclosingLabel = writer->labelStack->labels.labels[enclosingLabelStackIndex];
+
+        typeStackLengthBeforeBranches = writer->typeStack->length - blockFunctionType.parameterCount;
+
+        /* Branches to a loop pass the loop's parameters */
+        MUST (wasmLabelStackPush(
+            writer->labelStack,
+            typeStackLengthBeforeBranches,
+            blockFunctionType.parameterCount,
+            blockFunctionType.parameterTypes,
+            &label
+        ))
+
+        /*
+         * Breaking out of the loop continues after its end, which is only the end of the enclosing
+         * block, if, or function if the loop is its last instruction and neither passes values.
+         * Branches to an enclosing loop continue at its start instead
+         */
+        writer->loopBreak =
+            (enclosingLoopLabelStackIndex == 0 || enclosingLoopLabelStackIndex != enclosingLabelStackIndex)
+            && enclosingLabel.typeCount == 0
+            && blockFunctionType.resultCount == 0
+            && wasmCLoopEndsBlock(writer);
+        writer->loopLabelStackIndex = wasmLabelStackGetTopIndex(writer->labelStack, 0);
+
+        /* Branches from nested loops cannot use continue, so they still jump to the label */
+        MUST (wasmCWriteLabel(writer, label.index))
+
+        MUST (wasmCWriteIndent(writer))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, "for (;;) {\n"))
+        } else {
+            MUST (wasmCWrite(writer, "for(;;){\n"))
+        }
+
+        writer->indent++;
+    }
+
+    MUST (wasmCWriteFunctionCode(writer, opcode))
+
+    if (!ignore) {
+        /* Falling through the end of the loop's body leaves the loop */
+        if (!writer->ignore) {
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "break;\n"))
+        }
+
+        writer->ignore = false;
+        writer->loopLabelStackIndex = enclosingLoopLabelStackIndex;
+        writer->loopBreak = enclosingLoopBreak;
+
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+
+        if (writer->loopParameters != NULL) {
+            U32 parameterIndex = 0;
+            for (; parameterIndex < blockFunctionType.parameterCount; parameterIndex++) {
+                WasmCLoopParameter parameter;
+                parameter.stackIndex = assertSizeU32(typeStackLengthBeforeBranches) + parameterIndex;
+                parameter.valueType = blockFunctionType.parameterTypes[parameterIndex];
+                parameter.loopEnd = writer->builder->length;
+                MUST (wasmCLoopParametersAppend(writer->loopParameters, parameter))
             }
-            case wasmThreadsOpcodeI64AtomicRMW8SubU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_sub_u";
-                break;
+        }
+
+        writer->typeStack->length = typeStackLengthBeforeBranches;
+
+        wasmLabelStackPop(writer->labelStack);
+
+        MUST (wasmCAppendTypes(
+            writer->typeStack,
+            blockFunctionType.resultCount,
+            blockFunctionType.resultTypes
+        ))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteGoto(
+    const WasmCFunctionWriter* writer,
+    const U32 labelStackIndex
+) {
+    const WasmLabel label = writer->labelStack->labels.labels[labelStackIndex];
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteLabelValueAssignments(writer, label, false))
+
+    MUST (wasmCWrite(writer, "goto "))
+    MUST (wasmCWriteStringLabelName(writer->builder, label.index))
+    MUST (wasmCWrite(writer, ";\n"))
+    return true;
+}
+
+/*
+ * wasmCWriteBranch writes a branch to the label with the given label stack index.
+ * Branches to the innermost loop continue it, and branches to the label enclosing it
+ * break out of it if possible. Break statements cannot be used inside of a switch statement
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranch(
+    const WasmCFunctionWriter* writer,
+    const U32 labelStackIndex,
+    const bool breakAllowed
+) {
+    const U32 loopLabelStackIndex = writer->loopLabelStackIndex;
+    const WasmLabel label = writer->labelStack->labels.labels[labelStackIndex];
+
+    if (loopLabelStackIndex == 0) {
+        return wasmCWriteGoto(writer, labelStackIndex);
+    }
+
+    if (labelStackIndex == loopLabelStackIndex) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteLabelValueAssignments(writer, label, false))
+        MUST (wasmCWrite(writer, "continue;\n"))
+        return true;
+    }
+
+    if (breakAllowed && writer->loopBreak && labelStackIndex == loopLabelStackIndex - 1) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "break;\n"))
+        return true;
+    }
+
+    return wasmCWriteGoto(writer, labelStackIndex);
+}
+
+static const char* const tailCallArgumentFieldNames[wasmValueType_count] = {
+    "i32", "i64", "f32", "f64", "v128"
+};
+
+/* Local which is true if the function was called by a trampoline */
+static const char* const tailCallModeName = "tail";
+
+/* Label at the start of functions which perform a tail call to themselves */
+static const char* const tailCallEntryLabelName = "Lentry";
+
+static
+W2C2_INLINE
+bool
+WARN_UNUSED_RESULT
+wasmCWriteStringTailCallThunkName(
+    StringBuilder* builder,
+    const char* moduleName,
+    const U32 functionTypeIndex
+) {
+    MUST (stringBuilderAppend(builder, moduleName))
+    MUST (stringBuilderAppend(builder, "TailCall"))
+    MUST (stringBuilderAppendU32(builder, functionTypeIndex))
+    return true;
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteFileTailCallThunkName(
+    FILE* file,
+    const char* moduleName,
+    const U32 functionTypeIndex
+) {
+    fprintf(file, "%sTailCall%u", moduleName, functionTypeIndex);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteZero(
+    const WasmCFunctionWriter* writer,
+    const WasmValueType valueType
+) {
+    if (valueType == wasmValueTypeV128) {
+        return wasmCWrite(writer, "v128_zero()");
+    }
+    return wasmCWriteChar(writer, '0');
+}
+
+/*
+ * wasmCWriteSelfTailCall writes a tail call of the function to itself,
+ * which assigns the arguments to the parameters, resets the locals,
+ * and jumps back to the start of the function
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSelfTailCall(
+    WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType
+) {
+    const U32 parameterCount = functionType.parameterCount;
+    const WasmLocalsDeclarations localsDeclarations = writer->function.localsDeclarations;
+
+    U32 localIndex = 0;
+    for (; localIndex < parameterCount; localIndex++) {
+        const WasmValueType parameterType = functionType.parameterTypes[localIndex];
+        const U32 stackIndex = wasmTypeStackGetTopIndex(
+            writer->typeStack,
+            parameterCount - localIndex - 1
+        );
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringLocalName(writer->builder, localIndex))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex, parameterType))
+        MUST (wasmCWrite(writer, ";\n"))
+    }
+
+    {
+        U32 localsDeclarationIndex = 0;
+        for (; localsDeclarationIndex < localsDeclarations.declarationCount; localsDeclarationIndex++) {
+            const WasmLocalsDeclaration localsDeclaration =
+                localsDeclarations.declarations[localsDeclarationIndex];
+
+            const U32 endIndex = localIndex + localsDeclaration.count;
+            for (; localIndex < endIndex; localIndex++) {
+                MUST (wasmCWriteIndent(writer))
+                MUST (wasmCWriteStringLocalName(writer->builder, localIndex))
+                MUST (wasmCWriteAssign(writer))
+                MUST (wasmCWriteZero(writer, localsDeclaration.type))
+                MUST (wasmCWrite(writer, ";\n"))
             }
-            case wasmThreadsOpcodeI64AtomicRMW16SubU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_sub_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32SubU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_sub_u";
-                break;
-            }
-            /* And */
-            case wasmThreadsOpcodeI32AtomicRMWAnd: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_and";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWAnd: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_and";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8AndU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_and_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16AndU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_and_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8AndU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_and_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16AndU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_and_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32AndU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_and_u";
-                break;
-            }
-            /* Or */
-            case wasmThreadsOpcodeI32AtomicRMWOr: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_or";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWOr: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_or";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8OrU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_or_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16OrU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_or_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8OrU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_or_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16OrU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_or_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32OrU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_or_u";
-                break;
-            }
-            /* Xor */
-            case wasmThreadsOpcodeI32AtomicRMWXor: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_xor";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWXor: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_xor";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8XorU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_xor_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16XorU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_xor_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8XorU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_xor_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16XorU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_xor_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32XorU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_xor_u";
-                break;
-            }
-            /* Xchg */
-            case wasmThreadsOpcodeI32AtomicRMWXchg: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_xchg";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWXchg: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_xchg";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8XchgU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_xchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16XchgU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_xchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8XchgU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_xchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16XchgU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_xchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32XchgU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_xchg_u";
-                break;
-            }
-            default: {
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported atomic RMW instruction opcode: %s\n",
-                    wasmThreadsOpcodeDescription(opcode)
-                );
-                return false;
-            }
-        }
-
-        if (instruction.align != expectedAlign) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
-                wasmThreadsOpcodeDescription(opcode),
-                expectedAlign,
-                instruction.align
-            );
-            return false;
         }
+    }
 
-        {
-            const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
-
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
-            MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWrite(writer, functionName))
-            MUST (wasmCWriteChar(writer, '('))
-            MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
-            MUST (wasmCWriteComma(writer))
-            MUST (wasmCWrite(writer, "(U64)"))
-            MUST (wasmCWriteStringStackName(
-                    writer->builder,
-                stackIndex1,
-                writer->typeStack->valueTypes[stackIndex1]
-            ))
-            if (instruction.offset != 0) {
-                MUST (wasmCWritePlus(writer))
-                MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
-                MUST (wasmCWriteChar(writer, 'U'))
-            }
-            MUST (wasmCWriteComma(writer))
-            MUST (wasmCWriteStringStackName(
-                writer->builder,
-                stackIndex0,
-                writer->typeStack->valueTypes[stackIndex0]
-            ))
-            MUST (wasmCWrite(writer, ");\n"))
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "goto "))
+    MUST (wasmCWrite(writer, tailCallEntryLabelName))
+    MUST (wasmCWrite(writer, ";\n"))
 
-            wasmTypeStackDrop(writer->typeStack, 2);
-            MUST (wasmTypeStackAppend(writer->typeStack, resultType))
-        }
-    }
+    *writer->selfTailCallUsed = true;
 
     return true;
 }
 
+/*
+ * wasmCWriteTailCallTrampoline writes a tail call through the trampoline.
+ * The target must already be stored in the instance.
+ *
+ * When the function was called by a trampoline, the arguments are stored,
+ * and the function returns to the trampoline, which then performs the call.
+ * Otherwise, the function runs the trampoline itself.
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteAtomicRMWCmpxchgExpr(
-    const WasmCFunctionWriter* writer,
-    const WasmThreadsOpcode opcode
+wasmCWriteTailCallTrampoline(
+    WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType,
+    const U32 functionTypeIndex,
+    const U32 stackOffset
 ) {
-    WasmMemoryArgumentInstruction instruction;
-    if (!wasmMemoryArgumentInstructionRead(writer->code, &instruction)) {
-        fprintf(
-            stderr,
-            "w2c2: invalid %s instruction encoding\n",
-            wasmThreadsOpcodeDescription(opcode)
+    const U32 parameterCount = functionType.parameterCount;
+    const WasmLabel returnLabel = writer->labelStack->labels.labels[0];
+
+    U32 parameterIndex = 0;
+    for (; parameterIndex < parameterCount; parameterIndex++) {
+        const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+        const U32 stackIndex = wasmTypeStackGetTopIndex(
+            writer->typeStack,
+            parameterCount - parameterIndex - 1 + stackOffset
         );
-        return false;
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "i->tailCallArguments["))
+        MUST (stringBuilderAppendU32(writer->builder, parameterIndex))
+        MUST (wasmCWrite(writer, "]."))
+        MUST (wasmCWrite(writer, tailCallArgumentFieldNames[parameterType]))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex, parameterType))
+        MUST (wasmCWrite(writer, ";\n"))
     }
 
-    if (!writer->ignore) {
-        U32 expectedAlign = 0;
-        WasmValueType resultType = 0;
-        char *functionName = NULL;
-        switch (opcode) {
-            case wasmThreadsOpcodeI32AtomicRMWCmpxchg: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw_cmpxchg";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMWCmpxchg: {
-                expectedAlign = WASM_MEMARG64_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw_cmpxchg";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW8CmpxchgU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw8_cmpxchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI32AtomicRMW16CmpxchgU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI32;
-                functionName = "i32_atomic_rmw16_cmpxchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW8CmpxchgU: {
-                expectedAlign = WASM_MEMARG8_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw8_cmpxchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW16CmpxchgU: {
-                expectedAlign = WASM_MEMARG16_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw16_cmpxchg_u";
-                break;
-            }
-            case wasmThreadsOpcodeI64AtomicRMW32CmpxchgU: {
-                expectedAlign = WASM_MEMARG32_ALIGN;
-                resultType = wasmValueTypeI64;
-                functionName = "i64_atomic_rmw32_cmpxchg_u";
-                break;
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "i->tailCallThunk"))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWrite(writer, "(wasmFunc)"))
+    MUST (wasmCWriteStringTailCallThunkName(writer->builder, writer->moduleName, functionTypeIndex))
+    MUST (wasmCWrite(writer, ";\n"))
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, writer->pretty ? "if (!" : "if(!"))
+    MUST (wasmCWrite(writer, tailCallModeName))
+    MUST (wasmCWrite(writer, writer->pretty ? ") {\n" : "){\n"))
+    writer->indent++;
+    {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, writer->pretty ? "do {\n" : "do{\n"))
+        writer->indent++;
+        {
+            MUST (wasmCWriteCallResultsStart(writer, functionType, 0))
+            MUST (wasmCWrite(writer, "(("))
+            MUST (wasmCWriteStringReturnType(writer->builder, functionType))
+            MUST (wasmCWrite(writer, " (*)("))
+            MUST (wasmCWrite(writer, writer->moduleName))
+            MUST (wasmCWrite(writer, "Instance*))wasmTailCallNext(&i->tailCallThunk))(i);\n"))
+            MUST (wasmCWriteCallResultsEnd(writer, functionType, 0))
+        }
+        writer->indent--;
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, writer->pretty ? "} while (i->tailCallThunk);\n" : "}while(i->tailCallThunk);\n"))
+    }
+    writer->indent--;
+    MUST (wasmCWriteIndent(writer))
+
+    if (functionType.resultCount > 0) {
+        /* The results are ignored by the trampoline */
+        U32 resultIndex = 0;
+
+        MUST (wasmCWrite(writer, writer->pretty ? "} else {\n" : "}else{\n"))
+        writer->indent++;
+        for (; resultIndex < functionType.resultCount; resultIndex++) {
+            const WasmValueType resultType = functionType.resultTypes[resultIndex];
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, resultIndex, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteZero(writer, resultType))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+        writer->indent--;
+        MUST (wasmCWriteIndent(writer))
+    }
+    MUST (wasmCWrite(writer, "}\n"))
+
+    MUST (wasmCWriteGlobalCacheLoad(writer))
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "goto "))
+    MUST (wasmCWriteStringLabelName(writer->builder, returnLabel.index))
+    MUST (wasmCWrite(writer, ";\n"))
+
+    *writer->tailCallTrampolineUsed = true;
+
+    return true;
+}
+
+/*
+ * wasmCWriteMustTailStart starts a tail call which uses musttail if available,
+ * and the trampoline otherwise
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMustTailStart(
+    const WasmCFunctionWriter* writer
+) {
+    MUST (wasmCWrite(writer, "#if WASM_TAIL_CALL_MUSTTAIL\n"))
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWrite(writer, "__attribute__((musttail)) return "))
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteReturnCallExpr(
+    WasmCFunctionWriter* writer
+) {
+    const WasmCallInstruction instruction = writer->instruction->immediates.call;
+
+    if (!writer->ignore) {
+        const WasmModule* module = writer->module;
+        const U32 functionImportCount = assertSizeU32(module->functionImports.length);
+        const WasmFunctionType callerType =
+            module->functionTypes.functionTypes[writer->function.functionTypeIndex];
+
+        WasmFunctionType functionType;
+        MUST (wasmModuleGetFunctionType(module, instruction.funcIndex, &functionType))
+
+        if (instruction.funcIndex < functionImportCount) {
+            /* Imported functions cannot perform tail calls back into the module */
+            MUST (wasmCWriteCall(writer, instruction.funcIndex))
+            MUST (wasmCWriteGoto(writer, 0))
+        } else if (instruction.funcIndex == writer->functionIndex) {
+            MUST (wasmCWriteSelfTailCall(writer, functionType))
+        } else {
+            const WasmFunction function = module->functions.functions[instruction.funcIndex - functionImportCount];
+            const bool mustTail = wasmFunctionTypesEqual(functionType, callerType);
+
+            MUST (wasmCWriteGlobalCacheStore(writer))
+
+            if (mustTail) {
+                MUST (wasmCWriteMustTailStart(writer))
+                MUST (wasmCWriteStringFunctionUse(
+                    writer->builder,
+                    module,
+                    writer->moduleName,
+                    instruction.funcIndex,
+                    false,
+                    writer->multipleModules
+                ))
+                MUST (wasmCWrite(writer, "(i"))
+                MUST (wasmCWriteArguments(writer, functionType, 0, true))
+                MUST (wasmCWrite(writer, ");\n#else\n"))
+            } else {
+                *writer->tailCallMustTailUnavailable = true;
             }
-            default: {
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported atomic RMW compare-exchange instruction opcode: %s\n",
-                    wasmThreadsOpcodeDescription(opcode)
-                );
-                return false;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "i->tailCallTarget"))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, "(wasmFunc)"))
+            MUST (wasmCWriteStringFunctionUse(
+                writer->builder,
+                module,
+                writer->moduleName,
+                instruction.funcIndex,
+                false,
+                writer->multipleModules
+            ))
+            MUST (wasmCWrite(writer, ";\n"))
+            MUST (wasmCWriteTailCallTrampoline(writer, functionType, function.functionTypeIndex, 0))
+
+            if (mustTail) {
+                MUST (wasmCWrite(writer, "#endif\n"))
             }
         }
 
-        if (instruction.align != expectedAlign) {
-            fprintf(
-                stderr,
-                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
-                wasmThreadsOpcodeDescription(opcode),
-                expectedAlign,
-                instruction.align
-            );
-            return false;
+        writer->ignore = true;
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteReturnCallIndirectExpr(
+    WasmCFunctionWriter* writer
+) {
+    const WasmCallIndirectInstruction instruction = writer->instruction->immediates.callIndirect;
+
+    if (!writer->ignore) {
+        const WasmModule* module = writer->module;
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[instruction.functionTypeIndex];
+        const WasmFunctionType callerType =
+            module->functionTypes.functionTypes[writer->function.functionTypeIndex];
+        const bool mustTail = wasmFunctionTypesEqual(functionType, callerType);
+
+        MUST (wasmCWriteGlobalCacheStore(writer))
+
+        if (mustTail) {
+            MUST (wasmCWriteMustTailStart(writer))
+            MUST (wasmCWriteTableFunction(writer, instruction.tableIndex, functionType))
+            MUST (wasmCWrite(writer, "(i"))
+            MUST (wasmCWriteArguments(writer, functionType, 1, true))
+            MUST (wasmCWrite(writer, ");\n#else\n"))
+        } else {
+            *writer->tailCallMustTailUnavailable = true;
         }
 
         {
-            const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
-            const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
             const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
-
             MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, resultType))
+            MUST (wasmCWrite(writer, "i->tailCallTarget"))
             MUST (wasmCWriteAssign(writer))
-            MUST (wasmCWrite(writer, functionName))
-            MUST (wasmCWriteChar(writer, '('))
-            MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
-            MUST (wasmCWriteComma(writer))
-            MUST (wasmCWrite(writer, "(U64)"))
-            MUST (wasmCWriteStringStackName(
-                    writer->builder,
-                    stackIndex2,
-                    writer->typeStack->valueTypes[stackIndex2]
-            ))
-            if (instruction.offset != 0) {
-                MUST (wasmCWritePlus(writer))
-                MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
-                MUST (wasmCWriteChar(writer, 'U'))
-            }
+            MUST (wasmCWrite(writer, "TF("))
+            MUST (wasmCWriteStringTableUse(writer->builder, module, instruction.tableIndex, false))
             MUST (wasmCWriteComma(writer))
             MUST (wasmCWriteStringStackName(
-                    writer->builder,
-                    stackIndex1,
-                    writer->typeStack->valueTypes[stackIndex1]
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
             ))
             MUST (wasmCWriteComma(writer))
-            MUST (wasmCWriteStringStackName(
-                    writer->builder,
-                    stackIndex0,
-                    writer->typeStack->valueTypes[stackIndex0]
-            ))
-            MUST (wasmCWrite(writer, ");\n"))
+            MUST (wasmCWrite(writer, "wasmFunc);\n"))
+        }
+        MUST (wasmCWriteTailCallTrampoline(writer, functionType, instruction.functionTypeIndex, 1))
 
-            wasmTypeStackDrop(writer->typeStack, 3);
-            MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        if (mustTail) {
+            MUST (wasmCWrite(writer, "#endif\n"))
         }
+
+        writer->ignore = true;
     }
 
     return true;
@@ -3425,519 +3879,2409 @@ wasmCWriteAtomicRMWCmpxchgExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteFunctionCode(
-    WasmCFunctionWriter* writer,
-    WasmOpcode* opcode
+wasmCWriteSelectExpr(
+    const WasmCFunctionWriter* writer
 ) {
-    while (true) {
-        if (writer->debug) {
-            const size_t relativeAddress = writer->function.code.length - writer->code->length;
-            const size_t absoluteAddress = writer->function.start + relativeAddress;
-            const WasmDebugLine* debugLine = wasmCGetDebugLine(
-                writer->debugLines,
-                absoluteAddress
-            );
-            if (debugLine != NULL) {
-                MUST (wasmCWriteDebugLine(writer->builder, debugLine))
-            }
-        }
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
 
-        if (!wasmOpcodeRead(writer->code, opcode)) {
-            break;
-        }
+    /* same as 2 */
+    const WasmValueType resultType = writer->typeStack->valueTypes[stackIndex1];
 
-        switch (*opcode) {
-            case wasmOpcodeNop:
-                break;
-            case wasmOpcodeElse:
-            case wasmOpcodeEnd:
-                return true;
-            case wasmOpcodeIf: {
-                MUST (wasmCWriteIfExpr(writer, opcode))
-                if (*opcode == wasmOpcodeElse) {
-                    return true;
-                }
-                break;
-            }
-            case wasmOpcodeBlock: {
-                MUST (wasmCWriteBlockExpr(writer, opcode))
-                if (*opcode == wasmOpcodeElse) {
-                    return true;
-                }
-                break;
-            }
-            case wasmOpcodeLoop: {
-                MUST (wasmCWriteLoopExpr(writer, opcode))
-                if (*opcode == wasmOpcodeElse) {
-                    return true;
-                }
-                break;
-            }
-            case wasmOpcodeCall: {
-                MUST (wasmCWriteCallExpr(writer))
-                break;
-            }
-            case wasmOpcodeCallIndirect: {
-                MUST (wasmCWriteCallIndirectExpr(writer))
-                break;
-            }
-            case wasmOpcodeBr: {
-                MUST (wasmCWriteBranchExpr(writer))
-                writer->ignore = true;
-                break;
-            }
-            case wasmOpcodeBrIf: {
-                MUST (wasmCWriteBranchIfExpr(writer))
-                break;
-            }
-            case wasmOpcodeBrTable: {
-                MUST (wasmCWriteBranchTableExpr(writer))
-                writer->ignore = true;
-                break;
-            }
-            case wasmOpcodeLocalGet: {
-                MUST (wasmCWriteLocalGetExpr(writer))
-                break;
-            }
-            case wasmOpcodeLocalSet:
-            case wasmOpcodeLocalTee: {
-                MUST (wasmCWriteLocalAssignmentExpr(writer, *opcode))
-                break;
-            }
-            case wasmOpcodeGlobalGet: {
-                MUST (wasmCWriteGlobalGetExpr(writer))
-                break;
-            }
-            case wasmOpcodeGlobalSet: {
-                MUST (wasmCWriteGlobalSetExpr(writer))
-                break;
-            }
-            case wasmOpcodeI32Const:
-            case wasmOpcodeI64Const:
-            case wasmOpcodeF32Const:
-            case wasmOpcodeF64Const: {
-                MUST (wasmCWriteConstExpr(writer, *opcode))
-                break;
-            }
-            case wasmOpcodeI32Load:
-            case wasmOpcodeI64Load:
-            case wasmOpcodeF32Load:
-            case wasmOpcodeF64Load:
-            case wasmOpcodeI32Load8S:
-            case wasmOpcodeI32Load8U:
-            case wasmOpcodeI32Load16S:
-            case wasmOpcodeI32Load16U:
-            case wasmOpcodeI64Load8S:
-            case wasmOpcodeI64Load8U:
-            case wasmOpcodeI64Load16S:
-            case wasmOpcodeI64Load16U:
-            case wasmOpcodeI64Load32S:
-            case wasmOpcodeI64Load32U: {
-                MUST (wasmCWriteLoadExpr(writer, *opcode))
-                break;
-            }
-            case wasmOpcodeI32Store:
-            case wasmOpcodeI64Store:
-            case wasmOpcodeF32Store:
-            case wasmOpcodeF64Store:
-            case wasmOpcodeI32Store8:
-            case wasmOpcodeI32Store16:
-            case wasmOpcodeI64Store8:
-            case wasmOpcodeI64Store16:
-            case wasmOpcodeI64Store32: {
-                MUST (wasmCWriteStoreExpr(writer, *opcode))
-                break;
-            }
-            case wasmOpcodeMemorySize: {
-                MUST (wasmCWriteMemorySizeExpr(writer))
-                break;
-            }
-            case wasmOpcodeMemoryGrow: {
-                MUST (wasmCWriteMemoryGrowExpr(writer))
-                break;
-            }
-            case wasmOpcodeThreadsPrefix: {
-                WasmThreadsOpcode threadsOpcode = 0;
-                MUST (leb128ReadU32(writer->code, (U32*)&threadsOpcode) > 0)
-
-                switch (threadsOpcode) {
-                    case wasmThreadsOpcodeMemoryAtomicNotify: {
-                        MUST (wasmCWriteMemoryAtomicNotifyExpr(writer))
-                        break;
-                    }
-                    case wasmThreadsOpcodeMemoryAtomicWait32: {
-                        MUST (wasmCWriteMemoryAtomicWait32Expr(writer))
-                        break;
-                    }
-                    case wasmThreadsOpcodeMemoryAtomicWait64: {
-                        MUST (wasmCWriteMemoryAtomicWait64Expr(writer))
-                        break;
-                    }
-                    case wasmThreadsOpcodeAtomicFence: {
-                        MUST (wasmCWriteAtomicFenceExpr(writer))
-                        break;
-                    }
-                    case wasmThreadsOpcodeI32AtomicLoad:
-                    case wasmThreadsOpcodeI64AtomicLoad:
-                    case wasmThreadsOpcodeI32AtomicLoad8U:
-                    case wasmThreadsOpcodeI32AtomicLoad16U:
-                    case wasmThreadsOpcodeI64AtomicLoad8U:
-                    case wasmThreadsOpcodeI64AtomicLoad16U:
-                    case wasmThreadsOpcodeI64AtomicLoad32U: {
-                        MUST (wasmCWriteAtomicLoadExpr(writer, threadsOpcode))
-                        break;
-                    }
-                    case wasmThreadsOpcodeI32AtomicStore:
-                    case wasmThreadsOpcodeI64AtomicStore:
-                    case wasmThreadsOpcodeI32AtomicStore8:
-                    case wasmThreadsOpcodeI32AtomicStore16:
-                    case wasmThreadsOpcodeI64AtomicStore8:
-                    case wasmThreadsOpcodeI64AtomicStore16:
-                    case wasmThreadsOpcodeI64AtomicStore32: {
-                        MUST (wasmCWriteAtomicStoreExpr(writer, threadsOpcode))
-                        break;
-                    }
-                    case wasmThreadsOpcodeI32AtomicRMWAdd:
-                    case wasmThreadsOpcodeI64AtomicRMWAdd:
-                    case wasmThreadsOpcodeI32AtomicRMW8AddU:
-                    case wasmThreadsOpcodeI32AtomicRMW16AddU:
-                    case wasmThreadsOpcodeI64AtomicRMW8AddU:
-                    case wasmThreadsOpcodeI64AtomicRMW16AddU:
-                    case wasmThreadsOpcodeI64AtomicRMW32AddU:
-                    case wasmThreadsOpcodeI32AtomicRMWSub:
-                    case wasmThreadsOpcodeI64AtomicRMWSub:
-                    case wasmThreadsOpcodeI32AtomicRMW8SubU:
-                    case wasmThreadsOpcodeI32AtomicRMW16SubU:
-                    case wasmThreadsOpcodeI64AtomicRMW8SubU:
-                    case wasmThreadsOpcodeI64AtomicRMW16SubU:
-                    case wasmThreadsOpcodeI64AtomicRMW32SubU:
-                    case wasmThreadsOpcodeI32AtomicRMWAnd:
-                    case wasmThreadsOpcodeI64AtomicRMWAnd:
-                    case wasmThreadsOpcodeI32AtomicRMW8AndU:
-                    case wasmThreadsOpcodeI32AtomicRMW16AndU:
-                    case wasmThreadsOpcodeI64AtomicRMW8AndU:
-                    case wasmThreadsOpcodeI64AtomicRMW16AndU:
-                    case wasmThreadsOpcodeI64AtomicRMW32AndU:
-                    case wasmThreadsOpcodeI32AtomicRMWOr:
-                    case wasmThreadsOpcodeI64AtomicRMWOr:
-                    case wasmThreadsOpcodeI32AtomicRMW8OrU:
-                    case wasmThreadsOpcodeI32AtomicRMW16OrU:
-                    case wasmThreadsOpcodeI64AtomicRMW8OrU:
-                    case wasmThreadsOpcodeI64AtomicRMW16OrU:
-                    case wasmThreadsOpcodeI64AtomicRMW32OrU:
-                    case wasmThreadsOpcodeI32AtomicRMWXor:
-                    case wasmThreadsOpcodeI64AtomicRMWXor:
-                    case wasmThreadsOpcodeI32AtomicRMW8XorU:
-                    case wasmThreadsOpcodeI32AtomicRMW16XorU:
-                    case wasmThreadsOpcodeI64AtomicRMW8XorU:
-                    case wasmThreadsOpcodeI64AtomicRMW16XorU:
-                    case wasmThreadsOpcodeI64AtomicRMW32XorU:
-                    case wasmThreadsOpcodeI32AtomicRMWXchg:
-                    case wasmThreadsOpcodeI64AtomicRMWXchg:
-                    case wasmThreadsOpcodeI32AtomicRMW8XchgU:
-                    case wasmThreadsOpcodeI32AtomicRMW16XchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW8XchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW16XchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW32XchgU: {
-                        MUST (wasmCWriteAtomicRMWExpr(writer, threadsOpcode))
-                        break;
-                    }
-                    case wasmThreadsOpcodeI32AtomicRMWCmpxchg:
-                    case wasmThreadsOpcodeI64AtomicRMWCmpxchg:
-                    case wasmThreadsOpcodeI32AtomicRMW8CmpxchgU:
-                    case wasmThreadsOpcodeI32AtomicRMW16CmpxchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW8CmpxchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW16CmpxchgU:
-                    case wasmThreadsOpcodeI64AtomicRMW32CmpxchgU: {
-                        MUST (wasmCWriteAtomicRMWCmpxchgExpr(writer, threadsOpcode))
-                        break;
-                    }
-                }
+    MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
 
-                break;
-            }
-            case wasmOpcodeMiscPrefix: {
-                WasmMiscOpcode miscOpcode = 0;
-                MUST (leb128ReadU32(writer->code, (U32*)&miscOpcode) > 0)
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex2,
+        resultType
+    ))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex0,
+        writer->typeStack->valueTypes[stackIndex0]
+    ))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " ? "))
+    } else {
+        MUST (wasmCWriteChar(writer, '?'))
+    }
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex2,
+        writer->typeStack->valueTypes[stackIndex2]
+    ))
+    if (writer->pretty) {
+        MUST (wasmCWrite(writer, " : "))
+    } else {
+        MUST (wasmCWriteChar(writer, ':'))
+    }
+    MUST (wasmCWriteStringStackName(
+        writer->builder,
+        stackIndex1,
+        writer->typeStack->valueTypes[stackIndex1]
+    ))
+    MUST (wasmCWrite(writer, ";\n"))
 
-                switch (miscOpcode) {
-                    case wasmMiscOpcodeMemoryInit: {
-                        MUST (wasmCWriteMemoryInitExpr(writer))
-                        break;
-                    }
-                    case wasmMiscOpcodeDataDrop: {
-                        /* TODO: refactor into instruction read function */
-                        U32 dataIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &dataIndex) > 0)
+    wasmTypeStackDrop(writer->typeStack, 3);
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+    MUST (wasmTypeStackAppend(writer->typeStack, resultType))
 
-                        break;
-                    }
-                    case wasmMiscOpcodeMemoryCopy: {
-                        MUST (wasmCWriteMemoryCopyExpr(writer))
-                        continue;
-                    }
-                    case wasmMiscOpcodeMemoryFill: {
-                        MUST (wasmCWriteMemoryFillExpr(writer, miscOpcode))
-                        continue;
-                    }
-                    case wasmMiscOpcodeTableInit: {
-                        /* TODO: refactor into instruction read function */
-                        U32 elemIndex = 0;
-                        U32 tableIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &elemIndex) > 0)
-                        MUST (leb128ReadU32(writer->code, &tableIndex) > 0)
+    return true;
+}
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchExpr(
+    const WasmCFunctionWriter* writer
+) {
+    const WasmBranchInstruction instruction = writer->instruction->immediates.branch;
 
-                        break;
-                    }
-                    case wasmMiscOpcodeElemDrop: {
-                        /* TODO: refactor into instruction read function */
-                        U32 elemIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &elemIndex) > 0)
+    if (!writer->ignore) {
+        const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
+        MUST (wasmCWriteBranch(writer, labelIndex, true))
+    }
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+    return true;
+}
 
-                        break;
-                    }
-                    case wasmMiscOpcodeTableCopy: {
-                        /* TODO: refactor into instruction read function */
-                        U32 tableIndex1 = 0;
-                        U32 tableIndex2 = 0;
-                        MUST (leb128ReadU32(writer->code, &tableIndex1) > 0)
-                        MUST (leb128ReadU32(writer->code, &tableIndex2) > 0)
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchIfExpr(
+    WasmCFunctionWriter* writer
+) {
+    const WasmBranchInstruction instruction = writer->instruction->immediates.branch;
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+    if (!writer->ignore) {
 
-                        break;
-                    }
-                    case wasmMiscOpcodeTableGrow: {
-                        /* TODO: refactor into instruction read function */
-                        U32 tableIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &tableIndex) > 0)
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        MUST (wasmCWriteIndent(writer))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, "if ("))
+        } else {
+            MUST (wasmCWrite(writer, "if("))
+        }
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, ") {\n"))
+        } else {
+            MUST (wasmCWrite(writer, "){\n"))
+        }
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+        writer->indent++;
 
-                        break;
-                    }
-                    case wasmMiscOpcodeTableSize: {
-                        /* TODO: refactor into instruction read function */
-                        U32 tableIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &tableIndex) > 0)
+        wasmTypeStackDrop(writer->typeStack, 1);
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+        {
+            const U32 labelIndex = wasmLabelStackGetTopIndex(writer->labelStack, instruction.labelIndex);
+            MUST (wasmCWriteBranch(writer, labelIndex, true))
+        }
 
-                        break;
-                    }
-                    case wasmMiscOpcodeTableFill: {
-                        /* TODO: refactor into instruction read function */
-                        U32 tableIndex = 0;
-                        MUST (leb128ReadU32(writer->code, &tableIndex) > 0)
+        writer->indent--;
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+    }
 
-                        /* TODO */
-                        fprintf(
-                            stderr,
-                            "w2c2: unimplemented opcode: %s\n",
-                            wasmMiscOpcodeDescription(miscOpcode)
-                        );
+    return true;
+}
 
-                        break;
-                    }
-                    default:
-                        if (writer->ignore) {
-                            break;
-                        }
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteBranchTableExpr(
+    WasmCFunctionWriter* writer
+) {
+    const WasmBranchTableImmediates instruction = writer->instruction->immediates.branchTable;
+    const U32* labelIndices = writer->code->labelIndices.labelIndices + instruction.labelIndicesStart;
 
-                        switch (miscOpcode) {
-                            case wasmMiscOpcodeI32TruncSatF32S: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_S_F32"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI64TruncSatF32S: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_S_F32"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI32TruncSatF64S: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_S_F64"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI64TruncSatF64S: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_S_F64"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI32TruncSatF32U: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_U_F32"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI64TruncSatF32U: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_U_F32"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI32TruncSatF64U: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_U_F64"))
-                                break;
-                            }
-                            case wasmMiscOpcodeI64TruncSatF64U: {
-                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_U_F64"))
-                                break;
-                            }
-                            default: {
-                                fprintf(
-                                    stderr,
-                                    "w2c2: unsupported misc opcode: %s\n",
-                                    wasmMiscOpcodeDescription(miscOpcode)
-                                );
-                                return false;
-                            }
-                        }
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
 
-                        break;
-                }
+        MUST (wasmCWriteIndent(writer))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, "switch ("))
+        } else {
+            MUST (wasmCWrite(writer, "switch("))
+        }
+        MUST (wasmCWriteStringStackName(
+            writer->builder,
+            stackIndex0,
+            writer->typeStack->valueTypes[stackIndex0]
+        ))
+        if (writer->pretty) {
+            MUST (wasmCWrite(writer, ") {\n"))
+        } else {
+            MUST (wasmCWrite(writer, "){\n"))
+        }
 
-                break;
-            }
-            default: {
-                if (writer->ignore) {
-                    break;
+        wasmTypeStackDrop(writer->typeStack, 1);
+
+        {
+            U32 index = 0;
+            for (; index < instruction.labelIndexCount; index++) {
+                MUST (wasmCWriteIndent(writer))
+                MUST (wasmCWrite(writer, "case "))
+                MUST (stringBuilderAppendU32(writer->builder, index))
+                MUST (wasmCWrite(writer, ":\n"))
+                writer->indent++;
+                {
+                    const U32 labelIndex = wasmLabelStackGetTopIndex(
+                        writer->labelStack,
+                        labelIndices[index]
+                    );
+                    MUST (wasmCWriteBranch(writer, labelIndex, false))
                 }
+                writer->indent--;
+            }
+        }
 
-                switch (*opcode) {
-                    case wasmOpcodeDrop: {
-                        wasmTypeStackDrop(writer->typeStack, 1);
-                        break;
-                    }
-                    case wasmOpcodeUnreachable: {
-                        MUST (wasmCWriteIndent(writer))
-                        MUST (wasmCWrite(writer, "UNREACHABLE;\n"))
-                        writer->ignore = true;
-                        break;
-                    }
-                    case wasmOpcodeSelect: {
-                        MUST (wasmCWriteSelectExpr(writer))
-                        break;
-                    }
-                    case wasmOpcodeReturn: {
-                        MUST (wasmCWriteGoto(writer, 0))
-                        writer->ignore = true;
-                        break;
-                    }
-                    case wasmOpcodeI32Eq:
-                    case wasmOpcodeI64Eq:
-                    case wasmOpcodeF32Eq:
-                    case wasmOpcodeF64Eq: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "==", false))
-                        break;
-                    }
-                    case wasmOpcodeI32Ne:
-                    case wasmOpcodeI64Ne:
-                    case wasmOpcodeF32Ne:
-                    case wasmOpcodeF64Ne: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "!=", false))
-                        break;
-                    }
-                    case wasmOpcodeI32LtS:
-                    case wasmOpcodeI64LtS: {
-                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<"))
-                        break;
-                    }
-                    case wasmOpcodeI32LtU:
-                    case wasmOpcodeI64LtU:
-                    case wasmOpcodeF32Lt:
-                    case wasmOpcodeF64Lt: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "<", false))
-                        break;
-                    }
-                    case wasmOpcodeI32LeS:
-                    case wasmOpcodeI64LeS: {
-                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<="))
-                        break;
-                    }
-                    case wasmOpcodeI32LeU:
-                    case wasmOpcodeI64LeU:
-                    case wasmOpcodeF32Le:
-                    case wasmOpcodeF64Le: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "<=", false))
-                        break;
-                    }
-                    case wasmOpcodeI32GtS:
-                    case wasmOpcodeI64GtS: {
-                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">"))
-                        break;
-                    }
-                    case wasmOpcodeI32GtU:
-                    case wasmOpcodeI64GtU:
-                    case wasmOpcodeF32Gt:
-                    case wasmOpcodeF64Gt: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, ">", false))
-                        break;
-                    }
-                    case wasmOpcodeI32GeS:
-                    case wasmOpcodeI64GeS: {
-                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">="))
-                        break;
-                    }
-                    case wasmOpcodeI32GeU:
-                    case wasmOpcodeI64GeU:
-                    case wasmOpcodeF32Ge:
-                    case wasmOpcodeF64Ge: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, ">=", false))
-                        break;
-                    }
-                    case wasmOpcodeI32Add: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "+", true))
-                        break;
-                    }
-                    case wasmOpcodeI64Add: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI64, "+", true))
-                        break;
-                    }
-                    case wasmOpcodeF32Add: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeF32, "+", true))
-                        break;
-                    }
-                    case wasmOpcodeF64Add: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeF64, "+", true))
-                        break;
-                    }
-                    case wasmOpcodeI32Sub: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "-", true))
-                        break;
-                    }
-                    case wasmOpcodeI64Sub: {
-                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI64, "-", true))
-                        break;
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "default:\n"))
+        writer->indent++;
+        {
+            const U32 labelIndex = wasmLabelStackGetTopIndex(
+                writer->labelStack,
+                instruction.defaultLabelIndex
+            );
+            MUST (wasmCWriteBranch(writer, labelIndex, false))
+        }
+        writer->indent--;
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "}\n"))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteDebugLine(
+    StringBuilder* builder,
+    const WasmDebugLine* debugLine
+
+) {
+    MUST (stringBuilderAppend(builder, "#line "))
+    MUST (stringBuilderAppendU64(builder, debugLine->number))
+    MUST (stringBuilderAppend(builder, " \""))
+    MUST (stringBuilderAppend(builder, debugLine->path))
+    MUST (stringBuilderAppend(builder, "\"\n"))
+    return true;
+}
+
+
+static
+WasmDebugLine*
+wasmCGetDebugLine(
+    WasmDebugLines* debugLines,
+    const size_t absoluteAddress
+) {
+    WasmDebugLine* debugLine = NULL;
+    if (debugLines->length == 0) {
+        return NULL;
+    }
+
+    debugLine = debugLines->debugLines;
+
+    if (debugLines->length > 1) {
+        const WasmDebugLine* nextDebugLine = debugLine + 1;
+        if (absoluteAddress >= nextDebugLine->address) {
+            debugLines->length--;
+            debugLines->debugLines++;
+            debugLine = debugLines->debugLines;
+        }
+    }
+
+    if (absoluteAddress < debugLine->address) {
+       return NULL;
+    }
+
+    return debugLine;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryAtomicNotifyExpr(
+    const WasmCFunctionWriter* writer
+) {
+    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicNotify;
+
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (instruction.align != WASM_MEMARG32_ALIGN) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmThreadsOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+
+        static const WasmValueType resultType = wasmValueTypeI32;
+
+        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWrite(writer, "wasmMemoryAtomicNotify("))
+        MUST (wasmCWriteStringMemoryUse(
+                writer->builder,
+                writer->module,
+                0,
+                true
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex1,
+                writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWrite(writer, ");\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 2);
+
+        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryAtomicWaitExpr(
+    const WasmCFunctionWriter* writer,
+    const bool isWait64
+) {
+    if (!writer->ignore) {
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+
+        static const WasmValueType resultType = wasmValueTypeI32;
+
+        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, resultType))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWrite(writer, "wasmMemoryAtomicWait("))
+        MUST (wasmCWriteStringMemoryUse(
+                writer->builder,
+                writer->module,
+                0,
+                true
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex2,
+                writer->typeStack->valueTypes[stackIndex2]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex1,
+                writer->typeStack->valueTypes[stackIndex1]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+        ))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWrite(writer, isWait64 ? "true" : "false"))
+        MUST (wasmCWrite(writer, ");\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 3);
+
+        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryAtomicWait32Expr(
+    const WasmCFunctionWriter* writer
+) {
+    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicWait32;
+
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (instruction.align != WASM_MEMARG32_ALIGN) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmThreadsOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    MUST (wasmCWriteMemoryAtomicWaitExpr(writer, false))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteMemoryAtomicWait64Expr(
+    const WasmCFunctionWriter* writer
+) {
+    static const WasmThreadsOpcode opcode = wasmThreadsOpcodeMemoryAtomicWait64;
+
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (instruction.align != WASM_MEMARG64_ALIGN) {
+        fprintf(
+            stderr,
+            "w2c2: invalid %s instruction encoding\n",
+            wasmThreadsOpcodeDescription(opcode)
+        );
+        return false;
+    }
+
+    MUST (wasmCWriteMemoryAtomicWaitExpr(writer, true))
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAtomicFenceExpr(
+    const WasmCFunctionWriter* writer
+) {
+    if (!writer->ignore) {
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWrite(writer, "atomic_fence();\n"))
+    }
+
+    return true;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAtomicLoadExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmThreadsOpcode opcode
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (!writer->ignore) {
+        U32 expectedAlign = 0;
+        WasmValueType resultType = 0;
+        char* functionName = NULL;
+        switch (opcode) {
+            case wasmThreadsOpcodeI32AtomicLoad: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_load";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicLoad: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_load";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicLoad8U: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_load8_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicLoad16U: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_load16_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicLoad8U: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_load8_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicLoad16U: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_load16_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicLoad32U: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_load32_u";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported atomic load instruction opcode: %s\n",
+                    wasmThreadsOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        if (instruction.align != expectedAlign) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
+                wasmThreadsOpcodeDescription(opcode),
+                expectedAlign,
+                instruction.align
+            );
+            return false;
+        }
+
+        MUST (wasmCWriteLoad(
+            writer,
+            instruction,
+            functionName,
+            resultType,
+            NULL,
+            1U << expectedAlign
+        ))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAtomicStoreExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmThreadsOpcode opcode
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (!writer->ignore) {
+        U32 expectedAlign = 0;
+        char* functionName = NULL;
+        switch (opcode) {
+            case wasmThreadsOpcodeI32AtomicStore: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                functionName = "i32_atomic_store";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicStore: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                functionName = "i64_atomic_store";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicStore8: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                functionName = "i32_atomic_store8";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicStore8: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                functionName = "i64_atomic_store8";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicStore16: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                functionName = "i32_atomic_store16";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicStore16: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                functionName = "i64_atomic_store16";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicStore32: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                functionName = "i64_atomic_store32";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported atomic store instruction opcode: %s\n",
+                    wasmThreadsOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        if (instruction.align != expectedAlign) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
+                wasmThreadsOpcodeDescription(opcode),
+                expectedAlign,
+                instruction.align
+            );
+            return false;
+        }
+
+        MUST (wasmCWriteStore(
+            writer,
+            instruction,
+            functionName,
+            NULL,
+            1U << expectedAlign
+        ))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAtomicRMWExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmThreadsOpcode opcode
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (!writer->ignore) {
+        U32 expectedAlign = 0;
+        WasmValueType resultType = 0;
+        char *functionName = NULL;
+        switch (opcode) {
+            /* Add */
+            case wasmThreadsOpcodeI32AtomicRMWAdd: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_add";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWAdd: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_add";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8AddU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_add_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16AddU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_add_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8AddU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_add_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16AddU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_add_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32AddU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_add_u";
+                break;
+            }
+            /* Sub */
+            case wasmThreadsOpcodeI32AtomicRMWSub: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_sub";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWSub: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_sub";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8SubU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_sub_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16SubU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_sub_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8SubU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_sub_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16SubU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_sub_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32SubU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_sub_u";
+                break;
+            }
+            /* And */
+            case wasmThreadsOpcodeI32AtomicRMWAnd: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_and";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWAnd: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_and";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8AndU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_and_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16AndU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_and_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8AndU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_and_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16AndU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_and_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32AndU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_and_u";
+                break;
+            }
+            /* Or */
+            case wasmThreadsOpcodeI32AtomicRMWOr: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_or";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWOr: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_or";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8OrU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_or_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16OrU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_or_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8OrU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_or_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16OrU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_or_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32OrU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_or_u";
+                break;
+            }
+            /* Xor */
+            case wasmThreadsOpcodeI32AtomicRMWXor: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_xor";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWXor: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_xor";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8XorU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_xor_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16XorU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_xor_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8XorU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_xor_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16XorU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_xor_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32XorU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_xor_u";
+                break;
+            }
+            /* Xchg */
+            case wasmThreadsOpcodeI32AtomicRMWXchg: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_xchg";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWXchg: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_xchg";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8XchgU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_xchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16XchgU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_xchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8XchgU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_xchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16XchgU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_xchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32XchgU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_xchg_u";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported atomic RMW instruction opcode: %s\n",
+                    wasmThreadsOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        if (instruction.align != expectedAlign) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
+                wasmThreadsOpcodeDescription(opcode),
+                expectedAlign,
+                instruction.align
+            );
+            return false;
+        }
+
+        {
+            const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+            MUST (wasmCWriteBoundsCheck(writer, NULL, stackIndex1, instruction.offset, 1U << expectedAlign))
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, resultType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, functionName))
+            MUST (wasmCWriteChar(writer, '('))
+            MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWrite(writer, "(U64)"))
+            MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                stackIndex1,
+                writer->typeStack->valueTypes[stackIndex1]
+            ))
+            if (instruction.offset != 0) {
+                MUST (wasmCWritePlus(writer))
+                MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
+                MUST (wasmCWriteChar(writer, 'U'))
+            }
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+            MUST (wasmCWrite(writer, ");\n"))
+
+            wasmTypeStackDrop(writer->typeStack, 2);
+            MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteAtomicRMWCmpxchgExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmThreadsOpcode opcode
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+
+    if (!writer->ignore) {
+        U32 expectedAlign = 0;
+        WasmValueType resultType = 0;
+        char *functionName = NULL;
+        switch (opcode) {
+            case wasmThreadsOpcodeI32AtomicRMWCmpxchg: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw_cmpxchg";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMWCmpxchg: {
+                expectedAlign = WASM_MEMARG64_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw_cmpxchg";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW8CmpxchgU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw8_cmpxchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI32AtomicRMW16CmpxchgU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI32;
+                functionName = "i32_atomic_rmw16_cmpxchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW8CmpxchgU: {
+                expectedAlign = WASM_MEMARG8_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw8_cmpxchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW16CmpxchgU: {
+                expectedAlign = WASM_MEMARG16_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw16_cmpxchg_u";
+                break;
+            }
+            case wasmThreadsOpcodeI64AtomicRMW32CmpxchgU: {
+                expectedAlign = WASM_MEMARG32_ALIGN;
+                resultType = wasmValueTypeI64;
+                functionName = "i64_atomic_rmw32_cmpxchg_u";
+                break;
+            }
+            default: {
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported atomic RMW compare-exchange instruction opcode: %s\n",
+                    wasmThreadsOpcodeDescription(opcode)
+                );
+                return false;
+            }
+        }
+
+        if (instruction.align != expectedAlign) {
+            fprintf(
+                stderr,
+                "w2c2: invalid %s instruction encoding: expected align %d, got %d\n",
+                wasmThreadsOpcodeDescription(opcode),
+                expectedAlign,
+                instruction.align
+            );
+            return false;
+        }
+
+        {
+            const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+            const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+            MUST (wasmCWriteBoundsCheck(writer, NULL, stackIndex2, instruction.offset, 1U << expectedAlign))
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex2, resultType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, resultType))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWrite(writer, functionName))
+            MUST (wasmCWriteChar(writer, '('))
+            MUST (wasmCWriteStringMemoryUse(writer->builder, writer->module, 0, true))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWrite(writer, "(U64)"))
+            MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                    stackIndex2,
+                    writer->typeStack->valueTypes[stackIndex2]
+            ))
+            if (instruction.offset != 0) {
+                MUST (wasmCWritePlus(writer))
+                MUST (stringBuilderAppendU32(writer->builder, instruction.offset))
+                MUST (wasmCWriteChar(writer, 'U'))
+            }
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                    stackIndex1,
+                    writer->typeStack->valueTypes[stackIndex1]
+            ))
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                    writer->builder,
+                    stackIndex0,
+                    writer->typeStack->valueTypes[stackIndex0]
+            ))
+            MUST (wasmCWrite(writer, ");\n"))
+
+            wasmTypeStackDrop(writer->typeStack, 3);
+            MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+        }
+    }
+
+    return true;
+}
+
+#define WASM_C_SIMD_FUNCTION_NAME_LENGTH 64
+
+/*
+ * wasmCGetSIMDFunctionName returns the name of the runtime function implementing the given
+ * SIMD instruction, i.e. the name of the instruction with '.' replaced by '_'
+ */
+static
+void
+wasmCGetSIMDFunctionName(
+    const WasmSIMDOpcode simdOpcode,
+    char* result
+) {
+    const char* description = wasmSIMDOpcodeDescription(simdOpcode);
+    size_t index = 0;
+    for (;
+        description[index] != '\0' && index < WASM_C_SIMD_FUNCTION_NAME_LENGTH - 1;
+        index++
+    ) {
+        const char c = description[index];
+        result[index] = c == '.' ? '_' : c;
+    }
+    result[index] = '\0';
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDConstExpr(
+    const WasmCFunctionWriter* writer
+) {
+    const U8* bytes = writer->code->bytes.bytes + writer->instruction->immediates.bytesStart;
+
+    if (!writer->ignore) {
+        MUST (wasmTypeStackAppend(writer->typeStack, wasmValueTypeV128))
+        {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, wasmValueTypeV128))
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, wasmValueTypeV128))
+            MUST (wasmCWriteAssign(writer))
+            MUST (wasmCWriteV128Literal(writer->builder, bytes))
+            MUST (wasmCWrite(writer, ";\n"))
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDShuffleExpr(
+    const WasmCFunctionWriter* writer
+) {
+    const U8* bytes = writer->code->bytes.bytes + writer->instruction->immediates.bytesStart;
+
+    if (!writer->ignore) {
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+        MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, wasmValueTypeV128))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, wasmValueTypeV128))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWrite(writer, "i8x16_shuffle("))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, wasmValueTypeV128))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, wasmValueTypeV128))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteV128Literal(writer->builder, bytes))
+        MUST (wasmCWrite(writer, ");\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 1);
+    }
+
+    return true;
+}
+
+/*
+ * wasmCWriteSIMDLaneExpr writes an extract_lane instruction,
+ * or a replace_lane instruction if resultType is v128
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDLaneExpr(
+    const WasmCFunctionWriter* writer,
+    const char* functionName,
+    const WasmValueType resultType
+) {
+    const WasmLaneInstruction instruction = writer->instruction->immediates.lane;
+
+    if (!writer->ignore) {
+        const bool replace = resultType == wasmValueTypeV128;
+        const U32 vectorStackIndex = wasmTypeStackGetTopIndex(writer->typeStack, replace ? 1 : 0);
+
+        MUST (wasmTypeStackSet(writer->stackDeclarations, vectorStackIndex, resultType))
+
+        MUST (wasmCWriteIndent(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, vectorStackIndex, resultType))
+        MUST (wasmCWriteAssign(writer))
+        MUST (wasmCWrite(writer, functionName))
+        MUST (wasmCWriteChar(writer, '('))
+        MUST (wasmCWriteStringStackName(writer->builder, vectorStackIndex, wasmValueTypeV128))
+        MUST (wasmCWriteComma(writer))
+        MUST (stringBuilderAppendU32(writer->builder, instruction.laneIndex))
+        if (replace) {
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+            MUST (wasmCWriteComma(writer))
+            MUST (wasmCWriteStringStackName(
+                writer->builder,
+                stackIndex0,
+                writer->typeStack->valueTypes[stackIndex0]
+            ))
+        }
+        MUST (wasmCWrite(writer, ");\n"))
+
+        wasmTypeStackDrop(writer->typeStack, replace ? 2 : 1);
+        MUST (wasmTypeStackAppend(writer->typeStack, resultType))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDBitselectExpr(
+    const WasmCFunctionWriter* writer
+) {
+    const U32 stackIndex2 = wasmTypeStackGetTopIndex(writer->typeStack, 2);
+    const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+    const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+    MUST (wasmCWriteIndent(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, wasmValueTypeV128))
+    MUST (wasmCWriteAssign(writer))
+    MUST (wasmCWrite(writer, "v128_bitselect("))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex2, wasmValueTypeV128))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, wasmValueTypeV128))
+    MUST (wasmCWriteComma(writer))
+    MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, wasmValueTypeV128))
+    MUST (wasmCWrite(writer, ");\n"))
+
+    wasmTypeStackDrop(writer->typeStack, 2);
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDMemoryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmSIMDOpcode simdOpcode,
+    const char* functionName
+) {
+    const WasmMemoryArgumentInstruction instruction = writer->instruction->immediates.memoryArgument;
+    const WasmInstruction* position = writer->instruction;
+
+    if (!writer->ignore) {
+        const U32 length = wasmBoundsCheckSIMDAccessLength(simdOpcode);
+        if (simdOpcode == wasmSIMDOpcodeV128Store) {
+            MUST (wasmCWriteStore(writer, instruction, functionName, position, length))
+        } else {
+            MUST (wasmCWriteLoad(writer, instruction, functionName, wasmValueTypeV128, position, length))
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmCWriteSIMDLaneMemoryExpr writes a load_lane or store_lane instruction,
+ * which access memory at the address and the lane of the vector
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDLaneMemoryExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmSIMDOpcode simdOpcode,
+    const char* functionName,
+    const bool isStore
+) {
+    const WasmMemoryArgumentInstruction instruction =
+        writer->instruction->immediates.laneMemory.memoryArgument;
+    const WasmLaneInstruction laneInstruction = writer->instruction->immediates.laneMemory.lane;
+
+    if (!writer->ignore) {
+        const U32 stackIndex1 = wasmTypeStackGetTopIndex(writer->typeStack, 1);
+        const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+        MUST (wasmCWriteBoundsCheck(
+            writer,
+            NULL,
+            stackIndex1,
+            instruction.offset,
+            wasmBoundsCheckSIMDAccessLength(simdOpcode)
+        ))
+
+        MUST (wasmCWriteIndent(writer))
+        if (!isStore) {
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex1, wasmValueTypeV128))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex1, wasmValueTypeV128))
+            MUST (wasmCWriteAssign(writer))
+        }
+        MUST (wasmCWriteMemoryAccessStart(writer, functionName))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteMemoryAddress(writer, stackIndex1, instruction.offset))
+        MUST (wasmCWriteComma(writer))
+        MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, wasmValueTypeV128))
+        MUST (wasmCWriteComma(writer))
+        MUST (stringBuilderAppendU32(writer->builder, laneInstruction.laneIndex))
+        MUST (wasmCWrite(writer, ");\n"))
+
+        wasmTypeStackDrop(writer->typeStack, 2);
+        if (!isStore) {
+            MUST (wasmTypeStackAppend(writer->typeStack, wasmValueTypeV128))
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmCWriteSIMDExpr writes a SIMD instruction as a call of the runtime function
+ * named after the instruction, see the SIMD section of w2c2_base.h
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSIMDExpr(
+    const WasmCFunctionWriter* writer,
+    const WasmSIMDOpcode simdOpcode
+) {
+    char functionName[WASM_C_SIMD_FUNCTION_NAME_LENGTH];
+    wasmCGetSIMDFunctionName(simdOpcode, functionName);
+
+    switch (simdOpcode) {
+        case wasmSIMDOpcodeV128Load:
+        case wasmSIMDOpcodeV128Load8x8S:
+        case wasmSIMDOpcodeV128Load8x8U:
+        case wasmSIMDOpcodeV128Load16x4S:
+        case wasmSIMDOpcodeV128Load16x4U:
+        case wasmSIMDOpcodeV128Load32x2S:
+        case wasmSIMDOpcodeV128Load32x2U:
+        case wasmSIMDOpcodeV128Load8Splat:
+        case wasmSIMDOpcodeV128Load16Splat:
+        case wasmSIMDOpcodeV128Load32Splat:
+        case wasmSIMDOpcodeV128Load64Splat:
+        case wasmSIMDOpcodeV128Load32Zero:
+        case wasmSIMDOpcodeV128Load64Zero:
+        case wasmSIMDOpcodeV128Store: {
+                MUST (wasmCWriteSIMDMemoryExpr(writer, simdOpcode, functionName))
+                break;
+        }
+        case wasmSIMDOpcodeV128Load8Lane:
+        case wasmSIMDOpcodeV128Load16Lane:
+        case wasmSIMDOpcodeV128Load32Lane:
+        case wasmSIMDOpcodeV128Load64Lane: {
+                MUST (wasmCWriteSIMDLaneMemoryExpr(writer, simdOpcode, functionName, false))
+                break;
+        }
+        case wasmSIMDOpcodeV128Store8Lane:
+        case wasmSIMDOpcodeV128Store16Lane:
+        case wasmSIMDOpcodeV128Store32Lane:
+        case wasmSIMDOpcodeV128Store64Lane: {
+                MUST (wasmCWriteSIMDLaneMemoryExpr(writer, simdOpcode, functionName, true))
+                break;
+        }
+        case wasmSIMDOpcodeV128Const: {
+                MUST (wasmCWriteSIMDConstExpr(writer))
+                break;
+        }
+        case wasmSIMDOpcodeI8x16Shuffle: {
+                MUST (wasmCWriteSIMDShuffleExpr(writer))
+                break;
+        }
+        case wasmSIMDOpcodeI8x16ExtractLaneS:
+        case wasmSIMDOpcodeI8x16ExtractLaneU:
+        case wasmSIMDOpcodeI16x8ExtractLaneS:
+        case wasmSIMDOpcodeI16x8ExtractLaneU:
+        case wasmSIMDOpcodeI32x4ExtractLane: {
+                MUST (wasmCWriteSIMDLaneExpr(writer, functionName, wasmValueTypeI32))
+                break;
+        }
+        case wasmSIMDOpcodeI64x2ExtractLane: {
+                MUST (wasmCWriteSIMDLaneExpr(writer, functionName, wasmValueTypeI64))
+                break;
+        }
+        case wasmSIMDOpcodeF32x4ExtractLane: {
+                MUST (wasmCWriteSIMDLaneExpr(writer, functionName, wasmValueTypeF32))
+                break;
+        }
+        case wasmSIMDOpcodeF64x2ExtractLane: {
+                MUST (wasmCWriteSIMDLaneExpr(writer, functionName, wasmValueTypeF64))
+                break;
+        }
+        case wasmSIMDOpcodeI8x16ReplaceLane:
+        case wasmSIMDOpcodeI16x8ReplaceLane:
+        case wasmSIMDOpcodeI32x4ReplaceLane:
+        case wasmSIMDOpcodeI64x2ReplaceLane:
+        case wasmSIMDOpcodeF32x4ReplaceLane:
+        case wasmSIMDOpcodeF64x2ReplaceLane: {
+                MUST (wasmCWriteSIMDLaneExpr(writer, functionName, wasmValueTypeV128))
+                break;
+        }
+        case wasmSIMDOpcodeI8x16Splat:
+        case wasmSIMDOpcodeI16x8Splat:
+        case wasmSIMDOpcodeI32x4Splat:
+        case wasmSIMDOpcodeI64x2Splat:
+        case wasmSIMDOpcodeF32x4Splat:
+        case wasmSIMDOpcodeF64x2Splat:
+        case wasmSIMDOpcodeV128Not:
+        case wasmSIMDOpcodeF32x4DemoteF64x2Zero:
+        case wasmSIMDOpcodeF64x2PromoteLowF32x4:
+        case wasmSIMDOpcodeI8x16Abs:
+        case wasmSIMDOpcodeI8x16Neg:
+        case wasmSIMDOpcodeI8x16Popcnt:
+        case wasmSIMDOpcodeF32x4Ceil:
+        case wasmSIMDOpcodeF32x4Floor:
+        case wasmSIMDOpcodeF32x4Trunc:
+        case wasmSIMDOpcodeF32x4Nearest:
+        case wasmSIMDOpcodeF64x2Ceil:
+        case wasmSIMDOpcodeF64x2Floor:
+        case wasmSIMDOpcodeF64x2Trunc:
+        case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16S:
+        case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16U:
+        case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8S:
+        case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8U:
+        case wasmSIMDOpcodeI16x8Abs:
+        case wasmSIMDOpcodeI16x8Neg:
+        case wasmSIMDOpcodeI16x8ExtendLowI8x16S:
+        case wasmSIMDOpcodeI16x8ExtendHighI8x16S:
+        case wasmSIMDOpcodeI16x8ExtendLowI8x16U:
+        case wasmSIMDOpcodeI16x8ExtendHighI8x16U:
+        case wasmSIMDOpcodeF64x2Nearest:
+        case wasmSIMDOpcodeI32x4Abs:
+        case wasmSIMDOpcodeI32x4Neg:
+        case wasmSIMDOpcodeI32x4ExtendLowI16x8S:
+        case wasmSIMDOpcodeI32x4ExtendHighI16x8S:
+        case wasmSIMDOpcodeI32x4ExtendLowI16x8U:
+        case wasmSIMDOpcodeI32x4ExtendHighI16x8U:
+        case wasmSIMDOpcodeI64x2Abs:
+        case wasmSIMDOpcodeI64x2Neg:
+        case wasmSIMDOpcodeI64x2ExtendLowI32x4S:
+        case wasmSIMDOpcodeI64x2ExtendHighI32x4S:
+        case wasmSIMDOpcodeI64x2ExtendLowI32x4U:
+        case wasmSIMDOpcodeI64x2ExtendHighI32x4U:
+        case wasmSIMDOpcodeF32x4Abs:
+        case wasmSIMDOpcodeF32x4Neg:
+        case wasmSIMDOpcodeF32x4Sqrt:
+        case wasmSIMDOpcodeF64x2Abs:
+        case wasmSIMDOpcodeF64x2Neg:
+        case wasmSIMDOpcodeF64x2Sqrt:
+        case wasmSIMDOpcodeI32x4TruncSatF32x4S:
+        case wasmSIMDOpcodeI32x4TruncSatF32x4U:
+        case wasmSIMDOpcodeF32x4ConvertI32x4S:
+        case wasmSIMDOpcodeF32x4ConvertI32x4U:
+        case wasmSIMDOpcodeI32x4TruncSatF64x2SZero:
+        case wasmSIMDOpcodeI32x4TruncSatF64x2UZero:
+        case wasmSIMDOpcodeF64x2ConvertLowI32x4S:
+        case wasmSIMDOpcodeF64x2ConvertLowI32x4U: {
+                if (!writer->ignore) {
+                    MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeV128, functionName))
+                }
+                break;
+        }
+        case wasmSIMDOpcodeV128AnyTrue:
+        case wasmSIMDOpcodeI8x16AllTrue:
+        case wasmSIMDOpcodeI8x16Bitmask:
+        case wasmSIMDOpcodeI16x8AllTrue:
+        case wasmSIMDOpcodeI16x8Bitmask:
+        case wasmSIMDOpcodeI32x4AllTrue:
+        case wasmSIMDOpcodeI32x4Bitmask:
+        case wasmSIMDOpcodeI64x2AllTrue:
+        case wasmSIMDOpcodeI64x2Bitmask: {
+                if (!writer->ignore) {
+                    MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, functionName))
+                }
+                break;
+        }
+        case wasmSIMDOpcodeI8x16Swizzle:
+        case wasmSIMDOpcodeI8x16Eq:
+        case wasmSIMDOpcodeI8x16Ne:
+        case wasmSIMDOpcodeI8x16LtS:
+        case wasmSIMDOpcodeI8x16LtU:
+        case wasmSIMDOpcodeI8x16GtS:
+        case wasmSIMDOpcodeI8x16GtU:
+        case wasmSIMDOpcodeI8x16LeS:
+        case wasmSIMDOpcodeI8x16LeU:
+        case wasmSIMDOpcodeI8x16GeS:
+        case wasmSIMDOpcodeI8x16GeU:
+        case wasmSIMDOpcodeI16x8Eq:
+        case wasmSIMDOpcodeI16x8Ne:
+        case wasmSIMDOpcodeI16x8LtS:
+        case wasmSIMDOpcodeI16x8LtU:
+        case wasmSIMDOpcodeI16x8GtS:
+        case wasmSIMDOpcodeI16x8GtU:
+        case wasmSIMDOpcodeI16x8LeS:
+        case wasmSIMDOpcodeI16x8LeU:
+        case wasmSIMDOpcodeI16x8GeS:
+        case wasmSIMDOpcodeI16x8GeU:
+        case wasmSIMDOpcodeI32x4Eq:
+        case wasmSIMDOpcodeI32x4Ne:
+        case wasmSIMDOpcodeI32x4LtS:
+        case wasmSIMDOpcodeI32x4LtU:
+        case wasmSIMDOpcodeI32x4GtS:
+        case wasmSIMDOpcodeI32x4GtU:
+        case wasmSIMDOpcodeI32x4LeS:
+        case wasmSIMDOpcodeI32x4LeU:
+        case wasmSIMDOpcodeI32x4GeS:
+        case wasmSIMDOpcodeI32x4GeU:
+        case wasmSIMDOpcodeF32x4Eq:
+        case wasmSIMDOpcodeF32x4Ne:
+        case wasmSIMDOpcodeF32x4Lt:
+        case wasmSIMDOpcodeF32x4Gt:
+        case wasmSIMDOpcodeF32x4Le:
+        case wasmSIMDOpcodeF32x4Ge:
+        case wasmSIMDOpcodeF64x2Eq:
+        case wasmSIMDOpcodeF64x2Ne:
+        case wasmSIMDOpcodeF64x2Lt:
+        case wasmSIMDOpcodeF64x2Gt:
+        case wasmSIMDOpcodeF64x2Le:
+        case wasmSIMDOpcodeF64x2Ge:
+        case wasmSIMDOpcodeV128And:
+        case wasmSIMDOpcodeV128Andnot:
+        case wasmSIMDOpcodeV128Or:
+        case wasmSIMDOpcodeV128Xor:
+        case wasmSIMDOpcodeI8x16NarrowI16x8S:
+        case wasmSIMDOpcodeI8x16NarrowI16x8U:
+        case wasmSIMDOpcodeI8x16Add:
+        case wasmSIMDOpcodeI8x16AddSatS:
+        case wasmSIMDOpcodeI8x16AddSatU:
+        case wasmSIMDOpcodeI8x16Sub:
+        case wasmSIMDOpcodeI8x16SubSatS:
+        case wasmSIMDOpcodeI8x16SubSatU:
+        case wasmSIMDOpcodeI8x16MinS:
+        case wasmSIMDOpcodeI8x16MinU:
+        case wasmSIMDOpcodeI8x16MaxS:
+        case wasmSIMDOpcodeI8x16MaxU:
+        case wasmSIMDOpcodeI8x16AvgrU:
+        case wasmSIMDOpcodeI16x8Q15mulrSatS:
+        case wasmSIMDOpcodeI16x8NarrowI32x4S:
+        case wasmSIMDOpcodeI16x8NarrowI32x4U:
+        case wasmSIMDOpcodeI16x8Add:
+        case wasmSIMDOpcodeI16x8AddSatS:
+        case wasmSIMDOpcodeI16x8AddSatU:
+        case wasmSIMDOpcodeI16x8Sub:
+        case wasmSIMDOpcodeI16x8SubSatS:
+        case wasmSIMDOpcodeI16x8SubSatU:
+        case wasmSIMDOpcodeI16x8Mul:
+        case wasmSIMDOpcodeI16x8MinS:
+        case wasmSIMDOpcodeI16x8MinU:
+        case wasmSIMDOpcodeI16x8MaxS:
+        case wasmSIMDOpcodeI16x8MaxU:
+        case wasmSIMDOpcodeI16x8AvgrU:
+        case wasmSIMDOpcodeI16x8ExtmulLowI8x16S:
+        case wasmSIMDOpcodeI16x8ExtmulHighI8x16S:
+        case wasmSIMDOpcodeI16x8ExtmulLowI8x16U:
+        case wasmSIMDOpcodeI16x8ExtmulHighI8x16U:
+        case wasmSIMDOpcodeI32x4Add:
+        case wasmSIMDOpcodeI32x4Sub:
+        case wasmSIMDOpcodeI32x4Mul:
+        case wasmSIMDOpcodeI32x4MinS:
+        case wasmSIMDOpcodeI32x4MinU:
+        case wasmSIMDOpcodeI32x4MaxS:
+        case wasmSIMDOpcodeI32x4MaxU:
+        case wasmSIMDOpcodeI32x4DotI16x8S:
+        case wasmSIMDOpcodeI32x4ExtmulLowI16x8S:
+        case wasmSIMDOpcodeI32x4ExtmulHighI16x8S:
+        case wasmSIMDOpcodeI32x4ExtmulLowI16x8U:
+        case wasmSIMDOpcodeI32x4ExtmulHighI16x8U:
+        case wasmSIMDOpcodeI64x2Add:
+        case wasmSIMDOpcodeI64x2Sub:
+        case wasmSIMDOpcodeI64x2Mul:
+        case wasmSIMDOpcodeI64x2Eq:
+        case wasmSIMDOpcodeI64x2Ne:
+        case wasmSIMDOpcodeI64x2LtS:
+        case wasmSIMDOpcodeI64x2GtS:
+        case wasmSIMDOpcodeI64x2LeS:
+        case wasmSIMDOpcodeI64x2GeS:
+        case wasmSIMDOpcodeI64x2ExtmulLowI32x4S:
+        case wasmSIMDOpcodeI64x2ExtmulHighI32x4S:
+        case wasmSIMDOpcodeI64x2ExtmulLowI32x4U:
+        case wasmSIMDOpcodeI64x2ExtmulHighI32x4U:
+        case wasmSIMDOpcodeF32x4Add:
+        case wasmSIMDOpcodeF32x4Sub:
+        case wasmSIMDOpcodeF32x4Mul:
+        case wasmSIMDOpcodeF32x4Div:
+        case wasmSIMDOpcodeF32x4Min:
+        case wasmSIMDOpcodeF32x4Max:
+        case wasmSIMDOpcodeF32x4Pmin:
+        case wasmSIMDOpcodeF32x4Pmax:
+        case wasmSIMDOpcodeF64x2Add:
+        case wasmSIMDOpcodeF64x2Sub:
+        case wasmSIMDOpcodeF64x2Mul:
+        case wasmSIMDOpcodeF64x2Div:
+        case wasmSIMDOpcodeF64x2Min:
+        case wasmSIMDOpcodeF64x2Max:
+        case wasmSIMDOpcodeF64x2Pmin:
+        case wasmSIMDOpcodeF64x2Pmax:
+        case wasmSIMDOpcodeI8x16Shl:
+        case wasmSIMDOpcodeI8x16ShrS:
+        case wasmSIMDOpcodeI8x16ShrU:
+        case wasmSIMDOpcodeI16x8Shl:
+        case wasmSIMDOpcodeI16x8ShrS:
+        case wasmSIMDOpcodeI16x8ShrU:
+        case wasmSIMDOpcodeI32x4Shl:
+        case wasmSIMDOpcodeI32x4ShrS:
+        case wasmSIMDOpcodeI32x4ShrU:
+        case wasmSIMDOpcodeI64x2Shl:
+        case wasmSIMDOpcodeI64x2ShrS:
+        case wasmSIMDOpcodeI64x2ShrU: {
+                if (!writer->ignore) {
+                    MUST (wasmCWritePrefixBinaryExpr(writer, wasmValueTypeV128, functionName))
+                }
+                break;
+        }
+        case wasmSIMDOpcodeV128Bitselect: {
+                if (!writer->ignore) {
+                    MUST (wasmCWriteSIMDBitselectExpr(writer))
+                }
+                break;
+        }
+        default: {
+            fprintf(
+                stderr,
+                "w2c2: unsupported SIMD opcode: 0x%X\n",
+                simdOpcode
+            );
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmCFoldProduces returns true if the result of the given instruction can be folded,
+ * i.e. it is computed by an expression without side effects, which does not trap,
+ * except for out-of-bounds memory accesses.
+ *
+ * Comparisons are not folded, as their result has type int in C.
+ * Floating-point constants are not folded, as they may be written as integer literals,
+ * and C compilers simplify expressions like x - 0.0, which must quiet signaling NaNs.
+ * For the same reason, promotions are not folded, as a demotion of a promotion is simplified.
+ * Floating-point multiplications are not folded, as C compilers may contract them
+ * with an enclosing addition into a fused multiply-add, which rounds differently
+ */
+static
+bool
+wasmCFoldProduces(
+    const WasmCFunctionWriter* writer,
+    const WasmInstruction* instruction
+) {
+    switch (instruction->opcode) {
+        case wasmOpcodeI32Load:
+        case wasmOpcodeI64Load:
+        case wasmOpcodeF32Load:
+        case wasmOpcodeF64Load:
+        case wasmOpcodeI32Load8S:
+        case wasmOpcodeI32Load8U:
+        case wasmOpcodeI32Load16S:
+        case wasmOpcodeI32Load16U:
+        case wasmOpcodeI64Load8S:
+        case wasmOpcodeI64Load8U:
+        case wasmOpcodeI64Load16S:
+        case wasmOpcodeI64Load16U:
+        case wasmOpcodeI64Load32S:
+        case wasmOpcodeI64Load32U:
+            /* Checked accesses are preceded by a bounds check of the address */
+            return writer->boundsCheckMode != wasmBoundsCheckModeChecked;
+        case wasmOpcodeLocalGet:
+        case wasmOpcodeGlobalGet:
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeI32Clz:
+        case wasmOpcodeI32Ctz:
+        case wasmOpcodeI32PopCnt:
+        case wasmOpcodeI32Add:
+        case wasmOpcodeI32Sub:
+        case wasmOpcodeI32Mul:
+        case wasmOpcodeI32And:
+        case wasmOpcodeI32Or:
+        case wasmOpcodeI32Xor:
+        case wasmOpcodeI32Shl:
+        case wasmOpcodeI32ShrS:
+        case wasmOpcodeI32ShrU:
+        case wasmOpcodeI32Rotl:
+        case wasmOpcodeI32Rotr:
+        case wasmOpcodeI64Clz:
+        case wasmOpcodeI64Ctz:
+        case wasmOpcodeI64PopCnt:
+        case wasmOpcodeI64Add:
+        case wasmOpcodeI64Sub:
+        case wasmOpcodeI64Mul:
+        case wasmOpcodeI64And:
+        case wasmOpcodeI64Or:
+        case wasmOpcodeI64Xor:
+        case wasmOpcodeI64Shl:
+        case wasmOpcodeI64ShrS:
+        case wasmOpcodeI64ShrU:
+        case wasmOpcodeI64Rotl:
+        case wasmOpcodeI64Rotr:
+        case wasmOpcodeF32Abs:
+        case wasmOpcodeF32Neg:
+        case wasmOpcodeF32Ceil:
+        case wasmOpcodeF32Floor:
+        case wasmOpcodeF32Trunc:
+        case wasmOpcodeF32Nearest:
+        case wasmOpcodeF32Sqrt:
+        case wasmOpcodeF32Add:
+        case wasmOpcodeF32Sub:
+        case wasmOpcodeF32Div:
+        case wasmOpcodeF32Min:
+        case wasmOpcodeF32Max:
+        case wasmOpcodeF32CopySign:
+        case wasmOpcodeF64Abs:
+        case wasmOpcodeF64Neg:
+        case wasmOpcodeF64Ceil:
+        case wasmOpcodeF64Floor:
+        case wasmOpcodeF64Trunc:
+        case wasmOpcodeF64Nearest:
+        case wasmOpcodeF64Sqrt:
+        case wasmOpcodeF64Add:
+        case wasmOpcodeF64Sub:
+        case wasmOpcodeF64Div:
+        case wasmOpcodeF64Min:
+        case wasmOpcodeF64Max:
+        case wasmOpcodeF64CopySign:
+        case wasmOpcodeI32WrapI64:
+        case wasmOpcodeI64ExtendI32S:
+        case wasmOpcodeI64ExtendI32U:
+        case wasmOpcodeF32ConvertI32S:
+        case wasmOpcodeF32ConvertI32U:
+        case wasmOpcodeF32ConvertI64S:
+        case wasmOpcodeF32ConvertI64U:
+        case wasmOpcodeF32DemoteF64:
+        case wasmOpcodeF64ConvertI32S:
+        case wasmOpcodeF64ConvertI32U:
+        case wasmOpcodeF64ConvertI64S:
+        case wasmOpcodeF64ConvertI64U:
+        case wasmOpcodeI32ReinterpretF32:
+        case wasmOpcodeI64ReinterpretF64:
+        case wasmOpcodeF32ReinterpretI32:
+        case wasmOpcodeF64ReinterpretI64:
+        case wasmOpcodeI32Extend8S:
+        case wasmOpcodeI32Extend16S:
+        case wasmOpcodeI64Extend8S:
+        case wasmOpcodeI64Extend16S:
+        case wasmOpcodeI64Extend32S:
+            return true;
+        case wasmOpcodeMiscPrefix:
+            switch ((WasmMiscOpcode) instruction->prefixedOpcode) {
+                case wasmMiscOpcodeI32TruncSatF32S:
+                case wasmMiscOpcodeI32TruncSatF32U:
+                case wasmMiscOpcodeI32TruncSatF64S:
+                case wasmMiscOpcodeI32TruncSatF64U:
+                case wasmMiscOpcodeI64TruncSatF32S:
+                case wasmMiscOpcodeI64TruncSatF32U:
+                case wasmMiscOpcodeI64TruncSatF64S:
+                case wasmMiscOpcodeI64TruncSatF64U:
+                    return true;
+                default:
+                    return false;
+            }
+        default:
+            return false;
+    }
+}
+
+/*
+ * wasmCFoldConsumes returns true if the given instruction writes all uses of its operands
+ * using wasmCWriteStackValue, and pops all of them, so folded values can be moved into it.
+ * Instructions which may have side effects consume folded values, but their result is not folded
+ */
+static
+bool
+wasmCFoldConsumes(
+    const WasmCFunctionWriter* writer,
+    const WasmInstruction* instruction
+) {
+    if (wasmCFoldProduces(writer, instruction)) {
+        return true;
+    }
+
+    switch (instruction->opcode) {
+        case wasmOpcodeI32Store:
+        case wasmOpcodeI64Store:
+        case wasmOpcodeF32Store:
+        case wasmOpcodeF64Store:
+        case wasmOpcodeI32Store8:
+        case wasmOpcodeI32Store16:
+        case wasmOpcodeI64Store8:
+        case wasmOpcodeI64Store16:
+        case wasmOpcodeI64Store32:
+            return writer->boundsCheckMode != wasmBoundsCheckModeChecked;
+        case wasmOpcodeCall:
+        case wasmOpcodeLocalSet:
+        case wasmOpcodeGlobalSet:
+        case wasmOpcodeI32Eqz:
+        case wasmOpcodeI32Eq:
+        case wasmOpcodeI32Ne:
+        case wasmOpcodeI32LtS:
+        case wasmOpcodeI32LtU:
+        case wasmOpcodeI32GtS:
+        case wasmOpcodeI32GtU:
+        case wasmOpcodeI32LeS:
+        case wasmOpcodeI32LeU:
+        case wasmOpcodeI32GeS:
+        case wasmOpcodeI32GeU:
+        case wasmOpcodeI64Eqz:
+        case wasmOpcodeI64Eq:
+        case wasmOpcodeI64Ne:
+        case wasmOpcodeI64LtS:
+        case wasmOpcodeI64LtU:
+        case wasmOpcodeI64GtS:
+        case wasmOpcodeI64GtU:
+        case wasmOpcodeI64LeS:
+        case wasmOpcodeI64LeU:
+        case wasmOpcodeI64GeS:
+        case wasmOpcodeI64GeU:
+        case wasmOpcodeF32Eq:
+        case wasmOpcodeF32Ne:
+        case wasmOpcodeF32Lt:
+        case wasmOpcodeF32Gt:
+        case wasmOpcodeF32Le:
+        case wasmOpcodeF32Ge:
+        case wasmOpcodeF64Eq:
+        case wasmOpcodeF64Ne:
+        case wasmOpcodeF64Lt:
+        case wasmOpcodeF64Gt:
+        case wasmOpcodeF64Le:
+        case wasmOpcodeF64Ge:
+        case wasmOpcodeF32Mul:
+        case wasmOpcodeF64Mul:
+        case wasmOpcodeI32DivS:
+        case wasmOpcodeI32DivU:
+        case wasmOpcodeI32RemS:
+        case wasmOpcodeI32RemU:
+        case wasmOpcodeI64DivS:
+        case wasmOpcodeI64DivU:
+        case wasmOpcodeI64RemS:
+        case wasmOpcodeI64RemU:
+        case wasmOpcodeI32TruncF32S:
+        case wasmOpcodeI32TruncF32U:
+        case wasmOpcodeI32TruncF64S:
+        case wasmOpcodeI32TruncF64U:
+        case wasmOpcodeI64TruncF32S:
+        case wasmOpcodeI64TruncF32U:
+        case wasmOpcodeI64TruncF64S:
+        case wasmOpcodeI64TruncF64U:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+ * wasmCFoldBegin prepares folding for the given instruction.
+ * Instructions which do not consume folded values, e.g. control instructions,
+ * keep the assignments of all folded values
+ */
+static
+void
+wasmCFoldBegin(
+    const WasmCFunctionWriter* writer,
+    const WasmInstruction* instruction
+) {
+    WasmCExpressionFolder* folder = writer->folder;
+
+    folder->consuming = !writer->ignore && wasmCFoldConsumes(writer, instruction);
+    if (!folder->consuming) {
+        folder->values.length = 0;
+    }
+    folder->instructionStart = writer->builder->length;
+    folder->depth = 0;
+    folder->hasResult = false;
+}
+
+/*
+ * wasmCFoldEnd removes the assignments of the folded values consumed by the given instruction,
+ * and folds the instruction's result, if possible
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCFoldEnd(
+    const WasmCFunctionWriter* writer,
+    const WasmInstruction* instruction
+) {
+    WasmCExpressionFolder* folder = writer->folder;
+    WasmCFoldedValues* values = &folder->values;
+    StringBuilder* builder = writer->builder;
+    size_t removedLength = 0;
+    size_t firstConsumedIndex = values->length;
+    size_t index = 0;
+
+    if (!folder->consuming || writer->ignore) {
+        folder->consuming = false;
+        values->length = 0;
+        return true;
+    }
+    folder->consuming = false;
+
+    /*
+     * The consumed values are the operands on the top of the stack.
+     * Their assignments directly precede the instruction's code and can be removed
+     */
+    while (firstConsumedIndex > 0 && values->values[firstConsumedIndex - 1].consumed) {
+        firstConsumedIndex--;
+    }
+    for (; index < firstConsumedIndex; index++) {
+        if (values->values[index].consumed) {
+            /* Keep all assignments. Their expressions are free of side effects */
+            values->length = 0;
+            return true;
+        }
+    }
+    if (firstConsumedIndex < values->length) {
+        const size_t start = values->values[firstConsumedIndex].statementStart;
+        if (values->values[values->length - 1].statementEnd != folder->instructionStart) {
+            values->length = 0;
+            return true;
+        }
+        removedLength = folder->instructionStart - start;
+        stringBuilderRemove(builder, start, removedLength);
+        values->length = firstConsumedIndex;
+    }
+
+    if (!wasmCFoldProduces(writer, instruction)) {
+        values->length = 0;
+        return true;
+    }
+
+    /*
+     * Only fold the result if the instruction's code ends with the assignment
+     * of the result, e.g. it is not followed by a bounds check
+     */
+    if (folder->hasResult
+        && folder->result.statementEnd == builder->length + removedLength
+        && folder->depth < wasmCFoldMaxDepth
+    ) {
+        WasmCFoldedValue result = folder->result;
+        result.statementStart -= removedLength;
+        result.expressionStart -= removedLength;
+        result.statementEnd -= removedLength;
+        result.depth = folder->depth + 1;
+        result.consumed = false;
+        MUST (wasmCFoldedValuesAppend(values, result))
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionCode(
+    WasmCFunctionWriter* writer,
+    WasmOpcode* opcode
+) {
+    const WasmInstructions* instructions = &writer->code->instructions;
+    const WasmInstruction* instruction = NULL;
+
+    while (true) {
+        if (writer->debug) {
+            const size_t relativeAddress = writer->instructionIndex < instructions->length
+                ? instructions->instructions[writer->instructionIndex].offset
+                : writer->function.code.length;
+            const size_t absoluteAddress = writer->function.start + relativeAddress;
+            const WasmDebugLine* debugLine = wasmCGetDebugLine(
+                writer->debugLines,
+                absoluteAddress
+            );
+            if (debugLine != NULL) {
+                MUST (wasmCWriteDebugLine(writer->builder, debugLine))
+            }
+        }
+
+        if (writer->instructionIndex >= instructions->length) {
+            break;
+        }
+
+        instruction = &instructions->instructions[writer->instructionIndex++];
+        writer->instruction = instruction;
+        *opcode = instruction->opcode;
+
+        if (writer->folder != NULL) {
+            wasmCFoldBegin(writer, instruction);
+        }
+
+        switch (*opcode) {
+            case wasmOpcodeNop:
+                break;
+            case wasmOpcodeElse:
+            case wasmOpcodeEnd:
+                return true;
+            case wasmOpcodeIf: {
+                MUST (wasmCWriteIfExpr(writer, opcode))
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeBlock: {
+                MUST (wasmCWriteBlockExpr(writer, opcode))
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeLoop: {
+                MUST (wasmCWriteLoopExpr(writer, opcode))
+                if (*opcode == wasmOpcodeElse) {
+                    return true;
+                }
+                break;
+            }
+            case wasmOpcodeCall: {
+                MUST (wasmCWriteCallExpr(writer))
+                break;
+            }
+            case wasmOpcodeCallIndirect: {
+                MUST (wasmCWriteCallIndirectExpr(writer))
+                break;
+            }
+            case wasmOpcodeReturnCall: {
+                MUST (wasmCWriteReturnCallExpr(writer))
+                break;
+            }
+            case wasmOpcodeReturnCallIndirect: {
+                MUST (wasmCWriteReturnCallIndirectExpr(writer))
+                break;
+            }
+            case wasmOpcodeBr: {
+                MUST (wasmCWriteBranchExpr(writer))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeBrIf: {
+                MUST (wasmCWriteBranchIfExpr(writer))
+                break;
+            }
+            case wasmOpcodeBrTable: {
+                MUST (wasmCWriteBranchTableExpr(writer))
+                writer->ignore = true;
+                break;
+            }
+            case wasmOpcodeLocalGet: {
+                MUST (wasmCWriteLocalGetExpr(writer))
+                break;
+            }
+            case wasmOpcodeLocalSet:
+            case wasmOpcodeLocalTee: {
+                MUST (wasmCWriteLocalAssignmentExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeGlobalGet: {
+                MUST (wasmCWriteGlobalGetExpr(writer))
+                break;
+            }
+            case wasmOpcodeGlobalSet: {
+                MUST (wasmCWriteGlobalSetExpr(writer))
+                break;
+            }
+            case wasmOpcodeI32Const:
+            case wasmOpcodeI64Const:
+            case wasmOpcodeF32Const:
+            case wasmOpcodeF64Const: {
+                MUST (wasmCWriteConstExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeI32Load:
+            case wasmOpcodeI64Load:
+            case wasmOpcodeF32Load:
+            case wasmOpcodeF64Load:
+            case wasmOpcodeI32Load8S:
+            case wasmOpcodeI32Load8U:
+            case wasmOpcodeI32Load16S:
+            case wasmOpcodeI32Load16U:
+            case wasmOpcodeI64Load8S:
+            case wasmOpcodeI64Load8U:
+            case wasmOpcodeI64Load16S:
+            case wasmOpcodeI64Load16U:
+            case wasmOpcodeI64Load32S:
+            case wasmOpcodeI64Load32U: {
+                MUST (wasmCWriteLoadExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeI32Store:
+            case wasmOpcodeI64Store:
+            case wasmOpcodeF32Store:
+            case wasmOpcodeF64Store:
+            case wasmOpcodeI32Store8:
+            case wasmOpcodeI32Store16:
+            case wasmOpcodeI64Store8:
+            case wasmOpcodeI64Store16:
+            case wasmOpcodeI64Store32: {
+                MUST (wasmCWriteStoreExpr(writer, *opcode))
+                break;
+            }
+            case wasmOpcodeMemorySize: {
+                MUST (wasmCWriteMemorySizeExpr(writer))
+                break;
+            }
+            case wasmOpcodeMemoryGrow: {
+                MUST (wasmCWriteMemoryGrowExpr(writer))
+                break;
+            }
+            case wasmOpcodeThreadsPrefix: {
+                const WasmThreadsOpcode threadsOpcode = (WasmThreadsOpcode) writer->instruction->prefixedOpcode;
+
+                switch (threadsOpcode) {
+                    case wasmThreadsOpcodeMemoryAtomicNotify: {
+                        MUST (wasmCWriteMemoryAtomicNotifyExpr(writer))
+                        break;
+                    }
+                    case wasmThreadsOpcodeMemoryAtomicWait32: {
+                        MUST (wasmCWriteMemoryAtomicWait32Expr(writer))
+                        break;
+                    }
+                    case wasmThreadsOpcodeMemoryAtomicWait64: {
+                        MUST (wasmCWriteMemoryAtomicWait64Expr(writer))
+                        break;
+                    }
+                    case wasmThreadsOpcodeAtomicFence: {
+                        MUST (wasmCWriteAtomicFenceExpr(writer))
+                        break;
+                    }
+                    case wasmThreadsOpcodeI32AtomicLoad:
+                    case wasmThreadsOpcodeI64AtomicLoad:
+                    case wasmThreadsOpcodeI32AtomicLoad8U:
+                    case wasmThreadsOpcodeI32AtomicLoad16U:
+                    case wasmThreadsOpcodeI64AtomicLoad8U:
+                    case wasmThreadsOpcodeI64AtomicLoad16U:
+                    case wasmThreadsOpcodeI64AtomicLoad32U: {
+                        MUST (wasmCWriteAtomicLoadExpr(writer, threadsOpcode))
+                        break;
+                    }
+                    case wasmThreadsOpcodeI32AtomicStore:
+                    case wasmThreadsOpcodeI64AtomicStore:
+                    case wasmThreadsOpcodeI32AtomicStore8:
+                    case wasmThreadsOpcodeI32AtomicStore16:
+                    case wasmThreadsOpcodeI64AtomicStore8:
+                    case wasmThreadsOpcodeI64AtomicStore16:
+                    case wasmThreadsOpcodeI64AtomicStore32: {
+                        MUST (wasmCWriteAtomicStoreExpr(writer, threadsOpcode))
+                        break;
+                    }
+                    case wasmThreadsOpcodeI32AtomicRMWAdd:
+                    case wasmThreadsOpcodeI64AtomicRMWAdd:
+                    case wasmThreadsOpcodeI32AtomicRMW8AddU:
+                    case wasmThreadsOpcodeI32AtomicRMW16AddU:
+                    case wasmThreadsOpcodeI64AtomicRMW8AddU:
+                    case wasmThreadsOpcodeI64AtomicRMW16AddU:
+                    case wasmThreadsOpcodeI64AtomicRMW32AddU:
+                    case wasmThreadsOpcodeI32AtomicRMWSub:
+                    case wasmThreadsOpcodeI64AtomicRMWSub:
+                    case wasmThreadsOpcodeI32AtomicRMW8SubU:
+                    case wasmThreadsOpcodeI32AtomicRMW16SubU:
+                    case wasmThreadsOpcodeI64AtomicRMW8SubU:
+                    case wasmThreadsOpcodeI64AtomicRMW16SubU:
+                    case wasmThreadsOpcodeI64AtomicRMW32SubU:
+                    case wasmThreadsOpcodeI32AtomicRMWAnd:
+                    case wasmThreadsOpcodeI64AtomicRMWAnd:
+                    case wasmThreadsOpcodeI32AtomicRMW8AndU:
+                    case wasmThreadsOpcodeI32AtomicRMW16AndU:
+                    case wasmThreadsOpcodeI64AtomicRMW8AndU:
+                    case wasmThreadsOpcodeI64AtomicRMW16AndU:
+                    case wasmThreadsOpcodeI64AtomicRMW32AndU:
+                    case wasmThreadsOpcodeI32AtomicRMWOr:
+                    case wasmThreadsOpcodeI64AtomicRMWOr:
+                    case wasmThreadsOpcodeI32AtomicRMW8OrU:
+                    case wasmThreadsOpcodeI32AtomicRMW16OrU:
+                    case wasmThreadsOpcodeI64AtomicRMW8OrU:
+                    case wasmThreadsOpcodeI64AtomicRMW16OrU:
+                    case wasmThreadsOpcodeI64AtomicRMW32OrU:
+                    case wasmThreadsOpcodeI32AtomicRMWXor:
+                    case wasmThreadsOpcodeI64AtomicRMWXor:
+                    case wasmThreadsOpcodeI32AtomicRMW8XorU:
+                    case wasmThreadsOpcodeI32AtomicRMW16XorU:
+                    case wasmThreadsOpcodeI64AtomicRMW8XorU:
+                    case wasmThreadsOpcodeI64AtomicRMW16XorU:
+                    case wasmThreadsOpcodeI64AtomicRMW32XorU:
+                    case wasmThreadsOpcodeI32AtomicRMWXchg:
+                    case wasmThreadsOpcodeI64AtomicRMWXchg:
+                    case wasmThreadsOpcodeI32AtomicRMW8XchgU:
+                    case wasmThreadsOpcodeI32AtomicRMW16XchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW8XchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW16XchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW32XchgU: {
+                        MUST (wasmCWriteAtomicRMWExpr(writer, threadsOpcode))
+                        break;
+                    }
+                    case wasmThreadsOpcodeI32AtomicRMWCmpxchg:
+                    case wasmThreadsOpcodeI64AtomicRMWCmpxchg:
+                    case wasmThreadsOpcodeI32AtomicRMW8CmpxchgU:
+                    case wasmThreadsOpcodeI32AtomicRMW16CmpxchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW8CmpxchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW16CmpxchgU:
+                    case wasmThreadsOpcodeI64AtomicRMW32CmpxchgU: {
+                        MUST (wasmCWriteAtomicRMWCmpxchgExpr(writer, threadsOpcode))
+                        break;
+                    }
+                }
+
+                break;
+            }
+            case wasmOpcodeSIMDPrefix: {
+                const WasmSIMDOpcode simdOpcode = (WasmSIMDOpcode) writer->instruction->prefixedOpcode;
+                MUST (wasmCWriteSIMDExpr(writer, simdOpcode))
+                break;
+            }
+            case wasmOpcodeMiscPrefix: {
+                const WasmMiscOpcode miscOpcode = (WasmMiscOpcode) writer->instruction->prefixedOpcode;
+
+                switch (miscOpcode) {
+                    case wasmMiscOpcodeMemoryInit: {
+                        MUST (wasmCWriteMemoryInitExpr(writer))
+                        break;
+                    }
+                    case wasmMiscOpcodeDataDrop: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeMemoryCopy: {
+                        MUST (wasmCWriteMemoryCopyExpr(writer))
+                        continue;
+                    }
+                    case wasmMiscOpcodeMemoryFill: {
+                        MUST (wasmCWriteMemoryFillExpr(writer, miscOpcode))
+                        continue;
+                    }
+                    case wasmMiscOpcodeTableInit: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeElemDrop: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeTableCopy: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeTableGrow: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeTableSize: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    case wasmMiscOpcodeTableFill: {
+                        /* TODO */
+                        fprintf(
+                            stderr,
+                            "w2c2: unimplemented opcode: %s\n",
+                            wasmMiscOpcodeDescription(miscOpcode)
+                        );
+
+                        break;
+                    }
+                    default:
+                        if (writer->ignore) {
+                            break;
+                        }
+
+                        switch (miscOpcode) {
+                            case wasmMiscOpcodeI32TruncSatF32S: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_S_F32"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI64TruncSatF32S: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_S_F32"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI32TruncSatF64S: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_S_F64"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI64TruncSatF64S: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_S_F64"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI32TruncSatF32U: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_U_F32"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI64TruncSatF32U: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_U_F32"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI32TruncSatF64U: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI32, "I32_TRUNC_SAT_U_F64"))
+                                break;
+                            }
+                            case wasmMiscOpcodeI64TruncSatF64U: {
+                                MUST (wasmCWriteUnaryExpr(writer, wasmValueTypeI64, "I64_TRUNC_SAT_U_F64"))
+                                break;
+                            }
+                            default: {
+                                fprintf(
+                                    stderr,
+                                    "w2c2: unsupported misc opcode: %s\n",
+                                    wasmMiscOpcodeDescription(miscOpcode)
+                                );
+                                return false;
+                            }
+                        }
+
+                        break;
+                }
+
+                break;
+            }
+            default: {
+                if (writer->ignore) {
+                    break;
+                }
+
+                switch (*opcode) {
+                    case wasmOpcodeDrop: {
+                        wasmTypeStackDrop(writer->typeStack, 1);
+                        break;
+                    }
+                    case wasmOpcodeUnreachable: {
+                        MUST (wasmCWriteGlobalCacheStore(writer))
+                        MUST (wasmCWriteIndent(writer))
+                        MUST (wasmCWrite(writer, "UNREACHABLE;\n"))
+                        writer->ignore = true;
+                        break;
+                    }
+                    case wasmOpcodeSelect: {
+                        MUST (wasmCWriteSelectExpr(writer))
+                        break;
+                    }
+                    case wasmOpcodeReturn: {
+                        MUST (wasmCWriteGoto(writer, 0))
+                        writer->ignore = true;
+                        break;
+                    }
+                    case wasmOpcodeI32Eq:
+                    case wasmOpcodeI64Eq:
+                    case wasmOpcodeF32Eq:
+                    case wasmOpcodeF64Eq: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "==", false))
+                        break;
+                    }
+                    case wasmOpcodeI32Ne:
+                    case wasmOpcodeI64Ne:
+                    case wasmOpcodeF32Ne:
+                    case wasmOpcodeF64Ne: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "!=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32LtS:
+                    case wasmOpcodeI64LtS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<"))
+                        break;
+                    }
+                    case wasmOpcodeI32LtU:
+                    case wasmOpcodeI64LtU:
+                    case wasmOpcodeF32Lt:
+                    case wasmOpcodeF64Lt: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "<", false))
+                        break;
+                    }
+                    case wasmOpcodeI32LeS:
+                    case wasmOpcodeI64LeS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, "<="))
+                        break;
+                    }
+                    case wasmOpcodeI32LeU:
+                    case wasmOpcodeI64LeU:
+                    case wasmOpcodeF32Le:
+                    case wasmOpcodeF64Le: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "<=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32GtS:
+                    case wasmOpcodeI64GtS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">"))
+                        break;
+                    }
+                    case wasmOpcodeI32GtU:
+                    case wasmOpcodeI64GtU:
+                    case wasmOpcodeF32Gt:
+                    case wasmOpcodeF64Gt: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, ">", false))
+                        break;
+                    }
+                    case wasmOpcodeI32GeS:
+                    case wasmOpcodeI64GeS: {
+                        MUST (wasmCWriteSignedInfixBinaryExpr(writer, *opcode, ">="))
+                        break;
+                    }
+                    case wasmOpcodeI32GeU:
+                    case wasmOpcodeI64GeU:
+                    case wasmOpcodeF32Ge:
+                    case wasmOpcodeF64Ge: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, ">=", false))
+                        break;
+                    }
+                    case wasmOpcodeI32Add: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "+", true))
+                        break;
+                    }
+                    case wasmOpcodeI64Add: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI64, "+", true))
+                        break;
+                    }
+                    case wasmOpcodeF32Add: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeF32, "+", true))
+                        break;
+                    }
+                    case wasmOpcodeF64Add: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeF64, "+", true))
+                        break;
+                    }
+                    case wasmOpcodeI32Sub: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI32, "-", true))
+                        break;
+                    }
+                    case wasmOpcodeI64Sub: {
+                        MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeI64, "-", true))
+                        break;
                     }
                     case wasmOpcodeF32Sub: {
                         MUST (wasmCWriteInfixBinaryExpr(writer, wasmValueTypeF32, "-", true))
@@ -4295,374 +6639,2222 @@ wasmCWriteFunctionCode(
                 }
             }
         }
+
+        if (writer->folder != NULL) {
+            MUST (wasmCFoldEnd(writer, instruction))
+        }
+    }
+
+    return true;
+}
+
+static
+void
+wasmCWriteStackDeclarations(
+    FILE* file,
+    const WasmTypeStack* stackDeclarations,
+    const bool pretty
+) {
+    WasmValueType testType = 0;
+    for (; testType < wasmValueType_count; testType++) {
+        U32 written = 0;
+
+        U32 stackDeclarationIndex = 0;
+        for (; stackDeclarationIndex < stackDeclarations->length; stackDeclarationIndex++) {
+            const WasmValueType entry = stackDeclarations->valueTypes[stackDeclarationIndex];
+            if (!entry) {
+                continue;
+            }
+            if (!wasmTypeStackIsSet(stackDeclarations, stackDeclarationIndex, testType)) {
+                continue;
+            }
+            if (written == 0) {
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                fputs(valueTypeNames[testType], file);
+                fputc(' ', file);
+            } else {
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+
+            wasmCWriteFileStackName(file, stackDeclarationIndex, testType);
+
+            written++;
+        }
+
+        if (written > 0) {
+            fputs(";\n", file);
+        }
+    }
+}
+
+/*
+ * WasmCStackVariable is a stack variable of a function, i.e. a stack index and type.
+ * Stack variables of the same type whose uses do not overlap in the function's code
+ * are coalesced into a single variable.
+ */
+typedef struct WasmCStackVariable {
+    /* Offsets of the first and last use in the function's code */
+    size_t firstUse;
+    size_t lastUse;
+    bool used;
+    /* Index of the variable the stack variable is coalesced into */
+    U32 coalescedIndex;
+    /* Last use of all stack variables coalesced into the variable with this index */
+    size_t coalescedLastUse;
+} WasmCStackVariable;
+
+ARRAY_TYPE(
+    WasmCStackVariables,
+    WasmCStackVariable,
+    wasmCStackVariables,
+    variables,
+    variable
+)
+
+ARRAY_TYPE(
+    WasmCStackVariableIndices,
+    U32,
+    wasmCStackVariableIndices,
+    indices,
+    index
+)
+
+typedef struct WasmCStackCoalescer {
+    /* The stack variables, indexed by stack index and type */
+    WasmCStackVariables variables;
+    /* Indices of the used stack variables, in the order of their first use */
+    WasmCStackVariableIndices order;
+    /* Parameters of the function's loops */
+    WasmCLoopParameters loopParameters;
+} WasmCStackCoalescer;
+
+static const WasmCStackCoalescer wasmCEmptyStackCoalescer = {
+    {0, 0, NULL},
+    {0, 0, NULL},
+    {0, 0, NULL}
+};
+
+static
+W2C2_INLINE
+bool
+wasmCIsIdentifierCharacter(
+    const char c
+) {
+    return isalnum((unsigned char) c) || c == '_';
+}
+
+/*
+ * wasmCParseStackName returns true if the name of a stack variable starts at the given offset
+ * of the given code, i.e. the stack name prefix, the type, and the stack index,
+ * not preceded or followed by another character of an identifier
+ */
+static
+bool
+wasmCParseStackName(
+    const StringBuilder* builder,
+    const size_t offset,
+    U32* stackIndex,
+    WasmValueType* valueType,
+    size_t* length
+) {
+    const char* string = builder->string;
+    size_t end = offset + 2;
+    U32 index = 0;
+    WasmValueType type = 0;
+
+    if (string[offset] != stackNamePrefix
+        || (offset > 0 && wasmCIsIdentifierCharacter(string[offset - 1]))
+    ) {
+        return false;
+    }
+
+    /* The code is null-terminated, so the type is checked before the following character */
+    for (; type < wasmValueType_count; type++) {
+        if (string[offset + 1] == valueTypeStackNames[type]) {
+            break;
+        }
+    }
+    if (type == wasmValueType_count || !isdigit((unsigned char) string[end])) {
+        return false;
+    }
+
+    for (; isdigit((unsigned char) string[end]); end++) {
+        index = index * 10 + (U32) (string[end] - '0');
+    }
+    if (wasmCIsIdentifierCharacter(string[end])) {
+        return false;
+    }
+
+    *stackIndex = index;
+    *valueType = type;
+    *length = end - offset;
+    return true;
+}
+
+/*
+ * wasmCCoalesceStackVariables coalesces the stack variables of the same type
+ * whose uses do not overlap in the function's code, and updates the stack declarations.
+ *
+ * The stack of a block is never accessed inside of a nested block,
+ * so a stack variable is unused between its last use in the code and any earlier use,
+ * except for the parameters of a loop, which branches to its start assign.
+ * They are used until the end of the loop.
+ *
+ * Returns false if the code contains names of undeclared stack variables,
+ * in which case the stack variables are left as they are.
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCCoalesceStackVariables(
+    const StringBuilder* builder,
+    WasmTypeStack* stackDeclarations,
+    WasmCStackCoalescer* coalescer
+) {
+    const size_t variableCount = stackDeclarations->length * wasmValueType_count;
+    size_t offset = 0;
+
+    if (!wasmCStackVariablesEnsureCapacity(&coalescer->variables, variableCount)) {
+        return false;
+    }
+    coalescer->variables.length = variableCount;
+    memset(coalescer->variables.variables, 0, variableCount * sizeof(WasmCStackVariable));
+    coalescer->order.length = 0;
+
+    while (offset < builder->length) {
+        U32 stackIndex = 0;
+        WasmValueType valueType = 0;
+        size_t length = 0;
+        size_t variableIndex = 0;
+        WasmCStackVariable* variable = NULL;
+
+        if (!wasmCParseStackName(builder, offset, &stackIndex, &valueType, &length)) {
+            offset++;
+            continue;
+        }
+
+        if (stackIndex >= stackDeclarations->length
+            || !wasmTypeStackIsSet(stackDeclarations, stackIndex, valueType)
+        ) {
+            return false;
+        }
+
+        variableIndex = stackIndex * wasmValueType_count + valueType;
+        variable = &coalescer->variables.variables[variableIndex];
+        if (!variable->used) {
+            variable->used = true;
+            variable->firstUse = offset;
+            if (!wasmCStackVariableIndicesAppend(&coalescer->order, (U32) variableIndex)) {
+                return false;
+            }
+        }
+        variable->lastUse = offset;
+
+        offset += length;
+    }
+
+    {
+        size_t parameterIndex = 0;
+        for (; parameterIndex < coalescer->loopParameters.length; parameterIndex++) {
+            const WasmCLoopParameter parameter = coalescer->loopParameters.parameters[parameterIndex];
+            WasmCStackVariable* variable = NULL;
+
+            if (parameter.stackIndex >= stackDeclarations->length) {
+                continue;
+            }
+
+            variable = &coalescer->variables.variables[
+                parameter.stackIndex * wasmValueType_count + parameter.valueType
+            ];
+            if (variable->used && variable->lastUse < parameter.loopEnd) {
+                variable->lastUse = parameter.loopEnd;
+            }
+        }
+    }
+
+    memset(stackDeclarations->valueTypes, 0, stackDeclarations->length * sizeof(WasmValueType));
+
+    /* Assign each variable the lowest coalesced index which is unused from its first use on */
+    {
+        size_t orderIndex = 0;
+        for (; orderIndex < coalescer->order.length; orderIndex++) {
+            const U32 variableIndex = coalescer->order.indices[orderIndex];
+            const WasmValueType valueType = (WasmValueType) (variableIndex % wasmValueType_count);
+            WasmCStackVariable* variable = &coalescer->variables.variables[variableIndex];
+
+            U32 coalescedIndex = 0;
+            WasmCStackVariable* coalesced = NULL;
+            for (;; coalescedIndex++) {
+                coalesced = &coalescer->variables.variables[coalescedIndex * wasmValueType_count + valueType];
+                if (!wasmTypeStackIsSet(stackDeclarations, coalescedIndex, valueType)
+                    || coalesced->coalescedLastUse < variable->firstUse
+                ) {
+                    break;
+                }
+            }
+
+            variable->coalescedIndex = coalescedIndex;
+            coalesced->coalescedLastUse = variable->lastUse;
+            MUST (wasmTypeStackSet(stackDeclarations, coalescedIndex, valueType))
+        }
+    }
+
+    return true;
+}
+
+/* wasmCWriteFileCoalescedCode writes the function's code, using the coalesced stack variables */
+static
+void
+wasmCWriteFileCoalescedCode(
+    FILE* file,
+    const StringBuilder* builder,
+    const WasmCStackCoalescer* coalescer
+) {
+    size_t start = 0;
+    size_t offset = 0;
+
+    while (offset < builder->length) {
+        U32 stackIndex = 0;
+        WasmValueType valueType = 0;
+        size_t length = 0;
+
+        if (!wasmCParseStackName(builder, offset, &stackIndex, &valueType, &length)) {
+            offset++;
+            continue;
+        }
+
+        fwrite(builder->string + start, 1, offset - start, file);
+        wasmCWriteFileStackName(
+            file,
+            coalescer->variables.variables[stackIndex * wasmValueType_count + valueType].coalescedIndex,
+            valueType
+        );
+
+        offset += length;
+        start = offset;
+    }
+
+    fwrite(builder->string + start, 1, builder->length - start, file);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionReturn(
+    WasmCFunctionWriter* writer,
+    const WasmFunctionType functionType
+) {
+    if (!functionType.resultCount) {
+        return true;
+    }
+
+    if (writer->stackDeclarations->length > 0) {
+        wasmTypeStackClear(writer->typeStack);
+        MUST (wasmCAppendTypes(writer->typeStack, functionType.resultCount, functionType.resultTypes))
+
+        if (functionType.resultCount == 1) {
+            const WasmValueType returnType = functionType.resultTypes[0];
+            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
+
+            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, returnType))
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "return "))
+            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, returnType))
+            MUST (wasmCWrite(writer, ";\n"))
+        } else {
+            /* Multiple results are returned in a struct */
+            U32 resultIndex = 0;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "{\n"))
+            writer->indent++;
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWriteStringReturnType(writer->builder, functionType))
+            MUST (wasmCWriteChar(writer, ' '))
+            MUST (wasmCWrite(writer, multiValueVariableName))
+            MUST (wasmCWrite(writer, ";\n"))
+
+            for (; resultIndex < functionType.resultCount; resultIndex++) {
+                const WasmValueType resultType = functionType.resultTypes[resultIndex];
+
+                MUST (wasmTypeStackSet(writer->stackDeclarations, resultIndex, resultType))
+
+                MUST (wasmCWriteIndent(writer))
+                MUST (wasmCWrite(writer, multiValueVariableName))
+                MUST (wasmCWriteChar(writer, '.'))
+                MUST (wasmCWriteStringMultiValueFieldName(writer->builder, resultIndex))
+                MUST (wasmCWriteAssign(writer))
+                MUST (wasmCWriteStringStackName(writer->builder, resultIndex, resultType))
+                MUST (wasmCWrite(writer, ";\n"))
+            }
+
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "return "))
+            MUST (wasmCWrite(writer, multiValueVariableName))
+            MUST (wasmCWrite(writer, ";\n"))
+
+            writer->indent--;
+            MUST (wasmCWriteIndent(writer))
+            MUST (wasmCWrite(writer, "}\n"))
+        }
+    }
+
+    return true;
+}
+
+/*
+ * wasmCWriteFileSingleInstanceDeclaration declares the instance variable
+ * of a function which does not take the instance as a parameter
+ */
+static
+void
+wasmCWriteFileSingleInstanceDeclaration(
+    FILE* file,
+    const char* moduleName,
+    const bool pretty
+) {
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fprintf(
+        file,
+        pretty ? "%sInstance* const i = &%s%s;\n" : "%sInstance*const i=&%s%s;\n",
+        moduleName,
+        moduleName,
+        singleInstanceNameSuffix
+    );
+}
+
+/*
+ * wasmCWriteFileSingleInstanceSelection replaces the instance passed to a function of the public API
+ * with the single instance
+ */
+static
+void
+wasmCWriteFileSingleInstanceSelection(
+    FILE* file,
+    const char* moduleName,
+    const bool pretty
+) {
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fprintf(file, pretty ? "i = &%s%s;\n" : "i=&%s%s;\n", moduleName, singleInstanceNameSuffix);
+}
+
+/* Name of the instance passed to Instantiate and ResetInstance, when the single instance is used */
+static const char* const singleInstanceCallerName = "caller";
+
+/*
+ * wasmCWriteFileSingleInstanceCallerDeclaration keeps the instance passed to a function of the public API,
+ * before it is replaced with the single instance
+ */
+static
+void
+wasmCWriteFileSingleInstanceCallerDeclaration(
+    FILE* file,
+    const char* moduleName,
+    const bool pretty
+) {
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fprintf(
+        file,
+        pretty ? "%sInstance* const %s = i;\n" : "%sInstance*const %s=i;\n",
+        moduleName,
+        singleInstanceCallerName
+    );
+}
+
+/*
+ * wasmCWriteFileSingleInstanceCopy copies the single instance to the instance passed to
+ * a function of the public API, if any, so it is initialized and refers to the same memories.
+ * The copy is a snapshot: later changes of globals and tables are only made to the single instance
+ */
+static
+void
+wasmCWriteFileSingleInstanceCopy(
+    FILE* file,
+    const bool pretty
+) {
+    const char* indent = pretty ? indentation : "";
+
+    fprintf(
+        file,
+        pretty ? "%sif (%s != NULL && %s != i) {\n" : "%sif(%s!=NULL&&%s!=i){\n",
+        indent,
+        singleInstanceCallerName,
+        singleInstanceCallerName
+    );
+    fprintf(file, pretty ? "%s%s*%s = *i;\n" : "%s%s*%s=*i;\n", indent, indent, singleInstanceCallerName);
+    fprintf(file, "%s}\n", indent);
+}
+
+static
+void
+wasmCWriteFileMemoryBaseDeclaration(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fprintf(file, "U8* %s", memoryBaseName);
+    fputs(pretty ? " = " : "=", file);
+    wasmCWriteFileMemoryUse(file, module, 0, NULL, true);
+    fputs("->data;\n", file);
+}
+
+static
+void
+wasmCWriteFileCachedGlobalDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    const WasmCGlobalCache* globalCache,
+    const bool pretty
+) {
+    size_t index = 0;
+    for (; index < globalCache->indices.length; index++) {
+        const U32 globalIndex = globalCache->indices.indices[index];
+        WasmValueType globalType = 0;
+        if (!wasmModuleGetGlobalType(module, globalIndex, &globalType)) {
+            continue;
+        }
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs(valueTypeNames[globalType], file);
+        fputc(' ', file);
+        wasmCWriteFileCachedGlobalName(file, globalIndex);
+        fputs(pretty ? " = " : "=", file);
+        wasmCWriteFileGlobalUse(file, module, globalIndex, false);
+        fputs(";\n", file);
+    }
+}
+
+/*
+ * wasmCWriteFileTailCallPrologue writes the prologue of functions which perform tail calls
+ * through the trampoline: The function was called by a trampoline if it is the tail call target
+ */
+static
+void
+wasmCWriteFileTailCallPrologue(
+    FILE* file,
+    const char* moduleName,
+    const U32 functionIndex,
+    const bool mustTailAvailable,
+    const bool pretty,
+    const bool multipleModules
+) {
+    if (mustTailAvailable) {
+        fputs("#if !WASM_TAIL_CALL_MUSTTAIL\n", file);
+    }
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fprintf(file, "bool %s", tailCallModeName);
+    fputs(pretty ? " = " : "=", file);
+    fputs(pretty ? "i->tailCallTarget == (wasmFunc)" : "i->tailCallTarget==(wasmFunc)", file);
+    if (multipleModules) {
+        fputs(moduleName, file);
+        fputc('_', file);
+    }
+    wasmCWriteFileFunctionNonImportName(file, functionIndex);
+    fputs(";\n", file);
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs(pretty ? "i->tailCallTarget = NULL;\n" : "i->tailCallTarget=NULL;\n", file);
+    if (mustTailAvailable) {
+        fputs("#endif\n", file);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionBody(
+    FILE* file,
+    StringBuilder* stringBuilder,
+    WasmTypeStack* typeStack,
+    WasmTypeStack* stackDeclarations,
+    WasmLabelStack* labelStack,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmFunction function,
+    const U32 functionIndex,
+    const WasmCode* code,
+    WasmDebugLines* debugLines,
+    const bool pretty,
+    const bool debug,
+    const bool multipleModules,
+    const bool* instanceParameters,
+    const WasmBoundsCheckMode boundsCheckMode,
+    const bool cacheMemoryBase,
+    WasmCGlobalCache* globalCache,
+    WasmCExpressionFolder* folder,
+    WasmDataflow* dataflow,
+    WasmCStackCoalescer* coalescer
+) {
+    WasmBoundsCheckAccesses boundsCheckAccesses = wasmEmptyBoundsCheckAccesses;
+    bool coalesced = false;
+    bool memoryBaseUsed = false;
+    bool selfTailCallUsed = false;
+    bool tailCallTrampolineUsed = false;
+    bool tailCallMustTailUnavailable = false;
+    WasmOpcode opcode = wasmOpcodeUnreachable;
+    WasmLabel label = wasmEmptyLabel;
+
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    MUST (stringBuilderReset(stringBuilder))
+
+    {
+        WasmCFunctionWriter writer;
+        writer.builder = stringBuilder;
+        writer.typeStack = typeStack;
+        writer.stackDeclarations = stackDeclarations;
+        writer.labelStack = labelStack;
+        writer.module = module;
+        writer.moduleName = moduleName;
+        writer.function = function;
+        writer.code = code;
+        writer.instructionIndex = 0;
+        writer.instruction = NULL;
+        writer.indent = 0;
+        writer.ignore = false;
+        writer.pretty = pretty;
+        writer.debug = debug;
+        writer.multipleModules = multipleModules;
+        writer.instanceParameters = instanceParameters;
+        writer.debugLines = debugLines;
+        writer.boundsCheckMode = boundsCheckMode;
+        writer.boundsCheckAccesses = &boundsCheckAccesses;
+        writer.cacheMemoryBase = cacheMemoryBase;
+        writer.memoryBaseUsed = &memoryBaseUsed;
+        writer.globalCache = globalCache;
+        if (globalCache != NULL) {
+            MUST (wasmCGlobalCacheAnalyze(globalCache, module, code))
+        }
+        writer.functionIndex = functionIndex;
+        writer.selfTailCallUsed = &selfTailCallUsed;
+        writer.tailCallTrampolineUsed = &tailCallTrampolineUsed;
+        writer.tailCallMustTailUnavailable = &tailCallMustTailUnavailable;
+        writer.folder = folder;
+        if (folder != NULL) {
+            folder->values.length = 0;
+        }
+        writer.loopLabelStackIndex = 0;
+        writer.loopBreak = false;
+        writer.loopParameters = NULL;
+        if (coalescer != NULL) {
+            writer.loopParameters = &coalescer->loopParameters;
+            writer.loopParameters->length = 0;
+        }
+
+        MUST (wasmLabelStackPush(
+            writer.labelStack,
+            0,
+            functionType.resultCount,
+            functionType.resultTypes,
+            &label
+        ))
+        MUST (wasmCWriteFunctionCode(&writer, &opcode))
+        MUST (wasmCWriteLabel(&writer, label.index))
+        MUST (wasmCWriteGlobalCacheStore(&writer))
+        MUST (wasmCWriteFunctionReturn(&writer, functionType))
+    }
+
+    MUST (wasmDataflowAnalyzeLocals(module, function, code, dataflow))
+    if (coalescer != NULL) {
+        coalesced = wasmCCoalesceStackVariables(stringBuilder, stackDeclarations, coalescer);
+    }
+
+    fputs("{\n", file);
+    if (!wasmCFunctionHasInstanceParameter(module, instanceParameters, functionIndex)) {
+        wasmCWriteFileSingleInstanceDeclaration(file, moduleName, pretty);
+    }
+    wasmCWriteFileLocalsDeclarations(file, module, function, dataflow, pretty);
+    wasmCWriteStackDeclarations(file, stackDeclarations, pretty);
+    if (memoryBaseUsed) {
+        wasmCWriteFileMemoryBaseDeclaration(file, module, pretty);
+    }
+    if (globalCache != NULL) {
+        wasmCWriteFileCachedGlobalDeclarations(file, module, globalCache, pretty);
+    }
+    if (tailCallTrampolineUsed) {
+        wasmCWriteFileTailCallPrologue(
+            file,
+            moduleName,
+            functionIndex,
+            !tailCallMustTailUnavailable,
+            pretty,
+            multipleModules
+        );
+    }
+    if (selfTailCallUsed) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fprintf(file, "%s:;\n", tailCallEntryLabelName);
+    }
+    if (coalesced) {
+        wasmCWriteFileCoalescedCode(file, stringBuilder, coalescer);
+    } else {
+        fwrite(stringBuilder->string, 1, stringBuilder->length, file);
+    }
+    fputs("}\n", file);
+
+    return true;
+}
+
+static
+void
+wasmCWriteFileParameters(
+    FILE* file,
+    const char* moduleName,
+    const WasmFunctionType functionType,
+    const bool writeParameterNames,
+    const bool voidPointerInstanceType,
+    const bool instanceParameter,
+    const bool pretty
+) {
+    fputc('(', file);
+    if (!instanceParameter) {
+        if (functionType.parameterCount == 0) {
+            fputs("void", file);
+        }
+    } else if (voidPointerInstanceType) {
+        fputs("void*", file);
+    } else {
+        fputs(moduleName, file);
+        fputs("Instance*", file);
+    }
+
+    if (instanceParameter && writeParameterNames) {
+        if (pretty) {
+            fputs(" i", file);
+        } else {
+            fputc('i', file);
+        }
+    }
+    {
+        U32 parameterIndex = 0;
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            const char* parameterTypeName = valueTypeNames[parameterType];
+            if (instanceParameter || parameterIndex > 0) {
+                if (pretty) {
+                    fputs(", ", file);
+                } else {
+                    fputc(',', file);
+                }
+            }
+            fputs(parameterTypeName, file);
+            if (writeParameterNames) {
+                fputc(' ', file);
+                wasmCWriteFileLocalName(file, parameterIndex);
+            }
+        }
+    }
+    fputc(')', file);
+}
+
+
+static
+void
+wasmCWriteFileFunctionSignature(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmFunction function,
+    const U32 functionIndex,
+    const bool writeParameterNames,
+    const bool instanceParameter,
+    const bool pretty,
+    const bool prefix
+) {
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    wasmCWriteFileReturnType(file, functionType);
+    fputc(' ', file);
+    if (prefix) {
+        fputs(moduleName, file);
+        fputc('_', file);
+    }
+    wasmCWriteFileFunctionNonImportName(file, functionIndex);
+    wasmCWriteFileParameters(
+        file,
+        moduleName,
+        functionType,
+        writeParameterNames,
+        false,
+        instanceParameter,
+        pretty
+    );
+}
+
+/*
+ * WasmCFunctionEffects summarizes the effects of a function, from the least to the most.
+ * Only functions which always return and never trap have no effects or only read state,
+ * so calls of them can be removed, combined, and moved by the C compiler
+ */
+typedef enum WasmCFunctionEffects {
+    /* The result only depends on the arguments, i.e. the function is const */
+    wasmCFunctionEffectsNone,
+    /* The function also reads globals or the size of the memory, i.e. the function is pure */
+    wasmCFunctionEffectsRead,
+    /*
+     * The function writes state, reads the memory or tables, calls imported functions
+     * or functions through tables, may trap, or may not return, i.e. it contains a loop
+     */
+    wasmCFunctionEffectsAny
+} WasmCFunctionEffects;
+
+ARRAY_TYPE(
+    WasmCFunctionIndices,
+    U32,
+    wasmCFunctionIndices,
+    indices,
+    index
+)
+
+static const WasmCFunctionIndices wasmCEmptyFunctionIndices = {0, 0, NULL};
+
+static
+void
+wasmCWriteFunctionDeclarations(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const bool* instanceParameters,
+    const bool* reachableFunctions,
+    const WasmCFunctionEffects* functionEffects,
+    const bool pretty,
+    const bool debug,
+    const bool multipleModules
+) {
+    const size_t functionImportCount = module->functionImports.length;
+    const U32 functionCount = module->functions.count;
+
+    U32 declaredFunctionIndex = 0;
+    for (; declaredFunctionIndex < functionCount; declaredFunctionIndex++) {
+        const WasmFunction function = module->functions.functions[declaredFunctionIndex];
+        const U32 moduleFunctionIndex = assertSizeU32(functionImportCount) + declaredFunctionIndex;
+
+        if (reachableFunctions != NULL && !reachableFunctions[declaredFunctionIndex]) {
+            continue;
+        }
+
+        wasmCWriteFileFunctionSignature(
+            file,
+            module,
+            moduleName,
+            function,
+            moduleFunctionIndex,
+            false,
+            wasmCFunctionHasInstanceParameter(module, instanceParameters, moduleFunctionIndex),
+            pretty,
+            multipleModules
+        );
+
+        if (debug && function.exportName == NULL && moduleFunctionIndex < module->functionNames.length) {
+            char* functionName = module->functionNames.names[moduleFunctionIndex];
+            if (functionName != NULL) {
+                fprintf(file, " __asm__(\"%s_%s\")", moduleName, functionName);
+            }
+        }
+
+        /* Functions without results are only called for their effects */
+        if (module->functionTypes.functionTypes[function.functionTypeIndex].resultCount > 0) {
+            switch (functionEffects[declaredFunctionIndex]) {
+                case wasmCFunctionEffectsNone: {
+                    fputs(" CONST_FUNCTION", file);
+                    break;
+                }
+                case wasmCFunctionEffectsRead: {
+                    fputs(" PURE_FUNCTION", file);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        fputs(";\n\n", file);
+    }
+}
+
+/*
+ * Version of the cache entries.
+ * Must be changed whenever the code generated for function bodies changes
+ */
+static const U32 wasmCCacheVersion = 4;
+
+typedef struct WasmCCache {
+    const char* directory;
+    /* Hash of the options and the parts of the module the generated function bodies depend on */
+    U8 moduleHash[SHA1_DIGEST_LENGTH];
+} WasmCCache;
+
+static
+void
+wasmCCacheHashU32(
+    SHA1_CTX* context,
+    const U32 value
+) {
+    U8 bytes[4];
+    bytes[0] = (U8)(value & 0xFF);
+    bytes[1] = (U8)((value >> 8) & 0xFF);
+    bytes[2] = (U8)((value >> 16) & 0xFF);
+    bytes[3] = (U8)((value >> 24) & 0xFF);
+    SHA1Update(context, bytes, 4);
+}
+
+static
+void
+wasmCCacheHashString(
+    SHA1_CTX* context,
+    const char* string
+) {
+    const size_t length = strlen(string);
+    wasmCCacheHashU32(context, (U32)length);
+    SHA1Update(context, (const U8*)string, length);
+}
+
+static
+void
+wasmCCacheHashValueTypes(
+    SHA1_CTX* context,
+    const U32 count,
+    const WasmValueType* valueTypes
+) {
+    U32 index = 0;
+    wasmCCacheHashU32(context, count);
+    for (; index < count; index++) {
+        wasmCCacheHashU32(context, (U32)valueTypes[index]);
+    }
+}
+
+/*
+ * wasmCCacheInitialize hashes everything the generated function bodies depend on,
+ * except the functions themselves: The options, the module name, the types,
+ * the imports, the globals, the memories, and the tables
+ */
+static
+void
+wasmCCacheInitialize(
+    WasmCCache* cache,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmCWriteModuleOptions options
+) {
+    SHA1_CTX context;
+    U32 index = 0;
+
+    SHA1Init(&context);
+
+    wasmCCacheHashU32(&context, wasmCCacheVersion);
+    wasmCCacheHashString(&context, moduleName);
+    wasmCCacheHashU32(&context, options.pretty);
+    wasmCCacheHashU32(&context, options.multipleModules);
+    wasmCCacheHashU32(&context, (U32)options.boundsCheckMode);
+    wasmCCacheHashU32(&context, options.cacheMemoryBase);
+    wasmCCacheHashU32(&context, options.cacheGlobals);
+    wasmCCacheHashU32(&context, options.foldExpressions);
+    wasmCCacheHashU32(&context, options.singleInstance);
+
+    wasmCCacheHashU32(&context, module->functionTypes.count);
+    for (index = 0; index < module->functionTypes.count; index++) {
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[index];
+        wasmCCacheHashValueTypes(&context, functionType.parameterCount, functionType.parameterTypes);
+        wasmCCacheHashValueTypes(&context, functionType.resultCount, functionType.resultTypes);
+    }
+
+    wasmCCacheHashU32(&context, (U32)module->functionImports.length);
+    for (index = 0; index < module->functionImports.length; index++) {
+        const WasmFunctionImport import = module->functionImports.imports[index];
+        wasmCCacheHashString(&context, import.module);
+        wasmCCacheHashString(&context, import.name);
+        wasmCCacheHashU32(&context, import.functionTypeIndex);
+    }
+
+    wasmCCacheHashU32(&context, (U32)module->globalImports.length);
+    for (index = 0; index < module->globalImports.length; index++) {
+        const WasmGlobalImport import = module->globalImports.imports[index];
+        wasmCCacheHashString(&context, import.module);
+        wasmCCacheHashString(&context, import.name);
+        wasmCCacheHashU32(&context, (U32)import.globalType.valueType);
+        wasmCCacheHashU32(&context, import.globalType.mutable);
+    }
+
+    wasmCCacheHashU32(&context, (U32)module->memoryImports.length);
+    for (index = 0; index < module->memoryImports.length; index++) {
+        const WasmMemoryImport import = module->memoryImports.imports[index];
+        wasmCCacheHashString(&context, import.module);
+        wasmCCacheHashString(&context, import.name);
+        wasmCCacheHashU32(&context, import.min);
+        wasmCCacheHashU32(&context, import.max);
+        wasmCCacheHashU32(&context, import.shared);
+    }
+
+    wasmCCacheHashU32(&context, (U32)module->tableImports.length);
+    for (index = 0; index < module->tableImports.length; index++) {
+        const WasmTableImport import = module->tableImports.imports[index];
+        wasmCCacheHashString(&context, import.module);
+        wasmCCacheHashString(&context, import.name);
+        wasmCCacheHashU32(&context, import.min);
+        wasmCCacheHashU32(&context, import.max);
+    }
+
+    wasmCCacheHashU32(&context, module->globals.count);
+    for (index = 0; index < module->globals.count; index++) {
+        const WasmGlobal global = module->globals.globals[index];
+        wasmCCacheHashU32(&context, (U32)global.type.valueType);
+        wasmCCacheHashU32(&context, global.type.mutable);
+        wasmCCacheHashU32(&context, (U32)global.init.length);
+        SHA1Update(&context, global.init.data, global.init.length);
+    }
+
+    wasmCCacheHashU32(&context, module->memories.count);
+    for (index = 0; index < module->memories.count; index++) {
+        const WasmMemory memory = module->memories.memories[index];
+        wasmCCacheHashU32(&context, memory.min);
+        wasmCCacheHashU32(&context, memory.max);
+        wasmCCacheHashU32(&context, memory.shared);
+    }
+
+    wasmCCacheHashU32(&context, module->tables.count);
+    for (index = 0; index < module->tables.count; index++) {
+        const WasmTable table = module->tables.tables[index];
+        wasmCCacheHashU32(&context, table.min);
+        wasmCCacheHashU32(&context, table.max);
+    }
+
+    SHA1Final(cache->moduleHash, &context);
+}
+
+/*
+ * wasmCCacheFunctionKey determines the key of the cache entry for the given function.
+ * In addition to the module hash and the hash of the function's code,
+ * it covers the function's type, the types of the functions it calls directly,
+ * whether the function and the functions it calls directly take the instance as a parameter,
+ * and, if the function performs tail calls, its index
+ */
+static
+void
+wasmCCacheFunctionKey(
+    const WasmCCache* cache,
+    const WasmModule* module,
+    const WasmFunction function,
+    const U32 functionIndex,
+    const WasmCode* code,
+    const bool* instanceParameters,
+    U8* key
+) {
+    const U32 functionImportCount = assertSizeU32(module->functionImports.length);
+
+    SHA1_CTX context;
+    size_t instructionIndex = 0;
+
+    SHA1Init(&context);
+    SHA1Update(&context, cache->moduleHash, SHA1_DIGEST_LENGTH);
+    SHA1Update(&context, function.hash, SHA1_DIGEST_LENGTH);
+    wasmCCacheHashU32(&context, function.functionTypeIndex);
+    wasmCCacheHashU32(&context, wasmCFunctionHasInstanceParameter(module, instanceParameters, functionIndex));
+
+    for (; instructionIndex < code->instructions.length; instructionIndex++) {
+        const WasmInstruction* instruction = &code->instructions.instructions[instructionIndex];
+        const WasmOpcode opcode = instruction->opcode;
+
+        if (opcode == wasmOpcodeReturnCall || opcode == wasmOpcodeReturnCallIndirect) {
+            wasmCCacheHashU32(&context, functionIndex);
+        }
+
+        if (opcode == wasmOpcodeCall || opcode == wasmOpcodeReturnCall) {
+            const U32 funcIndex = instruction->immediates.call.funcIndex;
+            if (funcIndex >= functionImportCount
+                && funcIndex - functionImportCount < module->functions.count
+            ) {
+                const WasmFunction target =
+                    module->functions.functions[funcIndex - functionImportCount];
+                wasmCCacheHashU32(&context, target.functionTypeIndex);
+                wasmCCacheHashU32(&context, wasmCFunctionHasInstanceParameter(module, instanceParameters, funcIndex));
+            }
+        }
+    }
+
+    SHA1Final(key, &context);
+}
+
+/*
+ * wasmCCachePath returns the path of the cache entry with the given key,
+ * which must be freed by the caller
+ */
+static
+char*
+wasmCCachePath(
+    const WasmCCache* cache,
+    const U8* key,
+    const char* suffix
+) {
+    static const char* const hexDigits = "0123456789abcdef";
+
+    const size_t directoryLength = strlen(cache->directory);
+    char* path = malloc(directoryLength + 1 + 2 * SHA1_DIGEST_LENGTH + strlen(suffix) + 1);
+    char* name = NULL;
+    U32 index = 0;
+
+    if (path == NULL) {
+        return NULL;
+    }
+
+    strcpy(path, cache->directory);
+    path[directoryLength] = PATH_SEPARATOR;
+    name = path + directoryLength + 1;
+    for (; index < SHA1_DIGEST_LENGTH; index++) {
+        *name++ = hexDigits[key[index] >> 4];
+        *name++ = hexDigits[key[index] & 0xF];
+    }
+    strcpy(name, suffix);
+
+    return path;
+}
+
+/*
+ * wasmCCacheRead writes the cached body of the function with the given key to the file.
+ * Returns false if there is no cache entry
+ */
+static
+bool
+wasmCCacheRead(
+    const WasmCCache* cache,
+    const U8* key,
+    FILE* file
+) {
+    char* path = wasmCCachePath(cache, key, ".c");
+    Buffer buffer;
+    bool result = false;
+
+    if (path == NULL) {
+        return false;
+    }
+
+    buffer = readFile(path);
+    if (buffer.data != NULL) {
+        result = fwrite(buffer.data, 1, buffer.length, file) == buffer.length;
+        free(buffer.data);
+    }
+
+    free(path);
+    return result;
+}
+
+/*
+ * wasmCCacheWrite writes the body of the function, both into the file and into the cache.
+ * The body is first written to a temporary file, which is then moved into place,
+ * so concurrent processes never read incomplete cache entries
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCCacheWrite(
+    const WasmCCache* cache,
+    const U8* key,
+    FILE* file,
+    FILE* temporaryFile,
+    const char* temporaryPath
+) {
+    Buffer buffer;
+    char* path = NULL;
+
+    if (fclose(temporaryFile) != 0) {
+        fprintf(
+            stderr,
+            "w2c2: failed to close cache file %s: %s\n",
+            temporaryPath,
+            strerror(errno)
+        );
+        return false;
+    }
+
+    buffer = readFile(temporaryPath);
+    if (buffer.data == NULL) {
+        fprintf(stderr, "w2c2: failed to read cache file %s\n", temporaryPath);
+        return false;
+    }
+    if (fwrite(buffer.data, 1, buffer.length, file) != buffer.length) {
+        fprintf(stderr, "w2c2: failed to write function: %s\n", strerror(errno));
+        free(buffer.data);
+        return false;
+    }
+    free(buffer.data);
+
+    path = wasmCCachePath(cache, key, ".c");
+    if (path == NULL || rename(temporaryPath, path) != 0) {
+        /* The cache is best-effort, e.g. another process might have created the entry */
+        remove(temporaryPath);
+    }
+    free(path);
+
+    return true;
+}
+
+/*
+ * wasmCCacheCreate creates the temporary file for the cache entry with the given key.
+ * The file is unique, as the same entry might be written concurrently by threads of this process.
+ * Returns NULL if the file cannot be created, in which case the function is not cached
+ */
+static
+FILE*
+wasmCCacheCreate(
+    const WasmCCache* cache,
+    const U8* key,
+    const U32 uniqueIndex,
+    char** temporaryPath
+) {
+    FILE* file = NULL;
+
+#if HAS_MKSTEMP
+    int descriptor = -1;
+
+    (void)uniqueIndex;
+
+    *temporaryPath = wasmCCachePath(cache, key, ".XXXXXX");
+    if (*temporaryPath == NULL) {
+        return NULL;
+    }
+
+    descriptor = mkstemp(*temporaryPath);
+    if (descriptor >= 0) {
+        file = fdopen(descriptor, "wb");
+        if (file == NULL) {
+            close(descriptor);
+            remove(*temporaryPath);
+        }
+    }
+#else
+    char suffix[48];
+
+#if HAS_UNISTD
+    sprintf(suffix, ".%ld.%lu.tmp", (long)getpid(), (unsigned long)uniqueIndex);
+#else
+    sprintf(suffix, ".%lu.tmp", (unsigned long)uniqueIndex);
+#endif /* HAS_UNISTD */
+
+    *temporaryPath = wasmCCachePath(cache, key, suffix);
+    if (*temporaryPath == NULL) {
+        return NULL;
+    }
+
+    file = fopen(*temporaryPath, "wb");
+#endif /* HAS_MKSTEMP */
+
+    if (file == NULL) {
+        free(*temporaryPath);
+        *temporaryPath = NULL;
+    }
+    return file;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteFunctionImplementations(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    WasmDebugLines* debugLines,
+    const U32 startIDIndex,
+    const U32 endIDIndex,
+    const WasmFunctionIDs functionIDs,
+    const bool pretty,
+    const bool debug,
+    const bool multipleModules,
+    const bool* instanceParameters,
+    const WasmBoundsCheckMode boundsCheckMode,
+    const bool cacheMemoryBase,
+    const bool cacheGlobals,
+    const bool foldExpressions,
+    const WasmCCache* cache
+) {
+    const size_t functionImportCount = module->functionImports.length;
+
+    /* The bodies of all functions are generated into the same string builder, to reuse its memory */
+    StringBuilder stringBuilder = emptyStringBuilder;
+    WasmTypeStack typeStack = wasmEmptyTypeStack;
+    WasmTypeStack stackDeclarations = wasmEmptyTypeStack;
+    WasmLabelStack labelStack = wasmEmptyLabelStack;
+    WasmCode code = wasmEmptyCode;
+    WasmCExpressionFolder folder = wasmCEmptyExpressionFolder;
+    WasmCGlobalCache globalCache = wasmCEmptyGlobalCache;
+    WasmDataflow dataflow = wasmEmptyDataflow;
+    WasmCStackCoalescer coalescer = wasmCEmptyStackCoalescer;
+
+    U32 functionIDIndex = startIDIndex;
+    for (; functionIDIndex < endIDIndex; functionIDIndex++) {
+        const WasmFunctionID functionID = functionIDs.functionIDs[functionIDIndex];
+        const U32 functionIndex = functionID.functionIndex;
+        const WasmFunction function = module->functions.functions[functionIndex];
+
+        wasmTypeStackClear(&typeStack);
+        wasmTypeStackClear(&stackDeclarations);
+        wasmLabelStackClear(&labelStack);
+
+        if (debug) {
+            const WasmDebugLine* debugLine = wasmCGetDebugLine(debugLines, function.start);
+            if (debugLine != NULL) {
+                fprintf(file, "#line %u \"%s\"\n", (U32)debugLine->number, debugLine->path);
+            }
+        }
+
+        wasmCWriteFileFunctionSignature(
+            file,
+            module,
+            moduleName,
+            function,
+            assertSizeU32(functionImportCount) + functionIndex,
+            true,
+            wasmCFunctionHasInstanceParameter(
+                module,
+                instanceParameters,
+                assertSizeU32(functionImportCount) + functionIndex
+            ),
+            pretty,
+            multipleModules
+        );
+        fputc(' ', file);
+
+        {
+            const U32 moduleFunctionIndex = assertSizeU32(functionImportCount) + functionIndex;
+            U8 cacheKey[SHA1_DIGEST_LENGTH];
+            FILE* cacheFile = NULL;
+            char* cacheFilePath = NULL;
+
+            MUST (wasmCodeDecode(module, function, &code))
+
+            if (cache != NULL) {
+                wasmCCacheFunctionKey(cache, module, function, moduleFunctionIndex, &code, instanceParameters, cacheKey);
+                if (wasmCCacheRead(cache, cacheKey, file)) {
+                    fputs("\n", file);
+                    continue;
+                }
+                /* Jobs write disjoint ranges of functions, so the start index is unique within this process */
+                cacheFile = wasmCCacheCreate(cache, cacheKey, startIDIndex, &cacheFilePath);
+            }
+
+            MUST (wasmCWriteFunctionBody(
+                cacheFile != NULL ? cacheFile : file,
+                &stringBuilder,
+                &typeStack,
+                &stackDeclarations,
+                &labelStack,
+                module,
+                moduleName,
+                function,
+                moduleFunctionIndex,
+                &code,
+                debugLines,
+                pretty,
+                debug,
+                multipleModules,
+                instanceParameters,
+                boundsCheckMode,
+                cacheMemoryBase,
+                cacheGlobals ? &globalCache : NULL,
+                /* Folded code has no instruction boundaries for #line directives */
+                foldExpressions && !debug ? &folder : NULL,
+                &dataflow,
+                /* Keep the stack variables of the code in debug information */
+                debug ? NULL : &coalescer
+            ))
+
+            if (cacheFile != NULL) {
+                const bool result = wasmCCacheWrite(cache, cacheKey, file, cacheFile, cacheFilePath);
+                free(cacheFilePath);
+                MUST (result)
+            }
+        }
+
+        fputs("\n", file);
+    }
+
+    stringBuilderFree(&stringBuilder);
+    wasmTypeStackFree(&typeStack);
+    wasmTypeStackFree(&stackDeclarations);
+    wasmLabelsFree(&labelStack.labels);
+    wasmCodeFree(&code);
+    wasmCFoldedValuesFree(&folder.values);
+    wasmCGlobalUsesArrayFree(&globalCache.uses);
+    wasmCCachedGlobalIndicesFree(&globalCache.indices);
+    wasmCGlobalCacheBlocksFree(&globalCache.blocks);
+    wasmDataflowFree(&dataflow);
+    wasmCStackVariablesFree(&coalescer.variables);
+    wasmCStackVariableIndicesFree(&coalescer.order);
+    wasmCLoopParametersFree(&coalescer.loopParameters);
+
+    return true;
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteGlobalImportType(
+    FILE* file,
+    const WasmGlobalImport import
+) {
+    fputs(valueTypeNames[import.globalType.valueType], file);
+    fputc('*', file);
+}
+
+static
+void
+wasmCWriteGlobalImports(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    const size_t globalImportCount = module->globalImports.length;
+    U32 globalIndex = 0;
+    for (; globalIndex < globalImportCount; globalIndex++) {
+        const WasmGlobalImport import = module->globalImports.imports[globalIndex];
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        wasmCWriteGlobalImportType(file, import);
+        if (pretty) {
+            fputc(' ', file);
+        }
+        wasmCWriteFileImportName(file, import.module, import.name);
+        fputs(";\n", file);
+    }
+}
+
+static
+void
+wasmCWriteGlobals(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    const size_t globalImportCount = module->globalImports.length;
+    const U32 globalCount = module->globals.count;
+
+    U32 globalIndex = 0;
+    for (; globalIndex < globalCount; globalIndex++) {
+        const WasmGlobal global = module->globals.globals[globalIndex];
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs(valueTypeNames[global.type.valueType], file);
+        fputc(' ', file);
+        wasmCWriteFileGlobalNonImportName(file, assertSizeU32(globalImportCount) + globalIndex);
+        fputs(";\n", file);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteConstantExpr(
+    StringBuilder* builder,
+    const WasmModule* module,
+    Buffer code
+) {
+    WasmOpcode opcode;
+    MUST (wasmOpcodeRead(&code, &opcode))
+    switch (opcode) {
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeF32Const:
+        case wasmOpcodeF64Const: {
+            const WasmValueType resultType = wasmOpcodeResultType(opcode);
+            WasmConstInstruction instruction;
+            if (!wasmConstInstructionRead(&code, opcode, &instruction)) {
+                fprintf(stderr, "w2c2: invalid const instruction encoding\n");
+                return false;
+            }
+            MUST (wasmCWriteLiteral(builder, resultType, instruction.value))
+            break;
+        }
+        case wasmOpcodeGlobalGet: {
+            WasmGlobalInstruction instruction;
+            MUST (wasmGlobalInstructionRead(&code, &instruction))
+            MUST (wasmCWriteStringGlobalUse(builder, module, instruction.globalIndex, false))
+            break;
+        }
+        case wasmOpcodeSIMDPrefix: {
+            WasmSIMDOpcode simdOpcode = 0;
+            WasmV128ConstInstruction instruction;
+            MUST (leb128ReadU32(&code, (U32*)&simdOpcode) > 0)
+            if (simdOpcode != wasmSIMDOpcodeV128Const
+                || !wasmV128ConstInstructionRead(&code, &instruction)
+            ) {
+                fprintf(stderr, "w2c2: invalid v128.const init expression\n");
+                return false;
+            }
+            MUST (wasmCWriteV128Literal(builder, instruction.bytes))
+            break;
+        }
+        default: {
+            fprintf(stderr, "w2c2: invalid init expression instruction %s\n", wasmOpcodeDescription(opcode));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitGlobals(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const bool pretty
+) {
+    const size_t globalImportCount = module->globalImports.length;
+    const U32 globalCount = module->globals.count;
+
+    if (globalCount > 0) {
+        StringBuilder stringBuilder = emptyStringBuilder;
+        MUST (stringBuilderInitialize(&stringBuilder))
+
+        fprintf(file, "static void %sInitGlobals(%sInstance* i) {\n", moduleName, moduleName);
+
+        {
+            U32 globalIndex = 0;
+            for (; globalIndex < globalCount; globalIndex++) {
+                const WasmGlobal global = module->globals.globals[globalIndex];
+
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                wasmCWriteFileGlobalUse(file, module, assertSizeU32(globalImportCount) + globalIndex, false);
+                if (pretty) {
+                    fputs(" = ", file);
+                } else {
+                    fputc('=', file);
+                }
+                {
+                    const Buffer code = global.init;
+                    MUST (stringBuilderReset(&stringBuilder))
+
+                    MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
+                    fputs(stringBuilder.string, file);
+                }
+                fputs(";\n", file);
+            }
+        }
+
+        fputs("}\n\n", file);
+
+        stringBuilderFree(&stringBuilder);
+    }
+
+    return true;
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteInitImportAssignment(
+    FILE* file,
+    const char* module,
+    const char* name,
+    const bool pretty
+) {
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("i->", file);
+    wasmCWriteFileImportName(file, module, name);
+    if (pretty) {
+        fputs(" =\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+            fputs(indentation, file);
+        }
+    } else {
+        fputc('=', file);
+    }
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteInitImportValue(
+    FILE* file,
+    const char* module,
+    const char* name
+) {
+    fprintf(file, "resolve(\"%s\", \"%s\");\n", module, name);
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteFunctionImport(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmFunctionImport import,
+    const bool declaration,
+    const bool pretty,
+    const bool prefix
+) {
+    const WasmFunctionType functionType = module->functionTypes.functionTypes[import.functionTypeIndex];
+    wasmCWriteFileReturnType(file, functionType);
+    fputc(' ', file);
+    if (declaration) {
+        if (prefix) {
+            fputs(moduleName, file);
+            fputc('_', file);
+        }
+        wasmCWriteFileImportName(file, import.module, import.name);
+    }
+    wasmCWriteFileParameters(
+        file,
+        moduleName,
+        functionType,
+        false,
+        declaration,
+        true,
+        pretty
+    );
+}
+
+static
+void
+wasmCWriteInitGlobalImports(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    const size_t globalImportCount = module->globalImports.length;
+    U32 globalIndex = 0;
+    for (; globalIndex < globalImportCount; globalIndex++) {
+        const WasmGlobalImport import = module->globalImports.imports[globalIndex];
+        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
+        fputc('(', file);
+        wasmCWriteGlobalImportType(file, import);
+        fputc(')', file);
+        wasmCWriteInitImportValue(file, import.module, import.name);
+    }
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteMemoryType(
+    FILE* file
+) {
+    fputs("wasmMemory*", file);
+}
+
+static
+void
+wasmCWriteInitMemoryImports(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    const size_t memoryImportCount = module->memoryImports.length;
+
+    U32 memoryIndex = 0;
+    for (; memoryIndex < memoryImportCount; memoryIndex++) {
+        const WasmMemoryImport import = module->memoryImports.imports[memoryIndex];
+        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
+        fputc('(', file);
+        wasmCWriteMemoryType(file);
+        fputc(')', file);
+        wasmCWriteInitImportValue(file, import.module, import.name);
+    }
+}
+
+static
+W2C2_INLINE
+void
+wasmCWriteTableType(
+    FILE* file
+) {
+    fputs("wasmTable*", file);
+}
+
+static
+void
+wasmCWriteInitTableImports(
+    FILE* file,
+    const WasmModule* module,
+    const bool pretty
+) {
+    const size_t tableImportCount = module->tableImports.length;
+
+    U32 tableIndex = 0;
+    for (; tableIndex < tableImportCount; tableIndex++) {
+        const WasmTableImport import = module->tableImports.imports[tableIndex];
+        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
+        fputc('(', file);
+        wasmCWriteTableType(file);
+        fputc(')', file);
+        wasmCWriteInitImportValue(file, import.module, import.name);
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitImports(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const bool pretty
+) {
+    fprintf(
+        file,
+        "static void %sInitImports(%sInstance* i, void* resolve(const char* module, const char* name)) {\n",
+        moduleName,
+        moduleName
+    );
+    if (pretty) {
+        fputs(indentation, file);
     }
+    fputs("if (resolve == NULL) { return; }\n", file);
+
+    wasmCWriteInitMemoryImports(file, module, pretty);
+    wasmCWriteInitTableImports(file, module, pretty);
+    wasmCWriteInitGlobalImports(file, module, pretty);
+
+    fputs("}\n\n", file);
 
     return true;
 }
 
 static
+W2C2_INLINE
 void
-wasmCWriteStackDeclarations(
+wasmCWriteExportName(
     FILE* file,
-    const WasmTypeStack* stackDeclarations,
-    const bool pretty
+    const char* moduleName,
+    const char* name
 ) {
-    WasmValueType testType = 0;
-    for (; testType < wasmValueType_count; testType++) {
-        U32 written = 0;
+    fprintf(file, "%s_", moduleName);
+    wasmCWriteFileEscaped(file, name);
+}
 
-        U32 stackDeclarationIndex = 0;
-        for (; stackDeclarationIndex < stackDeclarations->length; stackDeclarationIndex++) {
-            const WasmValueType entry = stackDeclarations->valueTypes[stackDeclarationIndex];
-            if (!entry) {
-                continue;
-            }
-            if (!wasmTypeStackIsSet(stackDeclarations, stackDeclarationIndex, testType)) {
-                continue;
-            }
-            if (written == 0) {
-                if (pretty) {
-                    fputs(indentation, file);
-                }
-                fputs(valueTypeNames[testType], file);
-                fputc(' ', file);
-            } else {
+static
+void
+wasmCWriteFunctionExport(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmExport export,
+    const WasmFunctionType functionType,
+    const bool writeBody,
+    const bool singleInstance,
+    const bool pretty,
+    const bool multipleModules
+) {
+    const U32 parameterCount = functionType.parameterCount;
+
+    wasmCWriteFileReturnType(file, functionType);
+    fputc(' ', file);
+    wasmCWriteExportName(file, moduleName, export.name);
+    wasmCWriteFileParameters(
+        file,
+        moduleName,
+        functionType,
+        true,
+        false,
+        true,
+        pretty
+    );
+    if (writeBody) {
+        if (pretty) {
+            fputc(' ', file);
+        }
+        fputs("{\n", file);
+        if (singleInstance) {
+            wasmCWriteFileSingleInstanceSelection(file, moduleName, pretty);
+        }
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        if (functionType.resultCount > 0) {
+            fputs("return ", file);
+        }
+        wasmCWriteFileFunctionUse(file, module, moduleName, export.index, false, multipleModules);
+        fputs("(i", file);
+        {
+            U32 parameterIndex = 0;
+            for (; parameterIndex < parameterCount; parameterIndex++) {
                 if (pretty) {
                     fputs(", ", file);
                 } else {
                     fputc(',', file);
                 }
+                wasmCWriteFileLocalName(file, parameterIndex);
             }
-
-            wasmCWriteFileStackName(file, stackDeclarationIndex, testType);
-
-            written++;
-        }
-
-        if (written > 0) {
-            fputs(";\n", file);
         }
+        fputs(");\n}\n\n", file);
+    } else {
+        fputs(";\n\n", file);
     }
 }
 
 static
-bool
-WARN_UNUSED_RESULT
-wasmCWriteFunctionReturn(
-    const WasmCFunctionWriter* writer,
-    const WasmFunctionType functionType
+void
+wasmCWriteMemoryExport(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const WasmExport export,
+    const bool writeBody,
+    const bool singleInstance,
+    const bool pretty
 ) {
-    if (!functionType.resultCount) {
-        return true;
+    wasmCWriteMemoryType(file);
+    if (pretty) {
+        fputc(' ', file);
     }
-
-    if (writer->stackDeclarations->length > 0) {
-        /* TODO: add support for multiple result values */
-        const WasmValueType returnType = functionType.resultTypes[0];
-        wasmTypeStackClear(writer->typeStack);
-        MUST (wasmTypeStackAppend(writer->typeStack, returnType))
-
-        {
-            const U32 stackIndex0 = wasmTypeStackGetTopIndex(writer->typeStack, 0);
-
-            MUST (wasmTypeStackSet(writer->stackDeclarations, stackIndex0, returnType))
-
-            MUST (wasmCWriteIndent(writer))
-            MUST (wasmCWrite(writer, "return "))
-            MUST (wasmCWriteStringStackName(writer->builder, stackIndex0, returnType))
-            MUST (wasmCWrite(writer, ";\n"))
+    wasmCWriteExportName(file, moduleName, export.name);
+    fprintf(file, "(%sInstance* i)", moduleName);
+    if (writeBody) {
+        if (pretty) {
+            fputc(' ', file);
+        }
+        fputs("{\n", file);
+        if (singleInstance) {
+            wasmCWriteFileSingleInstanceSelection(file, moduleName, pretty);
+        }
+        if (pretty) {
+            fputs(indentation, file);
         }
+        fputs("return ", file);
+        wasmCWriteFileMemoryUse(file, module, export.index, NULL, true);
+        fputs(";\n}\n\n", file);
+    } else {
+        fputs(";\n\n", file);
     }
-
-    return true;
 }
 
 static
-bool
-WARN_UNUSED_RESULT
-wasmCWriteFunctionBody(
+void
+wasmCWriteExports(
     FILE* file,
-    WasmTypeStack* typeStack,
-    WasmTypeStack* stackDeclarations,
-    WasmLabelStack* labelStack,
     const WasmModule* module,
     const char* moduleName,
-    const WasmFunction function,
-    WasmDebugLines* debugLines,
+    const bool writeBody,
+    const bool singleInstance,
     const bool pretty,
-    const bool debug,
     const bool multipleModules
 ) {
-    Buffer code = function.code;
-    StringBuilder stringBuilder = emptyStringBuilder;
-    WasmOpcode opcode = wasmOpcodeUnreachable;
-    WasmLabel label = wasmEmptyLabel;
-    WasmValueType* resultType = NULL;
-
-    const WasmFunctionType functionType =
-        module->functionTypes.functionTypes[function.functionTypeIndex];
+    const size_t functionImportCount = module->functionImports.length;
+    const U32 exportCount = module->exports.count;
 
-    if (functionType.resultCount) {
-        resultType = &functionType.resultTypes[0];
-        /* TODO: add support for multiple result values */
-        if (functionType.resultCount > 1) {
-            fprintf(stderr, "w2c2: function with multiple return values\n");
-            return false;
+    U32 exportIndex = 0;
+    for (; exportIndex < exportCount; exportIndex++) {
+        const WasmExport export = module->exports.exports[exportIndex];
+        switch (export.kind) {
+            case wasmExportKindFunction: {
+                WasmFunctionType functionType = wasmEmptyFunctionType;
+                U32 functionTypeIndex = 0;
+                if (export.index < functionImportCount) {
+                    const WasmFunctionImport import = module->functionImports.imports[export.index];
+                    functionTypeIndex = import.functionTypeIndex;
+                } else {
+                    const WasmFunction function = module->functions.functions[export.index - functionImportCount];
+                    functionTypeIndex = function.functionTypeIndex;
+                }
+                functionType = module->functionTypes.functionTypes[functionTypeIndex];
+                wasmCWriteFunctionExport(
+                    file,
+                    module,
+                    moduleName,
+                    export,
+                    functionType,
+                    writeBody,
+                    singleInstance,
+                    pretty,
+                    multipleModules
+                );
+                break;
+            }
+            case wasmExportKindMemory: {
+                wasmCWriteMemoryExport(file, module, moduleName, export, writeBody, singleInstance, pretty);
+                break;
+            }
+            default: {
+                /* TODO: other export kinds */
+                fprintf(
+                    stderr,
+                    "w2c2: unsupported export: %s (%s)\n",
+                    export.name,
+                    wasmExportKindDescription(export.kind)
+                );
+            }
         }
-    } else {
-        resultType = NULL;
     }
+}
 
-    MUST (stringBuilderInitialize(&stringBuilder))
+/*
+ * WasmCDataSegmentImage is the layout of the data segments file when it starts with an image
+ * of the first memory defined by the module: The leading active segments of the memory,
+ * which have constant offsets within its initial size, are placed at their offsets.
+ * The image covers the WebAssembly pages from the first to the last of these segments,
+ * so it can be mapped into the memory, and is followed by the remaining segments.
+ */
+typedef struct WasmCDataSegmentImage {
+    U32 memoryIndex;
+    /* Address in the memory the image starts at */
+    U64 start;
+    /* Length of the image, 0 if there is no image */
+    U64 length;
+    /* Whether each data segment is part of the image */
+    bool* segmentsInImage;
+    /* Offset of each data segment in the data segments file */
+    U64* segmentOffsets;
+} WasmCDataSegmentImage;
 
-    {
-        WasmCFunctionWriter writer;
-        writer.builder = &stringBuilder;
-        writer.typeStack = typeStack;
-        writer.stackDeclarations = stackDeclarations;
-        writer.labelStack = labelStack;
-        writer.module = module;
-        writer.moduleName = moduleName;
-        writer.function = function;
-        writer.code = &code;
-        writer.indent = 0;
-        writer.ignore = false;
-        writer.pretty = pretty;
-        writer.debug = debug;
-        writer.multipleModules = multipleModules;
-        writer.debugLines = debugLines;
+static const WasmCDataSegmentImage wasmCEmptyDataSegmentImage = {0, 0, 0, NULL, NULL};
 
-        MUST (wasmLabelStackPush(writer.labelStack, 0, resultType, &label))
-        MUST (wasmCWriteFunctionCode(&writer, &opcode))
-        MUST (wasmCWriteLabel(&writer, label.index))
-        MUST (wasmCWriteFunctionReturn(&writer, functionType))
+static
+bool
+wasmCDataSegmentConstantOffset(
+    Buffer code,
+    U64* result
+) {
+    WasmOpcode opcode;
+    WasmConstInstruction instruction;
+    if (!wasmOpcodeRead(&code, &opcode)
+        || opcode != wasmOpcodeI32Const
+        || !wasmConstInstructionRead(&code, opcode, &instruction)
+    ) {
+        return false;
     }
-
-    fputs("{\n", file);
-    wasmCWriteFileLocalsDeclarations(file, module, function, pretty);
-    wasmCWriteStackDeclarations(file, stackDeclarations, pretty);
-    fputs(stringBuilder.string, file);
-    fputs("}\n", file);
-
-    stringBuilderFree(&stringBuilder);
-
+    *result = (U64) (U32) instruction.value.i32;
     return true;
 }
 
+/*
+ * wasmCLayOutDataSegments determines the offsets of the data segments in the data segments file.
+ * If the image is not enabled, the segments are placed one after another.
+ */
 static
-void
-wasmCWriteFileParameters(
-    FILE* file,
-    const char* moduleName,
-    const WasmFunctionType functionType,
-    const bool writeParameterNames,
-    const bool voidPointerInstanceType,
-    const bool pretty
+bool
+WARN_UNUSED_RESULT
+wasmCLayOutDataSegments(
+    const WasmModule* module,
+    const bool imageEnabled,
+    WasmCDataSegmentImage* image
 ) {
-    fputc('(', file);
-    if (voidPointerInstanceType) {
-        fputs("void*", file);
+    const U32 dataSegmentCount = module->dataSegments.count;
+    const U32 memoryIndex = assertSizeU32(module->memoryImports.length);
+    bool mayAddToImage = imageEnabled
+        && module->memories.count > 0
+        && !module->memories.memories[0].shared;
+    U64 imageEnd = 0;
+    U64 byteOffset = 0;
+    U32 dataSegmentIndex = 0;
+
+    *image = wasmCEmptyDataSegmentImage;
+    image->memoryIndex = memoryIndex;
+    image->start = (U64) -1;
+
+    if (dataSegmentCount == 0) {
+        image->start = 0;
+        return true;
+    }
+
+    image->segmentsInImage = calloc(dataSegmentCount, sizeof(bool));
+    image->segmentOffsets = calloc(dataSegmentCount, sizeof(U64));
+    if (image->segmentsInImage == NULL || image->segmentOffsets == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate data segment layout\n");
+        free(image->segmentsInImage);
+        free(image->segmentOffsets);
+        *image = wasmCEmptyDataSegmentImage;
+        return false;
+    }
+
+    for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+        const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+        const U64 initialSize = mayAddToImage
+            ? (U64) module->memories.memories[0].min * WASM_PAGE_SIZE
+            : 0;
+        U64 address = 0;
+
+        /* Empty segments do not change the memory, so they do not need to be ordered either */
+        if (!mayAddToImage
+            || dataSegment.offset.data == NULL
+            || dataSegment.memoryIndex != memoryIndex
+            || dataSegment.bytes.length == 0
+        ) {
+            continue;
+        }
+
+        /* Later segments may overwrite this one, so they must be loaded after it, too */
+        if (!wasmCDataSegmentConstantOffset(dataSegment.offset, &address)
+            || address + dataSegment.bytes.length > initialSize
+        ) {
+            mayAddToImage = false;
+            continue;
+        }
+
+        image->segmentsInImage[dataSegmentIndex] = true;
+        image->segmentOffsets[dataSegmentIndex] = address;
+        if (address < image->start) {
+            image->start = address;
+        }
+        if (address + dataSegment.bytes.length > imageEnd) {
+            imageEnd = address + dataSegment.bytes.length;
+        }
+    }
+
+    if (imageEnd == 0) {
+        image->start = 0;
     } else {
-        fputs(moduleName, file);
-        fputs("Instance*", file);
+        image->start -= image->start % WASM_PAGE_SIZE;
+        image->length = (imageEnd + WASM_PAGE_SIZE - 1) / WASM_PAGE_SIZE * WASM_PAGE_SIZE - image->start;
     }
 
-    if (writeParameterNames) {
-        if (pretty) {
-            fputs(" i", file);
+    byteOffset = image->length;
+    for (dataSegmentIndex = 0; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+        if (image->segmentsInImage[dataSegmentIndex]) {
+            image->segmentOffsets[dataSegmentIndex] -= image->start;
         } else {
-            fputc('i', file);
-        }
-    }
-    {
-        U32 parameterIndex = 0;
-        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
-            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
-            const char* parameterTypeName = valueTypeNames[parameterType];
-            if (pretty) {
-                fputs(", ", file);
-            } else {
-                fputc(',', file);
-            }
-            fputs(parameterTypeName, file);
-            if (writeParameterNames) {
-                fputc(' ', file);
-                wasmCWriteFileLocalName(file, parameterIndex);
-            }
+            image->segmentOffsets[dataSegmentIndex] = byteOffset;
+            byteOffset += module->dataSegments.dataSegments[dataSegmentIndex].bytes.length;
         }
     }
-    fputc(')', file);
-}
 
+    return true;
+}
 
 static
 void
-wasmCWriteFileFunctionSignature(
-    FILE* file,
-    const WasmModule* module,
-    const char* moduleName,
-    const WasmFunction function,
-    const U32 functionIndex,
-    const bool writeParameterNames,
-    const bool pretty,
-    const bool prefix
+wasmCDataSegmentImageFree(
+    WasmCDataSegmentImage* image
 ) {
-    const WasmFunctionType functionType =
-        module->functionTypes.functionTypes[function.functionTypeIndex];
-
-    fputs(wasmCGetReturnType(functionType), file);
-    fputc(' ', file);
-    if (prefix) {
-        fputs(moduleName, file);
-        fputc('_', file);
-    }
-    wasmCWriteFileFunctionNonImportName(file, functionIndex);
-    wasmCWriteFileParameters(
-        file,
-        moduleName,
-        functionType,
-        writeParameterNames,
-        false,
-        pretty
-    );
+    free(image->segmentsInImage);
+    free(image->segmentOffsets);
+    *image = wasmCEmptyDataSegmentImage;
 }
 
+/* TODO: add support for multiple modules */
 static
 void
-wasmCWriteFunctionDeclarations(
+wasmCWriteDataSegments(
     FILE* file,
     const WasmModule* module,
-    const char* moduleName,
-    const bool pretty,
-    const bool debug,
-    const bool multipleModules
+    const WasmDataSegmentMode mode,
+    const bool pretty
 ) {
-    const size_t functionImportCount = module->functionImports.length;
-    const U32 functionCount = module->functions.count;
+    const U32 dataSegmentCount = module->dataSegments.count;
 
-    U32 declaredFunctionIndex = 0;
-    for (; declaredFunctionIndex < functionCount; declaredFunctionIndex++) {
-        const WasmFunction function = module->functions.functions[declaredFunctionIndex];
-        const U32 moduleFunctionIndex = assertSizeU32(functionImportCount) + declaredFunctionIndex;
-        wasmCWriteFileFunctionSignature(
-            file,
-            module,
-            moduleName,
-            function,
-            moduleFunctionIndex,
-            false,
-            pretty,
-            multipleModules
-        );
+    {
+        U32 dataSegmentIndex = 0;
+        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+            const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
 
-        if (debug && function.exportName == NULL && moduleFunctionIndex < module->functionNames.length) {
-            char* functionName = module->functionNames.names[moduleFunctionIndex];
-            if (functionName != NULL) {
-                fprintf(file, " __asm__(\"%s_%s\")", moduleName, functionName);
+            switch (mode) {
+                case wasmDataSegmentModeArrays: {
+                    fputs("const U8 ", file);
+                    /* TODO: add support for multiple modules */
+                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+                    if (pretty) {
+                        fputs("[] = {\n", file);
+                    } else {
+                        fputs("[]={\n", file);
+                    }
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    {
+                        U32 byteIndex = 0;
+                        for (; byteIndex < dataSegment.bytes.length; byteIndex++) {
+                            fprintf(file, "0x%x", dataSegment.bytes.data[byteIndex]);
+                            if (pretty) {
+                                fputs(", ", file);
+                            } else {
+                                fputc(',', file);
+                            }
+                        }
+                    }
+                    fputs("\n};\n\n", file);
+                    break;
+                }
+                case wasmDataSegmentModeGNULD:
+                case wasmDataSegmentModeSectcreate1:
+                case wasmDataSegmentModeSectcreate2: {
+                    fputs("U8* ", file);
+                    /* TODO: add support for multiple modules */
+                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+                    fputs(";\n", file);
+                    break;
+                }
+                default: {
+                    fprintf(stderr, "w2c2: unsupported data segment mode: %d\n", mode);
+                    abort();
+                }
             }
         }
-        fputs(";\n\n", file);
     }
 }
 
 static
-bool
-WARN_UNUSED_RESULT
-wasmCWriteFunctionImplementations(
+void
+wasmCWriteDataSegmentsFromSection(
     FILE* file,
     const WasmModule* module,
-    const char* moduleName,
-    WasmDebugLines* debugLines,
-    const U32 startIDIndex,
-    const U32 endIDIndex,
-    const WasmFunctionIDs functionIDs,
-    const bool pretty,
-    const bool debug,
-    const bool multipleModules
+    const WasmDataSegmentMode mode,
+    const WasmCDataSegmentImage* image
 ) {
-    const size_t functionImportCount = module->functionImports.length;
-
-    WasmTypeStack typeStack = wasmEmptyTypeStack;
-    WasmTypeStack stackDeclarations = wasmEmptyTypeStack;
-    WasmLabelStack labelStack = wasmEmptyLabelStack;
-
-    U32 functionIDIndex = startIDIndex;
-    for (; functionIDIndex < endIDIndex; functionIDIndex++) {
-        const WasmFunctionID functionID = functionIDs.functionIDs[functionIDIndex];
-        const U32 functionIndex = functionID.functionIndex;
-        const WasmFunction function = module->functions.functions[functionIndex];
+    static const char* const filename = "datasegments";
+    const U32 dataSegmentCount = module->dataSegments.count;
 
-        wasmTypeStackClear(&typeStack);
-        wasmTypeStackClear(&stackDeclarations);
-        wasmLabelStackClear(&labelStack);
+    U32 dataSegmentIndex = 0;
+    FILE* segmentsFile = NULL;
 
-        if (debug) {
-            const WasmDebugLine* debugLine = wasmCGetDebugLine(debugLines, function.start);
-            if (debugLine != NULL) {
-                fprintf(file, "#line %u \"%s\"\n", (U32)debugLine->number, debugLine->path);
-            }
+    switch (mode) {
+        case wasmDataSegmentModeGNULD: {
+            fputs("extern char _binary_datasegments_start[];\n\n", file);
+            fputs("static char* ds = _binary_datasegments_start;\n", file);
+            break;
+        }
+        case wasmDataSegmentModeSectcreate1: {
+            fputs("extern char data_segments_data __asm(\"section$start$__DATA$__datasegments\");\n\n", file);
+            fputs("static char* ds = &data_segments_data;\n", file);
+            break;
+        }
+        case wasmDataSegmentModeSectcreate2: {
+            /*
+             * On Rhapsody, mach-o/getsect.h was added.
+             * On OPENSTEP, libc.h is needed.
+             */
+            fputs(
+                "#include <mach/mach.h>\n"
+                "#ifdef __MACH30__\n"
+                "#include <mach-o/getsect.h>\n"
+                "#define SECT_DATA_SIZE_TYPE unsigned long\n"
+                "#else\n"
+                "#include <libc.h>\n"
+                "#define SECT_DATA_SIZE_TYPE int\n"
+                "#endif\n",
+                file
+            );
+            fputs(
+                "SECT_DATA_SIZE_TYPE len = 0;\n"
+                "static char* ds = getsectdata(\"__DATA\", \"__datasegments\", &len);\n",
+                file
+            );
+            break;
+        }
+        default: {
+            fprintf(stderr, "w2c2: unsupported data segment mode: %d\n", mode);
+            abort();
         }
+    }
 
-        wasmCWriteFileFunctionSignature(
-            file,
-            module,
-            moduleName,
-            function,
-            assertSizeU32(functionImportCount) + functionIndex,
-            true,
-            pretty,
-            multipleModules
+    segmentsFile = fopen(filename, "wb");
+    if (segmentsFile == NULL) {
+        fprintf(
+            stderr,
+            "w2c2: failed to create data segments file %s: %s\n",
+            filename,
+            strerror(errno)
         );
-        fputc(' ', file);
-        MUST (wasmCWriteFunctionBody(
-            file,
-            &typeStack,
-            &stackDeclarations,
-            &labelStack,
-            module,
-            moduleName,
-            function,
-            debugLines,
-            pretty,
-            debug,
-            multipleModules
-        ))
-        fputs("\n", file);
+        abort();
     }
 
-    wasmTypeStackFree(&typeStack);
-    wasmTypeStackFree(&stackDeclarations);
-    wasmLabelsFree(&labelStack.labels);
+    if (image->length > 0) {
+        /* The parts of the image not covered by segments are zero, like the rest of the memory */
+        U8* imageData = calloc((size_t) image->length, 1);
+        size_t written = 0;
+        if (imageData == NULL) {
+            fprintf(stderr, "w2c2: failed to allocate data segments image\n");
+            abort();
+        }
+        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+            const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+            if (image->segmentsInImage[dataSegmentIndex]) {
+                memcpy(
+                    imageData + image->segmentOffsets[dataSegmentIndex],
+                    dataSegment.bytes.data,
+                    dataSegment.bytes.length
+                );
+            }
+        }
+        written = fwrite(imageData, 1, (size_t) image->length, segmentsFile);
+        free(imageData);
+        if (written != image->length) {
+            fprintf(
+                stderr,
+                "w2c2: failed to write data segments image: %s",
+                strerror(errno)
+            );
+            abort();
+        }
+        fputs("static wasmMemoryImage dsi;\n", file);
+    }
 
-    return true;
-}
+    for (dataSegmentIndex = 0; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+        const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+        const size_t length = dataSegment.bytes.length;
+        size_t written = 0;
+        if (image->segmentsInImage[dataSegmentIndex]) {
+            continue;
+        }
+        written = fwrite(dataSegment.bytes.data, 1, length, segmentsFile);
+        if (written != length) {
+            fprintf(
+                stderr,
+                "w2c2: failed to write data segment %u: %s",
+                dataSegmentIndex,
+                strerror(errno)
+            );
+            abort();
+        }
+    }
 
-static
-W2C2_INLINE
-void
-wasmCWriteGlobalImportType(
-    FILE* file,
-    const WasmGlobalImport import
-) {
-    fputs(valueTypeNames[import.globalType.valueType], file);
-    fputc('*', file);
+    if (fclose(segmentsFile) != 0) {
+        fprintf(
+            stderr,
+            "w2c2: failed to close data segments file %s: %s",
+            filename,
+            strerror(errno)
+        );
+        abort();
+    }
 }
 
 static
 void
-wasmCWriteGlobalImports(
+wasmCWriteMemoryImports(
     FILE* file,
     const WasmModule* module,
     const bool pretty
 ) {
-    const size_t globalImportCount = module->globalImports.length;
-    U32 globalIndex = 0;
-    for (; globalIndex < globalImportCount; globalIndex++) {
-        const WasmGlobalImport import = module->globalImports.imports[globalIndex];
+    const size_t memoryImportCount = module->memoryImports.length;
+
+    U32 memoryIndex = 0;
+    for (; memoryIndex < memoryImportCount; memoryIndex++) {
+        const WasmMemoryImport import = module->memoryImports.imports[memoryIndex];
         if (pretty) {
             fputs(indentation, file);
         }
-        wasmCWriteGlobalImportType(file, import);
+        wasmCWriteMemoryType(file);
         if (pretty) {
             fputc(' ', file);
         }
@@ -4673,60 +8865,101 @@ wasmCWriteGlobalImports(
 
 static
 void
-wasmCWriteGlobals(
+wasmCWriteMemories(
     FILE* file,
     const WasmModule* module,
     const bool pretty
 ) {
-    const size_t globalImportCount = module->globalImports.length;
-    const U32 globalCount = module->globals.count;
+    const size_t memoryImportCount = module->memoryImports.length;
+    const U32 memoryCount = module->memories.count;
 
-    U32 globalIndex = 0;
-    for (; globalIndex < globalCount; globalIndex++) {
-        const WasmGlobal global = module->globals.globals[globalIndex];
+    U32 memoryIndex = 0;
+    for (; memoryIndex < memoryCount; memoryIndex++) {
+        U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
         if (pretty) {
             fputs(indentation, file);
         }
-        fputs(valueTypeNames[global.type.valueType], file);
-        fputc(' ', file);
-        wasmCWriteFileGlobalNonImportName(file, assertSizeU32(globalImportCount) + globalIndex);
+        fputs("wasmMemory* ", file);
+        wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
         fputs(";\n", file);
     }
 }
 
+/*
+ * wasmCWriteLoadDataSegments writes the loading of the active data segments,
+ * either from the data segment image, or copied by LOAD_DATA
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteConstantExpr(
-    StringBuilder* builder,
+wasmCWriteLoadDataSegments(
+    FILE* file,
     const WasmModule* module,
-    Buffer code
+    const WasmDataSegmentMode dataSegmentMode,
+    const WasmCDataSegmentImage* image,
+    StringBuilder* stringBuilder,
+    const bool pretty
 ) {
-    WasmOpcode opcode;
-    MUST (wasmOpcodeRead(&code, &opcode))
-    switch (opcode) {
-        case wasmOpcodeI32Const:
-        case wasmOpcodeI64Const:
-        case wasmOpcodeF32Const:
-        case wasmOpcodeF64Const: {
-            const WasmValueType resultType = wasmOpcodeResultType(opcode);
-            WasmConstInstruction instruction;
-            if (!wasmConstInstructionRead(&code, opcode, &instruction)) {
-                fprintf(stderr, "w2c2: invalid const instruction encoding\n");
-                return false;
-            }
-            MUST (wasmCWriteLiteral(builder, resultType, instruction.value))
-            break;
-        }
-        case wasmOpcodeGlobalGet: {
-            WasmGlobalInstruction instruction;
-            MUST (wasmGlobalInstructionRead(&code, &instruction))
-            MUST (wasmCWriteStringGlobalUse(builder, module, instruction.globalIndex, false))
-            break;
+    if (image->length > 0) {
+        if (pretty) {
+            fputs(indentation, file);
         }
-        default: {
-            fprintf(stderr, "w2c2: invalid init expression instruction %s\n", wasmOpcodeDescription(opcode));
-            return false;
+        fputs("wasmMemoryLoadImage(", file);
+        wasmCWriteFileMemoryUse(file, module, image->memoryIndex, NULL, true);
+        fprintf(
+            file,
+            ", &dsi, %llu, (const U8*) ds, %llu);\n",
+            (unsigned long long) image->start,
+            (unsigned long long) image->length
+        );
+    }
+
+    {
+        const U32 dataSegmentCount = module->dataSegments.count;
+        U32 dataSegmentIndex = 0;
+        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+            const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+            const size_t dataSegmentLength = dataSegment.bytes.length;
+            const Buffer code = dataSegment.offset;
+
+            switch (dataSegmentMode) {
+                case wasmDataSegmentModeGNULD:
+                case wasmDataSegmentModeSectcreate1:
+                case wasmDataSegmentModeSectcreate2: {
+                    /* TODO: add support for multiple modules */
+                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+                    if (pretty) {
+                        fprintf(file, " = ds + %llu", image->segmentOffsets[dataSegmentIndex]);
+                    } else {
+                        fprintf(file, "=ds+%llu", image->segmentOffsets[dataSegmentIndex]);
+                    }
+                    fputs(";\n", file);
+                    break;
+                }
+            }
+
+            /* Load active segments, unless they are part of the image */
+            if (code.data != NULL && !image->segmentsInImage[dataSegmentIndex]) {
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                fputs("LOAD_DATA(", file);
+                wasmCWriteFileMemoryUse(
+                        file,
+                        module,
+                        dataSegment.memoryIndex,
+                        NULL,
+                        false
+                );
+                fputs(", ", file);
+                MUST (stringBuilderReset(stringBuilder))
+                MUST (wasmCWriteConstantExpr(stringBuilder, module, code))
+                fputs(stringBuilder->string, file);
+                fputs(", ", file);
+                /* TODO: add support for multiple modules */
+                wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
+                fprintf(file, ", %lu);\n", (unsigned long) dataSegmentLength);
+            }
         }
     }
 
@@ -4736,915 +8969,1034 @@ wasmCWriteConstantExpr(
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteInitGlobals(
+wasmCWriteInitMemories(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
+    const WasmDataSegmentMode dataSegmentMode,
+    const WasmCDataSegmentImage* image,
     const bool pretty
 ) {
-    const size_t globalImportCount = module->globalImports.length;
-    const U32 globalCount = module->globals.count;
+    const size_t memoryImportCount = module->memoryImports.length;
+    const U32 memoryCount = module->memories.count;
+    if (memoryCount > 0) {
 
-    if (globalCount > 0) {
         StringBuilder stringBuilder = emptyStringBuilder;
         MUST (stringBuilderInitialize(&stringBuilder))
 
-        fprintf(file, "static void %sInitGlobals(%sInstance* i) {\n", moduleName, moduleName);
+        fprintf(
+            file,
+            "static void %sInitMemories(%sInstance* i, %sInstance* parent) {\n",
+            moduleName,
+            moduleName,
+            moduleName
+        );
 
         {
-            U32 globalIndex = 0;
-            for (; globalIndex < globalCount; globalIndex++) {
-                const WasmGlobal global = module->globals.globals[globalIndex];
+            U32 memoryIndex = 0;
+            for (; memoryIndex < memoryCount; memoryIndex++) {
+                const WasmMemory memory = module->memories.memories[memoryIndex];
+                U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
 
-                if (pretty) {
-                    fputs(indentation, file);
-                }
-                wasmCWriteFileGlobalUse(file, module, assertSizeU32(globalImportCount) + globalIndex, false);
-                if (pretty) {
-                    fputs(" = ", file);
+                if (memory.shared) {
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    fputs("if (parent == NULL) {\n", file);
+                    {
+                        if (pretty) {
+                            fputs(indentation, file);
+                            fputs(indentation, file);
+                        }
+                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
+                        fprintf(file, "= WASM_MEMORY_ALLOCATE_SHARED(%u, %u);\n", memory.min, memory.max);
+                    }
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    fputs("} else {\n", file);
+                    {
+                        if (pretty) {
+                            fputs(indentation, file);
+                            fputs(indentation, file);
+                        }
+                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
+                        fputs(" = ", file);
+                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, "parent", true);
+                        fputs(";\n", file);
+                    }
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    fputs("}\n", file);
                 } else {
-                    fputc('=', file);
-                }
-                {
-                    const Buffer code = global.init;
-                    MUST (stringBuilderReset(&stringBuilder))
-
-                    MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
-                    fputs(stringBuilder.string, file);
+                    if (pretty) {
+                        fputs(indentation, file);
+                    }
+                    wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
+                    fprintf(file, " = wasmMemoryAllocate(%u, %u, false);\n", memory.min, memory.max);
                 }
-                fputs(";\n", file);
-            }
-        }
-
-        fputs("}\n\n", file);
-
-        stringBuilderFree(&stringBuilder);
-    }
-
-    return true;
-}
-
-static
-W2C2_INLINE
-void
-wasmCWriteInitImportAssignment(
-    FILE* file,
-    const char* module,
-    const char* name,
-    const bool pretty
-) {
-    if (pretty) {
-        fputs(indentation, file);
-    }
-    fputs("i->", file);
-    wasmCWriteFileImportName(file, module, name);
-    if (pretty) {
-        fputs(" =\n", file);
-        if (pretty) {
-            fputs(indentation, file);
-            fputs(indentation, file);
-        }
-    } else {
-        fputc('=', file);
-    }
-}
-
-static
-W2C2_INLINE
-void
-wasmCWriteInitImportValue(
-    FILE* file,
-    const char* module,
-    const char* name
-) {
-    fprintf(file, "resolve(\"%s\", \"%s\");\n", module, name);
-}
-
-static
-W2C2_INLINE
-void
-wasmCWriteFunctionImport(
-    FILE* file,
-    const WasmModule* module,
-    const char* moduleName,
-    const WasmFunctionImport import,
-    const bool declaration,
-    const bool pretty,
-    const bool prefix
-) {
-    const WasmFunctionType functionType = module->functionTypes.functionTypes[import.functionTypeIndex];
-    fputs(wasmCGetReturnType(functionType), file);
-    fputc(' ', file);
-    if (declaration) {
-        if (prefix) {
-            fputs(moduleName, file);
-            fputc('_', file);
+            }
         }
-        wasmCWriteFileImportName(file, import.module, import.name);
+
+        MUST (wasmCWriteLoadDataSegments(file, module, dataSegmentMode, image, &stringBuilder, pretty))
+
+        fputs("}\n\n", file);
+
+        /* Resetting keeps the allocations of the memories, and loads the data segments again */
+        fprintf(file, "static void %sResetMemories(%sInstance* i) {\n", moduleName, moduleName);
+
+        {
+            U32 memoryIndex = 0;
+            for (; memoryIndex < memoryCount; memoryIndex++) {
+                const WasmMemory memory = module->memories.memories[memoryIndex];
+                U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
+
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                fputs("wasmMemoryReset(", file);
+                wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
+                fprintf(file, ", %u);\n", memory.min);
+            }
+        }
+
+        MUST (wasmCWriteLoadDataSegments(file, module, dataSegmentMode, image, &stringBuilder, pretty))
+
+        fputs("}\n\n", file);
+
+        stringBuilderFree(&stringBuilder);
     }
-    wasmCWriteFileParameters(
-        file,
-        moduleName,
-        functionType,
-        false,
-        declaration,
-        pretty
-    );
+    return true;
 }
 
 static
 void
-wasmCWriteInitGlobalImports(
+wasmCWriteFreeMemories(
     FILE* file,
     const WasmModule* module,
     const bool pretty
 ) {
-    const size_t globalImportCount = module->globalImports.length;
-    U32 globalIndex = 0;
-    for (; globalIndex < globalImportCount; globalIndex++) {
-        const WasmGlobalImport import = module->globalImports.imports[globalIndex];
-        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
-        fputc('(', file);
-        wasmCWriteGlobalImportType(file, import);
-        fputc(')', file);
-        wasmCWriteInitImportValue(file, import.module, import.name);
+    const size_t memoryImportCount = module->memoryImports.length;
+    const U32 memoryCount = module->memories.count;
+    U32 memoryIndex = 0;
+    for (; memoryIndex < memoryCount; memoryIndex++) {
+        U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs("wasmMemoryFree(", file);
+        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
+        fputs(");\n", file);
     }
 }
 
-static
-W2C2_INLINE
-void
-wasmCWriteMemoryType(
-    FILE* file
-) {
-    fputs("wasmMemory*", file);
-}
-
 static
 void
-wasmCWriteInitMemoryImports(
+wasmCWriteTableImports(
     FILE* file,
     const WasmModule* module,
     const bool pretty
 ) {
-    const size_t memoryImportCount = module->memoryImports.length;
+    const size_t tableImportCount = module->tableImports.length;
 
-    U32 memoryIndex = 0;
-    for (; memoryIndex < memoryImportCount; memoryIndex++) {
-        const WasmMemoryImport import = module->memoryImports.imports[memoryIndex];
-        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
-        fputc('(', file);
-        wasmCWriteMemoryType(file);
-        fputc(')', file);
-        wasmCWriteInitImportValue(file, import.module, import.name);
+    U32 tableIndex = 0;
+    for (; tableIndex < tableImportCount; tableIndex++) {
+        const WasmTableImport import = module->tableImports.imports[tableIndex];
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        wasmCWriteTableType(file);
+        if (pretty) {
+            fputc(' ', file);
+        }
+        wasmCWriteFileImportName(file, import.module, import.name);
+        fputs(";\n", file);
     }
 }
 
-static
-W2C2_INLINE
-void
-wasmCWriteTableType(
-    FILE* file
-) {
-    fputs("wasmTable*", file);
-}
-
 static
 void
-wasmCWriteInitTableImports(
+wasmCWriteTables(
     FILE* file,
     const WasmModule* module,
     const bool pretty
 ) {
     const size_t tableImportCount = module->tableImports.length;
+    const U32 tableCount = module->tables.count;
 
     U32 tableIndex = 0;
-    for (; tableIndex < tableImportCount; tableIndex++) {
-        const WasmTableImport import = module->tableImports.imports[tableIndex];
-        wasmCWriteInitImportAssignment(file, import.module, import.name, pretty);
-        fputc('(', file);
-        wasmCWriteTableType(file);
-        fputc(')', file);
-        wasmCWriteInitImportValue(file, import.module, import.name);
+    for (; tableIndex < tableCount; tableIndex++) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fputs("wasmTable ", file);
+        wasmCWriteFileTableNonImportName(file, assertSizeU32(tableImportCount) + tableIndex);
+        fputs(";\n", file);
     }
 }
 
+/*
+ * wasmCWriteLoadElementSegments writes the loading of the element segments into their tables.
+ * The offset variable must be declared if there are element segments
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteInitImports(
+wasmCWriteLoadElementSegments(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
-    const bool pretty
+    StringBuilder* stringBuilder,
+    const bool pretty,
+    const bool multipleModules
 ) {
-    fprintf(
-        file,
-        "static void %sInitImports(%sInstance* i, void* resolve(const char* module, const char* name)) {\n",
-        moduleName,
-        moduleName
-    );
-    if (pretty) {
-        fputs(indentation, file);
-    }
-    fputs("if (resolve == NULL) { return; }\n", file);
+    const U32 elementSegmentCount = module->elementSegments.count;
+    U32 elementSegmentIndex = 0;
 
-    wasmCWriteInitMemoryImports(file, module, pretty);
-    wasmCWriteInitTableImports(file, module, pretty);
-    wasmCWriteInitGlobalImports(file, module, pretty);
+    for (; elementSegmentIndex < elementSegmentCount; elementSegmentIndex++) {
+        const WasmElementSegment elementSegment = module->elementSegments.elementSegments[elementSegmentIndex];
 
-    fputs("}\n\n", file);
+        if (pretty) {
+            fputs(indentation, file);
+            fputs("offset = ", file);
+        } else {
+            fputs("offset=", file);
+        }
+        {
+            const Buffer code = elementSegment.offset;
+            MUST (stringBuilderReset(stringBuilder))
+            MUST (wasmCWriteConstantExpr(stringBuilder, module, code))
+            fputs(stringBuilder->string, file);
+        }
+        fputs(";\n", file);
 
-    return true;
-}
+        {
+            U32 functionIndexIndex = 0;
+            for (; functionIndexIndex < elementSegment.functionIndexCount; functionIndexIndex++) {
+                const U32 functionIndex = elementSegment.functionIndices[functionIndexIndex];
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                wasmCWriteFileTableUse(file, module, elementSegment.tableIndex, false);
+                if (pretty) {
+                    fprintf(file, ".data[offset + %u] = (wasmFunc)", functionIndexIndex);
+                } else {
+                    fprintf(file, ".data[offset+%u]=(wasmFunc)", functionIndexIndex);
+                }
+                wasmCWriteFileFunctionUse(file, module, moduleName, functionIndex, true, multipleModules);
+                fputs(";\n", file);
+            }
+        }
+    }
 
-static
-W2C2_INLINE
-void
-wasmCWriteExportName(
-    FILE* file,
-    const char* moduleName,
-    const char* name
-) {
-    fprintf(file, "%s_", moduleName);
-    wasmCWriteFileEscaped(file, name);
+    return true;
 }
 
 static
-void
-wasmCWriteFunctionExport(
+bool
+WARN_UNUSED_RESULT
+wasmCWriteInitTables(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
-    const WasmExport export,
-    const WasmFunctionType functionType,
-    const bool writeBody,
     const bool pretty,
     const bool multipleModules
 ) {
-    const U32 parameterCount = functionType.parameterCount;
+    const size_t tableImportCount = module->tableImports.length;
+    const U32 elementSegmentCount = module->elementSegments.count;
+    const U32 tableCount = module->tables.count;
+    if (tableCount > 0 || elementSegmentCount > 0) {
+        StringBuilder stringBuilder = emptyStringBuilder;
+        MUST (stringBuilderInitialize(&stringBuilder))
 
-    fputs(wasmCGetReturnType(functionType), file);
-    fputc(' ', file);
-    wasmCWriteExportName(file, moduleName, export.name);
-    wasmCWriteFileParameters(
-        file,
-        moduleName,
-        functionType,
-        true,
-        false,
-        pretty
-    );
-    if (writeBody) {
-        if (pretty) {
-            fputc(' ', file);
+        fprintf(file, "static void %sInitTables(%sInstance* i) {\n", moduleName, moduleName);
+
+        if (elementSegmentCount > 0) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("U32 offset;\n", file);
         }
-        fputs("{\n", file);
-        if (pretty) {
-            fputs(indentation, file);
+
+        {
+            U32 tableIndex = 0;
+            for (; tableIndex < tableCount; tableIndex++) {
+                const WasmTable table = module->tables.tables[tableIndex];
+
+                if (pretty) {
+                    fputs(indentation, file);
+                }
+                fputs("wasmTableAllocate(", file);
+                wasmCWriteFileTableUse(file, module, assertSizeU32(tableImportCount) + tableIndex, true);
+                fprintf(file, ", %u, %u);\n", table.min, table.max);
+            }
         }
-        if (functionType.resultCount > 0) {
-            fputs("return ", file);
+
+        MUST (wasmCWriteLoadElementSegments(file, module, moduleName, &stringBuilder, pretty, multipleModules))
+
+        fputs("}\n\n", file);
+
+        /* Resetting keeps the allocations of the tables, and loads the element segments again */
+        fprintf(file, "static void %sResetTables(%sInstance* i) {\n", moduleName, moduleName);
+
+        if (elementSegmentCount > 0) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fputs("U32 offset;\n", file);
         }
-        wasmCWriteFileFunctionUse(file, module, moduleName, export.index, false, multipleModules);
-        fputs("(i", file);
+
         {
-            U32 parameterIndex = 0;
-            for (; parameterIndex < parameterCount; parameterIndex++) {
+            U32 tableIndex = 0;
+            for (; tableIndex < tableCount; tableIndex++) {
                 if (pretty) {
-                    fputs(", ", file);
-                } else {
-                    fputc(',', file);
+                    fputs(indentation, file);
                 }
-                wasmCWriteFileLocalName(file, parameterIndex);
+                fputs("wasmTableReset(", file);
+                wasmCWriteFileTableUse(file, module, assertSizeU32(tableImportCount) + tableIndex, true);
+                fputs(");\n", file);
             }
         }
-        fputs(");\n}\n\n", file);
-    } else {
-        fputs(";\n\n", file);
+
+        MUST (wasmCWriteLoadElementSegments(file, module, moduleName, &stringBuilder, pretty, multipleModules))
+
+        fputs("}\n\n", file);
+
+        stringBuilderFree(&stringBuilder);
     }
+
+    return true;
 }
 
 static
 void
-wasmCWriteMemoryExport(
-    FILE* file,
-    const WasmModule* module,
-    const char* moduleName,
-    const WasmExport export,
-    const bool writeBody,
+wasmCWriteFreeTables(
+    FILE* file,
+    const WasmModule* module,
     const bool pretty
 ) {
-    wasmCWriteMemoryType(file);
-    if (pretty) {
-        fputc(' ', file);
-    }
-    wasmCWriteExportName(file, moduleName, export.name);
-    fprintf(file, "(%sInstance* i)", moduleName);
-    if (writeBody) {
-        if (pretty) {
-            fputc(' ', file);
-        }
-        fputs("{\n", file);
+    const size_t tableImportCount = module->tableImports.length;
+    const U32 tableCount = module->tables.count;
+    U32 tableIndex = 0;
+    for (; tableIndex < tableCount; tableIndex++) {
         if (pretty) {
             fputs(indentation, file);
         }
-        fputs("return ", file);
-        wasmCWriteFileMemoryUse(file, module, export.index, NULL, true);
-        fputs(";\n}\n\n", file);
-    } else {
-        fputs(";\n\n", file);
+        fputs("wasmTableFree(", file);
+        wasmCWriteFileTableUse(file, module, assertSizeU32(tableImportCount) + tableIndex, true);
+        fputs(");\n", file);
     }
 }
 
 static
 void
-wasmCWriteExports(
+wasmCWriteFunctionImports(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
-    const bool writeBody,
     const bool pretty,
     const bool multipleModules
 ) {
     const size_t functionImportCount = module->functionImports.length;
-    const U32 exportCount = module->exports.count;
-
-    U32 exportIndex = 0;
-    for (; exportIndex < exportCount; exportIndex++) {
-        const WasmExport export = module->exports.exports[exportIndex];
-        switch (export.kind) {
-            case wasmExportKindFunction: {
-                WasmFunctionType functionType = wasmEmptyFunctionType;
-                U32 functionTypeIndex = 0;
-                if (export.index < functionImportCount) {
-                    const WasmFunctionImport import = module->functionImports.imports[export.index];
-                    functionTypeIndex = import.functionTypeIndex;
-                } else {
-                    const WasmFunction function = module->functions.functions[export.index - functionImportCount];
-                    functionTypeIndex = function.functionTypeIndex;
-                }
-                functionType = module->functionTypes.functionTypes[functionTypeIndex];
-                wasmCWriteFunctionExport(file, module, moduleName, export, functionType, writeBody, pretty, multipleModules);
-                break;
-            }
-            case wasmExportKindMemory: {
-                wasmCWriteMemoryExport(file, module, moduleName, export, writeBody, pretty);
-                break;
-            }
-            default: {
-                /* TODO: other export kinds */
-                fprintf(
-                    stderr,
-                    "w2c2: unsupported export: %s (%s)\n",
-                    export.name,
-                    wasmExportKindDescription(export.kind)
-                );
-            }
+    U32 functionIndex = 0;
+    for (; functionIndex < functionImportCount; functionIndex++) {
+        const WasmFunctionImport import = module->functionImports.imports[functionIndex];
+        if (pretty) {
+            fputs(indentation, file);
         }
+        wasmCWriteFunctionImport(file, module, moduleName, import, true, pretty, multipleModules);
+        fputs(";\n\n", file);
     }
 }
 
-/* TODO: add support for multiple modules */
 static
+W2C2_INLINE
 void
-wasmCWriteDataSegments(
-    FILE* file,
-    const WasmModule* module,
-    const WasmDataSegmentMode mode,
-    const bool pretty
+wasmCWriteBaseInclude(
+    FILE* file
 ) {
-    const U32 dataSegmentCount = module->dataSegments.count;
+    fputs("#include \"w2c2_base.h\"\n\n", file);
+}
 
-    {
-        U32 dataSegmentIndex = 0;
-        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
-            const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+static
+W2C2_INLINE
+void
+wasmCWriteIncludes(
+    FILE* file,
+    const char* headerName
+) {
+    wasmCWriteBaseInclude(file);
+    fprintf(file, "#include \"%s\"\n\n", headerName);
+}
 
-            switch (mode) {
-                case wasmDataSegmentModeArrays: {
-                    fputs("const U8 ", file);
-                    /* TODO: add support for multiple modules */
-                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
-                    if (pretty) {
-                        fputs("[] = {\n", file);
-                    } else {
-                        fputs("[]={\n", file);
-                    }
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    {
-                        U32 byteIndex = 0;
-                        for (; byteIndex < dataSegment.bytes.length; byteIndex++) {
-                            fprintf(file, "0x%x", dataSegment.bytes.data[byteIndex]);
-                            if (pretty) {
-                                fputs(", ", file);
-                            } else {
-                                fputc(',', file);
-                            }
-                        }
-                    }
-                    fputs("\n};\n\n", file);
-                    break;
-                }
-                case wasmDataSegmentModeGNULD:
-                case wasmDataSegmentModeSectcreate1:
-                case wasmDataSegmentModeSectcreate2: {
-                    fputs("U8* ", file);
-                    /* TODO: add support for multiple modules */
-                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
-                    fputs(";\n", file);
-                    break;
-                }
-                default: {
-                    fprintf(stderr, "w2c2: unsupported data segment mode: %d\n", mode);
-                    abort();
-                }
-            }
+/*
+ * wasmCMultiValueTypeDeclared returns true if a function type
+ * preceding the given function type has the same result types
+ */
+static
+bool
+wasmCMultiValueTypeDeclared(
+    const WasmModule* module,
+    const U32 functionTypeIndex
+) {
+    const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
+    U32 otherIndex = 0;
+    for (; otherIndex < functionTypeIndex; otherIndex++) {
+        const WasmFunctionType otherType = module->functionTypes.functionTypes[otherIndex];
+        if (otherType.resultCount == functionType.resultCount
+            && memcmp(
+                otherType.resultTypes,
+                functionType.resultTypes,
+                functionType.resultCount * sizeof(WasmValueType)
+            ) == 0
+        ) {
+            return true;
         }
     }
+    return false;
 }
 
+typedef struct WasmCTailCalls {
+    /* Function types which are the target of tail calls through the trampoline */
+    bool* targetTypes;
+    /* Maximum number of parameters of the targets */
+    U32 maxParameterCount;
+    bool used;
+} WasmCTailCalls;
+
+static const WasmCTailCalls wasmCEmptyTailCalls = {NULL, 0, false};
+
 static
-void
-wasmCWriteDataSegmentsFromSection(
-    FILE* file,
+W2C2_INLINE
+bool
+WARN_UNUSED_RESULT
+wasmCTailCallsAdd(
     const WasmModule* module,
-    const WasmDataSegmentMode mode
+    WasmCTailCalls* tailCalls,
+    const U32 functionTypeIndex
 ) {
-    static const char* const filename = "datasegments";
-    const U32 dataSegmentCount = module->dataSegments.count;
-
-    U32 dataSegmentIndex = 0;
-    FILE* segmentsFile = NULL;
+    const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
 
-    switch (mode) {
-        case wasmDataSegmentModeGNULD: {
-            fputs("extern char _binary_datasegments_start[];\n\n", file);
-            fputs("static char* ds = _binary_datasegments_start;\n", file);
-            break;
-        }
-        case wasmDataSegmentModeSectcreate1: {
-            fputs("extern char data_segments_data __asm(\"section$start$__DATA$__datasegments\");\n\n", file);
-            fputs("static char* ds = &data_segments_data;\n", file);
-            break;
-        }
-        case wasmDataSegmentModeSectcreate2: {
-            /*
-             * On Rhapsody, mach-o/getsect.h was added.
-             * On OPENSTEP, libc.h is needed.
-             */
-            fputs(
-                "#include <mach/mach.h>\n"
-                "#ifdef __MACH30__\n"
-                "#include <mach-o/getsect.h>\n"
-                "#define SECT_DATA_SIZE_TYPE unsigned long\n"
-                "#else\n"
-                "#include <libc.h>\n"
-                "#define SECT_DATA_SIZE_TYPE int\n"
-                "#endif\n",
-                file
-            );
-            fputs(
-                "SECT_DATA_SIZE_TYPE len = 0;\n"
-                "static char* ds = getsectdata(\"__DATA\", \"__datasegments\", &len);\n",
-                file
-            );
-            break;
-        }
-        default: {
-            fprintf(stderr, "w2c2: unsupported data segment mode: %d\n", mode);
-            abort();
+    if (tailCalls->targetTypes == NULL) {
+        tailCalls->targetTypes = calloc(module->functionTypes.count, sizeof(bool));
+        if (tailCalls->targetTypes == NULL) {
+            fprintf(stderr, "w2c2: failed to allocate tail call types\n");
+            return false;
         }
     }
 
-    segmentsFile = fopen(filename, "wb");
-    if (segmentsFile == NULL) {
-        fprintf(
-            stderr,
-            "w2c2: failed to create data segments file %s: %s\n",
-            filename,
-            strerror(errno)
-        );
-        abort();
+    tailCalls->targetTypes[functionTypeIndex] = true;
+    if (functionType.parameterCount > tailCalls->maxParameterCount) {
+        tailCalls->maxParameterCount = functionType.parameterCount;
     }
+    tailCalls->used = true;
 
-    for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
-        const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
-        const size_t length = dataSegment.bytes.length;
-        const size_t written = fwrite(dataSegment.bytes.data, 1, length, segmentsFile);
-        if (written != length) {
-            fprintf(
-                stderr,
-                "w2c2: failed to write data segment %u: %s",
-                dataSegmentIndex,
-                strerror(errno)
-            );
-            abort();
+    return true;
+}
+
+/*
+ * wasmCScanTailCalls determines the function types of the tail calls
+ * which are performed through the trampoline, i.e. all tail calls
+ * except the ones to imported functions and the calling function itself
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCScanTailCalls(
+    const WasmModule* module,
+    WasmCTailCalls* result
+) {
+    const U32 functionImportCount = assertSizeU32(module->functionImports.length);
+
+    WasmCode code = wasmEmptyCode;
+    bool success = true;
+
+    U32 functionIndex = 0;
+    for (; success && functionIndex < module->functions.count; functionIndex++) {
+        const WasmFunction function = module->functions.functions[functionIndex];
+        size_t instructionIndex = 0;
+
+        success = wasmCodeDecode(module, function, &code);
+
+        for (; success && instructionIndex < code.instructions.length; instructionIndex++) {
+            const WasmInstruction instruction = code.instructions.instructions[instructionIndex];
+            if (instruction.opcode == wasmOpcodeReturnCall) {
+                const U32 funcIndex = instruction.immediates.call.funcIndex;
+                if (funcIndex >= functionImportCount
+                    && funcIndex != functionImportCount + functionIndex
+                    && funcIndex - functionImportCount < module->functions.count
+                ) {
+                    const WasmFunction target = module->functions.functions[funcIndex - functionImportCount];
+                    success = wasmCTailCallsAdd(module, result, target.functionTypeIndex);
+                }
+            } else if (instruction.opcode == wasmOpcodeReturnCallIndirect) {
+                const U32 functionTypeIndex = instruction.immediates.callIndirect.functionTypeIndex;
+                if (functionTypeIndex < module->functionTypes.count) {
+                    success = wasmCTailCallsAdd(module, result, functionTypeIndex);
+                }
+            }
         }
     }
 
-    if (fclose(segmentsFile) != 0) {
-        fprintf(
-            stderr,
-            "w2c2: failed to close data segments file %s: %s",
-            filename,
-            strerror(errno)
-        );
-        abort();
-    }
+    wasmCodeFree(&code);
+
+    return success;
 }
 
+/*
+ * wasmCScanInstanceParameters determines which of the functions defined by the module
+ * take the instance as their first parameter when using a single instance.
+ * Functions which may be called through a pointer, i.e. exported functions,
+ * functions in element segments, and all functions if tail calls use the trampoline,
+ * take it like in the default mode. All other functions use the single instance directly.
+ * The result must be freed by the caller
+ */
 static
-void
-wasmCWriteMemoryImports(
-    FILE* file,
+bool
+WARN_UNUSED_RESULT
+wasmCScanInstanceParameters(
     const WasmModule* module,
-    const bool pretty
+    bool** result
 ) {
-    const size_t memoryImportCount = module->memoryImports.length;
+    const U32 functionImportCount = assertSizeU32(module->functionImports.length);
+    const U32 functionCount = module->functions.count;
 
-    U32 memoryIndex = 0;
-    for (; memoryIndex < memoryImportCount; memoryIndex++) {
-        const WasmMemoryImport import = module->memoryImports.imports[memoryIndex];
-        if (pretty) {
-            fputs(indentation, file);
+    WasmCTailCalls tailCalls = wasmCEmptyTailCalls;
+    bool* instanceParameters = calloc(functionCount + 1, sizeof(bool));
+    if (instanceParameters == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate instance parameters\n");
+        return false;
+    }
+
+    if (!wasmCScanTailCalls(module, &tailCalls)) {
+        free(instanceParameters);
+        return false;
+    }
+    free(tailCalls.targetTypes);
+
+    if (tailCalls.used) {
+        memset(instanceParameters, true, functionCount * sizeof(bool));
+    }
+
+    {
+        U32 exportIndex = 0;
+        for (; exportIndex < module->exports.count; exportIndex++) {
+            const WasmExport export = module->exports.exports[exportIndex];
+            if (export.kind == wasmExportKindFunction
+                && export.index >= functionImportCount
+                && export.index - functionImportCount < functionCount
+            ) {
+                instanceParameters[export.index - functionImportCount] = true;
+            }
         }
-        wasmCWriteMemoryType(file);
-        if (pretty) {
-            fputc(' ', file);
+    }
+
+    {
+        U32 elementSegmentIndex = 0;
+        for (; elementSegmentIndex < module->elementSegments.count; elementSegmentIndex++) {
+            const WasmElementSegment elementSegment = module->elementSegments.elementSegments[elementSegmentIndex];
+            U32 index = 0;
+            for (; index < elementSegment.functionIndexCount; index++) {
+                const U32 functionIndex = elementSegment.functionIndices[index];
+                if (functionIndex >= functionImportCount
+                    && functionIndex - functionImportCount < functionCount
+                ) {
+                    instanceParameters[functionIndex - functionImportCount] = true;
+                }
+            }
         }
-        wasmCWriteFileImportName(file, import.module, import.name);
-        fputs(";\n", file);
     }
+
+    *result = instanceParameters;
+
+    return true;
 }
 
+/*
+ * wasmCMarkFunctionReachable marks the given defined function as reachable,
+ * and adds it to the worklist if it was not reachable yet
+ */
 static
+W2C2_INLINE
 void
-wasmCWriteMemories(
-    FILE* file,
+wasmCMarkFunctionReachable(
     const WasmModule* module,
-    const bool pretty
+    const U32 functionIndex,
+    bool* reachableFunctions,
+    U32* worklist,
+    U32* worklistLength
 ) {
-    const size_t memoryImportCount = module->memoryImports.length;
-    const U32 memoryCount = module->memories.count;
+    const U32 functionImportCount = assertSizeU32(module->functionImports.length);
 
-    U32 memoryIndex = 0;
-    for (; memoryIndex < memoryCount; memoryIndex++) {
-        U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
-        if (pretty) {
-            fputs(indentation, file);
-        }
-        fputs("wasmMemory* ", file);
-        wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
-        fputs(";\n", file);
+    /* Imported functions are always declared, and invalid indices are reported when generating code */
+    if (functionIndex < functionImportCount
+        || functionIndex - functionImportCount >= module->functions.count
+        || reachableFunctions[functionIndex - functionImportCount]
+    ) {
+        return;
     }
+
+    reachableFunctions[functionIndex - functionImportCount] = true;
+    worklist[(*worklistLength)++] = functionIndex - functionImportCount;
 }
 
+/*
+ * wasmCScanReachableFunctions determines which of the functions defined by the module
+ * are reachable from the exported functions, the start function, and the element segments,
+ * through direct calls. Functions in tables may be called indirectly, so they are reachable.
+ * The result must be freed by the caller
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteInitMemories(
-    FILE* file,
+wasmCScanReachableFunctions(
     const WasmModule* module,
-    const char* moduleName,
-    const WasmDataSegmentMode dataSegmentMode,
-    const bool pretty
+    bool** result
 ) {
-    const size_t memoryImportCount = module->memoryImports.length;
-    const U32 memoryCount = module->memories.count;
-    if (memoryCount > 0) {
+    const U32 functionCount = module->functions.count;
 
-        StringBuilder stringBuilder = emptyStringBuilder;
-        MUST (stringBuilderInitialize(&stringBuilder))
+    WasmCode code = wasmEmptyCode;
+    U32 worklistLength = 0;
+    bool* reachableFunctions = calloc(functionCount + 1, sizeof(bool));
+    U32* worklist = calloc(functionCount + 1, sizeof(U32));
+    if (reachableFunctions == NULL || worklist == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate reachable functions\n");
+        free(reachableFunctions);
+        free(worklist);
+        return false;
+    }
 
-        fprintf(
-            file,
-            "static void %sInitMemories(%sInstance* i, %sInstance* parent) {\n",
-            moduleName,
-            moduleName,
-            moduleName
-        );
+    {
+        U32 exportIndex = 0;
+        for (; exportIndex < module->exports.count; exportIndex++) {
+            const WasmExport export = module->exports.exports[exportIndex];
+            if (export.kind == wasmExportKindFunction) {
+                wasmCMarkFunctionReachable(
+                    module,
+                    export.index,
+                    reachableFunctions,
+                    worklist,
+                    &worklistLength
+                );
+            }
+        }
+    }
 
-        {
-            U32 memoryIndex = 0;
-            for (; memoryIndex < memoryCount; memoryIndex++) {
-                const WasmMemory memory = module->memories.memories[memoryIndex];
-                U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
+    if (module->hasStartFunction) {
+        wasmCMarkFunctionReachable(
+            module,
+            module->startFunctionIndex,
+            reachableFunctions,
+            worklist,
+            &worklistLength
+        );
+    }
 
-                if (memory.shared) {
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    fputs("if (parent == NULL) {\n", file);
-                    {
-                        if (pretty) {
-                            fputs(indentation, file);
-                            fputs(indentation, file);
-                        }
-                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
-                        fprintf(file, "= WASM_MEMORY_ALLOCATE_SHARED(%u, %u);\n", memory.min, memory.max);
-                    }
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    fputs("} else {\n", file);
-                    {
-                        if (pretty) {
-                            fputs(indentation, file);
-                            fputs(indentation, file);
-                        }
-                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
-                        fputs(" = ", file);
-                        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, "parent", true);
-                        fputs(";\n", file);
-                    }
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    fputs("}\n", file);
-                } else {
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
-                    fprintf(file, " = wasmMemoryAllocate(%u, %u, false);\n", memory.min, memory.max);
-                }
+    {
+        U32 elementSegmentIndex = 0;
+        for (; elementSegmentIndex < module->elementSegments.count; elementSegmentIndex++) {
+            const WasmElementSegment elementSegment = module->elementSegments.elementSegments[elementSegmentIndex];
+            U32 index = 0;
+            for (; index < elementSegment.functionIndexCount; index++) {
+                wasmCMarkFunctionReachable(
+                    module,
+                    elementSegment.functionIndices[index],
+                    reachableFunctions,
+                    worklist,
+                    &worklistLength
+                );
             }
         }
+    }
 
-        {
-            const U32 dataSegmentCount = module->dataSegments.count;
-            U32 dataSegmentIndex = 0;
-            U64 byteOffset = 0;
-            for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
-                const WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
-                const size_t dataSegmentLength = dataSegment.bytes.length;
-                const Buffer code = dataSegment.offset;
-
-                switch (dataSegmentMode) {
-                    case wasmDataSegmentModeGNULD:
-                    case wasmDataSegmentModeSectcreate1:
-                    case wasmDataSegmentModeSectcreate2: {
-                        /* TODO: add support for multiple modules */
-                        wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
-                        if (pretty) {
-                            fprintf(file, " = ds + %llu", byteOffset);
-                        } else {
-                            fprintf(file, "=ds+%llu", byteOffset);
-                        }
-                        fputs(";\n", file);
-                        break;
-                    }
-                }
+    /* Each function is added to the worklist at most once */
+    while (worklistLength > 0) {
+        const WasmFunction function = module->functions.functions[worklist[--worklistLength]];
+        size_t instructionIndex = 0;
 
-                /* Load active segments */
-                if (code.data != NULL) {
-                    if (pretty) {
-                        fputs(indentation, file);
-                    }
-                    fputs("LOAD_DATA(", file);
-                    wasmCWriteFileMemoryUse(
-                            file,
-                            module,
-                            dataSegment.memoryIndex,
-                            NULL,
-                            false
-                    );
-                    fputs(", ", file);
-                    MUST (stringBuilderReset(&stringBuilder))
-                    MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
-                    fputs(stringBuilder.string, file);
-                    fputs(", ", file);
-                    /* TODO: add support for multiple modules */
-                    wasmCWriteFileDataSegmentName(file, dataSegmentIndex);
-                    fprintf(file, ", %lu);\n", (unsigned long) dataSegmentLength);
-                }
+        if (!wasmCodeDecode(module, function, &code)) {
+            free(reachableFunctions);
+            free(worklist);
+            wasmCodeFree(&code);
+            return false;
+        }
 
-                byteOffset += dataSegment.bytes.length;
+        for (; instructionIndex < code.instructions.length; instructionIndex++) {
+            const WasmInstruction instruction = code.instructions.instructions[instructionIndex];
+            if (instruction.opcode == wasmOpcodeCall || instruction.opcode == wasmOpcodeReturnCall) {
+                wasmCMarkFunctionReachable(
+                    module,
+                    instruction.immediates.call.funcIndex,
+                    reachableFunctions,
+                    worklist,
+                    &worklistLength
+                );
             }
         }
+    }
 
-        fputs("}\n\n", file);
+    free(worklist);
+    wasmCodeFree(&code);
+
+    *result = reachableFunctions;
 
-        stringBuilderFree(&stringBuilder);
-    }
     return true;
 }
 
+/*
+ * wasmCFilterReachableFunctionIDs appends the IDs of the reachable functions
+ * of the given function IDs to the result, keeping their order
+ */
 static
-void
-wasmCWriteFreeMemories(
-    FILE* file,
-    const WasmModule* module,
-    const bool pretty
+bool
+WARN_UNUSED_RESULT
+wasmCFilterReachableFunctionIDs(
+    const WasmFunctionIDs functionIDs,
+    const bool* reachableFunctions,
+    WasmFunctionIDs* result
 ) {
-    const size_t memoryImportCount = module->memoryImports.length;
-    const U32 memoryCount = module->memories.count;
-    U32 memoryIndex = 0;
-    for (; memoryIndex < memoryCount; memoryIndex++) {
-        U32 moduleMemoryIndex = assertSizeU32(memoryImportCount) + memoryIndex;
-        if (pretty) {
-            fputs(indentation, file);
+    size_t functionIDIndex = 0;
+    for (; functionIDIndex < functionIDs.length; functionIDIndex++) {
+        const WasmFunctionID functionID = functionIDs.functionIDs[functionIDIndex];
+        if (!reachableFunctions[functionID.functionIndex]) {
+            continue;
+        }
+        if (!wasmFunctionIDsAppend(result, functionID)) {
+            fprintf(stderr, "w2c2: failed to allocate function IDs\n");
+            return false;
         }
-        fputs("wasmMemoryFree(", file);
-        wasmCWriteFileMemoryUse(file, module, moduleMemoryIndex, NULL, true);
-        fputs(");\n", file);
     }
+    return true;
 }
 
+/*
+ * wasmCScanLocalFunctionEffects determines the effects of the code of the given function itself,
+ * and appends the indices of the functions it calls directly to the given callees.
+ * The given code is used to decode the function
+ */
 static
-void
-wasmCWriteTableImports(
-    FILE* file,
+bool
+WARN_UNUSED_RESULT
+wasmCScanLocalFunctionEffects(
     const WasmModule* module,
-    const bool pretty
+    const WasmFunction function,
+    WasmCode* code,
+    WasmCFunctionIndices* callees,
+    WasmCFunctionEffects* result
 ) {
-    const size_t tableImportCount = module->tableImports.length;
+    const U32 functionImportCount = assertSizeU32(module->functionImports.length);
 
-    U32 tableIndex = 0;
-    for (; tableIndex < tableImportCount; tableIndex++) {
-        const WasmTableImport import = module->tableImports.imports[tableIndex];
-        if (pretty) {
-            fputs(indentation, file);
-        }
-        wasmCWriteTableType(file);
-        if (pretty) {
-            fputc(' ', file);
-        }
-        wasmCWriteFileImportName(file, import.module, import.name);
-        fputs(";\n", file);
-    }
-}
+    WasmCFunctionEffects effects = wasmCFunctionEffectsNone;
+    size_t instructionIndex = 0;
 
-static
-void
-wasmCWriteTables(
-    FILE* file,
-    const WasmModule* module,
-    const bool pretty
-) {
-    const size_t tableImportCount = module->tableImports.length;
-    const U32 tableCount = module->tables.count;
+    MUST (wasmCodeDecode(module, function, code))
 
-    U32 tableIndex = 0;
-    for (; tableIndex < tableCount; tableIndex++) {
-        if (pretty) {
-            fputs(indentation, file);
+    for (;
+        instructionIndex < code->instructions.length && effects != wasmCFunctionEffectsAny;
+        instructionIndex++
+    ) {
+        const WasmInstruction instruction = code->instructions.instructions[instructionIndex];
+
+        switch (instruction.opcode) {
+            case wasmOpcodeNop:
+            case wasmOpcodeBlock:
+            case wasmOpcodeIf:
+            case wasmOpcodeElse:
+            case wasmOpcodeEnd:
+            case wasmOpcodeBr:
+            case wasmOpcodeBrIf:
+            case wasmOpcodeBrTable:
+            case wasmOpcodeReturn:
+            case wasmOpcodeDrop:
+            case wasmOpcodeSelect:
+            case wasmOpcodeLocalGet:
+            case wasmOpcodeLocalSet:
+            case wasmOpcodeLocalTee:
+            case wasmOpcodeI32Const:
+            case wasmOpcodeI64Const:
+            case wasmOpcodeF32Const:
+            case wasmOpcodeF64Const: {
+                break;
+            }
+            case wasmOpcodeGlobalGet:
+            case wasmOpcodeMemorySize: {
+                effects = wasmCFunctionEffectsRead;
+                break;
+            }
+            case wasmOpcodeCall: {
+                const U32 funcIndex = instruction.immediates.call.funcIndex;
+                if (funcIndex < functionImportCount
+                    || funcIndex - functionImportCount >= module->functions.count
+                ) {
+                    effects = wasmCFunctionEffectsAny;
+                    break;
+                }
+                MUST (wasmCFunctionIndicesAppend(callees, funcIndex - functionImportCount))
+                break;
+            }
+            case wasmOpcodeI32DivS:
+            case wasmOpcodeI32DivU:
+            case wasmOpcodeI32RemS:
+            case wasmOpcodeI32RemU:
+            case wasmOpcodeI64DivS:
+            case wasmOpcodeI64DivU:
+            case wasmOpcodeI64RemS:
+            case wasmOpcodeI64RemU:
+            case wasmOpcodeI32TruncF32S:
+            case wasmOpcodeI32TruncF32U:
+            case wasmOpcodeI32TruncF64S:
+            case wasmOpcodeI32TruncF64U:
+            case wasmOpcodeI64TruncF32S:
+            case wasmOpcodeI64TruncF32U:
+            case wasmOpcodeI64TruncF64S:
+            case wasmOpcodeI64TruncF64U: {
+                effects = wasmCFunctionEffectsAny;
+                break;
+            }
+            case wasmOpcodeMiscPrefix: {
+                /* Only the saturating truncations, which never trap, are considered */
+                if (instruction.prefixedOpcode > wasmMiscOpcodeI64TruncSatF64U) {
+                    effects = wasmCFunctionEffectsAny;
+                }
+                break;
+            }
+            default: {
+                /* All other numeric instructions never trap */
+                if (instruction.opcode < wasmOpcodeI32Eqz || instruction.opcode > wasmOpcodeI64Extend32S) {
+                    effects = wasmCFunctionEffectsAny;
+                }
+                break;
+            }
         }
-        fputs("wasmTable ", file);
-        wasmCWriteFileTableNonImportName(file, assertSizeU32(tableImportCount) + tableIndex);
-        fputs(";\n", file);
     }
+
+    *result = effects;
+
+    return true;
 }
 
+/*
+ * wasmCScanFunctionEffects determines the effects of the functions defined by the module,
+ * including the effects of the functions they call.
+ * Functions which are part of a cycle of calls may not return, so they have any effects.
+ * The result must be freed by the caller
+ */
 static
 bool
 WARN_UNUSED_RESULT
-wasmCWriteInitTables(
-    FILE* file,
+wasmCScanFunctionEffects(
     const WasmModule* module,
-    const char* moduleName,
-    const bool pretty,
-    const bool multipleModules
+    WasmCFunctionEffects** result
 ) {
-    const size_t tableImportCount = module->tableImports.length;
-    const U32 elementSegmentCount = module->elementSegments.count;
-    const U32 tableCount = module->tables.count;
-    if (tableCount > 0 || elementSegmentCount > 0) {
-        StringBuilder stringBuilder = emptyStringBuilder;
-        MUST (stringBuilderInitialize(&stringBuilder))
+    const U32 functionCount = module->functions.count;
+
+    WasmCFunctionIndices callees = wasmCEmptyFunctionIndices;
+    WasmCode code = wasmEmptyCode;
+    /* Start of the callees of each function in the callees, followed by the end */
+    size_t* calleesStarts = calloc(functionCount + 1, sizeof(size_t));
+    bool* determined = calloc(functionCount + 1, sizeof(bool));
+    WasmCFunctionEffects* effects = calloc(functionCount + 1, sizeof(WasmCFunctionEffects));
+    bool changed = true;
+    bool success = calleesStarts != NULL && determined != NULL && effects != NULL;
+
+    U32 functionIndex = 0;
+    for (; success && functionIndex < functionCount; functionIndex++) {
+        calleesStarts[functionIndex] = callees.length;
+        success = wasmCScanLocalFunctionEffects(
+            module,
+            module->functions.functions[functionIndex],
+            &code,
+            &callees,
+            &effects[functionIndex]
+        );
+    }
 
-        fprintf(file, "static void %sInitTables(%sInstance* i) {\n", moduleName, moduleName);
+    wasmCodeFree(&code);
 
-        if (elementSegmentCount > 0) {
-            if (pretty) {
-                fputs(indentation, file);
-            }
-            fputs("U32 offset;\n", file);
-        }
+    if (!success) {
+        fprintf(stderr, "w2c2: failed to scan function effects\n");
+        free(calleesStarts);
+        free(determined);
+        free(effects);
+        wasmCFunctionIndicesFree(&callees);
+        return false;
+    }
 
-        {
-            U32 tableIndex = 0;
-            for (; tableIndex < tableCount; tableIndex++) {
-                const WasmTable table = module->tables.tables[tableIndex];
+    calleesStarts[functionCount] = callees.length;
 
-                if (pretty) {
-                    fputs(indentation, file);
-                }
-                fputs("wasmTableAllocate(", file);
-                wasmCWriteFileTableUse(file, module, assertSizeU32(tableImportCount) + tableIndex, true);
-                fprintf(file, ", %u, %u);\n", table.min, table.max);
-            }
-        }
+    /* Determine the effects of callers once the effects of all their callees are determined */
+    while (changed) {
+        changed = false;
+        for (functionIndex = 0; functionIndex < functionCount; functionIndex++) {
+            WasmCFunctionEffects functionEffects = effects[functionIndex];
+            size_t calleeIndex = calleesStarts[functionIndex];
+            bool calleesDetermined = true;
 
-        {
-            U32 elementSegmentIndex = 0;
-            for (; elementSegmentIndex < elementSegmentCount; elementSegmentIndex++) {
-                const WasmElementSegment elementSegment = module->elementSegments.elementSegments[elementSegmentIndex];
+            if (determined[functionIndex]) {
+                continue;
+            }
 
-                if (pretty) {
-                    fputs(indentation, file);
-                    fputs("offset = ", file);
-                } else {
-                    fputs("offset=", file);
+            for (;
+                functionEffects != wasmCFunctionEffectsAny && calleeIndex < calleesStarts[functionIndex + 1];
+                calleeIndex++
+            ) {
+                const U32 calleeFunctionIndex = callees.indices[calleeIndex];
+                if (!determined[calleeFunctionIndex]) {
+                    calleesDetermined = false;
+                    break;
                 }
-                {
-                    const Buffer code = elementSegment.offset;
-                    MUST (stringBuilderReset(&stringBuilder))
-                    MUST (wasmCWriteConstantExpr(&stringBuilder, module, code))
-                    fputs(stringBuilder.string, file);
+                if (effects[calleeFunctionIndex] > functionEffects) {
+                    functionEffects = effects[calleeFunctionIndex];
                 }
-                fputs(";\n", file);
+            }
 
-                {
-                    U32 functionIndexIndex = 0;
-                    for (; functionIndexIndex < elementSegment.functionIndexCount; functionIndexIndex++) {
-                        const U32 functionIndex = elementSegment.functionIndices[functionIndexIndex];
-                        if (pretty) {
-                            fputs(indentation, file);
-                        }
-                        wasmCWriteFileTableUse(file, module, elementSegment.tableIndex, false);
-                        if (pretty) {
-                            fprintf(file, ".data[offset + %u] = (wasmFunc)", functionIndexIndex);
-                        } else {
-                            fprintf(file, ".data[offset+%u]=(wasmFunc)", functionIndexIndex);
-                        }
-                        wasmCWriteFileFunctionUse(file, module, moduleName, functionIndex, true, multipleModules);
-                        fputs(";\n", file);
-                    }
-                }
+            if (calleesDetermined || functionEffects == wasmCFunctionEffectsAny) {
+                effects[functionIndex] = functionEffects;
+                determined[functionIndex] = true;
+                changed = true;
             }
         }
+    }
 
-        fputs("}\n\n", file);
-
-        stringBuilderFree(&stringBuilder);
+    for (functionIndex = 0; functionIndex < functionCount; functionIndex++) {
+        if (!determined[functionIndex]) {
+            effects[functionIndex] = wasmCFunctionEffectsAny;
+        }
     }
 
+    free(calleesStarts);
+    free(determined);
+    wasmCFunctionIndicesFree(&callees);
+
+    *result = effects;
+
     return true;
 }
 
 static
 void
-wasmCWriteFreeTables(
+wasmCWriteTailCallThunks(
     FILE* file,
     const WasmModule* module,
+    const char* moduleName,
+    const WasmCTailCalls tailCalls,
     const bool pretty
 ) {
-    const size_t tableImportCount = module->tableImports.length;
-    const U32 tableCount = module->tables.count;
-    U32 tableIndex = 0;
-    for (; tableIndex < tableCount; tableIndex++) {
+    U32 functionTypeIndex = 0;
+
+    if (!tailCalls.used) {
+        return;
+    }
+
+    for (; functionTypeIndex < module->functionTypes.count; functionTypeIndex++) {
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
+        U32 parameterIndex = 0;
+
+        if (!tailCalls.targetTypes[functionTypeIndex]) {
+            continue;
+        }
+
+        fputs("static W2C2_INLINE ", file);
+        wasmCWriteFileReturnType(file, functionType);
+        fputc(' ', file);
+        wasmCWriteFileTailCallThunkName(file, moduleName, functionTypeIndex);
+        fprintf(file, "(%sInstance* i) {\n", moduleName);
         if (pretty) {
             fputs(indentation, file);
         }
-        fputs("wasmTableFree(", file);
-        wasmCWriteFileTableUse(file, module, assertSizeU32(tableImportCount) + tableIndex, true);
-        fputs(");\n", file);
+        if (functionType.resultCount > 0) {
+            fputs("return ", file);
+        }
+        fputs("((", file);
+        wasmCWriteFileReturnType(file, functionType);
+        fputs(" (*)", file);
+        wasmCWriteFileParameters(file, moduleName, functionType, false, false, true, pretty);
+        fputs(")i->tailCallTarget)(i", file);
+        for (; parameterIndex < functionType.parameterCount; parameterIndex++) {
+            const WasmValueType parameterType = functionType.parameterTypes[parameterIndex];
+            fprintf(
+                file,
+                pretty ? ", i->tailCallArguments[%u].%s" : ",i->tailCallArguments[%u].%s",
+                parameterIndex,
+                tailCallArgumentFieldNames[parameterType]
+            );
+        }
+        fputs(");\n}\n\n", file);
     }
 }
 
 static
 void
-wasmCWriteFunctionImports(
+wasmCWriteTailCallFields(
     FILE* file,
-    const WasmModule* module,
-    const char* moduleName,
-    const bool pretty,
-    const bool multipleModules
+    const WasmCTailCalls tailCalls,
+    const bool pretty
 ) {
-    const size_t functionImportCount = module->functionImports.length;
-    U32 functionIndex = 0;
-    for (; functionIndex < functionImportCount; functionIndex++) {
-        const WasmFunctionImport import = module->functionImports.imports[functionIndex];
+    if (!tailCalls.used) {
+        return;
+    }
+
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("wasmFunc tailCallThunk;\n", file);
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    fputs("wasmFunc tailCallTarget;\n", file);
+    if (tailCalls.maxParameterCount > 0) {
         if (pretty) {
             fputs(indentation, file);
         }
-        wasmCWriteFunctionImport(file, module, moduleName, import, true, pretty, multipleModules);
-        fputs(";\n\n", file);
+        fprintf(file, "wasmTailCallArgument tailCallArguments[%u];\n", tailCalls.maxParameterCount);
     }
 }
 
 static
-W2C2_INLINE
-void
-wasmCWriteBaseInclude(
-    FILE* file
-) {
-    fputs("#include \"w2c2_base.h\"\n\n", file);
-}
-
-static
-W2C2_INLINE
 void
-wasmCWriteIncludes(
+wasmCWriteMultiValueTypes(
     FILE* file,
-    const char* headerName
+    const WasmModule* module,
+    const bool pretty
 ) {
-    wasmCWriteBaseInclude(file);
-    fprintf(file, "#include \"%s\"\n\n", headerName);
+    U32 functionTypeIndex = 0;
+    for (; functionTypeIndex < module->functionTypes.count; functionTypeIndex++) {
+        const WasmFunctionType functionType = module->functionTypes.functionTypes[functionTypeIndex];
+        U32 resultIndex = 0;
+
+        if (functionType.resultCount < 2
+            || wasmCMultiValueTypeDeclared(module, functionTypeIndex)
+        ) {
+            continue;
+        }
+
+        /* Multiple modules may use the same struct */
+        fprintf(file, "#ifndef %s", multiValueGuardPrefix);
+        wasmCWriteFileMultiValueTypeSuffix(file, functionType);
+        fprintf(file, "\n#define %s", multiValueGuardPrefix);
+        wasmCWriteFileMultiValueTypeSuffix(file, functionType);
+        fputs("\n", file);
+
+        fputs("typedef struct ", file);
+        wasmCWriteFileReturnType(file, functionType);
+        fputs(" {\n", file);
+        for (; resultIndex < functionType.resultCount; resultIndex++) {
+            if (pretty) {
+                fputs(indentation, file);
+            }
+            fprintf(
+                file,
+                "%s %c%u;\n",
+                valueTypeNames[functionType.resultTypes[resultIndex]],
+                multiValueFieldPrefix,
+                resultIndex
+            );
+        }
+        fputs("} ", file);
+        wasmCWriteFileReturnType(file, functionType);
+        fputs(";\n#endif\n\n", file);
+    }
 }
 
 static
@@ -5653,6 +10005,7 @@ wasmCWriteModuleInstanceDeclaration(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
+    const WasmCTailCalls tailCalls,
     const bool pretty
 ) {
     fprintf(file, "typedef struct %sInstance {\n", moduleName);
@@ -5670,6 +10023,8 @@ wasmCWriteModuleInstanceDeclaration(
     wasmCWriteTables(file, module, pretty);
     wasmCWriteGlobals(file, module, pretty);
 
+    wasmCWriteTailCallFields(file, tailCalls, pretty);
+
     fprintf(file, "} %sInstance;\n\n", moduleName);
 }
 
@@ -5679,14 +10034,33 @@ wasmCWriteModuleDeclarations(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
+    const WasmCTailCalls tailCalls,
+    const bool* instanceParameters,
+    const bool* reachableFunctions,
+    const WasmCFunctionEffects* functionEffects,
     const bool pretty,
     const bool debug,
     const bool multipleModules
 ) {
-    wasmCWriteModuleInstanceDeclaration(file, module, moduleName, pretty);
+    wasmCWriteMultiValueTypes(file, module, pretty);
+    wasmCWriteModuleInstanceDeclaration(file, module, moduleName, tailCalls, pretty);
+    if (instanceParameters != NULL) {
+        fprintf(file, "extern %sInstance %s%s;\n\n", moduleName, moduleName, singleInstanceNameSuffix);
+    }
     wasmCWriteFunctionImports(file, module, moduleName, pretty, multipleModules);
-    wasmCWriteFunctionDeclarations(file, module, moduleName, pretty, debug, multipleModules);
-    wasmCWriteExports(file, module, moduleName, false, pretty, multipleModules);
+    wasmCWriteFunctionDeclarations(
+        file,
+        module,
+        moduleName,
+        instanceParameters,
+        reachableFunctions,
+        functionEffects,
+        pretty,
+        debug,
+        multipleModules
+    );
+    wasmCWriteTailCallThunks(file, module, moduleName, tailCalls, pretty);
+    wasmCWriteExports(file, module, moduleName, false, false, pretty, multipleModules);
 }
 
 /* TODO: verify */
@@ -5778,6 +10152,30 @@ wasmCWriteNewChildFunction(
     fputs("}\n\n", file);
 }
 
+static
+void
+wasmCWriteStartFunctionCall(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const bool* instanceParameters,
+    const bool pretty,
+    const bool multipleModules
+) {
+    if (!module->hasStartFunction) {
+        return;
+    }
+
+    if (pretty) {
+        fputs(indentation, file);
+    }
+    wasmCWriteFileFunctionUse(file, module, moduleName, module->startFunctionIndex, false, multipleModules);
+    if (wasmCFunctionHasInstanceParameter(module, instanceParameters, module->startFunctionIndex)) {
+        fputs("(i);\n", file);
+    } else {
+        fputs("();\n", file);
+    }
+}
 
 static
 void
@@ -5785,6 +10183,7 @@ wasmCWriteInstantiateFunction(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
+    const bool* instanceParameters,
     const bool pretty,
     const bool multipleModules
 ) {
@@ -5795,6 +10194,11 @@ wasmCWriteInstantiateFunction(
         moduleName
     );
 
+    if (instanceParameters != NULL) {
+        wasmCWriteFileSingleInstanceCallerDeclaration(file, moduleName, pretty);
+        wasmCWriteFileSingleInstanceSelection(file, moduleName, pretty);
+    }
+
     if (pretty) {
         fputs(indentation, file);
     }
@@ -5805,10 +10209,12 @@ wasmCWriteInstantiateFunction(
     }
     fputs("i->common.resolveImports = resolveImports;\n", file);
 
-    if (pretty) {
-        fputs(indentation, file);
+    if (instanceParameters == NULL) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fprintf(file, "i->common.newChild = (struct wasmModuleInstance* (*)(struct wasmModuleInstance*))%sNewChild;\n", moduleName);
     }
-    fprintf(file, "i->common.newChild = (struct wasmModuleInstance* (*)(struct wasmModuleInstance*))%sNewChild;\n", moduleName);
 
     if (pretty) {
         fputs(indentation, file);
@@ -5838,12 +10244,61 @@ wasmCWriteInstantiateFunction(
         fprintf(file, "%sInitGlobals(i);\n", moduleName);
     }
 
-    if (module->hasStartFunction) {
+    wasmCWriteStartFunctionCall(file, module, moduleName, instanceParameters, pretty, multipleModules);
+
+    if (instanceParameters != NULL) {
+        wasmCWriteFileSingleInstanceCopy(file, pretty);
+    }
+
+    fputs("}\n\n", file);
+}
+
+static
+void
+wasmCWriteResetFunction(
+    FILE* file,
+    const WasmModule* module,
+    const char* moduleName,
+    const bool* instanceParameters,
+    const bool pretty,
+    const bool multipleModules
+) {
+    fprintf(file, "void %sResetInstance(%sInstance* i) {\n", moduleName, moduleName);
+
+    if (instanceParameters != NULL) {
+        wasmCWriteFileSingleInstanceCallerDeclaration(file, moduleName, pretty);
+        wasmCWriteFileSingleInstanceSelection(file, moduleName, pretty);
+    }
+
+    /* The imports stay resolved */
+
+    if (module->memories.count > 0) {
         if (pretty) {
             fputs(indentation, file);
         }
-        wasmCWriteFileFunctionUse(file, module, moduleName, module->startFunctionIndex, false, multipleModules);
-        fputs("(i);\n", file);
+        fprintf(file, "%sResetMemories(i);\n", moduleName);
+    }
+
+    if (module->tables.count > 0
+        || module->elementSegments.count > 0
+    ) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fprintf(file, "%sResetTables(i);\n", moduleName);
+    }
+
+    if (module->globals.count > 0) {
+        if (pretty) {
+            fputs(indentation, file);
+        }
+        fprintf(file, "%sInitGlobals(i);\n", moduleName);
+    }
+
+    wasmCWriteStartFunctionCall(file, module, moduleName, instanceParameters, pretty, multipleModules);
+
+    if (instanceParameters != NULL) {
+        wasmCWriteFileSingleInstanceCopy(file, pretty);
     }
 
     fputs("}\n\n", file);
@@ -5855,16 +10310,70 @@ wasmCWriteFreeFunction(
     FILE* file,
     const WasmModule* module,
     const char* moduleName,
+    const bool singleInstance,
     const bool pretty
 ) {
     fprintf(file, "void %sFreeInstance(%sInstance* i) {\n", moduleName, moduleName);
 
+    if (singleInstance) {
+        wasmCWriteFileSingleInstanceSelection(file, moduleName, pretty);
+    }
+
     wasmCWriteFreeMemories(file, module, pretty);
     wasmCWriteFreeTables(file, module, pretty);
 
     fputs("}\n\n", file);
 }
 
+/*
+ * wasmCWriteInstancePoolFunctions writes the functions to reuse instances:
+ * Released instances are reset and put into the pool,
+ * so acquiring an instance only instantiates a new one if the pool is empty
+ */
+static
+void
+wasmCWriteInstancePoolFunctions(
+    FILE* file,
+    const char* moduleName,
+    const bool pretty
+) {
+    const char* indent = pretty ? indentation : "";
+
+    fprintf(
+        file,
+        "%sInstance* %sAcquireInstance(wasmInstancePool* pool, void* resolveImports(const char* module, const char* name)) {\n",
+        moduleName,
+        moduleName
+    );
+    fprintf(file, "%s%sInstance* i = (%sInstance*)wasmInstancePoolTake(pool);\n", indent, moduleName, moduleName);
+    fprintf(file, "%sif (i == NULL) {\n", indent);
+    fprintf(file, "%s%si = (%sInstance*)calloc(1, sizeof(%sInstance));\n", indent, indent, moduleName, moduleName);
+    fprintf(file, "%s%sif (i == NULL) {\n", indent, indent);
+    fprintf(file, "%s%s%sreturn NULL;\n", indent, indent, indent);
+    fprintf(file, "%s%s}\n", indent, indent);
+    fprintf(file, "%s%s%sInstantiate(i, resolveImports);\n", indent, indent, moduleName);
+    fprintf(file, "%s}\n", indent);
+    fprintf(file, "%sreturn i;\n", indent);
+    fputs("}\n\n", file);
+
+    fprintf(file, "void %sReleaseInstance(wasmInstancePool* pool, %sInstance* i) {\n", moduleName, moduleName);
+    fprintf(file, "%s%sResetInstance(i);\n", indent, moduleName);
+    fprintf(file, "%sif (!wasmInstancePoolPut(pool, &i->common)) {\n", indent);
+    fprintf(file, "%s%s%sFreeInstance(i);\n", indent, indent, moduleName);
+    fprintf(file, "%s%sfree(i);\n", indent, indent);
+    fprintf(file, "%s}\n", indent);
+    fputs("}\n\n", file);
+
+    fprintf(file, "void %sFreeInstancePool(wasmInstancePool* pool) {\n", moduleName);
+    fprintf(file, "%s%sInstance* i = NULL;\n", indent, moduleName);
+    fprintf(file, "%swhile ((i = (%sInstance*)wasmInstancePoolTake(pool)) != NULL) {\n", indent, moduleName);
+    fprintf(file, "%s%s%sFreeInstance(i);\n", indent, indent, moduleName);
+    fprintf(file, "%s%sfree(i);\n", indent, indent);
+    fprintf(file, "%s}\n", indent);
+    fprintf(file, "%swasmInstancePoolFree(pool);\n", indent);
+    fputs("}\n\n", file);
+}
+
 static
 bool
 WARN_UNUSED_RESULT
@@ -5872,15 +10381,27 @@ wasmCWriteModuleHeader(
     const WasmModule* module,
     const char* moduleName,
     const char* filename,
+    const bool* instanceParameters,
+    const bool* reachableFunctions,
     const bool pretty,
     const bool debug,
     const bool multipleModules
 ) {
     /* Create file */
     FILE* file = NULL;
+    WasmCTailCalls tailCalls = wasmCEmptyTailCalls;
+    WasmCFunctionEffects* functionEffects = NULL;
+
+    MUST (wasmCScanTailCalls(module, &tailCalls))
+    if (!wasmCScanFunctionEffects(module, &functionEffects)) {
+        free(tailCalls.targetTypes);
+        return false;
+    }
 
     file = fopen(filename, "w");
     if (file == NULL) {
+        free(tailCalls.targetTypes);
+        free(functionEffects);
         fprintf(
             stderr,
             "w2c2: failed to create header file %s: %s\n",
@@ -5896,19 +10417,57 @@ wasmCWriteModuleHeader(
     fputs("#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n", file);
 
     wasmCWriteBaseInclude(file);
-    wasmCWriteModuleDeclarations(file, module, moduleName, pretty, debug, multipleModules);
+    wasmCWriteModuleDeclarations(
+        file,
+        module,
+        moduleName,
+        tailCalls,
+        instanceParameters,
+        reachableFunctions,
+        functionEffects,
+        pretty,
+        debug,
+        multipleModules
+    );
+    free(tailCalls.targetTypes);
+    free(functionEffects);
     fprintf(
         file,
         "void %sInstantiate(%sInstance* instance, void* resolve(const char* module, const char* name));\n\n",
         moduleName,
         moduleName
     );
+    fprintf(
+        file,
+        "void %sResetInstance(%sInstance* instance);\n\n",
+        moduleName,
+        moduleName
+    );
     fprintf(
         file,
         "void %sFreeInstance(%sInstance* instance);\n\n",
         moduleName,
         moduleName
     );
+    if (instanceParameters == NULL) {
+        fprintf(
+            file,
+            "%sInstance* %sAcquireInstance(wasmInstancePool* pool, void* resolve(const char* module, const char* name));\n\n",
+            moduleName,
+            moduleName
+        );
+        fprintf(
+            file,
+            "void %sReleaseInstance(wasmInstancePool* pool, %sInstance* instance);\n\n",
+            moduleName,
+            moduleName
+        );
+        fprintf(
+            file,
+            "void %sFreeInstancePool(wasmInstancePool* pool);\n\n",
+            moduleName
+        );
+    }
 
     fputs("#ifdef __cplusplus\n}\n#endif\n\n", file);
 
@@ -5989,21 +10548,37 @@ wasmCWriteInits(
     const char* moduleName,
     FILE* file,
     const WasmDataSegmentMode dataSegmentMode,
+    const WasmCDataSegmentImage* dataSegmentImage,
+    const bool* instanceParameters,
     const bool pretty,
     const bool multipleModules
 ) {
+    const bool singleInstance = instanceParameters != NULL;
+
+    if (singleInstance) {
+        fprintf(file, "%sInstance %s%s;\n\n", moduleName, moduleName, singleInstanceNameSuffix);
+    }
+
     MUST (wasmCWriteModuleFunctionExportsArray(file, module, moduleName, pretty, multipleModules))
 
-    MUST (wasmCWriteInitMemories(file, module, moduleName, dataSegmentMode, pretty))
+    MUST (wasmCWriteInitMemories(file, module, moduleName, dataSegmentMode, dataSegmentImage, pretty))
     MUST (wasmCWriteInitTables(file, module, moduleName, pretty, multipleModules))
     MUST (wasmCWriteInitGlobals(file, module, moduleName, pretty))
     MUST (wasmCWriteInitImports(file, module, moduleName, pretty))
 
-    wasmCWriteExports(file, module, moduleName, true, pretty, multipleModules);
+    wasmCWriteExports(file, module, moduleName, true, singleInstance, pretty, multipleModules);
 
-    wasmCWriteNewChildFunction(file, module, moduleName, pretty, multipleModules);
-    wasmCWriteInstantiateFunction(file, module, moduleName, pretty, multipleModules);
-    wasmCWriteFreeFunction(file, module, moduleName, pretty);
+    /* Child instances, e.g. for threads, need their own globals */
+    if (!singleInstance) {
+        wasmCWriteNewChildFunction(file, module, moduleName, pretty, multipleModules);
+    }
+    wasmCWriteInstantiateFunction(file, module, moduleName, instanceParameters, pretty, multipleModules);
+    wasmCWriteResetFunction(file, module, moduleName, instanceParameters, pretty, multipleModules);
+    wasmCWriteFreeFunction(file, module, moduleName, singleInstance, pretty);
+    /* The single instance cannot be pooled */
+    if (!singleInstance) {
+        wasmCWriteInstancePoolFunctions(file, moduleName, pretty);
+    }
 
     return true;
 }
@@ -6018,21 +10593,21 @@ wasmCWriteImplementationFile(
     WasmDebugLines* debugLines,
     const char filePrefix,
     const U32 fileIndex,
-    const U32 functionsPerFile,
     const U32 startFunctionIDIndex,
+    const U32 endFunctionIDIndex,
     const WasmFunctionIDs functionIDs,
     const bool pretty,
     const bool debug,
-    const bool multipleModules
+    const bool multipleModules,
+    const bool* instanceParameters,
+    const WasmBoundsCheckMode boundsCheckMode,
+    const bool cacheMemoryBase,
+    const bool cacheGlobals,
+    const bool foldExpressions,
+    const WasmCCache* cache
 ) {
     FILE* file = NULL;
     char filename[W2C2_IMPL_FILENAME_LENGTH+1];
-    const U32 functionCount = (U32)functionIDs.length;
-
-    U32 endFunctionIDIndex = startFunctionIDIndex + (U32)functionsPerFile;
-    if (endFunctionIDIndex > functionCount) {
-        endFunctionIDIndex = functionCount;
-    }
 
     /* Do not create empty files */
     if (startFunctionIDIndex > endFunctionIDIndex) {
@@ -6050,6 +10625,7 @@ wasmCWriteImplementationFile(
         );
         return false;
     }
+    setvbuf(file, NULL, _IOFBF, wasmCOutputBufferSize);
 
     wasmCWriteIncludes(file, headerName);
 
@@ -6063,7 +10639,13 @@ wasmCWriteImplementationFile(
         functionIDs,
         pretty,
         debug,
-        multipleModules
+        multipleModules,
+        instanceParameters,
+        boundsCheckMode,
+        cacheMemoryBase,
+        cacheGlobals,
+        foldExpressions,
+        cache
     ))
 
     if (fclose(file) != 0) {
@@ -6079,128 +10661,259 @@ wasmCWriteImplementationFile(
     return true;
 }
 
-#if HAS_PTHREAD
-
-typedef struct WasmCImplementationWriterTask {
-    char filePrefix;
+/* A job writes one implementation file */
+typedef struct WasmCImplementationJob {
     U32 fileIndex;
-    U32 functionsPerFile;
+    U32 startFunctionIDIndex;
+    U32 endFunctionIDIndex;
+    /* Total code size of the functions, as an estimate of the work */
+    size_t codeSize;
+    bool result;
+} WasmCImplementationJob;
+
+typedef struct WasmCImplementationJobs {
     const WasmModule* module;
     const char* moduleName;
     const char* headerName;
-    U32 startFunctionIDIndex;
+    char filePrefix;
     WasmFunctionIDs functionIDs;
-    bool pretty;
-    bool debug;
-    bool multipleModules;
-    bool result;
+    WasmCWriteModuleOptions options;
     WasmDebugLines* debugLines;
-} WasmCImplementationWriterTask;
-
-typedef struct WasmCImplementationConcurrentWriter {
+    const bool* instanceParameters;
+    const WasmCCache* cache;
+    WasmCImplementationJob* jobs;
+    U32 count;
+    /* Index of the next job to be claimed */
+    U32 nextJobIndex;
+#if HAS_PTHREAD
     pthread_mutex_t mutex;
-    pthread_cond_t consume;
-    pthread_cond_t produce;
-    WasmCImplementationWriterTask* task;
-    bool done;
-} WasmCImplementationConcurrentWriter;
+#endif /* HAS_PTHREAD */
+} WasmCImplementationJobs;
 
+/*
+ * wasmCImplementationJobCompare orders jobs by decreasing code size,
+ * so the largest files are written first and do not delay the end,
+ * and by file index for jobs with the same size
+ */
 static
-WasmCImplementationConcurrentWriter
-wasmCImplementationConcurrentWriterNew(
-    void
+int
+wasmCImplementationJobCompare(
+    const void* a,
+    const void* b
 ) {
-    WasmCImplementationConcurrentWriter writer;
-    pthread_mutex_init(&writer.mutex, NULL);
-    pthread_cond_init(&writer.consume, NULL);
-    pthread_cond_init(&writer.produce, NULL);
-    writer.task = NULL;
-    writer.done = false;
-    return writer;
+    const WasmCImplementationJob* job1 = (const WasmCImplementationJob*)a;
+    const WasmCImplementationJob* job2 = (const WasmCImplementationJob*)b;
+
+    if (job1->codeSize != job2->codeSize) {
+        return job1->codeSize > job2->codeSize ? -1 : 1;
+    }
+    if (job1->fileIndex != job2->fileIndex) {
+        return job1->fileIndex < job2->fileIndex ? -1 : 1;
+    }
+    return 0;
 }
 
+/*
+ * wasmCImplementationFileEnd determines the end of the file which starts with the given function:
+ * Functions are added in order, until either the number of functions or the code size limit is reached.
+ * A file contains at least one function, even if it exceeds the code size limit
+ */
 static
-void
-wasmCImplementationConcurrentWriterDestroy(
-    WasmCImplementationConcurrentWriter* writer
+U32
+wasmCImplementationFileEnd(
+    const WasmModule* module,
+    const WasmFunctionIDs functionIDs,
+    const U32 startFunctionIDIndex,
+    const U32 functionsPerFile,
+    const U32 bytesPerFile,
+    size_t* codeSize
 ) {
-    pthread_mutex_destroy(&writer->mutex);
-    pthread_cond_destroy(&writer->consume);
-    pthread_cond_destroy(&writer->produce);
+    const U32 functionCount = (U32)functionIDs.length;
+
+    U32 functionIDIndex = startFunctionIDIndex;
+    *codeSize = 0;
+
+    for (; functionIDIndex < functionCount; functionIDIndex++) {
+        const WasmFunctionID functionID = functionIDs.functionIDs[functionIDIndex];
+        const size_t functionCodeSize = module->functions.functions[functionID.functionIndex].code.length;
+
+        if (functionIDIndex - startFunctionIDIndex >= functionsPerFile) {
+            break;
+        }
+        if (bytesPerFile > 0
+            && functionIDIndex > startFunctionIDIndex
+            && *codeSize + functionCodeSize > bytesPerFile
+        ) {
+            break;
+        }
+
+        *codeSize += functionCodeSize;
+    }
+
+    return functionIDIndex;
 }
 
 static
-void*
-wasmCImplementationWriterThread(
-    void* arg
+bool
+WARN_UNUSED_RESULT
+wasmCImplementationJobsCreate(
+    WasmCImplementationJobs* jobs,
+    const WasmModule* module,
+    const WasmFunctionIDs functionIDs,
+    const U32 functionsPerFile,
+    const U32 bytesPerFile,
+    const bool ordered
 ) {
-    WasmCImplementationConcurrentWriter* writer = (WasmCImplementationConcurrentWriter*)arg;
+    const U32 functionCount = (U32)functionIDs.length;
 
-    while (true) {
-        pthread_mutex_lock(&writer->mutex);
-        pthread_cond_signal(&writer->produce);
+    U32 fileCount = 0;
+    U32 fileIndex = 0;
+    U32 functionIDIndex = 0;
+    size_t codeSize = 0;
 
-        while (!writer->done && writer->task == NULL) {
-            pthread_cond_wait(
-                &writer->consume,
-                &writer->mutex
-            );
-        }
+    for (; functionIDIndex < functionCount; fileCount++) {
+        functionIDIndex = wasmCImplementationFileEnd(
+            module,
+            functionIDs,
+            functionIDIndex,
+            functionsPerFile,
+            bytesPerFile,
+            &codeSize
+        );
+    }
 
-        if (writer->done) {
-            pthread_mutex_unlock(&writer->mutex);
-            return NULL;
-        }
+    jobs->jobs = calloc(fileCount, sizeof(WasmCImplementationJob));
+    if (jobs->jobs == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate implementation jobs\n");
+        return false;
+    }
+    jobs->count = fileCount;
+    jobs->nextJobIndex = 0;
 
-        {
-            const WasmCImplementationWriterTask* task = writer->task;
-
-            const WasmModule* module = task->module;
-            const char* moduleName = task->moduleName;
-            const char* headerName = task->headerName;
-            const char filePrefix = task->filePrefix;
-            const U32 fileIndex = task->fileIndex;
-            const U32 functionsPerFile = task->functionsPerFile;
-            const U32 startFunctionIDIndex = task->startFunctionIDIndex;
-            const WasmFunctionIDs functionIDs = task->functionIDs;
-            const bool pretty = task->pretty;
-            const bool debug = task->debug;
-            const bool multipleModules = task->multipleModules;
-            WasmDebugLines* debugLines = task->debugLines;
-
-            writer->task = NULL;
-
-            pthread_mutex_unlock(&writer->mutex);
-
-            {
-                const bool result = wasmCWriteImplementationFile(
-                    module,
-                    moduleName,
-                    headerName,
-                    debugLines,
-                    filePrefix,
-                    fileIndex,
-                    functionsPerFile,
-                    startFunctionIDIndex,
-                    functionIDs,
-                    pretty,
-                    debug,
-                    multipleModules
-                );
-                if (!result) {
-                    const WasmFunctionID startFunctionID = functionIDs.functionIDs[startFunctionIDIndex];
-                    fprintf(
-                        stderr,
-                        "w2c2: failed to write implementation file %d. start function index: %d\n",
-                        fileIndex,
-                        startFunctionID.functionIndex
-                    );
-                    exit(1);
-                }
-            }
-        }
+    functionIDIndex = 0;
+    for (; fileIndex < fileCount; fileIndex++) {
+        WasmCImplementationJob* job = &jobs->jobs[fileIndex];
+
+        job->fileIndex = fileIndex;
+        job->startFunctionIDIndex = functionIDIndex;
+        job->endFunctionIDIndex = wasmCImplementationFileEnd(
+            module,
+            functionIDs,
+            functionIDIndex,
+            functionsPerFile,
+            bytesPerFile,
+            &job->codeSize
+        );
+        job->result = false;
+
+        functionIDIndex = job->endFunctionIDIndex;
+    }
+
+    /* Debug lines are consumed in order of the functions */
+    if (!ordered) {
+        qsort(
+            jobs->jobs,
+            fileCount,
+            sizeof(WasmCImplementationJob),
+            wasmCImplementationJobCompare
+        );
+    }
+
+    return true;
+}
+
+/*
+ * wasmCImplementationJobsClaim claims the next job.
+ * Returns NULL if all jobs have been claimed
+ */
+static
+W2C2_INLINE
+WasmCImplementationJob*
+wasmCImplementationJobsClaim(
+    WasmCImplementationJobs* jobs
+) {
+    U32 jobIndex = 0;
+#if HAS_PTHREAD
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+    jobIndex = __sync_fetch_and_add(&jobs->nextJobIndex, 1);
+#else
+    pthread_mutex_lock(&jobs->mutex);
+    jobIndex = jobs->nextJobIndex++;
+    pthread_mutex_unlock(&jobs->mutex);
+#endif
+#else
+    jobIndex = jobs->nextJobIndex++;
+#endif /* HAS_PTHREAD */
+
+    if (jobIndex >= jobs->count) {
+        return NULL;
+    }
+    return &jobs->jobs[jobIndex];
+}
+
+#if HAS_PTHREAD
+
+/*
+ * wasmCImplementationJobsCancel stops handing out jobs.
+ * Jobs which have already been claimed are still written
+ */
+static
+void
+wasmCImplementationJobsCancel(
+    WasmCImplementationJobs* jobs
+) {
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+    (void)__sync_lock_test_and_set(&jobs->nextJobIndex, jobs->count);
+#else
+    pthread_mutex_lock(&jobs->mutex);
+    jobs->nextJobIndex = jobs->count;
+    pthread_mutex_unlock(&jobs->mutex);
+#endif
+}
+
+#endif /* HAS_PTHREAD */
+
+/* wasmCImplementationJobsRun writes implementation files until all jobs have been claimed */
+static
+void
+wasmCImplementationJobsRun(
+    WasmCImplementationJobs* jobs
+) {
+    const WasmCWriteModuleOptions options = jobs->options;
+
+    WasmCImplementationJob* job = NULL;
+    while ((job = wasmCImplementationJobsClaim(jobs)) != NULL) {
+        job->result = wasmCWriteImplementationFile(
+            jobs->module,
+            jobs->moduleName,
+            jobs->headerName,
+            jobs->debugLines,
+            jobs->filePrefix,
+            job->fileIndex,
+            job->startFunctionIDIndex,
+            job->endFunctionIDIndex,
+            jobs->functionIDs,
+            options.pretty,
+            options.debug,
+            options.multipleModules,
+            jobs->instanceParameters,
+            options.boundsCheckMode,
+            options.cacheMemoryBase,
+            options.cacheGlobals,
+            options.foldExpressions,
+            jobs->cache
+        );
     }
+}
+
+#if HAS_PTHREAD
 
+static
+void*
+wasmCImplementationWriterThread(
+    void* arg
+) {
+    wasmCImplementationJobsRun((WasmCImplementationJobs*)arg);
     return NULL;
 }
 
@@ -6215,48 +10928,73 @@ wasmCWriteModuleImplementationFiles(
     const char* headerName,
     WasmFunctionIDs functionIDs,
     char filePrefix,
-    WasmCWriteModuleOptions options
+    WasmCWriteModuleOptions options,
+    const bool* instanceParameters,
+    const WasmCCache* cache
 ) {
     WasmDebugLines debugLines = module->debugLines;
+    WasmCImplementationJobs jobs;
 
-    U32 fileIndex = 0;
-    const size_t functionCount = functionIDs.length;
     U32 functionsPerFile = options.functionsPerFile;
-    size_t fileCount = 0;
-    if (functionCount == 0) {
+    bool result = true;
+
+    if (functionIDs.length == 0) {
         return true;
     }
     if (functionsPerFile == 0) {
         functionsPerFile = UINT32_MAX;
     }
-    fileCount = 1 + (functionCount - 1) / functionsPerFile;
 
-    {
+    jobs.module = module;
+    jobs.moduleName = moduleName;
+    jobs.headerName = headerName;
+    jobs.filePrefix = filePrefix;
+    jobs.functionIDs = functionIDs;
+    jobs.options = options;
+    jobs.debugLines = NULL;
+    jobs.instanceParameters = instanceParameters;
+    jobs.cache = cache;
 
+    {
 #if HAS_PTHREAD
         U32 threadCount = options.threadCount;
-        pthread_t* threads = calloc(threadCount, sizeof(pthread_t));
-        U32 jobIndex = 0;
+        pthread_t* threads = NULL;
+        U32 threadIndex = 0;
+
+        /* Debug lines can only be consumed by a single thread */
+        if (options.debug && threadCount == 1) {
+            jobs.debugLines = &debugLines;
+        }
+
+        MUST (wasmCImplementationJobsCreate(
+            &jobs,
+            module,
+            functionIDs,
+            functionsPerFile,
+            options.bytesPerFile,
+            jobs.debugLines != NULL
+        ))
 
-        bool setDebugLines = options.debug && options.threadCount == 1;
+        /* Do not start more threads than there are jobs */
+        if (threadCount > jobs.count) {
+            threadCount = jobs.count;
+        }
 
-        WasmCImplementationConcurrentWriter writer = wasmCImplementationConcurrentWriterNew();
+        threads = calloc(threadCount, sizeof(pthread_t));
+        if (threads == NULL) {
+            fprintf(stderr, "w2c2: failed to allocate implementation threads\n");
+            free(jobs.jobs);
+            return false;
+        }
 
-        WasmCImplementationWriterTask task;
-        task.functionsPerFile = functionsPerFile;
-        task.module = module;
-        task.moduleName = moduleName;
-        task.headerName = headerName;
-        task.pretty = options.pretty;
-        task.debug = options.debug;
-        task.multipleModules = options.multipleModules;
+        pthread_mutex_init(&jobs.mutex, NULL);
 
-        for (; jobIndex < threadCount; jobIndex++) {
+        for (; threadIndex < threadCount; threadIndex++) {
             int err = pthread_create(
-                &threads[jobIndex],
+                &threads[threadIndex],
                 NULL,
                 wasmCImplementationWriterThread,
-                &writer
+                &jobs
             );
             if (err) {
                 fprintf(
@@ -6264,85 +11002,66 @@ wasmCWriteModuleImplementationFiles(
                     "w2c2: failed to create implementations thread: %s\n",
                     strerror(err)
                 );
-                return false;
+                /* The threads which were already created still use the jobs, so they must be joined */
+                wasmCImplementationJobsCancel(&jobs);
+                threadCount = threadIndex;
+                result = false;
+                break;
             }
         }
-#endif /* HAS_PTHREAD */
 
-        for (; fileIndex < fileCount; fileIndex++) {
-            U32 startFunctionIDIndex = fileIndex * functionsPerFile;
-#if HAS_PTHREAD
-            pthread_mutex_lock(&writer.mutex);
-
-            while (writer.task != NULL) {
-                pthread_cond_wait(
-                    &writer.produce,
-                    &writer.mutex
-                );
-            }
-
-            task.filePrefix = filePrefix;
-            task.fileIndex = fileIndex;
-            task.startFunctionIDIndex = startFunctionIDIndex;
-            task.functionIDs = functionIDs;
-            if (setDebugLines) {
-                task.debugLines = &debugLines;
-            } else {
-                task.debugLines = NULL;
+        for (threadIndex = 0; threadIndex < threadCount; threadIndex++) {
+            int err = pthread_join(threads[threadIndex], NULL);
+            if (err) {
+                fprintf(stderr, "w2c2: failed to join writer thread: %s\n", strerror(err));
+                result = false;
             }
+        }
 
-            writer.task = &task;
+        free(threads);
 
-            pthread_cond_signal(&writer.consume);
-            pthread_mutex_unlock(&writer.mutex);
+        pthread_mutex_destroy(&jobs.mutex);
 
-#else
-            MUST (wasmCWriteImplementationFile(
-                module,
-                moduleName,
-                headerName,
-                &debugLines,
-                filePrefix,
-                fileIndex,
-                functionsPerFile,
-                startFunctionIDIndex,
-                functionIDs,
-                options.pretty,
-                options.debug,
-                options.multipleModules
-            ))
-#endif /* HAS_PTHREAD */
+        if (!result) {
+            free(jobs.jobs);
+            return false;
         }
-#if HAS_PTHREAD
-
-        pthread_mutex_lock(&writer.mutex);
+#else
+        jobs.debugLines = &debugLines;
 
-        while (writer.task != NULL) {
-            pthread_cond_wait(
-                &writer.produce,
-                &writer.mutex
-            );
-        }
+        MUST (wasmCImplementationJobsCreate(
+            &jobs,
+            module,
+            functionIDs,
+            functionsPerFile,
+            options.bytesPerFile,
+            true
+        ))
 
-        writer.done = true;
-        pthread_cond_broadcast(&writer.consume);
-        pthread_mutex_unlock(&writer.mutex);
+        wasmCImplementationJobsRun(&jobs);
+#endif /* HAS_PTHREAD */
+    }
 
-        for (jobIndex = 0; jobIndex < threadCount; jobIndex++) {
-            int err = pthread_join(threads[jobIndex], NULL);
-            if (err) {
-                fprintf(stderr, "w2c2: failed to join writer thread: %s\n", strerror(err));
-                return false;
+    {
+        U32 jobIndex = 0;
+        for (; jobIndex < jobs.count; jobIndex++) {
+            const WasmCImplementationJob job = jobs.jobs[jobIndex];
+            if (!job.result) {
+                const WasmFunctionID startFunctionID = functionIDs.functionIDs[job.startFunctionIDIndex];
+                fprintf(
+                    stderr,
+                    "w2c2: failed to write implementation file %d. start function index: %d\n",
+                    job.fileIndex,
+                    startFunctionID.functionIndex
+                );
+                result = false;
             }
         }
-
-        free(threads);
-
-        wasmCImplementationConcurrentWriterDestroy(&writer);
-#endif /* HAS_PTHREAD */
     }
 
-    return true;
+    free(jobs.jobs);
+
+    return result;
 }
 
 static
@@ -6355,10 +11074,16 @@ wasmCWriteModuleImplementation(
     const char* headerName,
     const WasmFunctionIDs staticFunctionIDs,
     const WasmFunctionIDs dynamicFunctionIDs,
-    const WasmCWriteModuleOptions options
+    const WasmCWriteModuleOptions options,
+    const bool* instanceParameters
 ) {
     /* Create file */
     FILE* file = NULL;
+    WasmCCache cache;
+    const WasmCCache* cachePointer = NULL;
+    WasmCDataSegmentImage dataSegmentImage = wasmCEmptyDataSegmentImage;
+
+    MUST (wasmCLayOutDataSegments(module, options.dataSegmentImage, &dataSegmentImage))
 
     file = fopen(filename, "w");
     if (file == NULL) {
@@ -6370,6 +11095,7 @@ wasmCWriteModuleImplementation(
         );
         return false;
     }
+    setvbuf(file, NULL, _IOFBF, wasmCOutputBufferSize);
 
     wasmCWriteIncludes(file, headerName);
 
@@ -6380,7 +11106,8 @@ wasmCWriteModuleImplementation(
             wasmCWriteDataSegmentsFromSection(
                 file,
                 module,
-                options.dataSegmentMode
+                options.dataSegmentMode,
+                &dataSegmentImage
             );
             break;
         }
@@ -6402,7 +11129,15 @@ wasmCWriteModuleImplementation(
 
     /* Write implementations */
 
+    /* Debug lines are consumed in order, so functions with debug information cannot be cached */
+    if (options.cacheDirectory != NULL && !options.debug) {
+        cache.directory = options.cacheDirectory;
+        wasmCCacheInitialize(&cache, module, moduleName, options);
+        cachePointer = &cache;
+    }
+
     if (options.functionsPerFile >= module->functions.count
+        && options.bytesPerFile == 0
         && dynamicFunctionIDs.length == 0)
     {
         WasmDebugLines debugLines = module->debugLines;
@@ -6417,7 +11152,13 @@ wasmCWriteModuleImplementation(
             staticFunctionIDs,
             options.pretty,
             options.debug,
-            options.multipleModules
+            options.multipleModules,
+            instanceParameters,
+            options.boundsCheckMode,
+            options.cacheMemoryBase,
+            options.cacheGlobals,
+            options.foldExpressions,
+            cachePointer
         ))
     } else {
 
@@ -6427,7 +11168,9 @@ wasmCWriteModuleImplementation(
             headerName,
             staticFunctionIDs,
             's',
-            options
+            options,
+            instanceParameters,
+            cachePointer
         ))
 
         MUST (wasmCWriteModuleImplementationFiles(
@@ -6436,7 +11179,9 @@ wasmCWriteModuleImplementation(
             headerName,
             dynamicFunctionIDs,
             'd',
-            options
+            options,
+            instanceParameters,
+            cachePointer
         ))
     }
 
@@ -6447,10 +11192,14 @@ wasmCWriteModuleImplementation(
         moduleName,
         file,
         options.dataSegmentMode,
+        &dataSegmentImage,
+        instanceParameters,
         options.pretty,
         options.multipleModules
     ))
 
+    wasmCDataSegmentImageFree(&dataSegmentImage);
+
     /* Close file */
 
     if (fclose(file) != 0) {
@@ -6477,6 +11226,11 @@ wasmCWriteModule(
 ) {
     char outputName[PATH_MAX];
     char headerName[PATH_MAX];
+    bool* instanceParameters = NULL;
+    bool* reachableFunctions = NULL;
+    WasmFunctionIDs reachableStaticFunctionIDs = emptyWasmFunctionIDs;
+    WasmFunctionIDs reachableDynamicFunctionIDs = emptyWasmFunctionIDs;
+    bool result = true;
 
     const char* outputPath = options.outputPath;
 
@@ -6493,24 +11247,227 @@ wasmCWriteModule(
         strcpy(headerExt, ".h");
     }
 
-    MUST (wasmCWriteModuleHeader(
+    /* Functions which are not reachable are neither declared nor defined */
+    if (options.treeShake) {
+        result = wasmCScanReachableFunctions(module, &reachableFunctions)
+            && wasmCFilterReachableFunctionIDs(staticFunctionIDs, reachableFunctions, &reachableStaticFunctionIDs)
+            && wasmCFilterReachableFunctionIDs(dynamicFunctionIDs, reachableFunctions, &reachableDynamicFunctionIDs);
+    }
+
+    if (result && options.singleInstance) {
+        result = wasmCScanInstanceParameters(module, &instanceParameters);
+    }
+
+    result = result && wasmCWriteModuleHeader(
         module,
         moduleName,
         headerName,
+        instanceParameters,
+        reachableFunctions,
         options.pretty,
         options.debug,
         options.multipleModules
-    ))
-
-    MUST (wasmCWriteModuleImplementation(
+    ) && wasmCWriteModuleImplementation(
         module,
         moduleName,
         outputName,
         headerName,
-        staticFunctionIDs,
-        dynamicFunctionIDs,
-        options
-    ))
+        options.treeShake ? reachableStaticFunctionIDs : staticFunctionIDs,
+        options.treeShake ? reachableDynamicFunctionIDs : dynamicFunctionIDs,
+        options,
+        instanceParameters
+    );
+
+    free(instanceParameters);
+    free(reachableFunctions);
+    wasmFunctionIDsFree(&reachableStaticFunctionIDs);
+    wasmFunctionIDsFree(&reachableDynamicFunctionIDs);
+
+    return result;
+}
+
+/* wasmCWriteFileStringLiteral writes the given string as a C string literal */
+static
+void
+wasmCWriteFileStringLiteral(
+    FILE* file,
+    const char* string
+) {
+    fputc('"', file);
+    for (; *string != '\0'; string++) {
+        const unsigned char c = (unsigned char) *string;
+        if (c < 0x20 || c >= 0x7F || c == '"' || c == '\\' || c == '?') {
+            fprintf(file, "\\%03o", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSnapshotDriver(
+    const WasmModule* module,
+    const char* moduleName,
+    const char* headerName,
+    const char* exportName,
+    const char* filename
+) {
+    const U32 memoryImportCount = assertSizeU32(module->memoryImports.length);
+    const U32 tableImportCount = assertSizeU32(module->tableImports.length);
+    const U32 globalImportCount = assertSizeU32(module->globalImports.length);
+    FILE* file = fopen(filename, "w");
+
+    if (file == NULL) {
+        fprintf(
+            stderr,
+            "w2c2: failed to open snapshot driver file %s: %s\n",
+            filename,
+            strerror(errno)
+        );
+        return false;
+    }
+
+    fputs("#include <stdio.h>\n#include <stdlib.h>\n", file);
+    fprintf(file, "#include \"%s\"\n\n", headerName);
+
+    fputs(
+        "static void snapshotFail(const char* message, const char* detail) NORETURN;\n\n"
+        "static void snapshotFail(const char* message, const char* detail) {\n"
+        "fprintf(stderr, \"w2c2: snapshot failed: %s%s\\n\", message, detail);\n"
+        "exit(EXIT_FAILURE);\n"
+        "}\n\n"
+        "void trap(Trap trap) {\n"
+        "snapshotFail(\"trap: \", trapDescription(trap));\n"
+        "}\n\n",
+        file
+    );
+
+    /* Imported functions cannot be called, as their effects would not be part of the snapshot */
+    {
+        const size_t functionImportCount = module->functionImports.length;
+        size_t importIndex = 0;
+        for (; importIndex < functionImportCount; importIndex++) {
+            const WasmFunctionImport import = module->functionImports.imports[importIndex];
+            const WasmFunctionType functionType = module->functionTypes.functionTypes[import.functionTypeIndex];
+            wasmCWriteFileReturnType(file, functionType);
+            fputc(' ', file);
+            wasmCWriteFileImportName(file, import.module, import.name);
+            wasmCWriteFileParameters(file, moduleName, functionType, true, true, true, false);
+            fputs(" {\nsnapshotFail(\"called import \", ", file);
+            wasmCWriteFileStringLiteral(file, import.name);
+            fputs(");\n", file);
+            if (functionType.resultCount > 0) {
+                wasmCWriteFileReturnType(file, functionType);
+                fputs(" result;\nmemset(&result, 0, sizeof(result));\nreturn result;\n", file);
+            }
+            fputs("}\n\n", file);
+        }
+    }
+
+    fputs("int main(int argc, char* argv[]) {\n", file);
+    fprintf(file, "static %sInstance fresh;\n", moduleName);
+    fprintf(file, "static %sInstance instance;\n", moduleName);
+    fputs(
+        "FILE* file = NULL;\n"
+        "if (argc != 2) {\n"
+        "snapshotFail(\"missing snapshot path\", \"\");\n"
+        "}\n",
+        file
+    );
+    fprintf(file, "%sInstantiate(&fresh, NULL);\n", moduleName);
+    fprintf(file, "%sInstantiate(&instance, NULL);\n", moduleName);
+
+    /*
+     * The module of the program has no start function, so the tables of the fresh instance
+     * are as the element segments leave them, like the tables of the snapshot module
+     */
+    if (module->hasStartFunction) {
+        fprintf(file, "{\n%sInstance* i = &instance;\n", moduleName);
+        wasmCWriteStartFunctionCall(file, module, moduleName, NULL, false, false);
+        fputs("}\n", file);
+    }
+
+    wasmCWriteExportName(file, moduleName, exportName);
+    fputs("(&instance);\n", file);
+
+    /* Tables hold function pointers, which cannot be part of the snapshot */
+    {
+        U32 tableIndex = 0;
+        for (; tableIndex < module->tables.count; tableIndex++) {
+            const U32 moduleTableIndex = tableImportCount + tableIndex;
+            fputs("if (fresh.", file);
+            wasmCWriteFileTableNonImportName(file, moduleTableIndex);
+            fputs(".size != instance.", file);
+            wasmCWriteFileTableNonImportName(file, moduleTableIndex);
+            fputs(".size || memcmp(fresh.", file);
+            wasmCWriteFileTableNonImportName(file, moduleTableIndex);
+            fputs(".data, instance.", file);
+            wasmCWriteFileTableNonImportName(file, moduleTableIndex);
+            fputs(".data, fresh.", file);
+            wasmCWriteFileTableNonImportName(file, moduleTableIndex);
+            fputs(".size * sizeof(wasmFunc)) != 0) {\nsnapshotFail(\"modified a table\", \"\");\n}\n", file);
+        }
+    }
+
+    fputs(
+        "file = fopen(argv[1], \"wb\");\n"
+        "if (file == NULL) {\n"
+        "snapshotFail(\"cannot open \", argv[1]);\n"
+        "}\n",
+        file
+    );
+
+    {
+        U32 memoryIndex = 0;
+        for (; memoryIndex < module->memories.count; memoryIndex++) {
+            const U32 moduleMemoryIndex = memoryImportCount + memoryIndex;
+            fputs("if (fwrite(&instance.", file);
+            wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
+            fputs("->pages, sizeof(U32), 1, file) != 1\n|| fwrite(instance.", file);
+            wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
+            fputs("->data, 1, instance.", file);
+            wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
+            fputs("->size, file) != instance.", file);
+            wasmCWriteFileMemoryNonImportName(file, moduleMemoryIndex);
+            fputs("->size) {\nsnapshotFail(\"cannot write memory\", \"\");\n}\n", file);
+        }
+    }
+
+    {
+        U32 globalIndex = 0;
+        for (; globalIndex < module->globals.count; globalIndex++) {
+            const WasmGlobal global = module->globals.globals[globalIndex];
+            if (!global.type.mutable) {
+                continue;
+            }
+            fputs("if (fwrite(&instance.", file);
+            wasmCWriteFileGlobalNonImportName(file, globalImportCount + globalIndex);
+            fputs(", sizeof(instance.", file);
+            wasmCWriteFileGlobalNonImportName(file, globalImportCount + globalIndex);
+            fputs("), 1, file) != 1) {\nsnapshotFail(\"cannot write global\", \"\");\n}\n", file);
+        }
+    }
+
+    fputs(
+        "if (fclose(file) != 0) {\n"
+        "snapshotFail(\"cannot close \", argv[1]);\n"
+        "}\n"
+        "return EXIT_SUCCESS;\n"
+        "}\n",
+        file
+    );
+
+    if (fclose(file) != 0) {
+        fprintf(
+            stderr,
+            "w2c2: failed to close snapshot driver file %s: %s\n",
+            filename,
+            strerror(errno)
+        );
+        return false;
+    }
 
     return true;
 }
@@ -3,6 +3,7 @@
 
 #include "w2c2_base.h"
 #include "module.h"
+#include "boundscheck.h"
 
 #define W2C2_IMPL_FILENAME_LENGTH 13
 
@@ -10,14 +11,30 @@ typedef struct WasmCWriteModuleOptions {
     const char* outputPath;
     U32 threadCount;
     U32 functionsPerFile;
+    /* Maximum code size of the functions per file, 0 if unlimited */
+    U32 bytesPerFile;
     bool pretty;
     bool debug;
     bool multipleModules;
     WasmDataSegmentMode dataSegmentMode;
+    /* Start the data segments file with a page-aligned image of the first memory, which can be mapped */
+    bool dataSegmentImage;
+    WasmBoundsCheckMode boundsCheckMode;
+    bool cacheMemoryBase;
+    /* Cache mutable globals in local variables */
+    bool cacheGlobals;
+    /* Fold single-use stack values into nested expressions */
+    bool foldExpressions;
+    /* Store the instance statically, and only pass it to functions which may be called indirectly */
+    bool singleInstance;
+    /* Only write the functions reachable from the exports, the start function, and the element segments */
+    bool treeShake;
+    /* Directory of the cache of generated functions, NULL if disabled */
+    const char* cacheDirectory;
 } WasmCWriteModuleOptions;
 
 static const WasmCWriteModuleOptions emptyWasmCWriteModuleOptions ={
-    NULL, 0, 0, false, false, false, wasmDataSegmentModeArrays
+    NULL, 0, 0, 0, false, false, false, wasmDataSegmentModeArrays, false, wasmBoundsCheckModeNone, false, false, false, false, false, NULL
 };
 
 bool
@@ -30,4 +47,22 @@ wasmCWriteModule(
     WasmFunctionIDs dynamicFunctionIDs
 );
 
+/*
+ * wasmCWriteSnapshotDriver writes a program for the module, as written by wasmCWriteModule
+ * without its start function with the given header, which instantiates the module,
+ * calls the start function and the given export,
+ * and writes the state of the instance to the file given as its argument:
+ * the number of pages and the data of each memory, followed by the value of each mutable global.
+ * The program fails if the export calls an imported function, traps, or modifies a table.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmCWriteSnapshotDriver(
+    const WasmModule* module,
+    const char* moduleName,
+    const char* headerName,
+    const char* exportName,
+    const char* filename
+);
+
 #endif /* W2C2_C_H */
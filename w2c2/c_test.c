@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if HAS_PTHREAD && HAS_UNISTD
+  #include <unistd.h>
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+#include "c.h"
+#include "c_test.h"
+#include "reader.h"
+
+#if HAS_PTHREAD && HAS_UNISTD
+
+/* Enough functions with the same body that many threads write the same cache entry */
+#define CACHE_TEST_FUNCTION_COUNT 400
+
+static
+void
+testCacheFail(
+    const char* message
+) {
+    fprintf(stderr, "FAIL testCacheConcurrentWrites: %s\n", message);
+    exit(1);
+}
+
+static
+U8*
+testCacheWriteU32LEB128(
+    U8* data,
+    U32 value
+) {
+    do {
+        U8 byte = (U8)(value & 0x7F);
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        *data++ = byte;
+    } while (value != 0);
+    return data;
+}
+
+/*
+ * testCacheModule returns a module with functions which all have the same type and body
+ */
+static
+Buffer
+testCacheModule(void) {
+    /* (func (param i32) (result i32) (i32.add (local.get 0) (i32.mul (local.get 0) (i32.const 3)))) */
+    static const U8 body[] = {0x00, 0x20, 0x00, 0x20, 0x00, 0x41, 0x03, 0x6C, 0x6A, 0x0B};
+    static const U8 header[] = {
+        0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00,
+        /* Type section: (i32) -> i32 */
+        0x01, 0x06, 0x01, 0x60, 0x01, 0x7F, 0x01, 0x7F
+    };
+
+    Buffer result = {NULL, 0};
+    U8* data = malloc(sizeof(header) + 16 + CACHE_TEST_FUNCTION_COUNT * (2 + sizeof(body)));
+    U32 index = 0;
+
+    if (data == NULL) {
+        testCacheFail("failed to allocate module");
+    }
+    result.data = data;
+
+    memcpy(data, header, sizeof(header));
+    data += sizeof(header);
+
+    /* Function section */
+    *data++ = 0x03;
+    data = testCacheWriteU32LEB128(data, 2 + CACHE_TEST_FUNCTION_COUNT);
+    data = testCacheWriteU32LEB128(data, CACHE_TEST_FUNCTION_COUNT);
+    for (index = 0; index < CACHE_TEST_FUNCTION_COUNT; index++) {
+        *data++ = 0x00;
+    }
+
+    /* Code section */
+    *data++ = 0x0A;
+    data = testCacheWriteU32LEB128(data, 2 + CACHE_TEST_FUNCTION_COUNT * (1 + (U32)sizeof(body)));
+    data = testCacheWriteU32LEB128(data, CACHE_TEST_FUNCTION_COUNT);
+    for (index = 0; index < CACHE_TEST_FUNCTION_COUNT; index++) {
+        *data++ = (U8)sizeof(body);
+        memcpy(data, body, sizeof(body));
+        data += sizeof(body);
+    }
+
+    result.length = (size_t)(data - result.data);
+    return result;
+}
+
+/*
+ * testCacheRemoveFiles removes the files in the directory, and returns how many were removed.
+ * If temporaryCount is not NULL, it is set to the number of files which are not cache entries
+ */
+static
+U32
+testCacheRemoveFiles(
+    const char* directory,
+    U32* temporaryCount
+) {
+    DIR* dir = opendir(directory);
+    struct dirent* entry = NULL;
+    char path[1024];
+    U32 count = 0;
+
+    if (temporaryCount != NULL) {
+        *temporaryCount = 0;
+    }
+    if (dir == NULL) {
+        testCacheFail("failed to open directory");
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        const size_t length = strlen(entry->d_name);
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        if (temporaryCount != NULL
+            && (length < 2 || strcmp(entry->d_name + length - 2, ".c") != 0)
+        ) {
+            (*temporaryCount)++;
+        }
+        sprintf(path, "%s/%s", directory, entry->d_name);
+        remove(path);
+        count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+void
+testCacheConcurrentWrites(void) {
+    static const U32 runCount = 5;
+
+    char directory[] = "/tmp/w2c2_cache_test_XXXXXX";
+    char cacheDirectory[64];
+    char currentDirectory[1024];
+    WasmModuleReader reader = emptyWasmModuleReader;
+    WasmModuleReaderError* error = NULL;
+    Buffer module = testCacheModule();
+    WasmCWriteModuleOptions options = emptyWasmCWriteModuleOptions;
+    WasmFunctionIDs functionIDs = emptyWasmFunctionIDs;
+    U32 run = 0;
+    U32 index = 0;
+
+    reader.buffer = module;
+    wasmModuleRead(&reader, &error);
+    if (error != NULL) {
+        testCacheFail(wasmModuleReaderErrorMessage(error));
+    }
+
+    for (index = 0; index < CACHE_TEST_FUNCTION_COUNT; index++) {
+        WasmFunctionID functionID = emptyWasmFunctionID;
+        memcpy(functionID.hash, reader.module->functions.functions[index].hash, SHA1_DIGEST_LENGTH);
+        functionID.functionIndex = index;
+        if (!wasmFunctionIDsAppend(&functionIDs, functionID)) {
+            testCacheFail("failed to append function ID");
+        }
+    }
+
+    if (getcwd(currentDirectory, sizeof(currentDirectory)) == NULL
+        || mkdtemp(directory) == NULL
+        || chdir(directory) != 0
+    ) {
+        testCacheFail("failed to create output directory");
+    }
+    sprintf(cacheDirectory, "%s/cache", directory);
+
+    options.outputPath = "m.c";
+    options.threadCount = 16;
+    options.functionsPerFile = 1;
+    options.cacheDirectory = cacheDirectory;
+
+    for (; run < runCount; run++) {
+        U32 temporaryCount = 0;
+
+        if (mkdir(cacheDirectory, 0777) != 0 && errno != EEXIST) {
+            testCacheFail("failed to create cache directory");
+        }
+
+        /* All threads write the cache entry of the same body */
+        if (!wasmCWriteModule(reader.module, "m", options, functionIDs, emptyWasmFunctionIDs)) {
+            testCacheFail("failed to write module with empty cache");
+        }
+        /* All threads read the cache entry */
+        if (!wasmCWriteModule(reader.module, "m", options, functionIDs, emptyWasmFunctionIDs)) {
+            testCacheFail("failed to write module with cache");
+        }
+
+        if (testCacheRemoveFiles(cacheDirectory, &temporaryCount) != 1) {
+            testCacheFail("incorrect number of cache entries");
+        }
+        if (temporaryCount != 0) {
+            testCacheFail("temporary cache files were left behind");
+        }
+        if (rmdir(cacheDirectory) != 0) {
+            testCacheFail("failed to remove cache directory");
+        }
+    }
+
+    testCacheRemoveFiles(directory, NULL);
+    if (chdir(currentDirectory) != 0 || rmdir(directory) != 0) {
+        testCacheFail("failed to remove output directory");
+    }
+
+    free(functionIDs.functionIDs);
+    free(module.data);
+}
+
+#else
+
+void
+testCacheConcurrentWrites(void) {
+    /* The cache is only written concurrently when threads are available */
+}
+
+#endif /* HAS_PTHREAD && HAS_UNISTD */
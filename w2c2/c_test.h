@@ -0,0 +1,7 @@
+#ifndef W2C2_C_TEST_H
+#define W2C2_C_TEST_H
+
+void
+testCacheConcurrentWrites(void);
+
+#endif /* W2C2_C_TEST_H */
@@ -0,0 +1,658 @@
+#include <stdio.h>
+#include "code.h"
+#include "leb128.h"
+
+/*
+ * wasmCodeNumericStackEffect returns the number of values popped by the given
+ * numeric opcode, which pushes a single value, or false if the opcode is not numeric.
+ */
+static
+bool
+wasmCodeNumericStackEffect(
+    const WasmOpcode opcode,
+    U32* popCount
+) {
+    if (opcode == wasmOpcodeI32Eqz
+        || opcode == wasmOpcodeI64Eqz
+        || (opcode >= wasmOpcodeI32Clz && opcode <= wasmOpcodeI32PopCnt)
+        || (opcode >= wasmOpcodeI64Clz && opcode <= wasmOpcodeI64PopCnt)
+        || (opcode >= wasmOpcodeF32Abs && opcode <= wasmOpcodeF32Sqrt)
+        || (opcode >= wasmOpcodeF64Abs && opcode <= wasmOpcodeF64Sqrt)
+        || (opcode >= wasmOpcodeI32WrapI64 && opcode <= wasmOpcodeF64ReinterpretI64)
+        || (opcode >= wasmOpcodeI32Extend8S && opcode <= wasmOpcodeI64Extend32S)
+    ) {
+        *popCount = 1;
+        return true;
+    }
+
+    if ((opcode >= wasmOpcodeI32Eq && opcode <= wasmOpcodeI32GeU)
+        || (opcode >= wasmOpcodeI64Eq && opcode <= wasmOpcodeI64GeU)
+        || (opcode >= wasmOpcodeF32Eq && opcode <= wasmOpcodeF64Ge)
+        || (opcode >= wasmOpcodeI32Add && opcode <= wasmOpcodeI32Rotr)
+        || (opcode >= wasmOpcodeI64Add && opcode <= wasmOpcodeI64Rotr)
+        || (opcode >= wasmOpcodeF32Add && opcode <= wasmOpcodeF32CopySign)
+        || (opcode >= wasmOpcodeF64Add && opcode <= wasmOpcodeF64CopySign)
+    ) {
+        *popCount = 2;
+        return true;
+    }
+
+    return false;
+}
+
+static
+void
+wasmCodeSIMDStackEffect(
+    const WasmSIMDOpcode simdOpcode,
+    U32* popCount,
+    U32* pushCount
+) {
+    *pushCount = 1;
+
+    switch (simdOpcode) {
+        case wasmSIMDOpcodeV128Const:
+            *popCount = 0;
+            break;
+        case wasmSIMDOpcodeV128Store:
+        case wasmSIMDOpcodeV128Store8Lane:
+        case wasmSIMDOpcodeV128Store16Lane:
+        case wasmSIMDOpcodeV128Store32Lane:
+        case wasmSIMDOpcodeV128Store64Lane:
+            *popCount = 2;
+            *pushCount = 0;
+            break;
+        case wasmSIMDOpcodeV128Bitselect:
+            *popCount = 3;
+            break;
+        case wasmSIMDOpcodeV128Load:
+        case wasmSIMDOpcodeV128Load8x8S:
+        case wasmSIMDOpcodeV128Load8x8U:
+        case wasmSIMDOpcodeV128Load16x4S:
+        case wasmSIMDOpcodeV128Load16x4U:
+        case wasmSIMDOpcodeV128Load32x2S:
+        case wasmSIMDOpcodeV128Load32x2U:
+        case wasmSIMDOpcodeV128Load8Splat:
+        case wasmSIMDOpcodeV128Load16Splat:
+        case wasmSIMDOpcodeV128Load32Splat:
+        case wasmSIMDOpcodeV128Load64Splat:
+        case wasmSIMDOpcodeV128Load32Zero:
+        case wasmSIMDOpcodeV128Load64Zero:
+        case wasmSIMDOpcodeI8x16ExtractLaneS:
+        case wasmSIMDOpcodeI8x16ExtractLaneU:
+        case wasmSIMDOpcodeI16x8ExtractLaneS:
+        case wasmSIMDOpcodeI16x8ExtractLaneU:
+        case wasmSIMDOpcodeI32x4ExtractLane:
+        case wasmSIMDOpcodeI64x2ExtractLane:
+        case wasmSIMDOpcodeF32x4ExtractLane:
+        case wasmSIMDOpcodeF64x2ExtractLane:
+        case wasmSIMDOpcodeI8x16Splat:
+        case wasmSIMDOpcodeI16x8Splat:
+        case wasmSIMDOpcodeI32x4Splat:
+        case wasmSIMDOpcodeI64x2Splat:
+        case wasmSIMDOpcodeF32x4Splat:
+        case wasmSIMDOpcodeF64x2Splat:
+        case wasmSIMDOpcodeV128Not:
+        case wasmSIMDOpcodeV128AnyTrue:
+        case wasmSIMDOpcodeF32x4DemoteF64x2Zero:
+        case wasmSIMDOpcodeF64x2PromoteLowF32x4:
+        case wasmSIMDOpcodeI8x16Abs:
+        case wasmSIMDOpcodeI8x16Neg:
+        case wasmSIMDOpcodeI8x16Popcnt:
+        case wasmSIMDOpcodeI8x16AllTrue:
+        case wasmSIMDOpcodeI8x16Bitmask:
+        case wasmSIMDOpcodeF32x4Ceil:
+        case wasmSIMDOpcodeF32x4Floor:
+        case wasmSIMDOpcodeF32x4Trunc:
+        case wasmSIMDOpcodeF32x4Nearest:
+        case wasmSIMDOpcodeF64x2Ceil:
+        case wasmSIMDOpcodeF64x2Floor:
+        case wasmSIMDOpcodeF64x2Trunc:
+        case wasmSIMDOpcodeF64x2Nearest:
+        case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16S:
+        case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16U:
+        case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8S:
+        case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8U:
+        case wasmSIMDOpcodeI16x8Abs:
+        case wasmSIMDOpcodeI16x8Neg:
+        case wasmSIMDOpcodeI16x8AllTrue:
+        case wasmSIMDOpcodeI16x8Bitmask:
+        case wasmSIMDOpcodeI16x8ExtendLowI8x16S:
+        case wasmSIMDOpcodeI16x8ExtendHighI8x16S:
+        case wasmSIMDOpcodeI16x8ExtendLowI8x16U:
+        case wasmSIMDOpcodeI16x8ExtendHighI8x16U:
+        case wasmSIMDOpcodeI32x4Abs:
+        case wasmSIMDOpcodeI32x4Neg:
+        case wasmSIMDOpcodeI32x4AllTrue:
+        case wasmSIMDOpcodeI32x4Bitmask:
+        case wasmSIMDOpcodeI32x4ExtendLowI16x8S:
+        case wasmSIMDOpcodeI32x4ExtendHighI16x8S:
+        case wasmSIMDOpcodeI32x4ExtendLowI16x8U:
+        case wasmSIMDOpcodeI32x4ExtendHighI16x8U:
+        case wasmSIMDOpcodeI64x2Abs:
+        case wasmSIMDOpcodeI64x2Neg:
+        case wasmSIMDOpcodeI64x2AllTrue:
+        case wasmSIMDOpcodeI64x2Bitmask:
+        case wasmSIMDOpcodeI64x2ExtendLowI32x4S:
+        case wasmSIMDOpcodeI64x2ExtendHighI32x4S:
+        case wasmSIMDOpcodeI64x2ExtendLowI32x4U:
+        case wasmSIMDOpcodeI64x2ExtendHighI32x4U:
+        case wasmSIMDOpcodeF32x4Abs:
+        case wasmSIMDOpcodeF32x4Neg:
+        case wasmSIMDOpcodeF32x4Sqrt:
+        case wasmSIMDOpcodeF64x2Abs:
+        case wasmSIMDOpcodeF64x2Neg:
+        case wasmSIMDOpcodeF64x2Sqrt:
+        case wasmSIMDOpcodeI32x4TruncSatF32x4S:
+        case wasmSIMDOpcodeI32x4TruncSatF32x4U:
+        case wasmSIMDOpcodeF32x4ConvertI32x4S:
+        case wasmSIMDOpcodeF32x4ConvertI32x4U:
+        case wasmSIMDOpcodeI32x4TruncSatF64x2SZero:
+        case wasmSIMDOpcodeI32x4TruncSatF64x2UZero:
+        case wasmSIMDOpcodeF64x2ConvertLowI32x4S:
+        case wasmSIMDOpcodeF64x2ConvertLowI32x4U:
+            *popCount = 1;
+            break;
+        default:
+            /* Binary operations, shuffles, lane replacements and lane loads */
+            *popCount = 2;
+            break;
+    }
+}
+
+static
+void
+wasmCodeThreadsStackEffect(
+    const WasmThreadsOpcode threadsOpcode,
+    U32* popCount,
+    U32* pushCount
+) {
+    *pushCount = 1;
+
+    if (threadsOpcode == wasmThreadsOpcodeAtomicFence) {
+        *popCount = 0;
+        *pushCount = 0;
+    } else if (threadsOpcode == wasmThreadsOpcodeMemoryAtomicNotify) {
+        *popCount = 2;
+    } else if (threadsOpcode == wasmThreadsOpcodeMemoryAtomicWait32
+        || threadsOpcode == wasmThreadsOpcodeMemoryAtomicWait64
+        || threadsOpcode >= wasmThreadsOpcodeI32AtomicRMWCmpxchg
+    ) {
+        *popCount = 3;
+    } else if (threadsOpcode >= wasmThreadsOpcodeI32AtomicStore
+        && threadsOpcode <= wasmThreadsOpcodeI64AtomicStore32
+    ) {
+        *popCount = 2;
+        *pushCount = 0;
+    } else if (threadsOpcode >= wasmThreadsOpcodeI32AtomicRMWAdd) {
+        *popCount = 2;
+    } else {
+        *popCount = 1;
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadBytes(
+    Buffer* buffer,
+    WasmCode* code,
+    WasmInstruction* instruction
+) {
+    const size_t bytesStart = code->bytes.length;
+    const size_t newLength = bytesStart + WASM_V128_BYTE_COUNT;
+
+    MUST (buffer->length >= WASM_V128_BYTE_COUNT)
+    MUST (wasmCodeBytesEnsureCapacity(&code->bytes, newLength))
+
+    memcpy(code->bytes.bytes + bytesStart, buffer->data, WASM_V128_BYTE_COUNT);
+    bufferSkipUnchecked(buffer, WASM_V128_BYTE_COUNT);
+
+    code->bytes.length = newLength;
+    instruction->immediates.bytesStart = (U32) bytesStart;
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadBranchTable(
+    Buffer* buffer,
+    WasmCode* code,
+    WasmInstruction* instruction
+) {
+    WasmBranchTableImmediates* immediates = &instruction->immediates.branchTable;
+    U32 labelIndexCount = 0;
+    U32 index = 0;
+
+    MUST (leb128ReadU32(buffer, &labelIndexCount) > 0)
+    /* Each label index is encoded in at least one byte */
+    MUST (labelIndexCount <= buffer->length)
+    MUST (wasmCodeLabelIndicesEnsureCapacity(
+        &code->labelIndices,
+        code->labelIndices.length + labelIndexCount
+    ))
+
+    immediates->labelIndicesStart = (U32) code->labelIndices.length;
+    immediates->labelIndexCount = labelIndexCount;
+
+    for (; index < labelIndexCount; index++) {
+        U32 labelIndex = 0;
+        MUST (leb128ReadU32(buffer, &labelIndex) > 0)
+        code->labelIndices.labelIndices[code->labelIndices.length++] = labelIndex;
+    }
+
+    MUST (leb128ReadU32(buffer, &immediates->defaultLabelIndex) > 0)
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadMiscImmediates(
+    Buffer* buffer,
+    WasmInstruction* instruction,
+    U32* popCount,
+    U32* pushCount
+) {
+    WasmInstructionImmediates* immediates = &instruction->immediates;
+
+    switch (instruction->prefixedOpcode) {
+        case wasmMiscOpcodeMemoryInit:
+            *popCount = 3;
+            return wasmMemoryInitInstructionRead(buffer, &immediates->memoryInit);
+        case wasmMiscOpcodeMemoryCopy:
+            *popCount = 3;
+            return wasmMemoryCopyInstructionRead(buffer, &immediates->memoryCopy);
+        case wasmMiscOpcodeMemoryFill:
+            *popCount = 3;
+            return wasmMemoryInstructionRead(buffer, &immediates->memory);
+        case wasmMiscOpcodeDataDrop:
+        case wasmMiscOpcodeElemDrop:
+            return leb128ReadU32(buffer, &immediates->indices[0]) > 0;
+        case wasmMiscOpcodeTableInit:
+        case wasmMiscOpcodeTableCopy:
+            *popCount = 3;
+            return leb128ReadU32(buffer, &immediates->indices[0]) > 0
+                && leb128ReadU32(buffer, &immediates->indices[1]) > 0;
+        case wasmMiscOpcodeTableGrow:
+            *popCount = 2;
+            *pushCount = 1;
+            return leb128ReadU32(buffer, &immediates->indices[0]) > 0;
+        case wasmMiscOpcodeTableSize:
+            *pushCount = 1;
+            return leb128ReadU32(buffer, &immediates->indices[0]) > 0;
+        case wasmMiscOpcodeTableFill:
+            *popCount = 3;
+            return leb128ReadU32(buffer, &immediates->indices[0]) > 0;
+        default:
+            /* Saturating truncations. Unknown opcodes are reported when generating code */
+            *popCount = 1;
+            *pushCount = 1;
+            return true;
+    }
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadSIMDImmediates(
+    Buffer* buffer,
+    WasmCode* code,
+    WasmInstruction* instruction
+) {
+    WasmInstructionImmediates* immediates = &instruction->immediates;
+    const U32 simdOpcode = instruction->prefixedOpcode;
+
+    switch (simdOpcode) {
+        case wasmSIMDOpcodeV128Const:
+        case wasmSIMDOpcodeI8x16Shuffle:
+            return wasmCodeReadBytes(buffer, code, instruction);
+        case wasmSIMDOpcodeI8x16ExtractLaneS:
+        case wasmSIMDOpcodeI8x16ExtractLaneU:
+        case wasmSIMDOpcodeI8x16ReplaceLane:
+        case wasmSIMDOpcodeI16x8ExtractLaneS:
+        case wasmSIMDOpcodeI16x8ExtractLaneU:
+        case wasmSIMDOpcodeI16x8ReplaceLane:
+        case wasmSIMDOpcodeI32x4ExtractLane:
+        case wasmSIMDOpcodeI32x4ReplaceLane:
+        case wasmSIMDOpcodeI64x2ExtractLane:
+        case wasmSIMDOpcodeI64x2ReplaceLane:
+        case wasmSIMDOpcodeF32x4ExtractLane:
+        case wasmSIMDOpcodeF32x4ReplaceLane:
+        case wasmSIMDOpcodeF64x2ExtractLane:
+        case wasmSIMDOpcodeF64x2ReplaceLane:
+            return wasmLaneInstructionRead(buffer, &immediates->lane);
+        case wasmSIMDOpcodeV128Load8Lane:
+        case wasmSIMDOpcodeV128Load16Lane:
+        case wasmSIMDOpcodeV128Load32Lane:
+        case wasmSIMDOpcodeV128Load64Lane:
+        case wasmSIMDOpcodeV128Store8Lane:
+        case wasmSIMDOpcodeV128Store16Lane:
+        case wasmSIMDOpcodeV128Store32Lane:
+        case wasmSIMDOpcodeV128Store64Lane:
+            return wasmMemoryArgumentInstructionRead(buffer, &immediates->laneMemory.memoryArgument)
+                && wasmLaneInstructionRead(buffer, &immediates->laneMemory.lane);
+        default:
+            if (simdOpcode <= wasmSIMDOpcodeV128Store
+                || simdOpcode == wasmSIMDOpcodeV128Load32Zero
+                || simdOpcode == wasmSIMDOpcodeV128Load64Zero
+            ) {
+                return wasmMemoryArgumentInstructionRead(buffer, &immediates->memoryArgument);
+            }
+            return true;
+    }
+}
+
+/* wasmCodeReadBlockType reads the block type of a block, loop, or if instruction, and pushes the block */
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadBlockType(
+    Buffer* buffer,
+    const WasmModule* module,
+    WasmCode* code,
+    WasmInstruction* instruction,
+    const U32 stackDepth
+) {
+    WasmBlockType* blockType = &instruction->immediates.blockType;
+    WasmCodeBlock block;
+
+    MUST (wasmReadBlockType(buffer, blockType))
+
+    block.parameterCount = 0;
+    block.resultCount = 0;
+
+    switch (blockType->kind) {
+        case wasmBlockTypeKindEmpty:
+            break;
+        case wasmBlockTypeKindValueType:
+            block.resultCount = 1;
+            break;
+        case wasmBlockTypeKindFunctionType:
+            /* Invalid function type indices are reported when generating code */
+            if (blockType->functionTypeIndex < module->functionTypes.count) {
+                const WasmFunctionType functionType =
+                    module->functionTypes.functionTypes[blockType->functionTypeIndex];
+                block.parameterCount = functionType.parameterCount;
+                block.resultCount = functionType.resultCount;
+            }
+            break;
+    }
+
+    /* The parameters of the block are on the stack */
+    block.stackDepth = stackDepth >= block.parameterCount
+        ? stackDepth - block.parameterCount
+        : 0;
+
+    return wasmCodeBlocksAppend(&code->blocks, block);
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmCodeReadImmediates(
+    Buffer* buffer,
+    const WasmModule* module,
+    WasmCode* code,
+    WasmInstruction* instruction,
+    U32* popCount,
+    U32* pushCount,
+    bool* unreachable
+) {
+    WasmInstructionImmediates* immediates = &instruction->immediates;
+    const WasmOpcode opcode = instruction->opcode;
+
+    if (opcode >= wasmOpcodeI32Load && opcode <= wasmOpcodeI64Store32) {
+        if (opcode >= wasmOpcodeI32Store) {
+            *popCount = 2;
+        } else {
+            *popCount = 1;
+            *pushCount = 1;
+        }
+        return wasmMemoryArgumentInstructionRead(buffer, &immediates->memoryArgument);
+    }
+
+    if (wasmCodeNumericStackEffect(opcode, popCount)) {
+        *pushCount = 1;
+        return true;
+    }
+
+    switch (opcode) {
+        case wasmOpcodeUnreachable:
+        case wasmOpcodeReturn:
+            *unreachable = true;
+            return true;
+        case wasmOpcodeBr:
+            *unreachable = true;
+            return wasmBranchInstructionRead(buffer, &immediates->branch);
+        case wasmOpcodeBrIf:
+            *popCount = 1;
+            return wasmBranchInstructionRead(buffer, &immediates->branch);
+        case wasmOpcodeBrTable:
+            *unreachable = true;
+            return wasmCodeReadBranchTable(buffer, code, instruction);
+        case wasmOpcodeCall:
+        case wasmOpcodeReturnCall: {
+            WasmFunctionType functionType;
+            MUST (wasmCallInstructionRead(buffer, &immediates->call))
+            /* Invalid function indices are reported when generating code */
+            if (wasmModuleGetFunctionType(module, immediates->call.funcIndex, &functionType)) {
+                *popCount = functionType.parameterCount;
+                *pushCount = functionType.resultCount;
+            }
+            *unreachable = opcode == wasmOpcodeReturnCall;
+            return true;
+        }
+        case wasmOpcodeCallIndirect:
+        case wasmOpcodeReturnCallIndirect: {
+            const WasmCallIndirectInstruction* callIndirect = &immediates->callIndirect;
+            MUST (wasmCallIndirectInstructionRead(buffer, &immediates->callIndirect))
+            /* The table element index */
+            *popCount = 1;
+            /* Invalid function type indices are reported when generating code */
+            if (callIndirect->functionTypeIndex < module->functionTypes.count) {
+                const WasmFunctionType functionType =
+                    module->functionTypes.functionTypes[callIndirect->functionTypeIndex];
+                *popCount += functionType.parameterCount;
+                *pushCount = functionType.resultCount;
+            }
+            *unreachable = opcode == wasmOpcodeReturnCallIndirect;
+            return true;
+        }
+        case wasmOpcodeDrop:
+            *popCount = 1;
+            return true;
+        case wasmOpcodeSelect:
+            *popCount = 3;
+            *pushCount = 1;
+            return true;
+        case wasmOpcodeLocalGet:
+            *pushCount = 1;
+            return wasmLocalInstructionRead(buffer, &immediates->local);
+        case wasmOpcodeLocalSet:
+            *popCount = 1;
+            return wasmLocalInstructionRead(buffer, &immediates->local);
+        case wasmOpcodeLocalTee:
+            *popCount = 1;
+            *pushCount = 1;
+            return wasmLocalInstructionRead(buffer, &immediates->local);
+        case wasmOpcodeGlobalGet:
+            *pushCount = 1;
+            return wasmGlobalInstructionRead(buffer, &immediates->global);
+        case wasmOpcodeGlobalSet:
+            *popCount = 1;
+            return wasmGlobalInstructionRead(buffer, &immediates->global);
+        case wasmOpcodeMemorySize:
+            *pushCount = 1;
+            return wasmMemoryInstructionRead(buffer, &immediates->memory);
+        case wasmOpcodeMemoryGrow:
+            *popCount = 1;
+            *pushCount = 1;
+            return wasmMemoryInstructionRead(buffer, &immediates->memory);
+        case wasmOpcodeI32Const:
+        case wasmOpcodeI64Const:
+        case wasmOpcodeF32Const:
+        case wasmOpcodeF64Const:
+            *pushCount = 1;
+            return wasmConstInstructionRead(buffer, opcode, &immediates->constant);
+        case wasmOpcodeMiscPrefix:
+            MUST (leb128ReadU32(buffer, &instruction->prefixedOpcode) > 0)
+            return wasmCodeReadMiscImmediates(buffer, instruction, popCount, pushCount);
+        case wasmOpcodeThreadsPrefix: {
+            MUST (leb128ReadU32(buffer, &instruction->prefixedOpcode) > 0)
+            wasmCodeThreadsStackEffect(instruction->prefixedOpcode, popCount, pushCount);
+            if (instruction->prefixedOpcode == wasmThreadsOpcodeAtomicFence) {
+                /* Reserved byte, must be zero */
+                U8 reserved = 0;
+                MUST (bufferReadByte(buffer, &reserved))
+                return reserved == 0;
+            }
+            /* All other atomic instructions have a memory argument */
+            return wasmMemoryArgumentInstructionRead(buffer, &immediates->memoryArgument);
+        }
+        case wasmOpcodeSIMDPrefix:
+            MUST (leb128ReadU32(buffer, &instruction->prefixedOpcode) > 0)
+            wasmCodeSIMDStackEffect(instruction->prefixedOpcode, popCount, pushCount);
+            return wasmCodeReadSIMDImmediates(buffer, code, instruction);
+        default:
+            /* No immediates. Unknown opcodes are reported when generating code */
+            return true;
+    }
+}
+
+static
+const char*
+wasmCodeInstructionDescription(
+    const WasmInstruction instruction
+) {
+    switch (instruction.opcode) {
+        case wasmOpcodeMiscPrefix:
+            return wasmMiscOpcodeDescription(instruction.prefixedOpcode);
+        case wasmOpcodeThreadsPrefix:
+            return wasmThreadsOpcodeDescription(instruction.prefixedOpcode);
+        case wasmOpcodeSIMDPrefix:
+            return wasmSIMDOpcodeDescription(instruction.prefixedOpcode);
+        default:
+            return wasmOpcodeDescription(instruction.opcode);
+    }
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmCodeDecode(
+    const WasmModule* module,
+    const WasmFunction function,
+    WasmCode* result
+) {
+    Buffer buffer = function.code;
+    U32 stackDepth = 0;
+
+    result->instructions.length = 0;
+    result->labelIndices.length = 0;
+    result->bytes.length = 0;
+    result->blocks.length = 0;
+
+    /* The function's body is a block with the function's results */
+    {
+        const WasmFunctionType functionType =
+            module->functionTypes.functionTypes[function.functionTypeIndex];
+        WasmCodeBlock block;
+        block.stackDepth = 0;
+        block.parameterCount = 0;
+        block.resultCount = functionType.resultCount;
+        MUST (wasmCodeBlocksAppend(&result->blocks, block))
+    }
+
+    while (result->blocks.length > 0) {
+        WasmInstruction instruction;
+        WasmCodeBlock block = result->blocks.blocks[result->blocks.length - 1];
+        U32 popCount = 0;
+        U32 pushCount = 0;
+        bool unreachable = false;
+
+        instruction.prefixedOpcode = 0;
+        instruction.offset = (U32) (function.code.length - buffer.length);
+        instruction.stackDepth = stackDepth;
+        memset(&instruction.immediates, 0, sizeof(WasmInstructionImmediates));
+
+        if (!wasmOpcodeRead(&buffer, &instruction.opcode)) {
+            break;
+        }
+
+        switch (instruction.opcode) {
+            case wasmOpcodeIf:
+            case wasmOpcodeBlock:
+            case wasmOpcodeLoop: {
+                if (instruction.opcode == wasmOpcodeIf) {
+                    /* Condition */
+                    stackDepth = stackDepth > block.stackDepth ? stackDepth - 1 : block.stackDepth;
+                }
+                if (!wasmCodeReadBlockType(&buffer, module, result, &instruction, stackDepth)) {
+                    fprintf(
+                        stderr,
+                        "w2c2: invalid %s instruction: expected block type\n",
+                        wasmOpcodeDescription(instruction.opcode)
+                    );
+                    return false;
+                }
+                break;
+            }
+            case wasmOpcodeElse: {
+                stackDepth = block.stackDepth + block.parameterCount;
+                break;
+            }
+            case wasmOpcodeEnd: {
+                stackDepth = block.stackDepth + block.resultCount;
+                result->blocks.length--;
+                break;
+            }
+            default: {
+                if (!wasmCodeReadImmediates(
+                    &buffer,
+                    module,
+                    result,
+                    &instruction,
+                    &popCount,
+                    &pushCount,
+                    &unreachable
+                )) {
+                    fprintf(
+                        stderr,
+                        "w2c2: invalid %s instruction encoding\n",
+                        wasmCodeInstructionDescription(instruction)
+                    );
+                    return false;
+                }
+
+                if (unreachable) {
+                    /* The rest of the block is unreachable, and its stack is polymorphic */
+                    stackDepth = block.stackDepth;
+                } else {
+                    /* Code after an unconditional branch may pop more values than the block has */
+                    stackDepth = stackDepth >= block.stackDepth + popCount
+                        ? stackDepth - popCount
+                        : block.stackDepth;
+                    stackDepth += pushCount;
+                }
+                break;
+            }
+        }
+
+        MUST (wasmInstructionsAppend(&result->instructions, instruction))
+    }
+
+    return true;
+}
+
+void
+wasmCodeFree(
+    WasmCode* code
+) {
+    wasmInstructionsFree(&code->instructions);
+    wasmCodeLabelIndicesFree(&code->labelIndices);
+    wasmCodeBytesFree(&code->bytes);
+    wasmCodeBlocksFree(&code->blocks);
+    *code = wasmEmptyCode;
+}
@@ -0,0 +1,144 @@
+#ifndef W2C2_CODE_H
+#define W2C2_CODE_H
+
+#include "w2c2_base.h"
+#include "array.h"
+#include "instruction.h"
+#include "valuetype.h"
+#include "module.h"
+
+/* WasmInstruction */
+
+/*
+ * WasmBranchTableImmediates are the immediates of a br_table instruction.
+ * The label indices are stored in the label indices of the code.
+ */
+typedef struct WasmBranchTableImmediates {
+    U32 labelIndicesStart;
+    U32 labelIndexCount;
+    U32 defaultLabelIndex;
+} WasmBranchTableImmediates;
+
+/* WasmLaneMemoryImmediates are the immediates of a SIMD load_lane or store_lane instruction */
+typedef struct WasmLaneMemoryImmediates {
+    WasmMemoryArgumentInstruction memoryArgument;
+    WasmLaneInstruction lane;
+} WasmLaneMemoryImmediates;
+
+typedef union WasmInstructionImmediates {
+    WasmLocalInstruction local;
+    WasmGlobalInstruction global;
+    WasmConstInstruction constant;
+    WasmMemoryArgumentInstruction memoryArgument;
+    WasmCallInstruction call;
+    WasmCallIndirectInstruction callIndirect;
+    WasmBranchInstruction branch;
+    WasmBranchTableImmediates branchTable;
+    WasmMemoryInstruction memory;
+    WasmMemoryCopyInstruction memoryCopy;
+    WasmMemoryInitInstruction memoryInit;
+    WasmBlockType blockType;
+    WasmLaneInstruction lane;
+    WasmLaneMemoryImmediates laneMemory;
+    /* Start of the 16 immediate bytes of v128.const and i8x16.shuffle in the bytes of the code */
+    U32 bytesStart;
+    /* Indices of data.drop, elem.drop, and the table instructions */
+    U32 indices[2];
+} WasmInstructionImmediates;
+
+/*
+ * WasmInstruction is a decoded instruction of a function's code.
+ * Immediates are decoded once, so passes over the code do not need to decode them again.
+ */
+typedef struct WasmInstruction {
+    WasmOpcode opcode;
+    /* Secondary opcode of instructions with a prefix (misc, threads, SIMD) */
+    U32 prefixedOpcode;
+    /* Offset of the instruction relative to the start of the function's code */
+    U32 offset;
+    /* Number of values on the operand stack before the instruction */
+    U32 stackDepth;
+    WasmInstructionImmediates immediates;
+} WasmInstruction;
+
+ARRAY_TYPE(
+    WasmInstructions,
+    WasmInstruction,
+    wasmInstructions,
+    instructions,
+    instruction
+)
+
+ARRAY_TYPE(
+    WasmCodeLabelIndices,
+    U32,
+    wasmCodeLabelIndices,
+    labelIndices,
+    labelIndex
+)
+
+ARRAY_TYPE(
+    WasmCodeBytes,
+    U8,
+    wasmCodeBytes,
+    bytes,
+    byte
+)
+
+/* WasmCodeBlock is a block, loop, or if, or the function itself, while decoding */
+typedef struct WasmCodeBlock {
+    /* Number of values on the operand stack below the block's parameters */
+    U32 stackDepth;
+    U32 parameterCount;
+    U32 resultCount;
+} WasmCodeBlock;
+
+ARRAY_TYPE(
+    WasmCodeBlocks,
+    WasmCodeBlock,
+    wasmCodeBlocks,
+    blocks,
+    block
+)
+
+/*
+ * WasmCode is the decoded code of a function: a flat array of instructions,
+ * and the variable-length immediates of br_table, v128.const and i8x16.shuffle.
+ *
+ * The instructions end at the end of the function's body,
+ * i.e. the final end instruction is the last instruction.
+ */
+typedef struct WasmCode {
+    WasmInstructions instructions;
+    WasmCodeLabelIndices labelIndices;
+    WasmCodeBytes bytes;
+    /* Used while decoding, kept to reuse its memory */
+    WasmCodeBlocks blocks;
+} WasmCode;
+
+static const WasmCode wasmEmptyCode = {
+    {0, 0, NULL},
+    {0, 0, NULL},
+    {0, 0, NULL},
+    {0, 0, NULL}
+};
+
+/*
+ * wasmCodeDecode decodes the code of the given function into the given code.
+ * The memory of the given code is reused, so the same code can be used for all functions.
+ * Returns false and reports an error if the code is invalid.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmCodeDecode(
+    const WasmModule* module,
+    WasmFunction function,
+    WasmCode* result
+);
+
+void
+wasmCodeFree(
+    WasmCode* code
+);
+
+#endif /* W2C2_CODE_H */
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <string.h>
+#include "code.h"
+#include "code_test.h"
+
+typedef struct CodeDecodeTest {
+    WasmOpcode opcode;
+    U32 prefixedOpcode;
+    U32 offset;
+    U32 stackDepth;
+} CodeDecodeTest;
+
+void
+testCodeDecode(void) {
+    static U8 data[] = {
+        /* i32.const 1; i32.const 2; i32.add */
+        0x41, 0x01, 0x41, 0x02, 0x6A,
+        /* block; local.get 0; br_table 0 1 0; end */
+        0x02, 0x40, 0x20, 0x00, 0x0E, 0x02, 0x00, 0x01, 0x00, 0x0B,
+        /* v128.const */
+        0xFD, 0x0C,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+        /* drop; end */
+        0x1A, 0x0B,
+        /* Trailing byte after the end of the function */
+        0x00
+    };
+
+    static const CodeDecodeTest tests[] = {
+        {wasmOpcodeI32Const, 0, 0, 0},
+        {wasmOpcodeI32Const, 0, 2, 1},
+        {wasmOpcodeI32Add, 0, 4, 2},
+        {wasmOpcodeBlock, 0, 5, 1},
+        {wasmOpcodeLocalGet, 0, 7, 1},
+        {wasmOpcodeBrTable, 0, 9, 2},
+        {wasmOpcodeEnd, 0, 14, 1},
+        {wasmOpcodeSIMDPrefix, wasmSIMDOpcodeV128Const, 15, 1},
+        {wasmOpcodeDrop, 0, 33, 2},
+        {wasmOpcodeEnd, 0, 34, 1}
+    };
+
+    static const WasmValueType resultTypes[] = {wasmValueTypeI32};
+
+    WasmFunctionType functionType = wasmEmptyFunctionType;
+    WasmFunction function = wasmEmptyFunction;
+    WasmModule module;
+    WasmCode code = wasmEmptyCode;
+
+    size_t index = 0;
+
+    memset(&module, 0, sizeof(WasmModule));
+    functionType.resultCount = 1;
+    functionType.resultTypes = (WasmValueType*) resultTypes;
+    module.functionTypes.functionTypes = &functionType;
+    module.functionTypes.count = 1;
+
+    function.code.data = data;
+    function.code.length = sizeof(data);
+
+    if (!wasmCodeDecode(&module, function, &code)) {
+        fprintf(stderr, "FAIL testCodeDecode: failed to decode code\n");
+        exit(1);
+    }
+
+    if (code.instructions.length != sizeof(tests) / sizeof(CodeDecodeTest)) {
+        fprintf(
+            stderr,
+            "FAIL testCodeDecode: incorrect instruction count: %lu != %lu\n",
+            (unsigned long) code.instructions.length,
+            (unsigned long) (sizeof(tests) / sizeof(CodeDecodeTest))
+        );
+        exit(1);
+    }
+
+    for (; index < code.instructions.length; index++) {
+        const CodeDecodeTest test = tests[index];
+        const WasmInstruction instruction = code.instructions.instructions[index];
+        if (
+            instruction.opcode != test.opcode
+            || instruction.prefixedOpcode != test.prefixedOpcode
+            || instruction.offset != test.offset
+            || instruction.stackDepth != test.stackDepth
+        ) {
+            fprintf(
+                stderr,
+                "FAIL testCodeDecode %lu: incorrect instruction: "
+                "opcode=%u/%u offset=%u depth=%u != opcode=%u/%u offset=%u depth=%u\n",
+                index,
+                instruction.opcode, instruction.prefixedOpcode,
+                instruction.offset, instruction.stackDepth,
+                test.opcode, test.prefixedOpcode,
+                test.offset, test.stackDepth
+            );
+            exit(1);
+        }
+    }
+
+    {
+        const I32 constant = code.instructions.instructions[1].immediates.constant.value.i32;
+        if (constant != 2) {
+            fprintf(stderr, "FAIL testCodeDecode: incorrect i32.const immediate: %d != 2\n", constant);
+            exit(1);
+        }
+    }
+
+    {
+        const WasmBranchTableImmediates branchTable = code.instructions.instructions[5].immediates.branchTable;
+        const U32* labelIndices = code.labelIndices.labelIndices + branchTable.labelIndicesStart;
+        if (
+            branchTable.labelIndexCount != 2
+            || branchTable.defaultLabelIndex != 0
+            || labelIndices[0] != 0
+            || labelIndices[1] != 1
+        ) {
+            fprintf(stderr, "FAIL testCodeDecode: incorrect br_table immediates\n");
+            exit(1);
+        }
+    }
+
+    {
+        const U32 bytesStart = code.instructions.instructions[7].immediates.bytesStart;
+        if (memcmp(code.bytes.bytes + bytesStart, data + 17, 16) != 0) {
+            fprintf(stderr, "FAIL testCodeDecode: incorrect v128.const immediate\n");
+            exit(1);
+        }
+    }
+
+    wasmCodeFree(&code);
+
+    printf("PASS testCodeDecode\n");
+}
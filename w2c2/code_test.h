@@ -0,0 +1,7 @@
+#ifndef W2C2_CODE_TEST_H
+#define W2C2_CODE_TEST_H
+
+void
+testCodeDecode(void);
+
+#endif /* W2C2_CODE_TEST_H */
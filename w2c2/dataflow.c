@@ -0,0 +1,335 @@
+#include <string.h>
+#include "dataflow.h"
+
+static
+W2C2_INLINE
+U32*
+wasmDataflowSet(
+    const WasmDataflow* dataflow,
+    const size_t setIndex
+) {
+    return dataflow->sets.words + setIndex * dataflow->wordCount;
+}
+
+static
+W2C2_INLINE
+U32*
+wasmDataflowCurrentSet(
+    const WasmDataflow* dataflow
+) {
+    return wasmDataflowSet(dataflow, 0);
+}
+
+/* wasmDataflowStartSet returns the set of the locals assigned at the start of the given block */
+static
+W2C2_INLINE
+U32*
+wasmDataflowStartSet(
+    const WasmDataflow* dataflow,
+    const size_t blockIndex
+) {
+    return wasmDataflowSet(dataflow, 1 + 2 * blockIndex);
+}
+
+/*
+ * wasmDataflowBranchesSet returns the set of the locals assigned
+ * on all branches to the end of the given block
+ */
+static
+W2C2_INLINE
+U32*
+wasmDataflowBranchesSet(
+    const WasmDataflow* dataflow,
+    const size_t blockIndex
+) {
+    return wasmDataflowSet(dataflow, 2 + 2 * blockIndex);
+}
+
+static
+W2C2_INLINE
+void
+wasmDataflowSetFill(
+    const WasmDataflow* dataflow,
+    U32* set
+) {
+    memset(set, 0xFF, dataflow->wordCount * sizeof(U32));
+}
+
+static
+W2C2_INLINE
+void
+wasmDataflowSetCopy(
+    const WasmDataflow* dataflow,
+    U32* target,
+    const U32* source
+) {
+    memcpy(target, source, dataflow->wordCount * sizeof(U32));
+}
+
+static
+W2C2_INLINE
+void
+wasmDataflowSetIntersect(
+    const WasmDataflow* dataflow,
+    U32* target,
+    const U32* source
+) {
+    U32 wordIndex = 0;
+    for (; wordIndex < dataflow->wordCount; wordIndex++) {
+        target[wordIndex] &= source[wordIndex];
+    }
+}
+
+/*
+ * wasmDataflowUnreachable marks the rest of the current block as unreachable.
+ * All locals are considered assigned in unreachable code, so it does not affect the analysis.
+ */
+static
+W2C2_INLINE
+void
+wasmDataflowUnreachable(
+    const WasmDataflow* dataflow
+) {
+    wasmDataflowSetFill(dataflow, wasmDataflowCurrentSet(dataflow));
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmDataflowPushBlock(
+    WasmDataflow* dataflow,
+    const WasmOpcode opcode
+) {
+    const size_t blockIndex = dataflow->blocks.length;
+    const size_t setCount = 3 + 2 * blockIndex;
+
+    WasmDataflowBlock block;
+    block.opcode = opcode;
+    block.hasElse = false;
+    MUST (wasmDataflowBlocksAppend(&dataflow->blocks, block))
+
+    MUST (wasmDataflowWordsEnsureCapacity(&dataflow->sets, setCount * dataflow->wordCount))
+    dataflow->sets.length = setCount * dataflow->wordCount;
+
+    wasmDataflowSetCopy(
+        dataflow,
+        wasmDataflowStartSet(dataflow, blockIndex),
+        wasmDataflowCurrentSet(dataflow)
+    );
+    wasmDataflowSetFill(dataflow, wasmDataflowBranchesSet(dataflow, blockIndex));
+
+    return true;
+}
+
+/*
+ * wasmDataflowBranch records a branch to the given label.
+ * Locals are only ever assigned, never unassigned, so the locals assigned
+ * when branching back to the start of a loop include the ones assigned at its start.
+ * Returns false if the label is invalid.
+ */
+static
+bool
+WARN_UNUSED_RESULT
+wasmDataflowBranch(
+    const WasmDataflow* dataflow,
+    const U32 labelIndex
+) {
+    size_t blockIndex = 0;
+
+    if (labelIndex >= dataflow->blocks.length) {
+        return false;
+    }
+
+    blockIndex = dataflow->blocks.length - 1 - labelIndex;
+    if (dataflow->blocks.blocks[blockIndex].opcode != wasmOpcodeLoop) {
+        wasmDataflowSetIntersect(
+            dataflow,
+            wasmDataflowBranchesSet(dataflow, blockIndex),
+            wasmDataflowCurrentSet(dataflow)
+        );
+    }
+
+    return true;
+}
+
+static
+void
+wasmDataflowElse(
+    WasmDataflow* dataflow
+) {
+    const size_t blockIndex = dataflow->blocks.length - 1;
+    U32* current = wasmDataflowCurrentSet(dataflow);
+
+    /* The end of the then-branch continues after the end of the if */
+    wasmDataflowSetIntersect(dataflow, wasmDataflowBranchesSet(dataflow, blockIndex), current);
+    wasmDataflowSetCopy(dataflow, current, wasmDataflowStartSet(dataflow, blockIndex));
+
+    dataflow->blocks.blocks[blockIndex].hasElse = true;
+}
+
+static
+void
+wasmDataflowEnd(
+    WasmDataflow* dataflow
+) {
+    const size_t blockIndex = dataflow->blocks.length - 1;
+    const WasmDataflowBlock block = dataflow->blocks.blocks[blockIndex];
+    U32* current = wasmDataflowCurrentSet(dataflow);
+    U32* branches = wasmDataflowBranchesSet(dataflow, blockIndex);
+
+    /* Branches to a loop go to its start, so only the end of its body continues after it */
+    if (block.opcode != wasmOpcodeLoop) {
+        /* An if without an else continues after the end when the condition is false */
+        if (block.opcode == wasmOpcodeIf && !block.hasElse) {
+            wasmDataflowSetIntersect(dataflow, branches, wasmDataflowStartSet(dataflow, blockIndex));
+        }
+        wasmDataflowSetIntersect(dataflow, branches, current);
+        wasmDataflowSetCopy(dataflow, current, branches);
+    }
+
+    dataflow->blocks.length--;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmDataflowAnalyzeLocals(
+    const WasmModule* module,
+    const WasmFunction function,
+    const WasmCode* code,
+    WasmDataflow* dataflow
+) {
+    const WasmFunctionType functionType =
+        module->functionTypes.functionTypes[function.functionTypeIndex];
+
+    U32 localCount = 0;
+    size_t instructionIndex = 0;
+
+    {
+        U32 localsDeclarationIndex = 0;
+        for (; localsDeclarationIndex < function.localsDeclarations.declarationCount; localsDeclarationIndex++) {
+            localCount += function.localsDeclarations.declarations[localsDeclarationIndex].count;
+        }
+    }
+
+    dataflow->parameterCount = functionType.parameterCount;
+    dataflow->localCount = localCount;
+    dataflow->wordCount = (localCount + 31) / 32;
+    dataflow->sets.length = 0;
+    dataflow->blocks.length = 0;
+
+    MUST (wasmDataflowWordsEnsureCapacity(&dataflow->uninitializedReads, dataflow->wordCount))
+    dataflow->uninitializedReads.length = dataflow->wordCount;
+    memset(dataflow->uninitializedReads.words, 0, dataflow->wordCount * sizeof(U32));
+
+    if (localCount == 0) {
+        return true;
+    }
+
+    /* No locals are assigned at the start of the function's body, which is a block */
+    MUST (wasmDataflowWordsEnsureCapacity(&dataflow->sets, dataflow->wordCount))
+    dataflow->sets.length = dataflow->wordCount;
+    memset(wasmDataflowCurrentSet(dataflow), 0, dataflow->wordCount * sizeof(U32));
+    MUST (wasmDataflowPushBlock(dataflow, wasmOpcodeBlock))
+
+    for (;
+        instructionIndex < code->instructions.length && dataflow->blocks.length > 0;
+        instructionIndex++
+    ) {
+        const WasmInstruction* instruction = code->instructions.instructions + instructionIndex;
+        bool valid = true;
+
+        switch (instruction->opcode) {
+            case wasmOpcodeBlock:
+            case wasmOpcodeLoop:
+            case wasmOpcodeIf: {
+                MUST (wasmDataflowPushBlock(dataflow, instruction->opcode))
+                break;
+            }
+            case wasmOpcodeElse: {
+                wasmDataflowElse(dataflow);
+                break;
+            }
+            case wasmOpcodeEnd: {
+                wasmDataflowEnd(dataflow);
+                break;
+            }
+            case wasmOpcodeBr: {
+                valid = wasmDataflowBranch(dataflow, instruction->immediates.branch.labelIndex);
+                wasmDataflowUnreachable(dataflow);
+                break;
+            }
+            case wasmOpcodeBrIf: {
+                valid = wasmDataflowBranch(dataflow, instruction->immediates.branch.labelIndex);
+                break;
+            }
+            case wasmOpcodeBrTable: {
+                const WasmBranchTableImmediates branchTable = instruction->immediates.branchTable;
+                U32 labelIndex = 0;
+                for (; valid && labelIndex < branchTable.labelIndexCount; labelIndex++) {
+                    valid = wasmDataflowBranch(
+                        dataflow,
+                        code->labelIndices.labelIndices[branchTable.labelIndicesStart + labelIndex]
+                    );
+                }
+                valid = valid && wasmDataflowBranch(dataflow, branchTable.defaultLabelIndex);
+                wasmDataflowUnreachable(dataflow);
+                break;
+            }
+            case wasmOpcodeUnreachable:
+            case wasmOpcodeReturn:
+            case wasmOpcodeReturnCall:
+            case wasmOpcodeReturnCallIndirect: {
+                wasmDataflowUnreachable(dataflow);
+                break;
+            }
+            case wasmOpcodeLocalGet:
+            case wasmOpcodeLocalSet:
+            case wasmOpcodeLocalTee: {
+                const U32 localIndex = instruction->immediates.local.localIndex;
+                U32 index = 0;
+                U32 bit = 0;
+                U32* word = NULL;
+
+                /* Invalid local indices are reported when generating code */
+                if (localIndex < dataflow->parameterCount
+                    || localIndex - dataflow->parameterCount >= localCount
+                ) {
+                    break;
+                }
+
+                index = localIndex - dataflow->parameterCount;
+                bit = 1U << (index % 32);
+                word = wasmDataflowCurrentSet(dataflow) + index / 32;
+
+                if (instruction->opcode == wasmOpcodeLocalGet) {
+                    if ((*word & bit) == 0) {
+                        dataflow->uninitializedReads.words[index / 32] |= bit;
+                    }
+                } else {
+                    *word |= bit;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+
+        /* Invalid labels are reported when generating code. Until then, initialize all locals */
+        if (!valid) {
+            memset(dataflow->uninitializedReads.words, 0xFF, dataflow->wordCount * sizeof(U32));
+            return true;
+        }
+    }
+
+    return true;
+}
+
+void
+wasmDataflowFree(
+    WasmDataflow* dataflow
+) {
+    wasmDataflowWordsFree(&dataflow->sets);
+    wasmDataflowBlocksFree(&dataflow->blocks);
+    wasmDataflowWordsFree(&dataflow->uninitializedReads);
+    *dataflow = wasmEmptyDataflow;
+}
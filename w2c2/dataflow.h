@@ -0,0 +1,99 @@
+#ifndef W2C2_DATAFLOW_H
+#define W2C2_DATAFLOW_H
+
+#include "w2c2_base.h"
+#include "array.h"
+#include "code.h"
+#include "module.h"
+
+ARRAY_TYPE(
+    WasmDataflowWords,
+    U32,
+    wasmDataflowWords,
+    words,
+    word
+)
+
+/* WasmDataflowBlock is a block, loop, or if, or the function itself, during the analysis */
+typedef struct WasmDataflowBlock {
+    WasmOpcode opcode;
+    bool hasElse;
+} WasmDataflowBlock;
+
+ARRAY_TYPE(
+    WasmDataflowBlocks,
+    WasmDataflowBlock,
+    wasmDataflowBlocks,
+    blocks,
+    block
+)
+
+/*
+ * WasmDataflow is the result of the definite assignment analysis of a function's locals.
+ *
+ * Declared locals (i.e. not parameters) are initialized to zero.
+ * A local only needs to be initialized if it may be read before it is assigned.
+ *
+ * Sets of locals are bit sets of the declared locals, all stored in the same array:
+ * the current set, followed by the set at the start and the set of the branches of each block.
+ * The memory is reused, so the same dataflow can be used for all functions.
+ */
+typedef struct WasmDataflow {
+    U32 parameterCount;
+    U32 localCount;
+    U32 wordCount;
+    WasmDataflowWords sets;
+    WasmDataflowBlocks blocks;
+    /* Set of the locals which may be read before they are assigned */
+    WasmDataflowWords uninitializedReads;
+} WasmDataflow;
+
+static const WasmDataflow wasmEmptyDataflow = {
+    0, 0, 0,
+    {0, 0, NULL},
+    {0, 0, NULL},
+    {0, 0, NULL}
+};
+
+/*
+ * wasmDataflowAnalyzeLocals determines which of the declared locals of the given function
+ * may be read before they are assigned.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmDataflowAnalyzeLocals(
+    const WasmModule* module,
+    WasmFunction function,
+    const WasmCode* code,
+    WasmDataflow* dataflow
+);
+
+/*
+ * wasmDataflowLocalNeedsInitialization returns true if the given local
+ * may be read before it is assigned, according to the last analysis.
+ * Parameters never need to be initialized.
+ */
+static
+W2C2_INLINE
+bool
+wasmDataflowLocalNeedsInitialization(
+    const WasmDataflow* dataflow,
+    const U32 localIndex
+) {
+    U32 index = 0;
+    if (localIndex < dataflow->parameterCount) {
+        return false;
+    }
+    index = localIndex - dataflow->parameterCount;
+    if (index >= dataflow->localCount) {
+        return true;
+    }
+    return (dataflow->uninitializedReads.words[index / 32] & (1U << (index % 32))) != 0;
+}
+
+void
+wasmDataflowFree(
+    WasmDataflow* dataflow
+);
+
+#endif /* W2C2_DATAFLOW_H */
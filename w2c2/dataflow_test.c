@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <string.h>
+#include "dataflow.h"
+#include "dataflow_test.h"
+
+typedef struct DataflowTest {
+    U32 localIndex;
+    bool needsInitialization;
+} DataflowTest;
+
+void
+testDataflowAnalyzeLocals(void) {
+    static U8 data[] = {
+        /* i32.const 1; local.set 2; local.get 2; drop */
+        0x41, 0x01, 0x21, 0x02, 0x20, 0x02, 0x1A,
+        /* block; local.get 0; br_if 0; i32.const 0; local.set 3; end */
+        0x02, 0x40, 0x20, 0x00, 0x0D, 0x00, 0x41, 0x00, 0x21, 0x03, 0x0B,
+        /* local.get 3; drop; local.get 1; drop */
+        0x20, 0x03, 0x1A, 0x20, 0x01, 0x1A,
+        /* loop; i32.const 0; local.set 4; end; local.get 4; drop */
+        0x03, 0x40, 0x41, 0x00, 0x21, 0x04, 0x0B, 0x20, 0x04, 0x1A,
+        /* local.get 0; if; i32.const 1; local.set 5; else; i32.const 2; local.set 5; end */
+        0x20, 0x00, 0x04, 0x40, 0x41, 0x01, 0x21, 0x05, 0x05, 0x41, 0x02, 0x21, 0x05, 0x0B,
+        /* local.get 5; drop; end */
+        0x20, 0x05, 0x1A, 0x0B
+    };
+
+    static const DataflowTest tests[] = {
+        /* Parameter */
+        {0, false},
+        /* Read before any assignment */
+        {1, true},
+        /* Assigned before the read */
+        {2, false},
+        /* Not assigned when branching out of the block */
+        {3, true},
+        /* Assigned in the loop's body */
+        {4, false},
+        /* Assigned in both branches of the if */
+        {5, false}
+    };
+
+    static const WasmValueType parameterTypes[] = {wasmValueTypeI32};
+    static WasmLocalsDeclaration localsDeclarations[] = {
+        {wasmValueTypeI32, 5}
+    };
+
+    WasmFunctionType functionType = wasmEmptyFunctionType;
+    WasmFunction function = wasmEmptyFunction;
+    WasmModule module;
+    WasmCode code = wasmEmptyCode;
+    WasmDataflow dataflow = wasmEmptyDataflow;
+
+    size_t index = 0;
+
+    memset(&module, 0, sizeof(WasmModule));
+    functionType.parameterCount = 1;
+    functionType.parameterTypes = (WasmValueType*) parameterTypes;
+    module.functionTypes.functionTypes = &functionType;
+    module.functionTypes.count = 1;
+
+    function.code.data = data;
+    function.code.length = sizeof(data);
+    function.localsDeclarations.declarations = localsDeclarations;
+    function.localsDeclarations.declarationCount = 1;
+
+    if (!wasmCodeDecode(&module, function, &code)) {
+        fprintf(stderr, "FAIL testDataflowAnalyzeLocals: failed to decode code\n");
+        exit(1);
+    }
+
+    if (!wasmDataflowAnalyzeLocals(&module, function, &code, &dataflow)) {
+        fprintf(stderr, "FAIL testDataflowAnalyzeLocals: failed to analyze locals\n");
+        exit(1);
+    }
+
+    for (; index < sizeof(tests) / sizeof(DataflowTest); index++) {
+        const DataflowTest test = tests[index];
+        const bool needsInitialization = wasmDataflowLocalNeedsInitialization(&dataflow, test.localIndex);
+        if (needsInitialization != test.needsInitialization) {
+            fprintf(
+                stderr,
+                "FAIL testDataflowAnalyzeLocals: incorrect result for local %u: %d != %d\n",
+                test.localIndex,
+                needsInitialization,
+                test.needsInitialization
+            );
+            exit(1);
+        }
+    }
+
+    wasmCodeFree(&code);
+    wasmDataflowFree(&dataflow);
+
+    printf("PASS testDataflowAnalyzeLocals\n");
+}
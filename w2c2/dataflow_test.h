@@ -0,0 +1,7 @@
+#ifndef W2C2_DATAFLOW_TEST_H
+#define W2C2_DATAFLOW_TEST_H
+
+void
+testDataflowAnalyzeLocals(void);
+
+#endif /* W2C2_DATAFLOW_TEST_H */
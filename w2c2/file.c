@@ -3,6 +3,13 @@
 #include "w2c2_base.h"
 #include "file.h"
 
+#if HAS_MMAN
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif /* HAS_MMAN */
+
 Buffer
 readFile(
     const char* path
@@ -37,3 +44,67 @@ readFile(
 
     return buffer;
 }
+
+Buffer
+mapFile(
+    const char* path,
+    bool* mapped
+) {
+#if HAS_MMAN
+    Buffer buffer = {NULL, 0};
+    struct stat fileStat;
+    void* data = NULL;
+
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return buffer;
+    }
+
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        /* Private and writable, as the module is not expected to be read-only */
+        data = mmap(
+            NULL,
+            (size_t)fileStat.st_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE,
+            fd,
+            0
+        );
+    }
+    close(fd);
+
+    if (data != NULL && data != MAP_FAILED) {
+        /* The module is parsed front to back, and all of it is needed */
+#ifdef MADV_SEQUENTIAL
+        madvise(data, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_WILLNEED
+        madvise(data, (size_t)fileStat.st_size, MADV_WILLNEED);
+#endif
+        buffer.data = (U8*)data;
+        buffer.length = (size_t)fileStat.st_size;
+        *mapped = true;
+        return buffer;
+    }
+#endif /* HAS_MMAN */
+
+    /* Fall back to reading the file, e.g. if it is empty or not a regular file */
+    *mapped = false;
+    return readFile(path);
+}
+
+void
+unmapFile(
+    Buffer buffer,
+    const bool mapped
+) {
+#if HAS_MMAN
+    if (mapped) {
+        munmap(buffer.data, buffer.length);
+        return;
+    }
+#else
+    (void)mapped;
+#endif /* HAS_MMAN */
+    free(buffer.data);
+}
@@ -3,9 +3,30 @@
 
 #include "buffer.h"
 
+/*
+ * readFile reads the file at the given path into a heap buffer,
+ * which must be freed by the caller
+ */
 Buffer
 readFile(
     const char* path
 );
 
+/*
+ * mapFile maps the file at the given path into memory, if supported,
+ * and reads it into a heap buffer otherwise.
+ * The buffer must be released using unmapFile
+ */
+Buffer
+mapFile(
+    const char* path,
+    bool* mapped
+);
+
+void
+unmapFile(
+    Buffer buffer,
+    const bool mapped
+);
+
 #endif /* W2C2_FILE_H */
@@ -13,4 +13,25 @@ typedef struct WasmFunctionType {
 
 static const WasmFunctionType wasmEmptyFunctionType = {0, NULL, 0, NULL};
 
+static
+W2C2_INLINE
+bool
+wasmFunctionTypesEqual(
+    const WasmFunctionType functionType1,
+    const WasmFunctionType functionType2
+) {
+    return functionType1.parameterCount == functionType2.parameterCount
+        && functionType1.resultCount == functionType2.resultCount
+        && memcmp(
+            functionType1.parameterTypes,
+            functionType2.parameterTypes,
+            functionType1.parameterCount * sizeof(WasmValueType)
+        ) == 0
+        && memcmp(
+            functionType1.resultTypes,
+            functionType2.resultTypes,
+            functionType1.resultCount * sizeof(WasmValueType)
+        ) == 0;
+}
+
 #endif /* W2C2_FUNCTIONTYPE_H */
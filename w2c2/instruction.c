@@ -52,6 +52,36 @@ wasmConstInstructionRead(
     }
 }
 
+/* WasmV128ConstInstruction */
+
+bool
+wasmV128ConstInstructionRead(
+    Buffer* buffer,
+    WasmV128ConstInstruction* result
+) {
+    U32 index = 0;
+    for (; index < WASM_V128_BYTE_COUNT; index++) {
+        MUST (bufferReadByte(buffer, &result->bytes[index]))
+    }
+
+    return true;
+}
+
+/* WasmLaneInstruction */
+
+bool
+wasmLaneInstructionRead(
+    Buffer* buffer,
+    WasmLaneInstruction* result
+) {
+    U8 laneIndex = 0;
+    MUST (bufferReadByte(buffer, &laneIndex))
+
+    result->laneIndex = laneIndex;
+
+    return true;
+}
+
 /* WasmMemoryArgumentInstruction */
 
 bool
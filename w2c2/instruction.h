@@ -52,6 +52,35 @@ wasmConstInstructionRead(
     WasmConstInstruction* result
 );
 
+/* WasmV128ConstInstruction */
+
+#define WASM_V128_BYTE_COUNT 16
+
+/* Also used for the lane indices of i8x16.shuffle */
+typedef struct WasmV128ConstInstruction {
+    U8 bytes[WASM_V128_BYTE_COUNT];
+} WasmV128ConstInstruction;
+
+bool
+WARN_UNUSED_RESULT
+wasmV128ConstInstructionRead(
+    Buffer* buffer,
+    WasmV128ConstInstruction* result
+);
+
+/* WasmLaneInstruction */
+
+typedef struct WasmLaneInstruction {
+    U8 laneIndex;
+} WasmLaneInstruction;
+
+bool
+WARN_UNUSED_RESULT
+wasmLaneInstructionRead(
+    Buffer* buffer,
+    WasmLaneInstruction* result
+);
+
 /* WasmMemoryArgumentInstruction */
 
 typedef struct WasmMemoryArgumentInstruction {
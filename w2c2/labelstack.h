@@ -8,10 +8,12 @@
 typedef struct WasmLabel {
     U32 index;
     size_t typeStackLength;
-    WasmValueType* type;
+    /* Types of the values passed when branching to the label */
+    U32 typeCount;
+    const WasmValueType* types;
 } WasmLabel;
 
-static const WasmLabel wasmEmptyLabel = {0, 0, NULL};
+static const WasmLabel wasmEmptyLabel = {0, 0, 0, NULL};
 
 ARRAY_TYPE(
     WasmLabels,
@@ -50,12 +52,14 @@ WARN_UNUSED_RESULT
 wasmLabelStackPush(
     WasmLabelStack* labelStack,
     const size_t typeStackLength,
-    WasmValueType* type,
+    const U32 typeCount,
+    const WasmValueType* types,
     WasmLabel* result
 ) {
     result->index = labelStack->nextLabelIndex;
     result->typeStackLength = typeStackLength;
-    result->type = type;
+    result->typeCount = typeCount;
+    result->types = types;
 
     MUST (wasmLabelsAppend(&labelStack->labels, *result))
 
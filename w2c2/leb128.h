@@ -27,13 +27,25 @@ leb128ReadU32(
     Buffer* buffer,
     U32* result
 ) {
+    const U8* data = buffer->data;
+    const size_t maxCount =
+        buffer->length < int32LEB128MaxByteCount ? buffer->length : int32LEB128MaxByteCount;
     U32 value = 0;
     U32 shift = 0;
     size_t count = 0;
     U8 byte = 0;
 
-    /* Only read up to maximum number of bytes */
-    while (count < int32LEB128MaxByteCount && bufferReadByte(buffer, &byte)) {
+    /* Fast path for single-byte values, which are the most common */
+    if (maxCount > 0 && (data[0] & 0x80) == 0) {
+        const U8 first = data[0];
+        *result = (U32) first;
+        bufferSkipUnchecked(buffer, 1);
+        return 1;
+    }
+
+    /* Only read up to maximum number of bytes, which are checked to be available once */
+    while (count < maxCount) {
+        byte = data[count];
         count++;
 
         value |= ((U32) (byte & 0x7F)) << shift;
@@ -46,6 +58,8 @@ leb128ReadU32(
         }
     }
 
+    bufferSkipUnchecked(buffer, count);
+
     *result = value;
 
     return count;
@@ -63,13 +77,25 @@ leb128ReadI32(
     Buffer* buffer,
     I32* result
 ) {
+    const U8* data = buffer->data;
+    const size_t maxCount =
+        buffer->length < int32LEB128MaxByteCount ? buffer->length : int32LEB128MaxByteCount;
     I32 value = 0;
     U32 shift = 0;
     size_t count = 0;
     U8 byte = 0;
 
-    /* Only read up to maximum number of bytes */
-    while (count < int32LEB128MaxByteCount && bufferReadByte(buffer, &byte)) {
+    /* Fast path for single-byte values, which are the most common */
+    if (maxCount > 0 && (data[0] & 0x80) == 0) {
+        const U8 first = data[0];
+        *result = ((I32) first) - ((I32) (first & 0x40) << 1);
+        bufferSkipUnchecked(buffer, 1);
+        return 1;
+    }
+
+    /* Only read up to maximum number of bytes, which are checked to be available once */
+    while (count < maxCount) {
+        byte = data[count];
         count++;
 
         value |= (I32) (((U32) (byte & 0x7F)) << shift);
@@ -86,6 +112,8 @@ leb128ReadI32(
         value |= -((I32) 1 << shift);
     }
 
+    bufferSkipUnchecked(buffer, count);
+
     *result = value;
 
     return count;
@@ -113,13 +141,25 @@ leb128ReadU64(
     Buffer* buffer,
     U64* result
 ) {
+    const U8* data = buffer->data;
+    const size_t maxCount =
+        buffer->length < int64LEB128MaxByteCount ? buffer->length : int64LEB128MaxByteCount;
     U64 value = 0;
-    U64 shift = 0;
+    U32 shift = 0;
     size_t count = 0;
     U8 byte = 0;
 
-    /* Only read up to maximum number of bytes */
-    while (count < int64LEB128MaxByteCount && bufferReadByte(buffer, &byte)) {
+    /* Fast path for single-byte values, which are the most common */
+    if (maxCount > 0 && (data[0] & 0x80) == 0) {
+        const U8 first = data[0];
+        *result = (U64) first;
+        bufferSkipUnchecked(buffer, 1);
+        return 1;
+    }
+
+    /* Only read up to maximum number of bytes, which are checked to be available once */
+    while (count < maxCount) {
+        byte = data[count];
         count++;
 
         value |= ((U64) (byte & 0x7F)) << shift;
@@ -132,6 +172,8 @@ leb128ReadU64(
         }
     }
 
+    bufferSkipUnchecked(buffer, count);
+
     *result = value;
 
     return count;
@@ -149,13 +191,25 @@ leb128ReadI64(
     Buffer* buffer,
     I64* result
 ) {
+    const U8* data = buffer->data;
+    const size_t maxCount =
+        buffer->length < int64LEB128MaxByteCount ? buffer->length : int64LEB128MaxByteCount;
     I64 value = 0;
-    U64 shift = 0;
+    U32 shift = 0;
     size_t count = 0;
     U8 byte = 0;
 
-    /* Only read up to maximum number of bytes */
-    while (count < int64LEB128MaxByteCount && bufferReadByte(buffer, &byte)) {
+    /* Fast path for single-byte values, which are the most common */
+    if (maxCount > 0 && (data[0] & 0x80) == 0) {
+        const U8 first = data[0];
+        *result = ((I64) first) - ((I64) (first & 0x40) << 1);
+        bufferSkipUnchecked(buffer, 1);
+        return 1;
+    }
+
+    /* Only read up to maximum number of bytes, which are checked to be available once */
+    while (count < maxCount) {
+        byte = data[count];
         count++;
 
         value |= (I64) (((U64) (byte & 0x7F)) << shift);
@@ -172,10 +226,46 @@ leb128ReadI64(
         value |= -((I64) 1 << shift);
     }
 
+    bufferSkipUnchecked(buffer, count);
+
     *result = value;
 
     return count;
 }
 
+/*
+ * leb128WriteI64 encodes a signed 64-bit integer into the given buffer,
+ * which must have room for at least int64LEB128MaxByteCount bytes.
+ * Returns the number of written bytes.
+ */
+static
+W2C2_INLINE
+size_t
+leb128WriteI64(
+    Buffer* buffer,
+    I64 value
+) {
+    size_t count = 0;
+    bool more = true;
+
+    while (more) {
+        U8 byte = (U8) (value & 0x7F);
+        /* Shift arithmetically, even where right shifts of negative values are logical */
+        value = value < 0 ? ~(~value >> 7) : value >> 7;
+
+        if ((value == 0 && (byte & 0x40) == 0) || (value == -1 && (byte & 0x40) != 0)) {
+            more = false;
+        } else {
+            byte |= 0x80;
+        }
+
+        buffer->data[count] = byte;
+        count++;
+    }
+
+    bufferSkipUnchecked(buffer, count);
+
+    return count;
+}
 
 #endif /* W2C2_LEB128_H */
@@ -109,3 +109,68 @@ testReadI32LEB128(void) {
         exit(1);
     }
 }
+
+void
+testWriteI64LEB128(void) {
+    typedef struct {
+        I64 value;
+        size_t count;
+        U8 expected[int64LEB128MaxByteCount];
+    } testCase;
+
+    const testCase testCases[] = {
+        {0,                        1,  {0x00}},
+        {1,                        1,  {0x01}},
+        {-1,                       1,  {0x7f}},
+        {63,                       1,  {0x3f}},
+        {64,                       2,  {0xc0, 0x00}},
+        {-64,                      1,  {0x40}},
+        {-65,                      2,  {0xbf, 0x7f}},
+        {128,                      2,  {0x80, 0x01}},
+        {-12345,                   3,  {0xc7, 0x9f, 0x7f}},
+        {2147483647,               5,  {0xff, 0xff, 0xff, 0xff, 0x07}},
+        {-2147483647 - 1,          5,  {0x80, 0x80, 0x80, 0x80, 0x78}},
+        {W2C2_LL(9223372036854775807), 10,
+         {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00}},
+        {-W2C2_LL(9223372036854775807) - 1, 10,
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f}},
+    };
+
+    bool success = true;
+    size_t i = 0;
+    for (; i < sizeof(testCases) / sizeof(testCases[0]); i++) {
+        U8 data[int64LEB128MaxByteCount];
+        I64 decoded = 0;
+        size_t count;
+        testCase testCase = testCases[i];
+        Buffer buffer = {
+            NULL,
+            int64LEB128MaxByteCount
+        };
+
+        buffer.data = data;
+        count = leb128WriteI64(&buffer, testCase.value);
+
+        if (count != testCase.count
+            || memcmp(data, testCase.expected, count) != 0
+            || buffer.data != data + count
+        ) {
+            fprintf(stderr, "FAIL testWriteI64LEB128: wrong encoding of value %lu\n", i);
+            success = false;
+            continue;
+        }
+
+        buffer.data = data;
+        buffer.length = count;
+        if (leb128ReadI64(&buffer, &decoded) != count || decoded != testCase.value) {
+            fprintf(stderr, "FAIL testWriteI64LEB128: value %lu does not round-trip\n", i);
+            success = false;
+        }
+    }
+
+    if (success) {
+        fprintf(stderr, "PASS testWriteI64LEB128\n");
+    } else {
+        exit(1);
+    }
+}
@@ -19,12 +19,13 @@
 #include "file.h"
 #include "reader.h"
 #include "c.h"
+#include "snapshot.h"
 #include "compat.h"
 
 #if HAS_PTHREAD
-static char* const optString = "t:f:d:r:pgmch";
+static char* const optString = "t:f:F:d:b:r:C:s:IpgmMGeSUch";
 #else
-static char* const optString = "f:d:r:pgmch";
+static char* const optString = "f:F:d:b:r:C:s:IpgmMGeSUch";
 #endif /* HAS_PTHREAD */
 
 #if defined(__wii__)
@@ -45,12 +46,148 @@ static char* const optString = "f:d:r:pgmch";
 #endif /* HAS_UNISTD */
 #if _WIN32
 #include <direct.h>
+#else
+#include <sys/stat.h>
 #endif
 
 #if _WIN32
 #include <windows.h>
 #endif
 
+typedef struct LongOption {
+    const char* name;
+    /* Short option string the long option is translated to */
+    char* shortOption;
+    bool hasArgument;
+} LongOption;
+
+static const LongOption longOptions[] = {
+    {"cache-dir", "-C", true},
+    {"single-instance", "-S", false},
+    {"tree-shake", "-U", false},
+    {"data-segment-image", "-I", false},
+    {"snapshot", "-s", true},
+    {NULL, NULL, false}
+};
+
+/*
+ * translateLongOptions translates the long options in the given arguments,
+ * i.e. --name VALUE and --name=VALUE, to their short options,
+ * as getopt_long is not available everywhere.
+ * Returns NULL if a long option is unknown
+ */
+static
+char**
+translateLongOptions(
+    const int argc,
+    char* argv[],
+    int* resultArgc
+) {
+    /* Each argument is translated to at most two */
+    char** result = calloc((size_t)argc * 2 + 1, sizeof(char*));
+    int argIndex = 0;
+    int resultIndex = 0;
+
+    if (result == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate arguments\n");
+        return NULL;
+    }
+
+    for (; argIndex < argc; argIndex++) {
+        char* arg = argv[argIndex];
+        const LongOption* longOption = longOptions;
+        size_t nameLength = 0;
+        char* value = NULL;
+
+        /* Only translate options, and stop at the end of the options */
+        if (argIndex == 0 || strncmp(arg, "--", 2) != 0) {
+            result[resultIndex++] = arg;
+            continue;
+        }
+        if (arg[2] == '\0') {
+            for (; argIndex < argc; argIndex++) {
+                result[resultIndex++] = argv[argIndex];
+            }
+            break;
+        }
+
+        value = strchr(arg, '=');
+        nameLength = value != NULL ? (size_t)(value - arg - 2) : strlen(arg + 2);
+
+        for (; longOption->name != NULL; longOption++) {
+            if (strlen(longOption->name) == nameLength
+                && strncmp(longOption->name, arg + 2, nameLength) == 0
+            ) {
+                break;
+            }
+        }
+
+        if (longOption->name == NULL
+            || (value != NULL && !longOption->hasArgument)
+        ) {
+            fprintf(stderr, "w2c2: unknown option `%s'.\n", arg);
+            free(result);
+            return NULL;
+        }
+
+        result[resultIndex++] = longOption->shortOption;
+        if (value != NULL) {
+            result[resultIndex++] = value + 1;
+        }
+    }
+
+    *resultArgc = resultIndex;
+    return result;
+}
+
+/*
+ * prepareCacheDirectory creates the cache directory if necessary,
+ * and returns its absolute path, as the working directory is changed later
+ */
+static
+char*
+prepareCacheDirectory(
+    const char* cacheDirectory
+) {
+    char* result = NULL;
+    char currentDirectory[PATH_MAX];
+    bool absolute = cacheDirectory[0] == PATH_SEPARATOR;
+#if _WIN32
+    absolute = absolute || (cacheDirectory[0] != '\0' && cacheDirectory[1] == ':');
+
+    if (_mkdir(cacheDirectory) != 0 && errno != EEXIST) {
+#else
+    if (mkdir(cacheDirectory, 0777) != 0 && errno != EEXIST) {
+#endif
+        fprintf(
+            stderr,
+            "w2c2: failed to create cache directory %s: %s\n",
+            cacheDirectory,
+            strerror(errno)
+        );
+        return NULL;
+    }
+
+    if (absolute) {
+        currentDirectory[0] = '\0';
+    } else if (getcwd(currentDirectory, PATH_MAX) == NULL) {
+        fprintf(stderr, "w2c2: failed to get current directory: %s\n", strerror(errno));
+        return NULL;
+    }
+
+    result = malloc(strlen(currentDirectory) + strlen(cacheDirectory) + 2);
+    if (result == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate cache directory\n");
+        return NULL;
+    }
+    if (absolute) {
+        strcpy(result, cacheDirectory);
+    } else {
+        sprintf(result, "%s%c%s", currentDirectory, PATH_SEPARATOR, cacheDirectory);
+    }
+    return result;
+}
+
 static
 bool
 readWasmBinary(
@@ -59,7 +196,8 @@ readWasmBinary(
     const bool debug
 ) {
     WasmModuleReaderError* error = NULL;
-    const Buffer buffer = readFile(path);
+    bool mapped = false;
+    const Buffer buffer = mapFile(path, &mapped);
     if (buffer.data == NULL) {
         fprintf(stderr, "w2c2: failed to read file %s\n", path);
         return false;
@@ -76,6 +214,7 @@ readWasmBinary(
             path,
             wasmModuleReaderErrorMessage(error)
         );
+        unmapFile(buffer, mapped);
         return false;
     }
 
@@ -296,18 +435,29 @@ changeToOutputDirectory(
 
 int
 main(
-    const int argc,
+    int argc,
     char* argv[]
 ) {
     U32 threadCount = 0;
     const char* modulePath = NULL;
     const char* referenceModulePath = NULL;
     const char* outputPath = NULL;
+    const char* cacheDirectory = NULL;
+    const char* snapshotExport = NULL;
+    char* cacheDirectoryPath = NULL;
     U32 functionsPerFile = 0;
+    U32 bytesPerFile = 0;
     bool pretty = false;
     bool debug = false;
     bool multipleModules = false;
+    bool cacheMemoryBase = false;
+    bool cacheGlobals = false;
+    bool foldExpressions = false;
+    bool singleInstance = false;
+    bool treeShake = false;
     WasmDataSegmentMode dataSegmentMode = wasmDataSegmentModeArrays;
+    bool dataSegmentImage = false;
+    WasmBoundsCheckMode boundsCheckMode = wasmBoundsCheckModeNone;
     char moduleName[PATH_MAX];
     bool clean = false;
 
@@ -316,6 +466,11 @@ main(
 
     opterr = 0;
 
+    argv = translateLongOptions(argc, argv, &argc);
+    if (argv == NULL) {
+        return 1;
+    }
+
     while ((c = getopt(argc, argv, optString)) != -1) {
         switch (c) {
 #if HAS_PTHREAD
@@ -328,6 +483,10 @@ main(
                 functionsPerFile = (U32) strtoul(optarg, NULL, 0);
                 break;
             }
+            case 'F': {
+                bytesPerFile = (U32) strtoul(optarg, NULL, 0);
+                break;
+            }
             case 'p': {
                 pretty = true;
                 break;
@@ -340,6 +499,26 @@ main(
                 multipleModules = true;
                 break;
             }
+            case 'M': {
+                cacheMemoryBase = true;
+                break;
+            }
+            case 'G': {
+                cacheGlobals = true;
+                break;
+            }
+            case 'e': {
+                foldExpressions = true;
+                break;
+            }
+            case 'S': {
+                singleInstance = true;
+                break;
+            }
+            case 'U': {
+                treeShake = true;
+                break;
+            }
             case 'c': {
                 clean = true;
                 break;
@@ -375,10 +554,46 @@ main(
                 }
                 break;
             }
+            case 's': {
+                snapshotExport = optarg;
+                break;
+            }
+            case 'I': {
+                dataSegmentImage = true;
+                break;
+            }
+            case 'b': {
+                if (strcmp(optarg, "none") == 0) {
+                    boundsCheckMode = wasmBoundsCheckModeNone;
+                } else if (strcmp(optarg, "checked") == 0) {
+                    boundsCheckMode = wasmBoundsCheckModeChecked;
+                } else if (strcmp(optarg, "help") == 0) {
+                    fprintf(
+                        stderr,
+                        "Supported bounds check modes are:\n"
+                        "none           No explicit checks. Relies on the runtime, e.g. guard pages\n"
+                        "checked        Checks memory accesses explicitly. Accesses with the same base\n"
+                        "               address are checked at once\n"
+                    );
+                    return EXIT_SUCCESS;
+                } else {
+                    fprintf(
+                        stderr,
+                        "w2c2: unsupported bounds check mode '%s'. Use 'help' to print available modes\n",
+                        optarg
+                    );
+                    return EXIT_FAILURE;
+                }
+                break;
+            }
             case 'r': {
                 referenceModulePath = optarg;
                 break;
             }
+            case 'C': {
+                cacheDirectory = optarg;
+                break;
+            }
             case 'h': {
                 fprintf(
                     stderr,
@@ -398,11 +613,25 @@ main(
                     "  -t N       Number of threads\n"
 #endif /* HAS_PTHREAD */
                     "  -f N       Number of functions per file. 0 (default) writes all functions into one file\n"
+                    "  -F N       Maximum code size of the functions per file, in bytes of WebAssembly code.\n"
+                    "             0 (default) does not limit the size. Functions larger than N get their own file\n"
                     "  -d MODE    Data segment mode. Default: arrays. Use 'help' to print available modes\n"
+                    "  -I         Start the data segments with an image of the memory, which is mapped copy-on-write\n"
+                    "             where possible (also --data-segment-image). Requires a data section mode\n"
+                    "  -b MODE    Bounds check mode. Default: none. Use 'help' to print available modes\n"
                     "  -g         Generate debug information (function names using asm(); #line directives based on DWARF, if available)\n"
                     "  -p         Generate pretty code\n"
                     "  -m         Support multiple modules (prefixes function names)\n"
+                    "  -M         Cache the memory base address in a local variable\n"
+                    "  -G         Cache mutable globals in local variables\n"
+                    "  -e         Fold single-use stack values into nested expressions\n"
+                    "  -S         Store the only instance of the module statically (also --single-instance)\n"
+                    "  -U         Omit functions unreachable from exports, start function, and tables (also --tree-shake)\n"
                     "  -r         Reference module\n"
+                    "  -C DIR     Cache the generated code of functions in the given directory\n"
+                    "             (also --cache-dir=DIR). Not used when generating debug information\n"
+                    "  -s EXPORT  Call the given export at build time, and start the module in the resulting state\n"
+                    "             (also --snapshot=EXPORT). The snapshot program is compiled using $CC $CFLAGS\n"
                 );
                 return 0;
             }
@@ -433,6 +662,14 @@ main(
     }
 #endif /* HAS_PTHREAD */
 
+    if (dataSegmentImage && dataSegmentMode == wasmDataSegmentModeArrays) {
+        fprintf(
+            stderr,
+            "w2c2: the data segment image requires a data section mode, e.g. '-d gnu-ld'\n"
+        );
+        return 1;
+    }
+
     index = optind;
 
     /* Module argument */
@@ -513,6 +750,13 @@ main(
             functionsPerFile = reader.module->functions.count;
         }
 
+        if (cacheDirectory != NULL && !debug) {
+            cacheDirectoryPath = prepareCacheDirectory(cacheDirectory);
+            if (cacheDirectoryPath == NULL) {
+                return 1;
+            }
+        }
+
         if (!changeToOutputDirectory(outputPath)) {
             return 1;
         }
@@ -521,13 +765,29 @@ main(
             cleanImplementationFiles();
         }
 
+        if (snapshotExport != NULL
+            && !wasmSnapshotModule(reader.module, moduleName, snapshotExport, functionIDs)
+        ) {
+            fprintf(stderr, "w2c2: failed to snapshot module\n");
+            return 1;
+        }
+
         writeOptions.outputPath = outputPath;
         writeOptions.threadCount = threadCount;
         writeOptions.functionsPerFile = functionsPerFile;
+        writeOptions.bytesPerFile = bytesPerFile;
         writeOptions.pretty = pretty;
         writeOptions.debug = debug;
         writeOptions.multipleModules = multipleModules;
         writeOptions.dataSegmentMode = dataSegmentMode;
+        writeOptions.dataSegmentImage = dataSegmentImage;
+        writeOptions.boundsCheckMode = boundsCheckMode;
+        writeOptions.cacheMemoryBase = cacheMemoryBase;
+        writeOptions.cacheGlobals = cacheGlobals;
+        writeOptions.foldExpressions = foldExpressions;
+        writeOptions.singleInstance = singleInstance;
+        writeOptions.treeShake = treeShake;
+        writeOptions.cacheDirectory = cacheDirectoryPath;
 
         if (!wasmCWriteModule(
             reader.module,
@@ -32,6 +32,10 @@ wasmOpcodeDescription(
             return "call";
         case wasmOpcodeCallIndirect:
             return "call_indirect";
+        case wasmOpcodeReturnCall:
+            return "return_call";
+        case wasmOpcodeReturnCallIndirect:
+            return "return_call_indirect";
         case wasmOpcodeDrop:
             return "drop";
         case wasmOpcodeSelect:
@@ -965,3 +969,485 @@ wasmThreadsOpcodeDescription(
         return "unknown";
     }
 }
+
+const char*
+wasmSIMDOpcodeDescription(
+    const WasmSIMDOpcode simdOpcode
+) {
+    switch (simdOpcode) {
+    case wasmSIMDOpcodeV128Load:
+        return "v128.load";
+    case wasmSIMDOpcodeV128Load8x8S:
+        return "v128.load8x8_s";
+    case wasmSIMDOpcodeV128Load8x8U:
+        return "v128.load8x8_u";
+    case wasmSIMDOpcodeV128Load16x4S:
+        return "v128.load16x4_s";
+    case wasmSIMDOpcodeV128Load16x4U:
+        return "v128.load16x4_u";
+    case wasmSIMDOpcodeV128Load32x2S:
+        return "v128.load32x2_s";
+    case wasmSIMDOpcodeV128Load32x2U:
+        return "v128.load32x2_u";
+    case wasmSIMDOpcodeV128Load8Splat:
+        return "v128.load8_splat";
+    case wasmSIMDOpcodeV128Load16Splat:
+        return "v128.load16_splat";
+    case wasmSIMDOpcodeV128Load32Splat:
+        return "v128.load32_splat";
+    case wasmSIMDOpcodeV128Load64Splat:
+        return "v128.load64_splat";
+    case wasmSIMDOpcodeV128Store:
+        return "v128.store";
+    case wasmSIMDOpcodeV128Const:
+        return "v128.const";
+    case wasmSIMDOpcodeI8x16Shuffle:
+        return "i8x16.shuffle";
+    case wasmSIMDOpcodeI8x16Swizzle:
+        return "i8x16.swizzle";
+    case wasmSIMDOpcodeI8x16Splat:
+        return "i8x16.splat";
+    case wasmSIMDOpcodeI16x8Splat:
+        return "i16x8.splat";
+    case wasmSIMDOpcodeI32x4Splat:
+        return "i32x4.splat";
+    case wasmSIMDOpcodeI64x2Splat:
+        return "i64x2.splat";
+    case wasmSIMDOpcodeF32x4Splat:
+        return "f32x4.splat";
+    case wasmSIMDOpcodeF64x2Splat:
+        return "f64x2.splat";
+    case wasmSIMDOpcodeI8x16ExtractLaneS:
+        return "i8x16.extract_lane_s";
+    case wasmSIMDOpcodeI8x16ExtractLaneU:
+        return "i8x16.extract_lane_u";
+    case wasmSIMDOpcodeI8x16ReplaceLane:
+        return "i8x16.replace_lane";
+    case wasmSIMDOpcodeI16x8ExtractLaneS:
+        return "i16x8.extract_lane_s";
+    case wasmSIMDOpcodeI16x8ExtractLaneU:
+        return "i16x8.extract_lane_u";
+    case wasmSIMDOpcodeI16x8ReplaceLane:
+        return "i16x8.replace_lane";
+    case wasmSIMDOpcodeI32x4ExtractLane:
+        return "i32x4.extract_lane";
+    case wasmSIMDOpcodeI32x4ReplaceLane:
+        return "i32x4.replace_lane";
+    case wasmSIMDOpcodeI64x2ExtractLane:
+        return "i64x2.extract_lane";
+    case wasmSIMDOpcodeI64x2ReplaceLane:
+        return "i64x2.replace_lane";
+    case wasmSIMDOpcodeF32x4ExtractLane:
+        return "f32x4.extract_lane";
+    case wasmSIMDOpcodeF32x4ReplaceLane:
+        return "f32x4.replace_lane";
+    case wasmSIMDOpcodeF64x2ExtractLane:
+        return "f64x2.extract_lane";
+    case wasmSIMDOpcodeF64x2ReplaceLane:
+        return "f64x2.replace_lane";
+    case wasmSIMDOpcodeI8x16Eq:
+        return "i8x16.eq";
+    case wasmSIMDOpcodeI8x16Ne:
+        return "i8x16.ne";
+    case wasmSIMDOpcodeI8x16LtS:
+        return "i8x16.lt_s";
+    case wasmSIMDOpcodeI8x16LtU:
+        return "i8x16.lt_u";
+    case wasmSIMDOpcodeI8x16GtS:
+        return "i8x16.gt_s";
+    case wasmSIMDOpcodeI8x16GtU:
+        return "i8x16.gt_u";
+    case wasmSIMDOpcodeI8x16LeS:
+        return "i8x16.le_s";
+    case wasmSIMDOpcodeI8x16LeU:
+        return "i8x16.le_u";
+    case wasmSIMDOpcodeI8x16GeS:
+        return "i8x16.ge_s";
+    case wasmSIMDOpcodeI8x16GeU:
+        return "i8x16.ge_u";
+    case wasmSIMDOpcodeI16x8Eq:
+        return "i16x8.eq";
+    case wasmSIMDOpcodeI16x8Ne:
+        return "i16x8.ne";
+    case wasmSIMDOpcodeI16x8LtS:
+        return "i16x8.lt_s";
+    case wasmSIMDOpcodeI16x8LtU:
+        return "i16x8.lt_u";
+    case wasmSIMDOpcodeI16x8GtS:
+        return "i16x8.gt_s";
+    case wasmSIMDOpcodeI16x8GtU:
+        return "i16x8.gt_u";
+    case wasmSIMDOpcodeI16x8LeS:
+        return "i16x8.le_s";
+    case wasmSIMDOpcodeI16x8LeU:
+        return "i16x8.le_u";
+    case wasmSIMDOpcodeI16x8GeS:
+        return "i16x8.ge_s";
+    case wasmSIMDOpcodeI16x8GeU:
+        return "i16x8.ge_u";
+    case wasmSIMDOpcodeI32x4Eq:
+        return "i32x4.eq";
+    case wasmSIMDOpcodeI32x4Ne:
+        return "i32x4.ne";
+    case wasmSIMDOpcodeI32x4LtS:
+        return "i32x4.lt_s";
+    case wasmSIMDOpcodeI32x4LtU:
+        return "i32x4.lt_u";
+    case wasmSIMDOpcodeI32x4GtS:
+        return "i32x4.gt_s";
+    case wasmSIMDOpcodeI32x4GtU:
+        return "i32x4.gt_u";
+    case wasmSIMDOpcodeI32x4LeS:
+        return "i32x4.le_s";
+    case wasmSIMDOpcodeI32x4LeU:
+        return "i32x4.le_u";
+    case wasmSIMDOpcodeI32x4GeS:
+        return "i32x4.ge_s";
+    case wasmSIMDOpcodeI32x4GeU:
+        return "i32x4.ge_u";
+    case wasmSIMDOpcodeF32x4Eq:
+        return "f32x4.eq";
+    case wasmSIMDOpcodeF32x4Ne:
+        return "f32x4.ne";
+    case wasmSIMDOpcodeF32x4Lt:
+        return "f32x4.lt";
+    case wasmSIMDOpcodeF32x4Gt:
+        return "f32x4.gt";
+    case wasmSIMDOpcodeF32x4Le:
+        return "f32x4.le";
+    case wasmSIMDOpcodeF32x4Ge:
+        return "f32x4.ge";
+    case wasmSIMDOpcodeF64x2Eq:
+        return "f64x2.eq";
+    case wasmSIMDOpcodeF64x2Ne:
+        return "f64x2.ne";
+    case wasmSIMDOpcodeF64x2Lt:
+        return "f64x2.lt";
+    case wasmSIMDOpcodeF64x2Gt:
+        return "f64x2.gt";
+    case wasmSIMDOpcodeF64x2Le:
+        return "f64x2.le";
+    case wasmSIMDOpcodeF64x2Ge:
+        return "f64x2.ge";
+    case wasmSIMDOpcodeV128Not:
+        return "v128.not";
+    case wasmSIMDOpcodeV128And:
+        return "v128.and";
+    case wasmSIMDOpcodeV128Andnot:
+        return "v128.andnot";
+    case wasmSIMDOpcodeV128Or:
+        return "v128.or";
+    case wasmSIMDOpcodeV128Xor:
+        return "v128.xor";
+    case wasmSIMDOpcodeV128Bitselect:
+        return "v128.bitselect";
+    case wasmSIMDOpcodeV128AnyTrue:
+        return "v128.any_true";
+    case wasmSIMDOpcodeV128Load8Lane:
+        return "v128.load8_lane";
+    case wasmSIMDOpcodeV128Load16Lane:
+        return "v128.load16_lane";
+    case wasmSIMDOpcodeV128Load32Lane:
+        return "v128.load32_lane";
+    case wasmSIMDOpcodeV128Load64Lane:
+        return "v128.load64_lane";
+    case wasmSIMDOpcodeV128Store8Lane:
+        return "v128.store8_lane";
+    case wasmSIMDOpcodeV128Store16Lane:
+        return "v128.store16_lane";
+    case wasmSIMDOpcodeV128Store32Lane:
+        return "v128.store32_lane";
+    case wasmSIMDOpcodeV128Store64Lane:
+        return "v128.store64_lane";
+    case wasmSIMDOpcodeV128Load32Zero:
+        return "v128.load32_zero";
+    case wasmSIMDOpcodeV128Load64Zero:
+        return "v128.load64_zero";
+    case wasmSIMDOpcodeF32x4DemoteF64x2Zero:
+        return "f32x4.demote_f64x2_zero";
+    case wasmSIMDOpcodeF64x2PromoteLowF32x4:
+        return "f64x2.promote_low_f32x4";
+    case wasmSIMDOpcodeI8x16Abs:
+        return "i8x16.abs";
+    case wasmSIMDOpcodeI8x16Neg:
+        return "i8x16.neg";
+    case wasmSIMDOpcodeI8x16Popcnt:
+        return "i8x16.popcnt";
+    case wasmSIMDOpcodeI8x16AllTrue:
+        return "i8x16.all_true";
+    case wasmSIMDOpcodeI8x16Bitmask:
+        return "i8x16.bitmask";
+    case wasmSIMDOpcodeI8x16NarrowI16x8S:
+        return "i8x16.narrow_i16x8_s";
+    case wasmSIMDOpcodeI8x16NarrowI16x8U:
+        return "i8x16.narrow_i16x8_u";
+    case wasmSIMDOpcodeF32x4Ceil:
+        return "f32x4.ceil";
+    case wasmSIMDOpcodeF32x4Floor:
+        return "f32x4.floor";
+    case wasmSIMDOpcodeF32x4Trunc:
+        return "f32x4.trunc";
+    case wasmSIMDOpcodeF32x4Nearest:
+        return "f32x4.nearest";
+    case wasmSIMDOpcodeI8x16Shl:
+        return "i8x16.shl";
+    case wasmSIMDOpcodeI8x16ShrS:
+        return "i8x16.shr_s";
+    case wasmSIMDOpcodeI8x16ShrU:
+        return "i8x16.shr_u";
+    case wasmSIMDOpcodeI8x16Add:
+        return "i8x16.add";
+    case wasmSIMDOpcodeI8x16AddSatS:
+        return "i8x16.add_sat_s";
+    case wasmSIMDOpcodeI8x16AddSatU:
+        return "i8x16.add_sat_u";
+    case wasmSIMDOpcodeI8x16Sub:
+        return "i8x16.sub";
+    case wasmSIMDOpcodeI8x16SubSatS:
+        return "i8x16.sub_sat_s";
+    case wasmSIMDOpcodeI8x16SubSatU:
+        return "i8x16.sub_sat_u";
+    case wasmSIMDOpcodeF64x2Ceil:
+        return "f64x2.ceil";
+    case wasmSIMDOpcodeF64x2Floor:
+        return "f64x2.floor";
+    case wasmSIMDOpcodeI8x16MinS:
+        return "i8x16.min_s";
+    case wasmSIMDOpcodeI8x16MinU:
+        return "i8x16.min_u";
+    case wasmSIMDOpcodeI8x16MaxS:
+        return "i8x16.max_s";
+    case wasmSIMDOpcodeI8x16MaxU:
+        return "i8x16.max_u";
+    case wasmSIMDOpcodeF64x2Trunc:
+        return "f64x2.trunc";
+    case wasmSIMDOpcodeI8x16AvgrU:
+        return "i8x16.avgr_u";
+    case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16S:
+        return "i16x8.extadd_pairwise_i8x16_s";
+    case wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16U:
+        return "i16x8.extadd_pairwise_i8x16_u";
+    case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8S:
+        return "i32x4.extadd_pairwise_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8U:
+        return "i32x4.extadd_pairwise_i16x8_u";
+    case wasmSIMDOpcodeI16x8Abs:
+        return "i16x8.abs";
+    case wasmSIMDOpcodeI16x8Neg:
+        return "i16x8.neg";
+    case wasmSIMDOpcodeI16x8Q15mulrSatS:
+        return "i16x8.q15mulr_sat_s";
+    case wasmSIMDOpcodeI16x8AllTrue:
+        return "i16x8.all_true";
+    case wasmSIMDOpcodeI16x8Bitmask:
+        return "i16x8.bitmask";
+    case wasmSIMDOpcodeI16x8NarrowI32x4S:
+        return "i16x8.narrow_i32x4_s";
+    case wasmSIMDOpcodeI16x8NarrowI32x4U:
+        return "i16x8.narrow_i32x4_u";
+    case wasmSIMDOpcodeI16x8ExtendLowI8x16S:
+        return "i16x8.extend_low_i8x16_s";
+    case wasmSIMDOpcodeI16x8ExtendHighI8x16S:
+        return "i16x8.extend_high_i8x16_s";
+    case wasmSIMDOpcodeI16x8ExtendLowI8x16U:
+        return "i16x8.extend_low_i8x16_u";
+    case wasmSIMDOpcodeI16x8ExtendHighI8x16U:
+        return "i16x8.extend_high_i8x16_u";
+    case wasmSIMDOpcodeI16x8Shl:
+        return "i16x8.shl";
+    case wasmSIMDOpcodeI16x8ShrS:
+        return "i16x8.shr_s";
+    case wasmSIMDOpcodeI16x8ShrU:
+        return "i16x8.shr_u";
+    case wasmSIMDOpcodeI16x8Add:
+        return "i16x8.add";
+    case wasmSIMDOpcodeI16x8AddSatS:
+        return "i16x8.add_sat_s";
+    case wasmSIMDOpcodeI16x8AddSatU:
+        return "i16x8.add_sat_u";
+    case wasmSIMDOpcodeI16x8Sub:
+        return "i16x8.sub";
+    case wasmSIMDOpcodeI16x8SubSatS:
+        return "i16x8.sub_sat_s";
+    case wasmSIMDOpcodeI16x8SubSatU:
+        return "i16x8.sub_sat_u";
+    case wasmSIMDOpcodeF64x2Nearest:
+        return "f64x2.nearest";
+    case wasmSIMDOpcodeI16x8Mul:
+        return "i16x8.mul";
+    case wasmSIMDOpcodeI16x8MinS:
+        return "i16x8.min_s";
+    case wasmSIMDOpcodeI16x8MinU:
+        return "i16x8.min_u";
+    case wasmSIMDOpcodeI16x8MaxS:
+        return "i16x8.max_s";
+    case wasmSIMDOpcodeI16x8MaxU:
+        return "i16x8.max_u";
+    case wasmSIMDOpcodeI16x8AvgrU:
+        return "i16x8.avgr_u";
+    case wasmSIMDOpcodeI16x8ExtmulLowI8x16S:
+        return "i16x8.extmul_low_i8x16_s";
+    case wasmSIMDOpcodeI16x8ExtmulHighI8x16S:
+        return "i16x8.extmul_high_i8x16_s";
+    case wasmSIMDOpcodeI16x8ExtmulLowI8x16U:
+        return "i16x8.extmul_low_i8x16_u";
+    case wasmSIMDOpcodeI16x8ExtmulHighI8x16U:
+        return "i16x8.extmul_high_i8x16_u";
+    case wasmSIMDOpcodeI32x4Abs:
+        return "i32x4.abs";
+    case wasmSIMDOpcodeI32x4Neg:
+        return "i32x4.neg";
+    case wasmSIMDOpcodeI32x4AllTrue:
+        return "i32x4.all_true";
+    case wasmSIMDOpcodeI32x4Bitmask:
+        return "i32x4.bitmask";
+    case wasmSIMDOpcodeI32x4ExtendLowI16x8S:
+        return "i32x4.extend_low_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtendHighI16x8S:
+        return "i32x4.extend_high_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtendLowI16x8U:
+        return "i32x4.extend_low_i16x8_u";
+    case wasmSIMDOpcodeI32x4ExtendHighI16x8U:
+        return "i32x4.extend_high_i16x8_u";
+    case wasmSIMDOpcodeI32x4Shl:
+        return "i32x4.shl";
+    case wasmSIMDOpcodeI32x4ShrS:
+        return "i32x4.shr_s";
+    case wasmSIMDOpcodeI32x4ShrU:
+        return "i32x4.shr_u";
+    case wasmSIMDOpcodeI32x4Add:
+        return "i32x4.add";
+    case wasmSIMDOpcodeI32x4Sub:
+        return "i32x4.sub";
+    case wasmSIMDOpcodeI32x4Mul:
+        return "i32x4.mul";
+    case wasmSIMDOpcodeI32x4MinS:
+        return "i32x4.min_s";
+    case wasmSIMDOpcodeI32x4MinU:
+        return "i32x4.min_u";
+    case wasmSIMDOpcodeI32x4MaxS:
+        return "i32x4.max_s";
+    case wasmSIMDOpcodeI32x4MaxU:
+        return "i32x4.max_u";
+    case wasmSIMDOpcodeI32x4DotI16x8S:
+        return "i32x4.dot_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtmulLowI16x8S:
+        return "i32x4.extmul_low_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtmulHighI16x8S:
+        return "i32x4.extmul_high_i16x8_s";
+    case wasmSIMDOpcodeI32x4ExtmulLowI16x8U:
+        return "i32x4.extmul_low_i16x8_u";
+    case wasmSIMDOpcodeI32x4ExtmulHighI16x8U:
+        return "i32x4.extmul_high_i16x8_u";
+    case wasmSIMDOpcodeI64x2Abs:
+        return "i64x2.abs";
+    case wasmSIMDOpcodeI64x2Neg:
+        return "i64x2.neg";
+    case wasmSIMDOpcodeI64x2AllTrue:
+        return "i64x2.all_true";
+    case wasmSIMDOpcodeI64x2Bitmask:
+        return "i64x2.bitmask";
+    case wasmSIMDOpcodeI64x2ExtendLowI32x4S:
+        return "i64x2.extend_low_i32x4_s";
+    case wasmSIMDOpcodeI64x2ExtendHighI32x4S:
+        return "i64x2.extend_high_i32x4_s";
+    case wasmSIMDOpcodeI64x2ExtendLowI32x4U:
+        return "i64x2.extend_low_i32x4_u";
+    case wasmSIMDOpcodeI64x2ExtendHighI32x4U:
+        return "i64x2.extend_high_i32x4_u";
+    case wasmSIMDOpcodeI64x2Shl:
+        return "i64x2.shl";
+    case wasmSIMDOpcodeI64x2ShrS:
+        return "i64x2.shr_s";
+    case wasmSIMDOpcodeI64x2ShrU:
+        return "i64x2.shr_u";
+    case wasmSIMDOpcodeI64x2Add:
+        return "i64x2.add";
+    case wasmSIMDOpcodeI64x2Sub:
+        return "i64x2.sub";
+    case wasmSIMDOpcodeI64x2Mul:
+        return "i64x2.mul";
+    case wasmSIMDOpcodeI64x2Eq:
+        return "i64x2.eq";
+    case wasmSIMDOpcodeI64x2Ne:
+        return "i64x2.ne";
+    case wasmSIMDOpcodeI64x2LtS:
+        return "i64x2.lt_s";
+    case wasmSIMDOpcodeI64x2GtS:
+        return "i64x2.gt_s";
+    case wasmSIMDOpcodeI64x2LeS:
+        return "i64x2.le_s";
+    case wasmSIMDOpcodeI64x2GeS:
+        return "i64x2.ge_s";
+    case wasmSIMDOpcodeI64x2ExtmulLowI32x4S:
+        return "i64x2.extmul_low_i32x4_s";
+    case wasmSIMDOpcodeI64x2ExtmulHighI32x4S:
+        return "i64x2.extmul_high_i32x4_s";
+    case wasmSIMDOpcodeI64x2ExtmulLowI32x4U:
+        return "i64x2.extmul_low_i32x4_u";
+    case wasmSIMDOpcodeI64x2ExtmulHighI32x4U:
+        return "i64x2.extmul_high_i32x4_u";
+    case wasmSIMDOpcodeF32x4Abs:
+        return "f32x4.abs";
+    case wasmSIMDOpcodeF32x4Neg:
+        return "f32x4.neg";
+    case wasmSIMDOpcodeF32x4Sqrt:
+        return "f32x4.sqrt";
+    case wasmSIMDOpcodeF32x4Add:
+        return "f32x4.add";
+    case wasmSIMDOpcodeF32x4Sub:
+        return "f32x4.sub";
+    case wasmSIMDOpcodeF32x4Mul:
+        return "f32x4.mul";
+    case wasmSIMDOpcodeF32x4Div:
+        return "f32x4.div";
+    case wasmSIMDOpcodeF32x4Min:
+        return "f32x4.min";
+    case wasmSIMDOpcodeF32x4Max:
+        return "f32x4.max";
+    case wasmSIMDOpcodeF32x4Pmin:
+        return "f32x4.pmin";
+    case wasmSIMDOpcodeF32x4Pmax:
+        return "f32x4.pmax";
+    case wasmSIMDOpcodeF64x2Abs:
+        return "f64x2.abs";
+    case wasmSIMDOpcodeF64x2Neg:
+        return "f64x2.neg";
+    case wasmSIMDOpcodeF64x2Sqrt:
+        return "f64x2.sqrt";
+    case wasmSIMDOpcodeF64x2Add:
+        return "f64x2.add";
+    case wasmSIMDOpcodeF64x2Sub:
+        return "f64x2.sub";
+    case wasmSIMDOpcodeF64x2Mul:
+        return "f64x2.mul";
+    case wasmSIMDOpcodeF64x2Div:
+        return "f64x2.div";
+    case wasmSIMDOpcodeF64x2Min:
+        return "f64x2.min";
+    case wasmSIMDOpcodeF64x2Max:
+        return "f64x2.max";
+    case wasmSIMDOpcodeF64x2Pmin:
+        return "f64x2.pmin";
+    case wasmSIMDOpcodeF64x2Pmax:
+        return "f64x2.pmax";
+    case wasmSIMDOpcodeI32x4TruncSatF32x4S:
+        return "i32x4.trunc_sat_f32x4_s";
+    case wasmSIMDOpcodeI32x4TruncSatF32x4U:
+        return "i32x4.trunc_sat_f32x4_u";
+    case wasmSIMDOpcodeF32x4ConvertI32x4S:
+        return "f32x4.convert_i32x4_s";
+    case wasmSIMDOpcodeF32x4ConvertI32x4U:
+        return "f32x4.convert_i32x4_u";
+    case wasmSIMDOpcodeI32x4TruncSatF64x2SZero:
+        return "i32x4.trunc_sat_f64x2_s_zero";
+    case wasmSIMDOpcodeI32x4TruncSatF64x2UZero:
+        return "i32x4.trunc_sat_f64x2_u_zero";
+    case wasmSIMDOpcodeF64x2ConvertLowI32x4S:
+        return "f64x2.convert_low_i32x4_s";
+    case wasmSIMDOpcodeF64x2ConvertLowI32x4U:
+        return "f64x2.convert_low_i32x4_u";
+    default:
+        return "unknown";
+    }
+}
@@ -19,6 +19,8 @@ typedef enum WasmOpcode {
     wasmOpcodeReturn            = 0x0F,
     wasmOpcodeCall              = 0x10,
     wasmOpcodeCallIndirect      = 0x11,
+    wasmOpcodeReturnCall        = 0x12,
+    wasmOpcodeReturnCallIndirect = 0x13,
     wasmOpcodeDrop              = 0x1A,
     wasmOpcodeSelect            = 0x1B,
     wasmOpcodeLocalGet          = 0x20,
@@ -184,6 +186,7 @@ typedef enum WasmOpcode {
     wasmOpcodeI64Extend16S      = 0xC3,
     wasmOpcodeI64Extend32S      = 0xC4,
     wasmOpcodeThreadsPrefix     = 0xFE,
+    wasmOpcodeSIMDPrefix        = 0xFD,
     wasmOpcodeMiscPrefix        = 0xFC
 } WasmOpcode;
 
@@ -293,6 +296,252 @@ wasmThreadsOpcodeDescription(
     WasmThreadsOpcode threadsOpcode
 );
 
+/* 0xFD prefix (SIMD128) */
+
+typedef enum WasmSIMDOpcode {
+    wasmSIMDOpcodeV128Load                  = 0x00,
+    wasmSIMDOpcodeV128Load8x8S              = 0x01,
+    wasmSIMDOpcodeV128Load8x8U              = 0x02,
+    wasmSIMDOpcodeV128Load16x4S             = 0x03,
+    wasmSIMDOpcodeV128Load16x4U             = 0x04,
+    wasmSIMDOpcodeV128Load32x2S             = 0x05,
+    wasmSIMDOpcodeV128Load32x2U             = 0x06,
+    wasmSIMDOpcodeV128Load8Splat            = 0x07,
+    wasmSIMDOpcodeV128Load16Splat           = 0x08,
+    wasmSIMDOpcodeV128Load32Splat           = 0x09,
+    wasmSIMDOpcodeV128Load64Splat           = 0x0A,
+    wasmSIMDOpcodeV128Store                 = 0x0B,
+    wasmSIMDOpcodeV128Const                 = 0x0C,
+    wasmSIMDOpcodeI8x16Shuffle              = 0x0D,
+    wasmSIMDOpcodeI8x16Swizzle              = 0x0E,
+    wasmSIMDOpcodeI8x16Splat                = 0x0F,
+    wasmSIMDOpcodeI16x8Splat                = 0x10,
+    wasmSIMDOpcodeI32x4Splat                = 0x11,
+    wasmSIMDOpcodeI64x2Splat                = 0x12,
+    wasmSIMDOpcodeF32x4Splat                = 0x13,
+    wasmSIMDOpcodeF64x2Splat                = 0x14,
+    wasmSIMDOpcodeI8x16ExtractLaneS         = 0x15,
+    wasmSIMDOpcodeI8x16ExtractLaneU         = 0x16,
+    wasmSIMDOpcodeI8x16ReplaceLane          = 0x17,
+    wasmSIMDOpcodeI16x8ExtractLaneS         = 0x18,
+    wasmSIMDOpcodeI16x8ExtractLaneU         = 0x19,
+    wasmSIMDOpcodeI16x8ReplaceLane          = 0x1A,
+    wasmSIMDOpcodeI32x4ExtractLane          = 0x1B,
+    wasmSIMDOpcodeI32x4ReplaceLane          = 0x1C,
+    wasmSIMDOpcodeI64x2ExtractLane          = 0x1D,
+    wasmSIMDOpcodeI64x2ReplaceLane          = 0x1E,
+    wasmSIMDOpcodeF32x4ExtractLane          = 0x1F,
+    wasmSIMDOpcodeF32x4ReplaceLane          = 0x20,
+    wasmSIMDOpcodeF64x2ExtractLane          = 0x21,
+    wasmSIMDOpcodeF64x2ReplaceLane          = 0x22,
+    wasmSIMDOpcodeI8x16Eq                   = 0x23,
+    wasmSIMDOpcodeI8x16Ne                   = 0x24,
+    wasmSIMDOpcodeI8x16LtS                  = 0x25,
+    wasmSIMDOpcodeI8x16LtU                  = 0x26,
+    wasmSIMDOpcodeI8x16GtS                  = 0x27,
+    wasmSIMDOpcodeI8x16GtU                  = 0x28,
+    wasmSIMDOpcodeI8x16LeS                  = 0x29,
+    wasmSIMDOpcodeI8x16LeU                  = 0x2A,
+    wasmSIMDOpcodeI8x16GeS                  = 0x2B,
+    wasmSIMDOpcodeI8x16GeU                  = 0x2C,
+    wasmSIMDOpcodeI16x8Eq                   = 0x2D,
+    wasmSIMDOpcodeI16x8Ne                   = 0x2E,
+    wasmSIMDOpcodeI16x8LtS                  = 0x2F,
+    wasmSIMDOpcodeI16x8LtU                  = 0x30,
+    wasmSIMDOpcodeI16x8GtS                  = 0x31,
+    wasmSIMDOpcodeI16x8GtU                  = 0x32,
+    wasmSIMDOpcodeI16x8LeS                  = 0x33,
+    wasmSIMDOpcodeI16x8LeU                  = 0x34,
+    wasmSIMDOpcodeI16x8GeS                  = 0x35,
+    wasmSIMDOpcodeI16x8GeU                  = 0x36,
+    wasmSIMDOpcodeI32x4Eq                   = 0x37,
+    wasmSIMDOpcodeI32x4Ne                   = 0x38,
+    wasmSIMDOpcodeI32x4LtS                  = 0x39,
+    wasmSIMDOpcodeI32x4LtU                  = 0x3A,
+    wasmSIMDOpcodeI32x4GtS                  = 0x3B,
+    wasmSIMDOpcodeI32x4GtU                  = 0x3C,
+    wasmSIMDOpcodeI32x4LeS                  = 0x3D,
+    wasmSIMDOpcodeI32x4LeU                  = 0x3E,
+    wasmSIMDOpcodeI32x4GeS                  = 0x3F,
+    wasmSIMDOpcodeI32x4GeU                  = 0x40,
+    wasmSIMDOpcodeF32x4Eq                   = 0x41,
+    wasmSIMDOpcodeF32x4Ne                   = 0x42,
+    wasmSIMDOpcodeF32x4Lt                   = 0x43,
+    wasmSIMDOpcodeF32x4Gt                   = 0x44,
+    wasmSIMDOpcodeF32x4Le                   = 0x45,
+    wasmSIMDOpcodeF32x4Ge                   = 0x46,
+    wasmSIMDOpcodeF64x2Eq                   = 0x47,
+    wasmSIMDOpcodeF64x2Ne                   = 0x48,
+    wasmSIMDOpcodeF64x2Lt                   = 0x49,
+    wasmSIMDOpcodeF64x2Gt                   = 0x4A,
+    wasmSIMDOpcodeF64x2Le                   = 0x4B,
+    wasmSIMDOpcodeF64x2Ge                   = 0x4C,
+    wasmSIMDOpcodeV128Not                   = 0x4D,
+    wasmSIMDOpcodeV128And                   = 0x4E,
+    wasmSIMDOpcodeV128Andnot                = 0x4F,
+    wasmSIMDOpcodeV128Or                    = 0x50,
+    wasmSIMDOpcodeV128Xor                   = 0x51,
+    wasmSIMDOpcodeV128Bitselect             = 0x52,
+    wasmSIMDOpcodeV128AnyTrue               = 0x53,
+    wasmSIMDOpcodeV128Load8Lane             = 0x54,
+    wasmSIMDOpcodeV128Load16Lane            = 0x55,
+    wasmSIMDOpcodeV128Load32Lane            = 0x56,
+    wasmSIMDOpcodeV128Load64Lane            = 0x57,
+    wasmSIMDOpcodeV128Store8Lane            = 0x58,
+    wasmSIMDOpcodeV128Store16Lane           = 0x59,
+    wasmSIMDOpcodeV128Store32Lane           = 0x5A,
+    wasmSIMDOpcodeV128Store64Lane           = 0x5B,
+    wasmSIMDOpcodeV128Load32Zero            = 0x5C,
+    wasmSIMDOpcodeV128Load64Zero            = 0x5D,
+    wasmSIMDOpcodeF32x4DemoteF64x2Zero      = 0x5E,
+    wasmSIMDOpcodeF64x2PromoteLowF32x4      = 0x5F,
+    wasmSIMDOpcodeI8x16Abs                  = 0x60,
+    wasmSIMDOpcodeI8x16Neg                  = 0x61,
+    wasmSIMDOpcodeI8x16Popcnt               = 0x62,
+    wasmSIMDOpcodeI8x16AllTrue              = 0x63,
+    wasmSIMDOpcodeI8x16Bitmask              = 0x64,
+    wasmSIMDOpcodeI8x16NarrowI16x8S         = 0x65,
+    wasmSIMDOpcodeI8x16NarrowI16x8U         = 0x66,
+    wasmSIMDOpcodeF32x4Ceil                 = 0x67,
+    wasmSIMDOpcodeF32x4Floor                = 0x68,
+    wasmSIMDOpcodeF32x4Trunc                = 0x69,
+    wasmSIMDOpcodeF32x4Nearest              = 0x6A,
+    wasmSIMDOpcodeI8x16Shl                  = 0x6B,
+    wasmSIMDOpcodeI8x16ShrS                 = 0x6C,
+    wasmSIMDOpcodeI8x16ShrU                 = 0x6D,
+    wasmSIMDOpcodeI8x16Add                  = 0x6E,
+    wasmSIMDOpcodeI8x16AddSatS              = 0x6F,
+    wasmSIMDOpcodeI8x16AddSatU              = 0x70,
+    wasmSIMDOpcodeI8x16Sub                  = 0x71,
+    wasmSIMDOpcodeI8x16SubSatS              = 0x72,
+    wasmSIMDOpcodeI8x16SubSatU              = 0x73,
+    wasmSIMDOpcodeF64x2Ceil                 = 0x74,
+    wasmSIMDOpcodeF64x2Floor                = 0x75,
+    wasmSIMDOpcodeI8x16MinS                 = 0x76,
+    wasmSIMDOpcodeI8x16MinU                 = 0x77,
+    wasmSIMDOpcodeI8x16MaxS                 = 0x78,
+    wasmSIMDOpcodeI8x16MaxU                 = 0x79,
+    wasmSIMDOpcodeF64x2Trunc                = 0x7A,
+    wasmSIMDOpcodeI8x16AvgrU                = 0x7B,
+    wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16S = 0x7C,
+    wasmSIMDOpcodeI16x8ExtaddPairwiseI8x16U = 0x7D,
+    wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8S = 0x7E,
+    wasmSIMDOpcodeI32x4ExtaddPairwiseI16x8U = 0x7F,
+    wasmSIMDOpcodeI16x8Abs                  = 0x80,
+    wasmSIMDOpcodeI16x8Neg                  = 0x81,
+    wasmSIMDOpcodeI16x8Q15mulrSatS          = 0x82,
+    wasmSIMDOpcodeI16x8AllTrue              = 0x83,
+    wasmSIMDOpcodeI16x8Bitmask              = 0x84,
+    wasmSIMDOpcodeI16x8NarrowI32x4S         = 0x85,
+    wasmSIMDOpcodeI16x8NarrowI32x4U         = 0x86,
+    wasmSIMDOpcodeI16x8ExtendLowI8x16S      = 0x87,
+    wasmSIMDOpcodeI16x8ExtendHighI8x16S     = 0x88,
+    wasmSIMDOpcodeI16x8ExtendLowI8x16U      = 0x89,
+    wasmSIMDOpcodeI16x8ExtendHighI8x16U     = 0x8A,
+    wasmSIMDOpcodeI16x8Shl                  = 0x8B,
+    wasmSIMDOpcodeI16x8ShrS                 = 0x8C,
+    wasmSIMDOpcodeI16x8ShrU                 = 0x8D,
+    wasmSIMDOpcodeI16x8Add                  = 0x8E,
+    wasmSIMDOpcodeI16x8AddSatS              = 0x8F,
+    wasmSIMDOpcodeI16x8AddSatU              = 0x90,
+    wasmSIMDOpcodeI16x8Sub                  = 0x91,
+    wasmSIMDOpcodeI16x8SubSatS              = 0x92,
+    wasmSIMDOpcodeI16x8SubSatU              = 0x93,
+    wasmSIMDOpcodeF64x2Nearest              = 0x94,
+    wasmSIMDOpcodeI16x8Mul                  = 0x95,
+    wasmSIMDOpcodeI16x8MinS                 = 0x96,
+    wasmSIMDOpcodeI16x8MinU                 = 0x97,
+    wasmSIMDOpcodeI16x8MaxS                 = 0x98,
+    wasmSIMDOpcodeI16x8MaxU                 = 0x99,
+    wasmSIMDOpcodeI16x8AvgrU                = 0x9B,
+    wasmSIMDOpcodeI16x8ExtmulLowI8x16S      = 0x9C,
+    wasmSIMDOpcodeI16x8ExtmulHighI8x16S     = 0x9D,
+    wasmSIMDOpcodeI16x8ExtmulLowI8x16U      = 0x9E,
+    wasmSIMDOpcodeI16x8ExtmulHighI8x16U     = 0x9F,
+    wasmSIMDOpcodeI32x4Abs                  = 0xA0,
+    wasmSIMDOpcodeI32x4Neg                  = 0xA1,
+    wasmSIMDOpcodeI32x4AllTrue              = 0xA3,
+    wasmSIMDOpcodeI32x4Bitmask              = 0xA4,
+    wasmSIMDOpcodeI32x4ExtendLowI16x8S      = 0xA7,
+    wasmSIMDOpcodeI32x4ExtendHighI16x8S     = 0xA8,
+    wasmSIMDOpcodeI32x4ExtendLowI16x8U      = 0xA9,
+    wasmSIMDOpcodeI32x4ExtendHighI16x8U     = 0xAA,
+    wasmSIMDOpcodeI32x4Shl                  = 0xAB,
+    wasmSIMDOpcodeI32x4ShrS                 = 0xAC,
+    wasmSIMDOpcodeI32x4ShrU                 = 0xAD,
+    wasmSIMDOpcodeI32x4Add                  = 0xAE,
+    wasmSIMDOpcodeI32x4Sub                  = 0xB1,
+    wasmSIMDOpcodeI32x4Mul                  = 0xB5,
+    wasmSIMDOpcodeI32x4MinS                 = 0xB6,
+    wasmSIMDOpcodeI32x4MinU                 = 0xB7,
+    wasmSIMDOpcodeI32x4MaxS                 = 0xB8,
+    wasmSIMDOpcodeI32x4MaxU                 = 0xB9,
+    wasmSIMDOpcodeI32x4DotI16x8S            = 0xBA,
+    wasmSIMDOpcodeI32x4ExtmulLowI16x8S      = 0xBC,
+    wasmSIMDOpcodeI32x4ExtmulHighI16x8S     = 0xBD,
+    wasmSIMDOpcodeI32x4ExtmulLowI16x8U      = 0xBE,
+    wasmSIMDOpcodeI32x4ExtmulHighI16x8U     = 0xBF,
+    wasmSIMDOpcodeI64x2Abs                  = 0xC0,
+    wasmSIMDOpcodeI64x2Neg                  = 0xC1,
+    wasmSIMDOpcodeI64x2AllTrue              = 0xC3,
+    wasmSIMDOpcodeI64x2Bitmask              = 0xC4,
+    wasmSIMDOpcodeI64x2ExtendLowI32x4S      = 0xC7,
+    wasmSIMDOpcodeI64x2ExtendHighI32x4S     = 0xC8,
+    wasmSIMDOpcodeI64x2ExtendLowI32x4U      = 0xC9,
+    wasmSIMDOpcodeI64x2ExtendHighI32x4U     = 0xCA,
+    wasmSIMDOpcodeI64x2Shl                  = 0xCB,
+    wasmSIMDOpcodeI64x2ShrS                 = 0xCC,
+    wasmSIMDOpcodeI64x2ShrU                 = 0xCD,
+    wasmSIMDOpcodeI64x2Add                  = 0xCE,
+    wasmSIMDOpcodeI64x2Sub                  = 0xD1,
+    wasmSIMDOpcodeI64x2Mul                  = 0xD5,
+    wasmSIMDOpcodeI64x2Eq                   = 0xD6,
+    wasmSIMDOpcodeI64x2Ne                   = 0xD7,
+    wasmSIMDOpcodeI64x2LtS                  = 0xD8,
+    wasmSIMDOpcodeI64x2GtS                  = 0xD9,
+    wasmSIMDOpcodeI64x2LeS                  = 0xDA,
+    wasmSIMDOpcodeI64x2GeS                  = 0xDB,
+    wasmSIMDOpcodeI64x2ExtmulLowI32x4S      = 0xDC,
+    wasmSIMDOpcodeI64x2ExtmulHighI32x4S     = 0xDD,
+    wasmSIMDOpcodeI64x2ExtmulLowI32x4U      = 0xDE,
+    wasmSIMDOpcodeI64x2ExtmulHighI32x4U     = 0xDF,
+    wasmSIMDOpcodeF32x4Abs                  = 0xE0,
+    wasmSIMDOpcodeF32x4Neg                  = 0xE1,
+    wasmSIMDOpcodeF32x4Sqrt                 = 0xE3,
+    wasmSIMDOpcodeF32x4Add                  = 0xE4,
+    wasmSIMDOpcodeF32x4Sub                  = 0xE5,
+    wasmSIMDOpcodeF32x4Mul                  = 0xE6,
+    wasmSIMDOpcodeF32x4Div                  = 0xE7,
+    wasmSIMDOpcodeF32x4Min                  = 0xE8,
+    wasmSIMDOpcodeF32x4Max                  = 0xE9,
+    wasmSIMDOpcodeF32x4Pmin                 = 0xEA,
+    wasmSIMDOpcodeF32x4Pmax                 = 0xEB,
+    wasmSIMDOpcodeF64x2Abs                  = 0xEC,
+    wasmSIMDOpcodeF64x2Neg                  = 0xED,
+    wasmSIMDOpcodeF64x2Sqrt                 = 0xEF,
+    wasmSIMDOpcodeF64x2Add                  = 0xF0,
+    wasmSIMDOpcodeF64x2Sub                  = 0xF1,
+    wasmSIMDOpcodeF64x2Mul                  = 0xF2,
+    wasmSIMDOpcodeF64x2Div                  = 0xF3,
+    wasmSIMDOpcodeF64x2Min                  = 0xF4,
+    wasmSIMDOpcodeF64x2Max                  = 0xF5,
+    wasmSIMDOpcodeF64x2Pmin                 = 0xF6,
+    wasmSIMDOpcodeF64x2Pmax                 = 0xF7,
+    wasmSIMDOpcodeI32x4TruncSatF32x4S       = 0xF8,
+    wasmSIMDOpcodeI32x4TruncSatF32x4U       = 0xF9,
+    wasmSIMDOpcodeF32x4ConvertI32x4S        = 0xFA,
+    wasmSIMDOpcodeF32x4ConvertI32x4U        = 0xFB,
+    wasmSIMDOpcodeI32x4TruncSatF64x2SZero   = 0xFC,
+    wasmSIMDOpcodeI32x4TruncSatF64x2UZero   = 0xFD,
+    wasmSIMDOpcodeF64x2ConvertLowI32x4S     = 0xFE,
+    wasmSIMDOpcodeF64x2ConvertLowI32x4U     = 0xFF
+} WasmSIMDOpcode;
+
+const char*
+wasmSIMDOpcodeDescription(
+    WasmSIMDOpcode simdOpcode
+);
+
 WasmValueType
 wasmOpcodeResultType(
     WasmOpcode opcode
@@ -24,6 +24,8 @@ testOpcodes(void) {
         case wasmOpcodeReturn:
         case wasmOpcodeCall:
         case wasmOpcodeCallIndirect:
+        case wasmOpcodeReturnCall:
+        case wasmOpcodeReturnCallIndirect:
         case wasmOpcodeDrop:
         case wasmOpcodeSelect:
         case wasmOpcodeLocalGet:
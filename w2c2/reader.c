@@ -1095,6 +1095,14 @@ wasmReadConstantExpr(
             MUST (wasmGlobalInstructionRead(buffer, &instruction))
             break;
         }
+        case wasmOpcodeSIMDPrefix: {
+            WasmSIMDOpcode simdOpcode = 0;
+            WasmV128ConstInstruction instruction;
+            MUST (leb128ReadU32(buffer, (U32*)&simdOpcode) > 0)
+            MUST (simdOpcode == wasmSIMDOpcodeV128Const)
+            MUST (wasmV128ConstInstructionRead(buffer, &instruction))
+            break;
+        }
         case wasmOpcodeEnd:
             return true;
         default:
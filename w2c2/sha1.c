@@ -15,14 +15,6 @@
 #include "w2c2_base.h"
 #include "sha1.h"
 
-#define SHA1_BLOCK_LENGTH 64
-
-typedef struct {
-    uint32_t state[5];
-    uint64_t count;
-    uint8_t buffer[SHA1_BLOCK_LENGTH];
-} SHA1_CTX;
-
 #define rol(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
 
 /*
@@ -109,7 +101,6 @@ SHA1Transform(uint32_t state[5], const uint8_t buffer[SHA1_BLOCK_LENGTH])
 /*
  * SHA1Init - Initialize new context
  */
-static
 void
 SHA1Init(SHA1_CTX *context)
 {
@@ -126,7 +117,6 @@ SHA1Init(SHA1_CTX *context)
 /*
  * Run your data through this.
  */
-static
 void
 SHA1Update(SHA1_CTX *context, const uint8_t *data, size_t len)
 {
@@ -166,7 +156,6 @@ SHA1Pad(SHA1_CTX *context)
     SHA1Update(context, finalcount, 8); /* Should cause a SHA1Transform() */
 }
 
-static
 void
 SHA1Final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *context)
 {
@@ -16,6 +16,18 @@
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
 }
 
+#define SHA1_BLOCK_LENGTH 64
+
+typedef struct {
+    uint32_t state[5];
+    uint64_t count;
+    uint8_t buffer[SHA1_BLOCK_LENGTH];
+} SHA1_CTX;
+
+void SHA1Init(SHA1_CTX *context);
+void SHA1Update(SHA1_CTX *context, const uint8_t *data, size_t len);
+void SHA1Final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *context);
+
 void SHA1(const unsigned char *data, size_t count, unsigned char *result);
 
 #endif /* W2C2_SHA1_H */
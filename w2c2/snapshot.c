@@ -0,0 +1,513 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "path.h"
+#include "snapshot.h"
+#include "c.h"
+#include "file.h"
+#include "leb128.h"
+#include "opcode.h"
+
+/* A constant expression is an opcode, an immediate of at most 10 bytes (i64.const), and end */
+#define wasmSnapshotConstantExprMaxLength (1 + int64LEB128MaxByteCount + 1)
+
+static
+bool
+wasmSnapshotFindExport(
+    const WasmModule* module,
+    const char* exportName,
+    U32* exportIndex
+) {
+    U32 index = 0;
+    for (; index < module->exports.count; index++) {
+        const WasmExport export = module->exports.exports[index];
+        if (export.kind == wasmExportKindFunction && strcmp(export.name, exportName) == 0) {
+            *exportIndex = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotCheckModule(
+    const WasmModule* module,
+    const char* exportName
+) {
+    U32 exportIndex = 0;
+    WasmFunctionType functionType;
+
+    if (!wasmSnapshotFindExport(module, exportName, &exportIndex)) {
+        fprintf(stderr, "w2c2: snapshot export is not an exported function: %s\n", exportName);
+        return false;
+    }
+
+    MUST (wasmModuleGetFunctionType(module, module->exports.exports[exportIndex].index, &functionType))
+    if (functionType.parameterCount > 0 || functionType.resultCount > 0) {
+        fprintf(stderr, "w2c2: snapshot export must not have parameters or results: %s\n", exportName);
+        return false;
+    }
+
+    if (module->memoryImports.length > 0
+        || module->tableImports.length > 0
+        || module->globalImports.length > 0
+    ) {
+        fprintf(stderr, "w2c2: snapshots of modules which import memories, tables, or globals are not supported\n");
+        return false;
+    }
+
+    {
+        U32 memoryIndex = 0;
+        for (; memoryIndex < module->memories.count; memoryIndex++) {
+            if (module->memories.memories[memoryIndex].shared) {
+                fprintf(stderr, "w2c2: snapshots of shared memories are not supported\n");
+                return false;
+            }
+        }
+    }
+
+    {
+        U32 globalIndex = 0;
+        for (; globalIndex < module->globals.count; globalIndex++) {
+            const WasmGlobal global = module->globals.globals[globalIndex];
+            if (global.type.mutable && global.type.valueType == wasmValueTypeV128) {
+                fprintf(stderr, "w2c2: snapshots of mutable v128 globals are not supported\n");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotRead(
+    Buffer* snapshot,
+    void* result,
+    const size_t length
+) {
+    if (snapshot->length < length) {
+        fprintf(stderr, "w2c2: snapshot is truncated\n");
+        return false;
+    }
+    memcpy(result, snapshot->data, length);
+    bufferSkipUnchecked(snapshot, length);
+    return true;
+}
+
+/* wasmSnapshotConstantExpr allocates a constant expression with the given opcode and encoded immediate */
+static
+Buffer
+wasmSnapshotConstantExpr(
+    const WasmOpcode opcode,
+    const WasmValueType valueType,
+    const U64 bits
+) {
+    Buffer result = {NULL, 0};
+    Buffer code = {NULL, 0};
+    U8* data = calloc(wasmSnapshotConstantExprMaxLength, 1);
+
+    if (data == NULL) {
+        return result;
+    }
+
+    code.data = data;
+    code.length = wasmSnapshotConstantExprMaxLength;
+
+    code.data[0] = (U8) opcode;
+    bufferSkipUnchecked(&code, 1);
+
+    switch (valueType) {
+        case wasmValueTypeI32: {
+            (void) leb128WriteI64(&code, (I64) (I32) (U32) bits);
+            break;
+        }
+        case wasmValueTypeI64: {
+            (void) leb128WriteI64(&code, (I64) bits);
+            break;
+        }
+        case wasmValueTypeF32:
+        case wasmValueTypeF64: {
+            /* Floating-point immediates are stored in little endian byte order */
+            const size_t byteCount = valueType == wasmValueTypeF32 ? 4 : 8;
+            size_t byteIndex = 0;
+            for (; byteIndex < byteCount; byteIndex++) {
+                code.data[byteIndex] = (U8) (bits >> (8 * byteIndex));
+            }
+            bufferSkipUnchecked(&code, byteCount);
+            break;
+        }
+        default: {
+            free(data);
+            return result;
+        }
+    }
+
+    code.data[0] = wasmOpcodeEnd;
+    bufferSkipUnchecked(&code, 1);
+
+    result.data = data;
+    result.length = (size_t) (code.data - data);
+    return result;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotAppendDataSegment(
+    WasmDataSegments* dataSegments,
+    const U32 capacity,
+    const U32 memoryIndex,
+    const U32 address,
+    U8* data,
+    const size_t length
+) {
+    WasmDataSegment dataSegment = wasmEmptyDataSegment;
+
+    if (dataSegments->count >= capacity) {
+        fprintf(stderr, "w2c2: too many snapshot data segments\n");
+        return false;
+    }
+
+    dataSegment.memoryIndex = memoryIndex;
+    dataSegment.offset = wasmSnapshotConstantExpr(wasmOpcodeI32Const, wasmValueTypeI32, address);
+    if (dataSegment.offset.data == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate snapshot data segment\n");
+        return false;
+    }
+    dataSegment.bytes.data = data;
+    dataSegment.bytes.length = length;
+
+    dataSegments->dataSegments[dataSegments->count++] = dataSegment;
+    return true;
+}
+
+/*
+ * wasmSnapshotCountDataSegments returns the number of data segments needed for the given memory snapshot:
+ * one for each run of non-zero bytes, separated by at least wasmSnapshotMinimumZeroRunLength zero bytes
+ */
+static
+size_t
+wasmSnapshotCountDataSegments(
+    const U8* data,
+    const size_t size
+) {
+    size_t count = 0;
+    size_t zeroRunLength = wasmSnapshotMinimumZeroRunLength;
+    size_t position = 0;
+    for (; position < size; position++) {
+        if (data[position] != 0) {
+            if (zeroRunLength >= wasmSnapshotMinimumZeroRunLength) {
+                count++;
+            }
+            zeroRunLength = 0;
+        } else {
+            zeroRunLength++;
+        }
+    }
+    return count;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotApplyMemory(
+    WasmDataSegments* dataSegments,
+    const U32 capacity,
+    const U32 memoryIndex,
+    U8* data,
+    const size_t size
+) {
+    size_t position = 0;
+
+    while (position < size) {
+        size_t start = 0;
+        size_t end = 0;
+
+        for (; position < size && data[position] == 0; position++) {}
+        if (position == size) {
+            break;
+        }
+
+        start = position;
+        end = position;
+        while (position < size) {
+            size_t zeroRunStart = 0;
+            if (data[position] != 0) {
+                position++;
+                end = position;
+                continue;
+            }
+            zeroRunStart = position;
+            for (; position < size && data[position] == 0; position++) {}
+            if (position - zeroRunStart >= wasmSnapshotMinimumZeroRunLength) {
+                break;
+            }
+        }
+
+        MUST (wasmSnapshotAppendDataSegment(
+            dataSegments,
+            capacity,
+            memoryIndex,
+            (U32) start,
+            data + start,
+            end - start
+        ))
+    }
+
+    return true;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotApply(
+    WasmModule* module,
+    const char* exportName,
+    Buffer snapshot
+) {
+    const U32 dataSegmentCount = module->dataSegments.count;
+    WasmDataSegments dataSegments = {NULL, 0};
+    U32 capacity = dataSegmentCount;
+    U32 exportIndex = 0;
+
+    MUST (wasmSnapshotFindExport(module, exportName, &exportIndex))
+
+    /* Determine the number of data segments first, so they can be allocated at once */
+    {
+        Buffer memories = snapshot;
+        U32 memoryIndex = 0;
+        for (; memoryIndex < module->memories.count; memoryIndex++) {
+            U32 pages = 0;
+            size_t size = 0;
+            size_t count = 0;
+            MUST (wasmSnapshotRead(&memories, &pages, sizeof(U32)))
+            size = (size_t) pages * WASM_PAGE_SIZE;
+            if (memories.length < size) {
+                fprintf(stderr, "w2c2: snapshot is truncated\n");
+                return false;
+            }
+            count = wasmSnapshotCountDataSegments(memories.data, size);
+            if (count > (U32) -1 - capacity) {
+                fprintf(stderr, "w2c2: too many snapshot data segments\n");
+                return false;
+            }
+            capacity += (U32) count;
+            bufferSkipUnchecked(&memories, size);
+        }
+    }
+
+    if (capacity > 0) {
+        dataSegments.dataSegments = calloc(capacity, sizeof(WasmDataSegment));
+        if (dataSegments.dataSegments == NULL) {
+            fprintf(stderr, "w2c2: failed to allocate snapshot data segments\n");
+            return false;
+        }
+    }
+
+    /*
+     * The existing data segments keep their indices, for memory.init and data.drop,
+     * but the active ones are already part of the snapshot, so they become empty
+     */
+    {
+        U32 dataSegmentIndex = 0;
+        for (; dataSegmentIndex < dataSegmentCount; dataSegmentIndex++) {
+            WasmDataSegment dataSegment = module->dataSegments.dataSegments[dataSegmentIndex];
+            if (dataSegment.offset.data != NULL) {
+                dataSegment.offset = wasmSnapshotConstantExpr(wasmOpcodeI32Const, wasmValueTypeI32, 0);
+                if (dataSegment.offset.data == NULL) {
+                    fprintf(stderr, "w2c2: failed to allocate snapshot data segment\n");
+                    free(dataSegments.dataSegments);
+                    return false;
+                }
+                dataSegment.bytes.length = 0;
+            }
+            dataSegments.dataSegments[dataSegments.count++] = dataSegment;
+        }
+    }
+
+    {
+        U32 memoryIndex = 0;
+        for (; memoryIndex < module->memories.count; memoryIndex++) {
+            U32 pages = 0;
+            size_t size = 0;
+            MUST (wasmSnapshotRead(&snapshot, &pages, sizeof(U32)))
+            size = (size_t) pages * WASM_PAGE_SIZE;
+            if (!wasmSnapshotApplyMemory(&dataSegments, capacity, memoryIndex, snapshot.data, size)) {
+                free(dataSegments.dataSegments);
+                return false;
+            }
+            bufferSkipUnchecked(&snapshot, size);
+            module->memories.memories[memoryIndex].min = pages;
+        }
+    }
+
+    {
+        U32 globalIndex = 0;
+        for (; globalIndex < module->globals.count; globalIndex++) {
+            WasmGlobal* global = &module->globals.globals[globalIndex];
+            U64 bits = 0;
+            WasmOpcode opcode = wasmOpcodeI32Const;
+
+            if (!global->type.mutable) {
+                continue;
+            }
+
+            switch (global->type.valueType) {
+                case wasmValueTypeI32:
+                case wasmValueTypeF32: {
+                    U32 value = 0;
+                    MUST (wasmSnapshotRead(&snapshot, &value, sizeof(U32)))
+                    bits = value;
+                    opcode = global->type.valueType == wasmValueTypeI32
+                        ? wasmOpcodeI32Const
+                        : wasmOpcodeF32Const;
+                    break;
+                }
+                case wasmValueTypeI64:
+                case wasmValueTypeF64: {
+                    MUST (wasmSnapshotRead(&snapshot, &bits, sizeof(U64)))
+                    opcode = global->type.valueType == wasmValueTypeI64
+                        ? wasmOpcodeI64Const
+                        : wasmOpcodeF64Const;
+                    break;
+                }
+                default: {
+                    fprintf(stderr, "w2c2: unsupported snapshot global type\n");
+                    return false;
+                }
+            }
+
+            global->init = wasmSnapshotConstantExpr(opcode, global->type.valueType, bits);
+            if (global->init.data == NULL) {
+                fprintf(stderr, "w2c2: failed to allocate snapshot global initializer\n");
+                return false;
+            }
+        }
+    }
+
+    if (snapshot.length > 0) {
+        fprintf(stderr, "w2c2: snapshot has unexpected trailing data\n");
+        return false;
+    }
+
+    free(module->dataSegments.dataSegments);
+    module->dataSegments = dataSegments;
+
+    module->hasStartFunction = false;
+
+    module->exports.count--;
+    memmove(
+        module->exports.exports + exportIndex,
+        module->exports.exports + exportIndex + 1,
+        (module->exports.count - exportIndex) * sizeof(WasmExport)
+    );
+
+    return true;
+}
+
+static
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotRun(
+    const char* command
+) {
+    if (system(command) != 0) {
+        fprintf(stderr, "w2c2: snapshot command failed: %s\n", command);
+        return false;
+    }
+    return true;
+}
+
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotModule(
+    WasmModule* module,
+    const char* moduleName,
+    const char* exportName,
+    const WasmFunctionIDs functionIDs
+) {
+    char sourceName[PATH_MAX];
+    char headerName[PATH_MAX];
+    char driverName[PATH_MAX];
+    char programName[PATH_MAX];
+    char snapshotName[PATH_MAX];
+    const char* compiler = getenv("CC");
+    const char* flags = getenv("CFLAGS");
+    char* command = NULL;
+    Buffer snapshot = {NULL, 0};
+    WasmCWriteModuleOptions options = emptyWasmCWriteModuleOptions;
+
+    MUST (wasmSnapshotCheckModule(module, exportName))
+
+    if (strlen(moduleName) + 32 > PATH_MAX) {
+        fprintf(stderr, "w2c2: module name is too long for snapshot: %s\n", moduleName);
+        return false;
+    }
+
+    sprintf(sourceName, "%s_snapshot.c", moduleName);
+    sprintf(headerName, "%s_snapshot.h", moduleName);
+    sprintf(driverName, "%s_snapshot_main.c", moduleName);
+    sprintf(programName, "%s_snapshot", moduleName);
+    sprintf(snapshotName, "%s.snapshot", moduleName);
+
+    if (compiler == NULL || compiler[0] == '\0') {
+        compiler = "cc";
+    }
+    if (flags == NULL) {
+        flags = "";
+    }
+
+    options.outputPath = sourceName;
+    options.threadCount = 1;
+    options.functionsPerFile = module->functions.count;
+
+    /*
+     * The driver calls the start function itself, so it can compare the tables
+     * to the tables of an instance which did not run it
+     */
+    {
+        WasmModule program = *module;
+        program.hasStartFunction = false;
+        MUST (wasmCWriteModule(&program, moduleName, options, functionIDs, emptyWasmFunctionIDs))
+    }
+    MUST (wasmCWriteSnapshotDriver(module, moduleName, headerName, exportName, driverName))
+
+    command = malloc(strlen(compiler) + strlen(flags) + 4 * PATH_MAX + 32);
+    if (command == NULL) {
+        fprintf(stderr, "w2c2: failed to allocate snapshot command\n");
+        return false;
+    }
+
+    fprintf(stderr, "w2c2: compiling snapshot program %s\n", programName);
+    sprintf(command, "%s %s -o %s %s %s -lm", compiler, flags, programName, sourceName, driverName);
+    if (!wasmSnapshotRun(command)) {
+        free(command);
+        return false;
+    }
+
+    fprintf(stderr, "w2c2: running snapshot program %s\n", programName);
+    sprintf(command, ".%s%s %s", PATH_SEPARATOR_STRING, programName, snapshotName);
+    if (!wasmSnapshotRun(command)) {
+        free(command);
+        return false;
+    }
+    free(command);
+
+    /* A snapshot of a module without memories and mutable globals is empty, so it cannot be checked here */
+    snapshot = readFile(snapshotName);
+
+    /* The data segments refer to the snapshot, so it is kept */
+    MUST (wasmSnapshotApply(module, exportName, snapshot))
+
+    remove(sourceName);
+    remove(headerName);
+    remove(driverName);
+    remove(programName);
+    remove(snapshotName);
+
+    return true;
+}
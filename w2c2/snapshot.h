@@ -0,0 +1,59 @@
+#ifndef W2C2_SNAPSHOT_H
+#define W2C2_SNAPSHOT_H
+
+#include "w2c2_base.h"
+#include "buffer.h"
+#include "function.h"
+#include "module.h"
+
+/*
+ * Zero bytes between non-zero bytes of a memory snapshot are only split into separate data segments
+ * if there are at least this many of them, as each data segment is loaded separately
+ */
+#define wasmSnapshotMinimumZeroRunLength 64
+
+/*
+ * wasmSnapshotCheckModule checks whether the state of the module after calling the given export can be snapshotted:
+ * The export must be a function without parameters and results, and the module must not import memories,
+ * tables, or globals, or have shared memories or mutable vector globals.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotCheckModule(
+    const WasmModule* module,
+    const char* exportName
+);
+
+/*
+ * wasmSnapshotApply changes the module so it is instantiated in the given state,
+ * as written by the program of wasmCWriteSnapshotDriver: The memories are initialized
+ * with the non-zero parts of their snapshot, which are appended as active data segments,
+ * the active data segments of the module become empty, and the mutable globals are initialized
+ * with their snapshot values. The start function and the given export are removed,
+ * as their effects are part of the snapshot.
+ * The data segments refer to the data of the snapshot, so it must be kept as long as the module is used.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotApply(
+    WasmModule* module,
+    const char* exportName,
+    Buffer snapshot
+);
+
+/*
+ * wasmSnapshotModule translates the module, and compiles and runs the program of wasmCWriteSnapshotDriver
+ * in the current directory, using the C compiler in the CC environment variable (default cc),
+ * with the flags in the CFLAGS environment variable, then applies the snapshot to the module.
+ * The intermediate files are removed if the snapshot succeeds.
+ */
+bool
+WARN_UNUSED_RESULT
+wasmSnapshotModule(
+    WasmModule* module,
+    const char* moduleName,
+    const char* exportName,
+    WasmFunctionIDs functionIDs
+);
+
+#endif /* W2C2_SNAPSHOT_H */
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <string.h>
+#include "snapshot.h"
+#include "snapshot_test.h"
+#include "instruction.h"
+#include "opcode.h"
+
+static
+bool
+testSnapshotConstant(
+    Buffer code,
+    const WasmOpcode expectedOpcode,
+    WasmValue* value
+) {
+    WasmOpcode opcode;
+    WasmConstInstruction instruction;
+    if (!wasmOpcodeRead(&code, &opcode)
+        || opcode != expectedOpcode
+        || !wasmConstInstructionRead(&code, opcode, &instruction)
+        || code.length != 1
+        || code.data[0] != wasmOpcodeEnd
+    ) {
+        return false;
+    }
+    *value = instruction.value;
+    return true;
+}
+
+static
+void
+testSnapshotFail(
+    const char* message
+) {
+    fprintf(stderr, "FAIL testSnapshotApply: %s\n", message);
+    exit(1);
+}
+
+void
+testSnapshotApply(void) {
+    /* i32.const 16; end */
+    static U8 activeOffset[] = {0x41, 0x10, 0x0B};
+    static U8 activeBytes[] = {1, 2, 3};
+    static U8 passiveBytes[] = {4, 5};
+    static U8 globalInit[] = {0x41, 0x00, 0x0B};
+    static const char* const exportNames[] = {"a", "init", "b"};
+
+    const size_t memorySize = 2 * WASM_PAGE_SIZE;
+    const size_t snapshotLength = sizeof(U32) + memorySize + sizeof(U32) + sizeof(U32) + sizeof(U64);
+    const U32 pages = 2;
+    const I32 i32Value = -7;
+    const F32 f32Value = 1.5f;
+    const U64 i64Value = W2C2_LL(0x123456789);
+
+    WasmFunctionType functionType = wasmEmptyFunctionType;
+    WasmModule module;
+    WasmMemory memory = wasmEmptyMemory;
+    WasmGlobal globals[4];
+    WasmExport exports[3];
+    WasmValue value;
+    Buffer snapshot = {NULL, 0};
+    U8* data = NULL;
+    U32 globalBits = 0;
+    U32 index = 0;
+
+    memset(&module, 0, sizeof(WasmModule));
+
+    module.functionTypes.functionTypes = &functionType;
+    module.functionTypes.count = 1;
+    module.functions.functions = calloc(1, sizeof(WasmFunction));
+    module.functions.count = 1;
+    module.hasStartFunction = true;
+
+    memory.min = 1;
+    memory.max = 4;
+    module.memories.memories = &memory;
+    module.memories.count = 1;
+
+    module.dataSegments.dataSegments = calloc(2, sizeof(WasmDataSegment));
+    module.dataSegments.count = 2;
+    module.dataSegments.dataSegments[0].offset.data = activeOffset;
+    module.dataSegments.dataSegments[0].offset.length = sizeof(activeOffset);
+    module.dataSegments.dataSegments[0].bytes.data = activeBytes;
+    module.dataSegments.dataSegments[0].bytes.length = sizeof(activeBytes);
+    module.dataSegments.dataSegments[1].bytes.data = passiveBytes;
+    module.dataSegments.dataSegments[1].bytes.length = sizeof(passiveBytes);
+
+    for (; index < 4; index++) {
+        globals[index] = wasmEmptyGlobal;
+        globals[index].init.data = globalInit;
+        globals[index].init.length = sizeof(globalInit);
+    }
+    globals[0].type.valueType = wasmValueTypeI32;
+    globals[0].type.mutable = true;
+    globals[1].type.valueType = wasmValueTypeI32;
+    globals[2].type.valueType = wasmValueTypeF32;
+    globals[2].type.mutable = true;
+    globals[3].type.valueType = wasmValueTypeI64;
+    globals[3].type.mutable = true;
+    module.globals.globals = globals;
+    module.globals.count = 4;
+
+    for (index = 0; index < 3; index++) {
+        exports[index] = wasmEmptyExport;
+        exports[index].name = (char*) exportNames[index];
+    }
+    module.exports.exports = exports;
+    module.exports.count = 3;
+
+    /* The memory grew to two pages, and has two runs of bytes, separated by enough zero bytes */
+    data = calloc(snapshotLength, 1);
+    memcpy(data, &pages, sizeof(U32));
+    data[sizeof(U32) + 16] = 1;
+    data[sizeof(U32) + 17] = 2;
+    data[sizeof(U32) + 18] = 3;
+    data[sizeof(U32) + 20] = 9;
+    data[sizeof(U32) + WASM_PAGE_SIZE + 1] = 8;
+    memcpy(data + sizeof(U32) + memorySize, &i32Value, sizeof(I32));
+    memcpy(data + sizeof(U32) + memorySize + sizeof(U32), &f32Value, sizeof(F32));
+    memcpy(data + sizeof(U32) + memorySize + 2 * sizeof(U32), &i64Value, sizeof(U64));
+    snapshot.data = data;
+    snapshot.length = snapshotLength;
+
+    /* A truncated snapshot is rejected */
+    snapshot.length--;
+    if (wasmSnapshotApply(&module, "init", snapshot)) {
+        testSnapshotFail("accepted truncated snapshot");
+    }
+    snapshot.length++;
+
+    if (!wasmSnapshotApply(&module, "init", snapshot)) {
+        testSnapshotFail("failed to apply snapshot");
+    }
+
+    if (memory.min != 2 || memory.max != 4) {
+        testSnapshotFail("wrong memory limits");
+    }
+
+    if (module.dataSegments.count != 4) {
+        testSnapshotFail("wrong number of data segments");
+    }
+
+    /* The active segment is part of the snapshot, but keeps its index */
+    if (module.dataSegments.dataSegments[0].bytes.length != 0
+        || !testSnapshotConstant(module.dataSegments.dataSegments[0].offset, wasmOpcodeI32Const, &value)
+        || value.i32 != 0
+    ) {
+        testSnapshotFail("active data segment not emptied");
+    }
+    if (module.dataSegments.dataSegments[1].offset.data != NULL
+        || module.dataSegments.dataSegments[1].bytes.data != passiveBytes
+    ) {
+        testSnapshotFail("passive data segment changed");
+    }
+
+    if (!testSnapshotConstant(module.dataSegments.dataSegments[2].offset, wasmOpcodeI32Const, &value)
+        || value.i32 != 16
+        || module.dataSegments.dataSegments[2].bytes.length != 5
+        || module.dataSegments.dataSegments[2].bytes.data != data + sizeof(U32) + 16
+    ) {
+        testSnapshotFail("wrong first snapshot data segment");
+    }
+    if (!testSnapshotConstant(module.dataSegments.dataSegments[3].offset, wasmOpcodeI32Const, &value)
+        || value.i32 != WASM_PAGE_SIZE + 1
+        || module.dataSegments.dataSegments[3].bytes.length != 1
+    ) {
+        testSnapshotFail("wrong second snapshot data segment");
+    }
+
+    if (!testSnapshotConstant(globals[0].init, wasmOpcodeI32Const, &value) || value.i32 != -7) {
+        testSnapshotFail("wrong i32 global");
+    }
+    if (globals[1].init.data != globalInit) {
+        testSnapshotFail("immutable global changed");
+    }
+    memcpy(&globalBits, &f32Value, sizeof(U32));
+    if (!testSnapshotConstant(globals[2].init, wasmOpcodeF32Const, &value) || (U32) value.i32 != globalBits) {
+        testSnapshotFail("wrong f32 global");
+    }
+    if (!testSnapshotConstant(globals[3].init, wasmOpcodeI64Const, &value) || (U64) value.i64 != i64Value) {
+        testSnapshotFail("wrong i64 global");
+    }
+
+    if (module.hasStartFunction) {
+        testSnapshotFail("start function not removed");
+    }
+    if (module.exports.count != 2
+        || strcmp(module.exports.exports[0].name, "a") != 0
+        || strcmp(module.exports.exports[1].name, "b") != 0
+    ) {
+        testSnapshotFail("export not removed");
+    }
+
+    fprintf(stderr, "PASS testSnapshotApply\n");
+}
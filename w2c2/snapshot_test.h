@@ -0,0 +1,7 @@
+#ifndef W2C2_SNAPSHOT_TEST_H
+#define W2C2_SNAPSHOT_TEST_H
+
+void
+testSnapshotApply(void);
+
+#endif /* W2C2_SNAPSHOT_TEST_H */
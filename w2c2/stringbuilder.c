@@ -108,6 +108,48 @@ stringBuilderAppendSized(
     return true;
 }
 
+bool
+WARN_UNUSED_RESULT
+stringBuilderAppendRange(
+    StringBuilder* stringBuilder,
+    const size_t start,
+    const size_t length
+) {
+    const size_t newLength = stringBuilder->length + length;
+
+    MUST (start + length <= stringBuilder->length)
+
+    /* Ensure the capacity first, as growing may move the contents */
+    MUST (stringBuilderEnsureCapacity(stringBuilder, newLength))
+
+    memcpy(
+        stringBuilder->string + stringBuilder->length,
+        stringBuilder->string + start,
+        length
+    );
+
+    stringBuilder->length = newLength;
+    stringBuilder->string[stringBuilder->length] = '\0';
+
+    return true;
+}
+
+void
+stringBuilderRemove(
+    StringBuilder* stringBuilder,
+    const size_t start,
+    const size_t length
+) {
+    memmove(
+        stringBuilder->string + start,
+        stringBuilder->string + start + length,
+        stringBuilder->length - start - length
+    );
+
+    stringBuilder->length -= length;
+    stringBuilder->string[stringBuilder->length] = '\0';
+}
+
 bool
 stringBuilderAppendU32(
     StringBuilder* stringBuilder,
@@ -53,6 +53,28 @@ stringBuilderAppend(
     );
 }
 
+/*
+ * stringBuilderAppendRange appends a copy of the given range of the builder's own contents.
+ */
+bool
+WARN_UNUSED_RESULT
+stringBuilderAppendRange(
+    StringBuilder* stringBuilder,
+    size_t start,
+    size_t length
+);
+
+/*
+ * stringBuilderRemove removes the given range of the builder's contents,
+ * moving the following contents forward.
+ */
+void
+stringBuilderRemove(
+    StringBuilder* stringBuilder,
+    size_t start,
+    size_t length
+);
+
 bool
 WARN_UNUSED_RESULT
 stringBuilderAppendChar(
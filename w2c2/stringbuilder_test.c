@@ -130,5 +130,31 @@ testStringBuilder(void) {
         }
     }
 
+    stringBuilderRemove(&builder, 4, builder.length - 4);
+    stringBuilderRemove(&builder, 0, 1);
+    if (!(
+        stringBuilderAppendRange(&builder, 0, 2)
+        && stringBuilderAppendRange(&builder, 1, 3)
+    )) {
+        fprintf(stderr, "FAIL testStringBuilder: failed to append range\n");
+        exit(1);
+    }
+
+    {
+        const char* expected = "hishiish";
+        const size_t expectedLength = strlen(expected);
+        const size_t actualLength = builder.length;
+
+        if (actualLength != expectedLength || memcmp(builder.string, expected, actualLength) != 0) {
+            fprintf(
+                stderr,
+                "FAIL testStringBuilder: incorrect contents after remove and append range: \"%s\" != \"%s\"\n",
+                builder.string,
+                expected
+            );
+            exit(1);
+        }
+    }
+
     fprintf(stderr, "PASS testStringBuilder\n");
 }
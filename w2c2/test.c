@@ -3,14 +3,27 @@
 #include "typestack_test.h"
 #include "opcode_test.h"
 #include "sha1_test.h"
+#include "boundscheck_test.h"
+#include "valuetype_test.h"
+#include "code_test.h"
+#include "dataflow_test.h"
+#include "snapshot_test.h"
+#include "c_test.h"
 
 int
 main(void) {
     testReadU32LEB128();
     testReadI32LEB128();
+    testWriteI64LEB128();
     testStringBuilder();
     testTypeStack();
     testOpcodes();
     testSHA1();
+    testBoundsCheckScan();
+    testReadBlockType();
+    testCodeDecode();
+    testDataflowAnalyzeLocals();
+    testSnapshotApply();
+    testCacheConcurrentWrites();
     return 0;
 }
@@ -10,6 +10,7 @@ typedef enum WasmValueType {
     wasmValueTypeI64,
     wasmValueTypeF32,
     wasmValueTypeF64,
+    wasmValueTypeV128,
     wasmValueType_count
 } WasmValueType;
 
@@ -40,6 +41,9 @@ wasmDecodeValueType(
         case -0x4: /* 0x7C */
             *result = wasmValueTypeF64;
             return true;
+        case -0x5: /* 0x7B */
+            *result = wasmValueTypeV128;
+            return true;
         default: {
             return false;
         }
@@ -62,23 +66,47 @@ wasmReadValueType(
 }
 
 
+typedef enum WasmBlockTypeKind {
+    /* No parameters and no results */
+    wasmBlockTypeKindEmpty,
+    /* No parameters and a single result */
+    wasmBlockTypeKindValueType,
+    /* Parameters and results of a function type */
+    wasmBlockTypeKindFunctionType
+} WasmBlockTypeKind;
+
+typedef struct WasmBlockType {
+    WasmBlockTypeKind kind;
+    WasmValueType valueType;
+    U32 functionTypeIndex;
+} WasmBlockType;
+
 static
 W2C2_INLINE
 bool
+WARN_UNUSED_RESULT
 wasmReadBlockType(
     Buffer* buffer,
-    WasmValueType** result
+    WasmBlockType* result
 ) {
     I32 encodedValueType = 0;
 
     MUST (leb128ReadI32(buffer, &encodedValueType))
 
     if (encodedValueType == -64 /* 0x40 */) {
-        *result = NULL;
+        result->kind = wasmBlockTypeKindEmpty;
+        return true;
+    }
+
+    /* Non-negative values are function type indices */
+    if (encodedValueType >= 0) {
+        result->kind = wasmBlockTypeKindFunctionType;
+        result->functionTypeIndex = (U32) encodedValueType;
         return true;
     }
 
-    return wasmDecodeValueType(encodedValueType, *result);
+    result->kind = wasmBlockTypeKindValueType;
+    return wasmDecodeValueType(encodedValueType, &result->valueType);
 }
 
 
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include "valuetype_test.h"
+#include "valuetype.h"
+
+void
+testReadBlockType(void) {
+    typedef struct {
+        U8 data[2];
+        size_t length;
+        WasmBlockTypeKind expectedKind;
+        WasmValueType expectedValueType;
+        U32 expectedFunctionTypeIndex;
+    } testCase;
+
+    const testCase testCases[] = {
+        {{0x40},       1, wasmBlockTypeKindEmpty,        wasmValueTypeI32, 0},
+        {{0x7F},       1, wasmBlockTypeKindValueType,    wasmValueTypeI32, 0},
+        {{0x7E},       1, wasmBlockTypeKindValueType,    wasmValueTypeI64, 0},
+        {{0x7C},       1, wasmBlockTypeKindValueType,    wasmValueTypeF64, 0},
+        {{0x7B},       1, wasmBlockTypeKindValueType,    wasmValueTypeV128, 0},
+        {{0x00},       1, wasmBlockTypeKindFunctionType, wasmValueTypeI32, 0},
+        {{0x05},       1, wasmBlockTypeKindFunctionType, wasmValueTypeI32, 5},
+        {{0x80, 0x01}, 2, wasmBlockTypeKindFunctionType, wasmValueTypeI32, 128},
+    };
+
+    bool success = true;
+    size_t i = 0;
+    for (; i < sizeof(testCases) / sizeof(testCases[0]); i++) {
+        testCase testCase = testCases[i];
+        WasmBlockType actual;
+        Buffer buffer = {NULL, 0};
+
+        buffer.data = testCase.data;
+        buffer.length = testCase.length;
+
+        if (!wasmReadBlockType(&buffer, &actual)) {
+            fprintf(stderr, "FAIL testReadBlockType: case %lu: read failed\n", (unsigned long) i);
+            success = false;
+            continue;
+        }
+
+        if (actual.kind != testCase.expectedKind
+            || (actual.kind == wasmBlockTypeKindValueType
+                && actual.valueType != testCase.expectedValueType)
+            || (actual.kind == wasmBlockTypeKindFunctionType
+                && actual.functionTypeIndex != testCase.expectedFunctionTypeIndex)
+        ) {
+            fprintf(stderr, "FAIL testReadBlockType: case %lu: unexpected block type\n", (unsigned long) i);
+            success = false;
+        }
+    }
+
+    {
+        /* Invalid value type */
+        U8 data[1] = {0x70};
+        Buffer buffer = {NULL, 1};
+        WasmBlockType actual;
+        buffer.data = data;
+        if (wasmReadBlockType(&buffer, &actual)) {
+            fprintf(stderr, "FAIL testReadBlockType: invalid value type accepted\n");
+            success = false;
+        }
+    }
+
+    if (success) {
+        fprintf(stderr, "PASS testReadBlockType\n");
+    } else {
+        exit(1);
+    }
+}
@@ -0,0 +1,7 @@
+#ifndef W2C2_VALUETYPE_TEST_H
+#define W2C2_VALUETYPE_TEST_H
+
+void
+testReadBlockType(void);
+
+#endif /* W2C2_VALUETYPE_TEST_H */
@@ -196,6 +196,18 @@ typedef double F64;
 #define UNUSED
 #endif
 
+#if defined(__GNUC__) && GCC_VERSION >= 20905
+#define CONST_FUNCTION __attribute__((const))
+#else
+#define CONST_FUNCTION
+#endif
+
+#if defined(__GNUC__) && GCC_VERSION >= 29600
+#define PURE_FUNCTION __attribute__((pure))
+#else
+#define PURE_FUNCTION
+#endif
+
 #ifndef LLONG_MIN
 #define LLONG_MIN (W2C2_LL(-0x7fffffffffffffff)-1)
 #endif
@@ -262,7 +274,8 @@ typedef enum Trap {
     trapDivByZero,
     trapIntOverflow,
     trapInvalidConversion,
-    trapAllocationFailed
+    trapAllocationFailed,
+    trapMemoryOutOfBounds
 } Trap;
 
 static
@@ -282,6 +295,8 @@ trapDescription(
             return "invalid conversion";
         case trapAllocationFailed:
             return "allocation failed";
+        case trapMemoryOutOfBounds:
+            return "out of bounds memory access";
         default:
             return "unknown";
     }
@@ -475,6 +490,85 @@ I64_CTZ(
 }
 #endif
 
+/*
+ * C89 does not declare NAN, signbit, the single-precision math functions,
+ * and the functions rounding to integers other than floor and ceil.
+ * The SIMD helpers below use the following macros,
+ * which fall back to the double-precision functions
+ */
+#if !defined(__cplusplus) \
+    && (!defined(__STDC_VERSION__) || __STDC_VERSION__ < 199901L) \
+    && !(defined(_MSC_VER) && _MSC_VER >= 1800)
+#define W2C2_MATH_C89 1
+#else
+#define W2C2_MATH_C89 0
+#endif
+
+#if W2C2_MATH_C89
+
+#ifndef NAN
+#define NAN ((float)(INFINITY * 0.0F))
+#endif
+
+#ifndef signbit
+#define signbit(x) ((x) < 0 || ((x) == 0 && 1.0 / (x) < 0))
+#endif
+
+static
+W2C2_INLINE
+F64
+wasmTruncF64(
+    const F64 x
+) {
+    return x < 0 ? ceil(x) : floor(x);
+}
+
+/* Rounds to the nearest integer, ties to even, like nearbyint in the default rounding mode */
+static
+W2C2_INLINE
+F64
+wasmNearestF64(
+    const F64 x
+) {
+    F64 result = 0;
+    F64 fraction = 0;
+
+    /* Zeros, NaNs, infinities, and values of at least 2^52 are integral already */
+    if (x == 0 || !(fabs(x) < 4503599627370496.0)) {
+        return x;
+    }
+
+    result = floor(x);
+    fraction = x - result;
+    if (fraction > 0.5 || (fraction == 0.5 && fmod(result, 2.0) != 0)) {
+        result += 1.0;
+    }
+    if (result == 0 && x < 0) {
+        return -0.0;
+    }
+    return result;
+}
+
+#define F32_SQRT(x) ((F32)sqrt(x))
+#define F32_CEIL(x) ((F32)ceil(x))
+#define F32_FLOOR(x) ((F32)floor(x))
+#define F32_TRUNC(x) ((F32)wasmTruncF64(x))
+#define F32_NEAREST(x) ((F32)wasmNearestF64(x))
+#define F64_TRUNC(x) wasmTruncF64(x)
+#define F64_NEAREST(x) wasmNearestF64(x)
+
+#else
+
+#define F32_SQRT(x) sqrtf(x)
+#define F32_CEIL(x) ceilf(x)
+#define F32_FLOOR(x) floorf(x)
+#define F32_TRUNC(x) truncf(x)
+#define F32_NEAREST(x) nearbyintf(x)
+#define F64_TRUNC(x) trunc(x)
+#define F64_NEAREST(x) nearbyint(x)
+
+#endif /* W2C2_MATH_C89 */
+
 #define FMIN(x, y)                                    \
    (((x) != (x)) ? NAN                                \
   : ((y) != (y)) ? NAN                                \
@@ -664,21 +758,247 @@ wasmThreadCreate(
 
 #endif
 
+/*
+ * Guard page memories reserve the whole 32-bit address space,
+ * plus the largest possible static offset of a load or store,
+ * and only make the pages up to the current size accessible.
+ * Out-of-bounds accesses fault in the inaccessible region,
+ * and the fault is turned into a trap. Enabled by default on 64-bit Linux,
+ * if the headers declare the non-standard mapping and signal flags, e.g. not with -std=c89.
+ */
+#if !defined(WASM_MEMORY_GUARD_PAGES) \
+    && defined(__linux__) \
+    && (defined(__x86_64__) || defined(__aarch64__))
+#include <signal.h>
+#include <sys/mman.h>
+#if defined(MAP_ANONYMOUS) \
+    && defined(MAP_NORESERVE) \
+    && defined(SA_NODEFER)
+#define WASM_MEMORY_GUARD_PAGES 1
+#endif
+#endif
+
+#ifndef WASM_MEMORY_GUARD_PAGES
+#define WASM_MEMORY_GUARD_PAGES 0
+#endif /* WASM_MEMORY_GUARD_PAGES */
+
+#if WASM_MEMORY_GUARD_PAGES
+#include <signal.h>
+#include <sys/mman.h>
+#endif /* WASM_MEMORY_GUARD_PAGES */
+
+/*
+ * Without guard pages, shared memories reserve the address space for their maximum size,
+ * so their data never moves while other threads access it,
+ * and only make the pages up to the current size accessible when growing.
+ * Enabled by default where anonymous mappings are available.
+ */
+#if !defined(WASM_MEMORY_RESERVE_SHARED) || WASM_MEMORY_RESERVE_SHARED
+#if !WASM_MEMORY_GUARD_PAGES \
+    && (defined(__unix__) || defined(__APPLE__))
+#include <sys/mman.h>
+#if defined(MAP_ANONYMOUS) && defined(MAP_NORESERVE)
+#define WASM_MEMORY_RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE)
+#elif defined(MAP_ANONYMOUS)
+#define WASM_MEMORY_RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS)
+#elif defined(MAP_ANON)
+#define WASM_MEMORY_RESERVE_FLAGS (MAP_PRIVATE | MAP_ANON)
+#endif
+#endif
+#endif
+
+/* Anonymous mappings are not part of POSIX, so they are not declared e.g. with -std=c89 */
+#ifndef WASM_MEMORY_RESERVE_SHARED
+#ifdef WASM_MEMORY_RESERVE_FLAGS
+#define WASM_MEMORY_RESERVE_SHARED 1
+#else
+#define WASM_MEMORY_RESERVE_SHARED 0
+#endif
+#elif WASM_MEMORY_RESERVE_SHARED && !WASM_MEMORY_GUARD_PAGES && !defined(WASM_MEMORY_RESERVE_FLAGS)
+#error "WASM_MEMORY_RESERVE_SHARED requires anonymous mappings"
+#endif /* WASM_MEMORY_RESERVE_SHARED */
+
+/*
+ * When a memory is reset, its whole pages are discarded with madvise instead of zeroed,
+ * so only the pages that were written are freed, and they read as zero when accessed again.
+ * Enabled by default on Linux, where discarded private pages are guaranteed to be zero,
+ * if MADV_DONTNEED is declared: it is not part of POSIX, so e.g. not with -std=c89.
+ */
+#if !defined(WASM_MEMORY_DISCARD_PAGES) \
+    && defined(__linux__)
+#include <sys/mman.h>
+#ifdef MADV_DONTNEED
+#define WASM_MEMORY_DISCARD_PAGES 1
+#endif
+#endif
+
+#ifndef WASM_MEMORY_DISCARD_PAGES
+#define WASM_MEMORY_DISCARD_PAGES 0
+#endif /* WASM_MEMORY_DISCARD_PAGES */
+
+#if WASM_MEMORY_DISCARD_PAGES
+#include <unistd.h>
+#include <sys/mman.h>
+#endif /* WASM_MEMORY_DISCARD_PAGES */
+
 typedef struct wasmMemory {
     U8* data;
     U32 size;
     U32 pages;
     U32 maxPages;
+    /* Number of bytes allocated or accessible, at least the size. Grows geometrically */
+    size_t capacity;
     bool shared;
     void* futex;
     void (*futexFree)(void* futex);
 #ifdef WASM_MUTEX_TYPE
     WASM_MUTEX_TYPE mutex;
 #endif
+#if WASM_MEMORY_GUARD_PAGES
+    /* Slot of the reservation in the guard regions, cleared when the memory is freed */
+    U8** guardRegion;
+#endif
 } wasmMemory;
 
 #define WASM_PAGE_SIZE 65536
 
+#if WASM_MEMORY_GUARD_PAGES
+
+/* 4 GiB of addressable memory, 4 GiB for the offset immediate, and one page for the access width */
+#define WASM_MEMORY_GUARD_RESERVATION_SIZE (((size_t) 8 << 30) + WASM_PAGE_SIZE)
+
+/*
+ * The reservations of the guard page memories are stored in a fixed number of slots,
+ * which are claimed and cleared atomically, so the signal handler,
+ * which may interrupt any thread at any time, always sees a consistent set of regions
+ */
+#ifndef WASM_MEMORY_GUARD_MAX_MEMORIES
+#define WASM_MEMORY_GUARD_MAX_MEMORIES 1024
+#endif /* WASM_MEMORY_GUARD_MAX_MEMORIES */
+
+static
+W2C2_INLINE
+U8**
+wasmMemoryGuardRegions(void) {
+    static U8* regions[WASM_MEMORY_GUARD_MAX_MEMORIES];
+    return regions;
+}
+
+static
+W2C2_INLINE
+struct sigaction*
+wasmMemoryGuardPreviousAction(void) {
+    static struct sigaction previousAction;
+    return &previousAction;
+}
+
+static
+W2C2_INLINE
+void
+wasmMemoryGuardHandler(
+    int signal,
+    siginfo_t* info,
+    void* context
+) {
+    const U8* address = (const U8*) info->si_addr;
+    U8** regions = wasmMemoryGuardRegions();
+    struct sigaction* previousAction = wasmMemoryGuardPreviousAction();
+    size_t index = 0;
+
+    for (; index < WASM_MEMORY_GUARD_MAX_MEMORIES; index++) {
+        const U8* region = __atomic_load_n(&regions[index], __ATOMIC_ACQUIRE);
+        if (region != NULL
+            && address >= region
+            && address < region + WASM_MEMORY_GUARD_RESERVATION_SIZE
+        ) {
+            trap(trapMemoryOutOfBounds);
+        }
+    }
+
+    /* Not a guard page fault, forward to the previously installed handler */
+    if (previousAction->sa_flags & SA_SIGINFO) {
+        previousAction->sa_sigaction(signal, info, context);
+    } else if (previousAction->sa_handler == SIG_DFL
+        || previousAction->sa_handler == SIG_IGN
+    ) {
+        /* Restore the previous action and let the faulting access re-execute */
+        sigaction(signal, previousAction, NULL);
+    } else {
+        previousAction->sa_handler(signal);
+    }
+}
+
+static
+W2C2_INLINE
+void
+wasmMemoryGuardInstallHandler(void) {
+    /* 0: not installed, 1: being installed by another thread, 2: installed */
+    static int state = 0;
+    int expected = 0;
+    struct sigaction action;
+
+    if (!__atomic_compare_exchange_n(&state, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        /* Installing twice would forward faults to this handler itself */
+        while (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != 2) {}
+        return;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = wasmMemoryGuardHandler;
+    /* The trap handler may not return (e.g. longjmp), so do not block further faults */
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+
+    if (sigaction(SIGSEGV, &action, wasmMemoryGuardPreviousAction()) != 0) {
+        abort();
+    }
+
+    __atomic_store_n(&state, 2, __ATOMIC_RELEASE);
+}
+
+static
+W2C2_INLINE
+void
+wasmMemoryGuardRegister(
+    wasmMemory* memory
+) {
+    U8** regions = wasmMemoryGuardRegions();
+    size_t index = 0;
+
+    for (; index < WASM_MEMORY_GUARD_MAX_MEMORIES; index++) {
+        U8* expected = NULL;
+        if (__atomic_compare_exchange_n(
+            &regions[index],
+            &expected,
+            memory->data,
+            false,
+            __ATOMIC_ACQ_REL,
+            __ATOMIC_RELAXED
+        )) {
+            memory->guardRegion = &regions[index];
+            return;
+        }
+    }
+
+    /* More guard page memories than WASM_MEMORY_GUARD_MAX_MEMORIES */
+    abort();
+}
+
+static
+W2C2_INLINE
+void
+wasmMemoryGuardUnregister(
+    wasmMemory* memory
+) {
+    /* The slot may be in the regions of another translation unit, which allocated the memory */
+    if (memory->guardRegion != NULL) {
+        __atomic_store_n(memory->guardRegion, NULL, __ATOMIC_RELEASE);
+        memory->guardRegion = NULL;
+    }
+}
+
+#endif /* WASM_MEMORY_GUARD_PAGES */
+
 static
 W2C2_INLINE
 wasmMemory*
@@ -687,13 +1007,64 @@ wasmMemoryAllocate(
     const U32 maxPages,
     const bool shared
 ) {
+#if WASM_MEMORY_GUARD_PAGES
+    const size_t size = (size_t) initialPages * WASM_PAGE_SIZE;
+#elif WASM_MEMORY_RESERVE_SHARED
+    const U32 size = initialPages * WASM_PAGE_SIZE;
+#else
     const U32 size = (shared ? maxPages : initialPages) * WASM_PAGE_SIZE;
+#endif
     wasmMemory* memory = (wasmMemory*)calloc(1, sizeof(wasmMemory));
     if (!memory) {
         abort();
     }
-    memory->data = (U8*)calloc(size, 1);
-    memory->size = size;
+#if WASM_MEMORY_GUARD_PAGES
+    {
+        void* data = mmap(
+            NULL,
+            WASM_MEMORY_GUARD_RESERVATION_SIZE,
+            PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+            -1,
+            0
+        );
+        if (data == MAP_FAILED) {
+            abort();
+        }
+        if (size > 0 && mprotect(data, size, PROT_READ | PROT_WRITE) != 0) {
+            abort();
+        }
+        memory->data = (U8*)data;
+    }
+    wasmMemoryGuardInstallHandler();
+    wasmMemoryGuardRegister(memory);
+    memory->size = (U32) size;
+#else
+#if WASM_MEMORY_RESERVE_SHARED
+    if (shared) {
+        const U64 reservationSize = (U64) maxPages * WASM_PAGE_SIZE;
+        const size_t initialSize = (size_t) initialPages * WASM_PAGE_SIZE;
+        void* data = MAP_FAILED;
+        if (reservationSize > 0 && reservationSize <= (U64) (size_t) -1) {
+            data = mmap(NULL, (size_t) reservationSize, PROT_NONE, WASM_MEMORY_RESERVE_FLAGS, -1, 0);
+        }
+        if (data == MAP_FAILED) {
+            abort();
+        }
+        if (initialSize > 0 && mprotect(data, initialSize, PROT_READ | PROT_WRITE) != 0) {
+            abort();
+        }
+        memory->data = (U8*)data;
+        memory->size = (U32) initialSize;
+        memory->capacity = initialSize;
+    } else
+#endif /* WASM_MEMORY_RESERVE_SHARED */
+    {
+        memory->data = (U8*)calloc(size, 1);
+        memory->size = size;
+        memory->capacity = size;
+    }
+#endif
     memory->pages = initialPages;
     memory->maxPages = maxPages;
     memory->shared = shared;
@@ -725,10 +1096,25 @@ void
 wasmMemoryFree(
     wasmMemory* memory
 ) {
-    free(memory->data);
+#if WASM_MEMORY_GUARD_PAGES
+    wasmMemoryGuardUnregister(memory);
+    munmap(memory->data, WASM_MEMORY_GUARD_RESERVATION_SIZE);
+    memory->data = NULL;
+#else
+#if WASM_MEMORY_RESERVE_SHARED
+    if (memory->shared) {
+        munmap(memory->data, (size_t) memory->maxPages * WASM_PAGE_SIZE);
+    } else
+#endif /* WASM_MEMORY_RESERVE_SHARED */
+    {
+        free(memory->data);
+    }
+    memory->data = NULL;
+#endif
 
     memory->size = 0;
     memory->pages = 0;
+    memory->capacity = 0;
 
 #ifdef WASM_MUTEX_TYPE
     if (memory->shared) {
@@ -743,6 +1129,78 @@ wasmMemoryFree(
     memory->futexFree = NULL;
 }
 
+/* wasmMemoryZero zeroes the given data, discarding its whole pages, if enabled */
+static
+W2C2_INLINE
+void
+wasmMemoryZero(
+    U8* data,
+    const size_t length
+) {
+#if WASM_MEMORY_DISCARD_PAGES
+    const size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    const size_t start = (pageSize - (size_t) data % pageSize) % pageSize;
+    if (length >= start + pageSize) {
+        const size_t end = start + (length - start) / pageSize * pageSize;
+        /* Discarding fails e.g. for locked pages, so fall back to zeroing them */
+        if (madvise(data + start, end - start, MADV_DONTNEED) == 0) {
+            memset(data, 0, start);
+            memset(data + end, 0, length - end);
+            return;
+        }
+    }
+#endif /* WASM_MEMORY_DISCARD_PAGES */
+    memset(data, 0, length);
+}
+
+/*
+ * wasmMemoryReset zeroes the given memory and shrinks it to the given number of pages,
+ * but keeps its allocation, so it can be reused by a new instance.
+ * Discarded pages mapped from an image read as the image again instead of zero,
+ * so data segments must be loaded again after the reset.
+ * The memory must not be accessed by other threads while it is reset.
+ */
+static
+W2C2_INLINE
+void
+wasmMemoryReset(
+    wasmMemory* memory,
+    const U32 pages
+) {
+    const size_t oldSize = (size_t) memory->pages * WASM_PAGE_SIZE;
+    const size_t newSize = (size_t) pages * WASM_PAGE_SIZE;
+    /* Growing zeroes the new pages of allocated memories, but not the ones of mappings */
+    size_t zeroSize = oldSize;
+#if !WASM_MEMORY_GUARD_PAGES
+    if (!memory->shared) {
+        zeroSize = newSize;
+    }
+#endif
+
+    wasmMemoryZero(memory->data, zeroSize);
+
+#if WASM_MEMORY_GUARD_PAGES
+    if (newSize < oldSize
+        && mprotect(memory->data + newSize, oldSize - newSize, PROT_NONE) != 0
+    ) {
+        abort();
+    }
+    memory->capacity = newSize;
+#elif WASM_MEMORY_RESERVE_SHARED
+    if (memory->shared) {
+        if (newSize < oldSize
+            && mprotect(memory->data + newSize, oldSize - newSize, PROT_NONE) != 0
+        ) {
+            abort();
+        }
+        memory->capacity = newSize;
+    }
+#endif
+
+    memory->pages = pages;
+    memory->size = (U32) newSize;
+}
+
 static
 W2C2_INLINE
 U32
@@ -773,21 +1231,80 @@ wasmMemoryGrow(
     }
 
     {
+#if WASM_MEMORY_GUARD_PAGES
+        /* The reservation never moves, so growing only makes more pages accessible */
+        const size_t newSize = (size_t) newPages * WASM_PAGE_SIZE;
+        const size_t oldSize = (size_t) oldPages * WASM_PAGE_SIZE;
+        (void) doRealloc;
+        if (newSize > oldSize
+            && mprotect(memory->data + oldSize, newSize - oldSize, PROT_READ | PROT_WRITE) != 0
+        ) {
+            if (memory->shared) {
+#ifdef WASM_MUTEX_TYPE
+                WASM_MUTEX_UNLOCK(&memory->mutex);
+#endif
+            }
+            return (U32) -1;
+        }
+        memory->capacity = newSize;
+#else
         const U32 newSize = newPages * WASM_PAGE_SIZE;
         if (doRealloc) {
             const U32 oldSize = oldPages * WASM_PAGE_SIZE;
             const U32 deltaSize = delta * WASM_PAGE_SIZE;
-            U8* newData = (U8*)realloc(memory->data, newSize);
-            if (newData == NULL) {
-                return (U32) -1;
+
+            /*
+             * Allocators commonly grow the memory by a few pages at a time,
+             * so the capacity is doubled, up to the maximum size,
+             * and growing only copies the data when the capacity is exceeded
+             */
+            if (newSize > memory->capacity) {
+                const U64 maxSize = (U64) memory->maxPages * WASM_PAGE_SIZE;
+                U64 capacity = (U64) memory->capacity * 2;
+                U8* newData = NULL;
+
+                if (capacity > maxSize) {
+                    capacity = maxSize;
+                }
+                if (capacity < newSize || capacity > (U64) (size_t) -1) {
+                    capacity = newSize;
+                }
+
+                newData = (U8*)realloc(memory->data, (size_t) capacity);
+                /* Fall back to the exact size if the larger allocation fails */
+                if (newData == NULL && capacity > newSize) {
+                    capacity = newSize;
+                    newData = (U8*)realloc(memory->data, (size_t) capacity);
+                }
+                if (newData == NULL) {
+                    return (U32) -1;
+                }
+
+                memory->data = newData;
+                memory->capacity = (size_t) capacity;
             }
 
-            memset(newData + oldSize, 0, deltaSize);
-            memory->data = newData;
+            /* The bytes past the size were never accessible, but may be uninitialized */
+            memset(memory->data + oldSize, 0, deltaSize);
         }
+#if WASM_MEMORY_RESERVE_SHARED
+        else {
+            /* Shared memories never move, so growing only makes more pages of the reservation accessible */
+            const size_t oldSize = (size_t) oldPages * WASM_PAGE_SIZE;
+            const size_t deltaSize = (size_t) delta * WASM_PAGE_SIZE;
+            if (deltaSize > 0 && mprotect(memory->data + oldSize, deltaSize, PROT_READ | PROT_WRITE) != 0) {
+#ifdef WASM_MUTEX_TYPE
+                WASM_MUTEX_UNLOCK(&memory->mutex);
+#endif
+                return (U32) -1;
+            }
+            memory->capacity = oldSize + deltaSize;
+        }
+#endif /* WASM_MEMORY_RESERVE_SHARED */
+#endif
 
         memory->pages = newPages;
-        memory->size = newSize;
+        memory->size = (U32) newSize;
     }
 
     if (memory->shared) {
@@ -801,6 +1318,21 @@ wasmMemoryGrow(
     return oldPages;
 }
 
+/* Traps if the given access is out of bounds. Used by code compiled with explicit bounds checks */
+static
+W2C2_INLINE
+void
+wasmMemoryCheckBounds(
+    const wasmMemory* memory,
+    const U64 address,
+    const U32 offset,
+    const U32 length
+) {
+    if (address + offset + length > (U64) memory->pages * WASM_PAGE_SIZE) {
+        trap(trapMemoryOutOfBounds);
+    }
+}
+
 static
 W2C2_INLINE
 void
@@ -845,6 +1377,175 @@ load_data(
     memcpy(dest, src, n);
 }
 
+/*
+ * With guard pages, memories are mappings, so data segment images (see w2c2's -I option)
+ * are mapped into them copy-on-write instead of copied, and pages are only read when accessed.
+ * The image is mapped from the executable, if it is page-aligned in it,
+ * or else from a temporary file the image is written to once.
+ */
+#ifndef WASM_MEMORY_MAP_IMAGE
+#define WASM_MEMORY_MAP_IMAGE WASM_MEMORY_GUARD_PAGES
+#elif WASM_MEMORY_MAP_IMAGE && !WASM_MEMORY_GUARD_PAGES
+#error "WASM_MEMORY_MAP_IMAGE requires WASM_MEMORY_GUARD_PAGES"
+#endif /* WASM_MEMORY_MAP_IMAGE */
+
+#if WASM_MEMORY_MAP_IMAGE
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif /* WASM_MEMORY_MAP_IMAGE */
+
+/*
+ * wasmMemoryImage is the file a data segment image is mapped from.
+ * It is determined when the image is first loaded, and stays open.
+ */
+typedef struct wasmMemoryImage {
+    bool opened;
+    /* -1 if the image is copied */
+    int fd;
+    U64 offset;
+} wasmMemoryImage;
+
+#if WASM_MEMORY_MAP_IMAGE
+
+/*
+ * wasmMemoryImageOpenMapped opens the file the given data is mapped from, e.g. the executable,
+ * and stores the offset of the data in it. Returns -1 if there is no such file
+ */
+static
+W2C2_INLINE
+int
+wasmMemoryImageOpenMapped(
+    const U8* data,
+    const size_t length,
+    U64* offset
+) {
+    FILE* maps = fopen("/proc/self/maps", "r");
+    char line[4352];
+    int fd = -1;
+
+    if (maps == NULL) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), maps) != NULL) {
+        unsigned long start = 0;
+        unsigned long end = 0;
+        unsigned long fileOffset = 0;
+        unsigned long inode = 0;
+        char permissions[5];
+        int pathIndex = 0;
+        char* path = NULL;
+        struct stat status;
+
+        if (sscanf(line, "%lx-%lx %4s %lx %*s %lu %n", &start, &end, permissions, &fileOffset, &inode, &pathIndex) < 5
+            || (unsigned long) data < start
+            || (unsigned long) data + length > end
+        ) {
+            continue;
+        }
+
+        path = line + pathIndex;
+        path[strcspn(path, "\n")] = '\0';
+        *offset = fileOffset + ((unsigned long) data - start);
+
+        /* The file must still be the one that is mapped, e.g. not replaced after the process started */
+        if (path[0] == '/') {
+            fd = open(path, O_RDONLY);
+            if (fd >= 0
+                && (fstat(fd, &status) != 0
+                    || (unsigned long) status.st_ino != inode
+                    || (U64) status.st_size < *offset + length)
+            ) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        break;
+    }
+
+    fclose(maps);
+    return fd;
+}
+
+/* wasmMemoryImageCreateFile writes the given data to a temporary file. Returns -1 on failure */
+static
+W2C2_INLINE
+int
+wasmMemoryImageCreateFile(
+    const U8* data,
+    const size_t length
+) {
+    FILE* file = tmpfile();
+    int fd = -1;
+
+    if (file == NULL) {
+        return -1;
+    }
+    if (fwrite(data, 1, length, file) == length && fflush(file) == 0) {
+        /* The temporary file is deleted when it is closed, so keep a descriptor of it */
+        fd = dup(fileno(file));
+    }
+    fclose(file);
+    return fd;
+}
+
+#endif /* WASM_MEMORY_MAP_IMAGE */
+
+/*
+ * wasmMemoryLoadImage initializes the given range of a new memory with the given image.
+ * The image is only opened once, so the first load must not race with other loads.
+ */
+static
+W2C2_INLINE
+void
+wasmMemoryLoadImage(
+    wasmMemory* memory,
+    wasmMemoryImage* image,
+    const U64 address,
+    const U8* data,
+    const size_t length
+) {
+    U8* target = memory->data + address;
+#if WASM_MEMORY_MAP_IMAGE
+    const size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+
+    if (!image->opened) {
+        image->opened = true;
+        image->fd = -1;
+        image->offset = 0;
+        if ((size_t) data % pageSize == 0) {
+            image->fd = wasmMemoryImageOpenMapped(data, length, &image->offset);
+        }
+        if (image->fd < 0) {
+            image->offset = 0;
+            image->fd = wasmMemoryImageCreateFile(data, length);
+        }
+    }
+
+    if (image->fd >= 0
+        && (size_t) target % pageSize == 0
+        && length % pageSize == 0
+    ) {
+        if (mmap(
+            target,
+            length,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_FIXED,
+            image->fd,
+            (off_t) image->offset
+        ) == MAP_FAILED) {
+            abort();
+        }
+        return;
+    }
+#else
+    (void) image;
+#endif /* WASM_MEMORY_MAP_IMAGE */
+    load_data(target, data, length);
+}
+
 #if WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define readSwapU8(base, offset) (*(U8*)((base) + (offset)))
@@ -883,10 +1584,13 @@ load_data(
 /* DEFINE_LOAD */
 
 #define DEFINE_LOAD(name, t1, t2, t3)                       \
-    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t3 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        memcpy(&result, &mem->data[addr], sizeof(t1));      \
+        memcpy(&result, &data[addr], sizeof(t1));           \
         return (t3)(t2)result;                              \
+    }                                                       \
+    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 /* DEFINE_LOAD8 */
@@ -902,11 +1606,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_LOAD16(name, t1, t2, t3)                     \
-    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t3 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        U16 v = readSwapU16(mem->data, addr);               \
+        U16 v = readSwapU16(data, addr);                    \
         memcpy(&result, &v, sizeof(U16));                   \
         return (t3)(t2)result;                              \
+    }                                                       \
+    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 #endif
@@ -920,11 +1627,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_LOAD32(name, t1, t2, t3)                     \
-    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t3 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        U32 v = readSwapU32(mem->data, addr);               \
+        U32 v = readSwapU32(data, addr);                    \
         memcpy(&result, &v, sizeof(U32));                   \
         return (t3)(t2)result;                              \
+    }                                                       \
+    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 #endif
@@ -938,11 +1648,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_LOAD64(name, t1, t2, t3)                     \
-    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t3 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        U64 v = readSwapU64(mem->data, addr);               \
+        U64 v = readSwapU64(data, addr);                    \
         memcpy(&result, &v, sizeof(U64));                   \
         return (t3)(t2)result;                              \
+    }                                                       \
+    static W2C2_INLINE t3 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 #endif
@@ -950,9 +1663,12 @@ load_data(
 /* DEFINE_STORE */
 
 #define DEFINE_STORE(name, t1, t2)                                      \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
-        memcpy(&mem->data[addr], &wrapped, sizeof(t1));                 \
+        memcpy(&data[addr], &wrapped, sizeof(t1));                      \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 /* DEFINE_STORE8 */
@@ -968,11 +1684,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_STORE16(name, t1, t2)                                    \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
         U16 v;                                                          \
         memcpy(&v, &wrapped, sizeof(U16));                              \
-        writeSwapU16(mem->data, addr, v);                               \
+        writeSwapU16(data, addr, v);                                    \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 #endif
@@ -986,11 +1705,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_STORE32(name, t1, t2)                                    \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
         U32 v;                                                          \
         memcpy(&v, &wrapped, sizeof(U32));                              \
-        writeSwapU32(mem->data, addr, v);                               \
+        writeSwapU32(data, addr, v);                                    \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 #endif
@@ -1004,11 +1726,14 @@ load_data(
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_STORE64(name, t1, t2)                                    \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
         U64 v;                                                          \
         memcpy(&v, &wrapped, sizeof(U64));                              \
-        writeSwapU64(mem->data, addr, v);                               \
+        writeSwapU64(data, addr, v);                                    \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 #endif
@@ -1070,6 +1795,862 @@ DEFINE_SWAP(64, Q, unsigned long long)
 DEFINE_SWAP(32, f, float)
 DEFINE_SWAP(64, d, double)
 
+/* SIMD (128-bit vectors) */
+
+/*
+ * Use GCC/Clang vector extensions for lane-wise operations, if available.
+ * Otherwise, V128 is a union of arrays and all operations are scalar loops.
+ */
+#ifndef WASM_SIMD_VECTOR_EXTENSIONS
+#if defined(__clang__) || (defined(__GNUC__) && GCC_VERSION >= 40700)
+#define WASM_SIMD_VECTOR_EXTENSIONS 1
+#else
+#define WASM_SIMD_VECTOR_EXTENSIONS 0
+#endif
+#endif /* WASM_SIMD_VECTOR_EXTENSIONS */
+
+/* Use native intrinsics for operations which compilers do not detect in loops */
+#if WASM_SIMD_VECTOR_EXTENSIONS && defined(__SSE2__)
+#include <emmintrin.h>
+#define WASM_SIMD_SSE2 1
+#elif WASM_SIMD_VECTOR_EXTENSIONS && defined(__ARM_NEON) && WASM_ENDIAN == WASM_LITTLE_ENDIAN
+#include <arm_neon.h>
+#define WASM_SIMD_NEON 1
+#endif
+
+#ifndef WASM_SIMD_SSE2
+#define WASM_SIMD_SSE2 0
+#endif
+#ifndef WASM_SIMD_NEON
+#define WASM_SIMD_NEON 0
+#endif
+
+#if WASM_SIMD_VECTOR_EXTENSIONS
+
+typedef U8 wasmU8x16 __attribute__((vector_size(16)));
+typedef I8 wasmI8x16 __attribute__((vector_size(16)));
+typedef U16 wasmU16x8 __attribute__((vector_size(16)));
+typedef I16 wasmI16x8 __attribute__((vector_size(16)));
+typedef U32 wasmU32x4 __attribute__((vector_size(16)));
+typedef I32 wasmI32x4 __attribute__((vector_size(16)));
+typedef U64 wasmU64x2 __attribute__((vector_size(16)));
+typedef I64 wasmI64x2 __attribute__((vector_size(16)));
+typedef F32 wasmF32x4 __attribute__((vector_size(16)));
+typedef F64 wasmF64x2 __attribute__((vector_size(16)));
+
+typedef union V128 {
+    wasmU8x16 u8;
+    wasmI8x16 i8;
+    wasmU16x8 u16;
+    wasmI16x8 i16;
+    wasmU32x4 u32;
+    wasmI32x4 i32;
+    wasmU64x2 u64;
+    wasmI64x2 i64;
+    wasmF32x4 f32;
+    wasmF64x2 f64;
+} V128;
+
+#else
+
+typedef union V128 {
+    U8 u8[16];
+    I8 i8[16];
+    U16 u16[8];
+    I16 i16[8];
+    U32 u32[4];
+    I32 i32[4];
+    U64 u64[2];
+    I64 i64[2];
+    F32 f32[4];
+    F64 f64[2];
+} V128;
+
+#endif /* WASM_SIMD_VECTOR_EXTENSIONS */
+
+/*
+ * V128_LANE returns the index of the given WebAssembly lane in the host representation.
+ * On big-endian hosts, vectors are stored as byte-swapped 128-bit integers,
+ * so the lanes of all lane types are in reverse order.
+ * Lane-wise operations are independent of the order.
+ */
+#if WASM_ENDIAN == WASM_LITTLE_ENDIAN
+#define V128_LANE(count, lane) (lane)
+#else
+#define V128_LANE(count, lane) ((count) - 1 - (lane))
+#endif
+
+#define V128_SATURATE(x, min, max) ((x) < (min) ? (min) : (x) > (max) ? (max) : (x))
+
+#define V128_I32_TRUNC_SAT_S(x)                \
+   (((x) != (x)) ? 0                           \
+  : ((x) < -2147483648.) ? INT32_MIN           \
+  : ((x) >= 2147483648.) ? INT32_MAX           \
+  : (I32)(x))
+
+#define V128_I32_TRUNC_SAT_U(x)                \
+   (((x) != (x) || (x) <= -1) ? 0U             \
+  : ((x) >= 4294967296.) ? UINT32_MAX          \
+  : (U32)(x))
+
+static
+W2C2_INLINE
+void
+wasmV128Swap(
+    V128* v
+) {
+#if WASM_ENDIAN == WASM_BIG_ENDIAN
+    U32 index = 0;
+    for (; index < 8; index++) {
+        const U8 tmp = v->u8[index];
+        v->u8[index] = v->u8[15 - index];
+        v->u8[15 - index] = tmp;
+    }
+#else
+    (void)v;
+#endif
+}
+
+static
+W2C2_INLINE
+V128
+v128_zero(void) {
+    V128 r;
+    memset(&r, 0, sizeof(r));
+    return r;
+}
+
+static
+W2C2_INLINE
+V128
+v128_const(
+    U32 l0,
+    U32 l1,
+    U32 l2,
+    U32 l3
+) {
+    V128 r;
+    r.u32[V128_LANE(4, 0)] = l0;
+    r.u32[V128_LANE(4, 1)] = l1;
+    r.u32[V128_LANE(4, 2)] = l2;
+    r.u32[V128_LANE(4, 3)] = l3;
+    return r;
+}
+
+/* DEFINE_V128_UNARY: lane-wise expression of x */
+
+#define DEFINE_V128_UNARY(name, rlanes, lanes, count, t, expr) \
+    static W2C2_INLINE V128 name(V128 a) {                     \
+        V128 r;                                                \
+        U32 l = 0;                                             \
+        for (; l < count; l++) {                               \
+            t x = a.lanes[l];                                  \
+            r.rlanes[l] = expr;                                \
+        }                                                      \
+        return r;                                              \
+    }
+
+/* DEFINE_V128_BINARY_EXPR: lane-wise expression of x and y */
+
+#define DEFINE_V128_BINARY_EXPR(name, rlanes, lanes, count, t, expr) \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                   \
+        V128 r;                                                      \
+        U32 l = 0;                                                   \
+        for (; l < count; l++) {                                     \
+            t x = a.lanes[l];                                        \
+            t y = b.lanes[l];                                        \
+            r.rlanes[l] = expr;                                      \
+        }                                                            \
+        return r;                                                    \
+    }
+
+#if WASM_SIMD_VECTOR_EXTENSIONS
+
+/* DEFINE_V128_BINARY: lane-wise operator, computed in type t when scalar */
+
+#define DEFINE_V128_BINARY(name, lanes, count, t, op) \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {    \
+        V128 r;                                       \
+        r.lanes = a.lanes op b.lanes;                 \
+        return r;                                     \
+    }
+
+/* DEFINE_V128_NEG */
+
+#define DEFINE_V128_NEG(name, lanes, count, t) \
+    static W2C2_INLINE V128 name(V128 a) {     \
+        V128 r;                                \
+        r.lanes = -a.lanes;                    \
+        return r;                              \
+    }
+
+/* DEFINE_V128_COMPARE: lane-wise comparison, all bits of a result lane set if true */
+
+#define DEFINE_V128_COMPARE(name, rlanes, rtype, lanes, count, op) \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                 \
+        V128 r;                                                    \
+        r.rlanes = (rtype)(a.lanes op b.lanes);                    \
+        return r;                                                  \
+    }
+
+/* DEFINE_V128_SHIFT: lane-wise shift, by the count modulo the lane width */
+
+#define DEFINE_V128_SHIFT(name, lanes, count, bits, op) \
+    static W2C2_INLINE V128 name(V128 a, U32 n) {       \
+        V128 r;                                         \
+        r.lanes = a.lanes op (int)(n & (bits - 1));     \
+        return r;                                       \
+    }
+
+#else
+
+#define DEFINE_V128_BINARY(name, lanes, count, t, op) \
+    DEFINE_V128_BINARY_EXPR(name, lanes, lanes, count, t, x op y)
+
+#define DEFINE_V128_NEG(name, lanes, count, t) \
+    DEFINE_V128_UNARY(name, lanes, lanes, count, t, (t)0 - x)
+
+#define DEFINE_V128_COMPARE(name, rlanes, rtype, lanes, count, op) \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                 \
+        V128 r;                                                    \
+        U32 l = 0;                                                 \
+        for (; l < count; l++) {                                   \
+            r.rlanes[l] = (a.lanes[l] op b.lanes[l]) ? -1 : 0;     \
+        }                                                          \
+        return r;                                                  \
+    }
+
+#define DEFINE_V128_SHIFT(name, lanes, count, bits, op)     \
+    static W2C2_INLINE V128 name(V128 a, U32 n) {           \
+        V128 r;                                             \
+        U32 l = 0;                                          \
+        for (; l < count; l++) {                            \
+            r.lanes[l] = a.lanes[l] op (n & (bits - 1));    \
+        }                                                   \
+        return r;                                           \
+    }
+
+#endif /* WASM_SIMD_VECTOR_EXTENSIONS */
+
+/* DEFINE_V128_INTRINSIC: binary operation implemented by a native intrinsic for vectors of type t */
+
+#define DEFINE_V128_INTRINSIC(name, t, intrinsic)                      \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                     \
+        V128 r;                                                        \
+        r.i64 = (wasmI64x2)intrinsic((t)a.i64, (t)b.i64);              \
+        return r;                                                      \
+    }
+
+/* DEFINE_V128_SPLAT */
+
+#define DEFINE_V128_SPLAT(name, lanes, count, t1, t2) \
+    static W2C2_INLINE V128 name(t2 x) {              \
+        V128 r;                                       \
+        U32 l = 0;                                    \
+        for (; l < count; l++) {                      \
+            r.lanes[l] = (t1)x;                       \
+        }                                             \
+        return r;                                     \
+    }
+
+/* DEFINE_V128_EXTRACT_LANE */
+
+#define DEFINE_V128_EXTRACT_LANE(name, lanes, count, t1, t2)  \
+    static W2C2_INLINE t2 name(V128 a, U32 lane) {            \
+        return (t2)(t1)a.lanes[V128_LANE(count, lane)];       \
+    }
+
+/* DEFINE_V128_REPLACE_LANE */
+
+#define DEFINE_V128_REPLACE_LANE(name, lanes, count, t1, t2) \
+    static W2C2_INLINE V128 name(V128 a, U32 lane, t2 x) {   \
+        a.lanes[V128_LANE(count, lane)] = (t1)x;             \
+        return a;                                            \
+    }
+
+/* DEFINE_V128_ALL_TRUE */
+
+#define DEFINE_V128_ALL_TRUE(name, lanes, count) \
+    static W2C2_INLINE U32 name(V128 a) {        \
+        U32 l = 0;                               \
+        for (; l < count; l++) {                 \
+            if (a.lanes[l] == 0) {               \
+                return 0;                        \
+            }                                    \
+        }                                        \
+        return 1;                                \
+    }
+
+/* DEFINE_V128_BITMASK: the sign bits of all lanes */
+
+#define DEFINE_V128_BITMASK(name, lanes, count)         \
+    static W2C2_INLINE U32 name(V128 a) {               \
+        U32 r = 0;                                      \
+        U32 l = 0;                                      \
+        for (; l < count; l++) {                        \
+            if (a.lanes[V128_LANE(count, l)] < 0) {     \
+                r |= 1U << l;                           \
+            }                                           \
+        }                                               \
+        return r;                                       \
+    }
+
+/* DEFINE_V128_EXTEND: converts the low or high half of the lanes to wider lanes */
+
+#define DEFINE_V128_EXTEND(name, rlanes, count, lanes, offset, t)                     \
+    static W2C2_INLINE V128 name(V128 a) {                                            \
+        V128 r;                                                                       \
+        U32 l = 0;                                                                    \
+        for (; l < count; l++) {                                                      \
+            r.rlanes[V128_LANE(count, l)] = (t)a.lanes[V128_LANE(count * 2, l + offset)]; \
+        }                                                                             \
+        return r;                                                                     \
+    }
+
+/* DEFINE_V128_EXTMUL: multiplies the low or high half of the lanes into wider lanes */
+
+#define DEFINE_V128_EXTMUL(name, rlanes, count, lanes, offset, t)                  \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                                 \
+        V128 r;                                                                    \
+        U32 l = 0;                                                                 \
+        for (; l < count; l++) {                                                   \
+            const U32 i = V128_LANE(count * 2, l + offset);                        \
+            r.rlanes[V128_LANE(count, l)] = (t)((t)a.lanes[i] * (t)b.lanes[i]);    \
+        }                                                                          \
+        return r;                                                                  \
+    }
+
+/* DEFINE_V128_EXTADD_PAIRWISE: adds adjacent lanes into wider lanes */
+
+#define DEFINE_V128_EXTADD_PAIRWISE(name, rlanes, count, lanes, t)     \
+    static W2C2_INLINE V128 name(V128 a) {                             \
+        V128 r;                                                        \
+        U32 l = 0;                                                     \
+        for (; l < count; l++) {                                       \
+            r.rlanes[V128_LANE(count, l)] = (t)(                       \
+                (t)a.lanes[V128_LANE(count * 2, l * 2)]                \
+                + (t)a.lanes[V128_LANE(count * 2, l * 2 + 1)]          \
+            );                                                         \
+        }                                                              \
+        return r;                                                      \
+    }
+
+/* DEFINE_V128_NARROW: saturates the lanes of both vectors into narrower lanes */
+
+#define DEFINE_V128_NARROW(name, rlanes, count, lanes, t, min, max)             \
+    static W2C2_INLINE V128 name(V128 a, V128 b) {                              \
+        V128 r;                                                                 \
+        U32 l = 0;                                                              \
+        for (; l < count / 2; l++) {                                            \
+            const I32 x = a.lanes[V128_LANE(count / 2, l)];                     \
+            const I32 y = b.lanes[V128_LANE(count / 2, l)];                     \
+            r.rlanes[V128_LANE(count, l)] = (t)V128_SATURATE(x, min, max);       \
+            r.rlanes[V128_LANE(count, l + count / 2)] = (t)V128_SATURATE(y, min, max); \
+        }                                                                       \
+        return r;                                                               \
+    }
+
+/* DEFINE_V128_DEMOTE: converts both lanes to the low lanes of the result, zeroing the high lanes */
+
+#define DEFINE_V128_DEMOTE(name, rlanes, lanes, t, expr)   \
+    static W2C2_INLINE V128 name(V128 a) {                 \
+        V128 r = v128_zero();                              \
+        U32 l = 0;                                         \
+        for (; l < 2; l++) {                               \
+            t x = a.lanes[V128_LANE(2, l)];                \
+            r.rlanes[V128_LANE(4, l)] = expr;              \
+        }                                                  \
+        return r;                                          \
+    }
+
+/* Bitwise operations */
+
+#if WASM_SIMD_VECTOR_EXTENSIONS
+
+static W2C2_INLINE V128 v128_not(V128 a) {
+    V128 r;
+    r.u64 = ~a.u64;
+    return r;
+}
+
+static W2C2_INLINE V128 v128_andnot(V128 a, V128 b) {
+    V128 r;
+    r.u64 = a.u64 & ~b.u64;
+    return r;
+}
+
+static W2C2_INLINE V128 v128_bitselect(V128 a, V128 b, V128 c) {
+    V128 r;
+    r.u64 = (a.u64 & c.u64) | (b.u64 & ~c.u64);
+    return r;
+}
+
+#else
+
+DEFINE_V128_UNARY(v128_not, u64, u64, 2, U64, ~x)
+DEFINE_V128_BINARY_EXPR(v128_andnot, u64, u64, 2, U64, x & ~y)
+
+static W2C2_INLINE V128 v128_bitselect(V128 a, V128 b, V128 c) {
+    V128 r;
+    U32 l = 0;
+    for (; l < 2; l++) {
+        r.u64[l] = (a.u64[l] & c.u64[l]) | (b.u64[l] & ~c.u64[l]);
+    }
+    return r;
+}
+
+#endif /* WASM_SIMD_VECTOR_EXTENSIONS */
+
+DEFINE_V128_BINARY(v128_and, u64, 2, U64, &)
+DEFINE_V128_BINARY(v128_or, u64, 2, U64, |)
+DEFINE_V128_BINARY(v128_xor, u64, 2, U64, ^)
+
+static W2C2_INLINE U32 v128_any_true(V128 a) {
+    return (a.u64[0] | a.u64[1]) != 0;
+}
+
+/* Constructing and accessing lanes */
+
+static W2C2_INLINE V128 i8x16_shuffle(V128 a, V128 b, V128 lanes) {
+    V128 r;
+    U32 l = 0;
+    for (; l < 16; l++) {
+        const U32 i = lanes.u8[V128_LANE(16, l)];
+        r.u8[V128_LANE(16, l)] = i < 16 ? a.u8[V128_LANE(16, i)] : b.u8[V128_LANE(16, i - 16)];
+    }
+    return r;
+}
+
+static W2C2_INLINE V128 i8x16_swizzle(V128 a, V128 b) {
+    V128 r;
+    U32 l = 0;
+    for (; l < 16; l++) {
+        const U32 i = b.u8[V128_LANE(16, l)];
+        r.u8[V128_LANE(16, l)] = i < 16 ? a.u8[V128_LANE(16, i)] : 0;
+    }
+    return r;
+}
+
+DEFINE_V128_SPLAT(i8x16_splat, u8, 16, U8, U32)
+DEFINE_V128_SPLAT(i16x8_splat, u16, 8, U16, U32)
+DEFINE_V128_SPLAT(i32x4_splat, u32, 4, U32, U32)
+DEFINE_V128_SPLAT(i64x2_splat, u64, 2, U64, U64)
+DEFINE_V128_SPLAT(f32x4_splat, f32, 4, F32, F32)
+DEFINE_V128_SPLAT(f64x2_splat, f64, 2, F64, F64)
+
+DEFINE_V128_EXTRACT_LANE(i8x16_extract_lane_s, i8, 16, I32, U32)
+DEFINE_V128_EXTRACT_LANE(i8x16_extract_lane_u, u8, 16, U32, U32)
+DEFINE_V128_EXTRACT_LANE(i16x8_extract_lane_s, i16, 8, I32, U32)
+DEFINE_V128_EXTRACT_LANE(i16x8_extract_lane_u, u16, 8, U32, U32)
+DEFINE_V128_EXTRACT_LANE(i32x4_extract_lane, u32, 4, U32, U32)
+DEFINE_V128_EXTRACT_LANE(i64x2_extract_lane, u64, 2, U64, U64)
+DEFINE_V128_EXTRACT_LANE(f32x4_extract_lane, f32, 4, F32, F32)
+DEFINE_V128_EXTRACT_LANE(f64x2_extract_lane, f64, 2, F64, F64)
+
+DEFINE_V128_REPLACE_LANE(i8x16_replace_lane, u8, 16, U8, U32)
+DEFINE_V128_REPLACE_LANE(i16x8_replace_lane, u16, 8, U16, U32)
+DEFINE_V128_REPLACE_LANE(i32x4_replace_lane, u32, 4, U32, U32)
+DEFINE_V128_REPLACE_LANE(i64x2_replace_lane, u64, 2, U64, U64)
+DEFINE_V128_REPLACE_LANE(f32x4_replace_lane, f32, 4, F32, F32)
+DEFINE_V128_REPLACE_LANE(f64x2_replace_lane, f64, 2, F64, F64)
+
+/* Comparisons */
+
+DEFINE_V128_COMPARE(i8x16_eq, i8, wasmI8x16, u8, 16, ==)
+DEFINE_V128_COMPARE(i8x16_ne, i8, wasmI8x16, u8, 16, !=)
+DEFINE_V128_COMPARE(i8x16_lt_s, i8, wasmI8x16, i8, 16, <)
+DEFINE_V128_COMPARE(i8x16_lt_u, i8, wasmI8x16, u8, 16, <)
+DEFINE_V128_COMPARE(i8x16_gt_s, i8, wasmI8x16, i8, 16, >)
+DEFINE_V128_COMPARE(i8x16_gt_u, i8, wasmI8x16, u8, 16, >)
+DEFINE_V128_COMPARE(i8x16_le_s, i8, wasmI8x16, i8, 16, <=)
+DEFINE_V128_COMPARE(i8x16_le_u, i8, wasmI8x16, u8, 16, <=)
+DEFINE_V128_COMPARE(i8x16_ge_s, i8, wasmI8x16, i8, 16, >=)
+DEFINE_V128_COMPARE(i8x16_ge_u, i8, wasmI8x16, u8, 16, >=)
+
+DEFINE_V128_COMPARE(i16x8_eq, i16, wasmI16x8, u16, 8, ==)
+DEFINE_V128_COMPARE(i16x8_ne, i16, wasmI16x8, u16, 8, !=)
+DEFINE_V128_COMPARE(i16x8_lt_s, i16, wasmI16x8, i16, 8, <)
+DEFINE_V128_COMPARE(i16x8_lt_u, i16, wasmI16x8, u16, 8, <)
+DEFINE_V128_COMPARE(i16x8_gt_s, i16, wasmI16x8, i16, 8, >)
+DEFINE_V128_COMPARE(i16x8_gt_u, i16, wasmI16x8, u16, 8, >)
+DEFINE_V128_COMPARE(i16x8_le_s, i16, wasmI16x8, i16, 8, <=)
+DEFINE_V128_COMPARE(i16x8_le_u, i16, wasmI16x8, u16, 8, <=)
+DEFINE_V128_COMPARE(i16x8_ge_s, i16, wasmI16x8, i16, 8, >=)
+DEFINE_V128_COMPARE(i16x8_ge_u, i16, wasmI16x8, u16, 8, >=)
+
+DEFINE_V128_COMPARE(i32x4_eq, i32, wasmI32x4, u32, 4, ==)
+DEFINE_V128_COMPARE(i32x4_ne, i32, wasmI32x4, u32, 4, !=)
+DEFINE_V128_COMPARE(i32x4_lt_s, i32, wasmI32x4, i32, 4, <)
+DEFINE_V128_COMPARE(i32x4_lt_u, i32, wasmI32x4, u32, 4, <)
+DEFINE_V128_COMPARE(i32x4_gt_s, i32, wasmI32x4, i32, 4, >)
+DEFINE_V128_COMPARE(i32x4_gt_u, i32, wasmI32x4, u32, 4, >)
+DEFINE_V128_COMPARE(i32x4_le_s, i32, wasmI32x4, i32, 4, <=)
+DEFINE_V128_COMPARE(i32x4_le_u, i32, wasmI32x4, u32, 4, <=)
+DEFINE_V128_COMPARE(i32x4_ge_s, i32, wasmI32x4, i32, 4, >=)
+DEFINE_V128_COMPARE(i32x4_ge_u, i32, wasmI32x4, u32, 4, >=)
+
+DEFINE_V128_COMPARE(i64x2_eq, i64, wasmI64x2, u64, 2, ==)
+DEFINE_V128_COMPARE(i64x2_ne, i64, wasmI64x2, u64, 2, !=)
+DEFINE_V128_COMPARE(i64x2_lt_s, i64, wasmI64x2, i64, 2, <)
+DEFINE_V128_COMPARE(i64x2_gt_s, i64, wasmI64x2, i64, 2, >)
+DEFINE_V128_COMPARE(i64x2_le_s, i64, wasmI64x2, i64, 2, <=)
+DEFINE_V128_COMPARE(i64x2_ge_s, i64, wasmI64x2, i64, 2, >=)
+
+DEFINE_V128_COMPARE(f32x4_eq, i32, wasmI32x4, f32, 4, ==)
+DEFINE_V128_COMPARE(f32x4_ne, i32, wasmI32x4, f32, 4, !=)
+DEFINE_V128_COMPARE(f32x4_lt, i32, wasmI32x4, f32, 4, <)
+DEFINE_V128_COMPARE(f32x4_gt, i32, wasmI32x4, f32, 4, >)
+DEFINE_V128_COMPARE(f32x4_le, i32, wasmI32x4, f32, 4, <=)
+DEFINE_V128_COMPARE(f32x4_ge, i32, wasmI32x4, f32, 4, >=)
+
+DEFINE_V128_COMPARE(f64x2_eq, i64, wasmI64x2, f64, 2, ==)
+DEFINE_V128_COMPARE(f64x2_ne, i64, wasmI64x2, f64, 2, !=)
+DEFINE_V128_COMPARE(f64x2_lt, i64, wasmI64x2, f64, 2, <)
+DEFINE_V128_COMPARE(f64x2_gt, i64, wasmI64x2, f64, 2, >)
+DEFINE_V128_COMPARE(f64x2_le, i64, wasmI64x2, f64, 2, <=)
+DEFINE_V128_COMPARE(f64x2_ge, i64, wasmI64x2, f64, 2, >=)
+
+/* Integer arithmetic */
+
+static
+W2C2_INLINE
+U32
+wasmV128PopCount8(
+    U32 x
+) {
+    x = x - ((x >> 1) & 0x55U);
+    x = (x & 0x33U) + ((x >> 2) & 0x33U);
+    return (x + (x >> 4)) & 0x0FU;
+}
+
+DEFINE_V128_UNARY(i8x16_abs, u8, i8, 16, I8, (U8)(x < 0 ? 0U - (U32)x : (U32)x))
+DEFINE_V128_NEG(i8x16_neg, u8, 16, U32)
+DEFINE_V128_UNARY(i8x16_popcnt, u8, u8, 16, U32, (U8)wasmV128PopCount8(x))
+DEFINE_V128_ALL_TRUE(i8x16_all_true, u8, 16)
+DEFINE_V128_BINARY(i8x16_add, u8, 16, U32, +)
+DEFINE_V128_BINARY(i8x16_sub, u8, 16, U32, -)
+DEFINE_V128_SHIFT(i8x16_shl, u8, 16, 8, <<)
+DEFINE_V128_SHIFT(i8x16_shr_s, i8, 16, 8, >>)
+DEFINE_V128_SHIFT(i8x16_shr_u, u8, 16, 8, >>)
+DEFINE_V128_BINARY_EXPR(i8x16_min_s, i8, i8, 16, I8, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i8x16_min_u, u8, u8, 16, U8, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i8x16_max_s, i8, i8, 16, I8, x > y ? x : y)
+DEFINE_V128_BINARY_EXPR(i8x16_max_u, u8, u8, 16, U8, x > y ? x : y)
+
+DEFINE_V128_UNARY(i16x8_abs, u16, i16, 8, I16, (U16)(x < 0 ? 0U - (U32)x : (U32)x))
+DEFINE_V128_NEG(i16x8_neg, u16, 8, U32)
+DEFINE_V128_ALL_TRUE(i16x8_all_true, u16, 8)
+DEFINE_V128_BITMASK(i16x8_bitmask, i16, 8)
+DEFINE_V128_BINARY(i16x8_add, u16, 8, U32, +)
+DEFINE_V128_BINARY(i16x8_sub, u16, 8, U32, -)
+DEFINE_V128_BINARY(i16x8_mul, u16, 8, U32, *)
+DEFINE_V128_SHIFT(i16x8_shl, u16, 8, 16, <<)
+DEFINE_V128_SHIFT(i16x8_shr_s, i16, 8, 16, >>)
+DEFINE_V128_SHIFT(i16x8_shr_u, u16, 8, 16, >>)
+DEFINE_V128_BINARY_EXPR(i16x8_min_s, i16, i16, 8, I16, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i16x8_min_u, u16, u16, 8, U16, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i16x8_max_s, i16, i16, 8, I16, x > y ? x : y)
+DEFINE_V128_BINARY_EXPR(i16x8_max_u, u16, u16, 8, U16, x > y ? x : y)
+DEFINE_V128_BINARY_EXPR(
+    i16x8_q15mulr_sat_s, i16, i16, 8, I32,
+    (I16)V128_SATURATE((x * y + 0x4000) >> 15, -32768, 32767)
+)
+DEFINE_V128_EXTADD_PAIRWISE(i16x8_extadd_pairwise_i8x16_s, i16, 8, i8, I16)
+DEFINE_V128_EXTADD_PAIRWISE(i16x8_extadd_pairwise_i8x16_u, u16, 8, u8, U16)
+DEFINE_V128_EXTEND(i16x8_extend_low_i8x16_s, i16, 8, i8, 0, I16)
+DEFINE_V128_EXTEND(i16x8_extend_high_i8x16_s, i16, 8, i8, 8, I16)
+DEFINE_V128_EXTEND(i16x8_extend_low_i8x16_u, u16, 8, u8, 0, U16)
+DEFINE_V128_EXTEND(i16x8_extend_high_i8x16_u, u16, 8, u8, 8, U16)
+DEFINE_V128_EXTMUL(i16x8_extmul_low_i8x16_s, i16, 8, i8, 0, I16)
+DEFINE_V128_EXTMUL(i16x8_extmul_high_i8x16_s, i16, 8, i8, 8, I16)
+DEFINE_V128_EXTMUL(i16x8_extmul_low_i8x16_u, u16, 8, u8, 0, U16)
+DEFINE_V128_EXTMUL(i16x8_extmul_high_i8x16_u, u16, 8, u8, 8, U16)
+DEFINE_V128_NARROW(i16x8_narrow_i32x4_u, u16, 8, i32, U16, 0, 65535)
+
+DEFINE_V128_UNARY(i32x4_abs, u32, i32, 4, I32, x < 0 ? 0U - (U32)x : (U32)x)
+DEFINE_V128_NEG(i32x4_neg, u32, 4, U32)
+DEFINE_V128_ALL_TRUE(i32x4_all_true, u32, 4)
+DEFINE_V128_BINARY(i32x4_add, u32, 4, U32, +)
+DEFINE_V128_BINARY(i32x4_sub, u32, 4, U32, -)
+DEFINE_V128_BINARY(i32x4_mul, u32, 4, U32, *)
+DEFINE_V128_SHIFT(i32x4_shl, u32, 4, 32, <<)
+DEFINE_V128_SHIFT(i32x4_shr_s, i32, 4, 32, >>)
+DEFINE_V128_SHIFT(i32x4_shr_u, u32, 4, 32, >>)
+DEFINE_V128_BINARY_EXPR(i32x4_min_s, i32, i32, 4, I32, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i32x4_min_u, u32, u32, 4, U32, x < y ? x : y)
+DEFINE_V128_BINARY_EXPR(i32x4_max_s, i32, i32, 4, I32, x > y ? x : y)
+DEFINE_V128_BINARY_EXPR(i32x4_max_u, u32, u32, 4, U32, x > y ? x : y)
+DEFINE_V128_EXTADD_PAIRWISE(i32x4_extadd_pairwise_i16x8_s, i32, 4, i16, I32)
+DEFINE_V128_EXTADD_PAIRWISE(i32x4_extadd_pairwise_i16x8_u, u32, 4, u16, U32)
+DEFINE_V128_EXTEND(i32x4_extend_low_i16x8_s, i32, 4, i16, 0, I32)
+DEFINE_V128_EXTEND(i32x4_extend_high_i16x8_s, i32, 4, i16, 4, I32)
+DEFINE_V128_EXTEND(i32x4_extend_low_i16x8_u, u32, 4, u16, 0, U32)
+DEFINE_V128_EXTEND(i32x4_extend_high_i16x8_u, u32, 4, u16, 4, U32)
+DEFINE_V128_EXTMUL(i32x4_extmul_low_i16x8_s, i32, 4, i16, 0, I32)
+DEFINE_V128_EXTMUL(i32x4_extmul_high_i16x8_s, i32, 4, i16, 4, I32)
+DEFINE_V128_EXTMUL(i32x4_extmul_low_i16x8_u, u32, 4, u16, 0, U32)
+DEFINE_V128_EXTMUL(i32x4_extmul_high_i16x8_u, u32, 4, u16, 4, U32)
+
+DEFINE_V128_UNARY(i64x2_abs, u64, i64, 2, I64, x < 0 ? 0U - (U64)x : (U64)x)
+DEFINE_V128_NEG(i64x2_neg, u64, 2, U64)
+DEFINE_V128_ALL_TRUE(i64x2_all_true, u64, 2)
+DEFINE_V128_BITMASK(i64x2_bitmask, i64, 2)
+DEFINE_V128_BINARY(i64x2_add, u64, 2, U64, +)
+DEFINE_V128_BINARY(i64x2_sub, u64, 2, U64, -)
+DEFINE_V128_BINARY(i64x2_mul, u64, 2, U64, *)
+DEFINE_V128_SHIFT(i64x2_shl, u64, 2, 64, <<)
+DEFINE_V128_SHIFT(i64x2_shr_s, i64, 2, 64, >>)
+DEFINE_V128_SHIFT(i64x2_shr_u, u64, 2, 64, >>)
+DEFINE_V128_EXTEND(i64x2_extend_low_i32x4_s, i64, 2, i32, 0, I64)
+DEFINE_V128_EXTEND(i64x2_extend_high_i32x4_s, i64, 2, i32, 2, I64)
+DEFINE_V128_EXTEND(i64x2_extend_low_i32x4_u, u64, 2, u32, 0, U64)
+DEFINE_V128_EXTEND(i64x2_extend_high_i32x4_u, u64, 2, u32, 2, U64)
+DEFINE_V128_EXTMUL(i64x2_extmul_low_i32x4_s, i64, 2, i32, 0, I64)
+DEFINE_V128_EXTMUL(i64x2_extmul_high_i32x4_s, i64, 2, i32, 2, I64)
+DEFINE_V128_EXTMUL(i64x2_extmul_low_i32x4_u, u64, 2, u32, 0, U64)
+DEFINE_V128_EXTMUL(i64x2_extmul_high_i32x4_u, u64, 2, u32, 2, U64)
+
+/* Saturating arithmetic and rounding average */
+
+#if WASM_SIMD_SSE2
+
+DEFINE_V128_INTRINSIC(i8x16_add_sat_s, __m128i, _mm_adds_epi8)
+DEFINE_V128_INTRINSIC(i8x16_add_sat_u, __m128i, _mm_adds_epu8)
+DEFINE_V128_INTRINSIC(i8x16_sub_sat_s, __m128i, _mm_subs_epi8)
+DEFINE_V128_INTRINSIC(i8x16_sub_sat_u, __m128i, _mm_subs_epu8)
+DEFINE_V128_INTRINSIC(i16x8_add_sat_s, __m128i, _mm_adds_epi16)
+DEFINE_V128_INTRINSIC(i16x8_add_sat_u, __m128i, _mm_adds_epu16)
+DEFINE_V128_INTRINSIC(i16x8_sub_sat_s, __m128i, _mm_subs_epi16)
+DEFINE_V128_INTRINSIC(i16x8_sub_sat_u, __m128i, _mm_subs_epu16)
+DEFINE_V128_INTRINSIC(i8x16_avgr_u, __m128i, _mm_avg_epu8)
+DEFINE_V128_INTRINSIC(i16x8_avgr_u, __m128i, _mm_avg_epu16)
+
+#elif WASM_SIMD_NEON
+
+DEFINE_V128_INTRINSIC(i8x16_add_sat_s, int8x16_t, vqaddq_s8)
+DEFINE_V128_INTRINSIC(i8x16_add_sat_u, uint8x16_t, vqaddq_u8)
+DEFINE_V128_INTRINSIC(i8x16_sub_sat_s, int8x16_t, vqsubq_s8)
+DEFINE_V128_INTRINSIC(i8x16_sub_sat_u, uint8x16_t, vqsubq_u8)
+DEFINE_V128_INTRINSIC(i16x8_add_sat_s, int16x8_t, vqaddq_s16)
+DEFINE_V128_INTRINSIC(i16x8_add_sat_u, uint16x8_t, vqaddq_u16)
+DEFINE_V128_INTRINSIC(i16x8_sub_sat_s, int16x8_t, vqsubq_s16)
+DEFINE_V128_INTRINSIC(i16x8_sub_sat_u, uint16x8_t, vqsubq_u16)
+DEFINE_V128_INTRINSIC(i8x16_avgr_u, uint8x16_t, vrhaddq_u8)
+DEFINE_V128_INTRINSIC(i16x8_avgr_u, uint16x8_t, vrhaddq_u16)
+
+#else
+
+DEFINE_V128_BINARY_EXPR(i8x16_add_sat_s, i8, i8, 16, I32, (I8)V128_SATURATE(x + y, -128, 127))
+DEFINE_V128_BINARY_EXPR(i8x16_add_sat_u, u8, u8, 16, I32, (U8)V128_SATURATE(x + y, 0, 255))
+DEFINE_V128_BINARY_EXPR(i8x16_sub_sat_s, i8, i8, 16, I32, (I8)V128_SATURATE(x - y, -128, 127))
+DEFINE_V128_BINARY_EXPR(i8x16_sub_sat_u, u8, u8, 16, I32, (U8)V128_SATURATE(x - y, 0, 255))
+DEFINE_V128_BINARY_EXPR(i16x8_add_sat_s, i16, i16, 8, I32, (I16)V128_SATURATE(x + y, -32768, 32767))
+DEFINE_V128_BINARY_EXPR(i16x8_add_sat_u, u16, u16, 8, I32, (U16)V128_SATURATE(x + y, 0, 65535))
+DEFINE_V128_BINARY_EXPR(i16x8_sub_sat_s, i16, i16, 8, I32, (I16)V128_SATURATE(x - y, -32768, 32767))
+DEFINE_V128_BINARY_EXPR(i16x8_sub_sat_u, u16, u16, 8, I32, (U16)V128_SATURATE(x - y, 0, 65535))
+DEFINE_V128_BINARY_EXPR(i8x16_avgr_u, u8, u8, 16, U32, (U8)((x + y + 1) >> 1))
+DEFINE_V128_BINARY_EXPR(i16x8_avgr_u, u16, u16, 8, U32, (U16)((x + y + 1) >> 1))
+
+#endif
+
+/* Narrowing, dot product, and bitmask */
+
+#if WASM_SIMD_SSE2
+
+DEFINE_V128_INTRINSIC(i8x16_narrow_i16x8_s, __m128i, _mm_packs_epi16)
+DEFINE_V128_INTRINSIC(i8x16_narrow_i16x8_u, __m128i, _mm_packus_epi16)
+DEFINE_V128_INTRINSIC(i16x8_narrow_i32x4_s, __m128i, _mm_packs_epi32)
+DEFINE_V128_INTRINSIC(i32x4_dot_i16x8_s, __m128i, _mm_madd_epi16)
+
+static W2C2_INLINE U32 i8x16_bitmask(V128 a) {
+    return (U32)_mm_movemask_epi8((__m128i)a.i64);
+}
+
+static W2C2_INLINE U32 i32x4_bitmask(V128 a) {
+    return (U32)_mm_movemask_ps((__m128)a.f32);
+}
+
+#else
+
+DEFINE_V128_NARROW(i8x16_narrow_i16x8_s, i8, 16, i16, I8, -128, 127)
+DEFINE_V128_NARROW(i8x16_narrow_i16x8_u, u8, 16, i16, U8, 0, 255)
+DEFINE_V128_NARROW(i16x8_narrow_i32x4_s, i16, 8, i32, I16, -32768, 32767)
+
+static W2C2_INLINE V128 i32x4_dot_i16x8_s(V128 a, V128 b) {
+    V128 r;
+    U32 l = 0;
+    for (; l < 4; l++) {
+        const U32 i = V128_LANE(8, l * 2);
+        const U32 j = V128_LANE(8, l * 2 + 1);
+        r.u32[V128_LANE(4, l)] =
+            (U32)((I32)a.i16[i] * (I32)b.i16[i])
+            + (U32)((I32)a.i16[j] * (I32)b.i16[j]);
+    }
+    return r;
+}
+
+DEFINE_V128_BITMASK(i8x16_bitmask, i8, 16)
+DEFINE_V128_BITMASK(i32x4_bitmask, i32, 4)
+
+#endif /* WASM_SIMD_SSE2 */
+
+/* Floating-point arithmetic */
+
+DEFINE_V128_UNARY(f32x4_abs, u32, u32, 4, U32, x & 0x7FFFFFFFU)
+DEFINE_V128_UNARY(f32x4_neg, u32, u32, 4, U32, x ^ 0x80000000U)
+DEFINE_V128_UNARY(f32x4_sqrt, f32, f32, 4, F32, F32_SQRT(x))
+DEFINE_V128_UNARY(f32x4_ceil, f32, f32, 4, F32, F32_CEIL(x))
+DEFINE_V128_UNARY(f32x4_floor, f32, f32, 4, F32, F32_FLOOR(x))
+DEFINE_V128_UNARY(f32x4_trunc, f32, f32, 4, F32, F32_TRUNC(x))
+DEFINE_V128_UNARY(f32x4_nearest, f32, f32, 4, F32, F32_NEAREST(x))
+DEFINE_V128_BINARY(f32x4_add, f32, 4, F32, +)
+DEFINE_V128_BINARY(f32x4_sub, f32, 4, F32, -)
+DEFINE_V128_BINARY(f32x4_mul, f32, 4, F32, *)
+DEFINE_V128_BINARY(f32x4_div, f32, 4, F32, /)
+DEFINE_V128_BINARY_EXPR(f32x4_min, f32, f32, 4, F32, FMIN(x, y))
+DEFINE_V128_BINARY_EXPR(f32x4_max, f32, f32, 4, F32, FMAX(x, y))
+DEFINE_V128_BINARY_EXPR(f32x4_pmin, f32, f32, 4, F32, y < x ? y : x)
+DEFINE_V128_BINARY_EXPR(f32x4_pmax, f32, f32, 4, F32, x < y ? y : x)
+
+DEFINE_V128_UNARY(f64x2_abs, u64, u64, 2, U64, x & W2C2_LL(0x7FFFFFFFFFFFFFFFU))
+DEFINE_V128_UNARY(f64x2_neg, u64, u64, 2, U64, x ^ W2C2_LL(0x8000000000000000U))
+DEFINE_V128_UNARY(f64x2_sqrt, f64, f64, 2, F64, sqrt(x))
+DEFINE_V128_UNARY(f64x2_ceil, f64, f64, 2, F64, ceil(x))
+DEFINE_V128_UNARY(f64x2_floor, f64, f64, 2, F64, floor(x))
+DEFINE_V128_UNARY(f64x2_trunc, f64, f64, 2, F64, F64_TRUNC(x))
+DEFINE_V128_UNARY(f64x2_nearest, f64, f64, 2, F64, F64_NEAREST(x))
+DEFINE_V128_BINARY(f64x2_add, f64, 2, F64, +)
+DEFINE_V128_BINARY(f64x2_sub, f64, 2, F64, -)
+DEFINE_V128_BINARY(f64x2_mul, f64, 2, F64, *)
+DEFINE_V128_BINARY(f64x2_div, f64, 2, F64, /)
+DEFINE_V128_BINARY_EXPR(f64x2_min, f64, f64, 2, F64, FMIN(x, y))
+DEFINE_V128_BINARY_EXPR(f64x2_max, f64, f64, 2, F64, FMAX(x, y))
+DEFINE_V128_BINARY_EXPR(f64x2_pmin, f64, f64, 2, F64, y < x ? y : x)
+DEFINE_V128_BINARY_EXPR(f64x2_pmax, f64, f64, 2, F64, x < y ? y : x)
+
+/* Conversions */
+
+DEFINE_V128_UNARY(i32x4_trunc_sat_f32x4_s, i32, f32, 4, F32, V128_I32_TRUNC_SAT_S(x))
+DEFINE_V128_UNARY(i32x4_trunc_sat_f32x4_u, u32, f32, 4, F32, V128_I32_TRUNC_SAT_U(x))
+DEFINE_V128_UNARY(f32x4_convert_i32x4_s, f32, i32, 4, I32, (F32)x)
+DEFINE_V128_UNARY(f32x4_convert_i32x4_u, f32, u32, 4, U32, (F32)x)
+DEFINE_V128_DEMOTE(i32x4_trunc_sat_f64x2_s_zero, i32, f64, F64, V128_I32_TRUNC_SAT_S(x))
+DEFINE_V128_DEMOTE(i32x4_trunc_sat_f64x2_u_zero, u32, f64, F64, V128_I32_TRUNC_SAT_U(x))
+DEFINE_V128_DEMOTE(f32x4_demote_f64x2_zero, f32, f64, F64, (F32)x)
+DEFINE_V128_EXTEND(f64x2_promote_low_f32x4, f64, 2, f32, 0, F64)
+DEFINE_V128_EXTEND(f64x2_convert_low_i32x4_s, f64, 2, i32, 0, F64)
+DEFINE_V128_EXTEND(f64x2_convert_low_i32x4_u, f64, 2, u32, 0, F64)
+
+/* Loads and stores */
+
+static W2C2_INLINE V128 v128_load_data(U8* data, U64 addr) {
+    V128 r;
+    memcpy(&r, &data[addr], sizeof(r));
+    wasmV128Swap(&r);
+    return r;
+}
+
+static W2C2_INLINE void v128_store_data(U8* data, U64 addr, V128 value) {
+    wasmV128Swap(&value);
+    memcpy(&data[addr], &value, sizeof(value));
+}
+
+/* DEFINE_V128_LOAD_EXTEND: loads narrow values from memory into wider lanes */
+
+#define DEFINE_V128_LOAD_EXTEND(name, rlanes, count, load, t1, t2)                     \
+    static W2C2_INLINE V128 name##_data(U8* data, U64 addr) {                          \
+        V128 r;                                                                        \
+        U32 l = 0;                                                                     \
+        for (; l < count; l++) {                                                       \
+            r.rlanes[V128_LANE(count, l)] = (t1)(t2)load##_data(data, addr + l * (8 / count)); \
+        }                                                                              \
+        return r;                                                                      \
+    }
+
+/* DEFINE_V128_LOAD_SPLAT: loads a value from memory into all lanes */
+
+#define DEFINE_V128_LOAD_SPLAT(name, load, splat)             \
+    static W2C2_INLINE V128 name##_data(U8* data, U64 addr) { \
+        return splat(load##_data(data, addr));                \
+    }
+
+/* DEFINE_V128_LOAD_ZERO: loads a value from memory into the first lane, zeroing the others */
+
+#define DEFINE_V128_LOAD_ZERO(name, lanes, count, load)       \
+    static W2C2_INLINE V128 name##_data(U8* data, U64 addr) { \
+        V128 r = v128_zero();                                 \
+        r.lanes[V128_LANE(count, 0)] = load##_data(data, addr); \
+        return r;                                             \
+    }
+
+/* DEFINE_V128_LOAD_LANE: loads a value from memory into one lane */
+
+#define DEFINE_V128_LOAD_LANE(name, lanes, count, load, t)                         \
+    static W2C2_INLINE V128 name##_data(U8* data, U64 addr, V128 v, U32 lane) {    \
+        v.lanes[V128_LANE(count, lane)] = (t)load##_data(data, addr);              \
+        return v;                                                                  \
+    }                                                                              \
+    static W2C2_INLINE V128 name(wasmMemory* mem, U64 addr, V128 v, U32 lane) {    \
+        return name##_data(mem->data, addr, v, lane);                              \
+    }
+
+/* DEFINE_V128_STORE_LANE: stores one lane to memory */
+
+#define DEFINE_V128_STORE_LANE(name, lanes, count, store)                          \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, V128 v, U32 lane) {    \
+        store##_data(data, addr, v.lanes[V128_LANE(count, lane)]);                 \
+    }                                                                              \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, V128 v, U32 lane) {    \
+        name##_data(mem->data, addr, v, lane);                                     \
+    }
+
+/* DEFINE_V128_LOAD */
+
+#define DEFINE_V128_LOAD(name)                                  \
+    static W2C2_INLINE V128 name(wasmMemory* mem, U64 addr) {   \
+        return name##_data(mem->data, addr);                    \
+    }
+
+DEFINE_V128_LOAD_EXTEND(v128_load8x8_s, i16, 8, i32_load8_s, I16, I32)
+DEFINE_V128_LOAD_EXTEND(v128_load8x8_u, u16, 8, i32_load8_u, U16, U32)
+DEFINE_V128_LOAD_EXTEND(v128_load16x4_s, i32, 4, i32_load16_s, I32, I32)
+DEFINE_V128_LOAD_EXTEND(v128_load16x4_u, u32, 4, i32_load16_u, U32, U32)
+DEFINE_V128_LOAD_EXTEND(v128_load32x2_s, i64, 2, i64_load32_s, I64, I64)
+DEFINE_V128_LOAD_EXTEND(v128_load32x2_u, u64, 2, i64_load32_u, U64, U64)
+DEFINE_V128_LOAD_SPLAT(v128_load8_splat, i32_load8_u, i8x16_splat)
+DEFINE_V128_LOAD_SPLAT(v128_load16_splat, i32_load16_u, i16x8_splat)
+DEFINE_V128_LOAD_SPLAT(v128_load32_splat, i32_load, i32x4_splat)
+DEFINE_V128_LOAD_SPLAT(v128_load64_splat, i64_load, i64x2_splat)
+DEFINE_V128_LOAD_ZERO(v128_load32_zero, u32, 4, i32_load)
+DEFINE_V128_LOAD_ZERO(v128_load64_zero, u64, 2, i64_load)
+
+DEFINE_V128_LOAD(v128_load)
+DEFINE_V128_LOAD(v128_load8x8_s)
+DEFINE_V128_LOAD(v128_load8x8_u)
+DEFINE_V128_LOAD(v128_load16x4_s)
+DEFINE_V128_LOAD(v128_load16x4_u)
+DEFINE_V128_LOAD(v128_load32x2_s)
+DEFINE_V128_LOAD(v128_load32x2_u)
+DEFINE_V128_LOAD(v128_load8_splat)
+DEFINE_V128_LOAD(v128_load16_splat)
+DEFINE_V128_LOAD(v128_load32_splat)
+DEFINE_V128_LOAD(v128_load64_splat)
+DEFINE_V128_LOAD(v128_load32_zero)
+DEFINE_V128_LOAD(v128_load64_zero)
+
+static W2C2_INLINE void v128_store(wasmMemory* mem, U64 addr, V128 value) {
+    v128_store_data(mem->data, addr, value);
+}
+
+DEFINE_V128_LOAD_LANE(v128_load8_lane, u8, 16, i32_load8_u, U8)
+DEFINE_V128_LOAD_LANE(v128_load16_lane, u16, 8, i32_load16_u, U16)
+DEFINE_V128_LOAD_LANE(v128_load32_lane, u32, 4, i32_load, U32)
+DEFINE_V128_LOAD_LANE(v128_load64_lane, u64, 2, i64_load, U64)
+DEFINE_V128_STORE_LANE(v128_store8_lane, u8, 16, i32_store8)
+DEFINE_V128_STORE_LANE(v128_store16_lane, u16, 8, i32_store16)
+DEFINE_V128_STORE_LANE(v128_store32_lane, u32, 4, i32_store)
+DEFINE_V128_STORE_LANE(v128_store64_lane, u64, 2, i64_store)
+
 typedef void (*wasmFunc)(void);
 
 typedef struct wasmTable {
@@ -1105,8 +2686,58 @@ wasmTableFree(
     table->size = 0;
 }
 
+/* wasmTableReset clears all elements of the given table, but keeps its allocation */
+static
+W2C2_INLINE
+void
+wasmTableReset(
+    wasmTable* table
+) {
+    if (table->data == NULL) {
+        return;
+    }
+
+    memset(table->data, 0, table->size * sizeof(wasmFunc));
+}
+
 #define TF(table, index, t) ((t)((table).data[index]))
 
+/*
+ * Tail calls between functions with the same signature use musttail, if available.
+ * Otherwise, the calling function stores the arguments of the tail call in the instance,
+ * returns to the closest trampoline loop, which then calls the target through a thunk.
+ */
+#ifndef WASM_TAIL_CALL_MUSTTAIL
+#if defined(__clang__) && defined(__has_attribute)
+#if __has_attribute(musttail)
+#define WASM_TAIL_CALL_MUSTTAIL 1
+#endif
+#endif
+#endif
+
+#ifndef WASM_TAIL_CALL_MUSTTAIL
+#define WASM_TAIL_CALL_MUSTTAIL 0
+#endif
+
+typedef union wasmTailCallArgument {
+    U32 i32;
+    U64 i64;
+    F32 f32;
+    F64 f64;
+    V128 v128;
+} wasmTailCallArgument;
+
+static
+W2C2_INLINE
+wasmFunc
+wasmTailCallNext(
+    wasmFunc* thunk
+) {
+    wasmFunc result = *thunk;
+    *thunk = NULL;
+    return result;
+}
+
 typedef struct wasmFuncExport {
     wasmFunc func;
     char* name;
@@ -1118,6 +2749,70 @@ typedef struct wasmModuleInstance {
     struct wasmModuleInstance* (*newChild)(struct wasmModuleInstance* self);
 } wasmModuleInstance;
 
+/*
+ * wasmInstancePool holds instances of a module that were reset and can be reused,
+ * see the generated AcquireInstance and ReleaseInstance functions.
+ * A zero-initialized pool is empty. Pools are not thread-safe.
+ */
+typedef struct wasmInstancePool {
+    wasmModuleInstance** instances;
+    size_t count;
+    size_t capacity;
+} wasmInstancePool;
+
+/* wasmInstancePoolTake removes an instance from the given pool. Returns NULL if the pool is empty */
+static
+W2C2_INLINE
+wasmModuleInstance*
+wasmInstancePoolTake(
+    wasmInstancePool* pool
+) {
+    if (pool->count == 0) {
+        return NULL;
+    }
+    pool->count--;
+    return pool->instances[pool->count];
+}
+
+/* wasmInstancePoolPut adds the given instance to the given pool. Returns false if the pool cannot grow */
+static
+W2C2_INLINE
+bool
+WARN_UNUSED_RESULT
+wasmInstancePoolPut(
+    wasmInstancePool* pool,
+    wasmModuleInstance* instance
+) {
+    if (pool->count == pool->capacity) {
+        const size_t capacity = pool->capacity > 0 ? pool->capacity * 2 : 8;
+        wasmModuleInstance** instances = (wasmModuleInstance**)realloc(
+            pool->instances,
+            capacity * sizeof(wasmModuleInstance*)
+        );
+        if (instances == NULL) {
+            return false;
+        }
+        pool->instances = instances;
+        pool->capacity = capacity;
+    }
+    pool->instances[pool->count] = instance;
+    pool->count++;
+    return true;
+}
+
+/* wasmInstancePoolFree frees the storage of the given pool, which must be empty */
+static
+W2C2_INLINE
+void
+wasmInstancePoolFree(
+    wasmInstancePool* pool
+) {
+    free(pool->instances);
+    pool->instances = NULL;
+    pool->count = 0;
+    pool->capacity = 0;
+}
+
 
 #ifndef __has_feature
 #define __has_feature(x) 0
@@ -1263,20 +2958,26 @@ typedef struct wasmModuleInstance {
 #if WASM_ENDIAN == WASM_LITTLE_ENDIAN
 
 #define DEFINE_ATOMIC_LOAD(name, t1, t2)                    \
-    static W2C2_INLINE t2 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t2 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        result = atomic_load_##t1(&mem->data[addr]);        \
+        result = atomic_load_##t1(&data[addr]);             \
         return (t2)result;                                  \
+    }                                                       \
+    static W2C2_INLINE t2 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_ATOMIC_LOAD(name, t1, t2)                    \
-    static W2C2_INLINE t2 name(wasmMemory* mem, U64 addr) { \
+    static W2C2_INLINE t2 name##_data(U8* data, U64 addr) { \
         t1 result;                                          \
-        result = atomic_load_##t1(&mem->data[addr]);        \
+        result = atomic_load_##t1(&data[addr]);             \
         result = swap##t1(result);                          \
         return (t2)result;                                  \
+    }                                                       \
+    static W2C2_INLINE t2 name(wasmMemory* mem, U64 addr) { \
+        return name##_data(mem->data, addr);                \
     }
 
 #endif
@@ -1292,18 +2993,24 @@ DEFINE_ATOMIC_LOAD(i64_atomic_load, U64, U64)
 #if WASM_ENDIAN == WASM_LITTLE_ENDIAN
 
 #define DEFINE_ATOMIC_STORE(name, t1, t2)                               \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
-        atomic_store_##t1(&mem->data[addr], wrapped);                   \
+        atomic_store_##t1(&data[addr], wrapped);                        \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 #elif WASM_ENDIAN == WASM_BIG_ENDIAN
 
 #define DEFINE_ATOMIC_STORE(name, t1, t2)                               \
-    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+    static W2C2_INLINE void name##_data(U8* data, U64 addr, t2 value) { \
         t1 wrapped = (t1)value;                                         \
         wrapped = swap##t1(wrapped);                                    \
-        atomic_store_##t1(&mem->data[addr], wrapped);                   \
+        atomic_store_##t1(&data[addr], wrapped);                        \
+    }                                                                   \
+    static W2C2_INLINE void name(wasmMemory* mem, U64 addr, t2 value) { \
+        name##_data(mem->data, addr, value);                            \
     }
 
 #endif